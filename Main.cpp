@@ -2,24 +2,41 @@
 #include "include/BackgroundUtil.h"
 #include "include/SkyboxUtil.h"
 #include "include/Init.h"
-
-// Global Variables
-// ----------------
-std::vector<float> vertices, normals, uvs, moonVertices, moonNormals, moonUVs;
-std::vector<unsigned int> indices, moonIndices;
+#include "include/LodUtil.h"
+#include "include/UvUtil.h"
+#include "include/MeshRegistryUtil.h"
+#include "include/ImpostorUtil.h"
+#include "include/TerrainUtil.h"
+#include "include/SimulationUtil.h"
+#include "include/MeshExportUtil.h"
+#include "include/UniformUtil.h"
+#include "include/BodyRendererUtil.h"
+#include "include/RenderQueueUtil.h"
+#include "include/StreamBufferUtil.h"
+#include "include/StaticIcosphereUtil.h"
 
 // OpenGL Buffer and Texture IDs
 // -----------------------------
-unsigned int VBO, VAO, EBO, normalVBO, uvVBO, textureID, normalMap;
-unsigned int moonVBO, moonVAO, moonEBO, moonNormalVBO, moonTextureID;
+unsigned int VBO, VAO, EBO;
 unsigned int skyboxVAO, skyboxVBO, skyboxEBO, cubemapTexture;
 unsigned int skyboxShaderProgram;
 
+// Meshlets of every Sphere LOD Level (shared by all Bodies)
+// ---------------------------------------------------------
+std::vector<Meshlet> sphereLodMeshlets[LOD_LEVEL_COUNT];
+
+// Earth: Handle of the shared Sphere Mesh, Material and LOD State
+// ---------------------------------------------------------------
+MeshHandle earthMesh = INVALID_MESH_HANDLE;
+Material earthMaterial;
+LodState earthLod;
+
 // Function Declarations
 // ---------------------
 
 void updateLightPos();
 void calculateMatrices(glm::mat4& view, glm::mat4& projection);
+glm::mat4 earthModelMatrix();
 void drawEarth(unsigned int shaderProgram, glm::mat4 view, glm::mat4 projection);
 
 // Position Vectors
@@ -28,20 +45,66 @@ glm::vec3 lightPos(15.0f, 15.0f, 15.0f);   // Lightsource
 glm::vec3 lightColor(1.0f, 0.95f, 0.8f); // Lightcolor and -intensity
 glm::vec3 earthPos(0.0f, 0.0f, 0.0f); // Position of Earth
 
-int main()
+int main(int argc, char** argv)
 {
+    // Command Line: --analytic-tbn derives the Tangent Frame in the Shader instead of storing it,
+    // --procedural draws the Spheres from gl_VertexID without any Vertex Buffers,
+    // --cube-sphere uses Cube Spheres with Cube Map Surfaces instead of Icospheres,
+    // --tessellate refines Icosphere Patches on the GPU by their Screen-Space Error (OpenGL 4.0),
+    // --heat / --tracer run a Heat Diffusion / Tracer Advection on the Earth Mesh as a Color Overlay,
+    // --bench-uvs compares the SIMD UV Pass with the scalar one and exits,
+    // --export-mesh <level> <path> writes the Sphere as <path>.glb and <path>.ply and exits,
+    // --generate-static-icosphere <path> writes the embedded Icosphere Levels as a C++ Header and exits
+    // ------------------------------------------------------------------------------------------------
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::string(argv[i]) == "--analytic-tbn")
+            tangentFrameMode = TangentFrameMode::Analytic;
+        if (std::string(argv[i]) == "--procedural")
+            sphereGeometryMode = SphereGeometryMode::Procedural;
+        if (std::string(argv[i]) == "--cube-sphere")
+            sphereGeometryMode = SphereGeometryMode::CubeSphere;
+        if (std::string(argv[i]) == "--tessellate")
+            sphereGeometryMode = SphereGeometryMode::Tessellated;
+        if (std::string(argv[i]) == "--heat")
+            simulationMode = SimulationMode::Heat;
+        if (std::string(argv[i]) == "--tracer")
+            simulationMode = SimulationMode::Tracer;
+        if (std::string(argv[i]) == "--bench-uvs")
+            return benchmarkUVs() ? 0 : 1;
+        if (std::string(argv[i]) == "--export-mesh" && i + 2 < argc)
+        {
+            char* end = nullptr;
+            unsigned long level = std::strtoul(argv[i + 1], &end, 10);
+            if (end == argv[i + 1] || *end != '\0' || argv[i + 1][0] == '-' || level > EXPORT_MAX_LEVEL)
+            {
+                std::cout << "Usage: --export-mesh <level> <path> (level 0 - " << EXPORT_MAX_LEVEL << ")" << std::endl;
+                return 1;
+            }
+            return exportSphereMesh((unsigned int)level, argv[i + 2]) ? 0 : 1;
+        }
+        if (std::string(argv[i]) == "--generate-static-icosphere" && i + 1 < argc)
+            return writeStaticIcosphereHeader(argv[i + 1]) ? 0 : 1;
+    }
+
     // Prepare Libraries and initialize rendering Requirements
     // --------------------------------------------------------
 	GLFWwindow* window = initGLFW_GLAD();
 	unsigned int shaderProgram = initShaders_Buffers();
+    earthMesh = findMesh(SPHERE_MESH_NAME);
 
+    initFrameUniforms();
+    initStreamBuffers();
+    initBodyRenderer(earthMesh);
     initMoon();
+    initImpostors();
     initSkybox();
+    initTerrain();
+    initSimulation();
 
     glEnable(GL_DEPTH_TEST);
 
-    textureID = loadTexture("resources/earthmap.png");
-	normalMap = loadTexture("resources/Earth_Normal.png");
+    earthMaterial = loadBodyMaterial("resources/earthmap.png", "resources/Earth_Normal.png");
 
     // Render Loop
     // -----------
@@ -55,10 +118,23 @@ int main()
 		glm::mat4 view, projection;
 
 		calculateMatrices(view, projection);
-        drawSkybox(view, projection);
+        updateFrameUniforms(view, projection, lightPos, lightColor, cameraPos, earthPos);
+        drawSkybox();
 
 		drawEarth(shaderProgram, view, projection);
         drawMoon(shaderProgram, view, projection);
+        drawBodies();
+
+        // Simulation Step and Overlay (Sun Direction in the Earth's Object Space)
+        // -----------------------------------------------------------------------
+        glm::mat4 earthModel = earthModelMatrix();
+        stepSimulation(glm::normalize(glm::vec3(glm::inverse(earthModel) * glm::vec4(lightPos - earthPos, 0.0f))));
+        drawSimulationOverlay(earthModel);
+
+        // Run the queued Draws sorted by Pass, Program, Material and Mesh
+        // ---------------------------------------------------------------
+        flushRenderQueue();
+        endStreamFrame();
 
         // Swap Buffers and Poll IO Events
         // -------------------------------
@@ -68,12 +144,12 @@ int main()
 
     // De-allocate all Resources
     // -------------------------
-    glDeleteVertexArrays(1, &VAO);
-    glDeleteBuffers(1, &VBO);
-    glDeleteBuffers(1, &normalVBO);
-    glDeleteBuffers(1, &uvVBO);
-    glDeleteBuffers(1, &EBO);
+    releaseBodyRenderer();
+    releaseMeshes();
+    releaseFrameUniforms();
+    releaseStreamBuffers();
     glDeleteProgram(shaderProgram);
+    shutdownTerrain();
 
     glfwTerminate();
     return 0;
@@ -105,10 +181,20 @@ void calculateMatrices(glm::mat4& view, glm::mat4& projection)
     projection = glm::perspective(
         glm::radians(45.0f),                    // FOV
         (float)SCR_WIDTH / (float)SCR_HEIGHT,   // Aspect ratio
-        0.1f, 100.0f                            // Sight
+        cameraNearPlane(), CAMERA_FAR           // Sight (Near Plane follows the Altitude)
     );
 }
 
+/**
+ * Model Matrix of the Earth (Rotation around its own Axis)
+ * @return Model Matrix
+ */
+glm::mat4 earthModelMatrix()
+{
+    glm::mat4 model = glm::mat4(1.0f);
+    return glm::rotate(model, (float)glfwGetTime() * glm::radians(EARTH_ROTATION_SPEED), glm::vec3(0.0f, 1.0f, 0.0f));
+}
+
 /**
  * Draw Earth
  * @param shaderProgram Shader Program to use
@@ -117,50 +203,26 @@ void calculateMatrices(glm::mat4& view, glm::mat4& projection)
  */
 void drawEarth(unsigned int shaderProgram, glm::mat4 view, glm::mat4 projection)
 {
-    glUseProgram(shaderProgram);
-
-    // Light and Camera Position
-    // -------------------------
-    unsigned int lightPosLoc = glGetUniformLocation(shaderProgram, "lightPos");
-    glUniform3fv(lightPosLoc, 1, &lightPos[0]);
-
-    unsigned int lightColorLoc = glGetUniformLocation(shaderProgram, "lightColor");
-    glUniform3fv(lightColorLoc, 1, &lightColor[0]);
-
-    unsigned int viewPosLoc = glGetUniformLocation(shaderProgram, "viewPos");
-    glUniform3fv(viewPosLoc, 1, &cameraPos[0]);
-
-    unsigned int earthPosLoc = glGetUniformLocation(shaderProgram, "earthPos");
-    glUniform3fv(earthPosLoc, 1, glm::value_ptr(earthPos));
-
-    // Calculate and Set Model Matrix
-    // ------------------------------
-    glm::mat4 model = glm::mat4(1.0f);
-    model = glm::rotate(model, (float)glfwGetTime() * glm::radians(EARTH_ROTATION_SPEED), glm::vec3(0.0f, 1.0f, 0.0f));
-
-    unsigned int modelLoc = glGetUniformLocation(shaderProgram, "model");
-    glUniformMatrix4fv(modelLoc, 1, GL_FALSE, glm::value_ptr(model));
-
-    unsigned int viewLoc = glGetUniformLocation(shaderProgram, "view");
-    glUniformMatrix4fv(viewLoc, 1, GL_FALSE, glm::value_ptr(view));
-
-    unsigned int projectionLoc = glGetUniformLocation(shaderProgram, "projection");
-    glUniformMatrix4fv(projectionLoc, 1, GL_FALSE, glm::value_ptr(projection));
-
-    // Bind Texture
-    // ------------
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, textureID);
-    unsigned int texLoc = glGetUniformLocation(shaderProgram, "texture1");
-    glUniform1i(texLoc, 0);
-
-	glActiveTexture(GL_TEXTURE1);
-    glBindTexture(GL_TEXTURE_2D, normalMap);
-	unsigned int normalMapLoc = glGetUniformLocation(shaderProgram, "normalMap");
-	glUniform1i(normalMapLoc, 1);
+    // Near the Surface the streamed Terrain replaces the Sphere
+    // --------------------------------------------------------
+    glm::mat4 model = earthModelMatrix();
+    if (updateTerrain(glm::length(cameraPos - earthPos)))
+    {
+        shaderProgram = terrainShaderProgram();
+        submitDraw(renderSortKey(RenderPass::Opaque, shaderProgram, earthMaterial.texture, 0), [=]()
+        {
+            useProgram(shaderProgram);
+
+            // Set Model Matrix (Camera and Light are in the Frame Uniforms)
+            // -------------------------------------------------------------
+            glUniformMatrix4fv(uniformLocation(shaderProgram, Uniform::Model), 1, GL_FALSE, glm::value_ptr(model));
+            bindMaterial(shaderProgram, earthMaterial, surfaceTextureTarget());
+            drawTerrain(shaderProgram, model, view, projection);
+        });
+        return;
+    }
 
-    // Draw Earth
-    // ----------
-    glBindVertexArray(VAO);
-    glDrawElements(GL_TRIANGLES, indices.size(), GL_UNSIGNED_INT, 0);
+    // Queue the Earth for drawBodies() (LOD Level by Screen Size), far away it is ray traced on a Quad
+    // ------------------------------------------------------------------------------------------------
+    submitBody(shaderProgram, earthMesh, earthLod, earthMaterial, model, view, projection);
 }
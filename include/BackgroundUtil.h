@@ -6,10 +6,21 @@ extern glm::vec3 front;
 extern glm::vec3 cameraPos;
 extern glm::vec3 cameraFront;
 extern glm::vec3 cameraUp;
+extern glm::vec3 earthPos;
 
 const float LIGHT_ROTATION_SPEED = 10.0f;
 const float LIGHT_ORBIT_RADIUS = 15.0f;
 
+// Clip Planes: the Near Plane follows the Camera down to the Surface so the fine Terrain Levels
+// (tens of Meters, TerrainUtil.h) are not clipped; the Far/Near Ratio stays below 10^8
+// ---------------------------------------------------------------------------------------------
+const float CAMERA_MAX_NEAR = 0.1f;             // in Earth Radii, used from one Earth Radius Altitude up
+const float CAMERA_MIN_NEAR = 1e-6f;            // ~6 m
+const float CAMERA_NEAR_ALTITUDE_RATIO = 0.5f;  // Near Plane at half the Altitude above Sea Level
+const float CAMERA_FAR = 100.0f;
+
 glm::vec3 mouse_callback(GLFWwindow* window, double xpos, double ypos);
 void mouse_button_callback(GLFWwindow* window, int button, int action, int mods);
 void processInput(GLFWwindow* window);
+float cameraAltitude();
+float cameraNearPlane();
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "IkosaederUtil.h"
+#include "LodUtil.h"
+#include "MeshRegistryUtil.h"
+
+// Body Texture Arrays: Layers have the Size of the largest Surface added so far (smaller ones are resampled),
+// the Arrays grow by doubling as Materials are loaded
+// ----------------------------------------------------------------------------------------------------------
+const uint32_t BODY_FLAG_NORMAL_MAP = 1u;   // sample the Normal Map Layer (fs_instanced.glsl)
+const size_t BODY_STREAM_INSTANCES = 256;   // Instances per Frame before the Stream Ring grows
+
+// Per-Instance Attributes of one Body (Locations 4 - 8 of the instanced Shaders)
+// ------------------------------------------------------------------------------
+struct BodyInstance
+{
+    glm::mat4 model;            // Locations 4 - 7
+    uint32_t textureLayer;      // Location 8 (uvec4)
+    uint32_t normalLayer;
+    uint32_t flags;
+    uint32_t reserved;
+};
+static_assert(sizeof(BodyInstance) == 80, "BodyInstance must stay tightly packed");
+
+bool initBodyRenderer(MeshHandle mesh);
+Material loadBodyMaterial(const char* texturePath, const char* normalMapPath);
+void submitBody(unsigned int shaderProgram, MeshHandle mesh, LodState& lod, const Material& material,
+    const glm::mat4& model, const glm::mat4& view, const glm::mat4& projection);
+void drawBodies();
+void releaseBodyRenderer();
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "IkosaederUtil.h"
+#include "VertexLayoutUtil.h"
+#include "MeshletUtil.h"
+
+// Level the GPU Output is compared against the CPU Generator with at Startup
+// --------------------------------------------------------------------------
+const unsigned int COMPUTE_CHECK_LEVEL = 3;
+
+// Meshlet Tiling of the GPU Path: every Face Lattice is cut into Lattice Triangles with COMPUTE_BLOCK_SIDE
+// Edges (upright and upside down by Turns), each one Meshlet with the same local Indices
+// --------------------------------------------------------------------------------------------------------
+const unsigned int COMPUTE_BLOCK_SIDE = 8;
+const unsigned int COMPUTE_BLOCK_VERTICES = (COMPUTE_BLOCK_SIDE + 1) * (COMPUTE_BLOCK_SIDE + 2) / 2;     // 45
+const unsigned int COMPUTE_BLOCK_TRIANGLES = COMPUTE_BLOCK_SIDE * COMPUTE_BLOCK_SIDE;                   // 64
+static_assert(COMPUTE_BLOCK_VERTICES <= MESHLET_MAX_VERTICES && COMPUTE_BLOCK_TRIANGLES <= MESHLET_MAX_TRIANGLES,
+    "a Block has to fit into one Meshlet");
+
+bool initComputeShaders();
+void sphereLevelMeshletsGpu(unsigned int level, std::vector<Meshlet>& meshlets);
+void generateSphereLevelGpu(unsigned int level, const VertexLayout& layout,
+    unsigned int vertexBuffer, size_t vertexByteOffset, unsigned int indexBuffer, size_t indexByteOffset);
+bool checkSphereLevelGpu(unsigned int level, const VertexLayout& layout);
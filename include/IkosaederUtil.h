@@ -12,6 +12,22 @@
 #include <vector>
 #include <iostream>
 #include <cmath>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <unordered_map>
+#include <unordered_set>
+#include <memory>
+#include <cstring>
+#include <cstdlib>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <functional>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -20,7 +36,41 @@
 const unsigned int SCR_WIDTH = 1000;
 const unsigned int SCR_HEIGHT = 800;
 
+// Subdivision Modes
+// -----------------
+enum class SubdivisionMode
+{
+    Duplicate,  // Every Triangle pushes its own three Edge Midpoints
+    Welded      // Edge Midpoints are cached and shared by neighboring Triangles
+};
+
+// Base Icosahedron (12 Corners, 20 Faces, counter-clockwise seen from outside),
+// constexpr so its Edge Tables (StaticIcosphereUtil.h) can be found at Compile Time
+// ---------------------------------------------------------------------------------
+constexpr float ICOSAHEDRON_X = 0.52573111212f, ICOSAHEDRON_Z = 0.85065080835f;
+constexpr float ICOSAHEDRON_VERTICES[12 * 3] =
+{
+    -ICOSAHEDRON_X, 0, ICOSAHEDRON_Z,   ICOSAHEDRON_X, 0, ICOSAHEDRON_Z,    -ICOSAHEDRON_X, 0, -ICOSAHEDRON_Z,
+     ICOSAHEDRON_X, 0, -ICOSAHEDRON_Z,  0, ICOSAHEDRON_Z, ICOSAHEDRON_X,    0, ICOSAHEDRON_Z, -ICOSAHEDRON_X,
+     0, -ICOSAHEDRON_Z, ICOSAHEDRON_X,  0, -ICOSAHEDRON_Z, -ICOSAHEDRON_X,  ICOSAHEDRON_Z, ICOSAHEDRON_X, 0,
+     -ICOSAHEDRON_Z, ICOSAHEDRON_X, 0,  ICOSAHEDRON_Z, -ICOSAHEDRON_X, 0,   -ICOSAHEDRON_Z, -ICOSAHEDRON_X, 0
+};
+constexpr unsigned int ICOSAHEDRON_INDICES[20 * 3] =
+{
+    0,1,4,  0,4,9,  9,4,5,  4,8,5,  4,1,8,
+    8,1,10, 8,10,3, 5,8,3,  5,3,2,  2,3,7,
+    7,3,10, 7,10,6, 7,6,11, 11,6,0, 0,6,1,
+    6,10,1, 9,11,0, 9,2,11, 9,5,2,  7,11,2
+};
+
+// Cube Sphere Faces: Normal N and in-Plane Axis U; V = N x U so that U x V = N (outward)
+// -------------------------------------------------------------------------------------
+extern const int CUBE_FACE_AXES[6][2][3];
+
 void framebuffer_size_callback(GLFWwindow* window, int width, int height);
 std::string readFile(const char* filePath);
 unsigned int loadShader(const char* vertexPath, const char* fragmentPath);
-void subdivide(std::vector<float>& vertices, std::vector<float>& normals, std::vector<unsigned int>& indices);
+void subdivide(std::vector<float>& vertices, std::vector<float>& normals, std::vector<unsigned int>& indices,
+    SubdivisionMode mode = SubdivisionMode::Duplicate);
+void generateIcosphere(unsigned int level, std::vector<float>& vertices, std::vector<float>& normals, std::vector<unsigned int>& indices);
+void generateCubeSphere(unsigned int level, std::vector<float>& vertices, std::vector<float>& normals, std::vector<unsigned int>& indices);
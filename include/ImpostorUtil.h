@@ -0,0 +1,14 @@
+#pragma once
+
+#include "IkosaederUtil.h"
+#include "LodUtil.h"
+
+// Bodies smaller than about 64 Pixels across are ray traced on a camera-facing Quad instead of meshed
+// ----------------------------------------------------------------------------------------------------
+const float IMPOSTOR_MAX_RADIUS_PIXELS = 32.0f;
+const float IMPOSTOR_HYSTERESIS_PIXELS = 4.0f;      // keeps a Body from flickering between Quad and Mesh
+
+void initImpostors();
+unsigned int impostorShaderProgram();
+bool selectImpostor(LodState& state, float radiusPixels);
+void drawImpostor(unsigned int shaderProgram, const glm::mat4& model, const glm::mat4& view);
@@ -2,6 +2,31 @@
 
 #include "IkosaederUtil.h"
 #include "TextureUtil.h"
+#include "VertexLayoutUtil.h"
+
+// Where the Sphere's Tangent Frame comes from
+// -------------------------------------------
+enum class TangentFrameMode
+{
+    Stored,     // generated on the CPU, one packed Tangent per Vertex (PackedVertex)
+    Analytic    // derived from the Normal in vs_analytic.glsl (SlimVertex, no Tangent Pass)
+};
+
+// Where the Sphere's Vertices come from
+// -------------------------------------
+enum class SphereGeometryMode
+{
+    Buffers,    // LOD Chain generated (or mapped from the Cache) into VBO/EBO, drawn as Meshlets
+    Procedural, // no Buffers: vs_procedural.glsl rebuilds every Vertex from gl_VertexID/gl_InstanceID
+    CubeSphere, // Cube Sphere LOD Chain (SlimVertex) textured from equal-angle Cube Maps
+    Tessellated // Level-2 Icosphere Patches refined by Tessellation Shaders from the Screen-Space Error (OpenGL 4.0)
+};
+
+extern TangentFrameMode tangentFrameMode;
+extern SphereGeometryMode sphereGeometryMode;
 
 GLFWwindow* initGLFW_GLAD();
 unsigned int initShaders_Buffers();
+const VertexLayout& sphereVertexLayout();
+GLenum surfaceTextureTarget();
+unsigned int loadSurfaceTexture(const char* path, bool normalMap);
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "IkosaederUtil.h"
+#include "MeshletUtil.h"
+
+// Icosphere LOD Chain (Levels 0 - LOD_MAX_LEVEL, shared by all Bodies)
+// --------------------------------------------------------------------
+const unsigned int LOD_MAX_LEVEL = 8;
+const unsigned int LOD_LEVEL_COUNT = LOD_MAX_LEVEL + 1;
+const float LOD_TARGET_EDGE_PIXELS = 4.0f;      // wanted on-screen Edge Length
+const float LOD_HYSTERESIS = 0.25f;             // in Levels, keeps the Level from flickering
+const float ICOSAHEDRON_EDGE_ANGLE = 1.10714872f; // atan(2): Angle spanned by one Base Edge
+
+// Per-Body LOD Selection State
+// ----------------------------
+struct LodState
+{
+    unsigned int level = LOD_MAX_LEVEL;
+    bool impostor = false;      // drawn as ray-traced Quad (selectImpostor)
+};
+
+extern std::vector<Meshlet> sphereLodMeshlets[LOD_LEVEL_COUNT];
+
+float projectedRadius(const glm::mat4& model, const glm::mat4& view, const glm::mat4& projection);
+unsigned int selectLodLevel(LodState& state, float radiusPixels);
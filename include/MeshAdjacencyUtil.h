@@ -0,0 +1,22 @@
+#pragma once
+
+#include "IkosaederUtil.h"
+
+// Vertex -> Vertex Adjacency of a welded Mesh (CSR): the Neighbors of Vertex v are
+// neighbors[offsets[v]] ... neighbors[offsets[v + 1] - 1], sorted ascending
+// --------------------------------------------------------------------------------
+struct MeshAdjacency
+{
+    std::vector<unsigned int> offsets;
+    std::vector<unsigned int> neighbors;
+};
+
+struct AdjacencyBandwidth
+{
+    unsigned int maximum;   // largest Index Distance between Neighbors
+    float average;          // average Index Distance between Neighbors
+};
+
+void buildAdjacency(size_t vertexCount, const std::vector<unsigned int>& indices, MeshAdjacency& adjacency);
+void reorderForLocality(std::vector<float>& vertices, std::vector<float>& normals, std::vector<unsigned int>& indices, MeshAdjacency& adjacency);
+AdjacencyBandwidth analyzeBandwidth(const MeshAdjacency& adjacency);
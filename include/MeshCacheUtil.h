@@ -0,0 +1,76 @@
+#pragma once
+
+#include "IkosaederUtil.h"
+
+// Binary Mesh Cache File
+// ----------------------
+const uint32_t MESH_CACHE_MAGIC = 0x4D42524F;   // "ORBM"
+const uint32_t MESH_CACHE_VERSION = 5;
+const uint32_t MESH_CACHE_MAX_STREAMS = 8;
+const uint64_t MESH_CACHE_ALIGNMENT = 16;
+
+// Vertex Formats (Part of the Cache Key)
+// --------------------------------------
+enum MeshVertexFormat : uint32_t
+{
+    VERTEX_FORMAT_SEPARATE_FLOAT = 1,   // Position, Normal, UV, Tangent, Bitangent as float Streams + uint32 Indices
+    VERTEX_FORMAT_PACKED_24 = 2,        // meshlet-ordered PackedVertex Stream + uint16 local Indices + Meshlets
+    VERTEX_FORMAT_PACKED_20 = 3,        // same with SlimVertex (no Tangent, TBN derived in the Shader)
+    VERTEX_FORMAT_CUBE_SPHERE_20 = 4    // Cube Sphere instead of Icosphere, SlimVertex without UVs
+};
+
+struct MeshCacheHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t level;
+    uint32_t vertexFormat;
+    uint64_t vertexCount;
+    uint64_t indexCount;
+    uint32_t streamCount;
+    uint32_t reserved;
+    uint64_t streamOffset[MESH_CACHE_MAX_STREAMS];
+    uint64_t streamSize[MESH_CACHE_MAX_STREAMS];
+};
+
+// One contiguous Block of Bytes, ready for glBufferData
+// -----------------------------------------------------
+struct MeshStream
+{
+    const void* data;
+    size_t size;
+};
+
+// Expected Shape of one Stream: Element Size and which Header Count gives the Number of Elements
+// ---------------------------------------------------------------------------------------------
+enum class MeshStreamCount
+{
+    Vertices,   // header.vertexCount Elements
+    Indices,    // header.indexCount Elements
+    Any         // any whole Number of Elements
+};
+
+struct MeshStreamSpec
+{
+    uint64_t elementSize;
+    MeshStreamCount count;
+};
+
+// Read-only Mapping of a Cache File
+// ---------------------------------
+struct MeshCache
+{
+    const MeshCacheHeader* header = nullptr;
+    std::vector<MeshStream> streams;
+    const unsigned char* mapping = nullptr;
+    size_t mappingSize = 0;
+    void* fileHandle = nullptr;
+    void* mappingHandle = nullptr;
+};
+
+std::string meshCachePath(uint32_t level, uint32_t vertexFormat);
+bool writeMeshCache(const std::string& path, uint32_t level, uint32_t vertexFormat,
+    uint64_t vertexCount, uint64_t indexCount, const std::vector<MeshStream>& streams);
+bool openMeshCache(const std::string& path, uint32_t level, uint32_t vertexFormat,
+    const std::vector<MeshStreamSpec>& expected, MeshCache& cache);
+void closeMeshCache(MeshCache& cache);
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "IkosaederUtil.h"
+
+// Export of the Sphere Mesh as binary glTF (.glb) and PLY, streamed Chunk by Chunk: the Mesh is
+// generated Face by Face from the Icosahedron Lattice while writing, only the Seam Copies
+// (a few per Date Line Row and Pole) are held in Memory, so high Levels fit into little RAM.
+// Vertex Records are interleaved Position, Normal, UV, Tangent (xyzw) in both Files; UVs and
+// Tangents follow glTF: s = 1 - u as the Shaders sample it, Tangent along +s, w = Handedness
+// -----------------------------------------------------------------------------------------------
+const unsigned int EXPORT_MAX_LEVEL = 11;       // GLB Lengths are 32 bit, Level 12 would pass 4 GiB
+const size_t EXPORT_CHUNK_SIZE = 65536;         // Vertices or Triangles per Write
+const size_t EXPORT_VERTEX_FLOATS = 12;
+
+bool exportSphereMesh(unsigned int level, const std::string& basePath);
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "IkosaederUtil.h"
+#include "LodUtil.h"
+
+// How a registered Mesh is drawn
+// ------------------------------
+enum class MeshKind
+{
+    Meshlets,   // LOD Chain in VBO/EBO, one Meshlet List per Level
+    Procedural, // empty VAO, Vertices rebuilt in the Vertex Shader
+    Patches     // Patch Mesh in VBO/EBO, refined by Tessellation Shaders
+};
+
+// Geometry on the GPU, uploaded once and referenced by Handle from any Number of Bodies
+// -------------------------------------------------------------------------------------
+struct GpuMesh
+{
+    std::string name;
+    MeshKind kind;
+    unsigned int VAO, VBO, EBO;                 // VBO and EBO are 0 for procedural Meshes
+    const std::vector<Meshlet>* lodMeshlets;    // LOD_LEVEL_COUNT Meshlet Lists (Meshlets Kind only)
+};
+
+const unsigned int NO_TEXTURE_LAYER = 0xFFFFFFFFu;
+
+// Per-Body Surface: all a Body adds on top of the shared Mesh besides its Model Matrix
+// -----------------------------------------------------------------------------------
+struct Material
+{
+    unsigned int texture;
+    unsigned int normalMap;     // flat Normal Map (createFlatNormalMap) for Bodies without Relief
+    unsigned int textureLayer = NO_TEXTURE_LAYER;   // Layers in the Body Texture Arrays (loadBodyMaterial)
+    unsigned int normalLayer = NO_TEXTURE_LAYER;    // none for Bodies without Relief
+};
+
+typedef unsigned int MeshHandle;
+const MeshHandle INVALID_MESH_HANDLE = 0xFFFFFFFFu;
+const char* const SPHERE_MESH_NAME = "sphere";
+
+MeshHandle registerMesh(const std::string& name, MeshKind kind, unsigned int VAO, unsigned int VBO, unsigned int EBO, const std::vector<Meshlet>* lodMeshlets);
+MeshHandle findMesh(const std::string& name);
+const GpuMesh& meshByHandle(MeshHandle handle);
+void bindMaterial(unsigned int shaderProgram, const Material& material, GLenum textureTarget);
+void drawMesh(unsigned int shaderProgram, MeshHandle handle, LodState& lod, const glm::mat4& model, const glm::mat4& view, const glm::mat4& projection);
+void releaseMeshes();
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "IkosaederUtil.h"
+
+// Meshlet Limits (Vertices addressed by 16 bit local Indices)
+// -----------------------------------------------------------
+const unsigned int MESHLET_MAX_VERTICES = 64;
+const unsigned int MESHLET_MAX_TRIANGLES = 124;
+
+// Cluster of Triangles with own Vertex Range, Bounding Sphere and Normal Cone
+// ---------------------------------------------------------------------------
+struct Meshlet
+{
+    uint32_t vertexOffset;  // Base Vertex in the meshlet-ordered Vertex Buffer
+    uint32_t vertexCount;
+    uint32_t indexOffset;   // first local Index in the 16 bit Index Buffer
+    uint32_t indexCount;
+    float center[3];
+    float radius;
+    float coneAxis[3];
+    float coneCutoff;       // sin of the Cone Half Angle, 1 = never culled
+};
+
+void buildMeshlets(
+    const std::vector<float>& vertices,
+    const std::vector<unsigned int>& indices,
+    std::vector<Meshlet>& meshlets,
+    std::vector<unsigned int>& meshletVertices,
+    std::vector<uint16_t>& meshletIndices);
+void optimizeMeshlets(
+    const std::vector<Meshlet>& meshlets,
+    std::vector<unsigned int>& meshletVertices,
+    std::vector<uint16_t>& meshletIndices);
+bool isMeshletBackfacing(const Meshlet& meshlet, const glm::vec3& cameraPosition);
+unsigned int drawMeshlets(const std::vector<Meshlet>& meshlets, const glm::mat4& model, const glm::vec3& cameraPosition);
@@ -1,11 +1,10 @@
 #pragma once
 
 #include "IkosaederUtil.h"
+#include "LodUtil.h"
+#include "MeshRegistryUtil.h"
 
-extern std::vector<float> vertices, normaks, uvs, moonVertices, moonNormals, moonUVs;
-extern std::vector<unsigned int> indices, moonIndices;
-
-extern unsigned int moonVBO, moonVAO, moonEBO, moonNormalVBO, moonTextureID;
+extern Material moonMaterial;
 extern glm::vec3 lightPos, lightColor, earthPos, cameraPos;
 
 constexpr auto EARTH_ROTATION_SPEED = 10.0f;
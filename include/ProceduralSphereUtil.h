@@ -0,0 +1,6 @@
+#pragma once
+
+#include "IkosaederUtil.h"
+
+void initProceduralSphere(unsigned int shaderProgram);
+void drawProceduralSphere(unsigned int shaderProgram, unsigned int level);
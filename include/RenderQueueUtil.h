@@ -0,0 +1,43 @@
+#pragma once
+
+#include "IkosaederUtil.h"
+
+// Render Passes in Draw Order: the Skybox only fills Pixels left at the far Plane,
+// the Overlay blends over everything opaque
+// --------------------------------------------------------------------------------
+enum class RenderPass
+{
+    Opaque,
+    Sky,
+    Overlay
+};
+
+// 64 bit Sort Key: Pass (4 bits) | Program (20) | Material (20) | Mesh (20), so Draws sharing
+// a Program, then a Material, then a Mesh run back to back
+// ------------------------------------------------------------------------------------------
+const unsigned int SORT_KEY_FIELD_BITS = 20;
+const uint64_t SORT_KEY_FIELD_MASK = (1ull << SORT_KEY_FIELD_BITS) - 1;
+
+// Texture Units and Targets tracked by the State Cache (Targets not listed are always bound)
+// -----------------------------------------------------------------------------------------
+const unsigned int RENDER_TEXTURE_UNITS = 4;
+const GLenum RENDER_TEXTURE_TARGETS[] = { GL_TEXTURE_2D, GL_TEXTURE_CUBE_MAP, GL_TEXTURE_2D_ARRAY };
+
+// Instrumentation of the last flushed Frame
+// -----------------------------------------
+struct RenderStats
+{
+    unsigned int commands;              // Draw Commands run by flushRenderQueue
+    unsigned int stateChanges;          // Program, VAO and Texture Binds sent to OpenGL
+    unsigned int skippedStateChanges;   // redundant Binds filtered by the State Cache
+};
+
+uint64_t renderSortKey(RenderPass pass, unsigned int program, unsigned int material, unsigned int mesh);
+void submitDraw(uint64_t key, std::function<void()> draw);
+void flushRenderQueue();
+const RenderStats& renderStats();
+
+void useProgram(unsigned int program);
+void bindVertexArray(unsigned int vertexArray);
+void bindTexture(unsigned int unit, GLenum target, unsigned int texture);
+void invalidateRenderState();
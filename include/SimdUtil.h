@@ -0,0 +1,72 @@
+#pragma once
+
+#include "IkosaederUtil.h"
+
+#include <immintrin.h>
+
+void runParallel(size_t taskCount, const std::function<void(size_t)>& task);
+
+/**
+ * Run a Function over [0, count) split into one contiguous Range per Worker Thread
+ * (the Ranges run on the persistent Workers of runParallel)
+ * @param count Number of Items
+ * @param function Called as function(begin, end)
+ * @param minItemsPerWorker smallest Range worth a Thread (small Counts use fewer Workers)
+ */
+template <typename Function>
+static void parallelFor(size_t count, Function function, size_t minItemsPerWorker = 1)
+{
+    unsigned int workerCount = std::max(1u, std::thread::hardware_concurrency());
+    size_t chunk = std::max((count + workerCount - 1) / workerCount, std::max<size_t>(minItemsPerWorker, 1));
+    runParallel((count + chunk - 1) / chunk, [&](size_t range)
+        {
+            function(range * chunk, std::min(count, (range + 1) * chunk));
+        });
+}
+
+// SIMD_WIDTH floats at once: AVX2 if compiled with it, else SSE2
+// ---------------------------------------------------------------
+#ifdef __AVX2__
+typedef __m256 floatN;
+const size_t SIMD_WIDTH = 8;
+static inline floatN loadN(float v) { return _mm256_set1_ps(v); }
+static inline floatN loadN(const float* p) { return _mm256_loadu_ps(p); }
+static inline floatN addN(floatN a, floatN b) { return _mm256_add_ps(a, b); }
+static inline floatN subN(floatN a, floatN b) { return _mm256_sub_ps(a, b); }
+static inline floatN mulN(floatN a, floatN b) { return _mm256_mul_ps(a, b); }
+static inline floatN divN(floatN a, floatN b) { return _mm256_div_ps(a, b); }
+static inline floatN maxN(floatN a, floatN b) { return _mm256_max_ps(a, b); }
+static inline floatN sqrtN(floatN a) { return _mm256_sqrt_ps(a); }
+static inline floatN safeInverseN(floatN a)
+{
+    floatN zero = _mm256_setzero_ps();
+    return _mm256_and_ps(_mm256_cmp_ps(a, zero, _CMP_NEQ_OQ), _mm256_div_ps(_mm256_set1_ps(1.0f), a));
+}
+static inline void storeN(float* p, floatN a) { _mm256_storeu_ps(p, a); }
+static inline floatN gatherN(const float* base, const unsigned int* index, int stride, int component)
+{
+    __m256i offsets = _mm256_add_epi32(_mm256_mullo_epi32(_mm256_loadu_si256((const __m256i*)index), _mm256_set1_epi32(stride)), _mm256_set1_epi32(component));
+    return _mm256_i32gather_ps(base, offsets, 4);
+}
+#else
+typedef __m128 floatN;
+const size_t SIMD_WIDTH = 4;
+static inline floatN loadN(float v) { return _mm_set1_ps(v); }
+static inline floatN loadN(const float* p) { return _mm_loadu_ps(p); }
+static inline floatN addN(floatN a, floatN b) { return _mm_add_ps(a, b); }
+static inline floatN subN(floatN a, floatN b) { return _mm_sub_ps(a, b); }
+static inline floatN mulN(floatN a, floatN b) { return _mm_mul_ps(a, b); }
+static inline floatN divN(floatN a, floatN b) { return _mm_div_ps(a, b); }
+static inline floatN maxN(floatN a, floatN b) { return _mm_max_ps(a, b); }
+static inline floatN sqrtN(floatN a) { return _mm_sqrt_ps(a); }
+static inline floatN safeInverseN(floatN a)
+{
+    return _mm_and_ps(_mm_cmpneq_ps(a, _mm_setzero_ps()), _mm_div_ps(_mm_set1_ps(1.0f), a));
+}
+static inline void storeN(float* p, floatN a) { _mm_storeu_ps(p, a); }
+static inline floatN gatherN(const float* base, const unsigned int* index, int stride, int component)
+{
+    return _mm_setr_ps(base[index[0] * stride + component], base[index[1] * stride + component],
+        base[index[2] * stride + component], base[index[3] * stride + component]);
+}
+#endif
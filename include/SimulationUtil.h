@@ -0,0 +1,41 @@
+#pragma once
+
+#include "IkosaederUtil.h"
+#include "MeshAdjacencyUtil.h"
+
+// Per-Vertex Simulations on the welded Earth Mesh, drawn as a Color Overlay
+// -------------------------------------------------------------------------
+enum class SimulationMode
+{
+    None,
+    Heat,       // Diffusion of Heat from the Sun-facing Side (Relaxation towards the Insolation)
+    Tracer      // Upwind Advection of a Tracer by a Solid-Body Rotation around a tilted Axis
+};
+
+const unsigned int SIMULATION_LEVEL = 6;                // welded Icosphere, 10 * 4^6 + 2 Vertices
+const unsigned int STENCIL_WIDTH = 6;                   // highest Vertex Degree of a subdivided Icosahedron
+const unsigned int SIMULATION_STEPS_PER_FRAME = 4;
+const size_t STENCIL_MIN_VERTICES_PER_THREAD = 16384;   // smaller Ranges aren't worth a Thread
+const float HEAT_DIFFUSION = 0.5f;                      // Share of the Neighbor Mean taken per Step (stable up to 1)
+const float HEAT_RELAXATION = 0.002f;                   // Share of the Insolation taken per Step
+const float TRACER_COURANT = 0.5f;                      // largest Sum of Inflow Weights of any Vertex per Step
+const float OVERLAY_RADIUS = 1.002f;                    // above the Sphere; over the Terrain also above its Heights
+const unsigned int OVERLAY_TERRAIN_LEVEL = 2;           // Tile Level the Overlay samples Terrain Heights from (~80 km Grid)
+
+// Fixed-Width Stencil (ELLPACK) over a padded Vertex Range: Column k holds the k-th Neighbor
+// and its Weight for every Vertex, Vertices with fewer Neighbors repeat themselves with Weight 0.
+// One Step computes out[v] = in[v] + sum over k of weight[k][v] * (in[neighbor[k][v]] - in[v])
+// -----------------------------------------------------------------------------------------------
+struct StencilMatrix
+{
+    size_t vertexCount;                     // padded to a Multiple of SIMD_WIDTH
+    std::vector<unsigned int> neighbors;    // STENCIL_WIDTH Columns of vertexCount
+    std::vector<float> weights;
+};
+
+extern SimulationMode simulationMode;
+
+void applyStencil(const StencilMatrix& stencil, const float* in, float* out);
+void initSimulation();
+void stepSimulation(const glm::vec3& sunDirection);
+void drawSimulationOverlay(const glm::mat4& model);
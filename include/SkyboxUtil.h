@@ -5,4 +5,4 @@
 extern unsigned int skyboxVAO, skyboxVBO, skyboxEBO, cubemapTexture, skyboxShaderProgram;
 
 void initSkybox();
-void drawSkybox(glm::mat4 view, glm::mat4 projection);
+void drawSkybox();
@@ -0,0 +1,7412 @@
+#pragma once
+
+#include "IkosaederUtil.h"
+
+// Icosphere Levels 0 - 4 as generateIcosphere() and calculateSphereUVs() build them:
+// the welded Mesh, then the Seam Copies (Normals are the Positions).
+// Generated by --generate-static-icosphere, do not edit
+// ----------------------------------------------------------------------------------
+
+const float STATIC_ICOSPHERE_0_POSITIONS[] =
+{
+    -0.525731146f, 0.0f, 0.850650907f, 0.525731146f, 0.0f, 0.850650907f, -0.525731146f, 0.0f,
+    -0.850650907f, 0.525731146f, 0.0f, -0.850650907f, 0.0f, 0.850650907f, 0.525731146f, 0.0f,
+    0.850650907f, -0.525731146f, 0.0f, -0.850650907f, 0.525731146f, 0.0f, -0.850650907f, -0.525731146f,
+    0.850650907f, 0.525731146f, 0.0f, -0.850650907f, 0.525731146f, 0.0f, 0.850650907f, -0.525731146f,
+    0.0f, -0.850650907f, -0.525731146f, 0.0f, 0.0f, 0.850650907f, -0.525731146f, 0.0f,
+    -0.850650907f, -0.525731146f, -0.525731146f, 0.0f, -0.850650907f
+};
+const float STATIC_ICOSPHERE_0_UVS[] =
+{
+    0.838104069f, 0.49999997f, 0.661895931f, 0.49999997f, 0.161895931f, 0.49999997f, 0.338104069f, 0.49999997f,
+    0.75f, 0.176208138f, 0.25f, 0.176208138f, 0.75f, 0.823791862f, 0.25f, 0.823791862f,
+    0.5f, 0.323791802f, 1.0f, 0.323791802f, 0.5f, 0.676208198f, 1.0f, 0.676208198f,
+    1.25f, 0.176208138f, 1.25f, 0.823791862f, 1.16189599f, 0.49999997f
+};
+const uint16_t STATIC_ICOSPHERE_0_WELDED_INDICES[] =
+{
+    0, 1, 4, 0, 4, 9, 9, 4,
+    5, 4, 8, 5, 4, 1, 8, 8,
+    1, 10, 8, 10, 3, 5, 8, 3,
+    5, 3, 2, 2, 3, 7, 7, 3,
+    10, 7, 10, 6, 7, 6, 11, 11,
+    6, 0, 0, 6, 1, 6, 10, 1,
+    9, 11, 0, 9, 2, 11, 9, 5,
+    2, 7, 11, 2
+};
+const uint16_t STATIC_ICOSPHERE_0_INDICES[] =
+{
+    0, 1, 4, 0, 4, 9, 9, 4,
+    12, 4, 8, 5, 4, 1, 8, 8,
+    1, 10, 8, 10, 3, 5, 8, 3,
+    5, 3, 2, 2, 3, 7, 7, 3,
+    10, 7, 10, 6, 13, 6, 11, 11,
+    6, 0, 0, 6, 1, 6, 10, 1,
+    9, 11, 0, 9, 14, 11, 9, 12,
+    14, 13, 11, 14
+};
+
+const float STATIC_ICOSPHERE_1_POSITIONS[] =
+{
+    -0.525731146f, 0.0f, 0.850650907f, 0.525731146f, 0.0f, 0.850650907f, -0.525731146f, 0.0f,
+    -0.850650907f, 0.525731146f, 0.0f, -0.850650907f, 0.0f, 0.850650907f, 0.525731146f, 0.0f,
+    0.850650907f, -0.525731146f, 0.0f, -0.850650907f, 0.525731146f, 0.0f, -0.850650907f, -0.525731146f,
+    0.850650907f, 0.525731146f, 0.0f, -0.850650907f, 0.525731146f, 0.0f, 0.850650907f, -0.525731146f,
+    0.0f, -0.850650907f, -0.525731146f, 0.0f, 0.0f, 0.0f, 0.99999994f, 0.309016973f,
+    0.49999997f, 0.809016943f, -0.309016973f, 0.49999997f, 0.809016943f, -0.49999997f, 0.809016943f, 0.309016973f,
+    -0.809016943f, 0.309016973f, 0.49999997f, 0.0f, 0.99999994f, 0.0f, -0.49999997f, 0.809016943f,
+    -0.309016973f, 0.49999997f, 0.809016943f, 0.309016973f, 0.49999997f, 0.809016943f, -0.309016973f, 0.809016943f,
+    0.309016973f, 0.49999997f, 0.809016943f, -0.309016973f, 0.49999997f, 0.99999994f, 0.0f, 0.0f,
+    0.809016943f, -0.309016973f, -0.49999997f, 0.809016943f, 0.309016973f, -0.49999997f, 0.309016973f, 0.49999997f,
+    -0.809016943f, 0.0f, 0.0f, -0.99999994f, -0.309016973f, 0.49999997f, -0.809016943f, 0.309016973f,
+    -0.49999997f, -0.809016943f, -0.309016973f, -0.49999997f, -0.809016943f, 0.49999997f, -0.809016943f, -0.309016973f,
+    0.49999997f, -0.809016943f, 0.309016973f, 0.0f, -0.99999994f, 0.0f, -0.49999997f, -0.809016943f,
+    0.309016973f, -0.49999997f, -0.809016943f, -0.309016973f, -0.309016973f, -0.49999997f, 0.809016943f, -0.809016943f,
+    -0.309016973f, 0.49999997f, 0.309016973f, -0.49999997f, 0.809016943f, -0.99999994f, 0.0f, 0.0f,
+    -0.809016943f, 0.309016973f, -0.49999997f, -0.809016943f, -0.309016973f, -0.49999997f, -0.49999997f, 0.809016943f,
+    -0.309016973f, -0.49999997f, -0.809016943f, -0.309016973f, -0.809016943f, 0.309016973f, -0.49999997f, -0.809016943f,
+    -0.309016973f, -0.49999997f, 0.0f, 0.99999994f, 0.0f, 0.0f, 0.99999994f, 0.0f,
+    0.0f, 0.99999994f, 0.0f, 0.0f, 0.99999994f, 0.0f, 0.0f, 0.99999994f,
+    0.0f, 0.0f, 0.99999994f, 0.0f, 0.0f, -0.99999994f, 0.0f, 0.0f,
+    -0.99999994f, 0.0f, 0.0f, -0.99999994f, 0.0f, 0.0f, -0.99999994f, 0.0f,
+    0.0f, -0.99999994f, 0.0f, 0.0f, -0.99999994f, 0.0f
+};
+const float STATIC_ICOSPHERE_1_UVS[] =
+{
+    0.838104069f, 0.49999997f, 0.661895931f, 0.49999997f, 0.161895931f, 0.49999997f, 0.338104069f, 0.49999997f,
+    0.75f, 0.176208138f, 0.25f, 0.176208138f, 0.75f, 0.823791862f, 0.25f, 0.823791862f,
+    0.5f, 0.323791802f, 1.0f, 0.323791802f, 0.5f, 0.676208198f, 1.0f, 0.676208198f,
+    0.75f, 0.49999997f, 0.691930115f, 0.333333313f, 0.808069825f, 0.333333313f, 0.911895871f, 0.200000018f,
+    0.911895871f, 0.400000006f, 0.5f, 0.000109910965f, 0.088104099f, 0.200000018f, 0.588104129f, 0.200000018f,
+    0.411895901f, 0.200000018f, 0.588104129f, 0.400000006f, 0.588104129f, 0.600000024f, 0.5f, 0.49999997f,
+    0.411895901f, 0.600000024f, 0.411895901f, 0.400000006f, 0.308069885f, 0.333333313f, 0.25f, 0.49999997f,
+    0.191930145f, 0.333333313f, 0.308069885f, 0.666666687f, 0.191930145f, 0.666666687f, 0.411895901f, 0.799999952f,
+    0.588104129f, 0.799999952f, 0.5f, 0.999890089f, 0.911895871f, 0.799999952f, 0.088104099f, 0.799999952f,
+    0.808069825f, 0.666666687f, 0.911895871f, 0.600000024f, 0.691930115f, 0.666666687f, 1.0f, 0.49999997f,
+    0.088104099f, 0.400000006f, 0.088104099f, 0.600000024f, 1.08810413f, 0.200000018f, 1.08810413f, 0.799999952f,
+    1.08810413f, 0.400000006f, 1.08810413f, 0.600000024f, 0.830947936f, 0.000109910965f, 1.0f, 0.000109910965f,
+    0.16905205f, 0.000109910965f, 0.669052064f, 0.000109910965f, 0.5f, 0.000109910965f, 0.330947936f, 0.000109910965f,
+    0.330947936f, 0.999890089f, 0.5f, 0.999890089f, 0.669052064f, 0.999890089f, 0.16905205f, 0.999890089f,
+    0.830947936f, 0.999890089f, 1.0f, 0.999890089f
+};
+const uint16_t STATIC_ICOSPHERE_1_WELDED_INDICES[] =
+{
+    0, 12, 14, 12, 1, 13, 12, 13,
+    14, 14, 13, 4, 0, 14, 16, 14,
+    4, 15, 14, 15, 16, 16, 15, 9,
+    9, 15, 18, 15, 4, 17, 15, 17,
+    18, 18, 17, 5, 4, 19, 17, 19,
+    8, 20, 19, 20, 17, 17, 20, 5,
+    4, 13, 19, 13, 1, 21, 13, 21,
+    19, 19, 21, 8, 8, 21, 23, 21,
+    1, 22, 21, 22, 23, 23, 22, 10,
+    8, 23, 25, 23, 10, 24, 23, 24,
+    25, 25, 24, 3, 5, 20, 26, 20,
+    8, 25, 20, 25, 26, 26, 25, 3,
+    5, 26, 28, 26, 3, 27, 26, 27,
+    28, 28, 27, 2, 2, 27, 30, 27,
+    3, 29, 27, 29, 30, 30, 29, 7,
+    7, 29, 31, 29, 3, 24, 29, 24,
+    31, 31, 24, 10, 7, 31, 33, 31,
+    10, 32, 31, 32, 33, 33, 32, 6,
+    7, 33, 35, 33, 6, 34, 33, 34,
+    35, 35, 34, 11, 11, 34, 37, 34,
+    6, 36, 34, 36, 37, 37, 36, 0,
+    0, 36, 12, 36, 6, 38, 36, 38,
+    12, 12, 38, 1, 6, 32, 38, 32,
+    10, 22, 32, 22, 38, 38, 22, 1,
+    9, 39, 16, 39, 11, 37, 39, 37,
+    16, 16, 37, 0, 9, 40, 39, 40,
+    2, 41, 40, 41, 39, 39, 41, 11,
+    9, 18, 40, 18, 5, 28, 18, 28,
+    40, 40, 28, 2, 7, 35, 30, 35,
+    11, 41, 35, 41, 30, 30, 41, 2
+};
+const uint16_t STATIC_ICOSPHERE_1_INDICES[] =
+{
+    0, 12, 14, 12, 1, 13, 12, 13,
+    14, 14, 13, 4, 0, 14, 16, 14,
+    4, 15, 14, 15, 16, 16, 15, 9,
+    9, 15, 42, 15, 4, 46, 15, 47,
+    42, 18, 48, 5, 4, 19, 49, 19,
+    8, 20, 19, 20, 50, 51, 20, 5,
+    4, 13, 19, 13, 1, 21, 13, 21,
+    19, 19, 21, 8, 8, 21, 23, 21,
+    1, 22, 21, 22, 23, 23, 22, 10,
+    8, 23, 25, 23, 10, 24, 23, 24,
+    25, 25, 24, 3, 5, 20, 26, 20,
+    8, 25, 20, 25, 26, 26, 25, 3,
+    5, 26, 28, 26, 3, 27, 26, 27,
+    28, 28, 27, 2, 2, 27, 30, 27,
+    3, 29, 27, 29, 30, 30, 29, 7,
+    7, 29, 31, 29, 3, 24, 29, 24,
+    31, 31, 24, 10, 7, 31, 52, 31,
+    10, 32, 31, 32, 53, 54, 32, 6,
+    7, 55, 35, 56, 6, 34, 57, 34,
+    43, 43, 34, 11, 11, 34, 37, 34,
+    6, 36, 34, 36, 37, 37, 36, 0,
+    0, 36, 12, 36, 6, 38, 36, 38,
+    12, 12, 38, 1, 6, 32, 38, 32,
+    10, 22, 32, 22, 38, 38, 22, 1,
+    9, 39, 16, 39, 11, 37, 39, 37,
+    16, 16, 37, 0, 9, 44, 39, 40,
+    2, 41, 44, 45, 39, 39, 45, 11,
+    9, 42, 44, 18, 5, 28, 18, 28,
+    40, 40, 28, 2, 7, 35, 30, 43,
+    11, 45, 35, 41, 30, 30, 41, 2
+};
+
+const float STATIC_ICOSPHERE_2_POSITIONS[] =
+{
+    -0.525731146f, 0.0f, 0.850650907f, 0.525731146f, 0.0f, 0.850650907f, -0.525731146f, 0.0f,
+    -0.850650907f, 0.525731146f, 0.0f, -0.850650907f, 0.0f, 0.850650907f, 0.525731146f, 0.0f,
+    0.850650907f, -0.525731146f, 0.0f, -0.850650907f, 0.525731146f, 0.0f, -0.850650907f, -0.525731146f,
+    0.850650907f, 0.525731146f, 0.0f, -0.850650907f, 0.525731146f, 0.0f, 0.850650907f, -0.525731146f,
+    0.0f, -0.850650907f, -0.525731146f, 0.0f, -0.295241803f, 0.0f, 0.955422521f, 0.0f,
+    0.0f, 0.99999994f, 0.295241803f, 0.0f, 0.955422521f, 0.442862689f, 0.23885563f, 0.864187777f,
+    0.309016973f, 0.49999997f, 0.809016943f, 0.147620901f, 0.716566861f, 0.68171829f, -0.442862689f, 0.23885563f,
+    0.864187777f, -0.309016973f, 0.49999997f, 0.809016943f, -0.147620901f, 0.716566861f, 0.68171829f, -0.23885563f,
+    0.864187777f, 0.442862689f, -0.49999997f, 0.809016943f, 0.309016973f, -0.716566861f, 0.68171829f, 0.147620901f,
+    -0.68171829f, 0.147620901f, 0.716566861f, -0.809016943f, 0.309016973f, 0.49999997f, -0.864187777f, 0.442862689f,
+    0.23885563f, 0.0f, 0.955422521f, 0.295241803f, 0.0f, 0.99999994f, 0.0f, 0.0f,
+    0.955422521f, -0.295241803f, -0.716566861f, 0.68171829f, -0.147620901f, -0.49999997f, 0.809016943f, -0.309016973f,
+    -0.23885563f, 0.864187777f, -0.442862689f, 0.23885563f, 0.864187777f, 0.442862689f, 0.49999997f, 0.809016943f,
+    0.309016973f, 0.716566861f, 0.68171829f, 0.147620901f, 0.716566861f, 0.68171829f, -0.147620901f, 0.49999997f,
+    0.809016943f, -0.309016973f, 0.23885563f, 0.864187777f, -0.442862689f, 0.68171829f, 0.147620901f, 0.716566861f,
+    0.809016943f, 0.309016973f, 0.49999997f, 0.864187777f, 0.442862689f, 0.23885563f, 0.68171829f, -0.147620901f,
+    0.716566861f, 0.809016943f, -0.309016973f, 0.49999997f, 0.864187777f, -0.442862689f, 0.23885563f, 0.955422521f,
+    0.295241803f, 0.0f, 0.99999994f, 0.0f, 0.0f, 0.955422521f, -0.295241803f, 0.0f,
+    0.864187777f, -0.442862689f, -0.23885563f, 0.809016943f, -0.309016973f, -0.49999997f, 0.68171829f, -0.147620901f,
+    -0.716566861f, 0.864187777f, 0.442862689f, -0.23885563f, 0.809016943f, 0.309016973f, -0.49999997f, 0.68171829f,
+    0.147620901f, -0.716566861f, 0.147620901f, 0.716566861f, -0.68171829f, 0.309016973f, 0.49999997f, -0.809016943f,
+    0.442862689f, 0.23885563f, -0.864187777f, 0.295241803f, 0.0f, -0.955422521f, 0.0f, 0.0f,
+    -0.99999994f, -0.295241803f, 0.0f, -0.955422521f, -0.147620901f, 0.716566861f, -0.68171829f, -0.309016973f,
+    0.49999997f, -0.809016943f, -0.442862689f, 0.23885563f, -0.864187777f, 0.442862689f, -0.23885563f, -0.864187777f,
+    0.309016973f, -0.49999997f, -0.809016943f, 0.147620901f, -0.716566861f, -0.68171829f, -0.442862689f, -0.23885563f,
+    -0.864187777f, -0.309016973f, -0.49999997f, -0.809016943f, -0.147620901f, -0.716566861f, -0.68171829f, 0.23885563f,
+    -0.864187777f, -0.442862689f, 0.49999997f, -0.809016943f, -0.309016973f, 0.716566861f, -0.68171829f, -0.147620901f,
+    0.716566861f, -0.68171829f, 0.147620901f, 0.49999997f, -0.809016943f, 0.309016973f, 0.23885563f, -0.864187777f,
+    0.442862689f, 0.0f, -0.955422521f, -0.295241803f, 0.0f, -0.99999994f, 0.0f, 0.0f,
+    -0.955422521f, 0.295241803f, -0.23885563f, -0.864187777f, 0.442862689f, -0.49999997f, -0.809016943f, 0.309016973f,
+    -0.716566861f, -0.68171829f, 0.147620901f, -0.23885563f, -0.864187777f, -0.442862689f, -0.49999997f, -0.809016943f,
+    -0.309016973f, -0.716566861f, -0.68171829f, -0.147620901f, -0.147620901f, -0.716566861f, 0.68171829f, -0.309016973f,
+    -0.49999997f, 0.809016943f, -0.442862689f, -0.23885563f, 0.864187777f, -0.864187777f, -0.442862689f, 0.23885563f,
+    -0.809016943f, -0.309016973f, 0.49999997f, -0.68171829f, -0.147620901f, 0.716566861f, 0.147620901f, -0.716566861f,
+    0.68171829f, 0.309016973f, -0.49999997f, 0.809016943f, 0.442862689f, -0.23885563f, 0.864187777f, -0.955422521f,
+    0.295241803f, 0.0f, -0.99999994f, 0.0f, 0.0f, -0.955422521f, -0.295241803f, 0.0f,
+    -0.864187777f, 0.442862689f, -0.23885563f, -0.809016943f, 0.309016973f, -0.49999997f, -0.68171829f, 0.147620901f,
+    -0.716566861f, -0.68171829f, -0.147620901f, -0.716566861f, -0.809016943f, -0.309016973f, -0.49999997f, -0.864187777f,
+    -0.442862689f, -0.23885563f, -0.16245985f, 0.262865543f, 0.95105654f, 0.16245985f, 0.262865543f, 0.95105654f,
+    0.0f, 0.525731087f, 0.850650787f, -0.587785244f, 0.425325394f, 0.688190937f, -0.425325394f, 0.688190937f,
+    0.587785244f, -0.688190937f, 0.587785244f, 0.425325394f, -0.525731087f, 0.850650787f, 0.0f, -0.262865543f,
+    0.95105654f, 0.16245985f, -0.262865543f, 0.95105654f, -0.16245985f, 0.262865543f, 0.95105654f, 0.16245985f,
+    0.525731087f, 0.850650787f, 0.0f, 0.262865543f, 0.95105654f, -0.16245985f, 0.425325394f, 0.688190937f,
+    0.587785244f, 0.587785244f, 0.425325394f, 0.688190937f, 0.688190937f, 0.587785244f, 0.425325394f, 0.95105654f,
+    0.16245985f, 0.262865543f, 0.850650787f, 0.0f, 0.525731087f, 0.95105654f, -0.16245985f, 0.262865543f,
+    0.95105654f, 0.16245985f, -0.262865543f, 0.95105654f, -0.16245985f, -0.262865543f, 0.850650787f, 0.0f,
+    -0.525731087f, 0.425325394f, 0.688190937f, -0.587785244f, 0.688190937f, 0.587785244f, -0.425325394f, 0.587785244f,
+    0.425325394f, -0.688190937f, 0.0f, 0.525731087f, -0.850650787f, 0.16245985f, 0.262865543f, -0.95105654f,
+    -0.16245985f, 0.262865543f, -0.95105654f, -0.16245985f, -0.262865543f, -0.95105654f, 0.16245985f, -0.262865543f,
+    -0.95105654f, 0.0f, -0.525731087f, -0.850650787f, 0.425325394f, -0.688190937f, -0.587785244f, 0.587785244f,
+    -0.425325394f, -0.688190937f, 0.688190937f, -0.587785244f, -0.425325394f, 0.262865543f, -0.95105654f, -0.16245985f,
+    0.525731087f, -0.850650787f, 0.0f, 0.262865543f, -0.95105654f, 0.16245985f, -0.262865543f, -0.95105654f,
+    -0.16245985f, -0.262865543f, -0.95105654f, 0.16245985f, -0.525731087f, -0.850650787f, 0.0f, -0.688190937f,
+    -0.587785244f, 0.425325394f, -0.425325394f, -0.688190937f, 0.587785244f, -0.587785244f, -0.425325394f, 0.688190937f,
+    -0.16245985f, -0.262865543f, 0.95105654f, 0.0f, -0.525731087f, 0.850650787f, 0.16245985f, -0.262865543f,
+    0.95105654f, 0.425325394f, -0.688190937f, 0.587785244f, 0.688190937f, -0.587785244f, 0.425325394f, 0.587785244f,
+    -0.425325394f, 0.688190937f, -0.95105654f, 0.16245985f, 0.262865543f, -0.95105654f, -0.16245985f, 0.262865543f,
+    -0.850650787f, 0.0f, 0.525731087f, -0.95105654f, 0.16245985f, -0.262865543f, -0.850650787f, 0.0f,
+    -0.525731087f, -0.95105654f, -0.16245985f, -0.262865543f, -0.688190937f, 0.587785244f, -0.425325394f, -0.425325394f,
+    0.688190937f, -0.587785244f, -0.587785244f, 0.425325394f, -0.688190937f, -0.425325394f, -0.688190937f, -0.587785244f,
+    -0.688190937f, -0.587785244f, -0.425325394f, -0.587785244f, -0.425325394f, -0.688190937f, -0.716566861f, 0.68171829f,
+    -0.147620901f, -0.49999997f, 0.809016943f, -0.309016973f, -0.262865543f, 0.95105654f, -0.16245985f, -0.262865543f,
+    -0.95105654f, -0.16245985f, -0.49999997f, -0.809016943f, -0.309016973f, -0.716566861f, -0.68171829f, -0.147620901f,
+    -0.864187777f, 0.442862689f, -0.23885563f, -0.95105654f, 0.16245985f, -0.262865543f, -0.95105654f, -0.16245985f,
+    -0.262865543f, -0.864187777f, -0.442862689f, -0.23885563f, 0.0f, 0.99999994f, 0.0f, 0.0f,
+    0.99999994f, 0.0f, 0.0f, 0.99999994f, 0.0f, 0.0f, 0.99999994f, 0.0f,
+    0.0f, 0.99999994f, 0.0f, 0.0f, 0.99999994f, 0.0f, 0.0f, -0.99999994f,
+    0.0f, 0.0f, -0.99999994f, 0.0f, 0.0f, -0.99999994f, 0.0f, 0.0f,
+    -0.99999994f, 0.0f, 0.0f, -0.99999994f, 0.0f, 0.0f, -0.99999994f, 0.0f
+};
+const float STATIC_ICOSPHERE_2_UVS[] =
+{
+    0.838104069f, 0.49999997f, 0.661895931f, 0.49999997f, 0.161895931f, 0.49999997f, 0.338104069f, 0.49999997f,
+    0.75f, 0.176208138f, 0.25f, 0.176208138f, 0.75f, 0.823791862f, 0.25f, 0.823791862f,
+    0.5f, 0.323791802f, 1.0f, 0.323791802f, 0.5f, 0.676208198f, 1.0f, 0.676208198f,
+    0.797700107f, 0.49999997f, 0.75f, 0.49999997f, 0.702299893f, 0.49999997f, 0.674629509f, 0.423227727f,
+    0.691930115f, 0.333333313f, 0.716060221f, 0.245712459f, 0.825370431f, 0.423227727f, 0.808069825f, 0.333333313f,
+    0.783939779f, 0.245712459f, 0.828722119f, 0.167832822f, 0.911895871f, 0.200000018f, 0.967664659f, 0.261232972f,
+    0.871034265f, 0.452838391f, 0.911895871f, 0.400000006f, 0.957082152f, 0.353962898f, 0.75f, 0.095400244f,
+    0.5f, 0.000109910965f, 0.25f, 0.095400244f, 0.032335341f, 0.261232972f, 0.088104099f, 0.200000018f,
+    0.171277881f, 0.167832822f, 0.671277881f, 0.167832822f, 0.588104129f, 0.200000018f, 0.532335341f, 0.261232972f,
+    0.467664659f, 0.261232972f, 0.411895901f, 0.200000018f, 0.328722149f, 0.167832822f, 0.628965735f, 0.452838391f,
+    0.588104129f, 0.400000006f, 0.542917848f, 0.353962898f, 0.628965735f, 0.547161639f, 0.588104129f, 0.600000024f,
+    0.542917848f, 0.646037102f, 0.5f, 0.404599756f, 0.5f, 0.49999997f, 0.5f, 0.595400214f,
+    0.457082123f, 0.646037102f, 0.411895901f, 0.600000024f, 0.371034294f, 0.547161639f, 0.457082123f, 0.353962898f,
+    0.411895901f, 0.400000006f, 0.371034294f, 0.452838391f, 0.283939779f, 0.245712459f, 0.308069885f, 0.333333313f,
+    0.325370491f, 0.423227727f, 0.297700107f, 0.49999997f, 0.25f, 0.49999997f, 0.202299893f, 0.49999997f,
+    0.216060221f, 0.245712459f, 0.191930145f, 0.333333313f, 0.174629539f, 0.423227727f, 0.325370491f, 0.576772273f,
+    0.308069885f, 0.666666687f, 0.283939779f, 0.754287541f, 0.174629539f, 0.576772273f, 0.191930145f, 0.666666687f,
+    0.216060221f, 0.754287541f, 0.328722149f, 0.832167149f, 0.411895901f, 0.799999952f, 0.467664659f, 0.738767028f,
+    0.532335341f, 0.738767028f, 0.588104129f, 0.799999952f, 0.671277881f, 0.832167149f, 0.25f, 0.904599786f,
+    0.5f, 0.999890089f, 0.75f, 0.904599786f, 0.828722119f, 0.832167149f, 0.911895871f, 0.799999952f,
+    0.967664659f, 0.738767028f, 0.171277881f, 0.832167149f, 0.088104099f, 0.799999952f, 0.032335341f, 0.738767028f,
+    0.783939779f, 0.754287541f, 0.808069825f, 0.666666687f, 0.825370431f, 0.576772273f, 0.957082152f, 0.646037102f,
+    0.911895871f, 0.600000024f, 0.871034265f, 0.547161639f, 0.716060221f, 0.754287541f, 0.691930115f, 0.666666687f,
+    0.674629509f, 0.576772273f, 1.0f, 0.404599756f, 1.0f, 0.49999997f, 1.0f, 0.595400214f,
+    0.0429178774f, 0.353962898f, 0.088104099f, 0.400000006f, 0.128965706f, 0.452838391f, 0.128965706f, 0.547161639f,
+    0.088104099f, 0.600000024f, 0.0429178774f, 0.646037102f, 0.776926994f, 0.415332407f, 0.723073006f, 0.415332407f,
+    0.75f, 0.323791802f, 0.862501979f, 0.360159665f, 0.849693775f, 0.258405149f, 0.911895871f, 0.300000012f,
+    1.0f, 0.176208228f, 0.911895871f, 0.0999999642f, 0.088104099f, 0.0999999642f, 0.588104129f, 0.0999999642f,
+    0.5f, 0.176208228f, 0.411895901f, 0.0999999642f, 0.650306225f, 0.258405149f, 0.637498021f, 0.360159665f,
+    0.588104129f, 0.300000012f, 0.542917848f, 0.448057175f, 0.588104069f, 0.49999997f, 0.542917848f, 0.551942825f,
+    0.457082123f, 0.448057175f, 0.457082123f, 0.551942825f, 0.411895931f, 0.49999997f, 0.349693775f, 0.258405149f,
+    0.411895901f, 0.300000012f, 0.362501949f, 0.360159665f, 0.25f, 0.323791802f, 0.276927024f, 0.415332407f,
+    0.223072976f, 0.415332407f, 0.223072976f, 0.584667563f, 0.276927024f, 0.584667563f, 0.25f, 0.676208198f,
+    0.349693775f, 0.741594851f, 0.362501949f, 0.639840364f, 0.411895901f, 0.699999988f, 0.411895901f, 0.900000036f,
+    0.5f, 0.823791742f, 0.588104129f, 0.900000036f, 0.088104099f, 0.900000036f, 0.911895871f, 0.900000036f,
+    1.0f, 0.823791742f, 0.911895871f, 0.699999988f, 0.849693775f, 0.741594851f, 0.862501979f, 0.639840364f,
+    0.776926994f, 0.584667563f, 0.75f, 0.676208198f, 0.723073006f, 0.584667563f, 0.650306225f, 0.741594851f,
+    0.588104129f, 0.699999988f, 0.637498021f, 0.639840364f, 0.957082152f, 0.448057175f, 0.957082152f, 0.551942825f,
+    0.911895871f, 0.49999997f, 0.0429178774f, 0.448057175f, 0.088104099f, 0.49999997f, 0.0429178774f, 0.551942825f,
+    0.088104099f, 0.300000012f, 0.150306255f, 0.258405149f, 0.137498051f, 0.360159665f, 0.150306255f, 0.741594851f,
+    0.088104099f, 0.699999988f, 0.137498051f, 0.639840364f, 1.03233528f, 0.261232972f, 1.08810413f, 0.200000018f,
+    1.08810413f, 0.0999999642f, 1.08810413f, 0.900000036f, 1.08810413f, 0.799999952f, 1.03233528f, 0.738767028f,
+    1.04291785f, 0.353962898f, 1.04291785f, 0.448057175f, 1.04291785f, 0.551942825f, 1.04291785f, 0.646037102f,
+    0.830947936f, 0.000109910965f, 1.0f, 0.000109910965f, 0.16905205f, 0.000109910965f, 0.669052064f, 0.000109910965f,
+    0.5f, 0.000109910965f, 0.330947936f, 0.000109910965f, 0.330947936f, 0.999890089f, 0.5f, 0.999890089f,
+    0.669052064f, 0.999890089f, 0.16905205f, 0.999890089f, 0.830947936f, 0.999890089f, 1.0f, 0.999890089f
+};
+const uint16_t STATIC_ICOSPHERE_2_WELDED_INDICES[] =
+{
+    0, 12, 18, 12, 13, 102, 12, 102,
+    18, 18, 102, 19, 13, 14, 103, 13,
+    103, 102, 102, 103, 104, 102, 104, 19,
+    19, 104, 20, 14, 1, 15, 14, 15,
+    103, 103, 15, 16, 103, 16, 104, 104,
+    16, 17, 104, 17, 20, 20, 17, 4,
+    0, 18, 24, 18, 19, 105, 18, 105,
+    24, 24, 105, 25, 19, 20, 106, 19,
+    106, 105, 105, 106, 107, 105, 107, 25,
+    25, 107, 26, 20, 4, 21, 20, 21,
+    106, 106, 21, 22, 106, 22, 107, 107,
+    22, 23, 107, 23, 26, 26, 23, 9,
+    9, 23, 30, 23, 22, 108, 23, 108,
+    30, 30, 108, 31, 22, 21, 109, 22,
+    109, 108, 108, 109, 110, 108, 110, 31,
+    31, 110, 32, 21, 4, 27, 21, 27,
+    109, 109, 27, 28, 109, 28, 110, 110,
+    28, 29, 110, 29, 32, 32, 29, 5,
+    4, 33, 27, 33, 34, 111, 33, 111,
+    27, 27, 111, 28, 34, 35, 112, 34,
+    112, 111, 111, 112, 113, 111, 113, 28,
+    28, 113, 29, 35, 8, 36, 35, 36,
+    112, 112, 36, 37, 112, 37, 113, 113,
+    37, 38, 113, 38, 29, 29, 38, 5,
+    4, 17, 33, 17, 16, 114, 17, 114,
+    33, 33, 114, 34, 16, 15, 115, 16,
+    115, 114, 114, 115, 116, 114, 116, 34,
+    34, 116, 35, 15, 1, 39, 15, 39,
+    115, 115, 39, 40, 115, 40, 116, 116,
+    40, 41, 116, 41, 35, 35, 41, 8,
+    8, 41, 45, 41, 40, 117, 41, 117,
+    45, 45, 117, 46, 40, 39, 118, 40,
+    118, 117, 117, 118, 119, 117, 119, 46,
+    46, 119, 47, 39, 1, 42, 39, 42,
+    118, 118, 42, 43, 118, 43, 119, 119,
+    43, 44, 119, 44, 47, 47, 44, 10,
+    8, 45, 51, 45, 46, 120, 45, 120,
+    51, 51, 120, 52, 46, 47, 121, 46,
+    121, 120, 120, 121, 122, 120, 122, 52,
+    52, 122, 53, 47, 10, 48, 47, 48,
+    121, 121, 48, 49, 121, 49, 122, 122,
+    49, 50, 122, 50, 53, 53, 50, 3,
+    5, 38, 54, 38, 37, 123, 38, 123,
+    54, 54, 123, 55, 37, 36, 124, 37,
+    124, 123, 123, 124, 125, 123, 125, 55,
+    55, 125, 56, 36, 8, 51, 36, 51,
+    124, 124, 51, 52, 124, 52, 125, 125,
+    52, 53, 125, 53, 56, 56, 53, 3,
+    5, 54, 60, 54, 55, 126, 54, 126,
+    60, 60, 126, 61, 55, 56, 127, 55,
+    127, 126, 126, 127, 128, 126, 128, 61,
+    61, 128, 62, 56, 3, 57, 56, 57,
+    127, 127, 57, 58, 127, 58, 128, 128,
+    58, 59, 128, 59, 62, 62, 59, 2,
+    2, 59, 66, 59, 58, 129, 59, 129,
+    66, 66, 129, 67, 58, 57, 130, 58,
+    130, 129, 129, 130, 131, 129, 131, 67,
+    67, 131, 68, 57, 3, 63, 57, 63,
+    130, 130, 63, 64, 130, 64, 131, 131,
+    64, 65, 131, 65, 68, 68, 65, 7,
+    7, 65, 69, 65, 64, 132, 65, 132,
+    69, 69, 132, 70, 64, 63, 133, 64,
+    133, 132, 132, 133, 134, 132, 134, 70,
+    70, 134, 71, 63, 3, 50, 63, 50,
+    133, 133, 50, 49, 133, 49, 134, 134,
+    49, 48, 134, 48, 71, 71, 48, 10,
+    7, 69, 75, 69, 70, 135, 69, 135,
+    75, 75, 135, 76, 70, 71, 136, 70,
+    136, 135, 135, 136, 137, 135, 137, 76,
+    76, 137, 77, 71, 10, 72, 71, 72,
+    136, 136, 72, 73, 136, 73, 137, 137,
+    73, 74, 137, 74, 77, 77, 74, 6,
+    7, 75, 81, 75, 76, 138, 75, 138,
+    81, 81, 138, 82, 76, 77, 139, 76,
+    139, 138, 138, 139, 140, 138, 140, 82,
+    82, 140, 83, 77, 6, 78, 77, 78,
+    139, 139, 78, 79, 139, 79, 140, 140,
+    79, 80, 140, 80, 83, 83, 80, 11,
+    11, 80, 87, 80, 79, 141, 80, 141,
+    87, 87, 141, 88, 79, 78, 142, 79,
+    142, 141, 141, 142, 143, 141, 143, 88,
+    88, 143, 89, 78, 6, 84, 78, 84,
+    142, 142, 84, 85, 142, 85, 143, 143,
+    85, 86, 143, 86, 89, 89, 86, 0,
+    0, 86, 12, 86, 85, 144, 86, 144,
+    12, 12, 144, 13, 85, 84, 145, 85,
+    145, 144, 144, 145, 146, 144, 146, 13,
+    13, 146, 14, 84, 6, 90, 84, 90,
+    145, 145, 90, 91, 145, 91, 146, 146,
+    91, 92, 146, 92, 14, 14, 92, 1,
+    6, 74, 90, 74, 73, 147, 74, 147,
+    90, 90, 147, 91, 73, 72, 148, 73,
+    148, 147, 147, 148, 149, 147, 149, 91,
+    91, 149, 92, 72, 10, 44, 72, 44,
+    148, 148, 44, 43, 148, 43, 149, 149,
+    43, 42, 149, 42, 92, 92, 42, 1,
+    9, 93, 26, 93, 94, 150, 93, 150,
+    26, 26, 150, 25, 94, 95, 151, 94,
+    151, 150, 150, 151, 152, 150, 152, 25,
+    25, 152, 24, 95, 11, 87, 95, 87,
+    151, 151, 87, 88, 151, 88, 152, 152,
+    88, 89, 152, 89, 24, 24, 89, 0,
+    9, 96, 93, 96, 97, 153, 96, 153,
+    93, 93, 153, 94, 97, 98, 154, 97,
+    154, 153, 153, 154, 155, 153, 155, 94,
+    94, 155, 95, 98, 2, 99, 98, 99,
+    154, 154, 99, 100, 154, 100, 155, 155,
+    100, 101, 155, 101, 95, 95, 101, 11,
+    9, 30, 96, 30, 31, 156, 30, 156,
+    96, 96, 156, 97, 31, 32, 157, 31,
+    157, 156, 156, 157, 158, 156, 158, 97,
+    97, 158, 98, 32, 5, 60, 32, 60,
+    157, 157, 60, 61, 157, 61, 158, 158,
+    61, 62, 158, 62, 98, 98, 62, 2,
+    7, 81, 68, 81, 82, 159, 81, 159,
+    68, 68, 159, 67, 82, 83, 160, 82,
+    160, 159, 159, 160, 161, 159, 161, 67,
+    67, 161, 66, 83, 11, 101, 83, 101,
+    160, 160, 101, 100, 160, 100, 161, 161,
+    100, 99, 161, 99, 66, 66, 99, 2
+};
+const uint16_t STATIC_ICOSPHERE_2_INDICES[] =
+{
+    0, 12, 18, 12, 13, 102, 12, 102,
+    18, 18, 102, 19, 13, 14, 103, 13,
+    103, 102, 102, 103, 104, 102, 104, 19,
+    19, 104, 20, 14, 1, 15, 14, 15,
+    103, 103, 15, 16, 103, 16, 104, 104,
+    16, 17, 104, 17, 20, 20, 17, 4,
+    0, 18, 24, 18, 19, 105, 18, 105,
+    24, 24, 105, 25, 19, 20, 106, 19,
+    106, 105, 105, 106, 107, 105, 107, 25,
+    25, 107, 26, 20, 4, 21, 20, 21,
+    106, 106, 21, 22, 106, 22, 107, 107,
+    22, 23, 107, 23, 26, 26, 23, 9,
+    9, 23, 162, 23, 22, 108, 23, 108,
+    162, 162, 108, 163, 22, 21, 109, 22,
+    109, 108, 108, 109, 164, 108, 164, 163,
+    31, 110, 32, 21, 4, 27, 21, 27,
+    109, 109, 27, 172, 109, 173, 164, 110,
+    174, 29, 110, 29, 32, 32, 29, 5,
+    4, 33, 27, 33, 34, 111, 33, 111,
+    27, 27, 111, 175, 34, 35, 112, 34,
+    112, 111, 111, 112, 113, 111, 113, 176,
+    177, 113, 29, 35, 8, 36, 35, 36,
+    112, 112, 36, 37, 112, 37, 113, 113,
+    37, 38, 113, 38, 29, 29, 38, 5,
+    4, 17, 33, 17, 16, 114, 17, 114,
+    33, 33, 114, 34, 16, 15, 115, 16,
+    115, 114, 114, 115, 116, 114, 116, 34,
+    34, 116, 35, 15, 1, 39, 15, 39,
+    115, 115, 39, 40, 115, 40, 116, 116,
+    40, 41, 116, 41, 35, 35, 41, 8,
+    8, 41, 45, 41, 40, 117, 41, 117,
+    45, 45, 117, 46, 40, 39, 118, 40,
+    118, 117, 117, 118, 119, 117, 119, 46,
+    46, 119, 47, 39, 1, 42, 39, 42,
+    118, 118, 42, 43, 118, 43, 119, 119,
+    43, 44, 119, 44, 47, 47, 44, 10,
+    8, 45, 51, 45, 46, 120, 45, 120,
+    51, 51, 120, 52, 46, 47, 121, 46,
+    121, 120, 120, 121, 122, 120, 122, 52,
+    52, 122, 53, 47, 10, 48, 47, 48,
+    121, 121, 48, 49, 121, 49, 122, 122,
+    49, 50, 122, 50, 53, 53, 50, 3,
+    5, 38, 54, 38, 37, 123, 38, 123,
+    54, 54, 123, 55, 37, 36, 124, 37,
+    124, 123, 123, 124, 125, 123, 125, 55,
+    55, 125, 56, 36, 8, 51, 36, 51,
+    124, 124, 51, 52, 124, 52, 125, 125,
+    52, 53, 125, 53, 56, 56, 53, 3,
+    5, 54, 60, 54, 55, 126, 54, 126,
+    60, 60, 126, 61, 55, 56, 127, 55,
+    127, 126, 126, 127, 128, 126, 128, 61,
+    61, 128, 62, 56, 3, 57, 56, 57,
+    127, 127, 57, 58, 127, 58, 128, 128,
+    58, 59, 128, 59, 62, 62, 59, 2,
+    2, 59, 66, 59, 58, 129, 59, 129,
+    66, 66, 129, 67, 58, 57, 130, 58,
+    130, 129, 129, 130, 131, 129, 131, 67,
+    67, 131, 68, 57, 3, 63, 57, 63,
+    130, 130, 63, 64, 130, 64, 131, 131,
+    64, 65, 131, 65, 68, 68, 65, 7,
+    7, 65, 69, 65, 64, 132, 65, 132,
+    69, 69, 132, 70, 64, 63, 133, 64,
+    133, 132, 132, 133, 134, 132, 134, 70,
+    70, 134, 71, 63, 3, 50, 63, 50,
+    133, 133, 50, 49, 133, 49, 134, 134,
+    49, 48, 134, 48, 71, 71, 48, 10,
+    7, 69, 75, 69, 70, 135, 69, 135,
+    75, 75, 135, 178, 70, 71, 136, 70,
+    136, 135, 135, 136, 137, 135, 137, 179,
+    180, 137, 77, 71, 10, 72, 71, 72,
+    136, 136, 72, 73, 136, 73, 137, 137,
+    73, 74, 137, 74, 77, 77, 74, 6,
+    7, 75, 81, 75, 181, 138, 75, 138,
+    81, 81, 138, 82, 182, 77, 139, 183,
+    139, 165, 165, 139, 140, 165, 140, 166,
+    166, 140, 167, 77, 6, 78, 77, 78,
+    139, 139, 78, 79, 139, 79, 140, 140,
+    79, 80, 140, 80, 167, 167, 80, 11,
+    11, 80, 87, 80, 79, 141, 80, 141,
+    87, 87, 141, 88, 79, 78, 142, 79,
+    142, 141, 141, 142, 143, 141, 143, 88,
+    88, 143, 89, 78, 6, 84, 78, 84,
+    142, 142, 84, 85, 142, 85, 143, 143,
+    85, 86, 143, 86, 89, 89, 86, 0,
+    0, 86, 12, 86, 85, 144, 86, 144,
+    12, 12, 144, 13, 85, 84, 145, 85,
+    145, 144, 144, 145, 146, 144, 146, 13,
+    13, 146, 14, 84, 6, 90, 84, 90,
+    145, 145, 90, 91, 145, 91, 146, 146,
+    91, 92, 146, 92, 14, 14, 92, 1,
+    6, 74, 90, 74, 73, 147, 74, 147,
+    90, 90, 147, 91, 73, 72, 148, 73,
+    148, 147, 147, 148, 149, 147, 149, 91,
+    91, 149, 92, 72, 10, 44, 72, 44,
+    148, 148, 44, 43, 148, 43, 149, 149,
+    43, 42, 149, 42, 92, 92, 42, 1,
+    9, 93, 26, 93, 94, 150, 93, 150,
+    26, 26, 150, 25, 94, 95, 151, 94,
+    151, 150, 150, 151, 152, 150, 152, 25,
+    25, 152, 24, 95, 11, 87, 95, 87,
+    151, 151, 87, 88, 151, 88, 152, 152,
+    88, 89, 152, 89, 24, 24, 89, 0,
+    9, 168, 93, 96, 97, 153, 168, 169,
+    93, 93, 169, 94, 97, 98, 154, 97,
+    154, 153, 153, 154, 155, 169, 170, 94,
+    94, 170, 95, 98, 2, 99, 98, 99,
+    154, 154, 99, 100, 154, 100, 155, 155,
+    100, 101, 170, 171, 95, 95, 171, 11,
+    9, 162, 168, 30, 31, 156, 30, 156,
+    96, 96, 156, 97, 31, 32, 157, 31,
+    157, 156, 156, 157, 158, 156, 158, 97,
+    97, 158, 98, 32, 5, 60, 32, 60,
+    157, 157, 60, 61, 157, 61, 158, 158,
+    61, 62, 158, 62, 98, 98, 62, 2,
+    7, 81, 68, 81, 82, 159, 81, 159,
+    68, 68, 159, 67, 82, 83, 160, 82,
+    160, 159, 159, 160, 161, 159, 161, 67,
+    67, 161, 66, 167, 11, 171, 83, 101,
+    160, 160, 101, 100, 160, 100, 161, 161,
+    100, 99, 161, 99, 66, 66, 99, 2
+};
+
+const float STATIC_ICOSPHERE_3_POSITIONS[] =
+{
+    -0.525731146f, 0.0f, 0.850650907f, 0.525731146f, 0.0f, 0.850650907f, -0.525731146f, 0.0f,
+    -0.850650907f, 0.525731146f, 0.0f, -0.850650907f, 0.0f, 0.850650907f, 0.525731146f, 0.0f,
+    0.850650907f, -0.525731146f, 0.0f, -0.850650907f, 0.525731146f, 0.0f, -0.850650907f, -0.525731146f,
+    0.850650907f, 0.525731146f, 0.0f, -0.850650907f, 0.525731146f, 0.0f, 0.850650907f, -0.525731146f,
+    0.0f, -0.850650907f, -0.525731146f, 0.0f, -0.42054382f, 0.0f, 0.907272279f, -0.295241803f,
+    0.0f, 0.955422521f, -0.152696595f, 0.0f, 0.988273144f, 0.0f, 0.0f, 0.99999994f,
+    0.152696595f, 0.0f, 0.988273144f, 0.295241803f, 0.0f, 0.955422521f, 0.42054382f, 0.0f,
+    0.907272279f, 0.490634441f, 0.113409035f, 0.863953888f, 0.442862689f, 0.23885563f, 0.864187777f, 0.381741494f,
+    0.370602429f, 0.846715569f, 0.309016973f, 0.49999997f, 0.809016943f, 0.229044884f, 0.617670715f, 0.752343893f,
+    0.147620901f, 0.716566861f, 0.68171829f, 0.0700906366f, 0.793863237f, 0.604043484f, -0.490634441f, 0.113409035f,
+    0.863953888f, -0.442862689f, 0.23885563f, 0.864187777f, -0.381741494f, 0.370602429f, 0.846715569f, -0.309016973f,
+    0.49999997f, 0.809016943f, -0.229044884f, 0.617670715f, 0.752343893f, -0.147620901f, 0.716566861f, 0.68171829f,
+    -0.0700906366f, 0.793863237f, 0.604043484f, -0.113409035f, 0.863953888f, 0.490634441f, -0.23885563f, 0.864187777f,
+    0.442862689f, -0.370602429f, 0.846715569f, 0.381741494f, -0.49999997f, 0.809016943f, 0.309016973f, -0.617670715f,
+    0.752343893f, 0.229044884f, -0.716566861f, 0.68171829f, 0.147620901f, -0.793863237f, 0.604043484f, 0.0700906366f,
+    -0.604043484f, 0.0700906366f, 0.793863237f, -0.68171829f, 0.147620901f, 0.716566861f, -0.752343893f, 0.229044884f,
+    0.617670715f, -0.809016943f, 0.309016973f, 0.49999997f, -0.846715569f, 0.381741494f, 0.370602429f, -0.864187777f,
+    0.442862689f, 0.23885563f, -0.863953888f, 0.490634441f, 0.113409035f, 0.0f, 0.907272279f, 0.42054382f,
+    0.0f, 0.955422521f, 0.295241803f, 0.0f, 0.988273144f, 0.152696595f, 0.0f, 0.99999994f,
+    0.0f, 0.0f, 0.988273144f, -0.152696595f, 0.0f, 0.955422521f, -0.295241803f, 0.0f,
+    0.907272279f, -0.42054382f, -0.793863237f, 0.604043484f, -0.0700906366f, -0.716566861f, 0.68171829f, -0.147620901f,
+    -0.617670715f, 0.752343893f, -0.229044884f, -0.49999997f, 0.809016943f, -0.309016973f, -0.370602429f, 0.846715569f,
+    -0.381741494f, -0.23885563f, 0.864187777f, -0.442862689f, -0.113409035f, 0.863953888f, -0.490634441f, 0.113409035f,
+    0.863953888f, 0.490634441f, 0.23885563f, 0.864187777f, 0.442862689f, 0.370602429f, 0.846715569f, 0.381741494f,
+    0.49999997f, 0.809016943f, 0.309016973f, 0.617670715f, 0.752343893f, 0.229044884f, 0.716566861f, 0.68171829f,
+    0.147620901f, 0.793863237f, 0.604043484f, 0.0700906366f, 0.793863237f, 0.604043484f, -0.0700906366f, 0.716566861f,
+    0.68171829f, -0.147620901f, 0.617670715f, 0.752343893f, -0.229044884f, 0.49999997f, 0.809016943f, -0.309016973f,
+    0.370602429f, 0.846715569f, -0.381741494f, 0.23885563f, 0.864187777f, -0.442862689f, 0.113409035f, 0.863953888f,
+    -0.490634441f, 0.604043484f, 0.0700906366f, 0.793863237f, 0.68171829f, 0.147620901f, 0.716566861f, 0.752343893f,
+    0.229044884f, 0.617670715f, 0.809016943f, 0.309016973f, 0.49999997f, 0.846715569f, 0.381741494f, 0.370602429f,
+    0.864187777f, 0.442862689f, 0.23885563f, 0.863953888f, 0.490634441f, 0.113409035f, 0.604043484f, -0.0700906366f,
+    0.793863237f, 0.68171829f, -0.147620901f, 0.716566861f, 0.752343893f, -0.229044884f, 0.617670715f, 0.809016943f,
+    -0.309016973f, 0.49999997f, 0.846715569f, -0.381741494f, 0.370602429f, 0.864187777f, -0.442862689f, 0.23885563f,
+    0.863953888f, -0.490634441f, 0.113409035f, 0.907272279f, 0.42054382f, 0.0f, 0.955422521f, 0.295241803f,
+    0.0f, 0.988273144f, 0.152696595f, 0.0f, 0.99999994f, 0.0f, 0.0f, 0.988273144f,
+    -0.152696595f, 0.0f, 0.955422521f, -0.295241803f, 0.0f, 0.907272279f, -0.42054382f, 0.0f,
+    0.863953888f, -0.490634441f, -0.113409035f, 0.864187777f, -0.442862689f, -0.23885563f, 0.846715569f, -0.381741494f,
+    -0.370602429f, 0.809016943f, -0.309016973f, -0.49999997f, 0.752343893f, -0.229044884f, -0.617670715f, 0.68171829f,
+    -0.147620901f, -0.716566861f, 0.604043484f, -0.0700906366f, -0.793863237f, 0.863953888f, 0.490634441f, -0.113409035f,
+    0.864187777f, 0.442862689f, -0.23885563f, 0.846715569f, 0.381741494f, -0.370602429f, 0.809016943f, 0.309016973f,
+    -0.49999997f, 0.752343893f, 0.229044884f, -0.617670715f, 0.68171829f, 0.147620901f, -0.716566861f, 0.604043484f,
+    0.0700906366f, -0.793863237f, 0.0700906366f, 0.793863237f, -0.604043484f, 0.147620901f, 0.716566861f, -0.68171829f,
+    0.229044884f, 0.617670715f, -0.752343893f, 0.309016973f, 0.49999997f, -0.809016943f, 0.381741494f, 0.370602429f,
+    -0.846715569f, 0.442862689f, 0.23885563f, -0.864187777f, 0.490634441f, 0.113409035f, -0.863953888f, 0.42054382f,
+    0.0f, -0.907272279f, 0.295241803f, 0.0f, -0.955422521f, 0.152696595f, 0.0f, -0.988273144f,
+    0.0f, 0.0f, -0.99999994f, -0.152696595f, 0.0f, -0.988273144f, -0.295241803f, 0.0f,
+    -0.955422521f, -0.42054382f, 0.0f, -0.907272279f, -0.0700906366f, 0.793863237f, -0.604043484f, -0.147620901f,
+    0.716566861f, -0.68171829f, -0.229044884f, 0.617670715f, -0.752343893f, -0.309016973f, 0.49999997f, -0.809016943f,
+    -0.381741494f, 0.370602429f, -0.846715569f, -0.442862689f, 0.23885563f, -0.864187777f, -0.490634441f, 0.113409035f,
+    -0.863953888f, 0.490634441f, -0.113409035f, -0.863953888f, 0.442862689f, -0.23885563f, -0.864187777f, 0.381741494f,
+    -0.370602429f, -0.846715569f, 0.309016973f, -0.49999997f, -0.809016943f, 0.229044884f, -0.617670715f, -0.752343893f,
+    0.147620901f, -0.716566861f, -0.68171829f, 0.0700906366f, -0.793863237f, -0.604043484f, -0.490634441f, -0.113409035f,
+    -0.863953888f, -0.442862689f, -0.23885563f, -0.864187777f, -0.381741494f, -0.370602429f, -0.846715569f, -0.309016973f,
+    -0.49999997f, -0.809016943f, -0.229044884f, -0.617670715f, -0.752343893f, -0.147620901f, -0.716566861f, -0.68171829f,
+    -0.0700906366f, -0.793863237f, -0.604043484f, 0.113409035f, -0.863953888f, -0.490634441f, 0.23885563f, -0.864187777f,
+    -0.442862689f, 0.370602429f, -0.846715569f, -0.381741494f, 0.49999997f, -0.809016943f, -0.309016973f, 0.617670715f,
+    -0.752343893f, -0.229044884f, 0.716566861f, -0.68171829f, -0.147620901f, 0.793863237f, -0.604043484f, -0.0700906366f,
+    0.793863237f, -0.604043484f, 0.0700906366f, 0.716566861f, -0.68171829f, 0.147620901f, 0.617670715f, -0.752343893f,
+    0.229044884f, 0.49999997f, -0.809016943f, 0.309016973f, 0.370602429f, -0.846715569f, 0.381741494f, 0.23885563f,
+    -0.864187777f, 0.442862689f, 0.113409035f, -0.863953888f, 0.490634441f, 0.0f, -0.907272279f, -0.42054382f,
+    0.0f, -0.955422521f, -0.295241803f, 0.0f, -0.988273144f, -0.152696595f, 0.0f, -0.99999994f,
+    0.0f, 0.0f, -0.988273144f, 0.152696595f, 0.0f, -0.955422521f, 0.295241803f, 0.0f,
+    -0.907272279f, 0.42054382f, -0.113409035f, -0.863953888f, 0.490634441f, -0.23885563f, -0.864187777f, 0.442862689f,
+    -0.370602429f, -0.846715569f, 0.381741494f, -0.49999997f, -0.809016943f, 0.309016973f, -0.617670715f, -0.752343893f,
+    0.229044884f, -0.716566861f, -0.68171829f, 0.147620901f, -0.793863237f, -0.604043484f, 0.0700906366f, -0.113409035f,
+    -0.863953888f, -0.490634441f, -0.23885563f, -0.864187777f, -0.442862689f, -0.370602429f, -0.846715569f, -0.381741494f,
+    -0.49999997f, -0.809016943f, -0.309016973f, -0.617670715f, -0.752343893f, -0.229044884f, -0.716566861f, -0.68171829f,
+    -0.147620901f, -0.793863237f, -0.604043484f, -0.0700906366f, -0.0700906366f, -0.793863237f, 0.604043484f, -0.147620901f,
+    -0.716566861f, 0.68171829f, -0.229044884f, -0.617670715f, 0.752343893f, -0.309016973f, -0.49999997f, 0.809016943f,
+    -0.381741494f, -0.370602429f, 0.846715569f, -0.442862689f, -0.23885563f, 0.864187777f, -0.490634441f, -0.113409035f,
+    0.863953888f, -0.863953888f, -0.490634441f, 0.113409035f, -0.864187777f, -0.442862689f, 0.23885563f, -0.846715569f,
+    -0.381741494f, 0.370602429f, -0.809016943f, -0.309016973f, 0.49999997f, -0.752343893f, -0.229044884f, 0.617670715f,
+    -0.68171829f, -0.147620901f, 0.716566861f, -0.604043484f, -0.0700906366f, 0.793863237f, 0.0700906366f, -0.793863237f,
+    0.604043484f, 0.147620901f, -0.716566861f, 0.68171829f, 0.229044884f, -0.617670715f, 0.752343893f, 0.309016973f,
+    -0.49999997f, 0.809016943f, 0.381741494f, -0.370602429f, 0.846715569f, 0.442862689f, -0.23885563f, 0.864187777f,
+    0.490634441f, -0.113409035f, 0.863953888f, -0.907272279f, 0.42054382f, 0.0f, -0.955422521f, 0.295241803f,
+    0.0f, -0.988273144f, 0.152696595f, 0.0f, -0.99999994f, 0.0f, 0.0f, -0.988273144f,
+    -0.152696595f, 0.0f, -0.955422521f, -0.295241803f, 0.0f, -0.907272279f, -0.42054382f, 0.0f,
+    -0.863953888f, 0.490634441f, -0.113409035f, -0.864187777f, 0.442862689f, -0.23885563f, -0.846715569f, 0.381741494f,
+    -0.370602429f, -0.809016943f, 0.309016973f, -0.49999997f, -0.752343893f, 0.229044884f, -0.617670715f, -0.68171829f,
+    0.147620901f, -0.716566861f, -0.604043484f, 0.0700906366f, -0.793863237f, -0.604043484f, -0.0700906366f, -0.793863237f,
+    -0.68171829f, -0.147620901f, -0.716566861f, -0.752343893f, -0.229044884f, -0.617670715f, -0.809016943f, -0.309016973f,
+    -0.49999997f, -0.846715569f, -0.381741494f, -0.370602429f, -0.864187777f, -0.442862689f, -0.23885563f, -0.863953888f,
+    -0.490634441f, -0.113409035f, -0.373140365f, 0.120750763f, 0.91988343f, -0.234579682f, 0.126519307f, 0.963828325f,
+    -0.3127729f, 0.253038615f, 0.91550225f, -0.0801787227f, 0.129731908f, 0.988302052f, -0.16245985f, 0.262865543f,
+    0.95105654f, -0.240536168f, 0.38919571f, 0.889195681f, 0.0801787227f, 0.129731908f, 0.988302052f, 0.0f,
+    0.266404688f, 0.963861167f, -0.082323581f, 0.399607062f, 0.912982523f, -0.160357445f, 0.518927634f, 0.839642525f,
+    0.234579682f, 0.126519307f, 0.963828325f, 0.16245985f, 0.262865543f, 0.95105654f, 0.082323581f, 0.399607062f,
+    0.912982523f, 0.0f, 0.525731087f, 0.850650787f, -0.078193225f, 0.632596493f, 0.770524025f, 0.373140365f,
+    0.120750763f, 0.91988343f, 0.3127729f, 0.253038615f, 0.91550225f, 0.240536168f, 0.38919571f, 0.889195681f,
+    0.160357445f, 0.518927634f, 0.839642525f, 0.078193225f, 0.632596493f, 0.770524025f, 0.0f, 0.72450459f,
+    0.68926996f, -0.568519235f, 0.19537884f, 0.799132645f, -0.51748544f, 0.331231833f, 0.788982987f, -0.644004762f,
+    0.282905757f, 0.71078974f, -0.450446814f, 0.469374448f, 0.759463787f, -0.587785244f, 0.425325394f, 0.688190937f,
+    -0.709910631f, 0.370268077f, 0.599106312f, -0.370268077f, 0.599106312f, 0.709910631f, -0.513375461f, 0.564254224f,
+    0.646577775f, -0.646577775f, 0.513375461f, 0.564254224f, -0.759463787f, 0.450446814f, 0.469374448f, -0.282905757f,
+    0.71078974f, 0.644004762f, -0.425325394f, 0.688190937f, 0.587785244f, -0.564254224f, 0.646577775f, 0.513375461f,
+    -0.688190937f, 0.587785244f, 0.425325394f, -0.788983047f, 0.517485499f, 0.331231862f, -0.19537884f, 0.799132645f,
+    0.568519235f, -0.331231862f, 0.788983047f, 0.517485499f, -0.469374448f, 0.759463787f, 0.450446814f, -0.599106312f,
+    0.709910631f, 0.370268077f, -0.71078974f, 0.644004762f, 0.282905757f, -0.799132645f, 0.568519235f, 0.19537884f,
+    -0.72450459f, 0.68926996f, 0.0f, -0.632596493f, 0.770524025f, 0.078193225f, -0.632596493f, 0.770524025f,
+    -0.078193225f, -0.518927634f, 0.839642525f, 0.160357445f, -0.525731087f, 0.850650787f, 0.0f, -0.518927634f,
+    0.839642525f, -0.160357445f, -0.38919571f, 0.889195681f, 0.240536168f, -0.399607033f, 0.912982404f, 0.0823235735f,
+    -0.399607033f, 0.912982404f, -0.0823235735f, -0.38919571f, 0.889195681f, -0.240536168f, -0.253038615f, 0.91550225f,
+    0.3127729f, -0.262865543f, 0.95105654f, 0.16245985f, -0.266404688f, 0.963861167f, 0.0f, -0.262865543f,
+    0.95105654f, -0.16245985f, -0.253038615f, 0.91550225f, -0.3127729f, -0.120750763f, 0.91988343f, 0.373140365f,
+    -0.126519322f, 0.963828444f, 0.234579712f, -0.129731908f, 0.988302052f, 0.0801787227f, -0.129731908f, 0.988302052f,
+    -0.0801787227f, -0.126519322f, 0.963828444f, -0.234579712f, -0.120750763f, 0.91988343f, -0.373140365f, 0.120750763f,
+    0.91988343f, 0.373140365f, 0.253038615f, 0.91550225f, 0.3127729f, 0.126519322f, 0.963828444f, 0.234579712f,
+    0.38919571f, 0.889195681f, 0.240536168f, 0.262865543f, 0.95105654f, 0.16245985f, 0.129731908f, 0.988302052f,
+    0.0801787227f, 0.518927634f, 0.839642525f, 0.160357445f, 0.399607033f, 0.912982404f, 0.0823235735f, 0.266404688f,
+    0.963861167f, 0.0f, 0.129731908f, 0.988302052f, -0.0801787227f, 0.632596493f, 0.770524025f, 0.078193225f,
+    0.525731087f, 0.850650787f, 0.0f, 0.399607033f, 0.912982404f, -0.0823235735f, 0.262865543f, 0.95105654f,
+    -0.16245985f, 0.126519322f, 0.963828444f, -0.234579712f, 0.72450459f, 0.68926996f, 0.0f, 0.632596493f,
+    0.770524025f, -0.078193225f, 0.518927634f, 0.839642525f, -0.160357445f, 0.38919571f, 0.889195681f, -0.240536168f,
+    0.253038615f, 0.91550225f, -0.3127729f, 0.120750763f, 0.91988343f, -0.373140365f, 0.19537884f, 0.799132645f,
+    0.568519235f, 0.282905757f, 0.71078974f, 0.644004762f, 0.331231862f, 0.788983047f, 0.517485499f, 0.370268077f,
+    0.599106312f, 0.709910631f, 0.425325394f, 0.688190937f, 0.587785244f, 0.469374448f, 0.759463787f, 0.450446814f,
+    0.450446814f, 0.469374448f, 0.759463787f, 0.513375461f, 0.564254224f, 0.646577775f, 0.564254224f, 0.646577775f,
+    0.513375461f, 0.599106312f, 0.709910631f, 0.370268077f, 0.51748544f, 0.331231833f, 0.788982987f, 0.587785244f,
+    0.425325394f, 0.688190937f, 0.646577775f, 0.513375461f, 0.564254224f, 0.688190937f, 0.587785244f, 0.425325394f,
+    0.71078974f, 0.644004762f, 0.282905757f, 0.568519235f, 0.19537884f, 0.799132645f, 0.644004762f, 0.282905757f,
+    0.71078974f, 0.709910631f, 0.370268077f, 0.599106312f, 0.759463787f, 0.450446814f, 0.469374448f, 0.788983047f,
+    0.517485499f, 0.331231862f, 0.799132645f, 0.568519235f, 0.19537884f, 0.91988343f, 0.373140365f, 0.120750763f,
+    0.91550225f, 0.3127729f, 0.253038615f, 0.963828444f, 0.234579712f, 0.126519322f, 0.8891958f, 0.240536198f,
+    0.38919574f, 0.95105654f, 0.16245985f, 0.262865543f, 0.988302052f, 0.0801787227f, 0.129731908f, 0.839642525f,
+    0.160357445f, 0.518927634f, 0.912982523f, 0.082323581f, 0.399607062f, 0.963861167f, 0.0f, 0.266404688f,
+    0.988302052f, -0.0801787227f, 0.129731908f, 0.770524025f, 0.078193225f, 0.632596493f, 0.850650787f, 0.0f,
+    0.525731087f, 0.912982523f, -0.082323581f, 0.399607062f, 0.95105654f, -0.16245985f, 0.262865543f, 0.963828444f,
+    -0.234579712f, 0.126519322f, 0.68926996f, 0.0f, 0.72450459f, 0.770524025f, -0.078193225f, 0.632596493f,
+    0.839642525f, -0.160357445f, 0.518927634f, 0.8891958f, -0.240536198f, 0.38919574f, 0.91550225f, -0.3127729f,
+    0.253038615f, 0.91988343f, -0.373140365f, 0.120750763f, 0.91988343f, 0.373140365f, -0.120750763f, 0.963828444f,
+    0.234579712f, -0.126519322f, 0.91550225f, 0.3127729f, -0.253038615f, 0.988302052f, 0.0801787227f, -0.129731908f,
+    0.95105654f, 0.16245985f, -0.262865543f, 0.8891958f, 0.240536198f, -0.38919574f, 0.988302052f, -0.0801787227f,
+    -0.129731908f, 0.963861167f, 0.0f, -0.266404688f, 0.912982523f, 0.082323581f, -0.399607062f, 0.839642525f,
+    0.160357445f, -0.518927634f, 0.963828444f, -0.234579712f, -0.126519322f, 0.95105654f, -0.16245985f, -0.262865543f,
+    0.912982523f, -0.082323581f, -0.399607062f, 0.850650787f, 0.0f, -0.525731087f, 0.770524025f, 0.078193225f,
+    -0.632596493f, 0.91988343f, -0.373140365f, -0.120750763f, 0.91550225f, -0.3127729f, -0.253038615f, 0.8891958f,
+    -0.240536198f, -0.38919574f, 0.839642525f, -0.160357445f, -0.518927634f, 0.770524025f, -0.078193225f, -0.632596493f,
+    0.68926996f, 0.0f, -0.72450459f, 0.19537884f, 0.799132645f, -0.568519235f, 0.331231862f, 0.788983047f,
+    -0.517485499f, 0.282905757f, 0.71078974f, -0.644004762f, 0.469374448f, 0.759463787f, -0.450446814f, 0.425325394f,
+    0.688190937f, -0.587785244f, 0.370268077f, 0.599106312f, -0.709910631f, 0.599106312f, 0.709910631f, -0.370268077f,
+    0.564254224f, 0.646577775f, -0.513375461f, 0.513375461f, 0.564254224f, -0.646577775f, 0.450446814f, 0.469374448f,
+    -0.759463787f, 0.71078974f, 0.644004762f, -0.282905757f, 0.688190937f, 0.587785244f, -0.425325394f, 0.646577775f,
+    0.513375461f, -0.564254224f, 0.587785244f, 0.425325394f, -0.688190937f, 0.51748544f, 0.331231833f, -0.788982987f,
+    0.799132645f, 0.568519235f, -0.19537884f, 0.788983047f, 0.517485499f, -0.331231862f, 0.759463787f, 0.450446814f,
+    -0.469374448f, 0.709910631f, 0.370268077f, -0.599106312f, 0.644004762f, 0.282905757f, -0.71078974f, 0.568519235f,
+    0.19537884f, -0.799132645f, 0.0f, 0.72450459f, -0.68926996f, 0.078193225f, 0.632596493f, -0.770524025f,
+    -0.078193225f, 0.632596493f, -0.770524025f, 0.160357445f, 0.518927634f, -0.839642525f, 0.0f, 0.525731087f,
+    -0.850650787f, -0.160357445f, 0.518927634f, -0.839642525f, 0.240536168f, 0.38919571f, -0.889195681f, 0.082323581f,
+    0.399607062f, -0.912982523f, -0.082323581f, 0.399607062f, -0.912982523f, -0.240536168f, 0.38919571f, -0.889195681f,
+    0.3127729f, 0.253038615f, -0.91550225f, 0.16245985f, 0.262865543f, -0.95105654f, 0.0f, 0.266404688f,
+    -0.963861167f, -0.16245985f, 0.262865543f, -0.95105654f, -0.3127729f, 0.253038615f, -0.91550225f, 0.373140365f,
+    0.120750763f, -0.91988343f, 0.234579682f, 0.126519307f, -0.963828325f, 0.0801787227f, 0.129731908f, -0.988302052f,
+    -0.0801787227f, 0.129731908f, -0.988302052f, -0.234579682f, 0.126519307f, -0.963828325f, -0.373140365f, 0.120750763f,
+    -0.91988343f, -0.373140365f, -0.120750763f, -0.91988343f, -0.234579682f, -0.126519307f, -0.963828325f, -0.3127729f,
+    -0.253038615f, -0.91550225f, -0.0801787227f, -0.129731908f, -0.988302052f, -0.16245985f, -0.262865543f, -0.95105654f,
+    -0.240536168f, -0.38919571f, -0.889195681f, 0.0801787227f, -0.129731908f, -0.988302052f, 0.0f, -0.266404688f,
+    -0.963861167f, -0.082323581f, -0.399607062f, -0.912982523f, -0.160357445f, -0.518927634f, -0.839642525f, 0.234579682f,
+    -0.126519307f, -0.963828325f, 0.16245985f, -0.262865543f, -0.95105654f, 0.082323581f, -0.399607062f, -0.912982523f,
+    0.0f, -0.525731087f, -0.850650787f, -0.078193225f, -0.632596493f, -0.770524025f, 0.373140365f, -0.120750763f,
+    -0.91988343f, 0.3127729f, -0.253038615f, -0.91550225f, 0.240536168f, -0.38919571f, -0.889195681f, 0.160357445f,
+    -0.518927634f, -0.839642525f, 0.078193225f, -0.632596493f, -0.770524025f, 0.0f, -0.72450459f, -0.68926996f,
+    0.19537884f, -0.799132645f, -0.568519235f, 0.282905757f, -0.71078974f, -0.644004762f, 0.331231862f, -0.788983047f,
+    -0.517485499f, 0.370268077f, -0.599106312f, -0.709910631f, 0.425325394f, -0.688190937f, -0.587785244f, 0.469374448f,
+    -0.759463787f, -0.450446814f, 0.450446814f, -0.469374448f, -0.759463787f, 0.513375461f, -0.564254224f, -0.646577775f,
+    0.564254224f, -0.646577775f, -0.513375461f, 0.599106312f, -0.709910631f, -0.370268077f, 0.51748544f, -0.331231833f,
+    -0.788982987f, 0.587785244f, -0.425325394f, -0.688190937f, 0.646577775f, -0.513375461f, -0.564254224f, 0.688190937f,
+    -0.587785244f, -0.425325394f, 0.71078974f, -0.644004762f, -0.282905757f, 0.568519235f, -0.19537884f, -0.799132645f,
+    0.644004762f, -0.282905757f, -0.71078974f, 0.709910631f, -0.370268077f, -0.599106312f, 0.759463787f, -0.450446814f,
+    -0.469374448f, 0.788983047f, -0.517485499f, -0.331231862f, 0.799132645f, -0.568519235f, -0.19537884f, 0.120750763f,
+    -0.91988343f, -0.373140365f, 0.253038615f, -0.91550225f, -0.3127729f, 0.126519322f, -0.963828444f, -0.234579712f,
+    0.38919571f, -0.889195681f, -0.240536168f, 0.262865543f, -0.95105654f, -0.16245985f, 0.129731908f, -0.988302052f,
+    -0.0801787227f, 0.518927634f, -0.839642525f, -0.160357445f, 0.399607033f, -0.912982404f, -0.0823235735f, 0.266404688f,
+    -0.963861167f, 0.0f, 0.129731908f, -0.988302052f, 0.0801787227f, 0.632596493f, -0.770524025f, -0.078193225f,
+    0.525731087f, -0.850650787f, 0.0f, 0.399607033f, -0.912982404f, 0.0823235735f, 0.262865543f, -0.95105654f,
+    0.16245985f, 0.126519322f, -0.963828444f, 0.234579712f, 0.72450459f, -0.68926996f, 0.0f, 0.632596493f,
+    -0.770524025f, 0.078193225f, 0.518927634f, -0.839642525f, 0.160357445f, 0.38919571f, -0.889195681f, 0.240536168f,
+    0.253038615f, -0.91550225f, 0.3127729f, 0.120750763f, -0.91988343f, 0.373140365f, -0.120750763f, -0.91988343f,
+    -0.373140365f, -0.126519322f, -0.963828444f, -0.234579712f, -0.253038615f, -0.91550225f, -0.3127729f, -0.129731908f,
+    -0.988302052f, -0.0801787227f, -0.262865543f, -0.95105654f, -0.16245985f, -0.38919571f, -0.889195681f, -0.240536168f,
+    -0.129731908f, -0.988302052f, 0.0801787227f, -0.266404688f, -0.963861167f, 0.0f, -0.399607033f, -0.912982404f,
+    -0.0823235735f, -0.518927634f, -0.839642525f, -0.160357445f, -0.126519322f, -0.963828444f, 0.234579712f, -0.262865543f,
+    -0.95105654f, 0.16245985f, -0.399607033f, -0.912982404f, 0.0823235735f, -0.525731087f, -0.850650787f, 0.0f,
+    -0.632596493f, -0.770524025f, -0.078193225f, -0.120750763f, -0.91988343f, 0.373140365f, -0.253038615f, -0.91550225f,
+    0.3127729f, -0.38919571f, -0.889195681f, 0.240536168f, -0.518927634f, -0.839642525f, 0.160357445f, -0.632596493f,
+    -0.770524025f, 0.078193225f, -0.72450459f, -0.68926996f, 0.0f, -0.799132645f, -0.568519235f, 0.19537884f,
+    -0.71078974f, -0.644004762f, 0.282905757f, -0.788983047f, -0.517485499f, 0.331231862f, -0.599106312f, -0.709910631f,
+    0.370268077f, -0.688190937f, -0.587785244f, 0.425325394f, -0.759463787f, -0.450446814f, 0.469374448f, -0.469374448f,
+    -0.759463787f, 0.450446814f, -0.564254224f, -0.646577775f, 0.513375461f, -0.646577775f, -0.513375461f, 0.564254224f,
+    -0.709910631f, -0.370268077f, 0.599106312f, -0.331231862f, -0.788983047f, 0.517485499f, -0.425325394f, -0.688190937f,
+    0.587785244f, -0.513375461f, -0.564254224f, 0.646577775f, -0.587785244f, -0.425325394f, 0.688190937f, -0.644004762f,
+    -0.282905757f, 0.71078974f, -0.19537884f, -0.799132645f, 0.568519235f, -0.282905757f, -0.71078974f, 0.644004762f,
+    -0.370268077f, -0.599106312f, 0.709910631f, -0.450446814f, -0.469374448f, 0.759463787f, -0.51748544f, -0.331231833f,
+    0.788982987f, -0.568519235f, -0.19537884f, 0.799132645f, -0.373140365f, -0.120750763f, 0.91988343f, -0.3127729f,
+    -0.253038615f, 0.91550225f, -0.234579682f, -0.126519307f, 0.963828325f, -0.240536168f, -0.38919571f, 0.889195681f,
+    -0.16245985f, -0.262865543f, 0.95105654f, -0.0801787227f, -0.129731908f, 0.988302052f, -0.160357445f, -0.518927634f,
+    0.839642525f, -0.082323581f, -0.399607062f, 0.912982523f, 0.0f, -0.266404688f, 0.963861167f, 0.0801787227f,
+    -0.129731908f, 0.988302052f, -0.078193225f, -0.632596493f, 0.770524025f, 0.0f, -0.525731087f, 0.850650787f,
+    0.082323581f, -0.399607062f, 0.912982523f, 0.16245985f, -0.262865543f, 0.95105654f, 0.234579682f, -0.126519307f,
+    0.963828325f, 0.0f, -0.72450459f, 0.68926996f, 0.078193225f, -0.632596493f, 0.770524025f, 0.160357445f,
+    -0.518927634f, 0.839642525f, 0.240536168f, -0.38919571f, 0.889195681f, 0.3127729f, -0.253038615f, 0.91550225f,
+    0.373140365f, -0.120750763f, 0.91988343f, 0.19537884f, -0.799132645f, 0.568519235f, 0.331231862f, -0.788983047f,
+    0.517485499f, 0.282905757f, -0.71078974f, 0.644004762f, 0.469374448f, -0.759463787f, 0.450446814f, 0.425325394f,
+    -0.688190937f, 0.587785244f, 0.370268077f, -0.599106312f, 0.709910631f, 0.599106312f, -0.709910631f, 0.370268077f,
+    0.564254224f, -0.646577775f, 0.513375461f, 0.513375461f, -0.564254224f, 0.646577775f, 0.450446814f, -0.469374448f,
+    0.759463787f, 0.71078974f, -0.644004762f, 0.282905757f, 0.688190937f, -0.587785244f, 0.425325394f, 0.646577775f,
+    -0.513375461f, 0.564254224f, 0.587785244f, -0.425325394f, 0.688190937f, 0.51748544f, -0.331231833f, 0.788982987f,
+    0.799132645f, -0.568519235f, 0.19537884f, 0.788983047f, -0.517485499f, 0.331231862f, 0.759463787f, -0.450446814f,
+    0.469374448f, 0.709910631f, -0.370268077f, 0.599106312f, 0.644004762f, -0.282905757f, 0.71078974f, 0.568519235f,
+    -0.19537884f, 0.799132645f, -0.91988343f, 0.373140365f, 0.120750763f, -0.963828444f, 0.234579712f, 0.126519322f,
+    -0.91550225f, 0.3127729f, 0.253038615f, -0.988302052f, 0.0801787227f, 0.129731908f, -0.95105654f, 0.16245985f,
+    0.262865543f, -0.8891958f, 0.240536198f, 0.38919574f, -0.988302052f, -0.0801787227f, 0.129731908f, -0.963861167f,
+    0.0f, 0.266404688f, -0.912982523f, 0.082323581f, 0.399607062f, -0.839642525f, 0.160357445f, 0.518927634f,
+    -0.963828444f, -0.234579712f, 0.126519322f, -0.95105654f, -0.16245985f, 0.262865543f, -0.912982523f, -0.082323581f,
+    0.399607062f, -0.850650787f, 0.0f, 0.525731087f, -0.770524025f, 0.078193225f, 0.632596493f, -0.91988343f,
+    -0.373140365f, 0.120750763f, -0.91550225f, -0.3127729f, 0.253038615f, -0.8891958f, -0.240536198f, 0.38919574f,
+    -0.839642525f, -0.160357445f, 0.518927634f, -0.770524025f, -0.078193225f, 0.632596493f, -0.68926996f, 0.0f,
+    0.72450459f, -0.91988343f, 0.373140365f, -0.120750763f, -0.91550225f, 0.3127729f, -0.253038615f, -0.963828444f,
+    0.234579712f, -0.126519322f, -0.8891958f, 0.240536198f, -0.38919574f, -0.95105654f, 0.16245985f, -0.262865543f,
+    -0.988302052f, 0.0801787227f, -0.129731908f, -0.839642525f, 0.160357445f, -0.518927634f, -0.912982523f, 0.082323581f,
+    -0.399607062f, -0.963861167f, 0.0f, -0.266404688f, -0.988302052f, -0.0801787227f, -0.129731908f, -0.770524025f,
+    0.078193225f, -0.632596493f, -0.850650787f, 0.0f, -0.525731087f, -0.912982523f, -0.082323581f, -0.399607062f,
+    -0.95105654f, -0.16245985f, -0.262865543f, -0.963828444f, -0.234579712f, -0.126519322f, -0.68926996f, 0.0f,
+    -0.72450459f, -0.770524025f, -0.078193225f, -0.632596493f, -0.839642525f, -0.160357445f, -0.518927634f, -0.8891958f,
+    -0.240536198f, -0.38919574f, -0.91550225f, -0.3127729f, -0.253038615f, -0.91988343f, -0.373140365f, -0.120750763f,
+    -0.799132645f, 0.568519235f, -0.19537884f, -0.71078974f, 0.644004762f, -0.282905757f, -0.788983047f, 0.517485499f,
+    -0.331231862f, -0.599106312f, 0.709910631f, -0.370268077f, -0.688190937f, 0.587785244f, -0.425325394f, -0.759463787f,
+    0.450446814f, -0.469374448f, -0.469374448f, 0.759463787f, -0.450446814f, -0.564254224f, 0.646577775f, -0.513375461f,
+    -0.646577775f, 0.513375461f, -0.564254224f, -0.709910631f, 0.370268077f, -0.599106312f, -0.331231862f, 0.788983047f,
+    -0.517485499f, -0.425325394f, 0.688190937f, -0.587785244f, -0.513375461f, 0.564254224f, -0.646577775f, -0.587785244f,
+    0.425325394f, -0.688190937f, -0.644004762f, 0.282905757f, -0.71078974f, -0.19537884f, 0.799132645f, -0.568519235f,
+    -0.282905757f, 0.71078974f, -0.644004762f, -0.370268077f, 0.599106312f, -0.709910631f, -0.450446814f, 0.469374448f,
+    -0.759463787f, -0.51748544f, 0.331231833f, -0.788982987f, -0.568519235f, 0.19537884f, -0.799132645f, -0.19537884f,
+    -0.799132645f, -0.568519235f, -0.331231862f, -0.788983047f, -0.517485499f, -0.282905757f, -0.71078974f, -0.644004762f,
+    -0.469374448f, -0.759463787f, -0.450446814f, -0.425325394f, -0.688190937f, -0.587785244f, -0.370268077f, -0.599106312f,
+    -0.709910631f, -0.599106312f, -0.709910631f, -0.370268077f, -0.564254224f, -0.646577775f, -0.513375461f, -0.513375461f,
+    -0.564254224f, -0.646577775f, -0.450446814f, -0.469374448f, -0.759463787f, -0.71078974f, -0.644004762f, -0.282905757f,
+    -0.688190937f, -0.587785244f, -0.425325394f, -0.646577775f, -0.513375461f, -0.564254224f, -0.587785244f, -0.425325394f,
+    -0.688190937f, -0.51748544f, -0.331231833f, -0.788982987f, -0.799132645f, -0.568519235f, -0.19537884f, -0.788983047f,
+    -0.517485499f, -0.331231862f, -0.759463787f, -0.450446814f, -0.469374448f, -0.709910631f, -0.370268077f, -0.599106312f,
+    -0.644004762f, -0.282905757f, -0.71078974f, -0.568519235f, -0.19537884f, -0.799132645f, -0.793863237f, 0.604043484f,
+    -0.0700906366f, -0.716566861f, 0.68171829f, -0.147620901f, -0.632596493f, 0.770524025f, -0.078193225f, -0.518927634f,
+    0.839642525f, -0.160357445f, -0.399607033f, 0.912982404f, -0.0823235735f, -0.262865543f, 0.95105654f, -0.16245985f,
+    -0.129731908f, 0.988302052f, -0.0801787227f, -0.129731908f, -0.988302052f, -0.0801787227f, -0.262865543f, -0.95105654f,
+    -0.16245985f, -0.399607033f, -0.912982404f, -0.0823235735f, -0.518927634f, -0.839642525f, -0.160357445f, -0.632596493f,
+    -0.770524025f, -0.078193225f, -0.716566861f, -0.68171829f, -0.147620901f, -0.793863237f, -0.604043484f, -0.0700906366f,
+    -0.863953888f, 0.490634441f, -0.113409035f, -0.91988343f, 0.373140365f, -0.120750763f, -0.963828444f, 0.234579712f,
+    -0.126519322f, -0.988302052f, 0.0801787227f, -0.129731908f, -0.988302052f, -0.0801787227f, -0.129731908f, -0.963828444f,
+    -0.234579712f, -0.126519322f, -0.91988343f, -0.373140365f, -0.120750763f, -0.863953888f, -0.490634441f, -0.113409035f,
+    0.0f, 0.99999994f, 0.0f, 0.0f, 0.99999994f, 0.0f, 0.0f, 0.99999994f,
+    0.0f, 0.0f, 0.99999994f, 0.0f, 0.0f, 0.99999994f, 0.0f, 0.0f,
+    0.99999994f, 0.0f, 0.0f, -0.99999994f, 0.0f, 0.0f, -0.99999994f, 0.0f,
+    0.0f, -0.99999994f, 0.0f, 0.0f, -0.99999994f, 0.0f, 0.0f, -0.99999994f,
+    0.0f, 0.0f, -0.99999994f, 0.0f
+};
+const float STATIC_ICOSPHERE_3_UVS[] =
+{
+    0.838104069f, 0.49999997f, 0.661895931f, 0.49999997f, 0.161895931f, 0.49999997f, 0.338104069f, 0.49999997f,
+    0.75f, 0.176208138f, 0.25f, 0.176208138f, 0.75f, 0.823791862f, 0.25f, 0.823791862f,
+    0.5f, 0.323791802f, 1.0f, 0.323791802f, 0.5f, 0.676208198f, 1.0f, 0.676208198f,
+    0.819080353f, 0.49999997f, 0.797700107f, 0.49999997f, 0.77439785f, 0.49999997f, 0.75f, 0.49999997f,
+    0.72560215f, 0.49999997f, 0.702299893f, 0.49999997f, 0.680919647f, 0.49999997f, 0.667800009f, 0.463822901f,
+    0.674629509f, 0.423227727f, 0.682588279f, 0.379151225f, 0.691930115f, 0.333333313f, 0.702965438f, 0.28807646f,
+    0.716060221f, 0.245712459f, 0.73161453f, 0.208066583f, 0.832199931f, 0.463822901f, 0.825370431f, 0.423227727f,
+    0.817411721f, 0.379151225f, 0.808069825f, 0.333333313f, 0.797034502f, 0.28807646f, 0.783939779f, 0.245712459f,
+    0.76838541f, 0.208066583f, 0.786153316f, 0.167980731f, 0.828722119f, 0.167832822f, 0.872643769f, 0.178576589f,
+    0.911895871f, 0.200000018f, 0.943483829f, 0.228923202f, 0.967664659f, 0.261232972f, 0.985984445f, 0.293555319f,
+    0.853519917f, 0.477671117f, 0.871034265f, 0.452838391f, 0.8905949f, 0.426439732f, 0.911895871f, 0.400000006f,
+    0.934336901f, 0.375324458f, 0.957082152f, 0.353962898f, 0.979226887f, 0.336764991f, 0.75f, 0.138160646f,
+    0.75f, 0.095400244f, 0.75f, 0.0487956703f, 0.5f, 0.000109910965f, 0.25f, 0.0487956703f,
+    0.25f, 0.095400244f, 0.25f, 0.138160646f, 0.0140155554f, 0.293555319f, 0.032335341f, 0.261232972f,
+    0.0565161407f, 0.228923202f, 0.088104099f, 0.200000018f, 0.127356231f, 0.178576589f, 0.171277881f, 0.167832822f,
+    0.213846654f, 0.167980731f, 0.713846684f, 0.167980731f, 0.671277881f, 0.167832822f, 0.627356231f, 0.178576589f,
+    0.588104129f, 0.200000018f, 0.556516111f, 0.228923202f, 0.532335341f, 0.261232972f, 0.514015555f, 0.293555319f,
+    0.485984474f, 0.293555319f, 0.467664659f, 0.261232972f, 0.443483889f, 0.228923202f, 0.411895901f, 0.200000018f,
+    0.372643769f, 0.178576589f, 0.328722149f, 0.167832822f, 0.286153346f, 0.167980731f, 0.646480024f, 0.477671117f,
+    0.628965735f, 0.452838391f, 0.6094051f, 0.426439732f, 0.588104129f, 0.400000006f, 0.565663099f, 0.375324458f,
+    0.542917848f, 0.353962898f, 0.520773113f, 0.336764991f, 0.646480024f, 0.522328854f, 0.628965735f, 0.547161639f,
+    0.6094051f, 0.573560238f, 0.588104129f, 0.600000024f, 0.565663099f, 0.624675512f, 0.542917848f, 0.646037102f,
+    0.520773113f, 0.663235009f, 0.5f, 0.361839324f, 0.5f, 0.404599756f, 0.5f, 0.451204211f,
+    0.5f, 0.49999997f, 0.5f, 0.54879576f, 0.5f, 0.595400214f, 0.5f, 0.638160706f,
+    0.479226917f, 0.663235009f, 0.457082123f, 0.646037102f, 0.434336901f, 0.624675512f, 0.411895901f, 0.600000024f,
+    0.3905949f, 0.573560238f, 0.371034294f, 0.547161639f, 0.353519976f, 0.522328854f, 0.479226917f, 0.336764991f,
+    0.457082123f, 0.353962898f, 0.434336901f, 0.375324458f, 0.411895901f, 0.400000006f, 0.3905949f, 0.426439732f,
+    0.371034294f, 0.452838391f, 0.353519976f, 0.477671117f, 0.26838547f, 0.208066583f, 0.283939779f, 0.245712459f,
+    0.297034562f, 0.28807646f, 0.308069885f, 0.333333313f, 0.317411721f, 0.379151225f, 0.325370491f, 0.423227727f,
+    0.332199991f, 0.463822901f, 0.319080353f, 0.49999997f, 0.297700107f, 0.49999997f, 0.27439788f, 0.49999997f,
+    0.25f, 0.49999997f, 0.22560212f, 0.49999997f, 0.202299893f, 0.49999997f, 0.180919677f, 0.49999997f,
+    0.23161456f, 0.208066583f, 0.216060221f, 0.245712459f, 0.202965468f, 0.28807646f, 0.191930145f, 0.333333313f,
+    0.182588279f, 0.379151225f, 0.174629539f, 0.423227727f, 0.167800039f, 0.463822901f, 0.332199991f, 0.536177099f,
+    0.325370491f, 0.576772273f, 0.317411721f, 0.620848775f, 0.308069885f, 0.666666687f, 0.297034562f, 0.71192354f,
+    0.283939779f, 0.754287541f, 0.26838547f, 0.791933417f, 0.167800039f, 0.536177099f, 0.174629539f, 0.576772273f,
+    0.182588279f, 0.620848775f, 0.191930145f, 0.666666687f, 0.202965468f, 0.71192354f, 0.216060221f, 0.754287541f,
+    0.23161456f, 0.791933417f, 0.286153346f, 0.832019269f, 0.328722149f, 0.832167149f, 0.372643769f, 0.821423411f,
+    0.411895901f, 0.799999952f, 0.443483889f, 0.771076798f, 0.467664659f, 0.738767028f, 0.485984474f, 0.706444681f,
+    0.514015555f, 0.706444681f, 0.532335341f, 0.738767028f, 0.556516111f, 0.771076798f, 0.588104129f, 0.799999952f,
+    0.627356231f, 0.821423411f, 0.671277881f, 0.832167149f, 0.713846684f, 0.832019269f, 0.25f, 0.861839354f,
+    0.25f, 0.904599786f, 0.25f, 0.9512043f, 0.5f, 0.999890089f, 0.75f, 0.9512043f,
+    0.75f, 0.904599786f, 0.75f, 0.861839354f, 0.786153316f, 0.832019269f, 0.828722119f, 0.832167149f,
+    0.872643769f, 0.821423411f, 0.911895871f, 0.799999952f, 0.943483829f, 0.771076798f, 0.967664659f, 0.738767028f,
+    0.985984445f, 0.706444681f, 0.213846654f, 0.832019269f, 0.171277881f, 0.832167149f, 0.127356231f, 0.821423411f,
+    0.088104099f, 0.799999952f, 0.0565161407f, 0.771076798f, 0.032335341f, 0.738767028f, 0.0140155554f, 0.706444681f,
+    0.76838541f, 0.791933417f, 0.783939779f, 0.754287541f, 0.797034502f, 0.71192354f, 0.808069825f, 0.666666687f,
+    0.817411721f, 0.620848775f, 0.825370431f, 0.576772273f, 0.832199931f, 0.536177099f, 0.979226887f, 0.663235009f,
+    0.957082152f, 0.646037102f, 0.934336901f, 0.624675512f, 0.911895871f, 0.600000024f, 0.8905949f, 0.573560238f,
+    0.871034265f, 0.547161639f, 0.853519917f, 0.522328854f, 0.73161453f, 0.791933417f, 0.716060221f, 0.754287541f,
+    0.702965438f, 0.71192354f, 0.691930115f, 0.666666687f, 0.682588279f, 0.620848775f, 0.674629509f, 0.576772273f,
+    0.667800009f, 0.536177099f, 1.0f, 0.361839324f, 1.0f, 0.404599756f, 1.0f, 0.451204211f,
+    1.0f, 0.49999997f, 1.0f, 0.54879576f, 1.0f, 0.595400214f, 1.0f, 0.638160706f,
+    0.0207731128f, 0.336764991f, 0.0429178774f, 0.353962898f, 0.0656630993f, 0.375324458f, 0.088104099f, 0.400000006f,
+    0.1094051f, 0.426439732f, 0.128965706f, 0.452838391f, 0.146480054f, 0.477671117f, 0.146480054f, 0.522328854f,
+    0.128965706f, 0.547161639f, 0.1094051f, 0.573560238f, 0.088104099f, 0.600000024f, 0.0656630993f, 0.624675512f,
+    0.0429178774f, 0.646037102f, 0.0207731128f, 0.663235009f, 0.81133163f, 0.461469799f, 0.787996888f, 0.459619403f,
+    0.802395165f, 0.418569982f, 0.762883663f, 0.458588272f, 0.776926994f, 0.415332407f, 0.792046666f, 0.372752964f,
+    0.737116337f, 0.458588272f, 0.75f, 0.414164215f, 0.764312267f, 0.369146526f, 0.780034184f, 0.326331377f,
+    0.712003112f, 0.459619403f, 0.723073006f, 0.415332407f, 0.735687733f, 0.369146526f, 0.75f, 0.323791802f,
+    0.766095996f, 0.281989157f, 0.68866837f, 0.461469799f, 0.697604835f, 0.418569982f, 0.707953334f, 0.372752964f,
+    0.719965756f, 0.326331377f, 0.733903944f, 0.281989157f, 0.75f, 0.242068619f, 0.848413408f, 0.437406331f,
+    0.84239006f, 0.392535776f, 0.867160738f, 0.408701628f, 0.835201859f, 0.344479442f, 0.862501979f, 0.360159665f,
+    0.888439894f, 0.379265815f, 0.826514423f, 0.29552266f, 0.856803298f, 0.309163749f, 0.885804176f, 0.3283948f,
+    0.911895871f, 0.351264656f, 0.815876305f, 0.248337716f, 0.849693775f, 0.258405149f, 0.882508755f, 0.276199579f,
+    0.911895871f, 0.300000012f, 0.936739743f, 0.326868147f, 0.802683115f, 0.205292463f, 0.840617955f, 0.210607886f,
+    0.87827456f, 0.225461364f, 0.911895871f, 0.248735279f, 0.939712882f, 0.277271658f, 0.961837053f, 0.307516456f,
+    1.0f, 0.257931411f, 0.980426669f, 0.219994605f, 0.0195733607f, 0.219994605f, 0.952299893f, 0.1827645f,
+    1.0f, 0.176208228f, 0.0477001071f, 0.1827645f, 0.911895871f, 0.151264697f, 0.967664659f, 0.133773267f,
+    0.032335341f, 0.133773267f, 0.088104099f, 0.151264697f, 0.858259559f, 0.131793588f, 0.911895871f, 0.0999999642f,
+    1.0f, 0.0858358741f, 0.088104099f, 0.0999999642f, 0.141740441f, 0.131793588f, 0.799810886f, 0.128283054f,
+    0.828722119f, 0.0858749449f, 0.911895871f, 0.0487353802f, 0.088104099f, 0.0487353802f, 0.171277881f, 0.0858749449f,
+    0.200189084f, 0.128283054f, 0.700189114f, 0.128283054f, 0.641740441f, 0.131793588f, 0.671277881f, 0.0858749449f,
+    0.588104069f, 0.151264697f, 0.588104129f, 0.0999999642f, 0.588104069f, 0.0487353802f, 0.547700107f, 0.1827645f,
+    0.532335341f, 0.133773267f, 0.5f, 0.0858358741f, 0.411895931f, 0.0487353802f, 0.519573331f, 0.219994605f,
+    0.5f, 0.176208228f, 0.467664659f, 0.133773267f, 0.411895901f, 0.0999999642f, 0.328722149f, 0.0858749449f,
+    0.5f, 0.257931411f, 0.480426639f, 0.219994605f, 0.452299893f, 0.1827645f, 0.411895931f, 0.151264697f,
+    0.358259559f, 0.131793588f, 0.299810916f, 0.128283054f, 0.697316885f, 0.205292463f, 0.684123695f, 0.248337716f,
+    0.659381986f, 0.210607886f, 0.673485577f, 0.29552266f, 0.650306225f, 0.258405149f, 0.62172544f, 0.225461364f,
+    0.664798141f, 0.344479442f, 0.643196702f, 0.309163749f, 0.617491305f, 0.276199579f, 0.588104129f, 0.248735279f,
+    0.65760988f, 0.392535776f, 0.637498021f, 0.360159665f, 0.614195824f, 0.3283948f, 0.588104129f, 0.300000012f,
+    0.560287058f, 0.277271658f, 0.651586592f, 0.437406331f, 0.632839262f, 0.408701628f, 0.611560047f, 0.379265815f,
+    0.588104129f, 0.351264656f, 0.563260257f, 0.326868147f, 0.538162947f, 0.307516456f, 0.520773113f, 0.378280997f,
+    0.542917907f, 0.398742139f, 0.520773113f, 0.424628615f, 0.565663099f, 0.422676682f, 0.542917848f, 0.448057175f,
+    0.520773113f, 0.474450856f, 0.588104129f, 0.448735267f, 0.565663099f, 0.47376585f, 0.542917848f, 0.49999997f,
+    0.520773113f, 0.525549173f, 0.609405041f, 0.475084841f, 0.588104069f, 0.49999997f, 0.565663099f, 0.52623415f,
+    0.542917848f, 0.551942825f, 0.520773113f, 0.575371385f, 0.628965735f, 0.49999997f, 0.609405041f, 0.524915159f,
+    0.588104129f, 0.551264763f, 0.565663099f, 0.577323318f, 0.542917907f, 0.601257861f, 0.520773113f, 0.621719003f,
+    0.479226917f, 0.378280997f, 0.479226917f, 0.424628615f, 0.457082123f, 0.398742139f, 0.479226917f, 0.474450856f,
+    0.457082123f, 0.448057175f, 0.434336901f, 0.422676682f, 0.479226917f, 0.525549173f, 0.457082123f, 0.49999997f,
+    0.434336901f, 0.47376585f, 0.411895901f, 0.448735267f, 0.479226917f, 0.575371385f, 0.457082123f, 0.551942825f,
+    0.434336901f, 0.52623415f, 0.411895931f, 0.49999997f, 0.390594929f, 0.475084841f, 0.479226917f, 0.621719003f,
+    0.457082123f, 0.601257861f, 0.434336901f, 0.577323318f, 0.411895901f, 0.551264763f, 0.390594929f, 0.524915159f,
+    0.371034294f, 0.49999997f, 0.302683145f, 0.205292463f, 0.340617985f, 0.210607886f, 0.315876305f, 0.248337716f,
+    0.37827456f, 0.225461364f, 0.349693775f, 0.258405149f, 0.326514423f, 0.29552266f, 0.411895901f, 0.248735279f,
+    0.382508695f, 0.276199579f, 0.356803268f, 0.309163749f, 0.335201859f, 0.344479442f, 0.439712912f, 0.277271658f,
+    0.411895901f, 0.300000012f, 0.385804206f, 0.3283948f, 0.362501949f, 0.360159665f, 0.34239012f, 0.392535776f,
+    0.461837053f, 0.307516456f, 0.436739743f, 0.326868147f, 0.411895901f, 0.351264656f, 0.388439953f, 0.379265815f,
+    0.367160738f, 0.408701628f, 0.348413408f, 0.437406331f, 0.25f, 0.242068619f, 0.266096056f, 0.281989157f,
+    0.233903974f, 0.281989157f, 0.280034244f, 0.326331377f, 0.25f, 0.323791802f, 0.219965786f, 0.326331377f,
+    0.292046666f, 0.372752964f, 0.264312267f, 0.369146526f, 0.235687733f, 0.369146526f, 0.207953334f, 0.372752964f,
+    0.302395165f, 0.418569982f, 0.276927024f, 0.415332407f, 0.25f, 0.414164215f, 0.223072976f, 0.415332407f,
+    0.197604835f, 0.418569982f, 0.31133163f, 0.461469799f, 0.287996888f, 0.459619403f, 0.262883663f, 0.458588272f,
+    0.237116337f, 0.458588272f, 0.212003112f, 0.459619403f, 0.1886684f, 0.461469799f, 0.1886684f, 0.538530171f,
+    0.212003112f, 0.540380597f, 0.197604835f, 0.581430018f, 0.237116337f, 0.541411757f, 0.223072976f, 0.584667563f,
+    0.207953334f, 0.627247036f, 0.262883663f, 0.541411757f, 0.25f, 0.585835755f, 0.235687733f, 0.630853474f,
+    0.219965786f, 0.673668623f, 0.287996888f, 0.540380597f, 0.276927024f, 0.584667563f, 0.264312267f, 0.630853474f,
+    0.25f, 0.676208198f, 0.233903974f, 0.718010843f, 0.31133163f, 0.538530171f, 0.302395165f, 0.581430018f,
+    0.292046666f, 0.627247036f, 0.280034244f, 0.673668623f, 0.266096056f, 0.718010843f, 0.25f, 0.757931352f,
+    0.302683145f, 0.794707537f, 0.315876305f, 0.751662254f, 0.340617985f, 0.789392114f, 0.326514423f, 0.70447731f,
+    0.349693775f, 0.741594851f, 0.37827456f, 0.774538636f, 0.335201859f, 0.655520558f, 0.356803268f, 0.690836251f,
+    0.382508695f, 0.723800421f, 0.411895901f, 0.751264691f, 0.34239012f, 0.607464194f, 0.362501949f, 0.639840364f,
+    0.385804206f, 0.671605229f, 0.411895901f, 0.699999988f, 0.439712912f, 0.722728372f, 0.348413408f, 0.562593699f,
+    0.367160738f, 0.591298401f, 0.388439953f, 0.620734155f, 0.411895901f, 0.648735344f, 0.436739743f, 0.673131824f,
+    0.461837053f, 0.692483544f, 0.299810916f, 0.871716976f, 0.358259559f, 0.868206382f, 0.328722149f, 0.914125085f,
+    0.411895931f, 0.848735332f, 0.411895901f, 0.900000036f, 0.411895931f, 0.95126462f, 0.452299893f, 0.81723547f,
+    0.467664659f, 0.866226733f, 0.5f, 0.914164126f, 0.588104069f, 0.95126462f, 0.480426639f, 0.780005395f,
+    0.5f, 0.823791742f, 0.532335341f, 0.866226733f, 0.588104129f, 0.900000036f, 0.671277881f, 0.914125085f,
+    0.5f, 0.742068589f, 0.519573331f, 0.780005395f, 0.547700107f, 0.81723547f, 0.588104069f, 0.848735332f,
+    0.641740441f, 0.868206382f, 0.700189114f, 0.871716976f, 0.200189084f, 0.871716976f, 0.171277881f, 0.914125085f,
+    0.141740441f, 0.868206382f, 0.088104099f, 0.95126462f, 0.088104099f, 0.900000036f, 0.088104099f, 0.848735332f,
+    0.911895871f, 0.95126462f, 1.0f, 0.914164126f, 0.032335341f, 0.866226733f, 0.0477001071f, 0.81723547f,
+    0.828722119f, 0.914125085f, 0.911895871f, 0.900000036f, 0.967664659f, 0.866226733f, 1.0f, 0.823791742f,
+    0.0195733607f, 0.780005395f, 0.799810886f, 0.871716976f, 0.858259559f, 0.868206382f, 0.911895871f, 0.848735332f,
+    0.952299893f, 0.81723547f, 0.980426669f, 0.780005395f, 1.0f, 0.742068589f, 0.961837053f, 0.692483544f,
+    0.939712882f, 0.722728372f, 0.936739743f, 0.673131824f, 0.911895871f, 0.751264691f, 0.911895871f, 0.699999988f,
+    0.911895871f, 0.648735344f, 0.87827456f, 0.774538636f, 0.882508755f, 0.723800421f, 0.885804176f, 0.671605229f,
+    0.888439894f, 0.620734155f, 0.840617955f, 0.789392114f, 0.849693775f, 0.741594851f, 0.856803298f, 0.690836251f,
+    0.862501979f, 0.639840364f, 0.867160738f, 0.591298401f, 0.802683115f, 0.794707537f, 0.815876305f, 0.751662254f,
+    0.826514423f, 0.70447731f, 0.835201859f, 0.655520558f, 0.84239006f, 0.607464194f, 0.848413408f, 0.562593699f,
+    0.81133163f, 0.538530171f, 0.802395165f, 0.581430018f, 0.787996888f, 0.540380597f, 0.792046666f, 0.627247036f,
+    0.776926994f, 0.584667563f, 0.762883663f, 0.541411757f, 0.780034184f, 0.673668623f, 0.764312267f, 0.630853474f,
+    0.75f, 0.585835755f, 0.737116337f, 0.541411757f, 0.766095996f, 0.718010843f, 0.75f, 0.676208198f,
+    0.735687733f, 0.630853474f, 0.723073006f, 0.584667563f, 0.712003112f, 0.540380597f, 0.75f, 0.757931352f,
+    0.733903944f, 0.718010843f, 0.719965756f, 0.673668623f, 0.707953334f, 0.627247036f, 0.697604835f, 0.581430018f,
+    0.68866837f, 0.538530171f, 0.697316885f, 0.794707537f, 0.659381986f, 0.789392114f, 0.684123695f, 0.751662254f,
+    0.62172544f, 0.774538636f, 0.650306225f, 0.741594851f, 0.673485577f, 0.70447731f, 0.588104129f, 0.751264691f,
+    0.617491305f, 0.723800421f, 0.643196702f, 0.690836251f, 0.664798141f, 0.655520558f, 0.560287058f, 0.722728372f,
+    0.588104129f, 0.699999988f, 0.614195824f, 0.671605229f, 0.637498021f, 0.639840364f, 0.65760988f, 0.607464194f,
+    0.538162947f, 0.692483544f, 0.563260257f, 0.673131824f, 0.588104129f, 0.648735344f, 0.611560047f, 0.620734155f,
+    0.632839262f, 0.591298401f, 0.651586592f, 0.562593699f, 0.979226887f, 0.378280997f, 0.979226887f, 0.424628615f,
+    0.957082152f, 0.398742139f, 0.979226887f, 0.474450856f, 0.957082152f, 0.448057175f, 0.934336901f, 0.422676682f,
+    0.979226887f, 0.525549173f, 0.957082152f, 0.49999997f, 0.934336901f, 0.47376585f, 0.911895871f, 0.448735267f,
+    0.979226887f, 0.575371385f, 0.957082152f, 0.551942825f, 0.934336901f, 0.52623415f, 0.911895871f, 0.49999997f,
+    0.8905949f, 0.475084841f, 0.979226887f, 0.621719003f, 0.957082152f, 0.601257861f, 0.934336901f, 0.577323318f,
+    0.911895871f, 0.551264763f, 0.8905949f, 0.524915159f, 0.871034265f, 0.49999997f, 0.0207731128f, 0.378280997f,
+    0.0429178774f, 0.398742139f, 0.0207731128f, 0.424628615f, 0.0656630993f, 0.422676682f, 0.0429178774f, 0.448057175f,
+    0.0207731128f, 0.474450856f, 0.088104099f, 0.448735267f, 0.0656630993f, 0.47376585f, 0.0429178774f, 0.49999997f,
+    0.0207731128f, 0.525549173f, 0.1094051f, 0.475084841f, 0.088104099f, 0.49999997f, 0.0656630993f, 0.52623415f,
+    0.0429178774f, 0.551942825f, 0.0207731128f, 0.575371385f, 0.128965706f, 0.49999997f, 0.1094051f, 0.524915159f,
+    0.088104099f, 0.551264763f, 0.0656630993f, 0.577323318f, 0.0429178774f, 0.601257861f, 0.0207731128f, 0.621719003f,
+    0.0381629169f, 0.307516456f, 0.0602870882f, 0.277271658f, 0.0632602572f, 0.326868147f, 0.088104099f, 0.248735279f,
+    0.088104099f, 0.300000012f, 0.088104099f, 0.351264656f, 0.12172547f, 0.225461364f, 0.117491275f, 0.276199579f,
+    0.114195794f, 0.3283948f, 0.111560076f, 0.379265815f, 0.159382045f, 0.210607886f, 0.150306255f, 0.258405149f,
+    0.143196732f, 0.309163749f, 0.137498051f, 0.360159665f, 0.132839262f, 0.408701628f, 0.197316855f, 0.205292463f,
+    0.184123695f, 0.248337716f, 0.173485577f, 0.29552266f, 0.16479817f, 0.344479442f, 0.15760991f, 0.392535776f,
+    0.151586592f, 0.437406331f, 0.197316855f, 0.794707537f, 0.159382045f, 0.789392114f, 0.184123695f, 0.751662254f,
+    0.12172547f, 0.774538636f, 0.150306255f, 0.741594851f, 0.173485577f, 0.70447731f, 0.088104099f, 0.751264691f,
+    0.117491275f, 0.723800421f, 0.143196732f, 0.690836251f, 0.16479817f, 0.655520558f, 0.0602870882f, 0.722728372f,
+    0.088104099f, 0.699999988f, 0.114195794f, 0.671605229f, 0.137498051f, 0.639840364f, 0.15760991f, 0.607464194f,
+    0.0381629169f, 0.692483544f, 0.0632602572f, 0.673131824f, 0.088104099f, 0.648735344f, 0.111560076f, 0.620734155f,
+    0.132839262f, 0.591298401f, 0.151586592f, 0.562593699f, 1.01401556f, 0.293555319f, 1.03233528f, 0.261232972f,
+    1.01957333f, 0.219994605f, 1.04770017f, 0.1827645f, 1.03233528f, 0.133773267f, 1.08810413f, 0.0999999642f,
+    1.08810413f, 0.0487353802f, 1.08810413f, 0.95126462f, 1.08810413f, 0.900000036f, 1.03233528f, 0.866226733f,
+    1.04770017f, 0.81723547f, 1.01957333f, 0.780005395f, 1.03233528f, 0.738767028f, 1.01401556f, 0.706444681f,
+    1.02077317f, 0.336764991f, 1.02077317f, 0.378280997f, 1.02077317f, 0.424628615f, 1.02077317f, 0.474450856f,
+    1.02077317f, 0.525549173f, 1.02077317f, 0.575371385f, 1.02077317f, 0.621719003f, 1.02077317f, 0.663235009f,
+    0.830947936f, 0.000109910965f, 1.0f, 0.000109910965f, 0.16905205f, 0.000109910965f, 0.669052005f, 0.000109910965f,
+    0.5f, 0.000109910965f, 0.330947965f, 0.000109910965f, 0.330947965f, 0.999890089f, 0.5f, 0.999890089f,
+    0.669052005f, 0.999890089f, 0.16905205f, 0.999890089f, 0.830947936f, 0.999890089f, 1.0f, 0.999890089f
+};
+const uint16_t STATIC_ICOSPHERE_3_WELDED_INDICES[] =
+{
+    0, 12, 26, 12, 13, 222, 12, 222,
+    26, 26, 222, 27, 13, 14, 223, 13,
+    223, 222, 222, 223, 224, 222, 224, 27,
+    27, 224, 28, 14, 15, 225, 14, 225,
+    223, 223, 225, 226, 223, 226, 224, 224,
+    226, 227, 224, 227, 28, 28, 227, 29,
+    15, 16, 228, 15, 228, 225, 225, 228,
+    229, 225, 229, 226, 226, 229, 230, 226,
+    230, 227, 227, 230, 231, 227, 231, 29,
+    29, 231, 30, 16, 17, 232, 16, 232,
+    228, 228, 232, 233, 228, 233, 229, 229,
+    233, 234, 229, 234, 230, 230, 234, 235,
+    230, 235, 231, 231, 235, 236, 231, 236,
+    30, 30, 236, 31, 17, 18, 237, 17,
+    237, 232, 232, 237, 238, 232, 238, 233,
+    233, 238, 239, 233, 239, 234, 234, 239,
+    240, 234, 240, 235, 235, 240, 241, 235,
+    241, 236, 236, 241, 242, 236, 242, 31,
+    31, 242, 32, 18, 1, 19, 18, 19,
+    237, 237, 19, 20, 237, 20, 238, 238,
+    20, 21, 238, 21, 239, 239, 21, 22,
+    239, 22, 240, 240, 22, 23, 240, 23,
+    241, 241, 23, 24, 241, 24, 242, 242,
+    24, 25, 242, 25, 32, 32, 25, 4,
+    0, 26, 40, 26, 27, 243, 26, 243,
+    40, 40, 243, 41, 27, 28, 244, 27,
+    244, 243, 243, 244, 245, 243, 245, 41,
+    41, 245, 42, 28, 29, 246, 28, 246,
+    244, 244, 246, 247, 244, 247, 245, 245,
+    247, 248, 245, 248, 42, 42, 248, 43,
+    29, 30, 249, 29, 249, 246, 246, 249,
+    250, 246, 250, 247, 247, 250, 251, 247,
+    251, 248, 248, 251, 252, 248, 252, 43,
+    43, 252, 44, 30, 31, 253, 30, 253,
+    249, 249, 253, 254, 249, 254, 250, 250,
+    254, 255, 250, 255, 251, 251, 255, 256,
+    251, 256, 252, 252, 256, 257, 252, 257,
+    44, 44, 257, 45, 31, 32, 258, 31,
+    258, 253, 253, 258, 259, 253, 259, 254,
+    254, 259, 260, 254, 260, 255, 255, 260,
+    261, 255, 261, 256, 256, 261, 262, 256,
+    262, 257, 257, 262, 263, 257, 263, 45,
+    45, 263, 46, 32, 4, 33, 32, 33,
+    258, 258, 33, 34, 258, 34, 259, 259,
+    34, 35, 259, 35, 260, 260, 35, 36,
+    260, 36, 261, 261, 36, 37, 261, 37,
+    262, 262, 37, 38, 262, 38, 263, 263,
+    38, 39, 263, 39, 46, 46, 39, 9,
+    9, 39, 54, 39, 38, 264, 39, 264,
+    54, 54, 264, 55, 38, 37, 265, 38,
+    265, 264, 264, 265, 266, 264, 266, 55,
+    55, 266, 56, 37, 36, 267, 37, 267,
+    265, 265, 267, 268, 265, 268, 266, 266,
+    268, 269, 266, 269, 56, 56, 269, 57,
+    36, 35, 270, 36, 270, 267, 267, 270,
+    271, 267, 271, 268, 268, 271, 272, 268,
+    272, 269, 269, 272, 273, 269, 273, 57,
+    57, 273, 58, 35, 34, 274, 35, 274,
+    270, 270, 274, 275, 270, 275, 271, 271,
+    275, 276, 271, 276, 272, 272, 276, 277,
+    272, 277, 273, 273, 277, 278, 273, 278,
+    58, 58, 278, 59, 34, 33, 279, 34,
+    279, 274, 274, 279, 280, 274, 280, 275,
+    275, 280, 281, 275, 281, 276, 276, 281,
+    282, 276, 282, 277, 277, 282, 283, 277,
+    283, 278, 278, 283, 284, 278, 284, 59,
+    59, 284, 60, 33, 4, 47, 33, 47,
+    279, 279, 47, 48, 279, 48, 280, 280,
+    48, 49, 280, 49, 281, 281, 49, 50,
+    281, 50, 282, 282, 50, 51, 282, 51,
+    283, 283, 51, 52, 283, 52, 284, 284,
+    52, 53, 284, 53, 60, 60, 53, 5,
+    4, 61, 47, 61, 62, 285, 61, 285,
+    47, 47, 285, 48, 62, 63, 286, 62,
+    286, 285, 285, 286, 287, 285, 287, 48,
+    48, 287, 49, 63, 64, 288, 63, 288,
+    286, 286, 288, 289, 286, 289, 287, 287,
+    289, 290, 287, 290, 49, 49, 290, 50,
+    64, 65, 291, 64, 291, 288, 288, 291,
+    292, 288, 292, 289, 289, 292, 293, 289,
+    293, 290, 290, 293, 294, 290, 294, 50,
+    50, 294, 51, 65, 66, 295, 65, 295,
+    291, 291, 295, 296, 291, 296, 292, 292,
+    296, 297, 292, 297, 293, 293, 297, 298,
+    293, 298, 294, 294, 298, 299, 294, 299,
+    51, 51, 299, 52, 66, 67, 300, 66,
+    300, 295, 295, 300, 301, 295, 301, 296,
+    296, 301, 302, 296, 302, 297, 297, 302,
+    303, 297, 303, 298, 298, 303, 304, 298,
+    304, 299, 299, 304, 305, 299, 305, 52,
+    52, 305, 53, 67, 8, 68, 67, 68,
+    300, 300, 68, 69, 300, 69, 301, 301,
+    69, 70, 301, 70, 302, 302, 70, 71,
+    302, 71, 303, 303, 71, 72, 303, 72,
+    304, 304, 72, 73, 304, 73, 305, 305,
+    73, 74, 305, 74, 53, 53, 74, 5,
+    4, 25, 61, 25, 24, 306, 25, 306,
+    61, 61, 306, 62, 24, 23, 307, 24,
+    307, 306, 306, 307, 308, 306, 308, 62,
+    62, 308, 63, 23, 22, 309, 23, 309,
+    307, 307, 309, 310, 307, 310, 308, 308,
+    310, 311, 308, 311, 63, 63, 311, 64,
+    22, 21, 312, 22, 312, 309, 309, 312,
+    313, 309, 313, 310, 310, 313, 314, 310,
+    314, 311, 311, 314, 315, 311, 315, 64,
+    64, 315, 65, 21, 20, 316, 21, 316,
+    312, 312, 316, 317, 312, 317, 313, 313,
+    317, 318, 313, 318, 314, 314, 318, 319,
+    314, 319, 315, 315, 319, 320, 315, 320,
+    65, 65, 320, 66, 20, 19, 321, 20,
+    321, 316, 316, 321, 322, 316, 322, 317,
+    317, 322, 323, 317, 323, 318, 318, 323,
+    324, 318, 324, 319, 319, 324, 325, 319,
+    325, 320, 320, 325, 326, 320, 326, 66,
+    66, 326, 67, 19, 1, 75, 19, 75,
+    321, 321, 75, 76, 321, 76, 322, 322,
+    76, 77, 322, 77, 323, 323, 77, 78,
+    323, 78, 324, 324, 78, 79, 324, 79,
+    325, 325, 79, 80, 325, 80, 326, 326,
+    80, 81, 326, 81, 67, 67, 81, 8,
+    8, 81, 89, 81, 80, 327, 81, 327,
+    89, 89, 327, 90, 80, 79, 328, 80,
+    328, 327, 327, 328, 329, 327, 329, 90,
+    90, 329, 91, 79, 78, 330, 79, 330,
+    328, 328, 330, 331, 328, 331, 329, 329,
+    331, 332, 329, 332, 91, 91, 332, 92,
+    78, 77, 333, 78, 333, 330, 330, 333,
+    334, 330, 334, 331, 331, 334, 335, 331,
+    335, 332, 332, 335, 336, 332, 336, 92,
+    92, 336, 93, 77, 76, 337, 77, 337,
+    333, 333, 337, 338, 333, 338, 334, 334,
+    338, 339, 334, 339, 335, 335, 339, 340,
+    335, 340, 336, 336, 340, 341, 336, 341,
+    93, 93, 341, 94, 76, 75, 342, 76,
+    342, 337, 337, 342, 343, 337, 343, 338,
+    338, 343, 344, 338, 344, 339, 339, 344,
+    345, 339, 345, 340, 340, 345, 346, 340,
+    346, 341, 341, 346, 347, 341, 347, 94,
+    94, 347, 95, 75, 1, 82, 75, 82,
+    342, 342, 82, 83, 342, 83, 343, 343,
+    83, 84, 343, 84, 344, 344, 84, 85,
+    344, 85, 345, 345, 85, 86, 345, 86,
+    346, 346, 86, 87, 346, 87, 347, 347,
+    87, 88, 347, 88, 95, 95, 88, 10,
+    8, 89, 103, 89, 90, 348, 89, 348,
+    103, 103, 348, 104, 90, 91, 349, 90,
+    349, 348, 348, 349, 350, 348, 350, 104,
+    104, 350, 105, 91, 92, 351, 91, 351,
+    349, 349, 351, 352, 349, 352, 350, 350,
+    352, 353, 350, 353, 105, 105, 353, 106,
+    92, 93, 354, 92, 354, 351, 351, 354,
+    355, 351, 355, 352, 352, 355, 356, 352,
+    356, 353, 353, 356, 357, 353, 357, 106,
+    106, 357, 107, 93, 94, 358, 93, 358,
+    354, 354, 358, 359, 354, 359, 355, 355,
+    359, 360, 355, 360, 356, 356, 360, 361,
+    356, 361, 357, 357, 361, 362, 357, 362,
+    107, 107, 362, 108, 94, 95, 363, 94,
+    363, 358, 358, 363, 364, 358, 364, 359,
+    359, 364, 365, 359, 365, 360, 360, 365,
+    366, 360, 366, 361, 361, 366, 367, 361,
+    367, 362, 362, 367, 368, 362, 368, 108,
+    108, 368, 109, 95, 10, 96, 95, 96,
+    363, 363, 96, 97, 363, 97, 364, 364,
+    97, 98, 364, 98, 365, 365, 98, 99,
+    365, 99, 366, 366, 99, 100, 366, 100,
+    367, 367, 100, 101, 367, 101, 368, 368,
+    101, 102, 368, 102, 109, 109, 102, 3,
+    5, 74, 110, 74, 73, 369, 74, 369,
+    110, 110, 369, 111, 73, 72, 370, 73,
+    370, 369, 369, 370, 371, 369, 371, 111,
+    111, 371, 112, 72, 71, 372, 72, 372,
+    370, 370, 372, 373, 370, 373, 371, 371,
+    373, 374, 371, 374, 112, 112, 374, 113,
+    71, 70, 375, 71, 375, 372, 372, 375,
+    376, 372, 376, 373, 373, 376, 377, 373,
+    377, 374, 374, 377, 378, 374, 378, 113,
+    113, 378, 114, 70, 69, 379, 70, 379,
+    375, 375, 379, 380, 375, 380, 376, 376,
+    380, 381, 376, 381, 377, 377, 381, 382,
+    377, 382, 378, 378, 382, 383, 378, 383,
+    114, 114, 383, 115, 69, 68, 384, 69,
+    384, 379, 379, 384, 385, 379, 385, 380,
+    380, 385, 386, 380, 386, 381, 381, 386,
+    387, 381, 387, 382, 382, 387, 388, 382,
+    388, 383, 383, 388, 389, 383, 389, 115,
+    115, 389, 116, 68, 8, 103, 68, 103,
+    384, 384, 103, 104, 384, 104, 385, 385,
+    104, 105, 385, 105, 386, 386, 105, 106,
+    386, 106, 387, 387, 106, 107, 387, 107,
+    388, 388, 107, 108, 388, 108, 389, 389,
+    108, 109, 389, 109, 116, 116, 109, 3,
+    5, 110, 124, 110, 111, 390, 110, 390,
+    124, 124, 390, 125, 111, 112, 391, 111,
+    391, 390, 390, 391, 392, 390, 392, 125,
+    125, 392, 126, 112, 113, 393, 112, 393,
+    391, 391, 393, 394, 391, 394, 392, 392,
+    394, 395, 392, 395, 126, 126, 395, 127,
+    113, 114, 396, 113, 396, 393, 393, 396,
+    397, 393, 397, 394, 394, 397, 398, 394,
+    398, 395, 395, 398, 399, 395, 399, 127,
+    127, 399, 128, 114, 115, 400, 114, 400,
+    396, 396, 400, 401, 396, 401, 397, 397,
+    401, 402, 397, 402, 398, 398, 402, 403,
+    398, 403, 399, 399, 403, 404, 399, 404,
+    128, 128, 404, 129, 115, 116, 405, 115,
+    405, 400, 400, 405, 406, 400, 406, 401,
+    401, 406, 407, 401, 407, 402, 402, 407,
+    408, 402, 408, 403, 403, 408, 409, 403,
+    409, 404, 404, 409, 410, 404, 410, 129,
+    129, 410, 130, 116, 3, 117, 116, 117,
+    405, 405, 117, 118, 405, 118, 406, 406,
+    118, 119, 406, 119, 407, 407, 119, 120,
+    407, 120, 408, 408, 120, 121, 408, 121,
+    409, 409, 121, 122, 409, 122, 410, 410,
+    122, 123, 410, 123, 130, 130, 123, 2,
+    2, 123, 138, 123, 122, 411, 123, 411,
+    138, 138, 411, 139, 122, 121, 412, 122,
+    412, 411, 411, 412, 413, 411, 413, 139,
+    139, 413, 140, 121, 120, 414, 121, 414,
+    412, 412, 414, 415, 412, 415, 413, 413,
+    415, 416, 413, 416, 140, 140, 416, 141,
+    120, 119, 417, 120, 417, 414, 414, 417,
+    418, 414, 418, 415, 415, 418, 419, 415,
+    419, 416, 416, 419, 420, 416, 420, 141,
+    141, 420, 142, 119, 118, 421, 119, 421,
+    417, 417, 421, 422, 417, 422, 418, 418,
+    422, 423, 418, 423, 419, 419, 423, 424,
+    419, 424, 420, 420, 424, 425, 420, 425,
+    142, 142, 425, 143, 118, 117, 426, 118,
+    426, 421, 421, 426, 427, 421, 427, 422,
+    422, 427, 428, 422, 428, 423, 423, 428,
+    429, 423, 429, 424, 424, 429, 430, 424,
+    430, 425, 425, 430, 431, 425, 431, 143,
+    143, 431, 144, 117, 3, 131, 117, 131,
+    426, 426, 131, 132, 426, 132, 427, 427,
+    132, 133, 427, 133, 428, 428, 133, 134,
+    428, 134, 429, 429, 134, 135, 429, 135,
+    430, 430, 135, 136, 430, 136, 431, 431,
+    136, 137, 431, 137, 144, 144, 137, 7,
+    7, 137, 145, 137, 136, 432, 137, 432,
+    145, 145, 432, 146, 136, 135, 433, 136,
+    433, 432, 432, 433, 434, 432, 434, 146,
+    146, 434, 147, 135, 134, 435, 135, 435,
+    433, 433, 435, 436, 433, 436, 434, 434,
+    436, 437, 434, 437, 147, 147, 437, 148,
+    134, 133, 438, 134, 438, 435, 435, 438,
+    439, 435, 439, 436, 436, 439, 440, 436,
+    440, 437, 437, 440, 441, 437, 441, 148,
+    148, 441, 149, 133, 132, 442, 133, 442,
+    438, 438, 442, 443, 438, 443, 439, 439,
+    443, 444, 439, 444, 440, 440, 444, 445,
+    440, 445, 441, 441, 445, 446, 441, 446,
+    149, 149, 446, 150, 132, 131, 447, 132,
+    447, 442, 442, 447, 448, 442, 448, 443,
+    443, 448, 449, 443, 449, 444, 444, 449,
+    450, 444, 450, 445, 445, 450, 451, 445,
+    451, 446, 446, 451, 452, 446, 452, 150,
+    150, 452, 151, 131, 3, 102, 131, 102,
+    447, 447, 102, 101, 447, 101, 448, 448,
+    101, 100, 448, 100, 449, 449, 100, 99,
+    449, 99, 450, 450, 99, 98, 450, 98,
+    451, 451, 98, 97, 451, 97, 452, 452,
+    97, 96, 452, 96, 151, 151, 96, 10,
+    7, 145, 159, 145, 146, 453, 145, 453,
+    159, 159, 453, 160, 146, 147, 454, 146,
+    454, 453, 453, 454, 455, 453, 455, 160,
+    160, 455, 161, 147, 148, 456, 147, 456,
+    454, 454, 456, 457, 454, 457, 455, 455,
+    457, 458, 455, 458, 161, 161, 458, 162,
+    148, 149, 459, 148, 459, 456, 456, 459,
+    460, 456, 460, 457, 457, 460, 461, 457,
+    461, 458, 458, 461, 462, 458, 462, 162,
+    162, 462, 163, 149, 150, 463, 149, 463,
+    459, 459, 463, 464, 459, 464, 460, 460,
+    464, 465, 460, 465, 461, 461, 465, 466,
+    461, 466, 462, 462, 466, 467, 462, 467,
+    163, 163, 467, 164, 150, 151, 468, 150,
+    468, 463, 463, 468, 469, 463, 469, 464,
+    464, 469, 470, 464, 470, 465, 465, 470,
+    471, 465, 471, 466, 466, 471, 472, 466,
+    472, 467, 467, 472, 473, 467, 473, 164,
+    164, 473, 165, 151, 10, 152, 151, 152,
+    468, 468, 152, 153, 468, 153, 469, 469,
+    153, 154, 469, 154, 470, 470, 154, 155,
+    470, 155, 471, 471, 155, 156, 471, 156,
+    472, 472, 156, 157, 472, 157, 473, 473,
+    157, 158, 473, 158, 165, 165, 158, 6,
+    7, 159, 173, 159, 160, 474, 159, 474,
+    173, 173, 474, 174, 160, 161, 475, 160,
+    475, 474, 474, 475, 476, 474, 476, 174,
+    174, 476, 175, 161, 162, 477, 161, 477,
+    475, 475, 477, 478, 475, 478, 476, 476,
+    478, 479, 476, 479, 175, 175, 479, 176,
+    162, 163, 480, 162, 480, 477, 477, 480,
+    481, 477, 481, 478, 478, 481, 482, 478,
+    482, 479, 479, 482, 483, 479, 483, 176,
+    176, 483, 177, 163, 164, 484, 163, 484,
+    480, 480, 484, 485, 480, 485, 481, 481,
+    485, 486, 481, 486, 482, 482, 486, 487,
+    482, 487, 483, 483, 487, 488, 483, 488,
+    177, 177, 488, 178, 164, 165, 489, 164,
+    489, 484, 484, 489, 490, 484, 490, 485,
+    485, 490, 491, 485, 491, 486, 486, 491,
+    492, 486, 492, 487, 487, 492, 493, 487,
+    493, 488, 488, 493, 494, 488, 494, 178,
+    178, 494, 179, 165, 6, 166, 165, 166,
+    489, 489, 166, 167, 489, 167, 490, 490,
+    167, 168, 490, 168, 491, 491, 168, 169,
+    491, 169, 492, 492, 169, 170, 492, 170,
+    493, 493, 170, 171, 493, 171, 494, 494,
+    171, 172, 494, 172, 179, 179, 172, 11,
+    11, 172, 187, 172, 171, 495, 172, 495,
+    187, 187, 495, 188, 171, 170, 496, 171,
+    496, 495, 495, 496, 497, 495, 497, 188,
+    188, 497, 189, 170, 169, 498, 170, 498,
+    496, 496, 498, 499, 496, 499, 497, 497,
+    499, 500, 497, 500, 189, 189, 500, 190,
+    169, 168, 501, 169, 501, 498, 498, 501,
+    502, 498, 502, 499, 499, 502, 503, 499,
+    503, 500, 500, 503, 504, 500, 504, 190,
+    190, 504, 191, 168, 167, 505, 168, 505,
+    501, 501, 505, 506, 501, 506, 502, 502,
+    506, 507, 502, 507, 503, 503, 507, 508,
+    503, 508, 504, 504, 508, 509, 504, 509,
+    191, 191, 509, 192, 167, 166, 510, 167,
+    510, 505, 505, 510, 511, 505, 511, 506,
+    506, 511, 512, 506, 512, 507, 507, 512,
+    513, 507, 513, 508, 508, 513, 514, 508,
+    514, 509, 509, 514, 515, 509, 515, 192,
+    192, 515, 193, 166, 6, 180, 166, 180,
+    510, 510, 180, 181, 510, 181, 511, 511,
+    181, 182, 511, 182, 512, 512, 182, 183,
+    512, 183, 513, 513, 183, 184, 513, 184,
+    514, 514, 184, 185, 514, 185, 515, 515,
+    185, 186, 515, 186, 193, 193, 186, 0,
+    0, 186, 12, 186, 185, 516, 186, 516,
+    12, 12, 516, 13, 185, 184, 517, 185,
+    517, 516, 516, 517, 518, 516, 518, 13,
+    13, 518, 14, 184, 183, 519, 184, 519,
+    517, 517, 519, 520, 517, 520, 518, 518,
+    520, 521, 518, 521, 14, 14, 521, 15,
+    183, 182, 522, 183, 522, 519, 519, 522,
+    523, 519, 523, 520, 520, 523, 524, 520,
+    524, 521, 521, 524, 525, 521, 525, 15,
+    15, 525, 16, 182, 181, 526, 182, 526,
+    522, 522, 526, 527, 522, 527, 523, 523,
+    527, 528, 523, 528, 524, 524, 528, 529,
+    524, 529, 525, 525, 529, 530, 525, 530,
+    16, 16, 530, 17, 181, 180, 531, 181,
+    531, 526, 526, 531, 532, 526, 532, 527,
+    527, 532, 533, 527, 533, 528, 528, 533,
+    534, 528, 534, 529, 529, 534, 535, 529,
+    535, 530, 530, 535, 536, 530, 536, 17,
+    17, 536, 18, 180, 6, 194, 180, 194,
+    531, 531, 194, 195, 531, 195, 532, 532,
+    195, 196, 532, 196, 533, 533, 196, 197,
+    533, 197, 534, 534, 197, 198, 534, 198,
+    535, 535, 198, 199, 535, 199, 536, 536,
+    199, 200, 536, 200, 18, 18, 200, 1,
+    6, 158, 194, 158, 157, 537, 158, 537,
+    194, 194, 537, 195, 157, 156, 538, 157,
+    538, 537, 537, 538, 539, 537, 539, 195,
+    195, 539, 196, 156, 155, 540, 156, 540,
+    538, 538, 540, 541, 538, 541, 539, 539,
+    541, 542, 539, 542, 196, 196, 542, 197,
+    155, 154, 543, 155, 543, 540, 540, 543,
+    544, 540, 544, 541, 541, 544, 545, 541,
+    545, 542, 542, 545, 546, 542, 546, 197,
+    197, 546, 198, 154, 153, 547, 154, 547,
+    543, 543, 547, 548, 543, 548, 544, 544,
+    548, 549, 544, 549, 545, 545, 549, 550,
+    545, 550, 546, 546, 550, 551, 546, 551,
+    198, 198, 551, 199, 153, 152, 552, 153,
+    552, 547, 547, 552, 553, 547, 553, 548,
+    548, 553, 554, 548, 554, 549, 549, 554,
+    555, 549, 555, 550, 550, 555, 556, 550,
+    556, 551, 551, 556, 557, 551, 557, 199,
+    199, 557, 200, 152, 10, 88, 152, 88,
+    552, 552, 88, 87, 552, 87, 553, 553,
+    87, 86, 553, 86, 554, 554, 86, 85,
+    554, 85, 555, 555, 85, 84, 555, 84,
+    556, 556, 84, 83, 556, 83, 557, 557,
+    83, 82, 557, 82, 200, 200, 82, 1,
+    9, 201, 46, 201, 202, 558, 201, 558,
+    46, 46, 558, 45, 202, 203, 559, 202,
+    559, 558, 558, 559, 560, 558, 560, 45,
+    45, 560, 44, 203, 204, 561, 203, 561,
+    559, 559, 561, 562, 559, 562, 560, 560,
+    562, 563, 560, 563, 44, 44, 563, 43,
+    204, 205, 564, 204, 564, 561, 561, 564,
+    565, 561, 565, 562, 562, 565, 566, 562,
+    566, 563, 563, 566, 567, 563, 567, 43,
+    43, 567, 42, 205, 206, 568, 205, 568,
+    564, 564, 568, 569, 564, 569, 565, 565,
+    569, 570, 565, 570, 566, 566, 570, 571,
+    566, 571, 567, 567, 571, 572, 567, 572,
+    42, 42, 572, 41, 206, 207, 573, 206,
+    573, 568, 568, 573, 574, 568, 574, 569,
+    569, 574, 575, 569, 575, 570, 570, 575,
+    576, 570, 576, 571, 571, 576, 577, 571,
+    577, 572, 572, 577, 578, 572, 578, 41,
+    41, 578, 40, 207, 11, 187, 207, 187,
+    573, 573, 187, 188, 573, 188, 574, 574,
+    188, 189, 574, 189, 575, 575, 189, 190,
+    575, 190, 576, 576, 190, 191, 576, 191,
+    577, 577, 191, 192, 577, 192, 578, 578,
+    192, 193, 578, 193, 40, 40, 193, 0,
+    9, 208, 201, 208, 209, 579, 208, 579,
+    201, 201, 579, 202, 209, 210, 580, 209,
+    580, 579, 579, 580, 581, 579, 581, 202,
+    202, 581, 203, 210, 211, 582, 210, 582,
+    580, 580, 582, 583, 580, 583, 581, 581,
+    583, 584, 581, 584, 203, 203, 584, 204,
+    211, 212, 585, 211, 585, 582, 582, 585,
+    586, 582, 586, 583, 583, 586, 587, 583,
+    587, 584, 584, 587, 588, 584, 588, 204,
+    204, 588, 205, 212, 213, 589, 212, 589,
+    585, 585, 589, 590, 585, 590, 586, 586,
+    590, 591, 586, 591, 587, 587, 591, 592,
+    587, 592, 588, 588, 592, 593, 588, 593,
+    205, 205, 593, 206, 213, 214, 594, 213,
+    594, 589, 589, 594, 595, 589, 595, 590,
+    590, 595, 596, 590, 596, 591, 591, 596,
+    597, 591, 597, 592, 592, 597, 598, 592,
+    598, 593, 593, 598, 599, 593, 599, 206,
+    206, 599, 207, 214, 2, 215, 214, 215,
+    594, 594, 215, 216, 594, 216, 595, 595,
+    216, 217, 595, 217, 596, 596, 217, 218,
+    596, 218, 597, 597, 218, 219, 597, 219,
+    598, 598, 219, 220, 598, 220, 599, 599,
+    220, 221, 599, 221, 207, 207, 221, 11,
+    9, 54, 208, 54, 55, 600, 54, 600,
+    208, 208, 600, 209, 55, 56, 601, 55,
+    601, 600, 600, 601, 602, 600, 602, 209,
+    209, 602, 210, 56, 57, 603, 56, 603,
+    601, 601, 603, 604, 601, 604, 602, 602,
+    604, 605, 602, 605, 210, 210, 605, 211,
+    57, 58, 606, 57, 606, 603, 603, 606,
+    607, 603, 607, 604, 604, 607, 608, 604,
+    608, 605, 605, 608, 609, 605, 609, 211,
+    211, 609, 212, 58, 59, 610, 58, 610,
+    606, 606, 610, 611, 606, 611, 607, 607,
+    611, 612, 607, 612, 608, 608, 612, 613,
+    608, 613, 609, 609, 613, 614, 609, 614,
+    212, 212, 614, 213, 59, 60, 615, 59,
+    615, 610, 610, 615, 616, 610, 616, 611,
+    611, 616, 617, 611, 617, 612, 612, 617,
+    618, 612, 618, 613, 613, 618, 619, 613,
+    619, 614, 614, 619, 620, 614, 620, 213,
+    213, 620, 214, 60, 5, 124, 60, 124,
+    615, 615, 124, 125, 615, 125, 616, 616,
+    125, 126, 616, 126, 617, 617, 126, 127,
+    617, 127, 618, 618, 127, 128, 618, 128,
+    619, 619, 128, 129, 619, 129, 620, 620,
+    129, 130, 620, 130, 214, 214, 130, 2,
+    7, 173, 144, 173, 174, 621, 173, 621,
+    144, 144, 621, 143, 174, 175, 622, 174,
+    622, 621, 621, 622, 623, 621, 623, 143,
+    143, 623, 142, 175, 176, 624, 175, 624,
+    622, 622, 624, 625, 622, 625, 623, 623,
+    625, 626, 623, 626, 142, 142, 626, 141,
+    176, 177, 627, 176, 627, 624, 624, 627,
+    628, 624, 628, 625, 625, 628, 629, 625,
+    629, 626, 626, 629, 630, 626, 630, 141,
+    141, 630, 140, 177, 178, 631, 177, 631,
+    627, 627, 631, 632, 627, 632, 628, 628,
+    632, 633, 628, 633, 629, 629, 633, 634,
+    629, 634, 630, 630, 634, 635, 630, 635,
+    140, 140, 635, 139, 178, 179, 636, 178,
+    636, 631, 631, 636, 637, 631, 637, 632,
+    632, 637, 638, 632, 638, 633, 633, 638,
+    639, 633, 639, 634, 634, 639, 640, 634,
+    640, 635, 635, 640, 641, 635, 641, 139,
+    139, 641, 138, 179, 11, 221, 179, 221,
+    636, 636, 221, 220, 636, 220, 637, 637,
+    220, 219, 637, 219, 638, 638, 219, 218,
+    638, 218, 639, 639, 218, 217, 639, 217,
+    640, 640, 217, 216, 640, 216, 641, 641,
+    216, 215, 641, 215, 138, 138, 215, 2
+};
+const uint16_t STATIC_ICOSPHERE_3_INDICES[] =
+{
+    0, 12, 26, 12, 13, 222, 12, 222,
+    26, 26, 222, 27, 13, 14, 223, 13,
+    223, 222, 222, 223, 224, 222, 224, 27,
+    27, 224, 28, 14, 15, 225, 14, 225,
+    223, 223, 225, 226, 223, 226, 224, 224,
+    226, 227, 224, 227, 28, 28, 227, 29,
+    15, 16, 228, 15, 228, 225, 225, 228,
+    229, 225, 229, 226, 226, 229, 230, 226,
+    230, 227, 227, 230, 231, 227, 231, 29,
+    29, 231, 30, 16, 17, 232, 16, 232,
+    228, 228, 232, 233, 228, 233, 229, 229,
+    233, 234, 229, 234, 230, 230, 234, 235,
+    230, 235, 231, 231, 235, 236, 231, 236,
+    30, 30, 236, 31, 17, 18, 237, 17,
+    237, 232, 232, 237, 238, 232, 238, 233,
+    233, 238, 239, 233, 239, 234, 234, 239,
+    240, 234, 240, 235, 235, 240, 241, 235,
+    241, 236, 236, 241, 242, 236, 242, 31,
+    31, 242, 32, 18, 1, 19, 18, 19,
+    237, 237, 19, 20, 237, 20, 238, 238,
+    20, 21, 238, 21, 239, 239, 21, 22,
+    239, 22, 240, 240, 22, 23, 240, 23,
+    241, 241, 23, 24, 241, 24, 242, 242,
+    24, 25, 242, 25, 32, 32, 25, 4,
+    0, 26, 40, 26, 27, 243, 26, 243,
+    40, 40, 243, 41, 27, 28, 244, 27,
+    244, 243, 243, 244, 245, 243, 245, 41,
+    41, 245, 42, 28, 29, 246, 28, 246,
+    244, 244, 246, 247, 244, 247, 245, 245,
+    247, 248, 245, 248, 42, 42, 248, 43,
+    29, 30, 249, 29, 249, 246, 246, 249,
+    250, 246, 250, 247, 247, 250, 251, 247,
+    251, 248, 248, 251, 252, 248, 252, 43,
+    43, 252, 44, 30, 31, 253, 30, 253,
+    249, 249, 253, 254, 249, 254, 250, 250,
+    254, 255, 250, 255, 251, 251, 255, 256,
+    251, 256, 252, 252, 256, 257, 252, 257,
+    44, 44, 257, 45, 31, 32, 258, 31,
+    258, 253, 253, 258, 259, 253, 259, 254,
+    254, 259, 260, 254, 260, 255, 255, 260,
+    261, 255, 261, 256, 256, 261, 262, 256,
+    262, 257, 257, 262, 263, 257, 263, 45,
+    45, 263, 46, 32, 4, 33, 32, 33,
+    258, 258, 33, 34, 258, 34, 259, 259,
+    34, 35, 259, 35, 260, 260, 35, 36,
+    260, 36, 261, 261, 36, 37, 261, 37,
+    262, 262, 37, 38, 262, 38, 263, 263,
+    38, 39, 263, 39, 46, 46, 39, 9,
+    9, 39, 642, 39, 38, 264, 39, 264,
+    642, 642, 264, 643, 38, 37, 265, 38,
+    265, 264, 264, 265, 644, 264, 644, 643,
+    55, 266, 56, 37, 36, 267, 37, 267,
+    265, 265, 267, 268, 265, 268, 644, 644,
+    268, 645, 266, 269, 56, 56, 269, 57,
+    36, 35, 270, 36, 270, 267, 267, 270,
+    271, 267, 271, 268, 268, 271, 646, 268,
+    646, 645, 269, 272, 273, 269, 273, 57,
+    57, 273, 58, 35, 34, 274, 35, 274,
+    270, 270, 274, 275, 270, 275, 271, 271,
+    275, 276, 271, 276, 646, 646, 276, 647,
+    272, 277, 273, 273, 277, 278, 273, 278,
+    58, 58, 278, 59, 34, 33, 279, 34,
+    279, 274, 274, 279, 280, 274, 280, 275,
+    275, 280, 281, 275, 281, 276, 276, 281,
+    648, 276, 648, 647, 277, 282, 283, 277,
+    283, 278, 278, 283, 284, 278, 284, 59,
+    59, 284, 60, 33, 4, 47, 33, 47,
+    279, 279, 47, 48, 279, 48, 280, 280,
+    48, 49, 280, 49, 281, 281, 49, 664,
+    281, 665, 648, 282, 666, 51, 282, 51,
+    283, 283, 51, 52, 283, 52, 284, 284,
+    52, 53, 284, 53, 60, 60, 53, 5,
+    4, 61, 47, 61, 62, 285, 61, 285,
+    47, 47, 285, 48, 62, 63, 286, 62,
+    286, 285, 285, 286, 287, 285, 287, 48,
+    48, 287, 49, 63, 64, 288, 63, 288,
+    286, 286, 288, 289, 286, 289, 287, 287,
+    289, 290, 287, 290, 49, 49, 290, 667,
+    64, 65, 291, 64, 291, 288, 288, 291,
+    292, 288, 292, 289, 289, 292, 293, 289,
+    293, 290, 290, 293, 294, 290, 294, 668,
+    669, 294, 51, 65, 66, 295, 65, 295,
+    291, 291, 295, 296, 291, 296, 292, 292,
+    296, 297, 292, 297, 293, 293, 297, 298,
+    293, 298, 294, 294, 298, 299, 294, 299,
+    51, 51, 299, 52, 66, 67, 300, 66,
+    300, 295, 295, 300, 301, 295, 301, 296,
+    296, 301, 302, 296, 302, 297, 297, 302,
+    303, 297, 303, 298, 298, 303, 304, 298,
+    304, 299, 299, 304, 305, 299, 305, 52,
+    52, 305, 53, 67, 8, 68, 67, 68,
+    300, 300, 68, 69, 300, 69, 301, 301,
+    69, 70, 301, 70, 302, 302, 70, 71,
+    302, 71, 303, 303, 71, 72, 303, 72,
+    304, 304, 72, 73, 304, 73, 305, 305,
+    73, 74, 305, 74, 53, 53, 74, 5,
+    4, 25, 61, 25, 24, 306, 25, 306,
+    61, 61, 306, 62, 24, 23, 307, 24,
+    307, 306, 306, 307, 308, 306, 308, 62,
+    62, 308, 63, 23, 22, 309, 23, 309,
+    307, 307, 309, 310, 307, 310, 308, 308,
+    310, 311, 308, 311, 63, 63, 311, 64,
+    22, 21, 312, 22, 312, 309, 309, 312,
+    313, 309, 313, 310, 310, 313, 314, 310,
+    314, 311, 311, 314, 315, 311, 315, 64,
+    64, 315, 65, 21, 20, 316, 21, 316,
+    312, 312, 316, 317, 312, 317, 313, 313,
+    317, 318, 313, 318, 314, 314, 318, 319,
+    314, 319, 315, 315, 319, 320, 315, 320,
+    65, 65, 320, 66, 20, 19, 321, 20,
+    321, 316, 316, 321, 322, 316, 322, 317,
+    317, 322, 323, 317, 323, 318, 318, 323,
+    324, 318, 324, 319, 319, 324, 325, 319,
+    325, 320, 320, 325, 326, 320, 326, 66,
+    66, 326, 67, 19, 1, 75, 19, 75,
+    321, 321, 75, 76, 321, 76, 322, 322,
+    76, 77, 322, 77, 323, 323, 77, 78,
+    323, 78, 324, 324, 78, 79, 324, 79,
+    325, 325, 79, 80, 325, 80, 326, 326,
+    80, 81, 326, 81, 67, 67, 81, 8,
+    8, 81, 89, 81, 80, 327, 81, 327,
+    89, 89, 327, 90, 80, 79, 328, 80,
+    328, 327, 327, 328, 329, 327, 329, 90,
+    90, 329, 91, 79, 78, 330, 79, 330,
+    328, 328, 330, 331, 328, 331, 329, 329,
+    331, 332, 329, 332, 91, 91, 332, 92,
+    78, 77, 333, 78, 333, 330, 330, 333,
+    334, 330, 334, 331, 331, 334, 335, 331,
+    335, 332, 332, 335, 336, 332, 336, 92,
+    92, 336, 93, 77, 76, 337, 77, 337,
+    333, 333, 337, 338, 333, 338, 334, 334,
+    338, 339, 334, 339, 335, 335, 339, 340,
+    335, 340, 336, 336, 340, 341, 336, 341,
+    93, 93, 341, 94, 76, 75, 342, 76,
+    342, 337, 337, 342, 343, 337, 343, 338,
+    338, 343, 344, 338, 344, 339, 339, 344,
+    345, 339, 345, 340, 340, 345, 346, 340,
+    346, 341, 341, 346, 347, 341, 347, 94,
+    94, 347, 95, 75, 1, 82, 75, 82,
+    342, 342, 82, 83, 342, 83, 343, 343,
+    83, 84, 343, 84, 344, 344, 84, 85,
+    344, 85, 345, 345, 85, 86, 345, 86,
+    346, 346, 86, 87, 346, 87, 347, 347,
+    87, 88, 347, 88, 95, 95, 88, 10,
+    8, 89, 103, 89, 90, 348, 89, 348,
+    103, 103, 348, 104, 90, 91, 349, 90,
+    349, 348, 348, 349, 350, 348, 350, 104,
+    104, 350, 105, 91, 92, 351, 91, 351,
+    349, 349, 351, 352, 349, 352, 350, 350,
+    352, 353, 350, 353, 105, 105, 353, 106,
+    92, 93, 354, 92, 354, 351, 351, 354,
+    355, 351, 355, 352, 352, 355, 356, 352,
+    356, 353, 353, 356, 357, 353, 357, 106,
+    106, 357, 107, 93, 94, 358, 93, 358,
+    354, 354, 358, 359, 354, 359, 355, 355,
+    359, 360, 355, 360, 356, 356, 360, 361,
+    356, 361, 357, 357, 361, 362, 357, 362,
+    107, 107, 362, 108, 94, 95, 363, 94,
+    363, 358, 358, 363, 364, 358, 364, 359,
+    359, 364, 365, 359, 365, 360, 360, 365,
+    366, 360, 366, 361, 361, 366, 367, 361,
+    367, 362, 362, 367, 368, 362, 368, 108,
+    108, 368, 109, 95, 10, 96, 95, 96,
+    363, 363, 96, 97, 363, 97, 364, 364,
+    97, 98, 364, 98, 365, 365, 98, 99,
+    365, 99, 366, 366, 99, 100, 366, 100,
+    367, 367, 100, 101, 367, 101, 368, 368,
+    101, 102, 368, 102, 109, 109, 102, 3,
+    5, 74, 110, 74, 73, 369, 74, 369,
+    110, 110, 369, 111, 73, 72, 370, 73,
+    370, 369, 369, 370, 371, 369, 371, 111,
+    111, 371, 112, 72, 71, 372, 72, 372,
+    370, 370, 372, 373, 370, 373, 371, 371,
+    373, 374, 371, 374, 112, 112, 374, 113,
+    71, 70, 375, 71, 375, 372, 372, 375,
+    376, 372, 376, 373, 373, 376, 377, 373,
+    377, 374, 374, 377, 378, 374, 378, 113,
+    113, 378, 114, 70, 69, 379, 70, 379,
+    375, 375, 379, 380, 375, 380, 376, 376,
+    380, 381, 376, 381, 377, 377, 381, 382,
+    377, 382, 378, 378, 382, 383, 378, 383,
+    114, 114, 383, 115, 69, 68, 384, 69,
+    384, 379, 379, 384, 385, 379, 385, 380,
+    380, 385, 386, 380, 386, 381, 381, 386,
+    387, 381, 387, 382, 382, 387, 388, 382,
+    388, 383, 383, 388, 389, 383, 389, 115,
+    115, 389, 116, 68, 8, 103, 68, 103,
+    384, 384, 103, 104, 384, 104, 385, 385,
+    104, 105, 385, 105, 386, 386, 105, 106,
+    386, 106, 387, 387, 106, 107, 387, 107,
+    388, 388, 107, 108, 388, 108, 389, 389,
+    108, 109, 389, 109, 116, 116, 109, 3,
+    5, 110, 124, 110, 111, 390, 110, 390,
+    124, 124, 390, 125, 111, 112, 391, 111,
+    391, 390, 390, 391, 392, 390, 392, 125,
+    125, 392, 126, 112, 113, 393, 112, 393,
+    391, 391, 393, 394, 391, 394, 392, 392,
+    394, 395, 392, 395, 126, 126, 395, 127,
+    113, 114, 396, 113, 396, 393, 393, 396,
+    397, 393, 397, 394, 394, 397, 398, 394,
+    398, 395, 395, 398, 399, 395, 399, 127,
+    127, 399, 128, 114, 115, 400, 114, 400,
+    396, 396, 400, 401, 396, 401, 397, 397,
+    401, 402, 397, 402, 398, 398, 402, 403,
+    398, 403, 399, 399, 403, 404, 399, 404,
+    128, 128, 404, 129, 115, 116, 405, 115,
+    405, 400, 400, 405, 406, 400, 406, 401,
+    401, 406, 407, 401, 407, 402, 402, 407,
+    408, 402, 408, 403, 403, 408, 409, 403,
+    409, 404, 404, 409, 410, 404, 410, 129,
+    129, 410, 130, 116, 3, 117, 116, 117,
+    405, 405, 117, 118, 405, 118, 406, 406,
+    118, 119, 406, 119, 407, 407, 119, 120,
+    407, 120, 408, 408, 120, 121, 408, 121,
+    409, 409, 121, 122, 409, 122, 410, 410,
+    122, 123, 410, 123, 130, 130, 123, 2,
+    2, 123, 138, 123, 122, 411, 123, 411,
+    138, 138, 411, 139, 122, 121, 412, 122,
+    412, 411, 411, 412, 413, 411, 413, 139,
+    139, 413, 140, 121, 120, 414, 121, 414,
+    412, 412, 414, 415, 412, 415, 413, 413,
+    415, 416, 413, 416, 140, 140, 416, 141,
+    120, 119, 417, 120, 417, 414, 414, 417,
+    418, 414, 418, 415, 415, 418, 419, 415,
+    419, 416, 416, 419, 420, 416, 420, 141,
+    141, 420, 142, 119, 118, 421, 119, 421,
+    417, 417, 421, 422, 417, 422, 418, 418,
+    422, 423, 418, 423, 419, 419, 423, 424,
+    419, 424, 420, 420, 424, 425, 420, 425,
+    142, 142, 425, 143, 118, 117, 426, 118,
+    426, 421, 421, 426, 427, 421, 427, 422,
+    422, 427, 428, 422, 428, 423, 423, 428,
+    429, 423, 429, 424, 424, 429, 430, 424,
+    430, 425, 425, 430, 431, 425, 431, 143,
+    143, 431, 144, 117, 3, 131, 117, 131,
+    426, 426, 131, 132, 426, 132, 427, 427,
+    132, 133, 427, 133, 428, 428, 133, 134,
+    428, 134, 429, 429, 134, 135, 429, 135,
+    430, 430, 135, 136, 430, 136, 431, 431,
+    136, 137, 431, 137, 144, 144, 137, 7,
+    7, 137, 145, 137, 136, 432, 137, 432,
+    145, 145, 432, 146, 136, 135, 433, 136,
+    433, 432, 432, 433, 434, 432, 434, 146,
+    146, 434, 147, 135, 134, 435, 135, 435,
+    433, 433, 435, 436, 433, 436, 434, 434,
+    436, 437, 434, 437, 147, 147, 437, 148,
+    134, 133, 438, 134, 438, 435, 435, 438,
+    439, 435, 439, 436, 436, 439, 440, 436,
+    440, 437, 437, 440, 441, 437, 441, 148,
+    148, 441, 149, 133, 132, 442, 133, 442,
+    438, 438, 442, 443, 438, 443, 439, 439,
+    443, 444, 439, 444, 440, 440, 444, 445,
+    440, 445, 441, 441, 445, 446, 441, 446,
+    149, 149, 446, 150, 132, 131, 447, 132,
+    447, 442, 442, 447, 448, 442, 448, 443,
+    443, 448, 449, 443, 449, 444, 444, 449,
+    450, 444, 450, 445, 445, 450, 451, 445,
+    451, 446, 446, 451, 452, 446, 452, 150,
+    150, 452, 151, 131, 3, 102, 131, 102,
+    447, 447, 102, 101, 447, 101, 448, 448,
+    101, 100, 448, 100, 449, 449, 100, 99,
+    449, 99, 450, 450, 99, 98, 450, 98,
+    451, 451, 98, 97, 451, 97, 452, 452,
+    97, 96, 452, 96, 151, 151, 96, 10,
+    7, 145, 159, 145, 146, 453, 145, 453,
+    159, 159, 453, 160, 146, 147, 454, 146,
+    454, 453, 453, 454, 455, 453, 455, 160,
+    160, 455, 161, 147, 148, 456, 147, 456,
+    454, 454, 456, 457, 454, 457, 455, 455,
+    457, 458, 455, 458, 161, 161, 458, 670,
+    148, 149, 459, 148, 459, 456, 456, 459,
+    460, 456, 460, 457, 457, 460, 461, 457,
+    461, 458, 458, 461, 462, 458, 462, 671,
+    672, 462, 163, 149, 150, 463, 149, 463,
+    459, 459, 463, 464, 459, 464, 460, 460,
+    464, 465, 460, 465, 461, 461, 465, 466,
+    461, 466, 462, 462, 466, 467, 462, 467,
+    163, 163, 467, 164, 150, 151, 468, 150,
+    468, 463, 463, 468, 469, 463, 469, 464,
+    464, 469, 470, 464, 470, 465, 465, 470,
+    471, 465, 471, 466, 466, 471, 472, 466,
+    472, 467, 467, 472, 473, 467, 473, 164,
+    164, 473, 165, 151, 10, 152, 151, 152,
+    468, 468, 152, 153, 468, 153, 469, 469,
+    153, 154, 469, 154, 470, 470, 154, 155,
+    470, 155, 471, 471, 155, 156, 471, 156,
+    472, 472, 156, 157, 472, 157, 473, 473,
+    157, 158, 473, 158, 165, 165, 158, 6,
+    7, 159, 173, 159, 160, 474, 159, 474,
+    173, 173, 474, 174, 160, 161, 475, 160,
+    475, 474, 474, 475, 476, 474, 476, 174,
+    174, 476, 175, 161, 673, 477, 161, 477,
+    475, 475, 477, 478, 475, 478, 476, 476,
+    478, 479, 476, 479, 175, 175, 479, 176,
+    674, 163, 480, 675, 480, 649, 649, 480,
+    481, 649, 481, 650, 650, 481, 651, 478,
+    482, 479, 479, 482, 483, 479, 483, 176,
+    176, 483, 177, 163, 164, 484, 163, 484,
+    480, 480, 484, 485, 480, 485, 481, 481,
+    485, 486, 481, 486, 651, 651, 486, 487,
+    651, 487, 652, 652, 487, 653, 483, 488,
+    177, 177, 488, 178, 164, 165, 489, 164,
+    489, 484, 484, 489, 490, 484, 490, 485,
+    485, 490, 491, 485, 491, 486, 486, 491,
+    492, 486, 492, 487, 487, 492, 493, 487,
+    493, 653, 653, 493, 494, 653, 494, 654,
+    654, 494, 655, 165, 6, 166, 165, 166,
+    489, 489, 166, 167, 489, 167, 490, 490,
+    167, 168, 490, 168, 491, 491, 168, 169,
+    491, 169, 492, 492, 169, 170, 492, 170,
+    493, 493, 170, 171, 493, 171, 494, 494,
+    171, 172, 494, 172, 655, 655, 172, 11,
+    11, 172, 187, 172, 171, 495, 172, 495,
+    187, 187, 495, 188, 171, 170, 496, 171,
+    496, 495, 495, 496, 497, 495, 497, 188,
+    188, 497, 189, 170, 169, 498, 170, 498,
+    496, 496, 498, 499, 496, 499, 497, 497,
+    499, 500, 497, 500, 189, 189, 500, 190,
+    169, 168, 501, 169, 501, 498, 498, 501,
+    502, 498, 502, 499, 499, 502, 503, 499,
+    503, 500, 500, 503, 504, 500, 504, 190,
+    190, 504, 191, 168, 167, 505, 168, 505,
+    501, 501, 505, 506, 501, 506, 502, 502,
+    506, 507, 502, 507, 503, 503, 507, 508,
+    503, 508, 504, 504, 508, 509, 504, 509,
+    191, 191, 509, 192, 167, 166, 510, 167,
+    510, 505, 505, 510, 511, 505, 511, 506,
+    506, 511, 512, 506, 512, 507, 507, 512,
+    513, 507, 513, 508, 508, 513, 514, 508,
+    514, 509, 509, 514, 515, 509, 515, 192,
+    192, 515, 193, 166, 6, 180, 166, 180,
+    510, 510, 180, 181, 510, 181, 511, 511,
+    181, 182, 511, 182, 512, 512, 182, 183,
+    512, 183, 513, 513, 183, 184, 513, 184,
+    514, 514, 184, 185, 514, 185, 515, 515,
+    185, 186, 515, 186, 193, 193, 186, 0,
+    0, 186, 12, 186, 185, 516, 186, 516,
+    12, 12, 516, 13, 185, 184, 517, 185,
+    517, 516, 516, 517, 518, 516, 518, 13,
+    13, 518, 14, 184, 183, 519, 184, 519,
+    517, 517, 519, 520, 517, 520, 518, 518,
+    520, 521, 518, 521, 14, 14, 521, 15,
+    183, 182, 522, 183, 522, 519, 519, 522,
+    523, 519, 523, 520, 520, 523, 524, 520,
+    524, 521, 521, 524, 525, 521, 525, 15,
+    15, 525, 16, 182, 181, 526, 182, 526,
+    522, 522, 526, 527, 522, 527, 523, 523,
+    527, 528, 523, 528, 524, 524, 528, 529,
+    524, 529, 525, 525, 529, 530, 525, 530,
+    16, 16, 530, 17, 181, 180, 531, 181,
+    531, 526, 526, 531, 532, 526, 532, 527,
+    527, 532, 533, 527, 533, 528, 528, 533,
+    534, 528, 534, 529, 529, 534, 535, 529,
+    535, 530, 530, 535, 536, 530, 536, 17,
+    17, 536, 18, 180, 6, 194, 180, 194,
+    531, 531, 194, 195, 531, 195, 532, 532,
+    195, 196, 532, 196, 533, 533, 196, 197,
+    533, 197, 534, 534, 197, 198, 534, 198,
+    535, 535, 198, 199, 535, 199, 536, 536,
+    199, 200, 536, 200, 18, 18, 200, 1,
+    6, 158, 194, 158, 157, 537, 158, 537,
+    194, 194, 537, 195, 157, 156, 538, 157,
+    538, 537, 537, 538, 539, 537, 539, 195,
+    195, 539, 196, 156, 155, 540, 156, 540,
+    538, 538, 540, 541, 538, 541, 539, 539,
+    541, 542, 539, 542, 196, 196, 542, 197,
+    155, 154, 543, 155, 543, 540, 540, 543,
+    544, 540, 544, 541, 541, 544, 545, 541,
+    545, 542, 542, 545, 546, 542, 546, 197,
+    197, 546, 198, 154, 153, 547, 154, 547,
+    543, 543, 547, 548, 543, 548, 544, 544,
+    548, 549, 544, 549, 545, 545, 549, 550,
+    545, 550, 546, 546, 550, 551, 546, 551,
+    198, 198, 551, 199, 153, 152, 552, 153,
+    552, 547, 547, 552, 553, 547, 553, 548,
+    548, 553, 554, 548, 554, 549, 549, 554,
+    555, 549, 555, 550, 550, 555, 556, 550,
+    556, 551, 551, 556, 557, 551, 557, 199,
+    199, 557, 200, 152, 10, 88, 152, 88,
+    552, 552, 88, 87, 552, 87, 553, 553,
+    87, 86, 553, 86, 554, 554, 86, 85,
+    554, 85, 555, 555, 85, 84, 555, 84,
+    556, 556, 84, 83, 556, 83, 557, 557,
+    83, 82, 557, 82, 200, 200, 82, 1,
+    9, 201, 46, 201, 202, 558, 201, 558,
+    46, 46, 558, 45, 202, 203, 559, 202,
+    559, 558, 558, 559, 560, 558, 560, 45,
+    45, 560, 44, 203, 204, 561, 203, 561,
+    559, 559, 561, 562, 559, 562, 560, 560,
+    562, 563, 560, 563, 44, 44, 563, 43,
+    204, 205, 564, 204, 564, 561, 561, 564,
+    565, 561, 565, 562, 562, 565, 566, 562,
+    566, 563, 563, 566, 567, 563, 567, 43,
+    43, 567, 42, 205, 206, 568, 205, 568,
+    564, 564, 568, 569, 564, 569, 565, 565,
+    569, 570, 565, 570, 566, 566, 570, 571,
+    566, 571, 567, 567, 571, 572, 567, 572,
+    42, 42, 572, 41, 206, 207, 573, 206,
+    573, 568, 568, 573, 574, 568, 574, 569,
+    569, 574, 575, 569, 575, 570, 570, 575,
+    576, 570, 576, 571, 571, 576, 577, 571,
+    577, 572, 572, 577, 578, 572, 578, 41,
+    41, 578, 40, 207, 11, 187, 207, 187,
+    573, 573, 187, 188, 573, 188, 574, 574,
+    188, 189, 574, 189, 575, 575, 189, 190,
+    575, 190, 576, 576, 190, 191, 576, 191,
+    577, 577, 191, 192, 577, 192, 578, 578,
+    192, 193, 578, 193, 40, 40, 193, 0,
+    9, 656, 201, 208, 209, 579, 656, 657,
+    201, 201, 657, 202, 209, 210, 580, 209,
+    580, 579, 579, 580, 581, 657, 658, 202,
+    202, 658, 203, 210, 211, 582, 210, 582,
+    580, 580, 582, 583, 580, 583, 581, 581,
+    583, 584, 658, 659, 203, 203, 659, 204,
+    211, 212, 585, 211, 585, 582, 582, 585,
+    586, 582, 586, 583, 583, 586, 587, 583,
+    587, 584, 584, 587, 588, 659, 660, 204,
+    204, 660, 205, 212, 213, 589, 212, 589,
+    585, 585, 589, 590, 585, 590, 586, 586,
+    590, 591, 586, 591, 587, 587, 591, 592,
+    587, 592, 588, 588, 592, 593, 660, 661,
+    205, 205, 661, 206, 213, 214, 594, 213,
+    594, 589, 589, 594, 595, 589, 595, 590,
+    590, 595, 596, 590, 596, 591, 591, 596,
+    597, 591, 597, 592, 592, 597, 598, 592,
+    598, 593, 593, 598, 599, 661, 662, 206,
+    206, 662, 207, 214, 2, 215, 214, 215,
+    594, 594, 215, 216, 594, 216, 595, 595,
+    216, 217, 595, 217, 596, 596, 217, 218,
+    596, 218, 597, 597, 218, 219, 597, 219,
+    598, 598, 219, 220, 598, 220, 599, 599,
+    220, 221, 662, 663, 207, 207, 663, 11,
+    9, 642, 656, 54, 55, 600, 54, 600,
+    208, 208, 600, 209, 55, 56, 601, 55,
+    601, 600, 600, 601, 602, 600, 602, 209,
+    209, 602, 210, 56, 57, 603, 56, 603,
+    601, 601, 603, 604, 601, 604, 602, 602,
+    604, 605, 602, 605, 210, 210, 605, 211,
+    57, 58, 606, 57, 606, 603, 603, 606,
+    607, 603, 607, 604, 604, 607, 608, 604,
+    608, 605, 605, 608, 609, 605, 609, 211,
+    211, 609, 212, 58, 59, 610, 58, 610,
+    606, 606, 610, 611, 606, 611, 607, 607,
+    611, 612, 607, 612, 608, 608, 612, 613,
+    608, 613, 609, 609, 613, 614, 609, 614,
+    212, 212, 614, 213, 59, 60, 615, 59,
+    615, 610, 610, 615, 616, 610, 616, 611,
+    611, 616, 617, 611, 617, 612, 612, 617,
+    618, 612, 618, 613, 613, 618, 619, 613,
+    619, 614, 614, 619, 620, 614, 620, 213,
+    213, 620, 214, 60, 5, 124, 60, 124,
+    615, 615, 124, 125, 615, 125, 616, 616,
+    125, 126, 616, 126, 617, 617, 126, 127,
+    617, 127, 618, 618, 127, 128, 618, 128,
+    619, 619, 128, 129, 619, 129, 620, 620,
+    129, 130, 620, 130, 214, 214, 130, 2,
+    7, 173, 144, 173, 174, 621, 173, 621,
+    144, 144, 621, 143, 174, 175, 622, 174,
+    622, 621, 621, 622, 623, 621, 623, 143,
+    143, 623, 142, 175, 176, 624, 175, 624,
+    622, 622, 624, 625, 622, 625, 623, 623,
+    625, 626, 623, 626, 142, 142, 626, 141,
+    176, 177, 627, 176, 627, 624, 624, 627,
+    628, 624, 628, 625, 625, 628, 629, 625,
+    629, 626, 626, 629, 630, 626, 630, 141,
+    141, 630, 140, 177, 178, 631, 177, 631,
+    627, 627, 631, 632, 627, 632, 628, 628,
+    632, 633, 628, 633, 629, 629, 633, 634,
+    629, 634, 630, 630, 634, 635, 630, 635,
+    140, 140, 635, 139, 178, 179, 636, 178,
+    636, 631, 631, 636, 637, 631, 637, 632,
+    632, 637, 638, 632, 638, 633, 633, 638,
+    639, 633, 639, 634, 634, 639, 640, 634,
+    640, 635, 635, 640, 641, 635, 641, 139,
+    139, 641, 138, 655, 11, 663, 179, 221,
+    636, 636, 221, 220, 636, 220, 637, 637,
+    220, 219, 637, 219, 638, 638, 219, 218,
+    638, 218, 639, 639, 218, 217, 639, 217,
+    640, 640, 217, 216, 640, 216, 641, 641,
+    216, 215, 641, 215, 138, 138, 215, 2
+};
+
+const float STATIC_ICOSPHERE_4_POSITIONS[] =
+{
+    -0.525731146f, 0.0f, 0.850650907f, 0.525731146f, 0.0f, 0.850650907f, -0.525731146f, 0.0f,
+    -0.850650907f, 0.525731146f, 0.0f, -0.850650907f, 0.0f, 0.850650907f, 0.525731146f, 0.0f,
+    0.850650907f, -0.525731146f, 0.0f, -0.850650907f, 0.525731146f, 0.0f, -0.850650907f, -0.525731146f,
+    0.850650907f, 0.525731146f, 0.0f, -0.850650907f, 0.525731146f, 0.0f, 0.850650907f, -0.525731146f,
+    0.0f, -0.850650907f, -0.525731146f, 0.0f, -0.475679845f, 0.0f, 0.879618466f, -0.42054382f,
+    0.0f, 0.907272279f, -0.360324293f, 0.0f, 0.932827175f, -0.295241803f, 0.0f, 0.955422521f,
+    -0.225778341f, 0.0f, 0.974178791f, -0.152696595f, 0.0f, 0.988273144f, -0.0770247355f, 0.0f,
+    0.997029185f, 0.0f, 0.0f, 0.99999994f, 0.0770247355f, 0.0f, 0.997029185f, 0.152696595f,
+    0.0f, 0.988273144f, 0.225778341f, 0.0f, 0.974178791f, 0.295241803f, 0.0f, 0.955422521f,
+    0.360324293f, 0.0f, 0.932827175f, 0.42054382f, 0.0f, 0.907272279f, 0.475679845f, 0.0f,
+    0.879618466f, 0.509656966f, 0.0549761541f, 0.858619452f, 0.490634441f, 0.113409035f, 0.863953888f, 0.468421519f,
+    0.174905077f, 0.866019249f, 0.442862689f, 0.23885563f, 0.864187777f, 0.413926959f, 0.304430872f, 0.857896507f,
+    0.381741494f, 0.370602429f, 0.846715569f, 0.346611321f, 0.436200261f, 0.830415487f, 0.309016973f, 0.49999997f,
+    0.809016943f, 0.269586593f, 0.560828924f, 0.782811582f, 0.229044884f, 0.617670715f, 0.752343893f, 0.188148618f,
+    0.669747889f, 0.718357861f, 0.147620901f, 0.716566861f, 0.68171829f, 0.108097278f, 0.757921994f, 0.643326581f,
+    0.0700906366f, 0.793863237f, 0.604043484f, 0.0339771323f, 0.824642301f, 0.564633131f, -0.509656966f, 0.0549761541f,
+    0.858619452f, -0.490634441f, 0.113409035f, 0.863953888f, -0.468421519f, 0.174905077f, 0.866019249f, -0.442862689f,
+    0.23885563f, 0.864187777f, -0.413926959f, 0.304430872f, 0.857896507f, -0.381741494f, 0.370602429f, 0.846715569f,
+    -0.346611321f, 0.436200261f, 0.830415487f, -0.309016973f, 0.49999997f, 0.809016943f, -0.269586593f, 0.560828924f,
+    0.782811582f, -0.229044884f, 0.617670715f, 0.752343893f, -0.188148618f, 0.669747889f, 0.718357861f, -0.147620901f,
+    0.716566861f, 0.68171829f, -0.108097278f, 0.757921994f, 0.643326581f, -0.0700906366f, 0.793863237f, 0.604043484f,
+    -0.0339771323f, 0.824642301f, 0.564633131f, -0.0549761541f, 0.858619452f, 0.509656966f, -0.113409035f, 0.863953888f,
+    0.490634441f, -0.174905077f, 0.866019249f, 0.468421519f, -0.23885563f, 0.864187777f, 0.442862689f, -0.304430872f,
+    0.857896507f, 0.413926959f, -0.370602429f, 0.846715569f, 0.381741494f, -0.436200261f, 0.830415487f, 0.346611321f,
+    -0.49999997f, 0.809016943f, 0.309016973f, -0.560828924f, 0.782811582f, 0.269586593f, -0.617670715f, 0.752343893f,
+    0.229044884f, -0.669747829f, 0.718357742f, 0.188148603f, -0.716566861f, 0.68171829f, 0.147620901f, -0.757922053f,
+    0.6433267f, 0.108097285f, -0.793863237f, 0.604043484f, 0.0700906366f, -0.824642301f, 0.564633131f, 0.0339771323f,
+    -0.564633131f, 0.0339771323f, 0.824642301f, -0.604043484f, 0.0700906366f, 0.793863237f, -0.643326581f, 0.108097278f,
+    0.757921994f, -0.68171829f, 0.147620901f, 0.716566861f, -0.718357861f, 0.188148618f, 0.669747889f, -0.752343893f,
+    0.229044884f, 0.617670715f, -0.782811582f, 0.269586593f, 0.560828924f, -0.809016943f, 0.309016973f, 0.49999997f,
+    -0.830415487f, 0.346611321f, 0.436200261f, -0.846715569f, 0.381741494f, 0.370602429f, -0.857896507f, 0.413926959f,
+    0.304430872f, -0.864187777f, 0.442862689f, 0.23885563f, -0.866019249f, 0.468421519f, 0.174905077f, -0.863953888f,
+    0.490634441f, 0.113409035f, -0.858619452f, 0.509656966f, 0.0549761541f, 0.0f, 0.879618466f, 0.475679845f,
+    0.0f, 0.907272279f, 0.42054382f, 0.0f, 0.932827175f, 0.360324293f, 0.0f, 0.955422521f,
+    0.295241803f, 0.0f, 0.974178791f, 0.225778341f, 0.0f, 0.988273144f, 0.152696595f, 0.0f,
+    0.997029185f, 0.0770247355f, 0.0f, 0.99999994f, 0.0f, 0.0f, 0.997029185f, -0.0770247355f,
+    0.0f, 0.988273144f, -0.152696595f, 0.0f, 0.974178791f, -0.225778341f, 0.0f, 0.955422521f,
+    -0.295241803f, 0.0f, 0.932827175f, -0.360324293f, 0.0f, 0.907272279f, -0.42054382f, 0.0f,
+    0.879618466f, -0.475679845f, -0.824642301f, 0.564633131f, -0.0339771323f, -0.793863237f, 0.604043484f, -0.0700906366f,
+    -0.757922053f, 0.6433267f, -0.108097285f, -0.716566861f, 0.68171829f, -0.147620901f, -0.669747829f, 0.718357742f,
+    -0.188148603f, -0.617670715f, 0.752343893f, -0.229044884f, -0.560828924f, 0.782811582f, -0.269586593f, -0.49999997f,
+    0.809016943f, -0.309016973f, -0.436200261f, 0.830415487f, -0.346611321f, -0.370602429f, 0.846715569f, -0.381741494f,
+    -0.304430872f, 0.857896507f, -0.413926959f, -0.23885563f, 0.864187777f, -0.442862689f, -0.174905077f, 0.866019249f,
+    -0.468421519f, -0.113409035f, 0.863953888f, -0.490634441f, -0.0549761541f, 0.858619452f, -0.509656966f, 0.0549761541f,
+    0.858619452f, 0.509656966f, 0.113409035f, 0.863953888f, 0.490634441f, 0.174905077f, 0.866019249f, 0.468421519f,
+    0.23885563f, 0.864187777f, 0.442862689f, 0.304430872f, 0.857896507f, 0.413926959f, 0.370602429f, 0.846715569f,
+    0.381741494f, 0.436200261f, 0.830415487f, 0.346611321f, 0.49999997f, 0.809016943f, 0.309016973f, 0.560828924f,
+    0.782811582f, 0.269586593f, 0.617670715f, 0.752343893f, 0.229044884f, 0.669747829f, 0.718357742f, 0.188148603f,
+    0.716566861f, 0.68171829f, 0.147620901f, 0.757922053f, 0.6433267f, 0.108097285f, 0.793863237f, 0.604043484f,
+    0.0700906366f, 0.824642301f, 0.564633131f, 0.0339771323f, 0.824642301f, 0.564633131f, -0.0339771323f, 0.793863237f,
+    0.604043484f, -0.0700906366f, 0.757922053f, 0.6433267f, -0.108097285f, 0.716566861f, 0.68171829f, -0.147620901f,
+    0.669747829f, 0.718357742f, -0.188148603f, 0.617670715f, 0.752343893f, -0.229044884f, 0.560828924f, 0.782811582f,
+    -0.269586593f, 0.49999997f, 0.809016943f, -0.309016973f, 0.436200261f, 0.830415487f, -0.346611321f, 0.370602429f,
+    0.846715569f, -0.381741494f, 0.304430872f, 0.857896507f, -0.413926959f, 0.23885563f, 0.864187777f, -0.442862689f,
+    0.174905077f, 0.866019249f, -0.468421519f, 0.113409035f, 0.863953888f, -0.490634441f, 0.0549761541f, 0.858619452f,
+    -0.509656966f, 0.564633131f, 0.0339771323f, 0.824642301f, 0.604043484f, 0.0700906366f, 0.793863237f, 0.643326581f,
+    0.108097278f, 0.757921994f, 0.68171829f, 0.147620901f, 0.716566861f, 0.718357861f, 0.188148618f, 0.669747889f,
+    0.752343893f, 0.229044884f, 0.617670715f, 0.782811582f, 0.269586593f, 0.560828924f, 0.809016943f, 0.309016973f,
+    0.49999997f, 0.830415487f, 0.346611321f, 0.436200261f, 0.846715569f, 0.381741494f, 0.370602429f, 0.857896507f,
+    0.413926959f, 0.304430872f, 0.864187777f, 0.442862689f, 0.23885563f, 0.866019249f, 0.468421519f, 0.174905077f,
+    0.863953888f, 0.490634441f, 0.113409035f, 0.858619452f, 0.509656966f, 0.0549761541f, 0.564633131f, -0.0339771323f,
+    0.824642301f, 0.604043484f, -0.0700906366f, 0.793863237f, 0.643326581f, -0.108097278f, 0.757921994f, 0.68171829f,
+    -0.147620901f, 0.716566861f, 0.718357861f, -0.188148618f, 0.669747889f, 0.752343893f, -0.229044884f, 0.617670715f,
+    0.782811582f, -0.269586593f, 0.560828924f, 0.809016943f, -0.309016973f, 0.49999997f, 0.830415487f, -0.346611321f,
+    0.436200261f, 0.846715569f, -0.381741494f, 0.370602429f, 0.857896507f, -0.413926959f, 0.304430872f, 0.864187777f,
+    -0.442862689f, 0.23885563f, 0.866019249f, -0.468421519f, 0.174905077f, 0.863953888f, -0.490634441f, 0.113409035f,
+    0.858619452f, -0.509656966f, 0.0549761541f, 0.879618466f, 0.475679845f, 0.0f, 0.907272279f, 0.42054382f,
+    0.0f, 0.932827175f, 0.360324293f, 0.0f, 0.955422521f, 0.295241803f, 0.0f, 0.974178791f,
+    0.225778341f, 0.0f, 0.988273144f, 0.152696595f, 0.0f, 0.997029185f, 0.0770247355f, 0.0f,
+    0.99999994f, 0.0f, 0.0f, 0.997029185f, -0.0770247355f, 0.0f, 0.988273144f, -0.152696595f,
+    0.0f, 0.974178791f, -0.225778341f, 0.0f, 0.955422521f, -0.295241803f, 0.0f, 0.932827175f,
+    -0.360324293f, 0.0f, 0.907272279f, -0.42054382f, 0.0f, 0.879618466f, -0.475679845f, 0.0f,
+    0.858619452f, -0.509656966f, -0.0549761541f, 0.863953888f, -0.490634441f, -0.113409035f, 0.866019249f, -0.468421519f,
+    -0.174905077f, 0.864187777f, -0.442862689f, -0.23885563f, 0.857896507f, -0.413926959f, -0.304430872f, 0.846715569f,
+    -0.381741494f, -0.370602429f, 0.830415487f, -0.346611321f, -0.436200261f, 0.809016943f, -0.309016973f, -0.49999997f,
+    0.782811582f, -0.269586593f, -0.560828924f, 0.752343893f, -0.229044884f, -0.617670715f, 0.718357861f, -0.188148618f,
+    -0.669747889f, 0.68171829f, -0.147620901f, -0.716566861f, 0.643326581f, -0.108097278f, -0.757921994f, 0.604043484f,
+    -0.0700906366f, -0.793863237f, 0.564633131f, -0.0339771323f, -0.824642301f, 0.858619452f, 0.509656966f, -0.0549761541f,
+    0.863953888f, 0.490634441f, -0.113409035f, 0.866019249f, 0.468421519f, -0.174905077f, 0.864187777f, 0.442862689f,
+    -0.23885563f, 0.857896507f, 0.413926959f, -0.304430872f, 0.846715569f, 0.381741494f, -0.370602429f, 0.830415487f,
+    0.346611321f, -0.436200261f, 0.809016943f, 0.309016973f, -0.49999997f, 0.782811582f, 0.269586593f, -0.560828924f,
+    0.752343893f, 0.229044884f, -0.617670715f, 0.718357861f, 0.188148618f, -0.669747889f, 0.68171829f, 0.147620901f,
+    -0.716566861f, 0.643326581f, 0.108097278f, -0.757921994f, 0.604043484f, 0.0700906366f, -0.793863237f, 0.564633131f,
+    0.0339771323f, -0.824642301f, 0.0339771323f, 0.824642301f, -0.564633131f, 0.0700906366f, 0.793863237f, -0.604043484f,
+    0.108097278f, 0.757921994f, -0.643326581f, 0.147620901f, 0.716566861f, -0.68171829f, 0.188148618f, 0.669747889f,
+    -0.718357861f, 0.229044884f, 0.617670715f, -0.752343893f, 0.269586593f, 0.560828924f, -0.782811582f, 0.309016973f,
+    0.49999997f, -0.809016943f, 0.346611321f, 0.436200261f, -0.830415487f, 0.381741494f, 0.370602429f, -0.846715569f,
+    0.413926959f, 0.304430872f, -0.857896507f, 0.442862689f, 0.23885563f, -0.864187777f, 0.468421519f, 0.174905077f,
+    -0.866019249f, 0.490634441f, 0.113409035f, -0.863953888f, 0.509656966f, 0.0549761541f, -0.858619452f, 0.475679845f,
+    0.0f, -0.879618466f, 0.42054382f, 0.0f, -0.907272279f, 0.360324293f, 0.0f, -0.932827175f,
+    0.295241803f, 0.0f, -0.955422521f, 0.225778341f, 0.0f, -0.974178791f, 0.152696595f, 0.0f,
+    -0.988273144f, 0.0770247355f, 0.0f, -0.997029185f, 0.0f, 0.0f, -0.99999994f, -0.0770247355f,
+    0.0f, -0.997029185f, -0.152696595f, 0.0f, -0.988273144f, -0.225778341f, 0.0f, -0.974178791f,
+    -0.295241803f, 0.0f, -0.955422521f, -0.360324293f, 0.0f, -0.932827175f, -0.42054382f, 0.0f,
+    -0.907272279f, -0.475679845f, 0.0f, -0.879618466f, -0.0339771323f, 0.824642301f, -0.564633131f, -0.0700906366f,
+    0.793863237f, -0.604043484f, -0.108097278f, 0.757921994f, -0.643326581f, -0.147620901f, 0.716566861f, -0.68171829f,
+    -0.188148618f, 0.669747889f, -0.718357861f, -0.229044884f, 0.617670715f, -0.752343893f, -0.269586593f, 0.560828924f,
+    -0.782811582f, -0.309016973f, 0.49999997f, -0.809016943f, -0.346611321f, 0.436200261f, -0.830415487f, -0.381741494f,
+    0.370602429f, -0.846715569f, -0.413926959f, 0.304430872f, -0.857896507f, -0.442862689f, 0.23885563f, -0.864187777f,
+    -0.468421519f, 0.174905077f, -0.866019249f, -0.490634441f, 0.113409035f, -0.863953888f, -0.509656966f, 0.0549761541f,
+    -0.858619452f, 0.509656966f, -0.0549761541f, -0.858619452f, 0.490634441f, -0.113409035f, -0.863953888f, 0.468421519f,
+    -0.174905077f, -0.866019249f, 0.442862689f, -0.23885563f, -0.864187777f, 0.413926959f, -0.304430872f, -0.857896507f,
+    0.381741494f, -0.370602429f, -0.846715569f, 0.346611321f, -0.436200261f, -0.830415487f, 0.309016973f, -0.49999997f,
+    -0.809016943f, 0.269586593f, -0.560828924f, -0.782811582f, 0.229044884f, -0.617670715f, -0.752343893f, 0.188148618f,
+    -0.669747889f, -0.718357861f, 0.147620901f, -0.716566861f, -0.68171829f, 0.108097278f, -0.757921994f, -0.643326581f,
+    0.0700906366f, -0.793863237f, -0.604043484f, 0.0339771323f, -0.824642301f, -0.564633131f, -0.509656966f, -0.0549761541f,
+    -0.858619452f, -0.490634441f, -0.113409035f, -0.863953888f, -0.468421519f, -0.174905077f, -0.866019249f, -0.442862689f,
+    -0.23885563f, -0.864187777f, -0.413926959f, -0.304430872f, -0.857896507f, -0.381741494f, -0.370602429f, -0.846715569f,
+    -0.346611321f, -0.436200261f, -0.830415487f, -0.309016973f, -0.49999997f, -0.809016943f, -0.269586593f, -0.560828924f,
+    -0.782811582f, -0.229044884f, -0.617670715f, -0.752343893f, -0.188148618f, -0.669747889f, -0.718357861f, -0.147620901f,
+    -0.716566861f, -0.68171829f, -0.108097278f, -0.757921994f, -0.643326581f, -0.0700906366f, -0.793863237f, -0.604043484f,
+    -0.0339771323f, -0.824642301f, -0.564633131f, 0.0549761541f, -0.858619452f, -0.509656966f, 0.113409035f, -0.863953888f,
+    -0.490634441f, 0.174905077f, -0.866019249f, -0.468421519f, 0.23885563f, -0.864187777f, -0.442862689f, 0.304430872f,
+    -0.857896507f, -0.413926959f, 0.370602429f, -0.846715569f, -0.381741494f, 0.436200261f, -0.830415487f, -0.346611321f,
+    0.49999997f, -0.809016943f, -0.309016973f, 0.560828924f, -0.782811582f, -0.269586593f, 0.617670715f, -0.752343893f,
+    -0.229044884f, 0.669747829f, -0.718357742f, -0.188148603f, 0.716566861f, -0.68171829f, -0.147620901f, 0.757922053f,
+    -0.6433267f, -0.108097285f, 0.793863237f, -0.604043484f, -0.0700906366f, 0.824642301f, -0.564633131f, -0.0339771323f,
+    0.824642301f, -0.564633131f, 0.0339771323f, 0.793863237f, -0.604043484f, 0.0700906366f, 0.757922053f, -0.6433267f,
+    0.108097285f, 0.716566861f, -0.68171829f, 0.147620901f, 0.669747829f, -0.718357742f, 0.188148603f, 0.617670715f,
+    -0.752343893f, 0.229044884f, 0.560828924f, -0.782811582f, 0.269586593f, 0.49999997f, -0.809016943f, 0.309016973f,
+    0.436200261f, -0.830415487f, 0.346611321f, 0.370602429f, -0.846715569f, 0.381741494f, 0.304430872f, -0.857896507f,
+    0.413926959f, 0.23885563f, -0.864187777f, 0.442862689f, 0.174905077f, -0.866019249f, 0.468421519f, 0.113409035f,
+    -0.863953888f, 0.490634441f, 0.0549761541f, -0.858619452f, 0.509656966f, 0.0f, -0.879618466f, -0.475679845f,
+    0.0f, -0.907272279f, -0.42054382f, 0.0f, -0.932827175f, -0.360324293f, 0.0f, -0.955422521f,
+    -0.295241803f, 0.0f, -0.974178791f, -0.225778341f, 0.0f, -0.988273144f, -0.152696595f, 0.0f,
+    -0.997029185f, -0.0770247355f, 0.0f, -0.99999994f, 0.0f, 0.0f, -0.997029185f, 0.0770247355f,
+    0.0f, -0.988273144f, 0.152696595f, 0.0f, -0.974178791f, 0.225778341f, 0.0f, -0.955422521f,
+    0.295241803f, 0.0f, -0.932827175f, 0.360324293f, 0.0f, -0.907272279f, 0.42054382f, 0.0f,
+    -0.879618466f, 0.475679845f, -0.0549761541f, -0.858619452f, 0.509656966f, -0.113409035f, -0.863953888f, 0.490634441f,
+    -0.174905077f, -0.866019249f, 0.468421519f, -0.23885563f, -0.864187777f, 0.442862689f, -0.304430872f, -0.857896507f,
+    0.413926959f, -0.370602429f, -0.846715569f, 0.381741494f, -0.436200261f, -0.830415487f, 0.346611321f, -0.49999997f,
+    -0.809016943f, 0.309016973f, -0.560828924f, -0.782811582f, 0.269586593f, -0.617670715f, -0.752343893f, 0.229044884f,
+    -0.669747829f, -0.718357742f, 0.188148603f, -0.716566861f, -0.68171829f, 0.147620901f, -0.757922053f, -0.6433267f,
+    0.108097285f, -0.793863237f, -0.604043484f, 0.0700906366f, -0.824642301f, -0.564633131f, 0.0339771323f, -0.0549761541f,
+    -0.858619452f, -0.509656966f, -0.113409035f, -0.863953888f, -0.490634441f, -0.174905077f, -0.866019249f, -0.468421519f,
+    -0.23885563f, -0.864187777f, -0.442862689f, -0.304430872f, -0.857896507f, -0.413926959f, -0.370602429f, -0.846715569f,
+    -0.381741494f, -0.436200261f, -0.830415487f, -0.346611321f, -0.49999997f, -0.809016943f, -0.309016973f, -0.560828924f,
+    -0.782811582f, -0.269586593f, -0.617670715f, -0.752343893f, -0.229044884f, -0.669747829f, -0.718357742f, -0.188148603f,
+    -0.716566861f, -0.68171829f, -0.147620901f, -0.757922053f, -0.6433267f, -0.108097285f, -0.793863237f, -0.604043484f,
+    -0.0700906366f, -0.824642301f, -0.564633131f, -0.0339771323f, -0.0339771323f, -0.824642301f, 0.564633131f, -0.0700906366f,
+    -0.793863237f, 0.604043484f, -0.108097278f, -0.757921994f, 0.643326581f, -0.147620901f, -0.716566861f, 0.68171829f,
+    -0.188148618f, -0.669747889f, 0.718357861f, -0.229044884f, -0.617670715f, 0.752343893f, -0.269586593f, -0.560828924f,
+    0.782811582f, -0.309016973f, -0.49999997f, 0.809016943f, -0.346611321f, -0.436200261f, 0.830415487f, -0.381741494f,
+    -0.370602429f, 0.846715569f, -0.413926959f, -0.304430872f, 0.857896507f, -0.442862689f, -0.23885563f, 0.864187777f,
+    -0.468421519f, -0.174905077f, 0.866019249f, -0.490634441f, -0.113409035f, 0.863953888f, -0.509656966f, -0.0549761541f,
+    0.858619452f, -0.858619452f, -0.509656966f, 0.0549761541f, -0.863953888f, -0.490634441f, 0.113409035f, -0.866019249f,
+    -0.468421519f, 0.174905077f, -0.864187777f, -0.442862689f, 0.23885563f, -0.857896507f, -0.413926959f, 0.304430872f,
+    -0.846715569f, -0.381741494f, 0.370602429f, -0.830415487f, -0.346611321f, 0.436200261f, -0.809016943f, -0.309016973f,
+    0.49999997f, -0.782811582f, -0.269586593f, 0.560828924f, -0.752343893f, -0.229044884f, 0.617670715f, -0.718357861f,
+    -0.188148618f, 0.669747889f, -0.68171829f, -0.147620901f, 0.716566861f, -0.643326581f, -0.108097278f, 0.757921994f,
+    -0.604043484f, -0.0700906366f, 0.793863237f, -0.564633131f, -0.0339771323f, 0.824642301f, 0.0339771323f, -0.824642301f,
+    0.564633131f, 0.0700906366f, -0.793863237f, 0.604043484f, 0.108097278f, -0.757921994f, 0.643326581f, 0.147620901f,
+    -0.716566861f, 0.68171829f, 0.188148618f, -0.669747889f, 0.718357861f, 0.229044884f, -0.617670715f, 0.752343893f,
+    0.269586593f, -0.560828924f, 0.782811582f, 0.309016973f, -0.49999997f, 0.809016943f, 0.346611321f, -0.436200261f,
+    0.830415487f, 0.381741494f, -0.370602429f, 0.846715569f, 0.413926959f, -0.304430872f, 0.857896507f, 0.442862689f,
+    -0.23885563f, 0.864187777f, 0.468421519f, -0.174905077f, 0.866019249f, 0.490634441f, -0.113409035f, 0.863953888f,
+    0.509656966f, -0.0549761541f, 0.858619452f, -0.879618466f, 0.475679845f, 0.0f, -0.907272279f, 0.42054382f,
+    0.0f, -0.932827175f, 0.360324293f, 0.0f, -0.955422521f, 0.295241803f, 0.0f, -0.974178791f,
+    0.225778341f, 0.0f, -0.988273144f, 0.152696595f, 0.0f, -0.997029185f, 0.0770247355f, 0.0f,
+    -0.99999994f, 0.0f, 0.0f, -0.997029185f, -0.0770247355f, 0.0f, -0.988273144f, -0.152696595f,
+    0.0f, -0.974178791f, -0.225778341f, 0.0f, -0.955422521f, -0.295241803f, 0.0f, -0.932827175f,
+    -0.360324293f, 0.0f, -0.907272279f, -0.42054382f, 0.0f, -0.879618466f, -0.475679845f, 0.0f,
+    -0.858619452f, 0.509656966f, -0.0549761541f, -0.863953888f, 0.490634441f, -0.113409035f, -0.866019249f, 0.468421519f,
+    -0.174905077f, -0.864187777f, 0.442862689f, -0.23885563f, -0.857896507f, 0.413926959f, -0.304430872f, -0.846715569f,
+    0.381741494f, -0.370602429f, -0.830415487f, 0.346611321f, -0.436200261f, -0.809016943f, 0.309016973f, -0.49999997f,
+    -0.782811582f, 0.269586593f, -0.560828924f, -0.752343893f, 0.229044884f, -0.617670715f, -0.718357861f, 0.188148618f,
+    -0.669747889f, -0.68171829f, 0.147620901f, -0.716566861f, -0.643326581f, 0.108097278f, -0.757921994f, -0.604043484f,
+    0.0700906366f, -0.793863237f, -0.564633131f, 0.0339771323f, -0.824642301f, -0.564633131f, -0.0339771323f, -0.824642301f,
+    -0.604043484f, -0.0700906366f, -0.793863237f, -0.643326581f, -0.108097278f, -0.757921994f, -0.68171829f, -0.147620901f,
+    -0.716566861f, -0.718357861f, -0.188148618f, -0.669747889f, -0.752343893f, -0.229044884f, -0.617670715f, -0.782811582f,
+    -0.269586593f, -0.560828924f, -0.809016943f, -0.309016973f, -0.49999997f, -0.830415487f, -0.346611321f, -0.436200261f,
+    -0.846715569f, -0.381741494f, -0.370602429f, -0.857896507f, -0.413926959f, -0.304430872f, -0.864187777f, -0.442862689f,
+    -0.23885563f, -0.866019249f, -0.468421519f, -0.174905077f, -0.863953888f, -0.490634441f, -0.113409035f, -0.858619452f,
+    -0.509656966f, -0.0549761541f, -0.456712335f, 0.0568443164f, 0.887796462f, -0.398431271f, 0.0586068518f, 0.915323794f,
+    -0.434652299f, 0.117213704f, 0.892937958f, -0.334895045f, 0.0602079555f, 0.940329909f, -0.373140365f, 0.120750763f,
+    0.91988343f, -0.409316182f, 0.180623859f, 0.894335091f, -0.26644361f, 0.0615878291f, 0.961880803f, -0.306287169f,
+    0.123895764f, 0.943842173f, -0.344573081f, 0.185843647f, 0.920180142f, -0.380633712f, 0.246351317f, 0.891307473f,
+    -0.193714559f, 0.0626873523f, 0.979053199f, -0.234579682f, 0.126519307f, 0.963828325f, -0.274516821f, 0.190361813f,
+    0.942551255f, -0.3127729f, 0.253038615f, 0.91550225f, -0.348686218f, 0.313436747f, 0.88327539f, -0.117650069f,
+    0.0634539351f, 0.991025746f, -0.158833161f, 0.128498718f, 0.978907645f, -0.199805617f, 0.193975374f, 0.960443318f,
+    -0.239766747f, 0.258633822f, 0.935745955f, -0.277958035f, 0.321246803f, 0.905284405f, -0.313733548f, 0.380723655f,
+    0.869839609f, -0.0394601934f, 0.0638479367f, 0.99717921f, -0.0801787227f, 0.129731908f, 0.988302052f, -0.121444866f,
+    0.196501926f, 0.9729532f, -0.16245985f, 0.262865543f, 0.95105654f, -0.202408105f, 0.327503204f, 0.922915161f,
+    -0.240536168f, 0.38919571f, 0.889195681f, -0.276221365f, 0.446935564f, 0.850852787f, 0.0394601934f, 0.0638479367f,
+    0.99717921f, 0.0f, 0.130150929f, 0.991494179f, -0.0407496244f, 0.197802827f, 0.979394495f, -0.0820460245f,
+    0.265506506f, 0.960611582f, -0.123069033f, 0.331883132f, 0.935257971f, -0.162998497f, 0.395605654f, 0.903840542f,
+    -0.20109424f, 0.455528229f, 0.867211103f, -0.236761168f, 0.510783494f, 0.826465011f, 0.117650069f, 0.0634539351f,
+    0.991025746f, 0.0801787227f, 0.129731908f, 0.988302052f, 0.0407496244f, 0.197802827f, 0.979394495f, 0.0f,
+    0.266404688f, 0.963861167f, -0.0413019843f, 0.334140062f, 0.941618085f, -0.082323581f, 0.399607062f, 0.912982523f,
+    -0.122248873f, 0.461539954f, 0.878655851f, -0.160357445f, 0.518927634f, 0.839642525f, -0.196083441f, 0.571085453f,
+    0.797127783f, 0.193714559f, 0.0626873523f, 0.979053199f, 0.158833161f, 0.128498718f, 0.978907645f, 0.121444866f,
+    0.196501926f, 0.9729532f, 0.0820460245f, 0.265506506f, 0.960611582f, 0.0413019843f, 0.334140062f, 0.941618085f,
+    0.0f, 0.400968105f, 0.916092038f, -0.041023016f, 0.464636445f, 0.88455081f, -0.080963254f, 0.524005175f,
+    0.847858191f, -0.119124867f, 0.578244269f, 0.807120144f, -0.154971644f, 0.626873493f, 0.763553202f, 0.26644361f,
+    0.0615878291f, 0.961880803f, 0.234579682f, 0.126519307f, 0.963828325f, 0.199805617f, 0.193975374f, 0.960443318f,
+    0.16245985f, 0.262865543f, 0.95105654f, 0.123069033f, 0.331883132f, 0.935257971f, 0.082323581f, 0.399607062f,
+    0.912982523f, 0.041023016f, 0.464636445f, 0.88455081f, 0.0f, 0.525731087f, 0.850650787f, -0.039961122f,
+    0.581926107f, 0.812259316f, -0.078193225f, 0.632596493f, 0.770524025f, -0.114190117f, 0.677466154f, 0.726636231f,
+    0.334895045f, 0.0602079555f, 0.940329909f, 0.306287169f, 0.123895764f, 0.943842173f, 0.274516821f, 0.190361813f,
+    0.942551255f, 0.239766747f, 0.258633822f, 0.935745955f, 0.202408105f, 0.327503204f, 0.922915161f, 0.162998497f,
+    0.395605654f, 0.903840542f, 0.122248873f, 0.461539954f, 0.878655851f, 0.080963254f, 0.524005175f, 0.847858191f,
+    0.039961122f, 0.581926107f, 0.812259316f, 0.0f, 0.634539366f, 0.772890508f, -0.0382858962f, 0.681426704f,
+    0.730884254f, -0.0744211227f, 0.722495437f, 0.687358558f, 0.398431271f, 0.0586068518f, 0.915323794f, 0.373140365f,
+    0.120750763f, 0.91988343f, 0.344573081f, 0.185843647f, 0.920180142f, 0.3127729f, 0.253038615f, 0.91550225f,
+    0.277958035f, 0.321246803f, 0.905284405f, 0.240536168f, 0.38919571f, 0.889195681f, 0.20109424f, 0.455528229f,
+    0.867211103f, 0.160357445f, 0.518927634f, 0.839642525f, 0.119124867f, 0.578244269f, 0.807120144f, 0.078193225f,
+    0.632596493f, 0.770524025f, 0.0382858962f, 0.681426704f, 0.730884254f, 0.0f, 0.72450459f, 0.68926996f,
+    -0.0362210236f, 0.76188904f, 0.646693885f, 0.456712335f, 0.0568443164f, 0.887796462f, 0.434652299f, 0.117213704f,
+    0.892937958f, 0.409316182f, 0.180623859f, 0.894335091f, 0.380633712f, 0.246351317f, 0.891307473f, 0.348686218f,
+    0.313436747f, 0.88327539f, 0.313733548f, 0.380723655f, 0.869839609f, 0.276221365f, 0.446935564f, 0.850852787f,
+    0.236761168f, 0.510783494f, 0.826465011f, 0.196083441f, 0.571085453f, 0.797127783f, 0.154971644f, 0.626873493f,
+    0.763553202f, 0.114190117f, 0.677466154f, 0.726636231f, 0.0744211227f, 0.722495437f, 0.687358558f, 0.0362210236f,
+    0.76188904f, 0.646693885f, 0.0f, 0.795820415f, 0.605532706f, -0.548688352f, 0.0919760317f, 0.830952168f,
+    -0.529480159f, 0.153434724f, 0.834331095f, -0.588087022f, 0.131048903f, 0.798110068f, -0.506734669f, 0.217834428f,
+    0.834127128f, -0.568519235f, 0.19537884f, 0.799132645f, -0.627150595f, 0.17183964f, 0.75970602f, -0.480284959f,
+    0.284414709f, 0.829719722f, -0.545040607f, 0.262415439f, 0.796284378f, -0.60698849f, 0.238753453f, 0.757998526f,
+    -0.66504842f, 0.213841319f, 0.715529501f, -0.450116485f, 0.352179676f, 0.820588052f, -0.51748544f, 0.331231833f,
+    0.788982987f, -0.58252871f, 0.308011889f, 0.752189457f, -0.644004762f, 0.282905757f, 0.71078974f, -0.700865865f,
+    0.256401926f, 0.665616393f, -0.416404188f, 0.419940352f, 0.806385636f, -0.485873312f, 0.400663376f, 0.776785731f,
+    -0.553625464f, 0.37851721f, 0.741770625f, -0.618283927f, 0.353819877f, 0.701809466f, -0.678621411f, 0.327040166f,
+    0.657660842f, -0.73367393f, 0.298754096f, 0.61030221f, -0.379529476f, 0.486395746f, 0.787004828f, -0.450446814f,
+    0.469374448f, 0.759463787f, -0.520354986f, 0.448948115f, 0.72641331f, -0.587785244f, 0.425325394f, 0.688190937f,
+    -0.65135622f, 0.398910046f, 0.645449996f, -0.709910631f, 0.370268077f, 0.599106312f, -0.762617111f, 0.340069294f,
+    0.550243676f, -0.340069294f, 0.550243676f, 0.762617111f, -0.411682844f, 0.535965919f, 0.737060189f, -0.483050197f,
+    0.517854512f, 0.7060377f, -0.552667618f, 0.495975226f, 0.669751525f, -0.619044185f, 0.470621556f, 0.628728449f,
+    -0.680853009f, 0.442300588f, 0.583788812f, -0.737060189f, 0.411682844f, 0.535965919f, -0.787004828f, 0.379529476f,
+    0.486395746f, -0.298754096f, 0.61030221f, 0.73367393f, -0.370268077f, 0.599106312f, 0.709910631f, -0.442300588f,
+    0.583788812f, 0.680853009f, -0.513375461f, 0.564254224f, 0.646577775f, -0.581951976f, 0.54065001f, 0.607478023f,
+    -0.646577775f, 0.513375461f, 0.564254224f, -0.7060377f, 0.483050197f, 0.517854512f, -0.759463787f, 0.450446814f,
+    0.469374448f, -0.806385636f, 0.416404188f, 0.419940352f, -0.256401926f, 0.665616393f, 0.700865865f, -0.327040166f,
+    0.657660842f, 0.678621411f, -0.398910046f, 0.645449996f, 0.65135622f, -0.470621616f, 0.628728509f, 0.619044244f,
+    -0.54065001f, 0.607478023f, 0.581951976f, -0.607478023f, 0.581951976f, 0.54065001f, -0.669751525f, 0.552667618f,
+    0.495975226f, -0.72641331f, 0.520354986f, 0.448948115f, -0.776785731f, 0.485873312f, 0.400663376f, -0.820588052f,
+    0.450116485f, 0.352179676f, -0.213841334f, 0.715529561f, 0.66504848f, -0.282905757f, 0.71078974f, 0.644004762f,
+    -0.353819877f, 0.701809466f, 0.618283927f, -0.425325394f, 0.688190937f, 0.587785244f, -0.495975226f, 0.669751525f,
+    0.552667618f, -0.564254224f, 0.646577775f, 0.513375461f, -0.628728509f, 0.619044244f, 0.470621616f, -0.688190937f,
+    0.587785244f, 0.425325394f, -0.741770625f, 0.553625464f, 0.37851721f, -0.788983047f, 0.517485499f, 0.331231862f,
+    -0.829719722f, 0.480284959f, 0.284414709f, -0.17183964f, 0.75970602f, 0.627150595f, -0.238753453f, 0.757998526f,
+    0.60698849f, -0.308011889f, 0.752189457f, 0.58252871f, -0.37851721f, 0.741770625f, 0.553625464f, -0.448948085f,
+    0.72641325f, 0.520354927f, -0.517854512f, 0.7060377f, 0.483050197f, -0.583788812f, 0.680853009f, 0.442300588f,
+    -0.645449996f, 0.65135622f, 0.398910046f, -0.701809466f, 0.618283927f, 0.353819877f, -0.752189517f, 0.58252877f,
+    0.308011919f, -0.796284378f, 0.545040607f, 0.262415439f, -0.834127128f, 0.506734669f, 0.217834428f, -0.131048918f,
+    0.798110187f, 0.588087082f, -0.19537884f, 0.799132645f, 0.568519235f, -0.262415439f, 0.796284378f, 0.545040607f,
+    -0.331231862f, 0.788983047f, 0.517485499f, -0.400663376f, 0.776785731f, 0.485873312f, -0.469374448f, 0.759463787f,
+    0.450446814f, -0.535965919f, 0.737060189f, 0.411682844f, -0.599106312f, 0.709910631f, 0.370268077f, -0.657660842f,
+    0.678621411f, 0.327040166f, -0.71078974f, 0.644004762f, 0.282905757f, -0.757998526f, 0.60698849f, 0.238753453f,
+    -0.799132645f, 0.568519235f, 0.19537884f, -0.834331095f, 0.529480159f, 0.153434724f, -0.0919760317f, 0.830952168f,
+    0.548688352f, -0.153434724f, 0.834331095f, 0.529480159f, -0.217834428f, 0.834127128f, 0.506734669f, -0.284414709f,
+    0.829719722f, 0.480284959f, -0.352179676f, 0.820588052f, 0.450116485f, -0.419940323f, 0.806385577f, 0.416404128f,
+    -0.486395746f, 0.787004828f, 0.379529476f, -0.550243676f, 0.762617111f, 0.340069294f, -0.61030215f, 0.733673811f,
+    0.298754066f, -0.665616393f, 0.700865865f, 0.256401926f, -0.715529561f, 0.66504848f, 0.213841334f, -0.75970602f,
+    0.627150595f, 0.17183964f, -0.798110068f, 0.588087022f, 0.131048903f, -0.830952168f, 0.548688352f, 0.0919760317f,
+    -0.795820415f, 0.605532706f, 0.0f, -0.76188904f, 0.646693885f, 0.0362210236f, -0.76188904f, 0.646693885f,
+    -0.0362210236f, -0.722495437f, 0.687358558f, 0.0744211227f, -0.72450459f, 0.68926996f, 0.0f, -0.722495437f,
+    0.687358558f, -0.0744211227f, -0.677466154f, 0.726636231f, 0.114190117f, -0.681426704f, 0.730884254f, 0.0382858962f,
+    -0.681426704f, 0.730884254f, -0.0382858962f, -0.677466154f, 0.726636231f, -0.114190117f, -0.626873493f, 0.763553202f,
+    0.154971644f, -0.632596493f, 0.770524025f, 0.078193225f, -0.634539366f, 0.772890508f, 0.0f, -0.632596493f,
+    0.770524025f, -0.078193225f, -0.626873493f, 0.763553202f, -0.154971644f, -0.571085453f, 0.797127783f, 0.196083441f,
+    -0.578244269f, 0.807120144f, 0.119124867f, -0.581926107f, 0.812259316f, 0.039961122f, -0.581926107f, 0.812259316f,
+    -0.039961122f, -0.578244269f, 0.807120144f, -0.119124867f, -0.571085453f, 0.797127783f, -0.196083441f, -0.510783494f,
+    0.826465011f, 0.236761168f, -0.518927634f, 0.839642525f, 0.160357445f, -0.524005115f, 0.847858131f, 0.0809632465f,
+    -0.525731087f, 0.850650787f, 0.0f, -0.524005115f, 0.847858131f, -0.0809632465f, -0.518927634f, 0.839642525f,
+    -0.160357445f, -0.510783494f, 0.826465011f, -0.236761168f, -0.446935564f, 0.850852787f, 0.276221365f, -0.455528229f,
+    0.867211103f, 0.20109424f, -0.461539954f, 0.878655851f, 0.122248873f, -0.464636445f, 0.88455081f, 0.041023016f,
+    -0.464636445f, 0.88455081f, -0.041023016f, -0.461539954f, 0.878655851f, -0.122248873f, -0.455528229f, 0.867211103f,
+    -0.20109424f, -0.446935564f, 0.850852787f, -0.276221365f, -0.380723625f, 0.869839489f, 0.313733518f, -0.38919571f,
+    0.889195681f, 0.240536168f, -0.395605654f, 0.903840542f, 0.162998497f, -0.399607033f, 0.912982404f, 0.0823235735f,
+    -0.400968105f, 0.916092038f, 0.0f, -0.399607033f, 0.912982404f, -0.0823235735f, -0.395605654f, 0.903840542f,
+    -0.162998497f, -0.38919571f, 0.889195681f, -0.240536168f, -0.380723625f, 0.869839489f, -0.313733518f, -0.313436747f,
+    0.88327539f, 0.348686218f, -0.321246803f, 0.905284405f, 0.277958035f, -0.327503204f, 0.922915161f, 0.202408105f,
+    -0.331883162f, 0.935258031f, 0.123069048f, -0.334140062f, 0.941618085f, 0.0413019843f, -0.334140062f, 0.941618085f,
+    -0.0413019843f, -0.331883162f, 0.935258031f, -0.123069048f, -0.327503204f, 0.922915161f, -0.202408105f, -0.321246803f,
+    0.905284405f, -0.277958035f, -0.313436747f, 0.88327539f, -0.348686218f, -0.246351317f, 0.891307473f, 0.380633712f,
+    -0.253038615f, 0.91550225f, 0.3127729f, -0.258633822f, 0.935745955f, 0.239766747f, -0.262865543f, 0.95105654f,
+    0.16245985f, -0.265506506f, 0.960611582f, 0.0820460245f, -0.266404688f, 0.963861167f, 0.0f, -0.265506506f,
+    0.960611582f, -0.0820460245f, -0.262865543f, 0.95105654f, -0.16245985f, -0.258633822f, 0.935745955f, -0.239766747f,
+    -0.253038615f, 0.91550225f, -0.3127729f, -0.246351317f, 0.891307473f, -0.380633712f, -0.180623859f, 0.894335091f,
+    0.409316182f, -0.185843647f, 0.920180142f, 0.344573081f, -0.190361813f, 0.942551255f, 0.274516821f, -0.193975359f,
+    0.960443199f, 0.199805602f, -0.196501926f, 0.9729532f, 0.121444866f, -0.197802827f, 0.979394495f, 0.0407496244f,
+    -0.197802827f, 0.979394495f, -0.0407496244f, -0.196501926f, 0.9729532f, -0.121444866f, -0.193975359f, 0.960443199f,
+    -0.199805602f, -0.190361813f, 0.942551255f, -0.274516821f, -0.185843647f, 0.920180142f, -0.344573081f, -0.180623859f,
+    0.894335091f, -0.409316182f, -0.117213704f, 0.892937958f, 0.434652299f, -0.120750763f, 0.91988343f, 0.373140365f,
+    -0.123895764f, 0.943842173f, 0.306287169f, -0.126519322f, 0.963828444f, 0.234579712f, -0.128498718f, 0.978907645f,
+    0.158833161f, -0.129731908f, 0.988302052f, 0.0801787227f, -0.130150929f, 0.991494179f, 0.0f, -0.129731908f,
+    0.988302052f, -0.0801787227f, -0.128498718f, 0.978907645f, -0.158833161f, -0.126519322f, 0.963828444f, -0.234579712f,
+    -0.123895764f, 0.943842173f, -0.306287169f, -0.120750763f, 0.91988343f, -0.373140365f, -0.117213704f, 0.892937958f,
+    -0.434652299f, -0.0568443164f, 0.887796462f, 0.456712335f, -0.0586068518f, 0.915323794f, 0.398431271f, -0.0602079555f,
+    0.940329909f, 0.334895045f, -0.0615878366f, 0.961880922f, 0.26644364f, -0.0626873523f, 0.979053199f, 0.193714559f,
+    -0.0634539425f, 0.991025865f, 0.117650077f, -0.0638479367f, 0.99717921f, 0.0394601934f, -0.0638479367f, 0.99717921f,
+    -0.0394601934f, -0.0634539425f, 0.991025865f, -0.117650077f, -0.0626873523f, 0.979053199f, -0.193714559f, -0.0615878366f,
+    0.961880922f, -0.26644364f, -0.0602079555f, 0.940329909f, -0.334895045f, -0.0586068518f, 0.915323794f, -0.398431271f,
+    -0.0568443164f, 0.887796462f, -0.456712335f, 0.0568443164f, 0.887796462f, 0.456712335f, 0.117213704f, 0.892937958f,
+    0.434652299f, 0.0586068518f, 0.915323794f, 0.398431271f, 0.180623859f, 0.894335091f, 0.409316182f, 0.120750763f,
+    0.91988343f, 0.373140365f, 0.0602079555f, 0.940329909f, 0.334895045f, 0.246351317f, 0.891307473f, 0.380633712f,
+    0.185843647f, 0.920180142f, 0.344573081f, 0.123895764f, 0.943842173f, 0.306287169f, 0.0615878366f, 0.961880922f,
+    0.26644364f, 0.313436747f, 0.88327539f, 0.348686218f, 0.253038615f, 0.91550225f, 0.3127729f, 0.190361813f,
+    0.942551255f, 0.274516821f, 0.126519322f, 0.963828444f, 0.234579712f, 0.0626873523f, 0.979053199f, 0.193714559f,
+    0.380723625f, 0.869839489f, 0.313733518f, 0.321246803f, 0.905284405f, 0.277958035f, 0.258633822f, 0.935745955f,
+    0.239766747f, 0.193975359f, 0.960443199f, 0.199805602f, 0.128498718f, 0.978907645f, 0.158833161f, 0.0634539425f,
+    0.991025865f, 0.117650077f, 0.446935564f, 0.850852787f, 0.276221365f, 0.38919571f, 0.889195681f, 0.240536168f,
+    0.327503204f, 0.922915161f, 0.202408105f, 0.262865543f, 0.95105654f, 0.16245985f, 0.196501926f, 0.9729532f,
+    0.121444866f, 0.129731908f, 0.988302052f, 0.0801787227f, 0.0638479367f, 0.99717921f, 0.0394601934f, 0.510783494f,
+    0.826465011f, 0.236761168f, 0.455528229f, 0.867211103f, 0.20109424f, 0.395605654f, 0.903840542f, 0.162998497f,
+    0.331883162f, 0.935258031f, 0.123069048f, 0.265506506f, 0.960611582f, 0.0820460245f, 0.197802827f, 0.979394495f,
+    0.0407496244f, 0.130150929f, 0.991494179f, 0.0f, 0.0638479367f, 0.99717921f, -0.0394601934f, 0.571085453f,
+    0.797127783f, 0.196083441f, 0.518927634f, 0.839642525f, 0.160357445f, 0.461539954f, 0.878655851f, 0.122248873f,
+    0.399607033f, 0.912982404f, 0.0823235735f, 0.334140062f, 0.941618085f, 0.0413019843f, 0.266404688f, 0.963861167f,
+    0.0f, 0.197802827f, 0.979394495f, -0.0407496244f, 0.129731908f, 0.988302052f, -0.0801787227f, 0.0634539425f,
+    0.991025865f, -0.117650077f, 0.626873493f, 0.763553202f, 0.154971644f, 0.578244269f, 0.807120144f, 0.119124867f,
+    0.524005115f, 0.847858131f, 0.0809632465f, 0.464636445f, 0.88455081f, 0.041023016f, 0.400968105f, 0.916092038f,
+    0.0f, 0.334140062f, 0.941618085f, -0.0413019843f, 0.265506506f, 0.960611582f, -0.0820460245f, 0.196501926f,
+    0.9729532f, -0.121444866f, 0.128498718f, 0.978907645f, -0.158833161f, 0.0626873523f, 0.979053199f, -0.193714559f,
+    0.677466154f, 0.726636231f, 0.114190117f, 0.632596493f, 0.770524025f, 0.078193225f, 0.581926107f, 0.812259316f,
+    0.039961122f, 0.525731087f, 0.850650787f, 0.0f, 0.464636445f, 0.88455081f, -0.041023016f, 0.399607033f,
+    0.912982404f, -0.0823235735f, 0.331883162f, 0.935258031f, -0.123069048f, 0.262865543f, 0.95105654f, -0.16245985f,
+    0.193975359f, 0.960443199f, -0.199805602f, 0.126519322f, 0.963828444f, -0.234579712f, 0.0615878366f, 0.961880922f,
+    -0.26644364f, 0.722495437f, 0.687358558f, 0.0744211227f, 0.681426704f, 0.730884254f, 0.0382858962f, 0.634539366f,
+    0.772890508f, 0.0f, 0.581926107f, 0.812259316f, -0.039961122f, 0.524005115f, 0.847858131f, -0.0809632465f,
+    0.461539954f, 0.878655851f, -0.122248873f, 0.395605654f, 0.903840542f, -0.162998497f, 0.327503204f, 0.922915161f,
+    -0.202408105f, 0.258633822f, 0.935745955f, -0.239766747f, 0.190361813f, 0.942551255f, -0.274516821f, 0.123895764f,
+    0.943842173f, -0.306287169f, 0.0602079555f, 0.940329909f, -0.334895045f, 0.76188904f, 0.646693885f, 0.0362210236f,
+    0.72450459f, 0.68926996f, 0.0f, 0.681426704f, 0.730884254f, -0.0382858962f, 0.632596493f, 0.770524025f,
+    -0.078193225f, 0.578244269f, 0.807120144f, -0.119124867f, 0.518927634f, 0.839642525f, -0.160357445f, 0.455528229f,
+    0.867211103f, -0.20109424f, 0.38919571f, 0.889195681f, -0.240536168f, 0.321246803f, 0.905284405f, -0.277958035f,
+    0.253038615f, 0.91550225f, -0.3127729f, 0.185843647f, 0.920180142f, -0.344573081f, 0.120750763f, 0.91988343f,
+    -0.373140365f, 0.0586068518f, 0.915323794f, -0.398431271f, 0.795820415f, 0.605532706f, 0.0f, 0.76188904f,
+    0.646693885f, -0.0362210236f, 0.722495437f, 0.687358558f, -0.0744211227f, 0.677466154f, 0.726636231f, -0.114190117f,
+    0.626873493f, 0.763553202f, -0.154971644f, 0.571085453f, 0.797127783f, -0.196083441f, 0.510783494f, 0.826465011f,
+    -0.236761168f, 0.446935564f, 0.850852787f, -0.276221365f, 0.380723625f, 0.869839489f, -0.313733518f, 0.313436747f,
+    0.88327539f, -0.348686218f, 0.246351317f, 0.891307473f, -0.380633712f, 0.180623859f, 0.894335091f, -0.409316182f,
+    0.117213704f, 0.892937958f, -0.434652299f, 0.0568443164f, 0.887796462f, -0.456712335f, 0.0919760317f, 0.830952168f,
+    0.548688352f, 0.131048918f, 0.798110187f, 0.588087082f, 0.153434724f, 0.834331095f, 0.529480159f, 0.17183964f,
+    0.75970602f, 0.627150595f, 0.19537884f, 0.799132645f, 0.568519235f, 0.217834428f, 0.834127128f, 0.506734669f,
+    0.213841334f, 0.715529561f, 0.66504848f, 0.238753453f, 0.757998526f, 0.60698849f, 0.262415439f, 0.796284378f,
+    0.545040607f, 0.284414709f, 0.829719722f, 0.480284959f, 0.256401926f, 0.665616393f, 0.700865865f, 0.282905757f,
+    0.71078974f, 0.644004762f, 0.308011889f, 0.752189457f, 0.58252871f, 0.331231862f, 0.788983047f, 0.517485499f,
+    0.352179676f, 0.820588052f, 0.450116485f, 0.298754096f, 0.61030221f, 0.73367393f, 0.327040166f, 0.657660842f,
+    0.678621411f, 0.353819877f, 0.701809466f, 0.618283927f, 0.37851721f, 0.741770625f, 0.553625464f, 0.400663376f,
+    0.776785731f, 0.485873312f, 0.419940323f, 0.806385577f, 0.416404128f, 0.340069294f, 0.550243676f, 0.762617111f,
+    0.370268077f, 0.599106312f, 0.709910631f, 0.398910046f, 0.645449996f, 0.65135622f, 0.425325394f, 0.688190937f,
+    0.587785244f, 0.448948085f, 0.72641325f, 0.520354927f, 0.469374448f, 0.759463787f, 0.450446814f, 0.486395746f,
+    0.787004828f, 0.379529476f, 0.379529476f, 0.486395746f, 0.787004828f, 0.411682844f, 0.535965919f, 0.737060189f,
+    0.442300588f, 0.583788812f, 0.680853009f, 0.470621616f, 0.628728509f, 0.619044244f, 0.495975226f, 0.669751525f,
+    0.552667618f, 0.517854512f, 0.7060377f, 0.483050197f, 0.535965919f, 0.737060189f, 0.411682844f, 0.550243676f,
+    0.762617111f, 0.340069294f, 0.416404188f, 0.419940352f, 0.806385636f, 0.450446814f, 0.469374448f, 0.759463787f,
+    0.483050197f, 0.517854512f, 0.7060377f, 0.513375461f, 0.564254224f, 0.646577775f, 0.54065001f, 0.607478023f,
+    0.581951976f, 0.564254224f, 0.646577775f, 0.513375461f, 0.583788812f, 0.680853009f, 0.442300588f, 0.599106312f,
+    0.709910631f, 0.370268077f, 0.61030215f, 0.733673811f, 0.298754066f, 0.450116485f, 0.352179676f, 0.820588052f,
+    0.485873312f, 0.400663376f, 0.776785731f, 0.520354986f, 0.448948115f, 0.72641331f, 0.552667618f, 0.495975226f,
+    0.669751525f, 0.581951976f, 0.54065001f, 0.607478023f, 0.607478023f, 0.581951976f, 0.54065001f, 0.628728509f,
+    0.619044244f, 0.470621616f, 0.645449996f, 0.65135622f, 0.398910046f, 0.657660842f, 0.678621411f, 0.327040166f,
+    0.665616393f, 0.700865865f, 0.256401926f, 0.480284959f, 0.284414709f, 0.829719722f, 0.51748544f, 0.331231833f,
+    0.788982987f, 0.553625464f, 0.37851721f, 0.741770625f, 0.587785244f, 0.425325394f, 0.688190937f, 0.619044185f,
+    0.470621556f, 0.628728449f, 0.646577775f, 0.513375461f, 0.564254224f, 0.669751525f, 0.552667618f, 0.495975226f,
+    0.688190937f, 0.587785244f, 0.425325394f, 0.701809466f, 0.618283927f, 0.353819877f, 0.71078974f, 0.644004762f,
+    0.282905757f, 0.715529561f, 0.66504848f, 0.213841334f, 0.506734669f, 0.217834428f, 0.834127128f, 0.545040607f,
+    0.262415439f, 0.796284378f, 0.58252871f, 0.308011889f, 0.752189457f, 0.618283927f, 0.353819877f, 0.701809466f,
+    0.65135622f, 0.398910046f, 0.645449996f, 0.680853009f, 0.442300588f, 0.583788812f, 0.7060377f, 0.483050197f,
+    0.517854512f, 0.72641331f, 0.520354986f, 0.448948115f, 0.741770625f, 0.553625464f, 0.37851721f, 0.752189517f,
+    0.58252877f, 0.308011919f, 0.757998526f, 0.60698849f, 0.238753453f, 0.75970602f, 0.627150595f, 0.17183964f,
+    0.529480159f, 0.153434724f, 0.834331095f, 0.568519235f, 0.19537884f, 0.799132645f, 0.60698849f, 0.238753453f,
+    0.757998526f, 0.644004762f, 0.282905757f, 0.71078974f, 0.678621411f, 0.327040166f, 0.657660842f, 0.709910631f,
+    0.370268077f, 0.599106312f, 0.737060189f, 0.411682844f, 0.535965919f, 0.759463787f, 0.450446814f, 0.469374448f,
+    0.776785731f, 0.485873312f, 0.400663376f, 0.788983047f, 0.517485499f, 0.331231862f, 0.796284378f, 0.545040607f,
+    0.262415439f, 0.799132645f, 0.568519235f, 0.19537884f, 0.798110068f, 0.588087022f, 0.131048903f, 0.548688352f,
+    0.0919760317f, 0.830952168f, 0.588087022f, 0.131048903f, 0.798110068f, 0.627150595f, 0.17183964f, 0.75970602f,
+    0.66504842f, 0.213841319f, 0.715529501f, 0.700865865f, 0.256401926f, 0.665616393f, 0.73367393f, 0.298754096f,
+    0.61030221f, 0.762617111f, 0.340069294f, 0.550243676f, 0.787004828f, 0.379529476f, 0.486395746f, 0.806385636f,
+    0.416404188f, 0.419940352f, 0.820588052f, 0.450116485f, 0.352179676f, 0.829719722f, 0.480284959f, 0.284414709f,
+    0.834127128f, 0.506734669f, 0.217834428f, 0.834331095f, 0.529480159f, 0.153434724f, 0.830952168f, 0.548688352f,
+    0.0919760317f, 0.887796462f, 0.456712335f, 0.0568443164f, 0.892937958f, 0.434652299f, 0.117213704f, 0.915323794f,
+    0.398431271f, 0.0586068518f, 0.894335091f, 0.409316182f, 0.180623859f, 0.91988343f, 0.373140365f, 0.120750763f,
+    0.940329909f, 0.334895045f, 0.0602079555f, 0.891307473f, 0.380633712f, 0.246351317f, 0.920180142f, 0.344573081f,
+    0.185843647f, 0.943842173f, 0.306287169f, 0.123895764f, 0.961880922f, 0.26644364f, 0.0615878366f, 0.88327539f,
+    0.348686218f, 0.313436747f, 0.91550225f, 0.3127729f, 0.253038615f, 0.942551255f, 0.274516821f, 0.190361813f,
+    0.963828444f, 0.234579712f, 0.126519322f, 0.979053199f, 0.193714559f, 0.0626873523f, 0.869839609f, 0.313733548f,
+    0.380723655f, 0.905284405f, 0.277958035f, 0.321246803f, 0.935745955f, 0.239766747f, 0.258633822f, 0.960443199f,
+    0.199805602f, 0.193975359f, 0.978907645f, 0.158833161f, 0.128498718f, 0.991025865f, 0.117650077f, 0.0634539425f,
+    0.850852787f, 0.276221365f, 0.446935564f, 0.8891958f, 0.240536198f, 0.38919574f, 0.922915161f, 0.202408105f,
+    0.327503204f, 0.95105654f, 0.16245985f, 0.262865543f, 0.9729532f, 0.121444866f, 0.196501926f, 0.988302052f,
+    0.0801787227f, 0.129731908f, 0.99717921f, 0.0394601934f, 0.0638479367f, 0.826465011f, 0.236761168f, 0.510783494f,
+    0.867211103f, 0.20109424f, 0.455528229f, 0.903840542f, 0.162998497f, 0.395605654f, 0.935258031f, 0.123069048f,
+    0.331883162f, 0.960611582f, 0.0820460245f, 0.265506506f, 0.979394495f, 0.0407496244f, 0.197802827f, 0.991494179f,
+    0.0f, 0.130150929f, 0.99717921f, -0.0394601934f, 0.0638479367f, 0.797127783f, 0.196083441f, 0.571085453f,
+    0.839642525f, 0.160357445f, 0.518927634f, 0.878655851f, 0.122248873f, 0.461539954f, 0.912982523f, 0.082323581f,
+    0.399607062f, 0.941618085f, 0.0413019843f, 0.334140062f, 0.963861167f, 0.0f, 0.266404688f, 0.979394495f,
+    -0.0407496244f, 0.197802827f, 0.988302052f, -0.0801787227f, 0.129731908f, 0.991025865f, -0.117650077f, 0.0634539425f,
+    0.763553202f, 0.154971644f, 0.626873493f, 0.807120144f, 0.119124867f, 0.578244269f, 0.847858131f, 0.0809632465f,
+    0.524005115f, 0.88455081f, 0.041023016f, 0.464636445f, 0.916092038f, 0.0f, 0.400968105f, 0.941618085f,
+    -0.0413019843f, 0.334140062f, 0.960611582f, -0.0820460245f, 0.265506506f, 0.9729532f, -0.121444866f, 0.196501926f,
+    0.978907645f, -0.158833161f, 0.128498718f, 0.979053199f, -0.193714559f, 0.0626873523f, 0.726636231f, 0.114190117f,
+    0.677466154f, 0.770524025f, 0.078193225f, 0.632596493f, 0.812259316f, 0.039961122f, 0.581926107f, 0.850650787f,
+    0.0f, 0.525731087f, 0.88455081f, -0.041023016f, 0.464636445f, 0.912982523f, -0.082323581f, 0.399607062f,
+    0.935258031f, -0.123069048f, 0.331883162f, 0.95105654f, -0.16245985f, 0.262865543f, 0.960443199f, -0.199805602f,
+    0.193975359f, 0.963828444f, -0.234579712f, 0.126519322f, 0.961880922f, -0.26644364f, 0.0615878366f, 0.687358558f,
+    0.0744211227f, 0.722495437f, 0.730884254f, 0.0382858962f, 0.681426704f, 0.772890508f, 0.0f, 0.634539366f,
+    0.812259316f, -0.039961122f, 0.581926107f, 0.847858131f, -0.0809632465f, 0.524005115f, 0.878655851f, -0.122248873f,
+    0.461539954f, 0.903840542f, -0.162998497f, 0.395605654f, 0.922915161f, -0.202408105f, 0.327503204f, 0.935745955f,
+    -0.239766747f, 0.258633822f, 0.942551255f, -0.274516821f, 0.190361813f, 0.943842173f, -0.306287169f, 0.123895764f,
+    0.940329909f, -0.334895045f, 0.0602079555f, 0.646693885f, 0.0362210236f, 0.76188904f, 0.68926996f, 0.0f,
+    0.72450459f, 0.730884254f, -0.0382858962f, 0.681426704f, 0.770524025f, -0.078193225f, 0.632596493f, 0.807120144f,
+    -0.119124867f, 0.578244269f, 0.839642525f, -0.160357445f, 0.518927634f, 0.867211103f, -0.20109424f, 0.455528229f,
+    0.8891958f, -0.240536198f, 0.38919574f, 0.905284405f, -0.277958035f, 0.321246803f, 0.91550225f, -0.3127729f,
+    0.253038615f, 0.920180142f, -0.344573081f, 0.185843647f, 0.91988343f, -0.373140365f, 0.120750763f, 0.915323794f,
+    -0.398431271f, 0.0586068518f, 0.605532706f, 0.0f, 0.795820415f, 0.646693885f, -0.0362210236f, 0.76188904f,
+    0.687358558f, -0.0744211227f, 0.722495437f, 0.726636231f, -0.114190117f, 0.677466154f, 0.763553202f, -0.154971644f,
+    0.626873493f, 0.797127783f, -0.196083441f, 0.571085453f, 0.826465011f, -0.236761168f, 0.510783494f, 0.850852787f,
+    -0.276221365f, 0.446935564f, 0.869839609f, -0.313733548f, 0.380723655f, 0.88327539f, -0.348686218f, 0.313436747f,
+    0.891307473f, -0.380633712f, 0.246351317f, 0.894335091f, -0.409316182f, 0.180623859f, 0.892937958f, -0.434652299f,
+    0.117213704f, 0.887796462f, -0.456712335f, 0.0568443164f, 0.887796462f, 0.456712335f, -0.0568443164f, 0.915323794f,
+    0.398431271f, -0.0586068518f, 0.892937958f, 0.434652299f, -0.117213704f, 0.940329909f, 0.334895045f, -0.0602079555f,
+    0.91988343f, 0.373140365f, -0.120750763f, 0.894335091f, 0.409316182f, -0.180623859f, 0.961880922f, 0.26644364f,
+    -0.0615878366f, 0.943842173f, 0.306287169f, -0.123895764f, 0.920180142f, 0.344573081f, -0.185843647f, 0.891307473f,
+    0.380633712f, -0.246351317f, 0.979053199f, 0.193714559f, -0.0626873523f, 0.963828444f, 0.234579712f, -0.126519322f,
+    0.942551255f, 0.274516821f, -0.190361813f, 0.91550225f, 0.3127729f, -0.253038615f, 0.88327539f, 0.348686218f,
+    -0.313436747f, 0.991025865f, 0.117650077f, -0.0634539425f, 0.978907645f, 0.158833161f, -0.128498718f, 0.960443199f,
+    0.199805602f, -0.193975359f, 0.935745955f, 0.239766747f, -0.258633822f, 0.905284405f, 0.277958035f, -0.321246803f,
+    0.869839609f, 0.313733548f, -0.380723655f, 0.99717921f, 0.0394601934f, -0.0638479367f, 0.988302052f, 0.0801787227f,
+    -0.129731908f, 0.9729532f, 0.121444866f, -0.196501926f, 0.95105654f, 0.16245985f, -0.262865543f, 0.922915161f,
+    0.202408105f, -0.327503204f, 0.8891958f, 0.240536198f, -0.38919574f, 0.850852787f, 0.276221365f, -0.446935564f,
+    0.99717921f, -0.0394601934f, -0.0638479367f, 0.991494179f, 0.0f, -0.130150929f, 0.979394495f, 0.0407496244f,
+    -0.197802827f, 0.960611582f, 0.0820460245f, -0.265506506f, 0.935258031f, 0.123069048f, -0.331883162f, 0.903840542f,
+    0.162998497f, -0.395605654f, 0.867211103f, 0.20109424f, -0.455528229f, 0.826465011f, 0.236761168f, -0.510783494f,
+    0.991025865f, -0.117650077f, -0.0634539425f, 0.988302052f, -0.0801787227f, -0.129731908f, 0.979394495f, -0.0407496244f,
+    -0.197802827f, 0.963861167f, 0.0f, -0.266404688f, 0.941618085f, 0.0413019843f, -0.334140062f, 0.912982523f,
+    0.082323581f, -0.399607062f, 0.878655851f, 0.122248873f, -0.461539954f, 0.839642525f, 0.160357445f, -0.518927634f,
+    0.797127783f, 0.196083441f, -0.571085453f, 0.979053199f, -0.193714559f, -0.0626873523f, 0.978907645f, -0.158833161f,
+    -0.128498718f, 0.9729532f, -0.121444866f, -0.196501926f, 0.960611582f, -0.0820460245f, -0.265506506f, 0.941618085f,
+    -0.0413019843f, -0.334140062f, 0.916092038f, 0.0f, -0.400968105f, 0.88455081f, 0.041023016f, -0.464636445f,
+    0.847858131f, 0.0809632465f, -0.524005115f, 0.807120144f, 0.119124867f, -0.578244269f, 0.763553202f, 0.154971644f,
+    -0.626873493f, 0.961880922f, -0.26644364f, -0.0615878366f, 0.963828444f, -0.234579712f, -0.126519322f, 0.960443199f,
+    -0.199805602f, -0.193975359f, 0.95105654f, -0.16245985f, -0.262865543f, 0.935258031f, -0.123069048f, -0.331883162f,
+    0.912982523f, -0.082323581f, -0.399607062f, 0.88455081f, -0.041023016f, -0.464636445f, 0.850650787f, 0.0f,
+    -0.525731087f, 0.812259316f, 0.039961122f, -0.581926107f, 0.770524025f, 0.078193225f, -0.632596493f, 0.726636231f,
+    0.114190117f, -0.677466154f, 0.940329909f, -0.334895045f, -0.0602079555f, 0.943842173f, -0.306287169f, -0.123895764f,
+    0.942551255f, -0.274516821f, -0.190361813f, 0.935745955f, -0.239766747f, -0.258633822f, 0.922915161f, -0.202408105f,
+    -0.327503204f, 0.903840542f, -0.162998497f, -0.395605654f, 0.878655851f, -0.122248873f, -0.461539954f, 0.847858131f,
+    -0.0809632465f, -0.524005115f, 0.812259316f, -0.039961122f, -0.581926107f, 0.772890508f, 0.0f, -0.634539366f,
+    0.730884254f, 0.0382858962f, -0.681426704f, 0.687358558f, 0.0744211227f, -0.722495437f, 0.915323794f, -0.398431271f,
+    -0.0586068518f, 0.91988343f, -0.373140365f, -0.120750763f, 0.920180142f, -0.344573081f, -0.185843647f, 0.91550225f,
+    -0.3127729f, -0.253038615f, 0.905284405f, -0.277958035f, -0.321246803f, 0.8891958f, -0.240536198f, -0.38919574f,
+    0.867211103f, -0.20109424f, -0.455528229f, 0.839642525f, -0.160357445f, -0.518927634f, 0.807120144f, -0.119124867f,
+    -0.578244269f, 0.770524025f, -0.078193225f, -0.632596493f, 0.730884254f, -0.0382858962f, -0.681426704f, 0.68926996f,
+    0.0f, -0.72450459f, 0.646693885f, 0.0362210236f, -0.76188904f, 0.887796462f, -0.456712335f, -0.0568443164f,
+    0.892937958f, -0.434652299f, -0.117213704f, 0.894335091f, -0.409316182f, -0.180623859f, 0.891307473f, -0.380633712f,
+    -0.246351317f, 0.88327539f, -0.348686218f, -0.313436747f, 0.869839609f, -0.313733548f, -0.380723655f, 0.850852787f,
+    -0.276221365f, -0.446935564f, 0.826465011f, -0.236761168f, -0.510783494f, 0.797127783f, -0.196083441f, -0.571085453f,
+    0.763553202f, -0.154971644f, -0.626873493f, 0.726636231f, -0.114190117f, -0.677466154f, 0.687358558f, -0.0744211227f,
+    -0.722495437f, 0.646693885f, -0.0362210236f, -0.76188904f, 0.605532706f, 0.0f, -0.795820415f, 0.0919760317f,
+    0.830952168f, -0.548688352f, 0.153434724f, 0.834331095f, -0.529480159f, 0.131048918f, 0.798110187f, -0.588087082f,
+    0.217834428f, 0.834127128f, -0.506734669f, 0.19537884f, 0.799132645f, -0.568519235f, 0.17183964f, 0.75970602f,
+    -0.627150595f, 0.284414709f, 0.829719722f, -0.480284959f, 0.262415439f, 0.796284378f, -0.545040607f, 0.238753453f,
+    0.757998526f, -0.60698849f, 0.213841334f, 0.715529561f, -0.66504848f, 0.352179676f, 0.820588052f, -0.450116485f,
+    0.331231862f, 0.788983047f, -0.517485499f, 0.308011889f, 0.752189457f, -0.58252871f, 0.282905757f, 0.71078974f,
+    -0.644004762f, 0.256401926f, 0.665616393f, -0.700865865f, 0.419940323f, 0.806385577f, -0.416404128f, 0.400663376f,
+    0.776785731f, -0.485873312f, 0.37851721f, 0.741770625f, -0.553625464f, 0.353819877f, 0.701809466f, -0.618283927f,
+    0.327040166f, 0.657660842f, -0.678621411f, 0.298754096f, 0.61030221f, -0.73367393f, 0.486395746f, 0.787004828f,
+    -0.379529476f, 0.469374448f, 0.759463787f, -0.450446814f, 0.448948085f, 0.72641325f, -0.520354927f, 0.425325394f,
+    0.688190937f, -0.587785244f, 0.398910046f, 0.645449996f, -0.65135622f, 0.370268077f, 0.599106312f, -0.709910631f,
+    0.340069294f, 0.550243676f, -0.762617111f, 0.550243676f, 0.762617111f, -0.340069294f, 0.535965919f, 0.737060189f,
+    -0.411682844f, 0.517854512f, 0.7060377f, -0.483050197f, 0.495975226f, 0.669751525f, -0.552667618f, 0.470621616f,
+    0.628728509f, -0.619044244f, 0.442300588f, 0.583788812f, -0.680853009f, 0.411682844f, 0.535965919f, -0.737060189f,
+    0.379529476f, 0.486395746f, -0.787004828f, 0.61030215f, 0.733673811f, -0.298754066f, 0.599106312f, 0.709910631f,
+    -0.370268077f, 0.583788812f, 0.680853009f, -0.442300588f, 0.564254224f, 0.646577775f, -0.513375461f, 0.54065001f,
+    0.607478023f, -0.581951976f, 0.513375461f, 0.564254224f, -0.646577775f, 0.483050197f, 0.517854512f, -0.7060377f,
+    0.450446814f, 0.469374448f, -0.759463787f, 0.416404188f, 0.419940352f, -0.806385636f, 0.665616393f, 0.700865865f,
+    -0.256401926f, 0.657660842f, 0.678621411f, -0.327040166f, 0.645449996f, 0.65135622f, -0.398910046f, 0.628728509f,
+    0.619044244f, -0.470621616f, 0.607478023f, 0.581951976f, -0.54065001f, 0.581951976f, 0.54065001f, -0.607478023f,
+    0.552667618f, 0.495975226f, -0.669751525f, 0.520354986f, 0.448948115f, -0.72641331f, 0.485873312f, 0.400663376f,
+    -0.776785731f, 0.450116485f, 0.352179676f, -0.820588052f, 0.715529561f, 0.66504848f, -0.213841334f, 0.71078974f,
+    0.644004762f, -0.282905757f, 0.701809466f, 0.618283927f, -0.353819877f, 0.688190937f, 0.587785244f, -0.425325394f,
+    0.669751525f, 0.552667618f, -0.495975226f, 0.646577775f, 0.513375461f, -0.564254224f, 0.619044185f, 0.470621556f,
+    -0.628728449f, 0.587785244f, 0.425325394f, -0.688190937f, 0.553625464f, 0.37851721f, -0.741770625f, 0.51748544f,
+    0.331231833f, -0.788982987f, 0.480284959f, 0.284414709f, -0.829719722f, 0.75970602f, 0.627150595f, -0.17183964f,
+    0.757998526f, 0.60698849f, -0.238753453f, 0.752189517f, 0.58252877f, -0.308011919f, 0.741770625f, 0.553625464f,
+    -0.37851721f, 0.72641331f, 0.520354986f, -0.448948115f, 0.7060377f, 0.483050197f, -0.517854512f, 0.680853009f,
+    0.442300588f, -0.583788812f, 0.65135622f, 0.398910046f, -0.645449996f, 0.618283927f, 0.353819877f, -0.701809466f,
+    0.58252871f, 0.308011889f, -0.752189457f, 0.545040607f, 0.262415439f, -0.796284378f, 0.506734669f, 0.217834428f,
+    -0.834127128f, 0.798110068f, 0.588087022f, -0.131048903f, 0.799132645f, 0.568519235f, -0.19537884f, 0.796284378f,
+    0.545040607f, -0.262415439f, 0.788983047f, 0.517485499f, -0.331231862f, 0.776785731f, 0.485873312f, -0.400663376f,
+    0.759463787f, 0.450446814f, -0.469374448f, 0.737060189f, 0.411682844f, -0.535965919f, 0.709910631f, 0.370268077f,
+    -0.599106312f, 0.678621411f, 0.327040166f, -0.657660842f, 0.644004762f, 0.282905757f, -0.71078974f, 0.60698849f,
+    0.238753453f, -0.757998526f, 0.568519235f, 0.19537884f, -0.799132645f, 0.529480159f, 0.153434724f, -0.834331095f,
+    0.830952168f, 0.548688352f, -0.0919760317f, 0.834331095f, 0.529480159f, -0.153434724f, 0.834127128f, 0.506734669f,
+    -0.217834428f, 0.829719722f, 0.480284959f, -0.284414709f, 0.820588052f, 0.450116485f, -0.352179676f, 0.806385636f,
+    0.416404188f, -0.419940352f, 0.787004828f, 0.379529476f, -0.486395746f, 0.762617111f, 0.340069294f, -0.550243676f,
+    0.73367393f, 0.298754096f, -0.61030221f, 0.700865865f, 0.256401926f, -0.665616393f, 0.66504842f, 0.213841319f,
+    -0.715529501f, 0.627150595f, 0.17183964f, -0.75970602f, 0.588087022f, 0.131048903f, -0.798110068f, 0.548688352f,
+    0.0919760317f, -0.830952168f, 0.0f, 0.795820415f, -0.605532706f, 0.0362210236f, 0.76188904f, -0.646693885f,
+    -0.0362210236f, 0.76188904f, -0.646693885f, 0.0744211227f, 0.722495437f, -0.687358558f, 0.0f, 0.72450459f,
+    -0.68926996f, -0.0744211227f, 0.722495437f, -0.687358558f, 0.114190117f, 0.677466154f, -0.726636231f, 0.0382858962f,
+    0.681426704f, -0.730884254f, -0.0382858962f, 0.681426704f, -0.730884254f, -0.114190117f, 0.677466154f, -0.726636231f,
+    0.154971644f, 0.626873493f, -0.763553202f, 0.078193225f, 0.632596493f, -0.770524025f, 0.0f, 0.634539366f,
+    -0.772890508f, -0.078193225f, 0.632596493f, -0.770524025f, -0.154971644f, 0.626873493f, -0.763553202f, 0.196083441f,
+    0.571085453f, -0.797127783f, 0.119124867f, 0.578244269f, -0.807120144f, 0.039961122f, 0.581926107f, -0.812259316f,
+    -0.039961122f, 0.581926107f, -0.812259316f, -0.119124867f, 0.578244269f, -0.807120144f, -0.196083441f, 0.571085453f,
+    -0.797127783f, 0.236761168f, 0.510783494f, -0.826465011f, 0.160357445f, 0.518927634f, -0.839642525f, 0.080963254f,
+    0.524005175f, -0.847858191f, 0.0f, 0.525731087f, -0.850650787f, -0.080963254f, 0.524005175f, -0.847858191f,
+    -0.160357445f, 0.518927634f, -0.839642525f, -0.236761168f, 0.510783494f, -0.826465011f, 0.276221365f, 0.446935564f,
+    -0.850852787f, 0.20109424f, 0.455528229f, -0.867211103f, 0.122248873f, 0.461539954f, -0.878655851f, 0.041023016f,
+    0.464636445f, -0.88455081f, -0.041023016f, 0.464636445f, -0.88455081f, -0.122248873f, 0.461539954f, -0.878655851f,
+    -0.20109424f, 0.455528229f, -0.867211103f, -0.276221365f, 0.446935564f, -0.850852787f, 0.313733548f, 0.380723655f,
+    -0.869839609f, 0.240536168f, 0.38919571f, -0.889195681f, 0.162998497f, 0.395605654f, -0.903840542f, 0.082323581f,
+    0.399607062f, -0.912982523f, 0.0f, 0.400968105f, -0.916092038f, -0.082323581f, 0.399607062f, -0.912982523f,
+    -0.162998497f, 0.395605654f, -0.903840542f, -0.240536168f, 0.38919571f, -0.889195681f, -0.313733548f, 0.380723655f,
+    -0.869839609f, 0.348686218f, 0.313436747f, -0.88327539f, 0.277958035f, 0.321246803f, -0.905284405f, 0.202408105f,
+    0.327503204f, -0.922915161f, 0.123069033f, 0.331883132f, -0.935257971f, 0.0413019843f, 0.334140062f, -0.941618085f,
+    -0.0413019843f, 0.334140062f, -0.941618085f, -0.123069033f, 0.331883132f, -0.935257971f, -0.202408105f, 0.327503204f,
+    -0.922915161f, -0.277958035f, 0.321246803f, -0.905284405f, -0.348686218f, 0.313436747f, -0.88327539f, 0.380633712f,
+    0.246351317f, -0.891307473f, 0.3127729f, 0.253038615f, -0.91550225f, 0.239766747f, 0.258633822f, -0.935745955f,
+    0.16245985f, 0.262865543f, -0.95105654f, 0.0820460245f, 0.265506506f, -0.960611582f, 0.0f, 0.266404688f,
+    -0.963861167f, -0.0820460245f, 0.265506506f, -0.960611582f, -0.16245985f, 0.262865543f, -0.95105654f, -0.239766747f,
+    0.258633822f, -0.935745955f, -0.3127729f, 0.253038615f, -0.91550225f, -0.380633712f, 0.246351317f, -0.891307473f,
+    0.409316182f, 0.180623859f, -0.894335091f, 0.344573081f, 0.185843647f, -0.920180142f, 0.274516821f, 0.190361813f,
+    -0.942551255f, 0.199805617f, 0.193975374f, -0.960443318f, 0.121444866f, 0.196501926f, -0.9729532f, 0.0407496244f,
+    0.197802827f, -0.979394495f, -0.0407496244f, 0.197802827f, -0.979394495f, -0.121444866f, 0.196501926f, -0.9729532f,
+    -0.199805617f, 0.193975374f, -0.960443318f, -0.274516821f, 0.190361813f, -0.942551255f, -0.344573081f, 0.185843647f,
+    -0.920180142f, -0.409316182f, 0.180623859f, -0.894335091f, 0.434652299f, 0.117213704f, -0.892937958f, 0.373140365f,
+    0.120750763f, -0.91988343f, 0.306287169f, 0.123895764f, -0.943842173f, 0.234579682f, 0.126519307f, -0.963828325f,
+    0.158833161f, 0.128498718f, -0.978907645f, 0.0801787227f, 0.129731908f, -0.988302052f, 0.0f, 0.130150929f,
+    -0.991494179f, -0.0801787227f, 0.129731908f, -0.988302052f, -0.158833161f, 0.128498718f, -0.978907645f, -0.234579682f,
+    0.126519307f, -0.963828325f, -0.306287169f, 0.123895764f, -0.943842173f, -0.373140365f, 0.120750763f, -0.91988343f,
+    -0.434652299f, 0.117213704f, -0.892937958f, 0.456712335f, 0.0568443164f, -0.887796462f, 0.398431271f, 0.0586068518f,
+    -0.915323794f, 0.334895045f, 0.0602079555f, -0.940329909f, 0.26644361f, 0.0615878291f, -0.961880803f, 0.193714559f,
+    0.0626873523f, -0.979053199f, 0.117650069f, 0.0634539351f, -0.991025746f, 0.0394601934f, 0.0638479367f, -0.99717921f,
+    -0.0394601934f, 0.0638479367f, -0.99717921f, -0.117650069f, 0.0634539351f, -0.991025746f, -0.193714559f, 0.0626873523f,
+    -0.979053199f, -0.26644361f, 0.0615878291f, -0.961880803f, -0.334895045f, 0.0602079555f, -0.940329909f, -0.398431271f,
+    0.0586068518f, -0.915323794f, -0.456712335f, 0.0568443164f, -0.887796462f, -0.456712335f, -0.0568443164f, -0.887796462f,
+    -0.398431271f, -0.0586068518f, -0.915323794f, -0.434652299f, -0.117213704f, -0.892937958f, -0.334895045f, -0.0602079555f,
+    -0.940329909f, -0.373140365f, -0.120750763f, -0.91988343f, -0.409316182f, -0.180623859f, -0.894335091f, -0.26644361f,
+    -0.0615878291f, -0.961880803f, -0.306287169f, -0.123895764f, -0.943842173f, -0.344573081f, -0.185843647f, -0.920180142f,
+    -0.380633712f, -0.246351317f, -0.891307473f, -0.193714559f, -0.0626873523f, -0.979053199f, -0.234579682f, -0.126519307f,
+    -0.963828325f, -0.274516821f, -0.190361813f, -0.942551255f, -0.3127729f, -0.253038615f, -0.91550225f, -0.348686218f,
+    -0.313436747f, -0.88327539f, -0.117650069f, -0.0634539351f, -0.991025746f, -0.158833161f, -0.128498718f, -0.978907645f,
+    -0.199805617f, -0.193975374f, -0.960443318f, -0.239766747f, -0.258633822f, -0.935745955f, -0.277958035f, -0.321246803f,
+    -0.905284405f, -0.313733548f, -0.380723655f, -0.869839609f, -0.0394601934f, -0.0638479367f, -0.99717921f, -0.0801787227f,
+    -0.129731908f, -0.988302052f, -0.121444866f, -0.196501926f, -0.9729532f, -0.16245985f, -0.262865543f, -0.95105654f,
+    -0.202408105f, -0.327503204f, -0.922915161f, -0.240536168f, -0.38919571f, -0.889195681f, -0.276221365f, -0.446935564f,
+    -0.850852787f, 0.0394601934f, -0.0638479367f, -0.99717921f, 0.0f, -0.130150929f, -0.991494179f, -0.0407496244f,
+    -0.197802827f, -0.979394495f, -0.0820460245f, -0.265506506f, -0.960611582f, -0.123069033f, -0.331883132f, -0.935257971f,
+    -0.162998497f, -0.395605654f, -0.903840542f, -0.20109424f, -0.455528229f, -0.867211103f, -0.236761168f, -0.510783494f,
+    -0.826465011f, 0.117650069f, -0.0634539351f, -0.991025746f, 0.0801787227f, -0.129731908f, -0.988302052f, 0.0407496244f,
+    -0.197802827f, -0.979394495f, 0.0f, -0.266404688f, -0.963861167f, -0.0413019843f, -0.334140062f, -0.941618085f,
+    -0.082323581f, -0.399607062f, -0.912982523f, -0.122248873f, -0.461539954f, -0.878655851f, -0.160357445f, -0.518927634f,
+    -0.839642525f, -0.196083441f, -0.571085453f, -0.797127783f, 0.193714559f, -0.0626873523f, -0.979053199f, 0.158833161f,
+    -0.128498718f, -0.978907645f, 0.121444866f, -0.196501926f, -0.9729532f, 0.0820460245f, -0.265506506f, -0.960611582f,
+    0.0413019843f, -0.334140062f, -0.941618085f, 0.0f, -0.400968105f, -0.916092038f, -0.041023016f, -0.464636445f,
+    -0.88455081f, -0.080963254f, -0.524005175f, -0.847858191f, -0.119124867f, -0.578244269f, -0.807120144f, -0.154971644f,
+    -0.626873493f, -0.763553202f, 0.26644361f, -0.0615878291f, -0.961880803f, 0.234579682f, -0.126519307f, -0.963828325f,
+    0.199805617f, -0.193975374f, -0.960443318f, 0.16245985f, -0.262865543f, -0.95105654f, 0.123069033f, -0.331883132f,
+    -0.935257971f, 0.082323581f, -0.399607062f, -0.912982523f, 0.041023016f, -0.464636445f, -0.88455081f, 0.0f,
+    -0.525731087f, -0.850650787f, -0.039961122f, -0.581926107f, -0.812259316f, -0.078193225f, -0.632596493f, -0.770524025f,
+    -0.114190117f, -0.677466154f, -0.726636231f, 0.334895045f, -0.0602079555f, -0.940329909f, 0.306287169f, -0.123895764f,
+    -0.943842173f, 0.274516821f, -0.190361813f, -0.942551255f, 0.239766747f, -0.258633822f, -0.935745955f, 0.202408105f,
+    -0.327503204f, -0.922915161f, 0.162998497f, -0.395605654f, -0.903840542f, 0.122248873f, -0.461539954f, -0.878655851f,
+    0.080963254f, -0.524005175f, -0.847858191f, 0.039961122f, -0.581926107f, -0.812259316f, 0.0f, -0.634539366f,
+    -0.772890508f, -0.0382858962f, -0.681426704f, -0.730884254f, -0.0744211227f, -0.722495437f, -0.687358558f, 0.398431271f,
+    -0.0586068518f, -0.915323794f, 0.373140365f, -0.120750763f, -0.91988343f, 0.344573081f, -0.185843647f, -0.920180142f,
+    0.3127729f, -0.253038615f, -0.91550225f, 0.277958035f, -0.321246803f, -0.905284405f, 0.240536168f, -0.38919571f,
+    -0.889195681f, 0.20109424f, -0.455528229f, -0.867211103f, 0.160357445f, -0.518927634f, -0.839642525f, 0.119124867f,
+    -0.578244269f, -0.807120144f, 0.078193225f, -0.632596493f, -0.770524025f, 0.0382858962f, -0.681426704f, -0.730884254f,
+    0.0f, -0.72450459f, -0.68926996f, -0.0362210236f, -0.76188904f, -0.646693885f, 0.456712335f, -0.0568443164f,
+    -0.887796462f, 0.434652299f, -0.117213704f, -0.892937958f, 0.409316182f, -0.180623859f, -0.894335091f, 0.380633712f,
+    -0.246351317f, -0.891307473f, 0.348686218f, -0.313436747f, -0.88327539f, 0.313733548f, -0.380723655f, -0.869839609f,
+    0.276221365f, -0.446935564f, -0.850852787f, 0.236761168f, -0.510783494f, -0.826465011f, 0.196083441f, -0.571085453f,
+    -0.797127783f, 0.154971644f, -0.626873493f, -0.763553202f, 0.114190117f, -0.677466154f, -0.726636231f, 0.0744211227f,
+    -0.722495437f, -0.687358558f, 0.0362210236f, -0.76188904f, -0.646693885f, 0.0f, -0.795820415f, -0.605532706f,
+    0.0919760317f, -0.830952168f, -0.548688352f, 0.131048918f, -0.798110187f, -0.588087082f, 0.153434724f, -0.834331095f,
+    -0.529480159f, 0.17183964f, -0.75970602f, -0.627150595f, 0.19537884f, -0.799132645f, -0.568519235f, 0.217834428f,
+    -0.834127128f, -0.506734669f, 0.213841334f, -0.715529561f, -0.66504848f, 0.238753453f, -0.757998526f, -0.60698849f,
+    0.262415439f, -0.796284378f, -0.545040607f, 0.284414709f, -0.829719722f, -0.480284959f, 0.256401926f, -0.665616393f,
+    -0.700865865f, 0.282905757f, -0.71078974f, -0.644004762f, 0.308011889f, -0.752189457f, -0.58252871f, 0.331231862f,
+    -0.788983047f, -0.517485499f, 0.352179676f, -0.820588052f, -0.450116485f, 0.298754096f, -0.61030221f, -0.73367393f,
+    0.327040166f, -0.657660842f, -0.678621411f, 0.353819877f, -0.701809466f, -0.618283927f, 0.37851721f, -0.741770625f,
+    -0.553625464f, 0.400663376f, -0.776785731f, -0.485873312f, 0.419940323f, -0.806385577f, -0.416404128f, 0.340069294f,
+    -0.550243676f, -0.762617111f, 0.370268077f, -0.599106312f, -0.709910631f, 0.398910046f, -0.645449996f, -0.65135622f,
+    0.425325394f, -0.688190937f, -0.587785244f, 0.448948085f, -0.72641325f, -0.520354927f, 0.469374448f, -0.759463787f,
+    -0.450446814f, 0.486395746f, -0.787004828f, -0.379529476f, 0.379529476f, -0.486395746f, -0.787004828f, 0.411682844f,
+    -0.535965919f, -0.737060189f, 0.442300588f, -0.583788812f, -0.680853009f, 0.470621616f, -0.628728509f, -0.619044244f,
+    0.495975226f, -0.669751525f, -0.552667618f, 0.517854512f, -0.7060377f, -0.483050197f, 0.535965919f, -0.737060189f,
+    -0.411682844f, 0.550243676f, -0.762617111f, -0.340069294f, 0.416404188f, -0.419940352f, -0.806385636f, 0.450446814f,
+    -0.469374448f, -0.759463787f, 0.483050197f, -0.517854512f, -0.7060377f, 0.513375461f, -0.564254224f, -0.646577775f,
+    0.54065001f, -0.607478023f, -0.581951976f, 0.564254224f, -0.646577775f, -0.513375461f, 0.583788812f, -0.680853009f,
+    -0.442300588f, 0.599106312f, -0.709910631f, -0.370268077f, 0.61030215f, -0.733673811f, -0.298754066f, 0.450116485f,
+    -0.352179676f, -0.820588052f, 0.485873312f, -0.400663376f, -0.776785731f, 0.520354986f, -0.448948115f, -0.72641331f,
+    0.552667618f, -0.495975226f, -0.669751525f, 0.581951976f, -0.54065001f, -0.607478023f, 0.607478023f, -0.581951976f,
+    -0.54065001f, 0.628728509f, -0.619044244f, -0.470621616f, 0.645449996f, -0.65135622f, -0.398910046f, 0.657660842f,
+    -0.678621411f, -0.327040166f, 0.665616393f, -0.700865865f, -0.256401926f, 0.480284959f, -0.284414709f, -0.829719722f,
+    0.51748544f, -0.331231833f, -0.788982987f, 0.553625464f, -0.37851721f, -0.741770625f, 0.587785244f, -0.425325394f,
+    -0.688190937f, 0.619044185f, -0.470621556f, -0.628728449f, 0.646577775f, -0.513375461f, -0.564254224f, 0.669751525f,
+    -0.552667618f, -0.495975226f, 0.688190937f, -0.587785244f, -0.425325394f, 0.701809466f, -0.618283927f, -0.353819877f,
+    0.71078974f, -0.644004762f, -0.282905757f, 0.715529561f, -0.66504848f, -0.213841334f, 0.506734669f, -0.217834428f,
+    -0.834127128f, 0.545040607f, -0.262415439f, -0.796284378f, 0.58252871f, -0.308011889f, -0.752189457f, 0.618283927f,
+    -0.353819877f, -0.701809466f, 0.65135622f, -0.398910046f, -0.645449996f, 0.680853009f, -0.442300588f, -0.583788812f,
+    0.7060377f, -0.483050197f, -0.517854512f, 0.72641331f, -0.520354986f, -0.448948115f, 0.741770625f, -0.553625464f,
+    -0.37851721f, 0.752189517f, -0.58252877f, -0.308011919f, 0.757998526f, -0.60698849f, -0.238753453f, 0.75970602f,
+    -0.627150595f, -0.17183964f, 0.529480159f, -0.153434724f, -0.834331095f, 0.568519235f, -0.19537884f, -0.799132645f,
+    0.60698849f, -0.238753453f, -0.757998526f, 0.644004762f, -0.282905757f, -0.71078974f, 0.678621411f, -0.327040166f,
+    -0.657660842f, 0.709910631f, -0.370268077f, -0.599106312f, 0.737060189f, -0.411682844f, -0.535965919f, 0.759463787f,
+    -0.450446814f, -0.469374448f, 0.776785731f, -0.485873312f, -0.400663376f, 0.788983047f, -0.517485499f, -0.331231862f,
+    0.796284378f, -0.545040607f, -0.262415439f, 0.799132645f, -0.568519235f, -0.19537884f, 0.798110068f, -0.588087022f,
+    -0.131048903f, 0.548688352f, -0.0919760317f, -0.830952168f, 0.588087022f, -0.131048903f, -0.798110068f, 0.627150595f,
+    -0.17183964f, -0.75970602f, 0.66504842f, -0.213841319f, -0.715529501f, 0.700865865f, -0.256401926f, -0.665616393f,
+    0.73367393f, -0.298754096f, -0.61030221f, 0.762617111f, -0.340069294f, -0.550243676f, 0.787004828f, -0.379529476f,
+    -0.486395746f, 0.806385636f, -0.416404188f, -0.419940352f, 0.820588052f, -0.450116485f, -0.352179676f, 0.829719722f,
+    -0.480284959f, -0.284414709f, 0.834127128f, -0.506734669f, -0.217834428f, 0.834331095f, -0.529480159f, -0.153434724f,
+    0.830952168f, -0.548688352f, -0.0919760317f, 0.0568443164f, -0.887796462f, -0.456712335f, 0.117213704f, -0.892937958f,
+    -0.434652299f, 0.0586068518f, -0.915323794f, -0.398431271f, 0.180623859f, -0.894335091f, -0.409316182f, 0.120750763f,
+    -0.91988343f, -0.373140365f, 0.0602079555f, -0.940329909f, -0.334895045f, 0.246351317f, -0.891307473f, -0.380633712f,
+    0.185843647f, -0.920180142f, -0.344573081f, 0.123895764f, -0.943842173f, -0.306287169f, 0.0615878366f, -0.961880922f,
+    -0.26644364f, 0.313436747f, -0.88327539f, -0.348686218f, 0.253038615f, -0.91550225f, -0.3127729f, 0.190361813f,
+    -0.942551255f, -0.274516821f, 0.126519322f, -0.963828444f, -0.234579712f, 0.0626873523f, -0.979053199f, -0.193714559f,
+    0.380723625f, -0.869839489f, -0.313733518f, 0.321246803f, -0.905284405f, -0.277958035f, 0.258633822f, -0.935745955f,
+    -0.239766747f, 0.193975359f, -0.960443199f, -0.199805602f, 0.128498718f, -0.978907645f, -0.158833161f, 0.0634539425f,
+    -0.991025865f, -0.117650077f, 0.446935564f, -0.850852787f, -0.276221365f, 0.38919571f, -0.889195681f, -0.240536168f,
+    0.327503204f, -0.922915161f, -0.202408105f, 0.262865543f, -0.95105654f, -0.16245985f, 0.196501926f, -0.9729532f,
+    -0.121444866f, 0.129731908f, -0.988302052f, -0.0801787227f, 0.0638479367f, -0.99717921f, -0.0394601934f, 0.510783494f,
+    -0.826465011f, -0.236761168f, 0.455528229f, -0.867211103f, -0.20109424f, 0.395605654f, -0.903840542f, -0.162998497f,
+    0.331883162f, -0.935258031f, -0.123069048f, 0.265506506f, -0.960611582f, -0.0820460245f, 0.197802827f, -0.979394495f,
+    -0.0407496244f, 0.130150929f, -0.991494179f, 0.0f, 0.0638479367f, -0.99717921f, 0.0394601934f, 0.571085453f,
+    -0.797127783f, -0.196083441f, 0.518927634f, -0.839642525f, -0.160357445f, 0.461539954f, -0.878655851f, -0.122248873f,
+    0.399607033f, -0.912982404f, -0.0823235735f, 0.334140062f, -0.941618085f, -0.0413019843f, 0.266404688f, -0.963861167f,
+    0.0f, 0.197802827f, -0.979394495f, 0.0407496244f, 0.129731908f, -0.988302052f, 0.0801787227f, 0.0634539425f,
+    -0.991025865f, 0.117650077f, 0.626873493f, -0.763553202f, -0.154971644f, 0.578244269f, -0.807120144f, -0.119124867f,
+    0.524005115f, -0.847858131f, -0.0809632465f, 0.464636445f, -0.88455081f, -0.041023016f, 0.400968105f, -0.916092038f,
+    0.0f, 0.334140062f, -0.941618085f, 0.0413019843f, 0.265506506f, -0.960611582f, 0.0820460245f, 0.196501926f,
+    -0.9729532f, 0.121444866f, 0.128498718f, -0.978907645f, 0.158833161f, 0.0626873523f, -0.979053199f, 0.193714559f,
+    0.677466154f, -0.726636231f, -0.114190117f, 0.632596493f, -0.770524025f, -0.078193225f, 0.581926107f, -0.812259316f,
+    -0.039961122f, 0.525731087f, -0.850650787f, 0.0f, 0.464636445f, -0.88455081f, 0.041023016f, 0.399607033f,
+    -0.912982404f, 0.0823235735f, 0.331883162f, -0.935258031f, 0.123069048f, 0.262865543f, -0.95105654f, 0.16245985f,
+    0.193975359f, -0.960443199f, 0.199805602f, 0.126519322f, -0.963828444f, 0.234579712f, 0.0615878366f, -0.961880922f,
+    0.26644364f, 0.722495437f, -0.687358558f, -0.0744211227f, 0.681426704f, -0.730884254f, -0.0382858962f, 0.634539366f,
+    -0.772890508f, 0.0f, 0.581926107f, -0.812259316f, 0.039961122f, 0.524005115f, -0.847858131f, 0.0809632465f,
+    0.461539954f, -0.878655851f, 0.122248873f, 0.395605654f, -0.903840542f, 0.162998497f, 0.327503204f, -0.922915161f,
+    0.202408105f, 0.258633822f, -0.935745955f, 0.239766747f, 0.190361813f, -0.942551255f, 0.274516821f, 0.123895764f,
+    -0.943842173f, 0.306287169f, 0.0602079555f, -0.940329909f, 0.334895045f, 0.76188904f, -0.646693885f, -0.0362210236f,
+    0.72450459f, -0.68926996f, 0.0f, 0.681426704f, -0.730884254f, 0.0382858962f, 0.632596493f, -0.770524025f,
+    0.078193225f, 0.578244269f, -0.807120144f, 0.119124867f, 0.518927634f, -0.839642525f, 0.160357445f, 0.455528229f,
+    -0.867211103f, 0.20109424f, 0.38919571f, -0.889195681f, 0.240536168f, 0.321246803f, -0.905284405f, 0.277958035f,
+    0.253038615f, -0.91550225f, 0.3127729f, 0.185843647f, -0.920180142f, 0.344573081f, 0.120750763f, -0.91988343f,
+    0.373140365f, 0.0586068518f, -0.915323794f, 0.398431271f, 0.795820415f, -0.605532706f, 0.0f, 0.76188904f,
+    -0.646693885f, 0.0362210236f, 0.722495437f, -0.687358558f, 0.0744211227f, 0.677466154f, -0.726636231f, 0.114190117f,
+    0.626873493f, -0.763553202f, 0.154971644f, 0.571085453f, -0.797127783f, 0.196083441f, 0.510783494f, -0.826465011f,
+    0.236761168f, 0.446935564f, -0.850852787f, 0.276221365f, 0.380723625f, -0.869839489f, 0.313733518f, 0.313436747f,
+    -0.88327539f, 0.348686218f, 0.246351317f, -0.891307473f, 0.380633712f, 0.180623859f, -0.894335091f, 0.409316182f,
+    0.117213704f, -0.892937958f, 0.434652299f, 0.0568443164f, -0.887796462f, 0.456712335f, -0.0568443164f, -0.887796462f,
+    -0.456712335f, -0.0586068518f, -0.915323794f, -0.398431271f, -0.117213704f, -0.892937958f, -0.434652299f, -0.0602079555f,
+    -0.940329909f, -0.334895045f, -0.120750763f, -0.91988343f, -0.373140365f, -0.180623859f, -0.894335091f, -0.409316182f,
+    -0.0615878366f, -0.961880922f, -0.26644364f, -0.123895764f, -0.943842173f, -0.306287169f, -0.185843647f, -0.920180142f,
+    -0.344573081f, -0.246351317f, -0.891307473f, -0.380633712f, -0.0626873523f, -0.979053199f, -0.193714559f, -0.126519322f,
+    -0.963828444f, -0.234579712f, -0.190361813f, -0.942551255f, -0.274516821f, -0.253038615f, -0.91550225f, -0.3127729f,
+    -0.313436747f, -0.88327539f, -0.348686218f, -0.0634539425f, -0.991025865f, -0.117650077f, -0.128498718f, -0.978907645f,
+    -0.158833161f, -0.193975359f, -0.960443199f, -0.199805602f, -0.258633822f, -0.935745955f, -0.239766747f, -0.321246803f,
+    -0.905284405f, -0.277958035f, -0.380723625f, -0.869839489f, -0.313733518f, -0.0638479367f, -0.99717921f, -0.0394601934f,
+    -0.129731908f, -0.988302052f, -0.0801787227f, -0.196501926f, -0.9729532f, -0.121444866f, -0.262865543f, -0.95105654f,
+    -0.16245985f, -0.327503204f, -0.922915161f, -0.202408105f, -0.38919571f, -0.889195681f, -0.240536168f, -0.446935564f,
+    -0.850852787f, -0.276221365f, -0.0638479367f, -0.99717921f, 0.0394601934f, -0.130150929f, -0.991494179f, 0.0f,
+    -0.197802827f, -0.979394495f, -0.0407496244f, -0.265506506f, -0.960611582f, -0.0820460245f, -0.331883162f, -0.935258031f,
+    -0.123069048f, -0.395605654f, -0.903840542f, -0.162998497f, -0.455528229f, -0.867211103f, -0.20109424f, -0.510783494f,
+    -0.826465011f, -0.236761168f, -0.0634539425f, -0.991025865f, 0.117650077f, -0.129731908f, -0.988302052f, 0.0801787227f,
+    -0.197802827f, -0.979394495f, 0.0407496244f, -0.266404688f, -0.963861167f, 0.0f, -0.334140062f, -0.941618085f,
+    -0.0413019843f, -0.399607033f, -0.912982404f, -0.0823235735f, -0.461539954f, -0.878655851f, -0.122248873f, -0.518927634f,
+    -0.839642525f, -0.160357445f, -0.571085453f, -0.797127783f, -0.196083441f, -0.0626873523f, -0.979053199f, 0.193714559f,
+    -0.128498718f, -0.978907645f, 0.158833161f, -0.196501926f, -0.9729532f, 0.121444866f, -0.265506506f, -0.960611582f,
+    0.0820460245f, -0.334140062f, -0.941618085f, 0.0413019843f, -0.400968105f, -0.916092038f, 0.0f, -0.464636445f,
+    -0.88455081f, -0.041023016f, -0.524005115f, -0.847858131f, -0.0809632465f, -0.578244269f, -0.807120144f, -0.119124867f,
+    -0.626873493f, -0.763553202f, -0.154971644f, -0.0615878366f, -0.961880922f, 0.26644364f, -0.126519322f, -0.963828444f,
+    0.234579712f, -0.193975359f, -0.960443199f, 0.199805602f, -0.262865543f, -0.95105654f, 0.16245985f, -0.331883162f,
+    -0.935258031f, 0.123069048f, -0.399607033f, -0.912982404f, 0.0823235735f, -0.464636445f, -0.88455081f, 0.041023016f,
+    -0.525731087f, -0.850650787f, 0.0f, -0.581926107f, -0.812259316f, -0.039961122f, -0.632596493f, -0.770524025f,
+    -0.078193225f, -0.677466154f, -0.726636231f, -0.114190117f, -0.0602079555f, -0.940329909f, 0.334895045f, -0.123895764f,
+    -0.943842173f, 0.306287169f, -0.190361813f, -0.942551255f, 0.274516821f, -0.258633822f, -0.935745955f, 0.239766747f,
+    -0.327503204f, -0.922915161f, 0.202408105f, -0.395605654f, -0.903840542f, 0.162998497f, -0.461539954f, -0.878655851f,
+    0.122248873f, -0.524005115f, -0.847858131f, 0.0809632465f, -0.581926107f, -0.812259316f, 0.039961122f, -0.634539366f,
+    -0.772890508f, 0.0f, -0.681426704f, -0.730884254f, -0.0382858962f, -0.722495437f, -0.687358558f, -0.0744211227f,
+    -0.0586068518f, -0.915323794f, 0.398431271f, -0.120750763f, -0.91988343f, 0.373140365f, -0.185843647f, -0.920180142f,
+    0.344573081f, -0.253038615f, -0.91550225f, 0.3127729f, -0.321246803f, -0.905284405f, 0.277958035f, -0.38919571f,
+    -0.889195681f, 0.240536168f, -0.455528229f, -0.867211103f, 0.20109424f, -0.518927634f, -0.839642525f, 0.160357445f,
+    -0.578244269f, -0.807120144f, 0.119124867f, -0.632596493f, -0.770524025f, 0.078193225f, -0.681426704f, -0.730884254f,
+    0.0382858962f, -0.72450459f, -0.68926996f, 0.0f, -0.76188904f, -0.646693885f, -0.0362210236f, -0.0568443164f,
+    -0.887796462f, 0.456712335f, -0.117213704f, -0.892937958f, 0.434652299f, -0.180623859f, -0.894335091f, 0.409316182f,
+    -0.246351317f, -0.891307473f, 0.380633712f, -0.313436747f, -0.88327539f, 0.348686218f, -0.380723625f, -0.869839489f,
+    0.313733518f, -0.446935564f, -0.850852787f, 0.276221365f, -0.510783494f, -0.826465011f, 0.236761168f, -0.571085453f,
+    -0.797127783f, 0.196083441f, -0.626873493f, -0.763553202f, 0.154971644f, -0.677466154f, -0.726636231f, 0.114190117f,
+    -0.722495437f, -0.687358558f, 0.0744211227f, -0.76188904f, -0.646693885f, 0.0362210236f, -0.795820415f, -0.605532706f,
+    0.0f, -0.830952168f, -0.548688352f, 0.0919760317f, -0.798110068f, -0.588087022f, 0.131048903f, -0.834331095f,
+    -0.529480159f, 0.153434724f, -0.75970602f, -0.627150595f, 0.17183964f, -0.799132645f, -0.568519235f, 0.19537884f,
+    -0.834127128f, -0.506734669f, 0.217834428f, -0.715529561f, -0.66504848f, 0.213841334f, -0.757998526f, -0.60698849f,
+    0.238753453f, -0.796284378f, -0.545040607f, 0.262415439f, -0.829719722f, -0.480284959f, 0.284414709f, -0.665616393f,
+    -0.700865865f, 0.256401926f, -0.71078974f, -0.644004762f, 0.282905757f, -0.752189517f, -0.58252877f, 0.308011919f,
+    -0.788983047f, -0.517485499f, 0.331231862f, -0.820588052f, -0.450116485f, 0.352179676f, -0.61030215f, -0.733673811f,
+    0.298754066f, -0.657660842f, -0.678621411f, 0.327040166f, -0.701809466f, -0.618283927f, 0.353819877f, -0.741770625f,
+    -0.553625464f, 0.37851721f, -0.776785731f, -0.485873312f, 0.400663376f, -0.806385636f, -0.416404188f, 0.419940352f,
+    -0.550243676f, -0.762617111f, 0.340069294f, -0.599106312f, -0.709910631f, 0.370268077f, -0.645449996f, -0.65135622f,
+    0.398910046f, -0.688190937f, -0.587785244f, 0.425325394f, -0.72641331f, -0.520354986f, 0.448948115f, -0.759463787f,
+    -0.450446814f, 0.469374448f, -0.787004828f, -0.379529476f, 0.486395746f, -0.486395746f, -0.787004828f, 0.379529476f,
+    -0.535965919f, -0.737060189f, 0.411682844f, -0.583788812f, -0.680853009f, 0.442300588f, -0.628728509f, -0.619044244f,
+    0.470621616f, -0.669751525f, -0.552667618f, 0.495975226f, -0.7060377f, -0.483050197f, 0.517854512f, -0.737060189f,
+    -0.411682844f, 0.535965919f, -0.762617111f, -0.340069294f, 0.550243676f, -0.419940323f, -0.806385577f, 0.416404128f,
+    -0.469374448f, -0.759463787f, 0.450446814f, -0.517854512f, -0.7060377f, 0.483050197f, -0.564254224f, -0.646577775f,
+    0.513375461f, -0.607478023f, -0.581951976f, 0.54065001f, -0.646577775f, -0.513375461f, 0.564254224f, -0.680853009f,
+    -0.442300588f, 0.583788812f, -0.709910631f, -0.370268077f, 0.599106312f, -0.73367393f, -0.298754096f, 0.61030221f,
+    -0.352179676f, -0.820588052f, 0.450116485f, -0.400663376f, -0.776785731f, 0.485873312f, -0.448948085f, -0.72641325f,
+    0.520354927f, -0.495975226f, -0.669751525f, 0.552667618f, -0.54065001f, -0.607478023f, 0.581951976f, -0.581951976f,
+    -0.54065001f, 0.607478023f, -0.619044185f, -0.470621556f, 0.628728449f, -0.65135622f, -0.398910046f, 0.645449996f,
+    -0.678621411f, -0.327040166f, 0.657660842f, -0.700865865f, -0.256401926f, 0.665616393f, -0.284414709f, -0.829719722f,
+    0.480284959f, -0.331231862f, -0.788983047f, 0.517485499f, -0.37851721f, -0.741770625f, 0.553625464f, -0.425325394f,
+    -0.688190937f, 0.587785244f, -0.470621616f, -0.628728509f, 0.619044244f, -0.513375461f, -0.564254224f, 0.646577775f,
+    -0.552667618f, -0.495975226f, 0.669751525f, -0.587785244f, -0.425325394f, 0.688190937f, -0.618283927f, -0.353819877f,
+    0.701809466f, -0.644004762f, -0.282905757f, 0.71078974f, -0.66504842f, -0.213841319f, 0.715529501f, -0.217834428f,
+    -0.834127128f, 0.506734669f, -0.262415439f, -0.796284378f, 0.545040607f, -0.308011889f, -0.752189457f, 0.58252871f,
+    -0.353819877f, -0.701809466f, 0.618283927f, -0.398910046f, -0.645449996f, 0.65135622f, -0.442300588f, -0.583788812f,
+    0.680853009f, -0.483050197f, -0.517854512f, 0.7060377f, -0.520354986f, -0.448948115f, 0.72641331f, -0.553625464f,
+    -0.37851721f, 0.741770625f, -0.58252871f, -0.308011889f, 0.752189457f, -0.60698849f, -0.238753453f, 0.757998526f,
+    -0.627150595f, -0.17183964f, 0.75970602f, -0.153434724f, -0.834331095f, 0.529480159f, -0.19537884f, -0.799132645f,
+    0.568519235f, -0.238753453f, -0.757998526f, 0.60698849f, -0.282905757f, -0.71078974f, 0.644004762f, -0.327040166f,
+    -0.657660842f, 0.678621411f, -0.370268077f, -0.599106312f, 0.709910631f, -0.411682844f, -0.535965919f, 0.737060189f,
+    -0.450446814f, -0.469374448f, 0.759463787f, -0.485873312f, -0.400663376f, 0.776785731f, -0.51748544f, -0.331231833f,
+    0.788982987f, -0.545040607f, -0.262415439f, 0.796284378f, -0.568519235f, -0.19537884f, 0.799132645f, -0.588087022f,
+    -0.131048903f, 0.798110068f, -0.0919760317f, -0.830952168f, 0.548688352f, -0.131048918f, -0.798110187f, 0.588087082f,
+    -0.17183964f, -0.75970602f, 0.627150595f, -0.213841334f, -0.715529561f, 0.66504848f, -0.256401926f, -0.665616393f,
+    0.700865865f, -0.298754096f, -0.61030221f, 0.73367393f, -0.340069294f, -0.550243676f, 0.762617111f, -0.379529476f,
+    -0.486395746f, 0.787004828f, -0.416404188f, -0.419940352f, 0.806385636f, -0.450116485f, -0.352179676f, 0.820588052f,
+    -0.480284959f, -0.284414709f, 0.829719722f, -0.506734669f, -0.217834428f, 0.834127128f, -0.529480159f, -0.153434724f,
+    0.834331095f, -0.548688352f, -0.0919760317f, 0.830952168f, -0.456712335f, -0.0568443164f, 0.887796462f, -0.434652299f,
+    -0.117213704f, 0.892937958f, -0.398431271f, -0.0586068518f, 0.915323794f, -0.409316182f, -0.180623859f, 0.894335091f,
+    -0.373140365f, -0.120750763f, 0.91988343f, -0.334895045f, -0.0602079555f, 0.940329909f, -0.380633712f, -0.246351317f,
+    0.891307473f, -0.344573081f, -0.185843647f, 0.920180142f, -0.306287169f, -0.123895764f, 0.943842173f, -0.26644361f,
+    -0.0615878291f, 0.961880803f, -0.348686218f, -0.313436747f, 0.88327539f, -0.3127729f, -0.253038615f, 0.91550225f,
+    -0.274516821f, -0.190361813f, 0.942551255f, -0.234579682f, -0.126519307f, 0.963828325f, -0.193714559f, -0.0626873523f,
+    0.979053199f, -0.313733548f, -0.380723655f, 0.869839609f, -0.277958035f, -0.321246803f, 0.905284405f, -0.239766747f,
+    -0.258633822f, 0.935745955f, -0.199805617f, -0.193975374f, 0.960443318f, -0.158833161f, -0.128498718f, 0.978907645f,
+    -0.117650069f, -0.0634539351f, 0.991025746f, -0.276221365f, -0.446935564f, 0.850852787f, -0.240536168f, -0.38919571f,
+    0.889195681f, -0.202408105f, -0.327503204f, 0.922915161f, -0.16245985f, -0.262865543f, 0.95105654f, -0.121444866f,
+    -0.196501926f, 0.9729532f, -0.0801787227f, -0.129731908f, 0.988302052f, -0.0394601934f, -0.0638479367f, 0.99717921f,
+    -0.236761168f, -0.510783494f, 0.826465011f, -0.20109424f, -0.455528229f, 0.867211103f, -0.162998497f, -0.395605654f,
+    0.903840542f, -0.123069033f, -0.331883132f, 0.935257971f, -0.0820460245f, -0.265506506f, 0.960611582f, -0.0407496244f,
+    -0.197802827f, 0.979394495f, 0.0f, -0.130150929f, 0.991494179f, 0.0394601934f, -0.0638479367f, 0.99717921f,
+    -0.196083441f, -0.571085453f, 0.797127783f, -0.160357445f, -0.518927634f, 0.839642525f, -0.122248873f, -0.461539954f,
+    0.878655851f, -0.082323581f, -0.399607062f, 0.912982523f, -0.0413019843f, -0.334140062f, 0.941618085f, 0.0f,
+    -0.266404688f, 0.963861167f, 0.0407496244f, -0.197802827f, 0.979394495f, 0.0801787227f, -0.129731908f, 0.988302052f,
+    0.117650069f, -0.0634539351f, 0.991025746f, -0.154971644f, -0.626873493f, 0.763553202f, -0.119124867f, -0.578244269f,
+    0.807120144f, -0.080963254f, -0.524005175f, 0.847858191f, -0.041023016f, -0.464636445f, 0.88455081f, 0.0f,
+    -0.400968105f, 0.916092038f, 0.0413019843f, -0.334140062f, 0.941618085f, 0.0820460245f, -0.265506506f, 0.960611582f,
+    0.121444866f, -0.196501926f, 0.9729532f, 0.158833161f, -0.128498718f, 0.978907645f, 0.193714559f, -0.0626873523f,
+    0.979053199f, -0.114190117f, -0.677466154f, 0.726636231f, -0.078193225f, -0.632596493f, 0.770524025f, -0.039961122f,
+    -0.581926107f, 0.812259316f, 0.0f, -0.525731087f, 0.850650787f, 0.041023016f, -0.464636445f, 0.88455081f,
+    0.082323581f, -0.399607062f, 0.912982523f, 0.123069033f, -0.331883132f, 0.935257971f, 0.16245985f, -0.262865543f,
+    0.95105654f, 0.199805617f, -0.193975374f, 0.960443318f, 0.234579682f, -0.126519307f, 0.963828325f, 0.26644361f,
+    -0.0615878291f, 0.961880803f, -0.0744211227f, -0.722495437f, 0.687358558f, -0.0382858962f, -0.681426704f, 0.730884254f,
+    0.0f, -0.634539366f, 0.772890508f, 0.039961122f, -0.581926107f, 0.812259316f, 0.080963254f, -0.524005175f,
+    0.847858191f, 0.122248873f, -0.461539954f, 0.878655851f, 0.162998497f, -0.395605654f, 0.903840542f, 0.202408105f,
+    -0.327503204f, 0.922915161f, 0.239766747f, -0.258633822f, 0.935745955f, 0.274516821f, -0.190361813f, 0.942551255f,
+    0.306287169f, -0.123895764f, 0.943842173f, 0.334895045f, -0.0602079555f, 0.940329909f, -0.0362210236f, -0.76188904f,
+    0.646693885f, 0.0f, -0.72450459f, 0.68926996f, 0.0382858962f, -0.681426704f, 0.730884254f, 0.078193225f,
+    -0.632596493f, 0.770524025f, 0.119124867f, -0.578244269f, 0.807120144f, 0.160357445f, -0.518927634f, 0.839642525f,
+    0.20109424f, -0.455528229f, 0.867211103f, 0.240536168f, -0.38919571f, 0.889195681f, 0.277958035f, -0.321246803f,
+    0.905284405f, 0.3127729f, -0.253038615f, 0.91550225f, 0.344573081f, -0.185843647f, 0.920180142f, 0.373140365f,
+    -0.120750763f, 0.91988343f, 0.398431271f, -0.0586068518f, 0.915323794f, 0.0f, -0.795820415f, 0.605532706f,
+    0.0362210236f, -0.76188904f, 0.646693885f, 0.0744211227f, -0.722495437f, 0.687358558f, 0.114190117f, -0.677466154f,
+    0.726636231f, 0.154971644f, -0.626873493f, 0.763553202f, 0.196083441f, -0.571085453f, 0.797127783f, 0.236761168f,
+    -0.510783494f, 0.826465011f, 0.276221365f, -0.446935564f, 0.850852787f, 0.313733548f, -0.380723655f, 0.869839609f,
+    0.348686218f, -0.313436747f, 0.88327539f, 0.380633712f, -0.246351317f, 0.891307473f, 0.409316182f, -0.180623859f,
+    0.894335091f, 0.434652299f, -0.117213704f, 0.892937958f, 0.456712335f, -0.0568443164f, 0.887796462f, 0.0919760317f,
+    -0.830952168f, 0.548688352f, 0.153434724f, -0.834331095f, 0.529480159f, 0.131048918f, -0.798110187f, 0.588087082f,
+    0.217834428f, -0.834127128f, 0.506734669f, 0.19537884f, -0.799132645f, 0.568519235f, 0.17183964f, -0.75970602f,
+    0.627150595f, 0.284414709f, -0.829719722f, 0.480284959f, 0.262415439f, -0.796284378f, 0.545040607f, 0.238753453f,
+    -0.757998526f, 0.60698849f, 0.213841334f, -0.715529561f, 0.66504848f, 0.352179676f, -0.820588052f, 0.450116485f,
+    0.331231862f, -0.788983047f, 0.517485499f, 0.308011889f, -0.752189457f, 0.58252871f, 0.282905757f, -0.71078974f,
+    0.644004762f, 0.256401926f, -0.665616393f, 0.700865865f, 0.419940323f, -0.806385577f, 0.416404128f, 0.400663376f,
+    -0.776785731f, 0.485873312f, 0.37851721f, -0.741770625f, 0.553625464f, 0.353819877f, -0.701809466f, 0.618283927f,
+    0.327040166f, -0.657660842f, 0.678621411f, 0.298754096f, -0.61030221f, 0.73367393f, 0.486395746f, -0.787004828f,
+    0.379529476f, 0.469374448f, -0.759463787f, 0.450446814f, 0.448948085f, -0.72641325f, 0.520354927f, 0.425325394f,
+    -0.688190937f, 0.587785244f, 0.398910046f, -0.645449996f, 0.65135622f, 0.370268077f, -0.599106312f, 0.709910631f,
+    0.340069294f, -0.550243676f, 0.762617111f, 0.550243676f, -0.762617111f, 0.340069294f, 0.535965919f, -0.737060189f,
+    0.411682844f, 0.517854512f, -0.7060377f, 0.483050197f, 0.495975226f, -0.669751525f, 0.552667618f, 0.470621616f,
+    -0.628728509f, 0.619044244f, 0.442300588f, -0.583788812f, 0.680853009f, 0.411682844f, -0.535965919f, 0.737060189f,
+    0.379529476f, -0.486395746f, 0.787004828f, 0.61030215f, -0.733673811f, 0.298754066f, 0.599106312f, -0.709910631f,
+    0.370268077f, 0.583788812f, -0.680853009f, 0.442300588f, 0.564254224f, -0.646577775f, 0.513375461f, 0.54065001f,
+    -0.607478023f, 0.581951976f, 0.513375461f, -0.564254224f, 0.646577775f, 0.483050197f, -0.517854512f, 0.7060377f,
+    0.450446814f, -0.469374448f, 0.759463787f, 0.416404188f, -0.419940352f, 0.806385636f, 0.665616393f, -0.700865865f,
+    0.256401926f, 0.657660842f, -0.678621411f, 0.327040166f, 0.645449996f, -0.65135622f, 0.398910046f, 0.628728509f,
+    -0.619044244f, 0.470621616f, 0.607478023f, -0.581951976f, 0.54065001f, 0.581951976f, -0.54065001f, 0.607478023f,
+    0.552667618f, -0.495975226f, 0.669751525f, 0.520354986f, -0.448948115f, 0.72641331f, 0.485873312f, -0.400663376f,
+    0.776785731f, 0.450116485f, -0.352179676f, 0.820588052f, 0.715529561f, -0.66504848f, 0.213841334f, 0.71078974f,
+    -0.644004762f, 0.282905757f, 0.701809466f, -0.618283927f, 0.353819877f, 0.688190937f, -0.587785244f, 0.425325394f,
+    0.669751525f, -0.552667618f, 0.495975226f, 0.646577775f, -0.513375461f, 0.564254224f, 0.619044185f, -0.470621556f,
+    0.628728449f, 0.587785244f, -0.425325394f, 0.688190937f, 0.553625464f, -0.37851721f, 0.741770625f, 0.51748544f,
+    -0.331231833f, 0.788982987f, 0.480284959f, -0.284414709f, 0.829719722f, 0.75970602f, -0.627150595f, 0.17183964f,
+    0.757998526f, -0.60698849f, 0.238753453f, 0.752189517f, -0.58252877f, 0.308011919f, 0.741770625f, -0.553625464f,
+    0.37851721f, 0.72641331f, -0.520354986f, 0.448948115f, 0.7060377f, -0.483050197f, 0.517854512f, 0.680853009f,
+    -0.442300588f, 0.583788812f, 0.65135622f, -0.398910046f, 0.645449996f, 0.618283927f, -0.353819877f, 0.701809466f,
+    0.58252871f, -0.308011889f, 0.752189457f, 0.545040607f, -0.262415439f, 0.796284378f, 0.506734669f, -0.217834428f,
+    0.834127128f, 0.798110068f, -0.588087022f, 0.131048903f, 0.799132645f, -0.568519235f, 0.19537884f, 0.796284378f,
+    -0.545040607f, 0.262415439f, 0.788983047f, -0.517485499f, 0.331231862f, 0.776785731f, -0.485873312f, 0.400663376f,
+    0.759463787f, -0.450446814f, 0.469374448f, 0.737060189f, -0.411682844f, 0.535965919f, 0.709910631f, -0.370268077f,
+    0.599106312f, 0.678621411f, -0.327040166f, 0.657660842f, 0.644004762f, -0.282905757f, 0.71078974f, 0.60698849f,
+    -0.238753453f, 0.757998526f, 0.568519235f, -0.19537884f, 0.799132645f, 0.529480159f, -0.153434724f, 0.834331095f,
+    0.830952168f, -0.548688352f, 0.0919760317f, 0.834331095f, -0.529480159f, 0.153434724f, 0.834127128f, -0.506734669f,
+    0.217834428f, 0.829719722f, -0.480284959f, 0.284414709f, 0.820588052f, -0.450116485f, 0.352179676f, 0.806385636f,
+    -0.416404188f, 0.419940352f, 0.787004828f, -0.379529476f, 0.486395746f, 0.762617111f, -0.340069294f, 0.550243676f,
+    0.73367393f, -0.298754096f, 0.61030221f, 0.700865865f, -0.256401926f, 0.665616393f, 0.66504842f, -0.213841319f,
+    0.715529501f, 0.627150595f, -0.17183964f, 0.75970602f, 0.588087022f, -0.131048903f, 0.798110068f, 0.548688352f,
+    -0.0919760317f, 0.830952168f, -0.887796462f, 0.456712335f, 0.0568443164f, -0.915323794f, 0.398431271f, 0.0586068518f,
+    -0.892937958f, 0.434652299f, 0.117213704f, -0.940329909f, 0.334895045f, 0.0602079555f, -0.91988343f, 0.373140365f,
+    0.120750763f, -0.894335091f, 0.409316182f, 0.180623859f, -0.961880922f, 0.26644364f, 0.0615878366f, -0.943842173f,
+    0.306287169f, 0.123895764f, -0.920180142f, 0.344573081f, 0.185843647f, -0.891307473f, 0.380633712f, 0.246351317f,
+    -0.979053199f, 0.193714559f, 0.0626873523f, -0.963828444f, 0.234579712f, 0.126519322f, -0.942551255f, 0.274516821f,
+    0.190361813f, -0.91550225f, 0.3127729f, 0.253038615f, -0.88327539f, 0.348686218f, 0.313436747f, -0.991025865f,
+    0.117650077f, 0.0634539425f, -0.978907645f, 0.158833161f, 0.128498718f, -0.960443199f, 0.199805602f, 0.193975359f,
+    -0.935745955f, 0.239766747f, 0.258633822f, -0.905284405f, 0.277958035f, 0.321246803f, -0.869839609f, 0.313733548f,
+    0.380723655f, -0.99717921f, 0.0394601934f, 0.0638479367f, -0.988302052f, 0.0801787227f, 0.129731908f, -0.9729532f,
+    0.121444866f, 0.196501926f, -0.95105654f, 0.16245985f, 0.262865543f, -0.922915161f, 0.202408105f, 0.327503204f,
+    -0.8891958f, 0.240536198f, 0.38919574f, -0.850852787f, 0.276221365f, 0.446935564f, -0.99717921f, -0.0394601934f,
+    0.0638479367f, -0.991494179f, 0.0f, 0.130150929f, -0.979394495f, 0.0407496244f, 0.197802827f, -0.960611582f,
+    0.0820460245f, 0.265506506f, -0.935258031f, 0.123069048f, 0.331883162f, -0.903840542f, 0.162998497f, 0.395605654f,
+    -0.867211103f, 0.20109424f, 0.455528229f, -0.826465011f, 0.236761168f, 0.510783494f, -0.991025865f, -0.117650077f,
+    0.0634539425f, -0.988302052f, -0.0801787227f, 0.129731908f, -0.979394495f, -0.0407496244f, 0.197802827f, -0.963861167f,
+    0.0f, 0.266404688f, -0.941618085f, 0.0413019843f, 0.334140062f, -0.912982523f, 0.082323581f, 0.399607062f,
+    -0.878655851f, 0.122248873f, 0.461539954f, -0.839642525f, 0.160357445f, 0.518927634f, -0.797127783f, 0.196083441f,
+    0.571085453f, -0.979053199f, -0.193714559f, 0.0626873523f, -0.978907645f, -0.158833161f, 0.128498718f, -0.9729532f,
+    -0.121444866f, 0.196501926f, -0.960611582f, -0.0820460245f, 0.265506506f, -0.941618085f, -0.0413019843f, 0.334140062f,
+    -0.916092038f, 0.0f, 0.400968105f, -0.88455081f, 0.041023016f, 0.464636445f, -0.847858131f, 0.0809632465f,
+    0.524005115f, -0.807120144f, 0.119124867f, 0.578244269f, -0.763553202f, 0.154971644f, 0.626873493f, -0.961880922f,
+    -0.26644364f, 0.0615878366f, -0.963828444f, -0.234579712f, 0.126519322f, -0.960443199f, -0.199805602f, 0.193975359f,
+    -0.95105654f, -0.16245985f, 0.262865543f, -0.935258031f, -0.123069048f, 0.331883162f, -0.912982523f, -0.082323581f,
+    0.399607062f, -0.88455081f, -0.041023016f, 0.464636445f, -0.850650787f, 0.0f, 0.525731087f, -0.812259316f,
+    0.039961122f, 0.581926107f, -0.770524025f, 0.078193225f, 0.632596493f, -0.726636231f, 0.114190117f, 0.677466154f,
+    -0.940329909f, -0.334895045f, 0.0602079555f, -0.943842173f, -0.306287169f, 0.123895764f, -0.942551255f, -0.274516821f,
+    0.190361813f, -0.935745955f, -0.239766747f, 0.258633822f, -0.922915161f, -0.202408105f, 0.327503204f, -0.903840542f,
+    -0.162998497f, 0.395605654f, -0.878655851f, -0.122248873f, 0.461539954f, -0.847858131f, -0.0809632465f, 0.524005115f,
+    -0.812259316f, -0.039961122f, 0.581926107f, -0.772890508f, 0.0f, 0.634539366f, -0.730884254f, 0.0382858962f,
+    0.681426704f, -0.687358558f, 0.0744211227f, 0.722495437f, -0.915323794f, -0.398431271f, 0.0586068518f, -0.91988343f,
+    -0.373140365f, 0.120750763f, -0.920180142f, -0.344573081f, 0.185843647f, -0.91550225f, -0.3127729f, 0.253038615f,
+    -0.905284405f, -0.277958035f, 0.321246803f, -0.8891958f, -0.240536198f, 0.38919574f, -0.867211103f, -0.20109424f,
+    0.455528229f, -0.839642525f, -0.160357445f, 0.518927634f, -0.807120144f, -0.119124867f, 0.578244269f, -0.770524025f,
+    -0.078193225f, 0.632596493f, -0.730884254f, -0.0382858962f, 0.681426704f, -0.68926996f, 0.0f, 0.72450459f,
+    -0.646693885f, 0.0362210236f, 0.76188904f, -0.887796462f, -0.456712335f, 0.0568443164f, -0.892937958f, -0.434652299f,
+    0.117213704f, -0.894335091f, -0.409316182f, 0.180623859f, -0.891307473f, -0.380633712f, 0.246351317f, -0.88327539f,
+    -0.348686218f, 0.313436747f, -0.869839609f, -0.313733548f, 0.380723655f, -0.850852787f, -0.276221365f, 0.446935564f,
+    -0.826465011f, -0.236761168f, 0.510783494f, -0.797127783f, -0.196083441f, 0.571085453f, -0.763553202f, -0.154971644f,
+    0.626873493f, -0.726636231f, -0.114190117f, 0.677466154f, -0.687358558f, -0.0744211227f, 0.722495437f, -0.646693885f,
+    -0.0362210236f, 0.76188904f, -0.605532706f, 0.0f, 0.795820415f, -0.887796462f, 0.456712335f, -0.0568443164f,
+    -0.892937958f, 0.434652299f, -0.117213704f, -0.915323794f, 0.398431271f, -0.0586068518f, -0.894335091f, 0.409316182f,
+    -0.180623859f, -0.91988343f, 0.373140365f, -0.120750763f, -0.940329909f, 0.334895045f, -0.0602079555f, -0.891307473f,
+    0.380633712f, -0.246351317f, -0.920180142f, 0.344573081f, -0.185843647f, -0.943842173f, 0.306287169f, -0.123895764f,
+    -0.961880922f, 0.26644364f, -0.0615878366f, -0.88327539f, 0.348686218f, -0.313436747f, -0.91550225f, 0.3127729f,
+    -0.253038615f, -0.942551255f, 0.274516821f, -0.190361813f, -0.963828444f, 0.234579712f, -0.126519322f, -0.979053199f,
+    0.193714559f, -0.0626873523f, -0.869839609f, 0.313733548f, -0.380723655f, -0.905284405f, 0.277958035f, -0.321246803f,
+    -0.935745955f, 0.239766747f, -0.258633822f, -0.960443199f, 0.199805602f, -0.193975359f, -0.978907645f, 0.158833161f,
+    -0.128498718f, -0.991025865f, 0.117650077f, -0.0634539425f, -0.850852787f, 0.276221365f, -0.446935564f, -0.8891958f,
+    0.240536198f, -0.38919574f, -0.922915161f, 0.202408105f, -0.327503204f, -0.95105654f, 0.16245985f, -0.262865543f,
+    -0.9729532f, 0.121444866f, -0.196501926f, -0.988302052f, 0.0801787227f, -0.129731908f, -0.99717921f, 0.0394601934f,
+    -0.0638479367f, -0.826465011f, 0.236761168f, -0.510783494f, -0.867211103f, 0.20109424f, -0.455528229f, -0.903840542f,
+    0.162998497f, -0.395605654f, -0.935258031f, 0.123069048f, -0.331883162f, -0.960611582f, 0.0820460245f, -0.265506506f,
+    -0.979394495f, 0.0407496244f, -0.197802827f, -0.991494179f, 0.0f, -0.130150929f, -0.99717921f, -0.0394601934f,
+    -0.0638479367f, -0.797127783f, 0.196083441f, -0.571085453f, -0.839642525f, 0.160357445f, -0.518927634f, -0.878655851f,
+    0.122248873f, -0.461539954f, -0.912982523f, 0.082323581f, -0.399607062f, -0.941618085f, 0.0413019843f, -0.334140062f,
+    -0.963861167f, 0.0f, -0.266404688f, -0.979394495f, -0.0407496244f, -0.197802827f, -0.988302052f, -0.0801787227f,
+    -0.129731908f, -0.991025865f, -0.117650077f, -0.0634539425f, -0.763553202f, 0.154971644f, -0.626873493f, -0.807120144f,
+    0.119124867f, -0.578244269f, -0.847858131f, 0.0809632465f, -0.524005115f, -0.88455081f, 0.041023016f, -0.464636445f,
+    -0.916092038f, 0.0f, -0.400968105f, -0.941618085f, -0.0413019843f, -0.334140062f, -0.960611582f, -0.0820460245f,
+    -0.265506506f, -0.9729532f, -0.121444866f, -0.196501926f, -0.978907645f, -0.158833161f, -0.128498718f, -0.979053199f,
+    -0.193714559f, -0.0626873523f, -0.726636231f, 0.114190117f, -0.677466154f, -0.770524025f, 0.078193225f, -0.632596493f,
+    -0.812259316f, 0.039961122f, -0.581926107f, -0.850650787f, 0.0f, -0.525731087f, -0.88455081f, -0.041023016f,
+    -0.464636445f, -0.912982523f, -0.082323581f, -0.399607062f, -0.935258031f, -0.123069048f, -0.331883162f, -0.95105654f,
+    -0.16245985f, -0.262865543f, -0.960443199f, -0.199805602f, -0.193975359f, -0.963828444f, -0.234579712f, -0.126519322f,
+    -0.961880922f, -0.26644364f, -0.0615878366f, -0.687358558f, 0.0744211227f, -0.722495437f, -0.730884254f, 0.0382858962f,
+    -0.681426704f, -0.772890508f, 0.0f, -0.634539366f, -0.812259316f, -0.039961122f, -0.581926107f, -0.847858131f,
+    -0.0809632465f, -0.524005115f, -0.878655851f, -0.122248873f, -0.461539954f, -0.903840542f, -0.162998497f, -0.395605654f,
+    -0.922915161f, -0.202408105f, -0.327503204f, -0.935745955f, -0.239766747f, -0.258633822f, -0.942551255f, -0.274516821f,
+    -0.190361813f, -0.943842173f, -0.306287169f, -0.123895764f, -0.940329909f, -0.334895045f, -0.0602079555f, -0.646693885f,
+    0.0362210236f, -0.76188904f, -0.68926996f, 0.0f, -0.72450459f, -0.730884254f, -0.0382858962f, -0.681426704f,
+    -0.770524025f, -0.078193225f, -0.632596493f, -0.807120144f, -0.119124867f, -0.578244269f, -0.839642525f, -0.160357445f,
+    -0.518927634f, -0.867211103f, -0.20109424f, -0.455528229f, -0.8891958f, -0.240536198f, -0.38919574f, -0.905284405f,
+    -0.277958035f, -0.321246803f, -0.91550225f, -0.3127729f, -0.253038615f, -0.920180142f, -0.344573081f, -0.185843647f,
+    -0.91988343f, -0.373140365f, -0.120750763f, -0.915323794f, -0.398431271f, -0.0586068518f, -0.605532706f, 0.0f,
+    -0.795820415f, -0.646693885f, -0.0362210236f, -0.76188904f, -0.687358558f, -0.0744211227f, -0.722495437f, -0.726636231f,
+    -0.114190117f, -0.677466154f, -0.763553202f, -0.154971644f, -0.626873493f, -0.797127783f, -0.196083441f, -0.571085453f,
+    -0.826465011f, -0.236761168f, -0.510783494f, -0.850852787f, -0.276221365f, -0.446935564f, -0.869839609f, -0.313733548f,
+    -0.380723655f, -0.88327539f, -0.348686218f, -0.313436747f, -0.891307473f, -0.380633712f, -0.246351317f, -0.894335091f,
+    -0.409316182f, -0.180623859f, -0.892937958f, -0.434652299f, -0.117213704f, -0.887796462f, -0.456712335f, -0.0568443164f,
+    -0.830952168f, 0.548688352f, -0.0919760317f, -0.798110068f, 0.588087022f, -0.131048903f, -0.834331095f, 0.529480159f,
+    -0.153434724f, -0.75970602f, 0.627150595f, -0.17183964f, -0.799132645f, 0.568519235f, -0.19537884f, -0.834127128f,
+    0.506734669f, -0.217834428f, -0.715529561f, 0.66504848f, -0.213841334f, -0.757998526f, 0.60698849f, -0.238753453f,
+    -0.796284378f, 0.545040607f, -0.262415439f, -0.829719722f, 0.480284959f, -0.284414709f, -0.665616393f, 0.700865865f,
+    -0.256401926f, -0.71078974f, 0.644004762f, -0.282905757f, -0.752189517f, 0.58252877f, -0.308011919f, -0.788983047f,
+    0.517485499f, -0.331231862f, -0.820588052f, 0.450116485f, -0.352179676f, -0.61030215f, 0.733673811f, -0.298754066f,
+    -0.657660842f, 0.678621411f, -0.327040166f, -0.701809466f, 0.618283927f, -0.353819877f, -0.741770625f, 0.553625464f,
+    -0.37851721f, -0.776785731f, 0.485873312f, -0.400663376f, -0.806385636f, 0.416404188f, -0.419940352f, -0.550243676f,
+    0.762617111f, -0.340069294f, -0.599106312f, 0.709910631f, -0.370268077f, -0.645449996f, 0.65135622f, -0.398910046f,
+    -0.688190937f, 0.587785244f, -0.425325394f, -0.72641331f, 0.520354986f, -0.448948115f, -0.759463787f, 0.450446814f,
+    -0.469374448f, -0.787004828f, 0.379529476f, -0.486395746f, -0.486395746f, 0.787004828f, -0.379529476f, -0.535965919f,
+    0.737060189f, -0.411682844f, -0.583788812f, 0.680853009f, -0.442300588f, -0.628728509f, 0.619044244f, -0.470621616f,
+    -0.669751525f, 0.552667618f, -0.495975226f, -0.7060377f, 0.483050197f, -0.517854512f, -0.737060189f, 0.411682844f,
+    -0.535965919f, -0.762617111f, 0.340069294f, -0.550243676f, -0.419940323f, 0.806385577f, -0.416404128f, -0.469374448f,
+    0.759463787f, -0.450446814f, -0.517854512f, 0.7060377f, -0.483050197f, -0.564254224f, 0.646577775f, -0.513375461f,
+    -0.607478023f, 0.581951976f, -0.54065001f, -0.646577775f, 0.513375461f, -0.564254224f, -0.680853009f, 0.442300588f,
+    -0.583788812f, -0.709910631f, 0.370268077f, -0.599106312f, -0.73367393f, 0.298754096f, -0.61030221f, -0.352179676f,
+    0.820588052f, -0.450116485f, -0.400663376f, 0.776785731f, -0.485873312f, -0.448948085f, 0.72641325f, -0.520354927f,
+    -0.495975226f, 0.669751525f, -0.552667618f, -0.54065001f, 0.607478023f, -0.581951976f, -0.581951976f, 0.54065001f,
+    -0.607478023f, -0.619044185f, 0.470621556f, -0.628728449f, -0.65135622f, 0.398910046f, -0.645449996f, -0.678621411f,
+    0.327040166f, -0.657660842f, -0.700865865f, 0.256401926f, -0.665616393f, -0.284414709f, 0.829719722f, -0.480284959f,
+    -0.331231862f, 0.788983047f, -0.517485499f, -0.37851721f, 0.741770625f, -0.553625464f, -0.425325394f, 0.688190937f,
+    -0.587785244f, -0.470621616f, 0.628728509f, -0.619044244f, -0.513375461f, 0.564254224f, -0.646577775f, -0.552667618f,
+    0.495975226f, -0.669751525f, -0.587785244f, 0.425325394f, -0.688190937f, -0.618283927f, 0.353819877f, -0.701809466f,
+    -0.644004762f, 0.282905757f, -0.71078974f, -0.66504842f, 0.213841319f, -0.715529501f, -0.217834428f, 0.834127128f,
+    -0.506734669f, -0.262415439f, 0.796284378f, -0.545040607f, -0.308011889f, 0.752189457f, -0.58252871f, -0.353819877f,
+    0.701809466f, -0.618283927f, -0.398910046f, 0.645449996f, -0.65135622f, -0.442300588f, 0.583788812f, -0.680853009f,
+    -0.483050197f, 0.517854512f, -0.7060377f, -0.520354986f, 0.448948115f, -0.72641331f, -0.553625464f, 0.37851721f,
+    -0.741770625f, -0.58252871f, 0.308011889f, -0.752189457f, -0.60698849f, 0.238753453f, -0.757998526f, -0.627150595f,
+    0.17183964f, -0.75970602f, -0.153434724f, 0.834331095f, -0.529480159f, -0.19537884f, 0.799132645f, -0.568519235f,
+    -0.238753453f, 0.757998526f, -0.60698849f, -0.282905757f, 0.71078974f, -0.644004762f, -0.327040166f, 0.657660842f,
+    -0.678621411f, -0.370268077f, 0.599106312f, -0.709910631f, -0.411682844f, 0.535965919f, -0.737060189f, -0.450446814f,
+    0.469374448f, -0.759463787f, -0.485873312f, 0.400663376f, -0.776785731f, -0.51748544f, 0.331231833f, -0.788982987f,
+    -0.545040607f, 0.262415439f, -0.796284378f, -0.568519235f, 0.19537884f, -0.799132645f, -0.588087022f, 0.131048903f,
+    -0.798110068f, -0.0919760317f, 0.830952168f, -0.548688352f, -0.131048918f, 0.798110187f, -0.588087082f, -0.17183964f,
+    0.75970602f, -0.627150595f, -0.213841334f, 0.715529561f, -0.66504848f, -0.256401926f, 0.665616393f, -0.700865865f,
+    -0.298754096f, 0.61030221f, -0.73367393f, -0.340069294f, 0.550243676f, -0.762617111f, -0.379529476f, 0.486395746f,
+    -0.787004828f, -0.416404188f, 0.419940352f, -0.806385636f, -0.450116485f, 0.352179676f, -0.820588052f, -0.480284959f,
+    0.284414709f, -0.829719722f, -0.506734669f, 0.217834428f, -0.834127128f, -0.529480159f, 0.153434724f, -0.834331095f,
+    -0.548688352f, 0.0919760317f, -0.830952168f, -0.0919760317f, -0.830952168f, -0.548688352f, -0.153434724f, -0.834331095f,
+    -0.529480159f, -0.131048918f, -0.798110187f, -0.588087082f, -0.217834428f, -0.834127128f, -0.506734669f, -0.19537884f,
+    -0.799132645f, -0.568519235f, -0.17183964f, -0.75970602f, -0.627150595f, -0.284414709f, -0.829719722f, -0.480284959f,
+    -0.262415439f, -0.796284378f, -0.545040607f, -0.238753453f, -0.757998526f, -0.60698849f, -0.213841334f, -0.715529561f,
+    -0.66504848f, -0.352179676f, -0.820588052f, -0.450116485f, -0.331231862f, -0.788983047f, -0.517485499f, -0.308011889f,
+    -0.752189457f, -0.58252871f, -0.282905757f, -0.71078974f, -0.644004762f, -0.256401926f, -0.665616393f, -0.700865865f,
+    -0.419940323f, -0.806385577f, -0.416404128f, -0.400663376f, -0.776785731f, -0.485873312f, -0.37851721f, -0.741770625f,
+    -0.553625464f, -0.353819877f, -0.701809466f, -0.618283927f, -0.327040166f, -0.657660842f, -0.678621411f, -0.298754096f,
+    -0.61030221f, -0.73367393f, -0.486395746f, -0.787004828f, -0.379529476f, -0.469374448f, -0.759463787f, -0.450446814f,
+    -0.448948085f, -0.72641325f, -0.520354927f, -0.425325394f, -0.688190937f, -0.587785244f, -0.398910046f, -0.645449996f,
+    -0.65135622f, -0.370268077f, -0.599106312f, -0.709910631f, -0.340069294f, -0.550243676f, -0.762617111f, -0.550243676f,
+    -0.762617111f, -0.340069294f, -0.535965919f, -0.737060189f, -0.411682844f, -0.517854512f, -0.7060377f, -0.483050197f,
+    -0.495975226f, -0.669751525f, -0.552667618f, -0.470621616f, -0.628728509f, -0.619044244f, -0.442300588f, -0.583788812f,
+    -0.680853009f, -0.411682844f, -0.535965919f, -0.737060189f, -0.379529476f, -0.486395746f, -0.787004828f, -0.61030215f,
+    -0.733673811f, -0.298754066f, -0.599106312f, -0.709910631f, -0.370268077f, -0.583788812f, -0.680853009f, -0.442300588f,
+    -0.564254224f, -0.646577775f, -0.513375461f, -0.54065001f, -0.607478023f, -0.581951976f, -0.513375461f, -0.564254224f,
+    -0.646577775f, -0.483050197f, -0.517854512f, -0.7060377f, -0.450446814f, -0.469374448f, -0.759463787f, -0.416404188f,
+    -0.419940352f, -0.806385636f, -0.665616393f, -0.700865865f, -0.256401926f, -0.657660842f, -0.678621411f, -0.327040166f,
+    -0.645449996f, -0.65135622f, -0.398910046f, -0.628728509f, -0.619044244f, -0.470621616f, -0.607478023f, -0.581951976f,
+    -0.54065001f, -0.581951976f, -0.54065001f, -0.607478023f, -0.552667618f, -0.495975226f, -0.669751525f, -0.520354986f,
+    -0.448948115f, -0.72641331f, -0.485873312f, -0.400663376f, -0.776785731f, -0.450116485f, -0.352179676f, -0.820588052f,
+    -0.715529561f, -0.66504848f, -0.213841334f, -0.71078974f, -0.644004762f, -0.282905757f, -0.701809466f, -0.618283927f,
+    -0.353819877f, -0.688190937f, -0.587785244f, -0.425325394f, -0.669751525f, -0.552667618f, -0.495975226f, -0.646577775f,
+    -0.513375461f, -0.564254224f, -0.619044185f, -0.470621556f, -0.628728449f, -0.587785244f, -0.425325394f, -0.688190937f,
+    -0.553625464f, -0.37851721f, -0.741770625f, -0.51748544f, -0.331231833f, -0.788982987f, -0.480284959f, -0.284414709f,
+    -0.829719722f, -0.75970602f, -0.627150595f, -0.17183964f, -0.757998526f, -0.60698849f, -0.238753453f, -0.752189517f,
+    -0.58252877f, -0.308011919f, -0.741770625f, -0.553625464f, -0.37851721f, -0.72641331f, -0.520354986f, -0.448948115f,
+    -0.7060377f, -0.483050197f, -0.517854512f, -0.680853009f, -0.442300588f, -0.583788812f, -0.65135622f, -0.398910046f,
+    -0.645449996f, -0.618283927f, -0.353819877f, -0.701809466f, -0.58252871f, -0.308011889f, -0.752189457f, -0.545040607f,
+    -0.262415439f, -0.796284378f, -0.506734669f, -0.217834428f, -0.834127128f, -0.798110068f, -0.588087022f, -0.131048903f,
+    -0.799132645f, -0.568519235f, -0.19537884f, -0.796284378f, -0.545040607f, -0.262415439f, -0.788983047f, -0.517485499f,
+    -0.331231862f, -0.776785731f, -0.485873312f, -0.400663376f, -0.759463787f, -0.450446814f, -0.469374448f, -0.737060189f,
+    -0.411682844f, -0.535965919f, -0.709910631f, -0.370268077f, -0.599106312f, -0.678621411f, -0.327040166f, -0.657660842f,
+    -0.644004762f, -0.282905757f, -0.71078974f, -0.60698849f, -0.238753453f, -0.757998526f, -0.568519235f, -0.19537884f,
+    -0.799132645f, -0.529480159f, -0.153434724f, -0.834331095f, -0.830952168f, -0.548688352f, -0.0919760317f, -0.834331095f,
+    -0.529480159f, -0.153434724f, -0.834127128f, -0.506734669f, -0.217834428f, -0.829719722f, -0.480284959f, -0.284414709f,
+    -0.820588052f, -0.450116485f, -0.352179676f, -0.806385636f, -0.416404188f, -0.419940352f, -0.787004828f, -0.379529476f,
+    -0.486395746f, -0.762617111f, -0.340069294f, -0.550243676f, -0.73367393f, -0.298754096f, -0.61030221f, -0.700865865f,
+    -0.256401926f, -0.665616393f, -0.66504842f, -0.213841319f, -0.715529501f, -0.627150595f, -0.17183964f, -0.75970602f,
+    -0.588087022f, -0.131048903f, -0.798110068f, -0.548688352f, -0.0919760317f, -0.830952168f, -0.824642301f, 0.564633131f,
+    -0.0339771323f, -0.793863237f, 0.604043484f, -0.0700906366f, -0.76188904f, 0.646693885f, -0.0362210236f, -0.722495437f,
+    0.687358558f, -0.0744211227f, -0.681426704f, 0.730884254f, -0.0382858962f, -0.632596493f, 0.770524025f, -0.078193225f,
+    -0.581926107f, 0.812259316f, -0.039961122f, -0.524005115f, 0.847858131f, -0.0809632465f, -0.464636445f, 0.88455081f,
+    -0.041023016f, -0.399607033f, 0.912982404f, -0.0823235735f, -0.334140062f, 0.941618085f, -0.0413019843f, -0.265506506f,
+    0.960611582f, -0.0820460245f, -0.197802827f, 0.979394495f, -0.0407496244f, -0.129731908f, 0.988302052f, -0.0801787227f,
+    -0.0638479367f, 0.99717921f, -0.0394601934f, -0.0638479367f, -0.99717921f, -0.0394601934f, -0.129731908f, -0.988302052f,
+    -0.0801787227f, -0.197802827f, -0.979394495f, -0.0407496244f, -0.265506506f, -0.960611582f, -0.0820460245f, -0.334140062f,
+    -0.941618085f, -0.0413019843f, -0.399607033f, -0.912982404f, -0.0823235735f, -0.464636445f, -0.88455081f, -0.041023016f,
+    -0.524005115f, -0.847858131f, -0.0809632465f, -0.581926107f, -0.812259316f, -0.039961122f, -0.632596493f, -0.770524025f,
+    -0.078193225f, -0.681426704f, -0.730884254f, -0.0382858962f, -0.722495437f, -0.687358558f, -0.0744211227f, -0.76188904f,
+    -0.646693885f, -0.0362210236f, -0.793863237f, -0.604043484f, -0.0700906366f, -0.824642301f, -0.564633131f, -0.0339771323f,
+    -0.858619452f, 0.509656966f, -0.0549761541f, -0.887796462f, 0.456712335f, -0.0568443164f, -0.915323794f, 0.398431271f,
+    -0.0586068518f, -0.940329909f, 0.334895045f, -0.0602079555f, -0.961880922f, 0.26644364f, -0.0615878366f, -0.979053199f,
+    0.193714559f, -0.0626873523f, -0.991025865f, 0.117650077f, -0.0634539425f, -0.99717921f, 0.0394601934f, -0.0638479367f,
+    -0.99717921f, -0.0394601934f, -0.0638479367f, -0.991025865f, -0.117650077f, -0.0634539425f, -0.979053199f, -0.193714559f,
+    -0.0626873523f, -0.961880922f, -0.26644364f, -0.0615878366f, -0.940329909f, -0.334895045f, -0.0602079555f, -0.915323794f,
+    -0.398431271f, -0.0586068518f, -0.887796462f, -0.456712335f, -0.0568443164f, -0.858619452f, -0.509656966f, -0.0549761541f,
+    0.0f, 0.99999994f, 0.0f, 0.0f, 0.99999994f, 0.0f, 0.0f, 0.99999994f,
+    0.0f, 0.0f, 0.99999994f, 0.0f, 0.0f, 0.99999994f, 0.0f, 0.0f,
+    0.99999994f, 0.0f, 0.0f, -0.99999994f, 0.0f, 0.0f, -0.99999994f, 0.0f,
+    0.0f, -0.99999994f, 0.0f, 0.0f, -0.99999994f, 0.0f, 0.0f, -0.99999994f,
+    0.0f, 0.0f, -0.99999994f, 0.0f
+};
+const float STATIC_ICOSPHERE_4_UVS[] =
+{
+    0.838104069f, 0.49999997f, 0.661895931f, 0.49999997f, 0.161895931f, 0.49999997f, 0.338104069f, 0.49999997f,
+    0.75f, 0.176208138f, 0.25f, 0.176208138f, 0.75f, 0.823791862f, 0.25f, 0.823791862f,
+    0.5f, 0.323791802f, 1.0f, 0.323791802f, 0.5f, 0.676208198f, 1.0f, 0.676208198f,
+    0.828898907f, 0.49999997f, 0.819080353f, 0.49999997f, 0.808666945f, 0.49999997f, 0.797700107f, 0.49999997f,
+    0.78624624f, 0.49999997f, 0.77439785f, 0.49999997f, 0.762271047f, 0.49999997f, 0.75f, 0.49999997f,
+    0.737728953f, 0.49999997f, 0.72560215f, 0.49999997f, 0.71375376f, 0.49999997f, 0.702299893f, 0.49999997f,
+    0.691333055f, 0.49999997f, 0.680919647f, 0.49999997f, 0.671101034f, 0.49999997f, 0.664743304f, 0.482491672f,
+    0.667800009f, 0.463822901f, 0.671087444f, 0.444038093f, 0.674629509f, 0.423227727f, 0.678453147f, 0.401533723f,
+    0.682588279f, 0.379151225f, 0.687068284f, 0.356323898f, 0.691930115f, 0.333333313f, 0.697214425f, 0.310482502f,
+    0.702965438f, 0.28807646f, 0.709230721f, 0.266402185f, 0.716060221f, 0.245712459f, 0.723504901f, 0.226214737f,
+    0.73161453f, 0.208066583f, 0.740434289f, 0.191376418f, 0.835256696f, 0.482491672f, 0.832199931f, 0.463822901f,
+    0.828912556f, 0.444038093f, 0.825370431f, 0.423227727f, 0.821546853f, 0.401533723f, 0.817411721f, 0.379151225f,
+    0.812931716f, 0.356323898f, 0.808069825f, 0.333333313f, 0.802785575f, 0.310482502f, 0.797034502f, 0.28807646f,
+    0.790769219f, 0.266402185f, 0.783939779f, 0.245712459f, 0.776495099f, 0.226214737f, 0.76838541f, 0.208066583f,
+    0.759565711f, 0.191376418f, 0.767101765f, 0.171322614f, 0.786153316f, 0.167980731f, 0.806875706f, 0.166670591f,
+    0.828722119f, 0.167832822f, 0.850926042f, 0.17177102f, 0.872643769f, 0.178576589f, 0.893135548f, 0.18810308f,
+    0.911895871f, 0.200000018f, 0.928685308f, 0.213784844f, 0.943483829f, 0.228923202f, 0.956412911f, 0.244894117f,
+    0.967664659f, 0.261232972f, 0.977452874f, 0.277553678f, 0.985984445f, 0.293555319f, 0.993446171f, 0.309017658f,
+    0.845554054f, 0.489182621f, 0.853519917f, 0.477671117f, 0.862013102f, 0.465524167f, 0.871034265f, 0.452838391f,
+    0.880571127f, 0.439751267f, 0.8905949f, 0.426439732f, 0.901058555f, 0.413112938f, 0.911895871f, 0.400000006f,
+    0.923022151f, 0.387332261f, 0.934336901f, 0.375324458f, 0.945728898f, 0.364156842f, 0.957082152f, 0.353962898f,
+    0.968282998f, 0.344822824f, 0.979226887f, 0.336764991f, 0.989823461f, 0.329772294f, 0.75f, 0.157797903f,
+    0.75f, 0.138160646f, 0.75f, 0.117333889f, 0.75f, 0.095400244f, 0.75f, 0.0724923611f,
+    0.75f, 0.0487956703f, 0.75f, 0.0245420635f, 0.5f, 0.000109910965f, 0.25f, 0.0245420635f,
+    0.25f, 0.0487956703f, 0.25f, 0.0724923611f, 0.25f, 0.095400244f, 0.25f, 0.117333889f,
+    0.25f, 0.138160646f, 0.25f, 0.157797903f, 0.00655382872f, 0.309017658f, 0.0140155554f, 0.293555319f,
+    0.0225471556f, 0.277553678f, 0.032335341f, 0.261232972f, 0.0435871184f, 0.244894117f, 0.0565161407f, 0.228923202f,
+    0.0713146627f, 0.213784844f, 0.088104099f, 0.200000018f, 0.106864423f, 0.18810308f, 0.127356231f, 0.178576589f,
+    0.149073988f, 0.17177102f, 0.171277881f, 0.167832822f, 0.193124294f, 0.166670591f, 0.213846654f, 0.167980731f,
+    0.232898265f, 0.171322614f, 0.732898235f, 0.171322614f, 0.713846684f, 0.167980731f, 0.693124294f, 0.166670591f,
+    0.671277881f, 0.167832822f, 0.649073958f, 0.17177102f, 0.627356231f, 0.178576589f, 0.606864393f, 0.18810308f,
+    0.588104129f, 0.200000018f, 0.571314633f, 0.213784844f, 0.556516111f, 0.228923202f, 0.543587089f, 0.244894117f,
+    0.532335341f, 0.261232972f, 0.522547126f, 0.277553678f, 0.514015555f, 0.293555319f, 0.506553829f, 0.309017658f,
+    0.493446171f, 0.309017658f, 0.485984474f, 0.293555319f, 0.477452874f, 0.277553678f, 0.467664659f, 0.261232972f,
+    0.456412911f, 0.244894117f, 0.443483889f, 0.228923202f, 0.428685367f, 0.213784844f, 0.411895901f, 0.200000018f,
+    0.393135607f, 0.18810308f, 0.372643769f, 0.178576589f, 0.350926042f, 0.17177102f, 0.328722149f, 0.167832822f,
+    0.306875706f, 0.166670591f, 0.286153346f, 0.167980731f, 0.267101765f, 0.171322614f, 0.654445887f, 0.489182621f,
+    0.646480024f, 0.477671117f, 0.637986958f, 0.465524167f, 0.628965735f, 0.452838391f, 0.619428873f, 0.439751267f,
+    0.6094051f, 0.426439732f, 0.598941445f, 0.413112938f, 0.588104129f, 0.400000006f, 0.576977849f, 0.387332261f,
+    0.565663099f, 0.375324458f, 0.554271102f, 0.364156842f, 0.542917848f, 0.353962898f, 0.531717002f, 0.344822824f,
+    0.520773113f, 0.336764991f, 0.510176539f, 0.329772294f, 0.654445887f, 0.510817409f, 0.646480024f, 0.522328854f,
+    0.637986958f, 0.534475803f, 0.628965735f, 0.547161639f, 0.619428873f, 0.560248733f, 0.6094051f, 0.573560238f,
+    0.598941445f, 0.586887062f, 0.588104129f, 0.600000024f, 0.576977849f, 0.612667739f, 0.565663099f, 0.624675512f,
+    0.554271102f, 0.635843158f, 0.542917848f, 0.646037102f, 0.531717002f, 0.655177176f, 0.520773113f, 0.663235009f,
+    0.510176539f, 0.670227706f, 0.5f, 0.342202067f, 0.5f, 0.361839324f, 0.5f, 0.382665992f,
+    0.5f, 0.404599756f, 0.5f, 0.42750746f, 0.5f, 0.451204211f, 0.5f, 0.475457907f,
+    0.5f, 0.49999997f, 0.5f, 0.524542093f, 0.5f, 0.54879576f, 0.5f, 0.57249254f,
+    0.5f, 0.595400214f, 0.5f, 0.617334008f, 0.5f, 0.638160706f, 0.5f, 0.657797933f,
+    0.489823431f, 0.670227706f, 0.479226917f, 0.663235009f, 0.468282998f, 0.655177176f, 0.457082123f, 0.646037102f,
+    0.445728898f, 0.635843158f, 0.434336901f, 0.624675512f, 0.423022151f, 0.612667739f, 0.411895901f, 0.600000024f,
+    0.401058584f, 0.586887062f, 0.3905949f, 0.573560238f, 0.380571157f, 0.560248733f, 0.371034294f, 0.547161639f,
+    0.362013042f, 0.534475803f, 0.353519976f, 0.522328854f, 0.345554084f, 0.510817409f, 0.489823431f, 0.329772294f,
+    0.479226917f, 0.336764991f, 0.468282998f, 0.344822824f, 0.457082123f, 0.353962898f, 0.445728898f, 0.364156842f,
+    0.434336901f, 0.375324458f, 0.423022151f, 0.387332261f, 0.411895901f, 0.400000006f, 0.401058584f, 0.413112938f,
+    0.3905949f, 0.426439732f, 0.380571157f, 0.439751267f, 0.371034294f, 0.452838391f, 0.362013042f, 0.465524167f,
+    0.353519976f, 0.477671117f, 0.345554084f, 0.489182621f, 0.259565711f, 0.191376418f, 0.26838547f, 0.208066583f,
+    0.276495099f, 0.226214737f, 0.283939779f, 0.245712459f, 0.290769279f, 0.266402185f, 0.297034562f, 0.28807646f,
+    0.302785575f, 0.310482502f, 0.308069885f, 0.333333313f, 0.312931716f, 0.356323898f, 0.317411721f, 0.379151225f,
+    0.321546853f, 0.401533723f, 0.325370491f, 0.423227727f, 0.328912556f, 0.444038093f, 0.332199991f, 0.463822901f,
+    0.335256696f, 0.482491672f, 0.328898966f, 0.49999997f, 0.319080353f, 0.49999997f, 0.308666974f, 0.49999997f,
+    0.297700107f, 0.49999997f, 0.28624624f, 0.49999997f, 0.27439788f, 0.49999997f, 0.262271047f, 0.49999997f,
+    0.25f, 0.49999997f, 0.237728983f, 0.49999997f, 0.22560212f, 0.49999997f, 0.21375376f, 0.49999997f,
+    0.202299893f, 0.49999997f, 0.191333026f, 0.49999997f, 0.180919677f, 0.49999997f, 0.171101063f, 0.49999997f,
+    0.240434319f, 0.191376418f, 0.23161456f, 0.208066583f, 0.223504931f, 0.226214737f, 0.216060221f, 0.245712459f,
+    0.209230751f, 0.266402185f, 0.202965468f, 0.28807646f, 0.197214425f, 0.310482502f, 0.191930145f, 0.333333313f,
+    0.187068284f, 0.356323898f, 0.182588279f, 0.379151225f, 0.178453147f, 0.401533723f, 0.174629539f, 0.423227727f,
+    0.171087444f, 0.444038093f, 0.167800039f, 0.463822901f, 0.164743334f, 0.482491672f, 0.335256696f, 0.517508328f,
+    0.332199991f, 0.536177099f, 0.328912556f, 0.555961907f, 0.325370491f, 0.576772273f, 0.321546853f, 0.598466277f,
+    0.317411721f, 0.620848775f, 0.312931716f, 0.643676102f, 0.308069885f, 0.666666687f, 0.302785575f, 0.689517498f,
+    0.297034562f, 0.71192354f, 0.290769279f, 0.733597815f, 0.283939779f, 0.754287541f, 0.276495099f, 0.773785233f,
+    0.26838547f, 0.791933417f, 0.259565711f, 0.808623552f, 0.164743334f, 0.517508328f, 0.167800039f, 0.536177099f,
+    0.171087444f, 0.555961907f, 0.174629539f, 0.576772273f, 0.178453147f, 0.598466277f, 0.182588279f, 0.620848775f,
+    0.187068284f, 0.643676102f, 0.191930145f, 0.666666687f, 0.197214425f, 0.689517498f, 0.202965468f, 0.71192354f,
+    0.209230751f, 0.733597815f, 0.216060221f, 0.754287541f, 0.223504931f, 0.773785233f, 0.23161456f, 0.791933417f,
+    0.240434319f, 0.808623552f, 0.267101765f, 0.828677416f, 0.286153346f, 0.832019269f, 0.306875706f, 0.833329439f,
+    0.328722149f, 0.832167149f, 0.350926042f, 0.828228951f, 0.372643769f, 0.821423411f, 0.393135607f, 0.81189692f,
+    0.411895901f, 0.799999952f, 0.428685367f, 0.786215186f, 0.443483889f, 0.771076798f, 0.456412911f, 0.755105853f,
+    0.467664659f, 0.738767028f, 0.477452874f, 0.722446322f, 0.485984474f, 0.706444681f, 0.493446171f, 0.690982342f,
+    0.506553829f, 0.690982342f, 0.514015555f, 0.706444681f, 0.522547126f, 0.722446322f, 0.532335341f, 0.738767028f,
+    0.543587089f, 0.755105853f, 0.556516111f, 0.771076798f, 0.571314633f, 0.786215186f, 0.588104129f, 0.799999952f,
+    0.606864393f, 0.81189692f, 0.627356231f, 0.821423411f, 0.649073958f, 0.828228951f, 0.671277881f, 0.832167149f,
+    0.693124294f, 0.833329439f, 0.713846684f, 0.832019269f, 0.732898235f, 0.828677416f, 0.25f, 0.842202067f,
+    0.25f, 0.861839354f, 0.25f, 0.882666111f, 0.25f, 0.904599786f, 0.25f, 0.927507639f,
+    0.25f, 0.9512043f, 0.25f, 0.975457907f, 0.5f, 0.999890089f, 0.75f, 0.975457907f,
+    0.75f, 0.9512043f, 0.75f, 0.927507639f, 0.75f, 0.904599786f, 0.75f, 0.882666111f,
+    0.75f, 0.861839354f, 0.75f, 0.842202067f, 0.767101765f, 0.828677416f, 0.786153316f, 0.832019269f,
+    0.806875706f, 0.833329439f, 0.828722119f, 0.832167149f, 0.850926042f, 0.828228951f, 0.872643769f, 0.821423411f,
+    0.893135548f, 0.81189692f, 0.911895871f, 0.799999952f, 0.928685308f, 0.786215186f, 0.943483829f, 0.771076798f,
+    0.956412911f, 0.755105853f, 0.967664659f, 0.738767028f, 0.977452874f, 0.722446322f, 0.985984445f, 0.706444681f,
+    0.993446171f, 0.690982342f, 0.232898265f, 0.828677416f, 0.213846654f, 0.832019269f, 0.193124294f, 0.833329439f,
+    0.171277881f, 0.832167149f, 0.149073988f, 0.828228951f, 0.127356231f, 0.821423411f, 0.106864423f, 0.81189692f,
+    0.088104099f, 0.799999952f, 0.0713146627f, 0.786215186f, 0.0565161407f, 0.771076798f, 0.0435871184f, 0.755105853f,
+    0.032335341f, 0.738767028f, 0.0225471556f, 0.722446322f, 0.0140155554f, 0.706444681f, 0.00655382872f, 0.690982342f,
+    0.759565711f, 0.808623552f, 0.76838541f, 0.791933417f, 0.776495099f, 0.773785233f, 0.783939779f, 0.754287541f,
+    0.790769219f, 0.733597815f, 0.797034502f, 0.71192354f, 0.802785575f, 0.689517498f, 0.808069825f, 0.666666687f,
+    0.812931716f, 0.643676102f, 0.817411721f, 0.620848775f, 0.821546853f, 0.598466277f, 0.825370431f, 0.576772273f,
+    0.828912556f, 0.555961907f, 0.832199931f, 0.536177099f, 0.835256696f, 0.517508328f, 0.989823461f, 0.670227706f,
+    0.979226887f, 0.663235009f, 0.968282998f, 0.655177176f, 0.957082152f, 0.646037102f, 0.945728898f, 0.635843158f,
+    0.934336901f, 0.624675512f, 0.923022151f, 0.612667739f, 0.911895871f, 0.600000024f, 0.901058555f, 0.586887062f,
+    0.8905949f, 0.573560238f, 0.880571127f, 0.560248733f, 0.871034265f, 0.547161639f, 0.862013102f, 0.534475803f,
+    0.853519917f, 0.522328854f, 0.845554054f, 0.510817409f, 0.740434289f, 0.808623552f, 0.73161453f, 0.791933417f,
+    0.723504901f, 0.773785233f, 0.716060221f, 0.754287541f, 0.709230721f, 0.733597815f, 0.702965438f, 0.71192354f,
+    0.697214425f, 0.689517498f, 0.691930115f, 0.666666687f, 0.687068284f, 0.643676102f, 0.682588279f, 0.620848775f,
+    0.678453147f, 0.598466277f, 0.674629509f, 0.576772273f, 0.671087444f, 0.555961907f, 0.667800009f, 0.536177099f,
+    0.664743304f, 0.517508328f, 1.0f, 0.342202067f, 1.0f, 0.361839324f, 1.0f, 0.382665992f,
+    1.0f, 0.404599756f, 1.0f, 0.42750746f, 1.0f, 0.451204211f, 1.0f, 0.475457907f,
+    1.0f, 0.49999997f, 1.0f, 0.524542093f, 1.0f, 0.54879576f, 1.0f, 0.57249254f,
+    1.0f, 0.595400214f, 1.0f, 0.617334008f, 1.0f, 0.638160706f, 1.0f, 0.657797933f,
+    0.0101765692f, 0.329772294f, 0.0207731128f, 0.336764991f, 0.0317170024f, 0.344822824f, 0.0429178774f, 0.353962898f,
+    0.0542711318f, 0.364156842f, 0.0656630993f, 0.375324458f, 0.0769778788f, 0.387332261f, 0.088104099f, 0.400000006f,
+    0.0989414155f, 0.413112938f, 0.1094051f, 0.426439732f, 0.119428843f, 0.439751267f, 0.128965706f, 0.452838391f,
+    0.137986928f, 0.465524167f, 0.146480054f, 0.477671117f, 0.154445946f, 0.489182621f, 0.154445946f, 0.510817409f,
+    0.146480054f, 0.522328854f, 0.137986928f, 0.534475803f, 0.128965706f, 0.547161639f, 0.119428843f, 0.560248733f,
+    0.1094051f, 0.573560238f, 0.0989414155f, 0.586887062f, 0.088104099f, 0.600000024f, 0.0769778788f, 0.612667739f,
+    0.0656630993f, 0.624675512f, 0.0542711318f, 0.635843158f, 0.0429178774f, 0.646037102f, 0.0317170024f, 0.655177176f,
+    0.0207731128f, 0.663235009f, 0.0101765692f, 0.670227706f, 0.825618923f, 0.481896102f, 0.815341711f, 0.48133415f,
+    0.822097957f, 0.462603718f, 0.804453254f, 0.480823606f, 0.81133163f, 0.461469799f, 0.818312407f, 0.442188293f,
+    0.79300797f, 0.480383545f, 0.799941182f, 0.46046114f, 0.807025135f, 0.440498173f, 0.814235926f, 0.420768261f,
+    0.78108871f, 0.480032861f, 0.787996888f, 0.459619403f, 0.795105934f, 0.439033836f, 0.802395165f, 0.418569982f,
+    0.809839904f, 0.398519605f, 0.7688061f, 0.479788363f, 0.775600672f, 0.458984137f, 0.782644153f, 0.4378618f,
+    0.789921522f, 0.416727692f, 0.797412634f, 0.395898104f, 0.805092633f, 0.375674903f, 0.756294727f, 0.479662687f,
+    0.762883663f, 0.458588272f, 0.769763649f, 0.437041789f, 0.776926994f, 0.415332407f, 0.784360886f, 0.393792719f,
+    0.792046666f, 0.372752964f, 0.799959779f, 0.35251531f, 0.743705273f, 0.479662687f, 0.75f, 0.458453774f,
+    0.756618142f, 0.436619371f, 0.763560534f, 0.414460808f, 0.7708233f, 0.392316043f, 0.778396726f, 0.370534658f,
+    0.786264896f, 0.34945038f, 0.794404626f, 0.329355359f, 0.7311939f, 0.479788363f, 0.737116337f, 0.458588272f,
+    0.743381858f, 0.436619371f, 0.75f, 0.414164215f, 0.756976485f, 0.391554117f, 0.764312267f, 0.369146526f,
+    0.77200222f, 0.347297043f, 0.780034184f, 0.326331377f, 0.788387954f, 0.306522459f, 0.71891129f, 0.480032861f,
+    0.724399328f, 0.458984137f, 0.730236351f, 0.437041789f, 0.736439466f, 0.414460808f, 0.743023515f, 0.391554117f,
+    0.75f, 0.368673801f, 0.757375836f, 0.346184969f, 0.765151978f, 0.324437201f, 0.773321688f, 0.303738058f,
+    0.781869411f, 0.284334242f, 0.70699203f, 0.480383545f, 0.712003112f, 0.459619403f, 0.717355847f, 0.4378618f,
+    0.723073006f, 0.415332407f, 0.7291767f, 0.392316043f, 0.735687733f, 0.369146526f, 0.742624104f, 0.346184969f,
+    0.75f, 0.323791802f, 0.757823706f, 0.302299291f, 0.766095996f, 0.281989157f, 0.774808168f, 0.263078034f,
+    0.695546746f, 0.480823606f, 0.700058818f, 0.46046114f, 0.704894066f, 0.439033836f, 0.710078478f, 0.416727692f,
+    0.715639114f, 0.393792719f, 0.721603274f, 0.370534658f, 0.72799772f, 0.347297043f, 0.734848022f, 0.324437201f,
+    0.742176294f, 0.302299291f, 0.75f, 0.281189799f, 0.758329391f, 0.261359811f, 0.767165065f, 0.242995024f,
+    0.684658289f, 0.48133415f, 0.68866837f, 0.461469799f, 0.692974865f, 0.440498173f, 0.697604835f, 0.418569982f,
+    0.702587366f, 0.395898104f, 0.707953334f, 0.372752964f, 0.713735104f, 0.34945038f, 0.719965756f, 0.326331377f,
+    0.726678312f, 0.303738058f, 0.733903944f, 0.281989157f, 0.741670609f, 0.261359811f, 0.75f, 0.242068619f,
+    0.758904934f, 0.224272132f, 0.674381077f, 0.481896102f, 0.677902043f, 0.462603718f, 0.681687593f, 0.442188293f,
+    0.685764015f, 0.420768261f, 0.690160096f, 0.398519605f, 0.694907367f, 0.375674903f, 0.700040162f, 0.35251531f,
+    0.705595374f, 0.329355359f, 0.711612046f, 0.306522459f, 0.718130589f, 0.284334242f, 0.725191832f, 0.263078034f,
+    0.732834995f, 0.242995024f, 0.741095066f, 0.224272132f, 0.75f, 0.207039922f, 0.842881322f, 0.470681667f,
+    0.839999676f, 0.450966448f, 0.851068377f, 0.458165467f, 0.836885571f, 0.430100679f, 0.848413408f, 0.437406331f,
+    0.859834075f, 0.445028901f, 0.833512425f, 0.408200741f, 0.845530152f, 0.415480912f, 0.857463837f, 0.423261225f,
+    0.869183064f, 0.431402445f, 0.829850137f, 0.385440588f, 0.84239006f, 0.392535776f, 0.854877114f, 0.400336325f,
+    0.867160738f, 0.408701628f, 0.879104614f, 0.417462885f, 0.825864077f, 0.36205098f, 0.838960111f, 0.368779659f,
+    0.852044642f, 0.376434058f, 0.864943266f, 0.384882569f, 0.877496243f, 0.393948764f, 0.889568925f, 0.403428942f,
+    0.821515203f, 0.338311315f, 0.835201859f, 0.344479442f, 0.848931432f, 0.351798773f, 0.862501979f, 0.360159665f,
+    0.875724852f, 0.369388521f, 0.888439894f, 0.379265815f, 0.900524378f, 0.389549434f, 0.81675899f, 0.314534783f,
+    0.831070602f, 0.319947541f, 0.845496595f, 0.326730847f, 0.859802425f, 0.334810615f, 0.873764753f, 0.344029665f,
+    0.887191594f, 0.354162395f, 0.899934947f, 0.36494112f, 0.911895871f, 0.376085877f, 0.811545253f, 0.29104799f,
+    0.826514423f, 0.29552266f, 0.841691256f, 0.301569581f, 0.856803298f, 0.309163749f, 0.871584892f, 0.318178326f,
+    0.885804176f, 0.3283948f, 0.899281204f, 0.339528799f, 0.911895871f, 0.351264656f, 0.923585892f, 0.363290071f,
+    0.805817604f, 0.268168688f, 0.821473002f, 0.271546006f, 0.837457061f, 0.27666986f, 0.853454232f, 0.283575654f,
+    0.869147122f, 0.292181253f, 0.884253323f, 0.302289128f, 0.898552001f, 0.313609898f, 0.911895871f, 0.325799584f,
+    0.924209595f, 0.338501573f, 0.935477734f, 0.351382434f, 0.79951334f, 0.246185452f, 0.815876305f, 0.248337716f,
+    0.832724571f, 0.252375782f, 0.849693775f, 0.258405149f, 0.866404057f, 0.266400576f, 0.882508755f, 0.276199579f,
+    0.897733569f, 0.287520111f, 0.911895871f, 0.300000012f, 0.924903572f, 0.313243926f, 0.936739743f, 0.326868147f,
+    0.947441936f, 0.340533227f, 0.792563915f, 0.22534284f, 0.809643745f, 0.226177394f, 0.827410102f, 0.228997797f,
+    0.845446289f, 0.233986288f, 0.863296449f, 0.241185874f, 0.880532026f, 0.25048089f, 0.896808505f, 0.261609256f,
+    0.911895871f, 0.27420038f, 0.92568022f, 0.287828207f, 0.938143134f, 0.302063286f, 0.949334383f, 0.316514194f,
+    0.959344268f, 0.33085233f, 0.784895778f, 0.205833226f, 0.802683115f, 0.205292463f, 0.821413815f, 0.206795901f,
+    0.840617955f, 0.210607886f, 0.859749556f, 0.216848791f, 0.87827456f, 0.225461364f, 0.895754576f, 0.236213386f,
+    0.911895871f, 0.248735279f, 0.926555157f, 0.262577713f, 0.939712882f, 0.277271658f, 0.951435208f, 0.292377383f,
+    0.961837053f, 0.307516456f, 0.971054614f, 0.32238698f, 0.776433229f, 0.187796235f, 0.794890881f, 0.185854137f,
+    0.814616203f, 0.185971886f, 0.835092068f, 0.188500255f, 0.855667472f, 0.193646073f, 0.875672936f, 0.201420635f,
+    0.894542933f, 0.211630642f, 0.911895871f, 0.223914087f, 0.927548349f, 0.237803996f, 0.941480041f, 0.252797127f,
+    0.953780055f, 0.268410861f, 0.964596152f, 0.284221053f, 0.974098086f, 0.29988122f, 0.982454956f, 0.315127313f,
+    1.0f, 0.292960048f, 0.99243927f, 0.276151121f, 0.00756072998f, 0.276151121f, 0.983663738f, 0.258770108f,
+    1.0f, 0.257931411f, 0.0163362622f, 0.258770108f, 0.973423481f, 0.241082579f, 0.99106729f, 0.239107907f,
+    0.00893270969f, 0.239107907f, 0.0265764892f, 0.241082579f, 0.961428106f, 0.223453045f, 0.980426669f, 0.219994605f,
+    1.0f, 0.218810171f, 0.0195733607f, 0.219994605f, 0.0385718942f, 0.223453045f, 0.947361052f, 0.206351668f,
+    0.967664659f, 0.20102492f, 0.98908788f, 0.198237419f, 0.0109121203f, 0.198237419f, 0.032335341f, 0.20102492f,
+    0.052638948f, 0.206351668f, 0.930919647f, 0.190348297f, 0.952299893f, 0.1827645f, 0.97560215f, 0.17789185f,
+    1.0f, 0.176208228f, 0.02439785f, 0.17789185f, 0.0477001071f, 0.1827645f, 0.0690803528f, 0.190348297f,
+    0.911895871f, 0.17608583f, 0.933835506f, 0.165910274f, 0.95879066f, 0.158440858f, 0.985984445f, 0.15446502f,
+    0.0140155554f, 0.15446502f, 0.0412093401f, 0.158440858f, 0.0661644638f, 0.165910274f, 0.088104099f, 0.17608583f,
+    0.8903054f, 0.164222211f, 0.911895871f, 0.151264697f, 0.937797844f, 0.140735716f, 0.967664659f, 0.133773267f,
+    1.0f, 0.131326169f, 0.032335341f, 0.133773267f, 0.0622021556f, 0.140735716f, 0.088104099f, 0.151264697f,
+    0.10969463f, 0.164222211f, 0.866535068f, 0.155333161f, 0.886478007f, 0.139657676f, 0.911895871f, 0.125799716f,
+    0.943483829f, 0.11516735f, 0.980426669f, 0.109305024f, 0.0195733607f, 0.109305024f, 0.0565161407f, 0.11516735f,
+    0.088104099f, 0.125799716f, 0.113521993f, 0.139657676f, 0.133464962f, 0.155333161f, 0.84142077f, 0.149788857f,
+    0.858259559f, 0.131793588f, 0.881021976f, 0.114727795f, 0.911895871f, 0.0999999642f, 0.952299893f, 0.0896365941f,
+    1.0f, 0.0858358741f, 0.0477001071f, 0.0896365941f, 0.088104099f, 0.0999999642f, 0.118978024f, 0.114727795f,
+    0.141740441f, 0.131793588f, 0.158579201f, 0.149788857f, 0.816141665f, 0.147649139f, 0.828722119f, 0.128042042f,
+    0.846497536f, 0.108419359f, 0.872643769f, 0.0898292363f, 0.911895871f, 0.0742004812f, 0.967664659f, 0.0647299588f,
+    0.032335341f, 0.0647299588f, 0.088104099f, 0.0742004812f, 0.127356231f, 0.0898292363f, 0.153502464f, 0.108419359f,
+    0.171277881f, 0.128042042f, 0.183858335f, 0.147649139f, 0.79192245f, 0.148640096f, 0.799810886f, 0.128283054f,
+    0.811177075f, 0.107182533f, 0.828722119f, 0.0858749449f, 0.858259559f, 0.0654928684f, 0.911895871f, 0.0487353802f,
+    1.0f, 0.0415462255f, 0.088104099f, 0.0487353802f, 0.141740441f, 0.0654928684f, 0.171277881f, 0.0858749449f,
+    0.188822925f, 0.107182533f, 0.200189084f, 0.128283054f, 0.20807758f, 0.148640096f, 0.769707739f, 0.152235329f,
+    0.773244023f, 0.131934702f, 0.778310657f, 0.110516489f, 0.786153316f, 0.0881710052f, 0.799810886f, 0.0652656853f,
+    0.828722119f, 0.0426763296f, 0.911895871f, 0.0239140093f, 0.088104099f, 0.0239140093f, 0.171277881f, 0.0426763296f,
+    0.200189084f, 0.0652656853f, 0.213846654f, 0.0881710052f, 0.221689314f, 0.110516489f, 0.226755947f, 0.131934702f,
+    0.230292261f, 0.152235329f, 0.730292261f, 0.152235329f, 0.70807755f, 0.148640096f, 0.726755917f, 0.131934702f,
+    0.683858335f, 0.147649139f, 0.700189114f, 0.128283054f, 0.721689284f, 0.110516489f, 0.658579171f, 0.149788857f,
+    0.671277881f, 0.128042042f, 0.688822925f, 0.107182533f, 0.713846684f, 0.0881710052f, 0.633464932f, 0.155333161f,
+    0.641740441f, 0.131793588f, 0.653502464f, 0.108419359f, 0.671277881f, 0.0858749449f, 0.700189114f, 0.0652656853f,
+    0.6096946f, 0.164222211f, 0.613521993f, 0.139657676f, 0.618978024f, 0.114727795f, 0.627356231f, 0.0898292363f,
+    0.641740441f, 0.0654928684f, 0.671277881f, 0.0426763296f, 0.588104129f, 0.17608583f, 0.588104069f, 0.151264697f,
+    0.588104069f, 0.125799716f, 0.588104129f, 0.0999999642f, 0.588104069f, 0.0742004812f, 0.588104069f, 0.0487353802f,
+    0.588104069f, 0.0239140093f, 0.569080353f, 0.190348297f, 0.566164434f, 0.165910274f, 0.562202156f, 0.140735716f,
+    0.556516111f, 0.11516735f, 0.547700107f, 0.0896365941f, 0.532335341f, 0.0647299588f, 0.5f, 0.0415462255f,
+    0.411895931f, 0.0239140093f, 0.552638948f, 0.206351668f, 0.547700107f, 0.1827645f, 0.54120934f, 0.158440858f,
+    0.532335341f, 0.133773267f, 0.519573331f, 0.109305024f, 0.5f, 0.0858358741f, 0.467664659f, 0.0647299588f,
+    0.411895931f, 0.0487353802f, 0.328722149f, 0.0426763296f, 0.538571894f, 0.223453045f, 0.532335341f, 0.20102492f,
+    0.52439785f, 0.17789185f, 0.514015555f, 0.15446502f, 0.5f, 0.131326169f, 0.480426639f, 0.109305024f,
+    0.452299893f, 0.0896365941f, 0.411895931f, 0.0742004812f, 0.358259559f, 0.0654928684f, 0.299810916f, 0.0652656853f,
+    0.526576519f, 0.241082579f, 0.519573331f, 0.219994605f, 0.51091212f, 0.198237419f, 0.5f, 0.176208228f,
+    0.485984474f, 0.15446502f, 0.467664659f, 0.133773267f, 0.443483889f, 0.11516735f, 0.411895901f, 0.0999999642f,
+    0.372643769f, 0.0898292363f, 0.328722149f, 0.0858749449f, 0.286153346f, 0.0881710052f, 0.516336262f, 0.258770108f,
+    0.50893271f, 0.239107907f, 0.5f, 0.218810171f, 0.48908788f, 0.198237419f, 0.47560215f, 0.17789185f,
+    0.45879066f, 0.158440858f, 0.437797844f, 0.140735716f, 0.411895931f, 0.125799716f, 0.381021976f, 0.114727795f,
+    0.346497536f, 0.108419359f, 0.311177075f, 0.107182533f, 0.278310716f, 0.110516489f, 0.50756073f, 0.276151121f,
+    0.5f, 0.257931411f, 0.49106729f, 0.239107907f, 0.480426639f, 0.219994605f, 0.467664659f, 0.20102492f,
+    0.452299893f, 0.1827645f, 0.433835566f, 0.165910274f, 0.411895931f, 0.151264697f, 0.386478007f, 0.139657676f,
+    0.358259559f, 0.131793588f, 0.328722149f, 0.128042042f, 0.299810916f, 0.128283054f, 0.273244083f, 0.131934702f,
+    0.5f, 0.292960048f, 0.4924393f, 0.276151121f, 0.483663768f, 0.258770108f, 0.473423481f, 0.241082579f,
+    0.461428106f, 0.223453045f, 0.447361052f, 0.206351668f, 0.430919647f, 0.190348297f, 0.411895901f, 0.17608583f,
+    0.39030537f, 0.164222211f, 0.366535038f, 0.155333161f, 0.341420829f, 0.149788857f, 0.316141665f, 0.147649139f,
+    0.29192245f, 0.148640096f, 0.269707739f, 0.152235329f, 0.723566771f, 0.187796235f, 0.715104163f, 0.205833226f,
+    0.705109119f, 0.185854137f, 0.707436085f, 0.22534284f, 0.697316885f, 0.205292463f, 0.685383797f, 0.185971886f,
+    0.70048666f, 0.246185452f, 0.690356255f, 0.226177394f, 0.678586185f, 0.206795901f, 0.664907932f, 0.188500255f,
+    0.694182396f, 0.268168688f, 0.684123695f, 0.248337716f, 0.672589898f, 0.228997797f, 0.659381986f, 0.210607886f,
+    0.644332528f, 0.193646073f, 0.688454747f, 0.29104799f, 0.678526998f, 0.271546006f, 0.667275488f, 0.252375782f,
+    0.654553711f, 0.233986288f, 0.640250444f, 0.216848791f, 0.624327064f, 0.201420635f, 0.68324101f, 0.314534783f,
+    0.673485577f, 0.29552266f, 0.662542939f, 0.27666986f, 0.650306225f, 0.258405149f, 0.636703491f, 0.241185874f,
+    0.62172544f, 0.225461364f, 0.605457067f, 0.211630642f, 0.678484797f, 0.338311315f, 0.668929398f, 0.319947541f,
+    0.658308744f, 0.301569581f, 0.646545768f, 0.283575654f, 0.633595943f, 0.266400576f, 0.619467974f, 0.25048089f,
+    0.604245484f, 0.236213386f, 0.588104129f, 0.223914087f, 0.674135923f, 0.36205098f, 0.664798141f, 0.344479442f,
+    0.654503345f, 0.326730847f, 0.643196702f, 0.309163749f, 0.630852878f, 0.292181253f, 0.617491305f, 0.276199579f,
+    0.603191495f, 0.261609256f, 0.588104129f, 0.248735279f, 0.572451651f, 0.237803996f, 0.670149863f, 0.385440588f,
+    0.661039829f, 0.368779659f, 0.651068509f, 0.351798773f, 0.640197575f, 0.334810615f, 0.628415048f, 0.318178326f,
+    0.615746617f, 0.302289128f, 0.602266431f, 0.287520111f, 0.588104129f, 0.27420038f, 0.573444843f, 0.262577713f,
+    0.5585199f, 0.252797127f, 0.666487515f, 0.408200741f, 0.65760988f, 0.392535776f, 0.647955418f, 0.376434058f,
+    0.637498021f, 0.360159665f, 0.626235247f, 0.344029665f, 0.614195824f, 0.3283948f, 0.601447999f, 0.313609898f,
+    0.588104129f, 0.300000012f, 0.57431978f, 0.287828207f, 0.560287058f, 0.277271658f, 0.546219885f, 0.268410861f,
+    0.663114429f, 0.430100679f, 0.654469848f, 0.415480912f, 0.645122826f, 0.400336325f, 0.635056734f, 0.384882569f,
+    0.624275148f, 0.369388521f, 0.612808406f, 0.354162395f, 0.600718796f, 0.339528799f, 0.588104129f, 0.325799584f,
+    0.575096428f, 0.313243926f, 0.561856866f, 0.302063286f, 0.548564792f, 0.292377383f, 0.535403848f, 0.284221053f,
+    0.660000324f, 0.450966448f, 0.651586592f, 0.437406331f, 0.642536163f, 0.423261225f, 0.632839262f, 0.408701628f,
+    0.622503757f, 0.393948764f, 0.611560047f, 0.379265815f, 0.600065053f, 0.36494112f, 0.588104129f, 0.351264656f,
+    0.575790346f, 0.338501573f, 0.563260257f, 0.326868147f, 0.550665617f, 0.316514194f, 0.538162947f, 0.307516456f,
+    0.525901973f, 0.29988122f, 0.657118618f, 0.470681667f, 0.648931623f, 0.458165467f, 0.640165925f, 0.445028901f,
+    0.630816936f, 0.431402445f, 0.620895386f, 0.417462885f, 0.610431015f, 0.403428942f, 0.599475563f, 0.389549434f,
+    0.588104129f, 0.376085877f, 0.576414108f, 0.363290071f, 0.564522266f, 0.351382434f, 0.552558064f, 0.340533227f,
+    0.540655732f, 0.33085233f, 0.528945386f, 0.32238698f, 0.517545044f, 0.315127313f, 0.510176539f, 0.349026829f,
+    0.520773113f, 0.356871247f, 0.510176539f, 0.369554698f, 0.531717002f, 0.3657673f, 0.520773113f, 0.378280997f,
+    0.510176539f, 0.391299129f, 0.542917848f, 0.375705838f, 0.531717002f, 0.388023674f, 0.520773113f, 0.400913239f,
+    0.510176539f, 0.414151371f, 0.554271102f, 0.386627913f, 0.542917907f, 0.398742139f, 0.531717002f, 0.411482096f,
+    0.520773113f, 0.424628615f, 0.510176539f, 0.437946379f, 0.565663099f, 0.398420095f, 0.554271102f, 0.410342395f,
+    0.542917848f, 0.422929019f, 0.531717002f, 0.435968906f, 0.520773113f, 0.449226767f, 0.510176539f, 0.462463856f,
+    0.576977849f, 0.41091767f, 0.565663099f, 0.422676682f, 0.554271102f, 0.435123205f, 0.542917848f, 0.448057175f,
+    0.531717002f, 0.461247176f, 0.520773113f, 0.474450856f, 0.510176539f, 0.487436146f, 0.588104129f, 0.423914075f,
+    0.576977849f, 0.435550213f, 0.565663099f, 0.447883427f, 0.554271102f, 0.460726291f, 0.542917848f, 0.473854482f,
+    0.531717002f, 0.48702538f, 0.520773113f, 0.49999997f, 0.510176539f, 0.512563884f, 0.598941445f, 0.437177628f,
+    0.588104129f, 0.448735267f, 0.576977849f, 0.460989386f, 0.565663099f, 0.47376585f, 0.554271102f, 0.486849427f,
+    0.542917848f, 0.49999997f, 0.531717002f, 0.51297462f, 0.520773113f, 0.525549173f, 0.510176539f, 0.537536144f,
+    0.609405041f, 0.450471342f, 0.598941445f, 0.461991102f, 0.588104069f, 0.474200338f, 0.576977849f, 0.486938298f,
+    0.565663099f, 0.49999997f, 0.554271102f, 0.513150573f, 0.542917848f, 0.526145518f, 0.531717002f, 0.538752794f,
+    0.520773113f, 0.550773263f, 0.510176539f, 0.562053621f, 0.619428873f, 0.463572681f, 0.609405041f, 0.475084841f,
+    0.598941445f, 0.487276524f, 0.588104069f, 0.49999997f, 0.576977849f, 0.513061702f, 0.565663099f, 0.52623415f,
+    0.554271102f, 0.539273679f, 0.542917848f, 0.551942825f, 0.531717002f, 0.564031065f, 0.520773113f, 0.575371385f,
+    0.510176539f, 0.585848629f, 0.628965735f, 0.476289064f, 0.619428873f, 0.487810194f, 0.609405041f, 0.49999997f,
+    0.598941445f, 0.512723446f, 0.588104069f, 0.525799692f, 0.576977849f, 0.539010644f, 0.565663099f, 0.552116573f,
+    0.554271102f, 0.564876795f, 0.542917848f, 0.577070951f, 0.531717002f, 0.588517904f, 0.520773113f, 0.599086761f,
+    0.510176539f, 0.608700871f, 0.637986958f, 0.488467932f, 0.628965735f, 0.49999997f, 0.619428873f, 0.512189806f,
+    0.609405041f, 0.524915159f, 0.598941445f, 0.538008928f, 0.588104129f, 0.551264763f, 0.576977849f, 0.564449787f,
+    0.565663099f, 0.577323318f, 0.554271102f, 0.589657605f, 0.542917907f, 0.601257861f, 0.531717002f, 0.611976326f,
+    0.520773113f, 0.621719003f, 0.510176539f, 0.630445302f, 0.646480024f, 0.49999997f, 0.637986958f, 0.511532068f,
+    0.628965735f, 0.523710907f, 0.619428873f, 0.536427319f, 0.609405041f, 0.549528658f, 0.598941445f, 0.562822342f,
+    0.588104129f, 0.576085925f, 0.576977849f, 0.589082301f, 0.565663099f, 0.601579905f, 0.554271102f, 0.613372087f,
+    0.542917848f, 0.624294162f, 0.531717002f, 0.6342327f, 0.520773113f, 0.643128753f, 0.510176539f, 0.650973201f,
+    0.489823431f, 0.349026829f, 0.489823431f, 0.369554698f, 0.479226917f, 0.356871247f, 0.489823431f, 0.391299129f,
+    0.479226917f, 0.378280997f, 0.468283027f, 0.3657673f, 0.489823431f, 0.414151371f, 0.479226917f, 0.400913239f,
+    0.468282998f, 0.388023674f, 0.457082123f, 0.375705838f, 0.489823431f, 0.437946379f, 0.479226917f, 0.424628615f,
+    0.468283027f, 0.411482096f, 0.457082123f, 0.398742139f, 0.445728898f, 0.386627913f, 0.489823431f, 0.462463856f,
+    0.479226917f, 0.449226767f, 0.468282998f, 0.435968906f, 0.457082123f, 0.422929019f, 0.445728898f, 0.410342395f,
+    0.434336901f, 0.398420095f, 0.489823431f, 0.487436146f, 0.479226917f, 0.474450856f, 0.468282998f, 0.461247176f,
+    0.457082123f, 0.448057175f, 0.445728898f, 0.435123205f, 0.434336901f, 0.422676682f, 0.423022151f, 0.41091767f,
+    0.489823431f, 0.512563884f, 0.479226917f, 0.49999997f, 0.468283027f, 0.48702538f, 0.457082123f, 0.473854482f,
+    0.445728898f, 0.460726291f, 0.434336901f, 0.447883427f, 0.423022151f, 0.435550213f, 0.411895901f, 0.423914075f,
+    0.489823431f, 0.537536144f, 0.479226917f, 0.525549173f, 0.468283027f, 0.51297462f, 0.457082123f, 0.49999997f,
+    0.445728898f, 0.486849427f, 0.434336901f, 0.47376585f, 0.423022151f, 0.460989386f, 0.411895901f, 0.448735267f,
+    0.401058584f, 0.437177628f, 0.489823431f, 0.562053621f, 0.479226917f, 0.550773263f, 0.468282998f, 0.538752794f,
+    0.457082123f, 0.526145518f, 0.445728898f, 0.513150573f, 0.434336901f, 0.49999997f, 0.423022151f, 0.486938298f,
+    0.411895931f, 0.474200338f, 0.401058584f, 0.461991102f, 0.390594929f, 0.450471342f, 0.489823431f, 0.585848629f,
+    0.479226917f, 0.575371385f, 0.468282998f, 0.564031065f, 0.457082123f, 0.551942825f, 0.445728898f, 0.539273679f,
+    0.434336901f, 0.52623415f, 0.423022151f, 0.513061702f, 0.411895931f, 0.49999997f, 0.401058584f, 0.487276524f,
+    0.390594929f, 0.475084841f, 0.380571157f, 0.463572681f, 0.489823431f, 0.608700871f, 0.479226917f, 0.599086761f,
+    0.468283027f, 0.588517904f, 0.457082123f, 0.577070951f, 0.445728898f, 0.564876795f, 0.434336901f, 0.552116573f,
+    0.423022151f, 0.539010644f, 0.411895931f, 0.525799692f, 0.401058584f, 0.512723446f, 0.390594929f, 0.49999997f,
+    0.380571157f, 0.487810194f, 0.371034294f, 0.476289064f, 0.489823431f, 0.630445302f, 0.479226917f, 0.621719003f,
+    0.468282998f, 0.611976326f, 0.457082123f, 0.601257861f, 0.445728898f, 0.589657605f, 0.434336901f, 0.577323318f,
+    0.423022151f, 0.564449787f, 0.411895901f, 0.551264763f, 0.401058584f, 0.538008928f, 0.390594929f, 0.524915159f,
+    0.380571157f, 0.512189806f, 0.371034294f, 0.49999997f, 0.362013042f, 0.488467932f, 0.489823431f, 0.650973201f,
+    0.479226917f, 0.643128753f, 0.468283027f, 0.6342327f, 0.457082123f, 0.624294162f, 0.445728898f, 0.613372087f,
+    0.434336901f, 0.601579905f, 0.423022151f, 0.589082301f, 0.411895901f, 0.576085925f, 0.401058584f, 0.562822342f,
+    0.390594929f, 0.549528658f, 0.380571157f, 0.536427319f, 0.371034294f, 0.523710907f, 0.362013042f, 0.511532068f,
+    0.353519976f, 0.49999997f, 0.276433229f, 0.187796235f, 0.29489091f, 0.185854137f, 0.284895837f, 0.205833226f,
+    0.314616233f, 0.185971886f, 0.302683145f, 0.205292463f, 0.292563915f, 0.22534284f, 0.335092038f, 0.188500255f,
+    0.321413815f, 0.206795901f, 0.309643745f, 0.226177394f, 0.29951334f, 0.246185452f, 0.355667502f, 0.193646073f,
+    0.340617985f, 0.210607886f, 0.327410102f, 0.228997797f, 0.315876305f, 0.248337716f, 0.305817604f, 0.268168688f,
+    0.375672936f, 0.201420635f, 0.359749556f, 0.216848791f, 0.345446289f, 0.233986288f, 0.332724512f, 0.252375782f,
+    0.321472973f, 0.271546006f, 0.311545253f, 0.29104799f, 0.394542933f, 0.211630642f, 0.37827456f, 0.225461364f,
+    0.363296479f, 0.241185874f, 0.349693775f, 0.258405149f, 0.337457061f, 0.27666986f, 0.326514423f, 0.29552266f,
+    0.31675899f, 0.314534783f, 0.411895901f, 0.223914087f, 0.395754546f, 0.236213386f, 0.380532056f, 0.25048089f,
+    0.366404027f, 0.266400576f, 0.353454202f, 0.283575654f, 0.341691256f, 0.301569581f, 0.331070602f, 0.319947541f,
+    0.321515203f, 0.338311315f, 0.427548349f, 0.237803996f, 0.411895901f, 0.248735279f, 0.396808475f, 0.261609256f,
+    0.382508695f, 0.276199579f, 0.369147122f, 0.292181253f, 0.356803268f, 0.309163749f, 0.345496625f, 0.326730847f,
+    0.335201859f, 0.344479442f, 0.325864106f, 0.36205098f, 0.4414801f, 0.252797127f, 0.426555157f, 0.262577713f,
+    0.411895901f, 0.27420038f, 0.397733539f, 0.287520111f, 0.384253353f, 0.302289128f, 0.371584952f, 0.318178326f,
+    0.359802425f, 0.334810615f, 0.348931491f, 0.351798773f, 0.338960141f, 0.368779659f, 0.329850137f, 0.385440588f,
+    0.453780085f, 0.268410861f, 0.439712912f, 0.277271658f, 0.42568022f, 0.287828207f, 0.411895901f, 0.300000012f,
+    0.398552001f, 0.313609898f, 0.385804206f, 0.3283948f, 0.373764783f, 0.344029665f, 0.362501949f, 0.360159665f,
+    0.352044612f, 0.376434058f, 0.34239012f, 0.392535776f, 0.333512485f, 0.408200741f, 0.464596152f, 0.284221053f,
+    0.451435208f, 0.292377383f, 0.438143134f, 0.302063286f, 0.424903572f, 0.313243926f, 0.411895901f, 0.325799584f,
+    0.399281204f, 0.339528799f, 0.387191623f, 0.354162395f, 0.375724852f, 0.369388521f, 0.364943266f, 0.384882569f,
+    0.354877174f, 0.400336325f, 0.345530152f, 0.415480912f, 0.336885571f, 0.430100679f, 0.474098057f, 0.29988122f,
+    0.461837053f, 0.307516456f, 0.449334353f, 0.316514194f, 0.436739743f, 0.326868147f, 0.424209654f, 0.338501573f,
+    0.411895901f, 0.351264656f, 0.399934977f, 0.36494112f, 0.388439953f, 0.379265815f, 0.377496272f, 0.393948764f,
+    0.367160738f, 0.408701628f, 0.357463837f, 0.423261225f, 0.348413408f, 0.437406331f, 0.339999676f, 0.450966448f,
+    0.482454956f, 0.315127313f, 0.471054584f, 0.32238698f, 0.459344298f, 0.33085233f, 0.447441965f, 0.340533227f,
+    0.435477704f, 0.351382434f, 0.423585892f, 0.363290071f, 0.411895901f, 0.376085877f, 0.400524408f, 0.389549434f,
+    0.389568985f, 0.403428942f, 0.379104614f, 0.417462885f, 0.369183064f, 0.431402445f, 0.359834075f, 0.445028901f,
+    0.351068407f, 0.458165467f, 0.342881382f, 0.470681667f, 0.25f, 0.207039922f, 0.258904904f, 0.224272132f,
+    0.241095096f, 0.224272132f, 0.267165005f, 0.242995024f, 0.25f, 0.242068619f, 0.232834965f, 0.242995024f,
+    0.274808139f, 0.263078034f, 0.258329391f, 0.261359811f, 0.241670609f, 0.261359811f, 0.225191861f, 0.263078034f,
+    0.281869382f, 0.284334242f, 0.266096056f, 0.281989157f, 0.25f, 0.281189799f, 0.233903974f, 0.281989157f,
+    0.218130618f, 0.284334242f, 0.288387954f, 0.306522459f, 0.273321688f, 0.303738058f, 0.257823706f, 0.302299291f,
+    0.242176294f, 0.302299291f, 0.226678312f, 0.303738058f, 0.211612046f, 0.306522459f, 0.294404596f, 0.329355359f,
+    0.280034244f, 0.326331377f, 0.265151978f, 0.324437201f, 0.25f, 0.323791802f, 0.234847993f, 0.324437201f,
+    0.219965786f, 0.326331377f, 0.205595404f, 0.329355359f, 0.299959838f, 0.35251531f, 0.286264896f, 0.34945038f,
+    0.27200228f, 0.347297043f, 0.257375896f, 0.346184969f, 0.242624134f, 0.346184969f, 0.22799775f, 0.347297043f,
+    0.213735104f, 0.34945038f, 0.200040191f, 0.35251531f, 0.305092633f, 0.375674903f, 0.292046666f, 0.372752964f,
+    0.278396755f, 0.370534658f, 0.264312267f, 0.369146526f, 0.25f, 0.368673801f, 0.235687733f, 0.369146526f,
+    0.221603245f, 0.370534658f, 0.207953334f, 0.372752964f, 0.194907367f, 0.375674903f, 0.309839904f, 0.398519605f,
+    0.297412634f, 0.395898104f, 0.284360886f, 0.393792719f, 0.2708233f, 0.392316043f, 0.256976515f, 0.391554117f,
+    0.243023485f, 0.391554117f, 0.2291767f, 0.392316043f, 0.215639114f, 0.393792719f, 0.202587366f, 0.395898104f,
+    0.190160096f, 0.398519605f, 0.314235985f, 0.420768261f, 0.302395165f, 0.418569982f, 0.289921492f, 0.416727692f,
+    0.276927024f, 0.415332407f, 0.263560534f, 0.414460808f, 0.25f, 0.414164215f, 0.236439466f, 0.414460808f,
+    0.223072976f, 0.415332407f, 0.210078508f, 0.416727692f, 0.197604835f, 0.418569982f, 0.185764045f, 0.420768261f,
+    0.318312377f, 0.442188293f, 0.307025135f, 0.440498173f, 0.295105934f, 0.439033836f, 0.282644153f, 0.4378618f,
+    0.269763649f, 0.437041789f, 0.256618142f, 0.436619371f, 0.243381858f, 0.436619371f, 0.230236351f, 0.437041789f,
+    0.217355847f, 0.4378618f, 0.204894066f, 0.439033836f, 0.192974865f, 0.440498173f, 0.181687623f, 0.442188293f,
+    0.322097957f, 0.462603718f, 0.31133163f, 0.461469799f, 0.299941152f, 0.46046114f, 0.287996888f, 0.459619403f,
+    0.275600672f, 0.458984137f, 0.262883663f, 0.458588272f, 0.25f, 0.458453774f, 0.237116337f, 0.458588272f,
+    0.224399328f, 0.458984137f, 0.212003112f, 0.459619403f, 0.200058848f, 0.46046114f, 0.1886684f, 0.461469799f,
+    0.177902043f, 0.462603718f, 0.325618923f, 0.481896102f, 0.315341711f, 0.48133415f, 0.304453254f, 0.480823606f,
+    0.293008f, 0.480383545f, 0.28108871f, 0.480032861f, 0.26880613f, 0.479788363f, 0.256294757f, 0.479662687f,
+    0.243705243f, 0.479662687f, 0.23119387f, 0.479788363f, 0.21891129f, 0.480032861f, 0.206992f, 0.480383545f,
+    0.195546746f, 0.480823606f, 0.184658289f, 0.48133415f, 0.174381077f, 0.481896102f, 0.174381077f, 0.518103898f,
+    0.184658289f, 0.51866585f, 0.177902043f, 0.537396252f, 0.195546746f, 0.519176424f, 0.1886684f, 0.538530171f,
+    0.181687623f, 0.557811677f, 0.206992f, 0.519616485f, 0.200058848f, 0.53953886f, 0.192974865f, 0.559501827f,
+    0.185764045f, 0.579231739f, 0.21891129f, 0.519967139f, 0.212003112f, 0.540380597f, 0.204894066f, 0.560966134f,
+    0.197604835f, 0.581430018f, 0.190160096f, 0.601480424f, 0.23119387f, 0.520211637f, 0.224399328f, 0.541015863f,
+    0.217355847f, 0.5621382f, 0.210078508f, 0.583272278f, 0.202587366f, 0.604101896f, 0.194907367f, 0.624325097f,
+    0.243705243f, 0.520337284f, 0.237116337f, 0.541411757f, 0.230236351f, 0.562958241f, 0.223072976f, 0.584667563f,
+    0.215639114f, 0.606207252f, 0.207953334f, 0.627247036f, 0.200040191f, 0.64748466f, 0.256294757f, 0.520337284f,
+    0.25f, 0.541546226f, 0.243381858f, 0.563380599f, 0.236439466f, 0.585539222f, 0.2291767f, 0.607683957f,
+    0.221603245f, 0.629465342f, 0.213735104f, 0.65054965f, 0.205595404f, 0.670644641f, 0.26880613f, 0.520211637f,
+    0.262883663f, 0.541411757f, 0.256618142f, 0.563380599f, 0.25f, 0.585835755f, 0.243023485f, 0.608445883f,
+    0.235687733f, 0.630853474f, 0.22799775f, 0.652702928f, 0.219965786f, 0.673668623f, 0.211612046f, 0.693477511f,
+    0.28108871f, 0.519967139f, 0.275600672f, 0.541015863f, 0.269763649f, 0.562958241f, 0.263560534f, 0.585539222f,
+    0.256976515f, 0.608445883f, 0.25f, 0.631326199f, 0.242624134f, 0.653815031f, 0.234847993f, 0.675562799f,
+    0.226678312f, 0.696261942f, 0.218130618f, 0.715665758f, 0.293008f, 0.519616485f, 0.287996888f, 0.540380597f,
+    0.282644153f, 0.5621382f, 0.276927024f, 0.584667563f, 0.2708233f, 0.607683957f, 0.264312267f, 0.630853474f,
+    0.257375896f, 0.653815031f, 0.25f, 0.676208198f, 0.242176294f, 0.697700739f, 0.233903974f, 0.718010843f,
+    0.225191861f, 0.736921966f, 0.304453254f, 0.519176424f, 0.299941152f, 0.53953886f, 0.295105934f, 0.560966134f,
+    0.289921492f, 0.583272278f, 0.284360886f, 0.606207252f, 0.278396755f, 0.629465342f, 0.27200228f, 0.652702928f,
+    0.265151978f, 0.675562799f, 0.257823706f, 0.697700739f, 0.25f, 0.718810201f, 0.241670609f, 0.738640189f,
+    0.232834965f, 0.757004976f, 0.315341711f, 0.51866585f, 0.31133163f, 0.538530171f, 0.307025135f, 0.559501827f,
+    0.302395165f, 0.581430018f, 0.297412634f, 0.604101896f, 0.292046666f, 0.627247036f, 0.286264896f, 0.65054965f,
+    0.280034244f, 0.673668623f, 0.273321688f, 0.696261942f, 0.266096056f, 0.718010843f, 0.258329391f, 0.738640189f,
+    0.25f, 0.757931352f, 0.241095096f, 0.775727868f, 0.325618923f, 0.518103898f, 0.322097957f, 0.537396252f,
+    0.318312377f, 0.557811677f, 0.314235985f, 0.579231739f, 0.309839904f, 0.601480424f, 0.305092633f, 0.624325097f,
+    0.299959838f, 0.64748466f, 0.294404596f, 0.670644641f, 0.288387954f, 0.693477511f, 0.281869382f, 0.715665758f,
+    0.274808139f, 0.736921966f, 0.267165005f, 0.757004976f, 0.258904904f, 0.775727868f, 0.25f, 0.792960048f,
+    0.276433229f, 0.812203765f, 0.284895837f, 0.794166803f, 0.29489091f, 0.814145863f, 0.292563915f, 0.77465713f,
+    0.302683145f, 0.794707537f, 0.314616233f, 0.814028144f, 0.29951334f, 0.753814578f, 0.309643745f, 0.773822606f,
+    0.321413815f, 0.793204069f, 0.335092038f, 0.811499715f, 0.305817604f, 0.731831312f, 0.315876305f, 0.751662254f,
+    0.327410102f, 0.771002173f, 0.340617985f, 0.789392114f, 0.355667502f, 0.806353927f, 0.311545253f, 0.70895201f,
+    0.321472973f, 0.728453994f, 0.332724512f, 0.747624218f, 0.345446289f, 0.766013741f, 0.359749556f, 0.783151209f,
+    0.375672936f, 0.798579335f, 0.31675899f, 0.685465217f, 0.326514423f, 0.70447731f, 0.337457061f, 0.72333014f,
+    0.349693775f, 0.741594851f, 0.363296479f, 0.758814096f, 0.37827456f, 0.774538636f, 0.394542933f, 0.788369358f,
+    0.321515203f, 0.661688685f, 0.331070602f, 0.680052459f, 0.341691256f, 0.698430419f, 0.353454202f, 0.716424346f,
+    0.366404027f, 0.733599424f, 0.380532056f, 0.74951911f, 0.395754546f, 0.763786614f, 0.411895901f, 0.776085913f,
+    0.325864106f, 0.63794899f, 0.335201859f, 0.655520558f, 0.345496625f, 0.673269153f, 0.356803268f, 0.690836251f,
+    0.369147122f, 0.707818747f, 0.382508695f, 0.723800421f, 0.396808475f, 0.738390744f, 0.411895901f, 0.751264691f,
+    0.427548349f, 0.762196004f, 0.329850137f, 0.614559412f, 0.338960141f, 0.631220341f, 0.348931491f, 0.648201227f,
+    0.359802425f, 0.665189385f, 0.371584952f, 0.681821704f, 0.384253353f, 0.697710872f, 0.397733539f, 0.712479889f,
+    0.411895901f, 0.72579962f, 0.426555157f, 0.737422287f, 0.4414801f, 0.747202873f, 0.333512485f, 0.591799259f,
+    0.34239012f, 0.607464194f, 0.352044612f, 0.623565912f, 0.362501949f, 0.639840364f, 0.373764783f, 0.655970335f,
+    0.385804206f, 0.671605229f, 0.398552001f, 0.686390102f, 0.411895901f, 0.699999988f, 0.42568022f, 0.712171793f,
+    0.439712912f, 0.722728372f, 0.453780085f, 0.731589139f, 0.336885571f, 0.569899321f, 0.345530152f, 0.584519088f,
+    0.354877174f, 0.599663675f, 0.364943266f, 0.615117431f, 0.375724852f, 0.630611479f, 0.387191623f, 0.645837605f,
+    0.399281204f, 0.660471201f, 0.411895901f, 0.674200416f, 0.424903572f, 0.686756074f, 0.438143134f, 0.697936714f,
+    0.451435208f, 0.707622647f, 0.464596152f, 0.715778947f, 0.339999676f, 0.549033523f, 0.348413408f, 0.562593699f,
+    0.357463837f, 0.576738775f, 0.367160738f, 0.591298401f, 0.377496272f, 0.606051266f, 0.388439953f, 0.620734155f,
+    0.399934977f, 0.63505888f, 0.411895901f, 0.648735344f, 0.424209654f, 0.661498427f, 0.436739743f, 0.673131824f,
+    0.449334353f, 0.683485806f, 0.461837053f, 0.692483544f, 0.474098057f, 0.70011878f, 0.342881382f, 0.529318333f,
+    0.351068407f, 0.541834533f, 0.359834075f, 0.554971099f, 0.369183064f, 0.568597555f, 0.379104614f, 0.582537115f,
+    0.389568985f, 0.596571028f, 0.400524408f, 0.610450566f, 0.411895901f, 0.623914123f, 0.423585892f, 0.636709929f,
+    0.435477704f, 0.648617566f, 0.447441965f, 0.659466743f, 0.459344298f, 0.66914767f, 0.471054584f, 0.67761302f,
+    0.482454956f, 0.684872687f, 0.269707739f, 0.847764671f, 0.29192245f, 0.851359904f, 0.273244083f, 0.868065298f,
+    0.316141665f, 0.852350831f, 0.299810916f, 0.871716976f, 0.278310716f, 0.889483511f, 0.341420829f, 0.850211143f,
+    0.328722149f, 0.871957958f, 0.311177075f, 0.892817497f, 0.286153346f, 0.911828995f, 0.366535038f, 0.844666839f,
+    0.358259559f, 0.868206382f, 0.346497536f, 0.891580641f, 0.328722149f, 0.914125085f, 0.299810916f, 0.934734344f,
+    0.39030537f, 0.83577776f, 0.386478007f, 0.860342324f, 0.381021976f, 0.885272205f, 0.372643769f, 0.910170794f,
+    0.358259559f, 0.934507132f, 0.328722149f, 0.95732367f, 0.411895901f, 0.82391417f, 0.411895931f, 0.848735332f,
+    0.411895931f, 0.874200284f, 0.411895901f, 0.900000036f, 0.411895931f, 0.925799489f, 0.411895931f, 0.95126462f,
+    0.411895931f, 0.97608602f, 0.430919647f, 0.809651732f, 0.433835566f, 0.834089756f, 0.437797844f, 0.859264255f,
+    0.443483889f, 0.884832621f, 0.452299893f, 0.910363436f, 0.467664659f, 0.935270071f, 0.5f, 0.958453774f,
+    0.588104069f, 0.97608602f, 0.447361052f, 0.793648362f, 0.452299893f, 0.81723547f, 0.45879066f, 0.841559172f,
+    0.467664659f, 0.866226733f, 0.480426639f, 0.890694976f, 0.5f, 0.914164126f, 0.532335341f, 0.935270071f,
+    0.588104069f, 0.95126462f, 0.671277881f, 0.95732367f, 0.461428106f, 0.776546955f, 0.467664659f, 0.79897511f,
+    0.47560215f, 0.82210815f, 0.485984474f, 0.84553498f, 0.5f, 0.868673801f, 0.519573331f, 0.890694976f,
+    0.547700107f, 0.910363436f, 0.588104069f, 0.925799489f, 0.641740441f, 0.934507132f, 0.700189114f, 0.934734344f,
+    0.473423481f, 0.758917451f, 0.480426639f, 0.780005395f, 0.48908788f, 0.801762581f, 0.5f, 0.823791742f,
+    0.514015555f, 0.84553498f, 0.532335341f, 0.866226733f, 0.556516111f, 0.884832621f, 0.588104129f, 0.900000036f,
+    0.627356231f, 0.910170794f, 0.671277881f, 0.914125085f, 0.713846684f, 0.911828995f, 0.483663768f, 0.741229892f,
+    0.49106729f, 0.760892093f, 0.5f, 0.781189799f, 0.51091212f, 0.801762581f, 0.52439785f, 0.82210815f,
+    0.54120934f, 0.841559172f, 0.562202156f, 0.859264255f, 0.588104069f, 0.874200284f, 0.618978024f, 0.885272205f,
+    0.653502464f, 0.891580641f, 0.688822925f, 0.892817497f, 0.721689284f, 0.889483511f, 0.4924393f, 0.723848879f,
+    0.5f, 0.742068589f, 0.50893271f, 0.760892093f, 0.519573331f, 0.780005395f, 0.532335341f, 0.79897511f,
+    0.547700107f, 0.81723547f, 0.566164434f, 0.834089756f, 0.588104069f, 0.848735332f, 0.613521993f, 0.860342324f,
+    0.641740441f, 0.868206382f, 0.671277881f, 0.871957958f, 0.700189114f, 0.871716976f, 0.726755917f, 0.868065298f,
+    0.5f, 0.707039952f, 0.50756073f, 0.723848879f, 0.516336262f, 0.741229892f, 0.526576519f, 0.758917451f,
+    0.538571894f, 0.776546955f, 0.552638948f, 0.793648362f, 0.569080353f, 0.809651732f, 0.588104129f, 0.82391417f,
+    0.6096946f, 0.83577776f, 0.633464932f, 0.844666839f, 0.658579171f, 0.850211143f, 0.683858335f, 0.852350831f,
+    0.70807755f, 0.851359904f, 0.730292261f, 0.847764671f, 0.230292261f, 0.847764671f, 0.226755947f, 0.868065298f,
+    0.20807758f, 0.851359904f, 0.221689314f, 0.889483511f, 0.200189084f, 0.871716976f, 0.183858335f, 0.852350831f,
+    0.213846654f, 0.911828995f, 0.188822925f, 0.892817497f, 0.171277881f, 0.871957958f, 0.158579201f, 0.850211143f,
+    0.200189084f, 0.934734344f, 0.171277881f, 0.914125085f, 0.153502464f, 0.891580641f, 0.141740441f, 0.868206382f,
+    0.133464962f, 0.844666839f, 0.171277881f, 0.95732367f, 0.141740441f, 0.934507132f, 0.127356231f, 0.910170794f,
+    0.118978024f, 0.885272205f, 0.113521993f, 0.860342324f, 0.10969463f, 0.83577776f, 0.088104099f, 0.97608602f,
+    0.088104099f, 0.95126462f, 0.088104099f, 0.925799489f, 0.088104099f, 0.900000036f, 0.088104099f, 0.874200284f,
+    0.088104099f, 0.848735332f, 0.088104099f, 0.82391417f, 0.911895871f, 0.97608602f, 1.0f, 0.958453774f,
+    0.032335341f, 0.935270071f, 0.0477001071f, 0.910363436f, 0.0565161407f, 0.884832621f, 0.0622021556f, 0.859264255f,
+    0.0661644638f, 0.834089756f, 0.0690803528f, 0.809651732f, 0.828722119f, 0.95732367f, 0.911895871f, 0.95126462f,
+    0.967664659f, 0.935270071f, 1.0f, 0.914164126f, 0.0195733607f, 0.890694976f, 0.032335341f, 0.866226733f,
+    0.0412093401f, 0.841559172f, 0.0477001071f, 0.81723547f, 0.052638948f, 0.793648362f, 0.799810886f, 0.934734344f,
+    0.858259559f, 0.934507132f, 0.911895871f, 0.925799489f, 0.952299893f, 0.910363436f, 0.980426669f, 0.890694976f,
+    1.0f, 0.868673801f, 0.0140155554f, 0.84553498f, 0.02439785f, 0.82210815f, 0.032335341f, 0.79897511f,
+    0.0385718942f, 0.776546955f, 0.786153316f, 0.911828995f, 0.828722119f, 0.914125085f, 0.872643769f, 0.910170794f,
+    0.911895871f, 0.900000036f, 0.943483829f, 0.884832621f, 0.967664659f, 0.866226733f, 0.985984445f, 0.84553498f,
+    1.0f, 0.823791742f, 0.0109121203f, 0.801762581f, 0.0195733607f, 0.780005395f, 0.0265764892f, 0.758917451f,
+    0.778310657f, 0.889483511f, 0.811177075f, 0.892817497f, 0.846497536f, 0.891580641f, 0.881021976f, 0.885272205f,
+    0.911895871f, 0.874200284f, 0.937797844f, 0.859264255f, 0.95879066f, 0.841559172f, 0.97560215f, 0.82210815f,
+    0.98908788f, 0.801762581f, 1.0f, 0.781189799f, 0.00893270969f, 0.760892093f, 0.0163362622f, 0.741229892f,
+    0.773244023f, 0.868065298f, 0.799810886f, 0.871716976f, 0.828722119f, 0.871957958f, 0.858259559f, 0.868206382f,
+    0.886478007f, 0.860342324f, 0.911895871f, 0.848735332f, 0.933835506f, 0.834089756f, 0.952299893f, 0.81723547f,
+    0.967664659f, 0.79897511f, 0.980426669f, 0.780005395f, 0.99106729f, 0.760892093f, 1.0f, 0.742068589f,
+    0.00756072998f, 0.723848879f, 0.769707739f, 0.847764671f, 0.79192245f, 0.851359904f, 0.816141665f, 0.852350831f,
+    0.84142077f, 0.850211143f, 0.866535068f, 0.844666839f, 0.8903054f, 0.83577776f, 0.911895871f, 0.82391417f,
+    0.930919647f, 0.809651732f, 0.947361052f, 0.793648362f, 0.961428106f, 0.776546955f, 0.973423481f, 0.758917451f,
+    0.983663738f, 0.741229892f, 0.99243927f, 0.723848879f, 1.0f, 0.707039952f, 0.982454956f, 0.684872687f,
+    0.974098086f, 0.70011878f, 0.971054614f, 0.67761302f, 0.964596152f, 0.715778947f, 0.961837053f, 0.692483544f,
+    0.959344268f, 0.66914767f, 0.953780055f, 0.731589139f, 0.951435208f, 0.707622647f, 0.949334383f, 0.683485806f,
+    0.947441936f, 0.659466743f, 0.941480041f, 0.747202873f, 0.939712882f, 0.722728372f, 0.938143134f, 0.697936714f,
+    0.936739743f, 0.673131824f, 0.935477734f, 0.648617566f, 0.927548349f, 0.762196004f, 0.926555157f, 0.737422287f,
+    0.92568022f, 0.712171793f, 0.924903572f, 0.686756074f, 0.924209595f, 0.661498427f, 0.923585892f, 0.636709929f,
+    0.911895871f, 0.776085913f, 0.911895871f, 0.751264691f, 0.911895871f, 0.72579962f, 0.911895871f, 0.699999988f,
+    0.911895871f, 0.674200416f, 0.911895871f, 0.648735344f, 0.911895871f, 0.623914123f, 0.894542933f, 0.788369358f,
+    0.895754576f, 0.763786614f, 0.896808505f, 0.738390744f, 0.897733569f, 0.712479889f, 0.898552001f, 0.686390102f,
+    0.899281204f, 0.660471201f, 0.899934947f, 0.63505888f, 0.900524378f, 0.610450566f, 0.875672936f, 0.798579335f,
+    0.87827456f, 0.774538636f, 0.880532026f, 0.74951911f, 0.882508755f, 0.723800421f, 0.884253323f, 0.697710872f,
+    0.885804176f, 0.671605229f, 0.887191594f, 0.645837605f, 0.888439894f, 0.620734155f, 0.889568925f, 0.596571028f,
+    0.855667472f, 0.806353927f, 0.859749556f, 0.783151209f, 0.863296449f, 0.758814096f, 0.866404057f, 0.733599424f,
+    0.869147122f, 0.707818747f, 0.871584892f, 0.681821704f, 0.873764753f, 0.655970335f, 0.875724852f, 0.630611479f,
+    0.877496243f, 0.606051266f, 0.879104614f, 0.582537115f, 0.835092068f, 0.811499715f, 0.840617955f, 0.789392114f,
+    0.845446289f, 0.766013741f, 0.849693775f, 0.741594851f, 0.853454232f, 0.716424346f, 0.856803298f, 0.690836251f,
+    0.859802425f, 0.665189385f, 0.862501979f, 0.639840364f, 0.864943266f, 0.615117431f, 0.867160738f, 0.591298401f,
+    0.869183064f, 0.568597555f, 0.814616203f, 0.814028144f, 0.821413815f, 0.793204069f, 0.827410102f, 0.771002173f,
+    0.832724571f, 0.747624218f, 0.837457061f, 0.72333014f, 0.841691256f, 0.698430419f, 0.845496595f, 0.673269153f,
+    0.848931432f, 0.648201227f, 0.852044642f, 0.623565912f, 0.854877114f, 0.599663675f, 0.857463837f, 0.576738775f,
+    0.859834075f, 0.554971099f, 0.794890881f, 0.814145863f, 0.802683115f, 0.794707537f, 0.809643745f, 0.773822606f,
+    0.815876305f, 0.751662254f, 0.821473002f, 0.728453994f, 0.826514423f, 0.70447731f, 0.831070602f, 0.680052459f,
+    0.835201859f, 0.655520558f, 0.838960111f, 0.631220341f, 0.84239006f, 0.607464194f, 0.845530152f, 0.584519088f,
+    0.848413408f, 0.562593699f, 0.851068377f, 0.541834533f, 0.776433229f, 0.812203765f, 0.784895778f, 0.794166803f,
+    0.792563915f, 0.77465713f, 0.79951334f, 0.753814578f, 0.805817604f, 0.731831312f, 0.811545253f, 0.70895201f,
+    0.81675899f, 0.685465217f, 0.821515203f, 0.661688685f, 0.825864077f, 0.63794899f, 0.829850137f, 0.614559412f,
+    0.833512425f, 0.591799259f, 0.836885571f, 0.569899321f, 0.839999676f, 0.549033523f, 0.842881322f, 0.529318333f,
+    0.825618923f, 0.518103898f, 0.822097957f, 0.537396252f, 0.815341711f, 0.51866585f, 0.818312407f, 0.557811677f,
+    0.81133163f, 0.538530171f, 0.804453254f, 0.519176424f, 0.814235926f, 0.579231739f, 0.807025135f, 0.559501827f,
+    0.799941182f, 0.53953886f, 0.79300797f, 0.519616485f, 0.809839904f, 0.601480424f, 0.802395165f, 0.581430018f,
+    0.795105934f, 0.560966134f, 0.787996888f, 0.540380597f, 0.78108871f, 0.519967139f, 0.805092633f, 0.624325097f,
+    0.797412634f, 0.604101896f, 0.789921522f, 0.583272278f, 0.782644153f, 0.5621382f, 0.775600672f, 0.541015863f,
+    0.7688061f, 0.520211637f, 0.799959779f, 0.64748466f, 0.792046666f, 0.627247036f, 0.784360886f, 0.606207252f,
+    0.776926994f, 0.584667563f, 0.769763649f, 0.562958241f, 0.762883663f, 0.541411757f, 0.756294727f, 0.520337284f,
+    0.794404626f, 0.670644641f, 0.786264896f, 0.65054965f, 0.778396726f, 0.629465342f, 0.7708233f, 0.607683957f,
+    0.763560534f, 0.585539222f, 0.756618142f, 0.563380599f, 0.75f, 0.541546226f, 0.743705273f, 0.520337284f,
+    0.788387954f, 0.693477511f, 0.780034184f, 0.673668623f, 0.77200222f, 0.652702928f, 0.764312267f, 0.630853474f,
+    0.756976485f, 0.608445883f, 0.75f, 0.585835755f, 0.743381858f, 0.563380599f, 0.737116337f, 0.541411757f,
+    0.7311939f, 0.520211637f, 0.781869411f, 0.715665758f, 0.773321688f, 0.696261942f, 0.765151978f, 0.675562799f,
+    0.757375836f, 0.653815031f, 0.75f, 0.631326199f, 0.743023515f, 0.608445883f, 0.736439466f, 0.585539222f,
+    0.730236351f, 0.562958241f, 0.724399328f, 0.541015863f, 0.71891129f, 0.519967139f, 0.774808168f, 0.736921966f,
+    0.766095996f, 0.718010843f, 0.757823706f, 0.697700739f, 0.75f, 0.676208198f, 0.742624104f, 0.653815031f,
+    0.735687733f, 0.630853474f, 0.7291767f, 0.607683957f, 0.723073006f, 0.584667563f, 0.717355847f, 0.5621382f,
+    0.712003112f, 0.540380597f, 0.70699203f, 0.519616485f, 0.767165065f, 0.757004976f, 0.758329391f, 0.738640189f,
+    0.75f, 0.718810201f, 0.742176294f, 0.697700739f, 0.734848022f, 0.675562799f, 0.72799772f, 0.652702928f,
+    0.721603274f, 0.629465342f, 0.715639114f, 0.606207252f, 0.710078478f, 0.583272278f, 0.704894066f, 0.560966134f,
+    0.700058818f, 0.53953886f, 0.695546746f, 0.519176424f, 0.758904934f, 0.775727868f, 0.75f, 0.757931352f,
+    0.741670609f, 0.738640189f, 0.733903944f, 0.718010843f, 0.726678312f, 0.696261942f, 0.719965756f, 0.673668623f,
+    0.713735104f, 0.65054965f, 0.707953334f, 0.627247036f, 0.702587366f, 0.604101896f, 0.697604835f, 0.581430018f,
+    0.692974865f, 0.559501827f, 0.68866837f, 0.538530171f, 0.684658289f, 0.51866585f, 0.75f, 0.792960048f,
+    0.741095066f, 0.775727868f, 0.732834995f, 0.757004976f, 0.725191832f, 0.736921966f, 0.718130589f, 0.715665758f,
+    0.711612046f, 0.693477511f, 0.705595374f, 0.670644641f, 0.700040162f, 0.64748466f, 0.694907367f, 0.624325097f,
+    0.690160096f, 0.601480424f, 0.685764015f, 0.579231739f, 0.681687593f, 0.557811677f, 0.677902043f, 0.537396252f,
+    0.674381077f, 0.518103898f, 0.723566771f, 0.812203765f, 0.705109119f, 0.814145863f, 0.715104163f, 0.794166803f,
+    0.685383797f, 0.814028144f, 0.697316885f, 0.794707537f, 0.707436085f, 0.77465713f, 0.664907932f, 0.811499715f,
+    0.678586185f, 0.793204069f, 0.690356255f, 0.773822606f, 0.70048666f, 0.753814578f, 0.644332528f, 0.806353927f,
+    0.659381986f, 0.789392114f, 0.672589898f, 0.771002173f, 0.684123695f, 0.751662254f, 0.694182396f, 0.731831312f,
+    0.624327064f, 0.798579335f, 0.640250444f, 0.783151209f, 0.654553711f, 0.766013741f, 0.667275488f, 0.747624218f,
+    0.678526998f, 0.728453994f, 0.688454747f, 0.70895201f, 0.605457067f, 0.788369358f, 0.62172544f, 0.774538636f,
+    0.636703491f, 0.758814096f, 0.650306225f, 0.741594851f, 0.662542939f, 0.72333014f, 0.673485577f, 0.70447731f,
+    0.68324101f, 0.685465217f, 0.588104129f, 0.776085913f, 0.604245484f, 0.763786614f, 0.619467974f, 0.74951911f,
+    0.633595943f, 0.733599424f, 0.646545768f, 0.716424346f, 0.658308744f, 0.698430419f, 0.668929398f, 0.680052459f,
+    0.678484797f, 0.661688685f, 0.572451651f, 0.762196004f, 0.588104129f, 0.751264691f, 0.603191495f, 0.738390744f,
+    0.617491305f, 0.723800421f, 0.630852878f, 0.707818747f, 0.643196702f, 0.690836251f, 0.654503345f, 0.673269153f,
+    0.664798141f, 0.655520558f, 0.674135923f, 0.63794899f, 0.5585199f, 0.747202873f, 0.573444843f, 0.737422287f,
+    0.588104129f, 0.72579962f, 0.602266431f, 0.712479889f, 0.615746617f, 0.697710872f, 0.628415048f, 0.681821704f,
+    0.640197575f, 0.665189385f, 0.651068509f, 0.648201227f, 0.661039829f, 0.631220341f, 0.670149863f, 0.614559412f,
+    0.546219885f, 0.731589139f, 0.560287058f, 0.722728372f, 0.57431978f, 0.712171793f, 0.588104129f, 0.699999988f,
+    0.601447999f, 0.686390102f, 0.614195824f, 0.671605229f, 0.626235247f, 0.655970335f, 0.637498021f, 0.639840364f,
+    0.647955418f, 0.623565912f, 0.65760988f, 0.607464194f, 0.666487515f, 0.591799259f, 0.535403848f, 0.715778947f,
+    0.548564792f, 0.707622647f, 0.561856866f, 0.697936714f, 0.575096428f, 0.686756074f, 0.588104129f, 0.674200416f,
+    0.600718796f, 0.660471201f, 0.612808406f, 0.645837605f, 0.624275148f, 0.630611479f, 0.635056734f, 0.615117431f,
+    0.645122826f, 0.599663675f, 0.654469848f, 0.584519088f, 0.663114429f, 0.569899321f, 0.525901973f, 0.70011878f,
+    0.538162947f, 0.692483544f, 0.550665617f, 0.683485806f, 0.563260257f, 0.673131824f, 0.575790346f, 0.661498427f,
+    0.588104129f, 0.648735344f, 0.600065053f, 0.63505888f, 0.611560047f, 0.620734155f, 0.622503757f, 0.606051266f,
+    0.632839262f, 0.591298401f, 0.642536163f, 0.576738775f, 0.651586592f, 0.562593699f, 0.660000324f, 0.549033523f,
+    0.517545044f, 0.684872687f, 0.528945386f, 0.67761302f, 0.540655732f, 0.66914767f, 0.552558064f, 0.659466743f,
+    0.564522266f, 0.648617566f, 0.576414108f, 0.636709929f, 0.588104129f, 0.623914123f, 0.599475563f, 0.610450566f,
+    0.610431015f, 0.596571028f, 0.620895386f, 0.582537115f, 0.630816936f, 0.568597555f, 0.640165925f, 0.554971099f,
+    0.648931623f, 0.541834533f, 0.657118618f, 0.529318333f, 0.989823461f, 0.349026829f, 0.989823461f, 0.369554698f,
+    0.979226887f, 0.356871247f, 0.989823461f, 0.391299129f, 0.979226887f, 0.378280997f, 0.968283057f, 0.3657673f,
+    0.989823461f, 0.414151371f, 0.979226887f, 0.400913239f, 0.968282998f, 0.388023674f, 0.957082152f, 0.375705838f,
+    0.989823461f, 0.437946379f, 0.979226887f, 0.424628615f, 0.968283057f, 0.411482096f, 0.957082152f, 0.398742139f,
+    0.945728898f, 0.386627913f, 0.989823461f, 0.462463856f, 0.979226887f, 0.449226767f, 0.968282998f, 0.435968906f,
+    0.957082152f, 0.422929019f, 0.945728898f, 0.410342395f, 0.934336901f, 0.398420095f, 0.989823461f, 0.487436146f,
+    0.979226887f, 0.474450856f, 0.968282998f, 0.461247176f, 0.957082152f, 0.448057175f, 0.945728898f, 0.435123205f,
+    0.934336901f, 0.422676682f, 0.923022151f, 0.41091767f, 0.989823461f, 0.512563884f, 0.979226887f, 0.49999997f,
+    0.968283057f, 0.48702538f, 0.957082152f, 0.473854482f, 0.945728898f, 0.460726291f, 0.934336901f, 0.447883427f,
+    0.923022151f, 0.435550213f, 0.911895871f, 0.423914075f, 0.989823461f, 0.537536144f, 0.979226887f, 0.525549173f,
+    0.968283057f, 0.51297462f, 0.957082152f, 0.49999997f, 0.945728898f, 0.486849427f, 0.934336901f, 0.47376585f,
+    0.923022151f, 0.460989386f, 0.911895871f, 0.448735267f, 0.901058555f, 0.437177628f, 0.989823461f, 0.562053621f,
+    0.979226887f, 0.550773263f, 0.968282998f, 0.538752794f, 0.957082152f, 0.526145518f, 0.945728898f, 0.513150573f,
+    0.934336901f, 0.49999997f, 0.923022151f, 0.486938298f, 0.911895871f, 0.474200338f, 0.901058555f, 0.461991102f,
+    0.8905949f, 0.450471342f, 0.989823461f, 0.585848629f, 0.979226887f, 0.575371385f, 0.968282998f, 0.564031065f,
+    0.957082152f, 0.551942825f, 0.945728898f, 0.539273679f, 0.934336901f, 0.52623415f, 0.923022151f, 0.513061702f,
+    0.911895871f, 0.49999997f, 0.901058555f, 0.487276524f, 0.8905949f, 0.475084841f, 0.880571127f, 0.463572681f,
+    0.989823461f, 0.608700871f, 0.979226887f, 0.599086761f, 0.968283057f, 0.588517904f, 0.957082152f, 0.577070951f,
+    0.945728898f, 0.564876795f, 0.934336901f, 0.552116573f, 0.923022151f, 0.539010644f, 0.911895871f, 0.525799692f,
+    0.901058555f, 0.512723446f, 0.8905949f, 0.49999997f, 0.880571127f, 0.487810194f, 0.871034265f, 0.476289064f,
+    0.989823461f, 0.630445302f, 0.979226887f, 0.621719003f, 0.968282998f, 0.611976326f, 0.957082152f, 0.601257861f,
+    0.945728898f, 0.589657605f, 0.934336901f, 0.577323318f, 0.923022151f, 0.564449787f, 0.911895871f, 0.551264763f,
+    0.901058555f, 0.538008928f, 0.8905949f, 0.524915159f, 0.880571127f, 0.512189806f, 0.871034265f, 0.49999997f,
+    0.862013102f, 0.488467932f, 0.989823461f, 0.650973201f, 0.979226887f, 0.643128753f, 0.968283057f, 0.6342327f,
+    0.957082152f, 0.624294162f, 0.945728898f, 0.613372087f, 0.934336901f, 0.601579905f, 0.923022151f, 0.589082301f,
+    0.911895871f, 0.576085925f, 0.901058555f, 0.562822342f, 0.8905949f, 0.549528658f, 0.880571127f, 0.536427319f,
+    0.871034265f, 0.523710907f, 0.862013102f, 0.511532068f, 0.853519917f, 0.49999997f, 0.0101765692f, 0.349026829f,
+    0.0207731128f, 0.356871247f, 0.0101765692f, 0.369554698f, 0.0317169726f, 0.3657673f, 0.0207731128f, 0.378280997f,
+    0.0101765692f, 0.391299129f, 0.0429178774f, 0.375705838f, 0.0317170024f, 0.388023674f, 0.0207731128f, 0.400913239f,
+    0.0101765692f, 0.414151371f, 0.0542711318f, 0.386627913f, 0.0429178774f, 0.398742139f, 0.0317169726f, 0.411482096f,
+    0.0207731128f, 0.424628615f, 0.0101765692f, 0.437946379f, 0.0656630993f, 0.398420095f, 0.0542711318f, 0.410342395f,
+    0.0429178774f, 0.422929019f, 0.0317170024f, 0.435968906f, 0.0207731128f, 0.449226767f, 0.0101765692f, 0.462463856f,
+    0.0769778788f, 0.41091767f, 0.0656630993f, 0.422676682f, 0.0542711318f, 0.435123205f, 0.0429178774f, 0.448057175f,
+    0.0317170024f, 0.461247176f, 0.0207731128f, 0.474450856f, 0.0101765692f, 0.487436146f, 0.088104099f, 0.423914075f,
+    0.0769778788f, 0.435550213f, 0.0656630993f, 0.447883427f, 0.0542711318f, 0.460726291f, 0.0429178774f, 0.473854482f,
+    0.0317169726f, 0.48702538f, 0.0207731128f, 0.49999997f, 0.0101765692f, 0.512563884f, 0.0989414155f, 0.437177628f,
+    0.088104099f, 0.448735267f, 0.0769778788f, 0.460989386f, 0.0656630993f, 0.47376585f, 0.0542711318f, 0.486849427f,
+    0.0429178774f, 0.49999997f, 0.0317169726f, 0.51297462f, 0.0207731128f, 0.525549173f, 0.0101765692f, 0.537536144f,
+    0.1094051f, 0.450471342f, 0.0989414155f, 0.461991102f, 0.088104099f, 0.474200338f, 0.0769778788f, 0.486938298f,
+    0.0656630993f, 0.49999997f, 0.0542711318f, 0.513150573f, 0.0429178774f, 0.526145518f, 0.0317170024f, 0.538752794f,
+    0.0207731128f, 0.550773263f, 0.0101765692f, 0.562053621f, 0.119428843f, 0.463572681f, 0.1094051f, 0.475084841f,
+    0.0989414155f, 0.487276524f, 0.088104099f, 0.49999997f, 0.0769778788f, 0.513061702f, 0.0656630993f, 0.52623415f,
+    0.0542711318f, 0.539273679f, 0.0429178774f, 0.551942825f, 0.0317170024f, 0.564031065f, 0.0207731128f, 0.575371385f,
+    0.0101765692f, 0.585848629f, 0.128965706f, 0.476289064f, 0.119428843f, 0.487810194f, 0.1094051f, 0.49999997f,
+    0.0989414155f, 0.512723446f, 0.088104099f, 0.525799692f, 0.0769778788f, 0.539010644f, 0.0656630993f, 0.552116573f,
+    0.0542711318f, 0.564876795f, 0.0429178774f, 0.577070951f, 0.0317169726f, 0.588517904f, 0.0207731128f, 0.599086761f,
+    0.0101765692f, 0.608700871f, 0.137986928f, 0.488467932f, 0.128965706f, 0.49999997f, 0.119428843f, 0.512189806f,
+    0.1094051f, 0.524915159f, 0.0989414155f, 0.538008928f, 0.088104099f, 0.551264763f, 0.0769778788f, 0.564449787f,
+    0.0656630993f, 0.577323318f, 0.0542711318f, 0.589657605f, 0.0429178774f, 0.601257861f, 0.0317170024f, 0.611976326f,
+    0.0207731128f, 0.621719003f, 0.0101765692f, 0.630445302f, 0.146480054f, 0.49999997f, 0.137986928f, 0.511532068f,
+    0.128965706f, 0.523710907f, 0.119428843f, 0.536427319f, 0.1094051f, 0.549528658f, 0.0989414155f, 0.562822342f,
+    0.088104099f, 0.576085925f, 0.0769778788f, 0.589082301f, 0.0656630993f, 0.601579905f, 0.0542711318f, 0.613372087f,
+    0.0429178774f, 0.624294162f, 0.0317169726f, 0.6342327f, 0.0207731128f, 0.643128753f, 0.0101765692f, 0.650973201f,
+    0.0175450444f, 0.315127313f, 0.0259019434f, 0.29988122f, 0.0289453864f, 0.32238698f, 0.0354038775f, 0.284221053f,
+    0.0381629169f, 0.307516456f, 0.0406557322f, 0.33085233f, 0.046219945f, 0.268410861f, 0.0485647619f, 0.292377383f,
+    0.050665617f, 0.316514194f, 0.0525580347f, 0.340533227f, 0.0585199296f, 0.252797127f, 0.0602870882f, 0.277271658f,
+    0.0618568659f, 0.302063286f, 0.0632602572f, 0.326868147f, 0.0645222962f, 0.351382434f, 0.0724516511f, 0.237803996f,
+    0.0734448433f, 0.262577713f, 0.0743197799f, 0.287828207f, 0.0750964284f, 0.313243926f, 0.0757903755f, 0.338501573f,
+    0.0764141381f, 0.363290071f, 0.088104099f, 0.223914087f, 0.088104099f, 0.248735279f, 0.088104099f, 0.27420038f,
+    0.088104099f, 0.300000012f, 0.088104099f, 0.325799584f, 0.088104099f, 0.351264656f, 0.088104099f, 0.376085877f,
+    0.105457067f, 0.211630642f, 0.104245454f, 0.236213386f, 0.103191525f, 0.261609256f, 0.102266461f, 0.287520111f,
+    0.101447999f, 0.313609898f, 0.100718796f, 0.339528799f, 0.100065053f, 0.36494112f, 0.0994755924f, 0.389549434f,
+    0.124327093f, 0.201420635f, 0.12172547f, 0.225461364f, 0.119467944f, 0.25048089f, 0.117491275f, 0.276199579f,
+    0.115746677f, 0.302289128f, 0.114195794f, 0.3283948f, 0.112808406f, 0.354162395f, 0.111560076f, 0.379265815f,
+    0.110431045f, 0.403428942f, 0.144332498f, 0.193646073f, 0.140250415f, 0.216848791f, 0.136703551f, 0.241185874f,
+    0.133595973f, 0.266400576f, 0.130852878f, 0.292181253f, 0.128415078f, 0.318178326f, 0.126235217f, 0.344029665f,
+    0.124275148f, 0.369388521f, 0.122503728f, 0.393948764f, 0.120895386f, 0.417462885f, 0.164907962f, 0.188500255f,
+    0.159382045f, 0.210607886f, 0.154553711f, 0.233986288f, 0.150306255f, 0.258405149f, 0.146545798f, 0.283575654f,
+    0.143196732f, 0.309163749f, 0.140197575f, 0.334810615f, 0.137498051f, 0.360159665f, 0.135056704f, 0.384882569f,
+    0.132839262f, 0.408701628f, 0.130816936f, 0.431402445f, 0.185383767f, 0.185971886f, 0.178586185f, 0.206795901f,
+    0.172589898f, 0.228997797f, 0.167275459f, 0.252375782f, 0.162542909f, 0.27666986f, 0.158308744f, 0.301569581f,
+    0.154503405f, 0.326730847f, 0.151068538f, 0.351798773f, 0.147955358f, 0.376434058f, 0.145122856f, 0.400336325f,
+    0.142536193f, 0.423261225f, 0.140165925f, 0.445028901f, 0.20510909f, 0.185854137f, 0.197316855f, 0.205292463f,
+    0.190356284f, 0.226177394f, 0.184123695f, 0.248337716f, 0.178527027f, 0.271546006f, 0.173485577f, 0.29552266f,
+    0.168929398f, 0.319947541f, 0.16479817f, 0.344479442f, 0.161039889f, 0.368779659f, 0.15760991f, 0.392535776f,
+    0.154469848f, 0.415480912f, 0.151586592f, 0.437406331f, 0.148931593f, 0.458165467f, 0.2235668f, 0.187796235f,
+    0.215104192f, 0.205833226f, 0.207436115f, 0.22534284f, 0.20048666f, 0.246185452f, 0.194182396f, 0.268168688f,
+    0.188454747f, 0.29104799f, 0.18324101f, 0.314534783f, 0.178484797f, 0.338311315f, 0.174135894f, 0.36205098f,
+    0.170149863f, 0.385440588f, 0.166487545f, 0.408200741f, 0.163114429f, 0.430100679f, 0.160000324f, 0.450966448f,
+    0.157118648f, 0.470681667f, 0.2235668f, 0.812203765f, 0.20510909f, 0.814145863f, 0.215104192f, 0.794166803f,
+    0.185383767f, 0.814028144f, 0.197316855f, 0.794707537f, 0.207436115f, 0.77465713f, 0.164907962f, 0.811499715f,
+    0.178586185f, 0.793204069f, 0.190356284f, 0.773822606f, 0.20048666f, 0.753814578f, 0.144332498f, 0.806353927f,
+    0.159382045f, 0.789392114f, 0.172589898f, 0.771002173f, 0.184123695f, 0.751662254f, 0.194182396f, 0.731831312f,
+    0.124327093f, 0.798579335f, 0.140250415f, 0.783151209f, 0.154553711f, 0.766013741f, 0.167275459f, 0.747624218f,
+    0.178527027f, 0.728453994f, 0.188454747f, 0.70895201f, 0.105457067f, 0.788369358f, 0.12172547f, 0.774538636f,
+    0.136703551f, 0.758814096f, 0.150306255f, 0.741594851f, 0.162542909f, 0.72333014f, 0.173485577f, 0.70447731f,
+    0.18324101f, 0.685465217f, 0.088104099f, 0.776085913f, 0.104245454f, 0.763786614f, 0.119467944f, 0.74951911f,
+    0.133595973f, 0.733599424f, 0.146545798f, 0.716424346f, 0.158308744f, 0.698430419f, 0.168929398f, 0.680052459f,
+    0.178484797f, 0.661688685f, 0.0724516511f, 0.762196004f, 0.088104099f, 0.751264691f, 0.103191525f, 0.738390744f,
+    0.117491275f, 0.723800421f, 0.130852878f, 0.707818747f, 0.143196732f, 0.690836251f, 0.154503405f, 0.673269153f,
+    0.16479817f, 0.655520558f, 0.174135894f, 0.63794899f, 0.0585199296f, 0.747202873f, 0.0734448433f, 0.737422287f,
+    0.088104099f, 0.72579962f, 0.102266461f, 0.712479889f, 0.115746677f, 0.697710872f, 0.128415078f, 0.681821704f,
+    0.140197575f, 0.665189385f, 0.151068538f, 0.648201227f, 0.161039889f, 0.631220341f, 0.170149863f, 0.614559412f,
+    0.046219945f, 0.731589139f, 0.0602870882f, 0.722728372f, 0.0743197799f, 0.712171793f, 0.088104099f, 0.699999988f,
+    0.101447999f, 0.686390102f, 0.114195794f, 0.671605229f, 0.126235217f, 0.655970335f, 0.137498051f, 0.639840364f,
+    0.147955358f, 0.623565912f, 0.15760991f, 0.607464194f, 0.166487545f, 0.591799259f, 0.0354038775f, 0.715778947f,
+    0.0485647619f, 0.707622647f, 0.0618568659f, 0.697936714f, 0.0750964284f, 0.686756074f, 0.088104099f, 0.674200416f,
+    0.100718796f, 0.660471201f, 0.112808406f, 0.645837605f, 0.124275148f, 0.630611479f, 0.135056704f, 0.615117431f,
+    0.145122856f, 0.599663675f, 0.154469848f, 0.584519088f, 0.163114429f, 0.569899321f, 0.0259019434f, 0.70011878f,
+    0.0381629169f, 0.692483544f, 0.050665617f, 0.683485806f, 0.0632602572f, 0.673131824f, 0.0757903755f, 0.661498427f,
+    0.088104099f, 0.648735344f, 0.100065053f, 0.63505888f, 0.111560076f, 0.620734155f, 0.122503728f, 0.606051266f,
+    0.132839262f, 0.591298401f, 0.142536193f, 0.576738775f, 0.151586592f, 0.562593699f, 0.160000324f, 0.549033523f,
+    0.0175450444f, 0.684872687f, 0.0289453864f, 0.67761302f, 0.0406557322f, 0.66914767f, 0.0525580347f, 0.659466743f,
+    0.0645222962f, 0.648617566f, 0.0764141381f, 0.636709929f, 0.088104099f, 0.623914123f, 0.0994755924f, 0.610450566f,
+    0.110431045f, 0.596571028f, 0.120895386f, 0.582537115f, 0.130816936f, 0.568597555f, 0.140165925f, 0.554971099f,
+    0.148931593f, 0.541834533f, 0.157118648f, 0.529318333f, 1.00655389f, 0.309017658f, 1.01401556f, 0.293555319f,
+    1.00756073f, 0.276151121f, 1.0163362f, 0.258770108f, 1.00893271f, 0.239107907f, 1.01957333f, 0.219994605f,
+    1.01091218f, 0.198237419f, 1.02439785f, 0.17789185f, 1.01401556f, 0.15446502f, 1.03233528f, 0.133773267f,
+    1.01957333f, 0.109305024f, 1.04770017f, 0.0896365941f, 1.03233528f, 0.0647299588f, 1.08810413f, 0.0487353802f,
+    1.08810413f, 0.0239140093f, 1.08810413f, 0.97608602f, 1.08810413f, 0.95126462f, 1.03233528f, 0.935270071f,
+    1.04770017f, 0.910363436f, 1.01957333f, 0.890694976f, 1.03233528f, 0.866226733f, 1.01401556f, 0.84553498f,
+    1.02439785f, 0.82210815f, 1.01091218f, 0.801762581f, 1.01957333f, 0.780005395f, 1.00893271f, 0.760892093f,
+    1.0163362f, 0.741229892f, 1.00756073f, 0.723848879f, 1.01401556f, 0.706444681f, 1.00655389f, 0.690982342f,
+    1.01017654f, 0.329772294f, 1.01017654f, 0.349026829f, 1.01017654f, 0.369554698f, 1.01017654f, 0.391299129f,
+    1.01017654f, 0.414151371f, 1.01017654f, 0.437946379f, 1.01017654f, 0.462463856f, 1.01017654f, 0.487436146f,
+    1.01017654f, 0.512563884f, 1.01017654f, 0.537536144f, 1.01017654f, 0.562053621f, 1.01017654f, 0.585848629f,
+    1.01017654f, 0.608700871f, 1.01017654f, 0.630445302f, 1.01017654f, 0.650973201f, 1.01017654f, 0.670227706f,
+    0.830947936f, 0.000109910965f, 1.0f, 0.000109910965f, 0.16905205f, 0.000109910965f, 0.669052005f, 0.000109910965f,
+    0.5f, 0.000109910965f, 0.330947965f, 0.000109910965f, 0.330947965f, 0.999890089f, 0.5f, 0.999890089f,
+    0.669052005f, 0.999890089f, 0.16905205f, 0.999890089f, 0.830947936f, 0.999890089f, 1.0f, 0.999890089f
+};
+const uint16_t STATIC_ICOSPHERE_4_WELDED_INDICES[] =
+{
+    0, 12, 42, 12, 13, 462, 12, 462,
+    42, 42, 462, 43, 13, 14, 463, 13,
+    463, 462, 462, 463, 464, 462, 464, 43,
+    43, 464, 44, 14, 15, 465, 14, 465,
+    463, 463, 465, 466, 463, 466, 464, 464,
+    466, 467, 464, 467, 44, 44, 467, 45,
+    15, 16, 468, 15, 468, 465, 465, 468,
+    469, 465, 469, 466, 466, 469, 470, 466,
+    470, 467, 467, 470, 471, 467, 471, 45,
+    45, 471, 46, 16, 17, 472, 16, 472,
+    468, 468, 472, 473, 468, 473, 469, 469,
+    473, 474, 469, 474, 470, 470, 474, 475,
+    470, 475, 471, 471, 475, 476, 471, 476,
+    46, 46, 476, 47, 17, 18, 477, 17,
+    477, 472, 472, 477, 478, 472, 478, 473,
+    473, 478, 479, 473, 479, 474, 474, 479,
+    480, 474, 480, 475, 475, 480, 481, 475,
+    481, 476, 476, 481, 482, 476, 482, 47,
+    47, 482, 48, 18, 19, 483, 18, 483,
+    477, 477, 483, 484, 477, 484, 478, 478,
+    484, 485, 478, 485, 479, 479, 485, 486,
+    479, 486, 480, 480, 486, 487, 480, 487,
+    481, 481, 487, 488, 481, 488, 482, 482,
+    488, 489, 482, 489, 48, 48, 489, 49,
+    19, 20, 490, 19, 490, 483, 483, 490,
+    491, 483, 491, 484, 484, 491, 492, 484,
+    492, 485, 485, 492, 493, 485, 493, 486,
+    486, 493, 494, 486, 494, 487, 487, 494,
+    495, 487, 495, 488, 488, 495, 496, 488,
+    496, 489, 489, 496, 497, 489, 497, 49,
+    49, 497, 50, 20, 21, 498, 20, 498,
+    490, 490, 498, 499, 490, 499, 491, 491,
+    499, 500, 491, 500, 492, 492, 500, 501,
+    492, 501, 493, 493, 501, 502, 493, 502,
+    494, 494, 502, 503, 494, 503, 495, 495,
+    503, 504, 495, 504, 496, 496, 504, 505,
+    496, 505, 497, 497, 505, 506, 497, 506,
+    50, 50, 506, 51, 21, 22, 507, 21,
+    507, 498, 498, 507, 508, 498, 508, 499,
+    499, 508, 509, 499, 509, 500, 500, 509,
+    510, 500, 510, 501, 501, 510, 511, 501,
+    511, 502, 502, 511, 512, 502, 512, 503,
+    503, 512, 513, 503, 513, 504, 504, 513,
+    514, 504, 514, 505, 505, 514, 515, 505,
+    515, 506, 506, 515, 516, 506, 516, 51,
+    51, 516, 52, 22, 23, 517, 22, 517,
+    507, 507, 517, 518, 507, 518, 508, 508,
+    518, 519, 508, 519, 509, 509, 519, 520,
+    509, 520, 510, 510, 520, 521, 510, 521,
+    511, 511, 521, 522, 511, 522, 512, 512,
+    522, 523, 512, 523, 513, 513, 523, 524,
+    513, 524, 514, 514, 524, 525, 514, 525,
+    515, 515, 525, 526, 515, 526, 516, 516,
+    526, 527, 516, 527, 52, 52, 527, 53,
+    23, 24, 528, 23, 528, 517, 517, 528,
+    529, 517, 529, 518, 518, 529, 530, 518,
+    530, 519, 519, 530, 531, 519, 531, 520,
+    520, 531, 532, 520, 532, 521, 521, 532,
+    533, 521, 533, 522, 522, 533, 534, 522,
+    534, 523, 523, 534, 535, 523, 535, 524,
+    524, 535, 536, 524, 536, 525, 525, 536,
+    537, 525, 537, 526, 526, 537, 538, 526,
+    538, 527, 527, 538, 539, 527, 539, 53,
+    53, 539, 54, 24, 25, 540, 24, 540,
+    528, 528, 540, 541, 528, 541, 529, 529,
+    541, 542, 529, 542, 530, 530, 542, 543,
+    530, 543, 531, 531, 543, 544, 531, 544,
+    532, 532, 544, 545, 532, 545, 533, 533,
+    545, 546, 533, 546, 534, 534, 546, 547,
+    534, 547, 535, 535, 547, 548, 535, 548,
+    536, 536, 548, 549, 536, 549, 537, 537,
+    549, 550, 537, 550, 538, 538, 550, 551,
+    538, 551, 539, 539, 551, 552, 539, 552,
+    54, 54, 552, 55, 25, 26, 553, 25,
+    553, 540, 540, 553, 554, 540, 554, 541,
+    541, 554, 555, 541, 555, 542, 542, 555,
+    556, 542, 556, 543, 543, 556, 557, 543,
+    557, 544, 544, 557, 558, 544, 558, 545,
+    545, 558, 559, 545, 559, 546, 546, 559,
+    560, 546, 560, 547, 547, 560, 561, 547,
+    561, 548, 548, 561, 562, 548, 562, 549,
+    549, 562, 563, 549, 563, 550, 550, 563,
+    564, 550, 564, 551, 551, 564, 565, 551,
+    565, 552, 552, 565, 566, 552, 566, 55,
+    55, 566, 56, 26, 1, 27, 26, 27,
+    553, 553, 27, 28, 553, 28, 554, 554,
+    28, 29, 554, 29, 555, 555, 29, 30,
+    555, 30, 556, 556, 30, 31, 556, 31,
+    557, 557, 31, 32, 557, 32, 558, 558,
+    32, 33, 558, 33, 559, 559, 33, 34,
+    559, 34, 560, 560, 34, 35, 560, 35,
+    561, 561, 35, 36, 561, 36, 562, 562,
+    36, 37, 562, 37, 563, 563, 37, 38,
+    563, 38, 564, 564, 38, 39, 564, 39,
+    565, 565, 39, 40, 565, 40, 566, 566,
+    40, 41, 566, 41, 56, 56, 41, 4,
+    0, 42, 72, 42, 43, 567, 42, 567,
+    72, 72, 567, 73, 43, 44, 568, 43,
+    568, 567, 567, 568, 569, 567, 569, 73,
+    73, 569, 74, 44, 45, 570, 44, 570,
+    568, 568, 570, 571, 568, 571, 569, 569,
+    571, 572, 569, 572, 74, 74, 572, 75,
+    45, 46, 573, 45, 573, 570, 570, 573,
+    574, 570, 574, 571, 571, 574, 575, 571,
+    575, 572, 572, 575, 576, 572, 576, 75,
+    75, 576, 76, 46, 47, 577, 46, 577,
+    573, 573, 577, 578, 573, 578, 574, 574,
+    578, 579, 574, 579, 575, 575, 579, 580,
+    575, 580, 576, 576, 580, 581, 576, 581,
+    76, 76, 581, 77, 47, 48, 582, 47,
+    582, 577, 577, 582, 583, 577, 583, 578,
+    578, 583, 584, 578, 584, 579, 579, 584,
+    585, 579, 585, 580, 580, 585, 586, 580,
+    586, 581, 581, 586, 587, 581, 587, 77,
+    77, 587, 78, 48, 49, 588, 48, 588,
+    582, 582, 588, 589, 582, 589, 583, 583,
+    589, 590, 583, 590, 584, 584, 590, 591,
+    584, 591, 585, 585, 591, 592, 585, 592,
+    586, 586, 592, 593, 586, 593, 587, 587,
+    593, 594, 587, 594, 78, 78, 594, 79,
+    49, 50, 595, 49, 595, 588, 588, 595,
+    596, 588, 596, 589, 589, 596, 597, 589,
+    597, 590, 590, 597, 598, 590, 598, 591,
+    591, 598, 599, 591, 599, 592, 592, 599,
+    600, 592, 600, 593, 593, 600, 601, 593,
+    601, 594, 594, 601, 602, 594, 602, 79,
+    79, 602, 80, 50, 51, 603, 50, 603,
+    595, 595, 603, 604, 595, 604, 596, 596,
+    604, 605, 596, 605, 597, 597, 605, 606,
+    597, 606, 598, 598, 606, 607, 598, 607,
+    599, 599, 607, 608, 599, 608, 600, 600,
+    608, 609, 600, 609, 601, 601, 609, 610,
+    601, 610, 602, 602, 610, 611, 602, 611,
+    80, 80, 611, 81, 51, 52, 612, 51,
+    612, 603, 603, 612, 613, 603, 613, 604,
+    604, 613, 614, 604, 614, 605, 605, 614,
+    615, 605, 615, 606, 606, 615, 616, 606,
+    616, 607, 607, 616, 617, 607, 617, 608,
+    608, 617, 618, 608, 618, 609, 609, 618,
+    619, 609, 619, 610, 610, 619, 620, 610,
+    620, 611, 611, 620, 621, 611, 621, 81,
+    81, 621, 82, 52, 53, 622, 52, 622,
+    612, 612, 622, 623, 612, 623, 613, 613,
+    623, 624, 613, 624, 614, 614, 624, 625,
+    614, 625, 615, 615, 625, 626, 615, 626,
+    616, 616, 626, 627, 616, 627, 617, 617,
+    627, 628, 617, 628, 618, 618, 628, 629,
+    618, 629, 619, 619, 629, 630, 619, 630,
+    620, 620, 630, 631, 620, 631, 621, 621,
+    631, 632, 621, 632, 82, 82, 632, 83,
+    53, 54, 633, 53, 633, 622, 622, 633,
+    634, 622, 634, 623, 623, 634, 635, 623,
+    635, 624, 624, 635, 636, 624, 636, 625,
+    625, 636, 637, 625, 637, 626, 626, 637,
+    638, 626, 638, 627, 627, 638, 639, 627,
+    639, 628, 628, 639, 640, 628, 640, 629,
+    629, 640, 641, 629, 641, 630, 630, 641,
+    642, 630, 642, 631, 631, 642, 643, 631,
+    643, 632, 632, 643, 644, 632, 644, 83,
+    83, 644, 84, 54, 55, 645, 54, 645,
+    633, 633, 645, 646, 633, 646, 634, 634,
+    646, 647, 634, 647, 635, 635, 647, 648,
+    635, 648, 636, 636, 648, 649, 636, 649,
+    637, 637, 649, 650, 637, 650, 638, 638,
+    650, 651, 638, 651, 639, 639, 651, 652,
+    639, 652, 640, 640, 652, 653, 640, 653,
+    641, 641, 653, 654, 641, 654, 642, 642,
+    654, 655, 642, 655, 643, 643, 655, 656,
+    643, 656, 644, 644, 656, 657, 644, 657,
+    84, 84, 657, 85, 55, 56, 658, 55,
+    658, 645, 645, 658, 659, 645, 659, 646,
+    646, 659, 660, 646, 660, 647, 647, 660,
+    661, 647, 661, 648, 648, 661, 662, 648,
+    662, 649, 649, 662, 663, 649, 663, 650,
+    650, 663, 664, 650, 664, 651, 651, 664,
+    665, 651, 665, 652, 652, 665, 666, 652,
+    666, 653, 653, 666, 667, 653, 667, 654,
+    654, 667, 668, 654, 668, 655, 655, 668,
+    669, 655, 669, 656, 656, 669, 670, 656,
+    670, 657, 657, 670, 671, 657, 671, 85,
+    85, 671, 86, 56, 4, 57, 56, 57,
+    658, 658, 57, 58, 658, 58, 659, 659,
+    58, 59, 659, 59, 660, 660, 59, 60,
+    660, 60, 661, 661, 60, 61, 661, 61,
+    662, 662, 61, 62, 662, 62, 663, 663,
+    62, 63, 663, 63, 664, 664, 63, 64,
+    664, 64, 665, 665, 64, 65, 665, 65,
+    666, 666, 65, 66, 666, 66, 667, 667,
+    66, 67, 667, 67, 668, 668, 67, 68,
+    668, 68, 669, 669, 68, 69, 669, 69,
+    670, 670, 69, 70, 670, 70, 671, 671,
+    70, 71, 671, 71, 86, 86, 71, 9,
+    9, 71, 102, 71, 70, 672, 71, 672,
+    102, 102, 672, 103, 70, 69, 673, 70,
+    673, 672, 672, 673, 674, 672, 674, 103,
+    103, 674, 104, 69, 68, 675, 69, 675,
+    673, 673, 675, 676, 673, 676, 674, 674,
+    676, 677, 674, 677, 104, 104, 677, 105,
+    68, 67, 678, 68, 678, 675, 675, 678,
+    679, 675, 679, 676, 676, 679, 680, 676,
+    680, 677, 677, 680, 681, 677, 681, 105,
+    105, 681, 106, 67, 66, 682, 67, 682,
+    678, 678, 682, 683, 678, 683, 679, 679,
+    683, 684, 679, 684, 680, 680, 684, 685,
+    680, 685, 681, 681, 685, 686, 681, 686,
+    106, 106, 686, 107, 66, 65, 687, 66,
+    687, 682, 682, 687, 688, 682, 688, 683,
+    683, 688, 689, 683, 689, 684, 684, 689,
+    690, 684, 690, 685, 685, 690, 691, 685,
+    691, 686, 686, 691, 692, 686, 692, 107,
+    107, 692, 108, 65, 64, 693, 65, 693,
+    687, 687, 693, 694, 687, 694, 688, 688,
+    694, 695, 688, 695, 689, 689, 695, 696,
+    689, 696, 690, 690, 696, 697, 690, 697,
+    691, 691, 697, 698, 691, 698, 692, 692,
+    698, 699, 692, 699, 108, 108, 699, 109,
+    64, 63, 700, 64, 700, 693, 693, 700,
+    701, 693, 701, 694, 694, 701, 702, 694,
+    702, 695, 695, 702, 703, 695, 703, 696,
+    696, 703, 704, 696, 704, 697, 697, 704,
+    705, 697, 705, 698, 698, 705, 706, 698,
+    706, 699, 699, 706, 707, 699, 707, 109,
+    109, 707, 110, 63, 62, 708, 63, 708,
+    700, 700, 708, 709, 700, 709, 701, 701,
+    709, 710, 701, 710, 702, 702, 710, 711,
+    702, 711, 703, 703, 711, 712, 703, 712,
+    704, 704, 712, 713, 704, 713, 705, 705,
+    713, 714, 705, 714, 706, 706, 714, 715,
+    706, 715, 707, 707, 715, 716, 707, 716,
+    110, 110, 716, 111, 62, 61, 717, 62,
+    717, 708, 708, 717, 718, 708, 718, 709,
+    709, 718, 719, 709, 719, 710, 710, 719,
+    720, 710, 720, 711, 711, 720, 721, 711,
+    721, 712, 712, 721, 722, 712, 722, 713,
+    713, 722, 723, 713, 723, 714, 714, 723,
+    724, 714, 724, 715, 715, 724, 725, 715,
+    725, 716, 716, 725, 726, 716, 726, 111,
+    111, 726, 112, 61, 60, 727, 61, 727,
+    717, 717, 727, 728, 717, 728, 718, 718,
+    728, 729, 718, 729, 719, 719, 729, 730,
+    719, 730, 720, 720, 730, 731, 720, 731,
+    721, 721, 731, 732, 721, 732, 722, 722,
+    732, 733, 722, 733, 723, 723, 733, 734,
+    723, 734, 724, 724, 734, 735, 724, 735,
+    725, 725, 735, 736, 725, 736, 726, 726,
+    736, 737, 726, 737, 112, 112, 737, 113,
+    60, 59, 738, 60, 738, 727, 727, 738,
+    739, 727, 739, 728, 728, 739, 740, 728,
+    740, 729, 729, 740, 741, 729, 741, 730,
+    730, 741, 742, 730, 742, 731, 731, 742,
+    743, 731, 743, 732, 732, 743, 744, 732,
+    744, 733, 733, 744, 745, 733, 745, 734,
+    734, 745, 746, 734, 746, 735, 735, 746,
+    747, 735, 747, 736, 736, 747, 748, 736,
+    748, 737, 737, 748, 749, 737, 749, 113,
+    113, 749, 114, 59, 58, 750, 59, 750,
+    738, 738, 750, 751, 738, 751, 739, 739,
+    751, 752, 739, 752, 740, 740, 752, 753,
+    740, 753, 741, 741, 753, 754, 741, 754,
+    742, 742, 754, 755, 742, 755, 743, 743,
+    755, 756, 743, 756, 744, 744, 756, 757,
+    744, 757, 745, 745, 757, 758, 745, 758,
+    746, 746, 758, 759, 746, 759, 747, 747,
+    759, 760, 747, 760, 748, 748, 760, 761,
+    748, 761, 749, 749, 761, 762, 749, 762,
+    114, 114, 762, 115, 58, 57, 763, 58,
+    763, 750, 750, 763, 764, 750, 764, 751,
+    751, 764, 765, 751, 765, 752, 752, 765,
+    766, 752, 766, 753, 753, 766, 767, 753,
+    767, 754, 754, 767, 768, 754, 768, 755,
+    755, 768, 769, 755, 769, 756, 756, 769,
+    770, 756, 770, 757, 757, 770, 771, 757,
+    771, 758, 758, 771, 772, 758, 772, 759,
+    759, 772, 773, 759, 773, 760, 760, 773,
+    774, 760, 774, 761, 761, 774, 775, 761,
+    775, 762, 762, 775, 776, 762, 776, 115,
+    115, 776, 116, 57, 4, 87, 57, 87,
+    763, 763, 87, 88, 763, 88, 764, 764,
+    88, 89, 764, 89, 765, 765, 89, 90,
+    765, 90, 766, 766, 90, 91, 766, 91,
+    767, 767, 91, 92, 767, 92, 768, 768,
+    92, 93, 768, 93, 769, 769, 93, 94,
+    769, 94, 770, 770, 94, 95, 770, 95,
+    771, 771, 95, 96, 771, 96, 772, 772,
+    96, 97, 772, 97, 773, 773, 97, 98,
+    773, 98, 774, 774, 98, 99, 774, 99,
+    775, 775, 99, 100, 775, 100, 776, 776,
+    100, 101, 776, 101, 116, 116, 101, 5,
+    4, 117, 87, 117, 118, 777, 117, 777,
+    87, 87, 777, 88, 118, 119, 778, 118,
+    778, 777, 777, 778, 779, 777, 779, 88,
+    88, 779, 89, 119, 120, 780, 119, 780,
+    778, 778, 780, 781, 778, 781, 779, 779,
+    781, 782, 779, 782, 89, 89, 782, 90,
+    120, 121, 783, 120, 783, 780, 780, 783,
+    784, 780, 784, 781, 781, 784, 785, 781,
+    785, 782, 782, 785, 786, 782, 786, 90,
+    90, 786, 91, 121, 122, 787, 121, 787,
+    783, 783, 787, 788, 783, 788, 784, 784,
+    788, 789, 784, 789, 785, 785, 789, 790,
+    785, 790, 786, 786, 790, 791, 786, 791,
+    91, 91, 791, 92, 122, 123, 792, 122,
+    792, 787, 787, 792, 793, 787, 793, 788,
+    788, 793, 794, 788, 794, 789, 789, 794,
+    795, 789, 795, 790, 790, 795, 796, 790,
+    796, 791, 791, 796, 797, 791, 797, 92,
+    92, 797, 93, 123, 124, 798, 123, 798,
+    792, 792, 798, 799, 792, 799, 793, 793,
+    799, 800, 793, 800, 794, 794, 800, 801,
+    794, 801, 795, 795, 801, 802, 795, 802,
+    796, 796, 802, 803, 796, 803, 797, 797,
+    803, 804, 797, 804, 93, 93, 804, 94,
+    124, 125, 805, 124, 805, 798, 798, 805,
+    806, 798, 806, 799, 799, 806, 807, 799,
+    807, 800, 800, 807, 808, 800, 808, 801,
+    801, 808, 809, 801, 809, 802, 802, 809,
+    810, 802, 810, 803, 803, 810, 811, 803,
+    811, 804, 804, 811, 812, 804, 812, 94,
+    94, 812, 95, 125, 126, 813, 125, 813,
+    805, 805, 813, 814, 805, 814, 806, 806,
+    814, 815, 806, 815, 807, 807, 815, 816,
+    807, 816, 808, 808, 816, 817, 808, 817,
+    809, 809, 817, 818, 809, 818, 810, 810,
+    818, 819, 810, 819, 811, 811, 819, 820,
+    811, 820, 812, 812, 820, 821, 812, 821,
+    95, 95, 821, 96, 126, 127, 822, 126,
+    822, 813, 813, 822, 823, 813, 823, 814,
+    814, 823, 824, 814, 824, 815, 815, 824,
+    825, 815, 825, 816, 816, 825, 826, 816,
+    826, 817, 817, 826, 827, 817, 827, 818,
+    818, 827, 828, 818, 828, 819, 819, 828,
+    829, 819, 829, 820, 820, 829, 830, 820,
+    830, 821, 821, 830, 831, 821, 831, 96,
+    96, 831, 97, 127, 128, 832, 127, 832,
+    822, 822, 832, 833, 822, 833, 823, 823,
+    833, 834, 823, 834, 824, 824, 834, 835,
+    824, 835, 825, 825, 835, 836, 825, 836,
+    826, 826, 836, 837, 826, 837, 827, 827,
+    837, 838, 827, 838, 828, 828, 838, 839,
+    828, 839, 829, 829, 839, 840, 829, 840,
+    830, 830, 840, 841, 830, 841, 831, 831,
+    841, 842, 831, 842, 97, 97, 842, 98,
+    128, 129, 843, 128, 843, 832, 832, 843,
+    844, 832, 844, 833, 833, 844, 845, 833,
+    845, 834, 834, 845, 846, 834, 846, 835,
+    835, 846, 847, 835, 847, 836, 836, 847,
+    848, 836, 848, 837, 837, 848, 849, 837,
+    849, 838, 838, 849, 850, 838, 850, 839,
+    839, 850, 851, 839, 851, 840, 840, 851,
+    852, 840, 852, 841, 841, 852, 853, 841,
+    853, 842, 842, 853, 854, 842, 854, 98,
+    98, 854, 99, 129, 130, 855, 129, 855,
+    843, 843, 855, 856, 843, 856, 844, 844,
+    856, 857, 844, 857, 845, 845, 857, 858,
+    845, 858, 846, 846, 858, 859, 846, 859,
+    847, 847, 859, 860, 847, 860, 848, 848,
+    860, 861, 848, 861, 849, 849, 861, 862,
+    849, 862, 850, 850, 862, 863, 850, 863,
+    851, 851, 863, 864, 851, 864, 852, 852,
+    864, 865, 852, 865, 853, 853, 865, 866,
+    853, 866, 854, 854, 866, 867, 854, 867,
+    99, 99, 867, 100, 130, 131, 868, 130,
+    868, 855, 855, 868, 869, 855, 869, 856,
+    856, 869, 870, 856, 870, 857, 857, 870,
+    871, 857, 871, 858, 858, 871, 872, 858,
+    872, 859, 859, 872, 873, 859, 873, 860,
+    860, 873, 874, 860, 874, 861, 861, 874,
+    875, 861, 875, 862, 862, 875, 876, 862,
+    876, 863, 863, 876, 877, 863, 877, 864,
+    864, 877, 878, 864, 878, 865, 865, 878,
+    879, 865, 879, 866, 866, 879, 880, 866,
+    880, 867, 867, 880, 881, 867, 881, 100,
+    100, 881, 101, 131, 8, 132, 131, 132,
+    868, 868, 132, 133, 868, 133, 869, 869,
+    133, 134, 869, 134, 870, 870, 134, 135,
+    870, 135, 871, 871, 135, 136, 871, 136,
+    872, 872, 136, 137, 872, 137, 873, 873,
+    137, 138, 873, 138, 874, 874, 138, 139,
+    874, 139, 875, 875, 139, 140, 875, 140,
+    876, 876, 140, 141, 876, 141, 877, 877,
+    141, 142, 877, 142, 878, 878, 142, 143,
+    878, 143, 879, 879, 143, 144, 879, 144,
+    880, 880, 144, 145, 880, 145, 881, 881,
+    145, 146, 881, 146, 101, 101, 146, 5,
+    4, 41, 117, 41, 40, 882, 41, 882,
+    117, 117, 882, 118, 40, 39, 883, 40,
+    883, 882, 882, 883, 884, 882, 884, 118,
+    118, 884, 119, 39, 38, 885, 39, 885,
+    883, 883, 885, 886, 883, 886, 884, 884,
+    886, 887, 884, 887, 119, 119, 887, 120,
+    38, 37, 888, 38, 888, 885, 885, 888,
+    889, 885, 889, 886, 886, 889, 890, 886,
+    890, 887, 887, 890, 891, 887, 891, 120,
+    120, 891, 121, 37, 36, 892, 37, 892,
+    888, 888, 892, 893, 888, 893, 889, 889,
+    893, 894, 889, 894, 890, 890, 894, 895,
+    890, 895, 891, 891, 895, 896, 891, 896,
+    121, 121, 896, 122, 36, 35, 897, 36,
+    897, 892, 892, 897, 898, 892, 898, 893,
+    893, 898, 899, 893, 899, 894, 894, 899,
+    900, 894, 900, 895, 895, 900, 901, 895,
+    901, 896, 896, 901, 902, 896, 902, 122,
+    122, 902, 123, 35, 34, 903, 35, 903,
+    897, 897, 903, 904, 897, 904, 898, 898,
+    904, 905, 898, 905, 899, 899, 905, 906,
+    899, 906, 900, 900, 906, 907, 900, 907,
+    901, 901, 907, 908, 901, 908, 902, 902,
+    908, 909, 902, 909, 123, 123, 909, 124,
+    34, 33, 910, 34, 910, 903, 903, 910,
+    911, 903, 911, 904, 904, 911, 912, 904,
+    912, 905, 905, 912, 913, 905, 913, 906,
+    906, 913, 914, 906, 914, 907, 907, 914,
+    915, 907, 915, 908, 908, 915, 916, 908,
+    916, 909, 909, 916, 917, 909, 917, 124,
+    124, 917, 125, 33, 32, 918, 33, 918,
+    910, 910, 918, 919, 910, 919, 911, 911,
+    919, 920, 911, 920, 912, 912, 920, 921,
+    912, 921, 913, 913, 921, 922, 913, 922,
+    914, 914, 922, 923, 914, 923, 915, 915,
+    923, 924, 915, 924, 916, 916, 924, 925,
+    916, 925, 917, 917, 925, 926, 917, 926,
+    125, 125, 926, 126, 32, 31, 927, 32,
+    927, 918, 918, 927, 928, 918, 928, 919,
+    919, 928, 929, 919, 929, 920, 920, 929,
+    930, 920, 930, 921, 921, 930, 931, 921,
+    931, 922, 922, 931, 932, 922, 932, 923,
+    923, 932, 933, 923, 933, 924, 924, 933,
+    934, 924, 934, 925, 925, 934, 935, 925,
+    935, 926, 926, 935, 936, 926, 936, 126,
+    126, 936, 127, 31, 30, 937, 31, 937,
+    927, 927, 937, 938, 927, 938, 928, 928,
+    938, 939, 928, 939, 929, 929, 939, 940,
+    929, 940, 930, 930, 940, 941, 930, 941,
+    931, 931, 941, 942, 931, 942, 932, 932,
+    942, 943, 932, 943, 933, 933, 943, 944,
+    933, 944, 934, 934, 944, 945, 934, 945,
+    935, 935, 945, 946, 935, 946, 936, 936,
+    946, 947, 936, 947, 127, 127, 947, 128,
+    30, 29, 948, 30, 948, 937, 937, 948,
+    949, 937, 949, 938, 938, 949, 950, 938,
+    950, 939, 939, 950, 951, 939, 951, 940,
+    940, 951, 952, 940, 952, 941, 941, 952,
+    953, 941, 953, 942, 942, 953, 954, 942,
+    954, 943, 943, 954, 955, 943, 955, 944,
+    944, 955, 956, 944, 956, 945, 945, 956,
+    957, 945, 957, 946, 946, 957, 958, 946,
+    958, 947, 947, 958, 959, 947, 959, 128,
+    128, 959, 129, 29, 28, 960, 29, 960,
+    948, 948, 960, 961, 948, 961, 949, 949,
+    961, 962, 949, 962, 950, 950, 962, 963,
+    950, 963, 951, 951, 963, 964, 951, 964,
+    952, 952, 964, 965, 952, 965, 953, 953,
+    965, 966, 953, 966, 954, 954, 966, 967,
+    954, 967, 955, 955, 967, 968, 955, 968,
+    956, 956, 968, 969, 956, 969, 957, 957,
+    969, 970, 957, 970, 958, 958, 970, 971,
+    958, 971, 959, 959, 971, 972, 959, 972,
+    129, 129, 972, 130, 28, 27, 973, 28,
+    973, 960, 960, 973, 974, 960, 974, 961,
+    961, 974, 975, 961, 975, 962, 962, 975,
+    976, 962, 976, 963, 963, 976, 977, 963,
+    977, 964, 964, 977, 978, 964, 978, 965,
+    965, 978, 979, 965, 979, 966, 966, 979,
+    980, 966, 980, 967, 967, 980, 981, 967,
+    981, 968, 968, 981, 982, 968, 982, 969,
+    969, 982, 983, 969, 983, 970, 970, 983,
+    984, 970, 984, 971, 971, 984, 985, 971,
+    985, 972, 972, 985, 986, 972, 986, 130,
+    130, 986, 131, 27, 1, 147, 27, 147,
+    973, 973, 147, 148, 973, 148, 974, 974,
+    148, 149, 974, 149, 975, 975, 149, 150,
+    975, 150, 976, 976, 150, 151, 976, 151,
+    977, 977, 151, 152, 977, 152, 978, 978,
+    152, 153, 978, 153, 979, 979, 153, 154,
+    979, 154, 980, 980, 154, 155, 980, 155,
+    981, 981, 155, 156, 981, 156, 982, 982,
+    156, 157, 982, 157, 983, 983, 157, 158,
+    983, 158, 984, 984, 158, 159, 984, 159,
+    985, 985, 159, 160, 985, 160, 986, 986,
+    160, 161, 986, 161, 131, 131, 161, 8,
+    8, 161, 177, 161, 160, 987, 161, 987,
+    177, 177, 987, 178, 160, 159, 988, 160,
+    988, 987, 987, 988, 989, 987, 989, 178,
+    178, 989, 179, 159, 158, 990, 159, 990,
+    988, 988, 990, 991, 988, 991, 989, 989,
+    991, 992, 989, 992, 179, 179, 992, 180,
+    158, 157, 993, 158, 993, 990, 990, 993,
+    994, 990, 994, 991, 991, 994, 995, 991,
+    995, 992, 992, 995, 996, 992, 996, 180,
+    180, 996, 181, 157, 156, 997, 157, 997,
+    993, 993, 997, 998, 993, 998, 994, 994,
+    998, 999, 994, 999, 995, 995, 999, 1000,
+    995, 1000, 996, 996, 1000, 1001, 996, 1001,
+    181, 181, 1001, 182, 156, 155, 1002, 156,
+    1002, 997, 997, 1002, 1003, 997, 1003, 998,
+    998, 1003, 1004, 998, 1004, 999, 999, 1004,
+    1005, 999, 1005, 1000, 1000, 1005, 1006, 1000,
+    1006, 1001, 1001, 1006, 1007, 1001, 1007, 182,
+    182, 1007, 183, 155, 154, 1008, 155, 1008,
+    1002, 1002, 1008, 1009, 1002, 1009, 1003, 1003,
+    1009, 1010, 1003, 1010, 1004, 1004, 1010, 1011,
+    1004, 1011, 1005, 1005, 1011, 1012, 1005, 1012,
+    1006, 1006, 1012, 1013, 1006, 1013, 1007, 1007,
+    1013, 1014, 1007, 1014, 183, 183, 1014, 184,
+    154, 153, 1015, 154, 1015, 1008, 1008, 1015,
+    1016, 1008, 1016, 1009, 1009, 1016, 1017, 1009,
+    1017, 1010, 1010, 1017, 1018, 1010, 1018, 1011,
+    1011, 1018, 1019, 1011, 1019, 1012, 1012, 1019,
+    1020, 1012, 1020, 1013, 1013, 1020, 1021, 1013,
+    1021, 1014, 1014, 1021, 1022, 1014, 1022, 184,
+    184, 1022, 185, 153, 152, 1023, 153, 1023,
+    1015, 1015, 1023, 1024, 1015, 1024, 1016, 1016,
+    1024, 1025, 1016, 1025, 1017, 1017, 1025, 1026,
+    1017, 1026, 1018, 1018, 1026, 1027, 1018, 1027,
+    1019, 1019, 1027, 1028, 1019, 1028, 1020, 1020,
+    1028, 1029, 1020, 1029, 1021, 1021, 1029, 1030,
+    1021, 1030, 1022, 1022, 1030, 1031, 1022, 1031,
+    185, 185, 1031, 186, 152, 151, 1032, 152,
+    1032, 1023, 1023, 1032, 1033, 1023, 1033, 1024,
+    1024, 1033, 1034, 1024, 1034, 1025, 1025, 1034,
+    1035, 1025, 1035, 1026, 1026, 1035, 1036, 1026,
+    1036, 1027, 1027, 1036, 1037, 1027, 1037, 1028,
+    1028, 1037, 1038, 1028, 1038, 1029, 1029, 1038,
+    1039, 1029, 1039, 1030, 1030, 1039, 1040, 1030,
+    1040, 1031, 1031, 1040, 1041, 1031, 1041, 186,
+    186, 1041, 187, 151, 150, 1042, 151, 1042,
+    1032, 1032, 1042, 1043, 1032, 1043, 1033, 1033,
+    1043, 1044, 1033, 1044, 1034, 1034, 1044, 1045,
+    1034, 1045, 1035, 1035, 1045, 1046, 1035, 1046,
+    1036, 1036, 1046, 1047, 1036, 1047, 1037, 1037,
+    1047, 1048, 1037, 1048, 1038, 1038, 1048, 1049,
+    1038, 1049, 1039, 1039, 1049, 1050, 1039, 1050,
+    1040, 1040, 1050, 1051, 1040, 1051, 1041, 1041,
+    1051, 1052, 1041, 1052, 187, 187, 1052, 188,
+    150, 149, 1053, 150, 1053, 1042, 1042, 1053,
+    1054, 1042, 1054, 1043, 1043, 1054, 1055, 1043,
+    1055, 1044, 1044, 1055, 1056, 1044, 1056, 1045,
+    1045, 1056, 1057, 1045, 1057, 1046, 1046, 1057,
+    1058, 1046, 1058, 1047, 1047, 1058, 1059, 1047,
+    1059, 1048, 1048, 1059, 1060, 1048, 1060, 1049,
+    1049, 1060, 1061, 1049, 1061, 1050, 1050, 1061,
+    1062, 1050, 1062, 1051, 1051, 1062, 1063, 1051,
+    1063, 1052, 1052, 1063, 1064, 1052, 1064, 188,
+    188, 1064, 189, 149, 148, 1065, 149, 1065,
+    1053, 1053, 1065, 1066, 1053, 1066, 1054, 1054,
+    1066, 1067, 1054, 1067, 1055, 1055, 1067, 1068,
+    1055, 1068, 1056, 1056, 1068, 1069, 1056, 1069,
+    1057, 1057, 1069, 1070, 1057, 1070, 1058, 1058,
+    1070, 1071, 1058, 1071, 1059, 1059, 1071, 1072,
+    1059, 1072, 1060, 1060, 1072, 1073, 1060, 1073,
+    1061, 1061, 1073, 1074, 1061, 1074, 1062, 1062,
+    1074, 1075, 1062, 1075, 1063, 1063, 1075, 1076,
+    1063, 1076, 1064, 1064, 1076, 1077, 1064, 1077,
+    189, 189, 1077, 190, 148, 147, 1078, 148,
+    1078, 1065, 1065, 1078, 1079, 1065, 1079, 1066,
+    1066, 1079, 1080, 1066, 1080, 1067, 1067, 1080,
+    1081, 1067, 1081, 1068, 1068, 1081, 1082, 1068,
+    1082, 1069, 1069, 1082, 1083, 1069, 1083, 1070,
+    1070, 1083, 1084, 1070, 1084, 1071, 1071, 1084,
+    1085, 1071, 1085, 1072, 1072, 1085, 1086, 1072,
+    1086, 1073, 1073, 1086, 1087, 1073, 1087, 1074,
+    1074, 1087, 1088, 1074, 1088, 1075, 1075, 1088,
+    1089, 1075, 1089, 1076, 1076, 1089, 1090, 1076,
+    1090, 1077, 1077, 1090, 1091, 1077, 1091, 190,
+    190, 1091, 191, 147, 1, 162, 147, 162,
+    1078, 1078, 162, 163, 1078, 163, 1079, 1079,
+    163, 164, 1079, 164, 1080, 1080, 164, 165,
+    1080, 165, 1081, 1081, 165, 166, 1081, 166,
+    1082, 1082, 166, 167, 1082, 167, 1083, 1083,
+    167, 168, 1083, 168, 1084, 1084, 168, 169,
+    1084, 169, 1085, 1085, 169, 170, 1085, 170,
+    1086, 1086, 170, 171, 1086, 171, 1087, 1087,
+    171, 172, 1087, 172, 1088, 1088, 172, 173,
+    1088, 173, 1089, 1089, 173, 174, 1089, 174,
+    1090, 1090, 174, 175, 1090, 175, 1091, 1091,
+    175, 176, 1091, 176, 191, 191, 176, 10,
+    8, 177, 207, 177, 178, 1092, 177, 1092,
+    207, 207, 1092, 208, 178, 179, 1093, 178,
+    1093, 1092, 1092, 1093, 1094, 1092, 1094, 208,
+    208, 1094, 209, 179, 180, 1095, 179, 1095,
+    1093, 1093, 1095, 1096, 1093, 1096, 1094, 1094,
+    1096, 1097, 1094, 1097, 209, 209, 1097, 210,
+    180, 181, 1098, 180, 1098, 1095, 1095, 1098,
+    1099, 1095, 1099, 1096, 1096, 1099, 1100, 1096,
+    1100, 1097, 1097, 1100, 1101, 1097, 1101, 210,
+    210, 1101, 211, 181, 182, 1102, 181, 1102,
+    1098, 1098, 1102, 1103, 1098, 1103, 1099, 1099,
+    1103, 1104, 1099, 1104, 1100, 1100, 1104, 1105,
+    1100, 1105, 1101, 1101, 1105, 1106, 1101, 1106,
+    211, 211, 1106, 212, 182, 183, 1107, 182,
+    1107, 1102, 1102, 1107, 1108, 1102, 1108, 1103,
+    1103, 1108, 1109, 1103, 1109, 1104, 1104, 1109,
+    1110, 1104, 1110, 1105, 1105, 1110, 1111, 1105,
+    1111, 1106, 1106, 1111, 1112, 1106, 1112, 212,
+    212, 1112, 213, 183, 184, 1113, 183, 1113,
+    1107, 1107, 1113, 1114, 1107, 1114, 1108, 1108,
+    1114, 1115, 1108, 1115, 1109, 1109, 1115, 1116,
+    1109, 1116, 1110, 1110, 1116, 1117, 1110, 1117,
+    1111, 1111, 1117, 1118, 1111, 1118, 1112, 1112,
+    1118, 1119, 1112, 1119, 213, 213, 1119, 214,
+    184, 185, 1120, 184, 1120, 1113, 1113, 1120,
+    1121, 1113, 1121, 1114, 1114, 1121, 1122, 1114,
+    1122, 1115, 1115, 1122, 1123, 1115, 1123, 1116,
+    1116, 1123, 1124, 1116, 1124, 1117, 1117, 1124,
+    1125, 1117, 1125, 1118, 1118, 1125, 1126, 1118,
+    1126, 1119, 1119, 1126, 1127, 1119, 1127, 214,
+    214, 1127, 215, 185, 186, 1128, 185, 1128,
+    1120, 1120, 1128, 1129, 1120, 1129, 1121, 1121,
+    1129, 1130, 1121, 1130, 1122, 1122, 1130, 1131,
+    1122, 1131, 1123, 1123, 1131, 1132, 1123, 1132,
+    1124, 1124, 1132, 1133, 1124, 1133, 1125, 1125,
+    1133, 1134, 1125, 1134, 1126, 1126, 1134, 1135,
+    1126, 1135, 1127, 1127, 1135, 1136, 1127, 1136,
+    215, 215, 1136, 216, 186, 187, 1137, 186,
+    1137, 1128, 1128, 1137, 1138, 1128, 1138, 1129,
+    1129, 1138, 1139, 1129, 1139, 1130, 1130, 1139,
+    1140, 1130, 1140, 1131, 1131, 1140, 1141, 1131,
+    1141, 1132, 1132, 1141, 1142, 1132, 1142, 1133,
+    1133, 1142, 1143, 1133, 1143, 1134, 1134, 1143,
+    1144, 1134, 1144, 1135, 1135, 1144, 1145, 1135,
+    1145, 1136, 1136, 1145, 1146, 1136, 1146, 216,
+    216, 1146, 217, 187, 188, 1147, 187, 1147,
+    1137, 1137, 1147, 1148, 1137, 1148, 1138, 1138,
+    1148, 1149, 1138, 1149, 1139, 1139, 1149, 1150,
+    1139, 1150, 1140, 1140, 1150, 1151, 1140, 1151,
+    1141, 1141, 1151, 1152, 1141, 1152, 1142, 1142,
+    1152, 1153, 1142, 1153, 1143, 1143, 1153, 1154,
+    1143, 1154, 1144, 1144, 1154, 1155, 1144, 1155,
+    1145, 1145, 1155, 1156, 1145, 1156, 1146, 1146,
+    1156, 1157, 1146, 1157, 217, 217, 1157, 218,
+    188, 189, 1158, 188, 1158, 1147, 1147, 1158,
+    1159, 1147, 1159, 1148, 1148, 1159, 1160, 1148,
+    1160, 1149, 1149, 1160, 1161, 1149, 1161, 1150,
+    1150, 1161, 1162, 1150, 1162, 1151, 1151, 1162,
+    1163, 1151, 1163, 1152, 1152, 1163, 1164, 1152,
+    1164, 1153, 1153, 1164, 1165, 1153, 1165, 1154,
+    1154, 1165, 1166, 1154, 1166, 1155, 1155, 1166,
+    1167, 1155, 1167, 1156, 1156, 1167, 1168, 1156,
+    1168, 1157, 1157, 1168, 1169, 1157, 1169, 218,
+    218, 1169, 219, 189, 190, 1170, 189, 1170,
+    1158, 1158, 1170, 1171, 1158, 1171, 1159, 1159,
+    1171, 1172, 1159, 1172, 1160, 1160, 1172, 1173,
+    1160, 1173, 1161, 1161, 1173, 1174, 1161, 1174,
+    1162, 1162, 1174, 1175, 1162, 1175, 1163, 1163,
+    1175, 1176, 1163, 1176, 1164, 1164, 1176, 1177,
+    1164, 1177, 1165, 1165, 1177, 1178, 1165, 1178,
+    1166, 1166, 1178, 1179, 1166, 1179, 1167, 1167,
+    1179, 1180, 1167, 1180, 1168, 1168, 1180, 1181,
+    1168, 1181, 1169, 1169, 1181, 1182, 1169, 1182,
+    219, 219, 1182, 220, 190, 191, 1183, 190,
+    1183, 1170, 1170, 1183, 1184, 1170, 1184, 1171,
+    1171, 1184, 1185, 1171, 1185, 1172, 1172, 1185,
+    1186, 1172, 1186, 1173, 1173, 1186, 1187, 1173,
+    1187, 1174, 1174, 1187, 1188, 1174, 1188, 1175,
+    1175, 1188, 1189, 1175, 1189, 1176, 1176, 1189,
+    1190, 1176, 1190, 1177, 1177, 1190, 1191, 1177,
+    1191, 1178, 1178, 1191, 1192, 1178, 1192, 1179,
+    1179, 1192, 1193, 1179, 1193, 1180, 1180, 1193,
+    1194, 1180, 1194, 1181, 1181, 1194, 1195, 1181,
+    1195, 1182, 1182, 1195, 1196, 1182, 1196, 220,
+    220, 1196, 221, 191, 10, 192, 191, 192,
+    1183, 1183, 192, 193, 1183, 193, 1184, 1184,
+    193, 194, 1184, 194, 1185, 1185, 194, 195,
+    1185, 195, 1186, 1186, 195, 196, 1186, 196,
+    1187, 1187, 196, 197, 1187, 197, 1188, 1188,
+    197, 198, 1188, 198, 1189, 1189, 198, 199,
+    1189, 199, 1190, 1190, 199, 200, 1190, 200,
+    1191, 1191, 200, 201, 1191, 201, 1192, 1192,
+    201, 202, 1192, 202, 1193, 1193, 202, 203,
+    1193, 203, 1194, 1194, 203, 204, 1194, 204,
+    1195, 1195, 204, 205, 1195, 205, 1196, 1196,
+    205, 206, 1196, 206, 221, 221, 206, 3,
+    5, 146, 222, 146, 145, 1197, 146, 1197,
+    222, 222, 1197, 223, 145, 144, 1198, 145,
+    1198, 1197, 1197, 1198, 1199, 1197, 1199, 223,
+    223, 1199, 224, 144, 143, 1200, 144, 1200,
+    1198, 1198, 1200, 1201, 1198, 1201, 1199, 1199,
+    1201, 1202, 1199, 1202, 224, 224, 1202, 225,
+    143, 142, 1203, 143, 1203, 1200, 1200, 1203,
+    1204, 1200, 1204, 1201, 1201, 1204, 1205, 1201,
+    1205, 1202, 1202, 1205, 1206, 1202, 1206, 225,
+    225, 1206, 226, 142, 141, 1207, 142, 1207,
+    1203, 1203, 1207, 1208, 1203, 1208, 1204, 1204,
+    1208, 1209, 1204, 1209, 1205, 1205, 1209, 1210,
+    1205, 1210, 1206, 1206, 1210, 1211, 1206, 1211,
+    226, 226, 1211, 227, 141, 140, 1212, 141,
+    1212, 1207, 1207, 1212, 1213, 1207, 1213, 1208,
+    1208, 1213, 1214, 1208, 1214, 1209, 1209, 1214,
+    1215, 1209, 1215, 1210, 1210, 1215, 1216, 1210,
+    1216, 1211, 1211, 1216, 1217, 1211, 1217, 227,
+    227, 1217, 228, 140, 139, 1218, 140, 1218,
+    1212, 1212, 1218, 1219, 1212, 1219, 1213, 1213,
+    1219, 1220, 1213, 1220, 1214, 1214, 1220, 1221,
+    1214, 1221, 1215, 1215, 1221, 1222, 1215, 1222,
+    1216, 1216, 1222, 1223, 1216, 1223, 1217, 1217,
+    1223, 1224, 1217, 1224, 228, 228, 1224, 229,
+    139, 138, 1225, 139, 1225, 1218, 1218, 1225,
+    1226, 1218, 1226, 1219, 1219, 1226, 1227, 1219,
+    1227, 1220, 1220, 1227, 1228, 1220, 1228, 1221,
+    1221, 1228, 1229, 1221, 1229, 1222, 1222, 1229,
+    1230, 1222, 1230, 1223, 1223, 1230, 1231, 1223,
+    1231, 1224, 1224, 1231, 1232, 1224, 1232, 229,
+    229, 1232, 230, 138, 137, 1233, 138, 1233,
+    1225, 1225, 1233, 1234, 1225, 1234, 1226, 1226,
+    1234, 1235, 1226, 1235, 1227, 1227, 1235, 1236,
+    1227, 1236, 1228, 1228, 1236, 1237, 1228, 1237,
+    1229, 1229, 1237, 1238, 1229, 1238, 1230, 1230,
+    1238, 1239, 1230, 1239, 1231, 1231, 1239, 1240,
+    1231, 1240, 1232, 1232, 1240, 1241, 1232, 1241,
+    230, 230, 1241, 231, 137, 136, 1242, 137,
+    1242, 1233, 1233, 1242, 1243, 1233, 1243, 1234,
+    1234, 1243, 1244, 1234, 1244, 1235, 1235, 1244,
+    1245, 1235, 1245, 1236, 1236, 1245, 1246, 1236,
+    1246, 1237, 1237, 1246, 1247, 1237, 1247, 1238,
+    1238, 1247, 1248, 1238, 1248, 1239, 1239, 1248,
+    1249, 1239, 1249, 1240, 1240, 1249, 1250, 1240,
+    1250, 1241, 1241, 1250, 1251, 1241, 1251, 231,
+    231, 1251, 232, 136, 135, 1252, 136, 1252,
+    1242, 1242, 1252, 1253, 1242, 1253, 1243, 1243,
+    1253, 1254, 1243, 1254, 1244, 1244, 1254, 1255,
+    1244, 1255, 1245, 1245, 1255, 1256, 1245, 1256,
+    1246, 1246, 1256, 1257, 1246, 1257, 1247, 1247,
+    1257, 1258, 1247, 1258, 1248, 1248, 1258, 1259,
+    1248, 1259, 1249, 1249, 1259, 1260, 1249, 1260,
+    1250, 1250, 1260, 1261, 1250, 1261, 1251, 1251,
+    1261, 1262, 1251, 1262, 232, 232, 1262, 233,
+    135, 134, 1263, 135, 1263, 1252, 1252, 1263,
+    1264, 1252, 1264, 1253, 1253, 1264, 1265, 1253,
+    1265, 1254, 1254, 1265, 1266, 1254, 1266, 1255,
+    1255, 1266, 1267, 1255, 1267, 1256, 1256, 1267,
+    1268, 1256, 1268, 1257, 1257, 1268, 1269, 1257,
+    1269, 1258, 1258, 1269, 1270, 1258, 1270, 1259,
+    1259, 1270, 1271, 1259, 1271, 1260, 1260, 1271,
+    1272, 1260, 1272, 1261, 1261, 1272, 1273, 1261,
+    1273, 1262, 1262, 1273, 1274, 1262, 1274, 233,
+    233, 1274, 234, 134, 133, 1275, 134, 1275,
+    1263, 1263, 1275, 1276, 1263, 1276, 1264, 1264,
+    1276, 1277, 1264, 1277, 1265, 1265, 1277, 1278,
+    1265, 1278, 1266, 1266, 1278, 1279, 1266, 1279,
+    1267, 1267, 1279, 1280, 1267, 1280, 1268, 1268,
+    1280, 1281, 1268, 1281, 1269, 1269, 1281, 1282,
+    1269, 1282, 1270, 1270, 1282, 1283, 1270, 1283,
+    1271, 1271, 1283, 1284, 1271, 1284, 1272, 1272,
+    1284, 1285, 1272, 1285, 1273, 1273, 1285, 1286,
+    1273, 1286, 1274, 1274, 1286, 1287, 1274, 1287,
+    234, 234, 1287, 235, 133, 132, 1288, 133,
+    1288, 1275, 1275, 1288, 1289, 1275, 1289, 1276,
+    1276, 1289, 1290, 1276, 1290, 1277, 1277, 1290,
+    1291, 1277, 1291, 1278, 1278, 1291, 1292, 1278,
+    1292, 1279, 1279, 1292, 1293, 1279, 1293, 1280,
+    1280, 1293, 1294, 1280, 1294, 1281, 1281, 1294,
+    1295, 1281, 1295, 1282, 1282, 1295, 1296, 1282,
+    1296, 1283, 1283, 1296, 1297, 1283, 1297, 1284,
+    1284, 1297, 1298, 1284, 1298, 1285, 1285, 1298,
+    1299, 1285, 1299, 1286, 1286, 1299, 1300, 1286,
+    1300, 1287, 1287, 1300, 1301, 1287, 1301, 235,
+    235, 1301, 236, 132, 8, 207, 132, 207,
+    1288, 1288, 207, 208, 1288, 208, 1289, 1289,
+    208, 209, 1289, 209, 1290, 1290, 209, 210,
+    1290, 210, 1291, 1291, 210, 211, 1291, 211,
+    1292, 1292, 211, 212, 1292, 212, 1293, 1293,
+    212, 213, 1293, 213, 1294, 1294, 213, 214,
+    1294, 214, 1295, 1295, 214, 215, 1295, 215,
+    1296, 1296, 215, 216, 1296, 216, 1297, 1297,
+    216, 217, 1297, 217, 1298, 1298, 217, 218,
+    1298, 218, 1299, 1299, 218, 219, 1299, 219,
+    1300, 1300, 219, 220, 1300, 220, 1301, 1301,
+    220, 221, 1301, 221, 236, 236, 221, 3,
+    5, 222, 252, 222, 223, 1302, 222, 1302,
+    252, 252, 1302, 253, 223, 224, 1303, 223,
+    1303, 1302, 1302, 1303, 1304, 1302, 1304, 253,
+    253, 1304, 254, 224, 225, 1305, 224, 1305,
+    1303, 1303, 1305, 1306, 1303, 1306, 1304, 1304,
+    1306, 1307, 1304, 1307, 254, 254, 1307, 255,
+    225, 226, 1308, 225, 1308, 1305, 1305, 1308,
+    1309, 1305, 1309, 1306, 1306, 1309, 1310, 1306,
+    1310, 1307, 1307, 1310, 1311, 1307, 1311, 255,
+    255, 1311, 256, 226, 227, 1312, 226, 1312,
+    1308, 1308, 1312, 1313, 1308, 1313, 1309, 1309,
+    1313, 1314, 1309, 1314, 1310, 1310, 1314, 1315,
+    1310, 1315, 1311, 1311, 1315, 1316, 1311, 1316,
+    256, 256, 1316, 257, 227, 228, 1317, 227,
+    1317, 1312, 1312, 1317, 1318, 1312, 1318, 1313,
+    1313, 1318, 1319, 1313, 1319, 1314, 1314, 1319,
+    1320, 1314, 1320, 1315, 1315, 1320, 1321, 1315,
+    1321, 1316, 1316, 1321, 1322, 1316, 1322, 257,
+    257, 1322, 258, 228, 229, 1323, 228, 1323,
+    1317, 1317, 1323, 1324, 1317, 1324, 1318, 1318,
+    1324, 1325, 1318, 1325, 1319, 1319, 1325, 1326,
+    1319, 1326, 1320, 1320, 1326, 1327, 1320, 1327,
+    1321, 1321, 1327, 1328, 1321, 1328, 1322, 1322,
+    1328, 1329, 1322, 1329, 258, 258, 1329, 259,
+    229, 230, 1330, 229, 1330, 1323, 1323, 1330,
+    1331, 1323, 1331, 1324, 1324, 1331, 1332, 1324,
+    1332, 1325, 1325, 1332, 1333, 1325, 1333, 1326,
+    1326, 1333, 1334, 1326, 1334, 1327, 1327, 1334,
+    1335, 1327, 1335, 1328, 1328, 1335, 1336, 1328,
+    1336, 1329, 1329, 1336, 1337, 1329, 1337, 259,
+    259, 1337, 260, 230, 231, 1338, 230, 1338,
+    1330, 1330, 1338, 1339, 1330, 1339, 1331, 1331,
+    1339, 1340, 1331, 1340, 1332, 1332, 1340, 1341,
+    1332, 1341, 1333, 1333, 1341, 1342, 1333, 1342,
+    1334, 1334, 1342, 1343, 1334, 1343, 1335, 1335,
+    1343, 1344, 1335, 1344, 1336, 1336, 1344, 1345,
+    1336, 1345, 1337, 1337, 1345, 1346, 1337, 1346,
+    260, 260, 1346, 261, 231, 232, 1347, 231,
+    1347, 1338, 1338, 1347, 1348, 1338, 1348, 1339,
+    1339, 1348, 1349, 1339, 1349, 1340, 1340, 1349,
+    1350, 1340, 1350, 1341, 1341, 1350, 1351, 1341,
+    1351, 1342, 1342, 1351, 1352, 1342, 1352, 1343,
+    1343, 1352, 1353, 1343, 1353, 1344, 1344, 1353,
+    1354, 1344, 1354, 1345, 1345, 1354, 1355, 1345,
+    1355, 1346, 1346, 1355, 1356, 1346, 1356, 261,
+    261, 1356, 262, 232, 233, 1357, 232, 1357,
+    1347, 1347, 1357, 1358, 1347, 1358, 1348, 1348,
+    1358, 1359, 1348, 1359, 1349, 1349, 1359, 1360,
+    1349, 1360, 1350, 1350, 1360, 1361, 1350, 1361,
+    1351, 1351, 1361, 1362, 1351, 1362, 1352, 1352,
+    1362, 1363, 1352, 1363, 1353, 1353, 1363, 1364,
+    1353, 1364, 1354, 1354, 1364, 1365, 1354, 1365,
+    1355, 1355, 1365, 1366, 1355, 1366, 1356, 1356,
+    1366, 1367, 1356, 1367, 262, 262, 1367, 263,
+    233, 234, 1368, 233, 1368, 1357, 1357, 1368,
+    1369, 1357, 1369, 1358, 1358, 1369, 1370, 1358,
+    1370, 1359, 1359, 1370, 1371, 1359, 1371, 1360,
+    1360, 1371, 1372, 1360, 1372, 1361, 1361, 1372,
+    1373, 1361, 1373, 1362, 1362, 1373, 1374, 1362,
+    1374, 1363, 1363, 1374, 1375, 1363, 1375, 1364,
+    1364, 1375, 1376, 1364, 1376, 1365, 1365, 1376,
+    1377, 1365, 1377, 1366, 1366, 1377, 1378, 1366,
+    1378, 1367, 1367, 1378, 1379, 1367, 1379, 263,
+    263, 1379, 264, 234, 235, 1380, 234, 1380,
+    1368, 1368, 1380, 1381, 1368, 1381, 1369, 1369,
+    1381, 1382, 1369, 1382, 1370, 1370, 1382, 1383,
+    1370, 1383, 1371, 1371, 1383, 1384, 1371, 1384,
+    1372, 1372, 1384, 1385, 1372, 1385, 1373, 1373,
+    1385, 1386, 1373, 1386, 1374, 1374, 1386, 1387,
+    1374, 1387, 1375, 1375, 1387, 1388, 1375, 1388,
+    1376, 1376, 1388, 1389, 1376, 1389, 1377, 1377,
+    1389, 1390, 1377, 1390, 1378, 1378, 1390, 1391,
+    1378, 1391, 1379, 1379, 1391, 1392, 1379, 1392,
+    264, 264, 1392, 265, 235, 236, 1393, 235,
+    1393, 1380, 1380, 1393, 1394, 1380, 1394, 1381,
+    1381, 1394, 1395, 1381, 1395, 1382, 1382, 1395,
+    1396, 1382, 1396, 1383, 1383, 1396, 1397, 1383,
+    1397, 1384, 1384, 1397, 1398, 1384, 1398, 1385,
+    1385, 1398, 1399, 1385, 1399, 1386, 1386, 1399,
+    1400, 1386, 1400, 1387, 1387, 1400, 1401, 1387,
+    1401, 1388, 1388, 1401, 1402, 1388, 1402, 1389,
+    1389, 1402, 1403, 1389, 1403, 1390, 1390, 1403,
+    1404, 1390, 1404, 1391, 1391, 1404, 1405, 1391,
+    1405, 1392, 1392, 1405, 1406, 1392, 1406, 265,
+    265, 1406, 266, 236, 3, 237, 236, 237,
+    1393, 1393, 237, 238, 1393, 238, 1394, 1394,
+    238, 239, 1394, 239, 1395, 1395, 239, 240,
+    1395, 240, 1396, 1396, 240, 241, 1396, 241,
+    1397, 1397, 241, 242, 1397, 242, 1398, 1398,
+    242, 243, 1398, 243, 1399, 1399, 243, 244,
+    1399, 244, 1400, 1400, 244, 245, 1400, 245,
+    1401, 1401, 245, 246, 1401, 246, 1402, 1402,
+    246, 247, 1402, 247, 1403, 1403, 247, 248,
+    1403, 248, 1404, 1404, 248, 249, 1404, 249,
+    1405, 1405, 249, 250, 1405, 250, 1406, 1406,
+    250, 251, 1406, 251, 266, 266, 251, 2,
+    2, 251, 282, 251, 250, 1407, 251, 1407,
+    282, 282, 1407, 283, 250, 249, 1408, 250,
+    1408, 1407, 1407, 1408, 1409, 1407, 1409, 283,
+    283, 1409, 284, 249, 248, 1410, 249, 1410,
+    1408, 1408, 1410, 1411, 1408, 1411, 1409, 1409,
+    1411, 1412, 1409, 1412, 284, 284, 1412, 285,
+    248, 247, 1413, 248, 1413, 1410, 1410, 1413,
+    1414, 1410, 1414, 1411, 1411, 1414, 1415, 1411,
+    1415, 1412, 1412, 1415, 1416, 1412, 1416, 285,
+    285, 1416, 286, 247, 246, 1417, 247, 1417,
+    1413, 1413, 1417, 1418, 1413, 1418, 1414, 1414,
+    1418, 1419, 1414, 1419, 1415, 1415, 1419, 1420,
+    1415, 1420, 1416, 1416, 1420, 1421, 1416, 1421,
+    286, 286, 1421, 287, 246, 245, 1422, 246,
+    1422, 1417, 1417, 1422, 1423, 1417, 1423, 1418,
+    1418, 1423, 1424, 1418, 1424, 1419, 1419, 1424,
+    1425, 1419, 1425, 1420, 1420, 1425, 1426, 1420,
+    1426, 1421, 1421, 1426, 1427, 1421, 1427, 287,
+    287, 1427, 288, 245, 244, 1428, 245, 1428,
+    1422, 1422, 1428, 1429, 1422, 1429, 1423, 1423,
+    1429, 1430, 1423, 1430, 1424, 1424, 1430, 1431,
+    1424, 1431, 1425, 1425, 1431, 1432, 1425, 1432,
+    1426, 1426, 1432, 1433, 1426, 1433, 1427, 1427,
+    1433, 1434, 1427, 1434, 288, 288, 1434, 289,
+    244, 243, 1435, 244, 1435, 1428, 1428, 1435,
+    1436, 1428, 1436, 1429, 1429, 1436, 1437, 1429,
+    1437, 1430, 1430, 1437, 1438, 1430, 1438, 1431,
+    1431, 1438, 1439, 1431, 1439, 1432, 1432, 1439,
+    1440, 1432, 1440, 1433, 1433, 1440, 1441, 1433,
+    1441, 1434, 1434, 1441, 1442, 1434, 1442, 289,
+    289, 1442, 290, 243, 242, 1443, 243, 1443,
+    1435, 1435, 1443, 1444, 1435, 1444, 1436, 1436,
+    1444, 1445, 1436, 1445, 1437, 1437, 1445, 1446,
+    1437, 1446, 1438, 1438, 1446, 1447, 1438, 1447,
+    1439, 1439, 1447, 1448, 1439, 1448, 1440, 1440,
+    1448, 1449, 1440, 1449, 1441, 1441, 1449, 1450,
+    1441, 1450, 1442, 1442, 1450, 1451, 1442, 1451,
+    290, 290, 1451, 291, 242, 241, 1452, 242,
+    1452, 1443, 1443, 1452, 1453, 1443, 1453, 1444,
+    1444, 1453, 1454, 1444, 1454, 1445, 1445, 1454,
+    1455, 1445, 1455, 1446, 1446, 1455, 1456, 1446,
+    1456, 1447, 1447, 1456, 1457, 1447, 1457, 1448,
+    1448, 1457, 1458, 1448, 1458, 1449, 1449, 1458,
+    1459, 1449, 1459, 1450, 1450, 1459, 1460, 1450,
+    1460, 1451, 1451, 1460, 1461, 1451, 1461, 291,
+    291, 1461, 292, 241, 240, 1462, 241, 1462,
+    1452, 1452, 1462, 1463, 1452, 1463, 1453, 1453,
+    1463, 1464, 1453, 1464, 1454, 1454, 1464, 1465,
+    1454, 1465, 1455, 1455, 1465, 1466, 1455, 1466,
+    1456, 1456, 1466, 1467, 1456, 1467, 1457, 1457,
+    1467, 1468, 1457, 1468, 1458, 1458, 1468, 1469,
+    1458, 1469, 1459, 1459, 1469, 1470, 1459, 1470,
+    1460, 1460, 1470, 1471, 1460, 1471, 1461, 1461,
+    1471, 1472, 1461, 1472, 292, 292, 1472, 293,
+    240, 239, 1473, 240, 1473, 1462, 1462, 1473,
+    1474, 1462, 1474, 1463, 1463, 1474, 1475, 1463,
+    1475, 1464, 1464, 1475, 1476, 1464, 1476, 1465,
+    1465, 1476, 1477, 1465, 1477, 1466, 1466, 1477,
+    1478, 1466, 1478, 1467, 1467, 1478, 1479, 1467,
+    1479, 1468, 1468, 1479, 1480, 1468, 1480, 1469,
+    1469, 1480, 1481, 1469, 1481, 1470, 1470, 1481,
+    1482, 1470, 1482, 1471, 1471, 1482, 1483, 1471,
+    1483, 1472, 1472, 1483, 1484, 1472, 1484, 293,
+    293, 1484, 294, 239, 238, 1485, 239, 1485,
+    1473, 1473, 1485, 1486, 1473, 1486, 1474, 1474,
+    1486, 1487, 1474, 1487, 1475, 1475, 1487, 1488,
+    1475, 1488, 1476, 1476, 1488, 1489, 1476, 1489,
+    1477, 1477, 1489, 1490, 1477, 1490, 1478, 1478,
+    1490, 1491, 1478, 1491, 1479, 1479, 1491, 1492,
+    1479, 1492, 1480, 1480, 1492, 1493, 1480, 1493,
+    1481, 1481, 1493, 1494, 1481, 1494, 1482, 1482,
+    1494, 1495, 1482, 1495, 1483, 1483, 1495, 1496,
+    1483, 1496, 1484, 1484, 1496, 1497, 1484, 1497,
+    294, 294, 1497, 295, 238, 237, 1498, 238,
+    1498, 1485, 1485, 1498, 1499, 1485, 1499, 1486,
+    1486, 1499, 1500, 1486, 1500, 1487, 1487, 1500,
+    1501, 1487, 1501, 1488, 1488, 1501, 1502, 1488,
+    1502, 1489, 1489, 1502, 1503, 1489, 1503, 1490,
+    1490, 1503, 1504, 1490, 1504, 1491, 1491, 1504,
+    1505, 1491, 1505, 1492, 1492, 1505, 1506, 1492,
+    1506, 1493, 1493, 1506, 1507, 1493, 1507, 1494,
+    1494, 1507, 1508, 1494, 1508, 1495, 1495, 1508,
+    1509, 1495, 1509, 1496, 1496, 1509, 1510, 1496,
+    1510, 1497, 1497, 1510, 1511, 1497, 1511, 295,
+    295, 1511, 296, 237, 3, 267, 237, 267,
+    1498, 1498, 267, 268, 1498, 268, 1499, 1499,
+    268, 269, 1499, 269, 1500, 1500, 269, 270,
+    1500, 270, 1501, 1501, 270, 271, 1501, 271,
+    1502, 1502, 271, 272, 1502, 272, 1503, 1503,
+    272, 273, 1503, 273, 1504, 1504, 273, 274,
+    1504, 274, 1505, 1505, 274, 275, 1505, 275,
+    1506, 1506, 275, 276, 1506, 276, 1507, 1507,
+    276, 277, 1507, 277, 1508, 1508, 277, 278,
+    1508, 278, 1509, 1509, 278, 279, 1509, 279,
+    1510, 1510, 279, 280, 1510, 280, 1511, 1511,
+    280, 281, 1511, 281, 296, 296, 281, 7,
+    7, 281, 297, 281, 280, 1512, 281, 1512,
+    297, 297, 1512, 298, 280, 279, 1513, 280,
+    1513, 1512, 1512, 1513, 1514, 1512, 1514, 298,
+    298, 1514, 299, 279, 278, 1515, 279, 1515,
+    1513, 1513, 1515, 1516, 1513, 1516, 1514, 1514,
+    1516, 1517, 1514, 1517, 299, 299, 1517, 300,
+    278, 277, 1518, 278, 1518, 1515, 1515, 1518,
+    1519, 1515, 1519, 1516, 1516, 1519, 1520, 1516,
+    1520, 1517, 1517, 1520, 1521, 1517, 1521, 300,
+    300, 1521, 301, 277, 276, 1522, 277, 1522,
+    1518, 1518, 1522, 1523, 1518, 1523, 1519, 1519,
+    1523, 1524, 1519, 1524, 1520, 1520, 1524, 1525,
+    1520, 1525, 1521, 1521, 1525, 1526, 1521, 1526,
+    301, 301, 1526, 302, 276, 275, 1527, 276,
+    1527, 1522, 1522, 1527, 1528, 1522, 1528, 1523,
+    1523, 1528, 1529, 1523, 1529, 1524, 1524, 1529,
+    1530, 1524, 1530, 1525, 1525, 1530, 1531, 1525,
+    1531, 1526, 1526, 1531, 1532, 1526, 1532, 302,
+    302, 1532, 303, 275, 274, 1533, 275, 1533,
+    1527, 1527, 1533, 1534, 1527, 1534, 1528, 1528,
+    1534, 1535, 1528, 1535, 1529, 1529, 1535, 1536,
+    1529, 1536, 1530, 1530, 1536, 1537, 1530, 1537,
+    1531, 1531, 1537, 1538, 1531, 1538, 1532, 1532,
+    1538, 1539, 1532, 1539, 303, 303, 1539, 304,
+    274, 273, 1540, 274, 1540, 1533, 1533, 1540,
+    1541, 1533, 1541, 1534, 1534, 1541, 1542, 1534,
+    1542, 1535, 1535, 1542, 1543, 1535, 1543, 1536,
+    1536, 1543, 1544, 1536, 1544, 1537, 1537, 1544,
+    1545, 1537, 1545, 1538, 1538, 1545, 1546, 1538,
+    1546, 1539, 1539, 1546, 1547, 1539, 1547, 304,
+    304, 1547, 305, 273, 272, 1548, 273, 1548,
+    1540, 1540, 1548, 1549, 1540, 1549, 1541, 1541,
+    1549, 1550, 1541, 1550, 1542, 1542, 1550, 1551,
+    1542, 1551, 1543, 1543, 1551, 1552, 1543, 1552,
+    1544, 1544, 1552, 1553, 1544, 1553, 1545, 1545,
+    1553, 1554, 1545, 1554, 1546, 1546, 1554, 1555,
+    1546, 1555, 1547, 1547, 1555, 1556, 1547, 1556,
+    305, 305, 1556, 306, 272, 271, 1557, 272,
+    1557, 1548, 1548, 1557, 1558, 1548, 1558, 1549,
+    1549, 1558, 1559, 1549, 1559, 1550, 1550, 1559,
+    1560, 1550, 1560, 1551, 1551, 1560, 1561, 1551,
+    1561, 1552, 1552, 1561, 1562, 1552, 1562, 1553,
+    1553, 1562, 1563, 1553, 1563, 1554, 1554, 1563,
+    1564, 1554, 1564, 1555, 1555, 1564, 1565, 1555,
+    1565, 1556, 1556, 1565, 1566, 1556, 1566, 306,
+    306, 1566, 307, 271, 270, 1567, 271, 1567,
+    1557, 1557, 1567, 1568, 1557, 1568, 1558, 1558,
+    1568, 1569, 1558, 1569, 1559, 1559, 1569, 1570,
+    1559, 1570, 1560, 1560, 1570, 1571, 1560, 1571,
+    1561, 1561, 1571, 1572, 1561, 1572, 1562, 1562,
+    1572, 1573, 1562, 1573, 1563, 1563, 1573, 1574,
+    1563, 1574, 1564, 1564, 1574, 1575, 1564, 1575,
+    1565, 1565, 1575, 1576, 1565, 1576, 1566, 1566,
+    1576, 1577, 1566, 1577, 307, 307, 1577, 308,
+    270, 269, 1578, 270, 1578, 1567, 1567, 1578,
+    1579, 1567, 1579, 1568, 1568, 1579, 1580, 1568,
+    1580, 1569, 1569, 1580, 1581, 1569, 1581, 1570,
+    1570, 1581, 1582, 1570, 1582, 1571, 1571, 1582,
+    1583, 1571, 1583, 1572, 1572, 1583, 1584, 1572,
+    1584, 1573, 1573, 1584, 1585, 1573, 1585, 1574,
+    1574, 1585, 1586, 1574, 1586, 1575, 1575, 1586,
+    1587, 1575, 1587, 1576, 1576, 1587, 1588, 1576,
+    1588, 1577, 1577, 1588, 1589, 1577, 1589, 308,
+    308, 1589, 309, 269, 268, 1590, 269, 1590,
+    1578, 1578, 1590, 1591, 1578, 1591, 1579, 1579,
+    1591, 1592, 1579, 1592, 1580, 1580, 1592, 1593,
+    1580, 1593, 1581, 1581, 1593, 1594, 1581, 1594,
+    1582, 1582, 1594, 1595, 1582, 1595, 1583, 1583,
+    1595, 1596, 1583, 1596, 1584, 1584, 1596, 1597,
+    1584, 1597, 1585, 1585, 1597, 1598, 1585, 1598,
+    1586, 1586, 1598, 1599, 1586, 1599, 1587, 1587,
+    1599, 1600, 1587, 1600, 1588, 1588, 1600, 1601,
+    1588, 1601, 1589, 1589, 1601, 1602, 1589, 1602,
+    309, 309, 1602, 310, 268, 267, 1603, 268,
+    1603, 1590, 1590, 1603, 1604, 1590, 1604, 1591,
+    1591, 1604, 1605, 1591, 1605, 1592, 1592, 1605,
+    1606, 1592, 1606, 1593, 1593, 1606, 1607, 1593,
+    1607, 1594, 1594, 1607, 1608, 1594, 1608, 1595,
+    1595, 1608, 1609, 1595, 1609, 1596, 1596, 1609,
+    1610, 1596, 1610, 1597, 1597, 1610, 1611, 1597,
+    1611, 1598, 1598, 1611, 1612, 1598, 1612, 1599,
+    1599, 1612, 1613, 1599, 1613, 1600, 1600, 1613,
+    1614, 1600, 1614, 1601, 1601, 1614, 1615, 1601,
+    1615, 1602, 1602, 1615, 1616, 1602, 1616, 310,
+    310, 1616, 311, 267, 3, 206, 267, 206,
+    1603, 1603, 206, 205, 1603, 205, 1604, 1604,
+    205, 204, 1604, 204, 1605, 1605, 204, 203,
+    1605, 203, 1606, 1606, 203, 202, 1606, 202,
+    1607, 1607, 202, 201, 1607, 201, 1608, 1608,
+    201, 200, 1608, 200, 1609, 1609, 200, 199,
+    1609, 199, 1610, 1610, 199, 198, 1610, 198,
+    1611, 1611, 198, 197, 1611, 197, 1612, 1612,
+    197, 196, 1612, 196, 1613, 1613, 196, 195,
+    1613, 195, 1614, 1614, 195, 194, 1614, 194,
+    1615, 1615, 194, 193, 1615, 193, 1616, 1616,
+    193, 192, 1616, 192, 311, 311, 192, 10,
+    7, 297, 327, 297, 298, 1617, 297, 1617,
+    327, 327, 1617, 328, 298, 299, 1618, 298,
+    1618, 1617, 1617, 1618, 1619, 1617, 1619, 328,
+    328, 1619, 329, 299, 300, 1620, 299, 1620,
+    1618, 1618, 1620, 1621, 1618, 1621, 1619, 1619,
+    1621, 1622, 1619, 1622, 329, 329, 1622, 330,
+    300, 301, 1623, 300, 1623, 1620, 1620, 1623,
+    1624, 1620, 1624, 1621, 1621, 1624, 1625, 1621,
+    1625, 1622, 1622, 1625, 1626, 1622, 1626, 330,
+    330, 1626, 331, 301, 302, 1627, 301, 1627,
+    1623, 1623, 1627, 1628, 1623, 1628, 1624, 1624,
+    1628, 1629, 1624, 1629, 1625, 1625, 1629, 1630,
+    1625, 1630, 1626, 1626, 1630, 1631, 1626, 1631,
+    331, 331, 1631, 332, 302, 303, 1632, 302,
+    1632, 1627, 1627, 1632, 1633, 1627, 1633, 1628,
+    1628, 1633, 1634, 1628, 1634, 1629, 1629, 1634,
+    1635, 1629, 1635, 1630, 1630, 1635, 1636, 1630,
+    1636, 1631, 1631, 1636, 1637, 1631, 1637, 332,
+    332, 1637, 333, 303, 304, 1638, 303, 1638,
+    1632, 1632, 1638, 1639, 1632, 1639, 1633, 1633,
+    1639, 1640, 1633, 1640, 1634, 1634, 1640, 1641,
+    1634, 1641, 1635, 1635, 1641, 1642, 1635, 1642,
+    1636, 1636, 1642, 1643, 1636, 1643, 1637, 1637,
+    1643, 1644, 1637, 1644, 333, 333, 1644, 334,
+    304, 305, 1645, 304, 1645, 1638, 1638, 1645,
+    1646, 1638, 1646, 1639, 1639, 1646, 1647, 1639,
+    1647, 1640, 1640, 1647, 1648, 1640, 1648, 1641,
+    1641, 1648, 1649, 1641, 1649, 1642, 1642, 1649,
+    1650, 1642, 1650, 1643, 1643, 1650, 1651, 1643,
+    1651, 1644, 1644, 1651, 1652, 1644, 1652, 334,
+    334, 1652, 335, 305, 306, 1653, 305, 1653,
+    1645, 1645, 1653, 1654, 1645, 1654, 1646, 1646,
+    1654, 1655, 1646, 1655, 1647, 1647, 1655, 1656,
+    1647, 1656, 1648, 1648, 1656, 1657, 1648, 1657,
+    1649, 1649, 1657, 1658, 1649, 1658, 1650, 1650,
+    1658, 1659, 1650, 1659, 1651, 1651, 1659, 1660,
+    1651, 1660, 1652, 1652, 1660, 1661, 1652, 1661,
+    335, 335, 1661, 336, 306, 307, 1662, 306,
+    1662, 1653, 1653, 1662, 1663, 1653, 1663, 1654,
+    1654, 1663, 1664, 1654, 1664, 1655, 1655, 1664,
+    1665, 1655, 1665, 1656, 1656, 1665, 1666, 1656,
+    1666, 1657, 1657, 1666, 1667, 1657, 1667, 1658,
+    1658, 1667, 1668, 1658, 1668, 1659, 1659, 1668,
+    1669, 1659, 1669, 1660, 1660, 1669, 1670, 1660,
+    1670, 1661, 1661, 1670, 1671, 1661, 1671, 336,
+    336, 1671, 337, 307, 308, 1672, 307, 1672,
+    1662, 1662, 1672, 1673, 1662, 1673, 1663, 1663,
+    1673, 1674, 1663, 1674, 1664, 1664, 1674, 1675,
+    1664, 1675, 1665, 1665, 1675, 1676, 1665, 1676,
+    1666, 1666, 1676, 1677, 1666, 1677, 1667, 1667,
+    1677, 1678, 1667, 1678, 1668, 1668, 1678, 1679,
+    1668, 1679, 1669, 1669, 1679, 1680, 1669, 1680,
+    1670, 1670, 1680, 1681, 1670, 1681, 1671, 1671,
+    1681, 1682, 1671, 1682, 337, 337, 1682, 338,
+    308, 309, 1683, 308, 1683, 1672, 1672, 1683,
+    1684, 1672, 1684, 1673, 1673, 1684, 1685, 1673,
+    1685, 1674, 1674, 1685, 1686, 1674, 1686, 1675,
+    1675, 1686, 1687, 1675, 1687, 1676, 1676, 1687,
+    1688, 1676, 1688, 1677, 1677, 1688, 1689, 1677,
+    1689, 1678, 1678, 1689, 1690, 1678, 1690, 1679,
+    1679, 1690, 1691, 1679, 1691, 1680, 1680, 1691,
+    1692, 1680, 1692, 1681, 1681, 1692, 1693, 1681,
+    1693, 1682, 1682, 1693, 1694, 1682, 1694, 338,
+    338, 1694, 339, 309, 310, 1695, 309, 1695,
+    1683, 1683, 1695, 1696, 1683, 1696, 1684, 1684,
+    1696, 1697, 1684, 1697, 1685, 1685, 1697, 1698,
+    1685, 1698, 1686, 1686, 1698, 1699, 1686, 1699,
+    1687, 1687, 1699, 1700, 1687, 1700, 1688, 1688,
+    1700, 1701, 1688, 1701, 1689, 1689, 1701, 1702,
+    1689, 1702, 1690, 1690, 1702, 1703, 1690, 1703,
+    1691, 1691, 1703, 1704, 1691, 1704, 1692, 1692,
+    1704, 1705, 1692, 1705, 1693, 1693, 1705, 1706,
+    1693, 1706, 1694, 1694, 1706, 1707, 1694, 1707,
+    339, 339, 1707, 340, 310, 311, 1708, 310,
+    1708, 1695, 1695, 1708, 1709, 1695, 1709, 1696,
+    1696, 1709, 1710, 1696, 1710, 1697, 1697, 1710,
+    1711, 1697, 1711, 1698, 1698, 1711, 1712, 1698,
+    1712, 1699, 1699, 1712, 1713, 1699, 1713, 1700,
+    1700, 1713, 1714, 1700, 1714, 1701, 1701, 1714,
+    1715, 1701, 1715, 1702, 1702, 1715, 1716, 1702,
+    1716, 1703, 1703, 1716, 1717, 1703, 1717, 1704,
+    1704, 1717, 1718, 1704, 1718, 1705, 1705, 1718,
+    1719, 1705, 1719, 1706, 1706, 1719, 1720, 1706,
+    1720, 1707, 1707, 1720, 1721, 1707, 1721, 340,
+    340, 1721, 341, 311, 10, 312, 311, 312,
+    1708, 1708, 312, 313, 1708, 313, 1709, 1709,
+    313, 314, 1709, 314, 1710, 1710, 314, 315,
+    1710, 315, 1711, 1711, 315, 316, 1711, 316,
+    1712, 1712, 316, 317, 1712, 317, 1713, 1713,
+    317, 318, 1713, 318, 1714, 1714, 318, 319,
+    1714, 319, 1715, 1715, 319, 320, 1715, 320,
+    1716, 1716, 320, 321, 1716, 321, 1717, 1717,
+    321, 322, 1717, 322, 1718, 1718, 322, 323,
+    1718, 323, 1719, 1719, 323, 324, 1719, 324,
+    1720, 1720, 324, 325, 1720, 325, 1721, 1721,
+    325, 326, 1721, 326, 341, 341, 326, 6,
+    7, 327, 357, 327, 328, 1722, 327, 1722,
+    357, 357, 1722, 358, 328, 329, 1723, 328,
+    1723, 1722, 1722, 1723, 1724, 1722, 1724, 358,
+    358, 1724, 359, 329, 330, 1725, 329, 1725,
+    1723, 1723, 1725, 1726, 1723, 1726, 1724, 1724,
+    1726, 1727, 1724, 1727, 359, 359, 1727, 360,
+    330, 331, 1728, 330, 1728, 1725, 1725, 1728,
+    1729, 1725, 1729, 1726, 1726, 1729, 1730, 1726,
+    1730, 1727, 1727, 1730, 1731, 1727, 1731, 360,
+    360, 1731, 361, 331, 332, 1732, 331, 1732,
+    1728, 1728, 1732, 1733, 1728, 1733, 1729, 1729,
+    1733, 1734, 1729, 1734, 1730, 1730, 1734, 1735,
+    1730, 1735, 1731, 1731, 1735, 1736, 1731, 1736,
+    361, 361, 1736, 362, 332, 333, 1737, 332,
+    1737, 1732, 1732, 1737, 1738, 1732, 1738, 1733,
+    1733, 1738, 1739, 1733, 1739, 1734, 1734, 1739,
+    1740, 1734, 1740, 1735, 1735, 1740, 1741, 1735,
+    1741, 1736, 1736, 1741, 1742, 1736, 1742, 362,
+    362, 1742, 363, 333, 334, 1743, 333, 1743,
+    1737, 1737, 1743, 1744, 1737, 1744, 1738, 1738,
+    1744, 1745, 1738, 1745, 1739, 1739, 1745, 1746,
+    1739, 1746, 1740, 1740, 1746, 1747, 1740, 1747,
+    1741, 1741, 1747, 1748, 1741, 1748, 1742, 1742,
+    1748, 1749, 1742, 1749, 363, 363, 1749, 364,
+    334, 335, 1750, 334, 1750, 1743, 1743, 1750,
+    1751, 1743, 1751, 1744, 1744, 1751, 1752, 1744,
+    1752, 1745, 1745, 1752, 1753, 1745, 1753, 1746,
+    1746, 1753, 1754, 1746, 1754, 1747, 1747, 1754,
+    1755, 1747, 1755, 1748, 1748, 1755, 1756, 1748,
+    1756, 1749, 1749, 1756, 1757, 1749, 1757, 364,
+    364, 1757, 365, 335, 336, 1758, 335, 1758,
+    1750, 1750, 1758, 1759, 1750, 1759, 1751, 1751,
+    1759, 1760, 1751, 1760, 1752, 1752, 1760, 1761,
+    1752, 1761, 1753, 1753, 1761, 1762, 1753, 1762,
+    1754, 1754, 1762, 1763, 1754, 1763, 1755, 1755,
+    1763, 1764, 1755, 1764, 1756, 1756, 1764, 1765,
+    1756, 1765, 1757, 1757, 1765, 1766, 1757, 1766,
+    365, 365, 1766, 366, 336, 337, 1767, 336,
+    1767, 1758, 1758, 1767, 1768, 1758, 1768, 1759,
+    1759, 1768, 1769, 1759, 1769, 1760, 1760, 1769,
+    1770, 1760, 1770, 1761, 1761, 1770, 1771, 1761,
+    1771, 1762, 1762, 1771, 1772, 1762, 1772, 1763,
+    1763, 1772, 1773, 1763, 1773, 1764, 1764, 1773,
+    1774, 1764, 1774, 1765, 1765, 1774, 1775, 1765,
+    1775, 1766, 1766, 1775, 1776, 1766, 1776, 366,
+    366, 1776, 367, 337, 338, 1777, 337, 1777,
+    1767, 1767, 1777, 1778, 1767, 1778, 1768, 1768,
+    1778, 1779, 1768, 1779, 1769, 1769, 1779, 1780,
+    1769, 1780, 1770, 1770, 1780, 1781, 1770, 1781,
+    1771, 1771, 1781, 1782, 1771, 1782, 1772, 1772,
+    1782, 1783, 1772, 1783, 1773, 1773, 1783, 1784,
+    1773, 1784, 1774, 1774, 1784, 1785, 1774, 1785,
+    1775, 1775, 1785, 1786, 1775, 1786, 1776, 1776,
+    1786, 1787, 1776, 1787, 367, 367, 1787, 368,
+    338, 339, 1788, 338, 1788, 1777, 1777, 1788,
+    1789, 1777, 1789, 1778, 1778, 1789, 1790, 1778,
+    1790, 1779, 1779, 1790, 1791, 1779, 1791, 1780,
+    1780, 1791, 1792, 1780, 1792, 1781, 1781, 1792,
+    1793, 1781, 1793, 1782, 1782, 1793, 1794, 1782,
+    1794, 1783, 1783, 1794, 1795, 1783, 1795, 1784,
+    1784, 1795, 1796, 1784, 1796, 1785, 1785, 1796,
+    1797, 1785, 1797, 1786, 1786, 1797, 1798, 1786,
+    1798, 1787, 1787, 1798, 1799, 1787, 1799, 368,
+    368, 1799, 369, 339, 340, 1800, 339, 1800,
+    1788, 1788, 1800, 1801, 1788, 1801, 1789, 1789,
+    1801, 1802, 1789, 1802, 1790, 1790, 1802, 1803,
+    1790, 1803, 1791, 1791, 1803, 1804, 1791, 1804,
+    1792, 1792, 1804, 1805, 1792, 1805, 1793, 1793,
+    1805, 1806, 1793, 1806, 1794, 1794, 1806, 1807,
+    1794, 1807, 1795, 1795, 1807, 1808, 1795, 1808,
+    1796, 1796, 1808, 1809, 1796, 1809, 1797, 1797,
+    1809, 1810, 1797, 1810, 1798, 1798, 1810, 1811,
+    1798, 1811, 1799, 1799, 1811, 1812, 1799, 1812,
+    369, 369, 1812, 370, 340, 341, 1813, 340,
+    1813, 1800, 1800, 1813, 1814, 1800, 1814, 1801,
+    1801, 1814, 1815, 1801, 1815, 1802, 1802, 1815,
+    1816, 1802, 1816, 1803, 1803, 1816, 1817, 1803,
+    1817, 1804, 1804, 1817, 1818, 1804, 1818, 1805,
+    1805, 1818, 1819, 1805, 1819, 1806, 1806, 1819,
+    1820, 1806, 1820, 1807, 1807, 1820, 1821, 1807,
+    1821, 1808, 1808, 1821, 1822, 1808, 1822, 1809,
+    1809, 1822, 1823, 1809, 1823, 1810, 1810, 1823,
+    1824, 1810, 1824, 1811, 1811, 1824, 1825, 1811,
+    1825, 1812, 1812, 1825, 1826, 1812, 1826, 370,
+    370, 1826, 371, 341, 6, 342, 341, 342,
+    1813, 1813, 342, 343, 1813, 343, 1814, 1814,
+    343, 344, 1814, 344, 1815, 1815, 344, 345,
+    1815, 345, 1816, 1816, 345, 346, 1816, 346,
+    1817, 1817, 346, 347, 1817, 347, 1818, 1818,
+    347, 348, 1818, 348, 1819, 1819, 348, 349,
+    1819, 349, 1820, 1820, 349, 350, 1820, 350,
+    1821, 1821, 350, 351, 1821, 351, 1822, 1822,
+    351, 352, 1822, 352, 1823, 1823, 352, 353,
+    1823, 353, 1824, 1824, 353, 354, 1824, 354,
+    1825, 1825, 354, 355, 1825, 355, 1826, 1826,
+    355, 356, 1826, 356, 371, 371, 356, 11,
+    11, 356, 387, 356, 355, 1827, 356, 1827,
+    387, 387, 1827, 388, 355, 354, 1828, 355,
+    1828, 1827, 1827, 1828, 1829, 1827, 1829, 388,
+    388, 1829, 389, 354, 353, 1830, 354, 1830,
+    1828, 1828, 1830, 1831, 1828, 1831, 1829, 1829,
+    1831, 1832, 1829, 1832, 389, 389, 1832, 390,
+    353, 352, 1833, 353, 1833, 1830, 1830, 1833,
+    1834, 1830, 1834, 1831, 1831, 1834, 1835, 1831,
+    1835, 1832, 1832, 1835, 1836, 1832, 1836, 390,
+    390, 1836, 391, 352, 351, 1837, 352, 1837,
+    1833, 1833, 1837, 1838, 1833, 1838, 1834, 1834,
+    1838, 1839, 1834, 1839, 1835, 1835, 1839, 1840,
+    1835, 1840, 1836, 1836, 1840, 1841, 1836, 1841,
+    391, 391, 1841, 392, 351, 350, 1842, 351,
+    1842, 1837, 1837, 1842, 1843, 1837, 1843, 1838,
+    1838, 1843, 1844, 1838, 1844, 1839, 1839, 1844,
+    1845, 1839, 1845, 1840, 1840, 1845, 1846, 1840,
+    1846, 1841, 1841, 1846, 1847, 1841, 1847, 392,
+    392, 1847, 393, 350, 349, 1848, 350, 1848,
+    1842, 1842, 1848, 1849, 1842, 1849, 1843, 1843,
+    1849, 1850, 1843, 1850, 1844, 1844, 1850, 1851,
+    1844, 1851, 1845, 1845, 1851, 1852, 1845, 1852,
+    1846, 1846, 1852, 1853, 1846, 1853, 1847, 1847,
+    1853, 1854, 1847, 1854, 393, 393, 1854, 394,
+    349, 348, 1855, 349, 1855, 1848, 1848, 1855,
+    1856, 1848, 1856, 1849, 1849, 1856, 1857, 1849,
+    1857, 1850, 1850, 1857, 1858, 1850, 1858, 1851,
+    1851, 1858, 1859, 1851, 1859, 1852, 1852, 1859,
+    1860, 1852, 1860, 1853, 1853, 1860, 1861, 1853,
+    1861, 1854, 1854, 1861, 1862, 1854, 1862, 394,
+    394, 1862, 395, 348, 347, 1863, 348, 1863,
+    1855, 1855, 1863, 1864, 1855, 1864, 1856, 1856,
+    1864, 1865, 1856, 1865, 1857, 1857, 1865, 1866,
+    1857, 1866, 1858, 1858, 1866, 1867, 1858, 1867,
+    1859, 1859, 1867, 1868, 1859, 1868, 1860, 1860,
+    1868, 1869, 1860, 1869, 1861, 1861, 1869, 1870,
+    1861, 1870, 1862, 1862, 1870, 1871, 1862, 1871,
+    395, 395, 1871, 396, 347, 346, 1872, 347,
+    1872, 1863, 1863, 1872, 1873, 1863, 1873, 1864,
+    1864, 1873, 1874, 1864, 1874, 1865, 1865, 1874,
+    1875, 1865, 1875, 1866, 1866, 1875, 1876, 1866,
+    1876, 1867, 1867, 1876, 1877, 1867, 1877, 1868,
+    1868, 1877, 1878, 1868, 1878, 1869, 1869, 1878,
+    1879, 1869, 1879, 1870, 1870, 1879, 1880, 1870,
+    1880, 1871, 1871, 1880, 1881, 1871, 1881, 396,
+    396, 1881, 397, 346, 345, 1882, 346, 1882,
+    1872, 1872, 1882, 1883, 1872, 1883, 1873, 1873,
+    1883, 1884, 1873, 1884, 1874, 1874, 1884, 1885,
+    1874, 1885, 1875, 1875, 1885, 1886, 1875, 1886,
+    1876, 1876, 1886, 1887, 1876, 1887, 1877, 1877,
+    1887, 1888, 1877, 1888, 1878, 1878, 1888, 1889,
+    1878, 1889, 1879, 1879, 1889, 1890, 1879, 1890,
+    1880, 1880, 1890, 1891, 1880, 1891, 1881, 1881,
+    1891, 1892, 1881, 1892, 397, 397, 1892, 398,
+    345, 344, 1893, 345, 1893, 1882, 1882, 1893,
+    1894, 1882, 1894, 1883, 1883, 1894, 1895, 1883,
+    1895, 1884, 1884, 1895, 1896, 1884, 1896, 1885,
+    1885, 1896, 1897, 1885, 1897, 1886, 1886, 1897,
+    1898, 1886, 1898, 1887, 1887, 1898, 1899, 1887,
+    1899, 1888, 1888, 1899, 1900, 1888, 1900, 1889,
+    1889, 1900, 1901, 1889, 1901, 1890, 1890, 1901,
+    1902, 1890, 1902, 1891, 1891, 1902, 1903, 1891,
+    1903, 1892, 1892, 1903, 1904, 1892, 1904, 398,
+    398, 1904, 399, 344, 343, 1905, 344, 1905,
+    1893, 1893, 1905, 1906, 1893, 1906, 1894, 1894,
+    1906, 1907, 1894, 1907, 1895, 1895, 1907, 1908,
+    1895, 1908, 1896, 1896, 1908, 1909, 1896, 1909,
+    1897, 1897, 1909, 1910, 1897, 1910, 1898, 1898,
+    1910, 1911, 1898, 1911, 1899, 1899, 1911, 1912,
+    1899, 1912, 1900, 1900, 1912, 1913, 1900, 1913,
+    1901, 1901, 1913, 1914, 1901, 1914, 1902, 1902,
+    1914, 1915, 1902, 1915, 1903, 1903, 1915, 1916,
+    1903, 1916, 1904, 1904, 1916, 1917, 1904, 1917,
+    399, 399, 1917, 400, 343, 342, 1918, 343,
+    1918, 1905, 1905, 1918, 1919, 1905, 1919, 1906,
+    1906, 1919, 1920, 1906, 1920, 1907, 1907, 1920,
+    1921, 1907, 1921, 1908, 1908, 1921, 1922, 1908,
+    1922, 1909, 1909, 1922, 1923, 1909, 1923, 1910,
+    1910, 1923, 1924, 1910, 1924, 1911, 1911, 1924,
+    1925, 1911, 1925, 1912, 1912, 1925, 1926, 1912,
+    1926, 1913, 1913, 1926, 1927, 1913, 1927, 1914,
+    1914, 1927, 1928, 1914, 1928, 1915, 1915, 1928,
+    1929, 1915, 1929, 1916, 1916, 1929, 1930, 1916,
+    1930, 1917, 1917, 1930, 1931, 1917, 1931, 400,
+    400, 1931, 401, 342, 6, 372, 342, 372,
+    1918, 1918, 372, 373, 1918, 373, 1919, 1919,
+    373, 374, 1919, 374, 1920, 1920, 374, 375,
+    1920, 375, 1921, 1921, 375, 376, 1921, 376,
+    1922, 1922, 376, 377, 1922, 377, 1923, 1923,
+    377, 378, 1923, 378, 1924, 1924, 378, 379,
+    1924, 379, 1925, 1925, 379, 380, 1925, 380,
+    1926, 1926, 380, 381, 1926, 381, 1927, 1927,
+    381, 382, 1927, 382, 1928, 1928, 382, 383,
+    1928, 383, 1929, 1929, 383, 384, 1929, 384,
+    1930, 1930, 384, 385, 1930, 385, 1931, 1931,
+    385, 386, 1931, 386, 401, 401, 386, 0,
+    0, 386, 12, 386, 385, 1932, 386, 1932,
+    12, 12, 1932, 13, 385, 384, 1933, 385,
+    1933, 1932, 1932, 1933, 1934, 1932, 1934, 13,
+    13, 1934, 14, 384, 383, 1935, 384, 1935,
+    1933, 1933, 1935, 1936, 1933, 1936, 1934, 1934,
+    1936, 1937, 1934, 1937, 14, 14, 1937, 15,
+    383, 382, 1938, 383, 1938, 1935, 1935, 1938,
+    1939, 1935, 1939, 1936, 1936, 1939, 1940, 1936,
+    1940, 1937, 1937, 1940, 1941, 1937, 1941, 15,
+    15, 1941, 16, 382, 381, 1942, 382, 1942,
+    1938, 1938, 1942, 1943, 1938, 1943, 1939, 1939,
+    1943, 1944, 1939, 1944, 1940, 1940, 1944, 1945,
+    1940, 1945, 1941, 1941, 1945, 1946, 1941, 1946,
+    16, 16, 1946, 17, 381, 380, 1947, 381,
+    1947, 1942, 1942, 1947, 1948, 1942, 1948, 1943,
+    1943, 1948, 1949, 1943, 1949, 1944, 1944, 1949,
+    1950, 1944, 1950, 1945, 1945, 1950, 1951, 1945,
+    1951, 1946, 1946, 1951, 1952, 1946, 1952, 17,
+    17, 1952, 18, 380, 379, 1953, 380, 1953,
+    1947, 1947, 1953, 1954, 1947, 1954, 1948, 1948,
+    1954, 1955, 1948, 1955, 1949, 1949, 1955, 1956,
+    1949, 1956, 1950, 1950, 1956, 1957, 1950, 1957,
+    1951, 1951, 1957, 1958, 1951, 1958, 1952, 1952,
+    1958, 1959, 1952, 1959, 18, 18, 1959, 19,
+    379, 378, 1960, 379, 1960, 1953, 1953, 1960,
+    1961, 1953, 1961, 1954, 1954, 1961, 1962, 1954,
+    1962, 1955, 1955, 1962, 1963, 1955, 1963, 1956,
+    1956, 1963, 1964, 1956, 1964, 1957, 1957, 1964,
+    1965, 1957, 1965, 1958, 1958, 1965, 1966, 1958,
+    1966, 1959, 1959, 1966, 1967, 1959, 1967, 19,
+    19, 1967, 20, 378, 377, 1968, 378, 1968,
+    1960, 1960, 1968, 1969, 1960, 1969, 1961, 1961,
+    1969, 1970, 1961, 1970, 1962, 1962, 1970, 1971,
+    1962, 1971, 1963, 1963, 1971, 1972, 1963, 1972,
+    1964, 1964, 1972, 1973, 1964, 1973, 1965, 1965,
+    1973, 1974, 1965, 1974, 1966, 1966, 1974, 1975,
+    1966, 1975, 1967, 1967, 1975, 1976, 1967, 1976,
+    20, 20, 1976, 21, 377, 376, 1977, 377,
+    1977, 1968, 1968, 1977, 1978, 1968, 1978, 1969,
+    1969, 1978, 1979, 1969, 1979, 1970, 1970, 1979,
+    1980, 1970, 1980, 1971, 1971, 1980, 1981, 1971,
+    1981, 1972, 1972, 1981, 1982, 1972, 1982, 1973,
+    1973, 1982, 1983, 1973, 1983, 1974, 1974, 1983,
+    1984, 1974, 1984, 1975, 1975, 1984, 1985, 1975,
+    1985, 1976, 1976, 1985, 1986, 1976, 1986, 21,
+    21, 1986, 22, 376, 375, 1987, 376, 1987,
+    1977, 1977, 1987, 1988, 1977, 1988, 1978, 1978,
+    1988, 1989, 1978, 1989, 1979, 1979, 1989, 1990,
+    1979, 1990, 1980, 1980, 1990, 1991, 1980, 1991,
+    1981, 1981, 1991, 1992, 1981, 1992, 1982, 1982,
+    1992, 1993, 1982, 1993, 1983, 1983, 1993, 1994,
+    1983, 1994, 1984, 1984, 1994, 1995, 1984, 1995,
+    1985, 1985, 1995, 1996, 1985, 1996, 1986, 1986,
+    1996, 1997, 1986, 1997, 22, 22, 1997, 23,
+    375, 374, 1998, 375, 1998, 1987, 1987, 1998,
+    1999, 1987, 1999, 1988, 1988, 1999, 2000, 1988,
+    2000, 1989, 1989, 2000, 2001, 1989, 2001, 1990,
+    1990, 2001, 2002, 1990, 2002, 1991, 1991, 2002,
+    2003, 1991, 2003, 1992, 1992, 2003, 2004, 1992,
+    2004, 1993, 1993, 2004, 2005, 1993, 2005, 1994,
+    1994, 2005, 2006, 1994, 2006, 1995, 1995, 2006,
+    2007, 1995, 2007, 1996, 1996, 2007, 2008, 1996,
+    2008, 1997, 1997, 2008, 2009, 1997, 2009, 23,
+    23, 2009, 24, 374, 373, 2010, 374, 2010,
+    1998, 1998, 2010, 2011, 1998, 2011, 1999, 1999,
+    2011, 2012, 1999, 2012, 2000, 2000, 2012, 2013,
+    2000, 2013, 2001, 2001, 2013, 2014, 2001, 2014,
+    2002, 2002, 2014, 2015, 2002, 2015, 2003, 2003,
+    2015, 2016, 2003, 2016, 2004, 2004, 2016, 2017,
+    2004, 2017, 2005, 2005, 2017, 2018, 2005, 2018,
+    2006, 2006, 2018, 2019, 2006, 2019, 2007, 2007,
+    2019, 2020, 2007, 2020, 2008, 2008, 2020, 2021,
+    2008, 2021, 2009, 2009, 2021, 2022, 2009, 2022,
+    24, 24, 2022, 25, 373, 372, 2023, 373,
+    2023, 2010, 2010, 2023, 2024, 2010, 2024, 2011,
+    2011, 2024, 2025, 2011, 2025, 2012, 2012, 2025,
+    2026, 2012, 2026, 2013, 2013, 2026, 2027, 2013,
+    2027, 2014, 2014, 2027, 2028, 2014, 2028, 2015,
+    2015, 2028, 2029, 2015, 2029, 2016, 2016, 2029,
+    2030, 2016, 2030, 2017, 2017, 2030, 2031, 2017,
+    2031, 2018, 2018, 2031, 2032, 2018, 2032, 2019,
+    2019, 2032, 2033, 2019, 2033, 2020, 2020, 2033,
+    2034, 2020, 2034, 2021, 2021, 2034, 2035, 2021,
+    2035, 2022, 2022, 2035, 2036, 2022, 2036, 25,
+    25, 2036, 26, 372, 6, 402, 372, 402,
+    2023, 2023, 402, 403, 2023, 403, 2024, 2024,
+    403, 404, 2024, 404, 2025, 2025, 404, 405,
+    2025, 405, 2026, 2026, 405, 406, 2026, 406,
+    2027, 2027, 406, 407, 2027, 407, 2028, 2028,
+    407, 408, 2028, 408, 2029, 2029, 408, 409,
+    2029, 409, 2030, 2030, 409, 410, 2030, 410,
+    2031, 2031, 410, 411, 2031, 411, 2032, 2032,
+    411, 412, 2032, 412, 2033, 2033, 412, 413,
+    2033, 413, 2034, 2034, 413, 414, 2034, 414,
+    2035, 2035, 414, 415, 2035, 415, 2036, 2036,
+    415, 416, 2036, 416, 26, 26, 416, 1,
+    6, 326, 402, 326, 325, 2037, 326, 2037,
+    402, 402, 2037, 403, 325, 324, 2038, 325,
+    2038, 2037, 2037, 2038, 2039, 2037, 2039, 403,
+    403, 2039, 404, 324, 323, 2040, 324, 2040,
+    2038, 2038, 2040, 2041, 2038, 2041, 2039, 2039,
+    2041, 2042, 2039, 2042, 404, 404, 2042, 405,
+    323, 322, 2043, 323, 2043, 2040, 2040, 2043,
+    2044, 2040, 2044, 2041, 2041, 2044, 2045, 2041,
+    2045, 2042, 2042, 2045, 2046, 2042, 2046, 405,
+    405, 2046, 406, 322, 321, 2047, 322, 2047,
+    2043, 2043, 2047, 2048, 2043, 2048, 2044, 2044,
+    2048, 2049, 2044, 2049, 2045, 2045, 2049, 2050,
+    2045, 2050, 2046, 2046, 2050, 2051, 2046, 2051,
+    406, 406, 2051, 407, 321, 320, 2052, 321,
+    2052, 2047, 2047, 2052, 2053, 2047, 2053, 2048,
+    2048, 2053, 2054, 2048, 2054, 2049, 2049, 2054,
+    2055, 2049, 2055, 2050, 2050, 2055, 2056, 2050,
+    2056, 2051, 2051, 2056, 2057, 2051, 2057, 407,
+    407, 2057, 408, 320, 319, 2058, 320, 2058,
+    2052, 2052, 2058, 2059, 2052, 2059, 2053, 2053,
+    2059, 2060, 2053, 2060, 2054, 2054, 2060, 2061,
+    2054, 2061, 2055, 2055, 2061, 2062, 2055, 2062,
+    2056, 2056, 2062, 2063, 2056, 2063, 2057, 2057,
+    2063, 2064, 2057, 2064, 408, 408, 2064, 409,
+    319, 318, 2065, 319, 2065, 2058, 2058, 2065,
+    2066, 2058, 2066, 2059, 2059, 2066, 2067, 2059,
+    2067, 2060, 2060, 2067, 2068, 2060, 2068, 2061,
+    2061, 2068, 2069, 2061, 2069, 2062, 2062, 2069,
+    2070, 2062, 2070, 2063, 2063, 2070, 2071, 2063,
+    2071, 2064, 2064, 2071, 2072, 2064, 2072, 409,
+    409, 2072, 410, 318, 317, 2073, 318, 2073,
+    2065, 2065, 2073, 2074, 2065, 2074, 2066, 2066,
+    2074, 2075, 2066, 2075, 2067, 2067, 2075, 2076,
+    2067, 2076, 2068, 2068, 2076, 2077, 2068, 2077,
+    2069, 2069, 2077, 2078, 2069, 2078, 2070, 2070,
+    2078, 2079, 2070, 2079, 2071, 2071, 2079, 2080,
+    2071, 2080, 2072, 2072, 2080, 2081, 2072, 2081,
+    410, 410, 2081, 411, 317, 316, 2082, 317,
+    2082, 2073, 2073, 2082, 2083, 2073, 2083, 2074,
+    2074, 2083, 2084, 2074, 2084, 2075, 2075, 2084,
+    2085, 2075, 2085, 2076, 2076, 2085, 2086, 2076,
+    2086, 2077, 2077, 2086, 2087, 2077, 2087, 2078,
+    2078, 2087, 2088, 2078, 2088, 2079, 2079, 2088,
+    2089, 2079, 2089, 2080, 2080, 2089, 2090, 2080,
+    2090, 2081, 2081, 2090, 2091, 2081, 2091, 411,
+    411, 2091, 412, 316, 315, 2092, 316, 2092,
+    2082, 2082, 2092, 2093, 2082, 2093, 2083, 2083,
+    2093, 2094, 2083, 2094, 2084, 2084, 2094, 2095,
+    2084, 2095, 2085, 2085, 2095, 2096, 2085, 2096,
+    2086, 2086, 2096, 2097, 2086, 2097, 2087, 2087,
+    2097, 2098, 2087, 2098, 2088, 2088, 2098, 2099,
+    2088, 2099, 2089, 2089, 2099, 2100, 2089, 2100,
+    2090, 2090, 2100, 2101, 2090, 2101, 2091, 2091,
+    2101, 2102, 2091, 2102, 412, 412, 2102, 413,
+    315, 314, 2103, 315, 2103, 2092, 2092, 2103,
+    2104, 2092, 2104, 2093, 2093, 2104, 2105, 2093,
+    2105, 2094, 2094, 2105, 2106, 2094, 2106, 2095,
+    2095, 2106, 2107, 2095, 2107, 2096, 2096, 2107,
+    2108, 2096, 2108, 2097, 2097, 2108, 2109, 2097,
+    2109, 2098, 2098, 2109, 2110, 2098, 2110, 2099,
+    2099, 2110, 2111, 2099, 2111, 2100, 2100, 2111,
+    2112, 2100, 2112, 2101, 2101, 2112, 2113, 2101,
+    2113, 2102, 2102, 2113, 2114, 2102, 2114, 413,
+    413, 2114, 414, 314, 313, 2115, 314, 2115,
+    2103, 2103, 2115, 2116, 2103, 2116, 2104, 2104,
+    2116, 2117, 2104, 2117, 2105, 2105, 2117, 2118,
+    2105, 2118, 2106, 2106, 2118, 2119, 2106, 2119,
+    2107, 2107, 2119, 2120, 2107, 2120, 2108, 2108,
+    2120, 2121, 2108, 2121, 2109, 2109, 2121, 2122,
+    2109, 2122, 2110, 2110, 2122, 2123, 2110, 2123,
+    2111, 2111, 2123, 2124, 2111, 2124, 2112, 2112,
+    2124, 2125, 2112, 2125, 2113, 2113, 2125, 2126,
+    2113, 2126, 2114, 2114, 2126, 2127, 2114, 2127,
+    414, 414, 2127, 415, 313, 312, 2128, 313,
+    2128, 2115, 2115, 2128, 2129, 2115, 2129, 2116,
+    2116, 2129, 2130, 2116, 2130, 2117, 2117, 2130,
+    2131, 2117, 2131, 2118, 2118, 2131, 2132, 2118,
+    2132, 2119, 2119, 2132, 2133, 2119, 2133, 2120,
+    2120, 2133, 2134, 2120, 2134, 2121, 2121, 2134,
+    2135, 2121, 2135, 2122, 2122, 2135, 2136, 2122,
+    2136, 2123, 2123, 2136, 2137, 2123, 2137, 2124,
+    2124, 2137, 2138, 2124, 2138, 2125, 2125, 2138,
+    2139, 2125, 2139, 2126, 2126, 2139, 2140, 2126,
+    2140, 2127, 2127, 2140, 2141, 2127, 2141, 415,
+    415, 2141, 416, 312, 10, 176, 312, 176,
+    2128, 2128, 176, 175, 2128, 175, 2129, 2129,
+    175, 174, 2129, 174, 2130, 2130, 174, 173,
+    2130, 173, 2131, 2131, 173, 172, 2131, 172,
+    2132, 2132, 172, 171, 2132, 171, 2133, 2133,
+    171, 170, 2133, 170, 2134, 2134, 170, 169,
+    2134, 169, 2135, 2135, 169, 168, 2135, 168,
+    2136, 2136, 168, 167, 2136, 167, 2137, 2137,
+    167, 166, 2137, 166, 2138, 2138, 166, 165,
+    2138, 165, 2139, 2139, 165, 164, 2139, 164,
+    2140, 2140, 164, 163, 2140, 163, 2141, 2141,
+    163, 162, 2141, 162, 416, 416, 162, 1,
+    9, 417, 86, 417, 418, 2142, 417, 2142,
+    86, 86, 2142, 85, 418, 419, 2143, 418,
+    2143, 2142, 2142, 2143, 2144, 2142, 2144, 85,
+    85, 2144, 84, 419, 420, 2145, 419, 2145,
+    2143, 2143, 2145, 2146, 2143, 2146, 2144, 2144,
+    2146, 2147, 2144, 2147, 84, 84, 2147, 83,
+    420, 421, 2148, 420, 2148, 2145, 2145, 2148,
+    2149, 2145, 2149, 2146, 2146, 2149, 2150, 2146,
+    2150, 2147, 2147, 2150, 2151, 2147, 2151, 83,
+    83, 2151, 82, 421, 422, 2152, 421, 2152,
+    2148, 2148, 2152, 2153, 2148, 2153, 2149, 2149,
+    2153, 2154, 2149, 2154, 2150, 2150, 2154, 2155,
+    2150, 2155, 2151, 2151, 2155, 2156, 2151, 2156,
+    82, 82, 2156, 81, 422, 423, 2157, 422,
+    2157, 2152, 2152, 2157, 2158, 2152, 2158, 2153,
+    2153, 2158, 2159, 2153, 2159, 2154, 2154, 2159,
+    2160, 2154, 2160, 2155, 2155, 2160, 2161, 2155,
+    2161, 2156, 2156, 2161, 2162, 2156, 2162, 81,
+    81, 2162, 80, 423, 424, 2163, 423, 2163,
+    2157, 2157, 2163, 2164, 2157, 2164, 2158, 2158,
+    2164, 2165, 2158, 2165, 2159, 2159, 2165, 2166,
+    2159, 2166, 2160, 2160, 2166, 2167, 2160, 2167,
+    2161, 2161, 2167, 2168, 2161, 2168, 2162, 2162,
+    2168, 2169, 2162, 2169, 80, 80, 2169, 79,
+    424, 425, 2170, 424, 2170, 2163, 2163, 2170,
+    2171, 2163, 2171, 2164, 2164, 2171, 2172, 2164,
+    2172, 2165, 2165, 2172, 2173, 2165, 2173, 2166,
+    2166, 2173, 2174, 2166, 2174, 2167, 2167, 2174,
+    2175, 2167, 2175, 2168, 2168, 2175, 2176, 2168,
+    2176, 2169, 2169, 2176, 2177, 2169, 2177, 79,
+    79, 2177, 78, 425, 426, 2178, 425, 2178,
+    2170, 2170, 2178, 2179, 2170, 2179, 2171, 2171,
+    2179, 2180, 2171, 2180, 2172, 2172, 2180, 2181,
+    2172, 2181, 2173, 2173, 2181, 2182, 2173, 2182,
+    2174, 2174, 2182, 2183, 2174, 2183, 2175, 2175,
+    2183, 2184, 2175, 2184, 2176, 2176, 2184, 2185,
+    2176, 2185, 2177, 2177, 2185, 2186, 2177, 2186,
+    78, 78, 2186, 77, 426, 427, 2187, 426,
+    2187, 2178, 2178, 2187, 2188, 2178, 2188, 2179,
+    2179, 2188, 2189, 2179, 2189, 2180, 2180, 2189,
+    2190, 2180, 2190, 2181, 2181, 2190, 2191, 2181,
+    2191, 2182, 2182, 2191, 2192, 2182, 2192, 2183,
+    2183, 2192, 2193, 2183, 2193, 2184, 2184, 2193,
+    2194, 2184, 2194, 2185, 2185, 2194, 2195, 2185,
+    2195, 2186, 2186, 2195, 2196, 2186, 2196, 77,
+    77, 2196, 76, 427, 428, 2197, 427, 2197,
+    2187, 2187, 2197, 2198, 2187, 2198, 2188, 2188,
+    2198, 2199, 2188, 2199, 2189, 2189, 2199, 2200,
+    2189, 2200, 2190, 2190, 2200, 2201, 2190, 2201,
+    2191, 2191, 2201, 2202, 2191, 2202, 2192, 2192,
+    2202, 2203, 2192, 2203, 2193, 2193, 2203, 2204,
+    2193, 2204, 2194, 2194, 2204, 2205, 2194, 2205,
+    2195, 2195, 2205, 2206, 2195, 2206, 2196, 2196,
+    2206, 2207, 2196, 2207, 76, 76, 2207, 75,
+    428, 429, 2208, 428, 2208, 2197, 2197, 2208,
+    2209, 2197, 2209, 2198, 2198, 2209, 2210, 2198,
+    2210, 2199, 2199, 2210, 2211, 2199, 2211, 2200,
+    2200, 2211, 2212, 2200, 2212, 2201, 2201, 2212,
+    2213, 2201, 2213, 2202, 2202, 2213, 2214, 2202,
+    2214, 2203, 2203, 2214, 2215, 2203, 2215, 2204,
+    2204, 2215, 2216, 2204, 2216, 2205, 2205, 2216,
+    2217, 2205, 2217, 2206, 2206, 2217, 2218, 2206,
+    2218, 2207, 2207, 2218, 2219, 2207, 2219, 75,
+    75, 2219, 74, 429, 430, 2220, 429, 2220,
+    2208, 2208, 2220, 2221, 2208, 2221, 2209, 2209,
+    2221, 2222, 2209, 2222, 2210, 2210, 2222, 2223,
+    2210, 2223, 2211, 2211, 2223, 2224, 2211, 2224,
+    2212, 2212, 2224, 2225, 2212, 2225, 2213, 2213,
+    2225, 2226, 2213, 2226, 2214, 2214, 2226, 2227,
+    2214, 2227, 2215, 2215, 2227, 2228, 2215, 2228,
+    2216, 2216, 2228, 2229, 2216, 2229, 2217, 2217,
+    2229, 2230, 2217, 2230, 2218, 2218, 2230, 2231,
+    2218, 2231, 2219, 2219, 2231, 2232, 2219, 2232,
+    74, 74, 2232, 73, 430, 431, 2233, 430,
+    2233, 2220, 2220, 2233, 2234, 2220, 2234, 2221,
+    2221, 2234, 2235, 2221, 2235, 2222, 2222, 2235,
+    2236, 2222, 2236, 2223, 2223, 2236, 2237, 2223,
+    2237, 2224, 2224, 2237, 2238, 2224, 2238, 2225,
+    2225, 2238, 2239, 2225, 2239, 2226, 2226, 2239,
+    2240, 2226, 2240, 2227, 2227, 2240, 2241, 2227,
+    2241, 2228, 2228, 2241, 2242, 2228, 2242, 2229,
+    2229, 2242, 2243, 2229, 2243, 2230, 2230, 2243,
+    2244, 2230, 2244, 2231, 2231, 2244, 2245, 2231,
+    2245, 2232, 2232, 2245, 2246, 2232, 2246, 73,
+    73, 2246, 72, 431, 11, 387, 431, 387,
+    2233, 2233, 387, 388, 2233, 388, 2234, 2234,
+    388, 389, 2234, 389, 2235, 2235, 389, 390,
+    2235, 390, 2236, 2236, 390, 391, 2236, 391,
+    2237, 2237, 391, 392, 2237, 392, 2238, 2238,
+    392, 393, 2238, 393, 2239, 2239, 393, 394,
+    2239, 394, 2240, 2240, 394, 395, 2240, 395,
+    2241, 2241, 395, 396, 2241, 396, 2242, 2242,
+    396, 397, 2242, 397, 2243, 2243, 397, 398,
+    2243, 398, 2244, 2244, 398, 399, 2244, 399,
+    2245, 2245, 399, 400, 2245, 400, 2246, 2246,
+    400, 401, 2246, 401, 72, 72, 401, 0,
+    9, 432, 417, 432, 433, 2247, 432, 2247,
+    417, 417, 2247, 418, 433, 434, 2248, 433,
+    2248, 2247, 2247, 2248, 2249, 2247, 2249, 418,
+    418, 2249, 419, 434, 435, 2250, 434, 2250,
+    2248, 2248, 2250, 2251, 2248, 2251, 2249, 2249,
+    2251, 2252, 2249, 2252, 419, 419, 2252, 420,
+    435, 436, 2253, 435, 2253, 2250, 2250, 2253,
+    2254, 2250, 2254, 2251, 2251, 2254, 2255, 2251,
+    2255, 2252, 2252, 2255, 2256, 2252, 2256, 420,
+    420, 2256, 421, 436, 437, 2257, 436, 2257,
+    2253, 2253, 2257, 2258, 2253, 2258, 2254, 2254,
+    2258, 2259, 2254, 2259, 2255, 2255, 2259, 2260,
+    2255, 2260, 2256, 2256, 2260, 2261, 2256, 2261,
+    421, 421, 2261, 422, 437, 438, 2262, 437,
+    2262, 2257, 2257, 2262, 2263, 2257, 2263, 2258,
+    2258, 2263, 2264, 2258, 2264, 2259, 2259, 2264,
+    2265, 2259, 2265, 2260, 2260, 2265, 2266, 2260,
+    2266, 2261, 2261, 2266, 2267, 2261, 2267, 422,
+    422, 2267, 423, 438, 439, 2268, 438, 2268,
+    2262, 2262, 2268, 2269, 2262, 2269, 2263, 2263,
+    2269, 2270, 2263, 2270, 2264, 2264, 2270, 2271,
+    2264, 2271, 2265, 2265, 2271, 2272, 2265, 2272,
+    2266, 2266, 2272, 2273, 2266, 2273, 2267, 2267,
+    2273, 2274, 2267, 2274, 423, 423, 2274, 424,
+    439, 440, 2275, 439, 2275, 2268, 2268, 2275,
+    2276, 2268, 2276, 2269, 2269, 2276, 2277, 2269,
+    2277, 2270, 2270, 2277, 2278, 2270, 2278, 2271,
+    2271, 2278, 2279, 2271, 2279, 2272, 2272, 2279,
+    2280, 2272, 2280, 2273, 2273, 2280, 2281, 2273,
+    2281, 2274, 2274, 2281, 2282, 2274, 2282, 424,
+    424, 2282, 425, 440, 441, 2283, 440, 2283,
+    2275, 2275, 2283, 2284, 2275, 2284, 2276, 2276,
+    2284, 2285, 2276, 2285, 2277, 2277, 2285, 2286,
+    2277, 2286, 2278, 2278, 2286, 2287, 2278, 2287,
+    2279, 2279, 2287, 2288, 2279, 2288, 2280, 2280,
+    2288, 2289, 2280, 2289, 2281, 2281, 2289, 2290,
+    2281, 2290, 2282, 2282, 2290, 2291, 2282, 2291,
+    425, 425, 2291, 426, 441, 442, 2292, 441,
+    2292, 2283, 2283, 2292, 2293, 2283, 2293, 2284,
+    2284, 2293, 2294, 2284, 2294, 2285, 2285, 2294,
+    2295, 2285, 2295, 2286, 2286, 2295, 2296, 2286,
+    2296, 2287, 2287, 2296, 2297, 2287, 2297, 2288,
+    2288, 2297, 2298, 2288, 2298, 2289, 2289, 2298,
+    2299, 2289, 2299, 2290, 2290, 2299, 2300, 2290,
+    2300, 2291, 2291, 2300, 2301, 2291, 2301, 426,
+    426, 2301, 427, 442, 443, 2302, 442, 2302,
+    2292, 2292, 2302, 2303, 2292, 2303, 2293, 2293,
+    2303, 2304, 2293, 2304, 2294, 2294, 2304, 2305,
+    2294, 2305, 2295, 2295, 2305, 2306, 2295, 2306,
+    2296, 2296, 2306, 2307, 2296, 2307, 2297, 2297,
+    2307, 2308, 2297, 2308, 2298, 2298, 2308, 2309,
+    2298, 2309, 2299, 2299, 2309, 2310, 2299, 2310,
+    2300, 2300, 2310, 2311, 2300, 2311, 2301, 2301,
+    2311, 2312, 2301, 2312, 427, 427, 2312, 428,
+    443, 444, 2313, 443, 2313, 2302, 2302, 2313,
+    2314, 2302, 2314, 2303, 2303, 2314, 2315, 2303,
+    2315, 2304, 2304, 2315, 2316, 2304, 2316, 2305,
+    2305, 2316, 2317, 2305, 2317, 2306, 2306, 2317,
+    2318, 2306, 2318, 2307, 2307, 2318, 2319, 2307,
+    2319, 2308, 2308, 2319, 2320, 2308, 2320, 2309,
+    2309, 2320, 2321, 2309, 2321, 2310, 2310, 2321,
+    2322, 2310, 2322, 2311, 2311, 2322, 2323, 2311,
+    2323, 2312, 2312, 2323, 2324, 2312, 2324, 428,
+    428, 2324, 429, 444, 445, 2325, 444, 2325,
+    2313, 2313, 2325, 2326, 2313, 2326, 2314, 2314,
+    2326, 2327, 2314, 2327, 2315, 2315, 2327, 2328,
+    2315, 2328, 2316, 2316, 2328, 2329, 2316, 2329,
+    2317, 2317, 2329, 2330, 2317, 2330, 2318, 2318,
+    2330, 2331, 2318, 2331, 2319, 2319, 2331, 2332,
+    2319, 2332, 2320, 2320, 2332, 2333, 2320, 2333,
+    2321, 2321, 2333, 2334, 2321, 2334, 2322, 2322,
+    2334, 2335, 2322, 2335, 2323, 2323, 2335, 2336,
+    2323, 2336, 2324, 2324, 2336, 2337, 2324, 2337,
+    429, 429, 2337, 430, 445, 446, 2338, 445,
+    2338, 2325, 2325, 2338, 2339, 2325, 2339, 2326,
+    2326, 2339, 2340, 2326, 2340, 2327, 2327, 2340,
+    2341, 2327, 2341, 2328, 2328, 2341, 2342, 2328,
+    2342, 2329, 2329, 2342, 2343, 2329, 2343, 2330,
+    2330, 2343, 2344, 2330, 2344, 2331, 2331, 2344,
+    2345, 2331, 2345, 2332, 2332, 2345, 2346, 2332,
+    2346, 2333, 2333, 2346, 2347, 2333, 2347, 2334,
+    2334, 2347, 2348, 2334, 2348, 2335, 2335, 2348,
+    2349, 2335, 2349, 2336, 2336, 2349, 2350, 2336,
+    2350, 2337, 2337, 2350, 2351, 2337, 2351, 430,
+    430, 2351, 431, 446, 2, 447, 446, 447,
+    2338, 2338, 447, 448, 2338, 448, 2339, 2339,
+    448, 449, 2339, 449, 2340, 2340, 449, 450,
+    2340, 450, 2341, 2341, 450, 451, 2341, 451,
+    2342, 2342, 451, 452, 2342, 452, 2343, 2343,
+    452, 453, 2343, 453, 2344, 2344, 453, 454,
+    2344, 454, 2345, 2345, 454, 455, 2345, 455,
+    2346, 2346, 455, 456, 2346, 456, 2347, 2347,
+    456, 457, 2347, 457, 2348, 2348, 457, 458,
+    2348, 458, 2349, 2349, 458, 459, 2349, 459,
+    2350, 2350, 459, 460, 2350, 460, 2351, 2351,
+    460, 461, 2351, 461, 431, 431, 461, 11,
+    9, 102, 432, 102, 103, 2352, 102, 2352,
+    432, 432, 2352, 433, 103, 104, 2353, 103,
+    2353, 2352, 2352, 2353, 2354, 2352, 2354, 433,
+    433, 2354, 434, 104, 105, 2355, 104, 2355,
+    2353, 2353, 2355, 2356, 2353, 2356, 2354, 2354,
+    2356, 2357, 2354, 2357, 434, 434, 2357, 435,
+    105, 106, 2358, 105, 2358, 2355, 2355, 2358,
+    2359, 2355, 2359, 2356, 2356, 2359, 2360, 2356,
+    2360, 2357, 2357, 2360, 2361, 2357, 2361, 435,
+    435, 2361, 436, 106, 107, 2362, 106, 2362,
+    2358, 2358, 2362, 2363, 2358, 2363, 2359, 2359,
+    2363, 2364, 2359, 2364, 2360, 2360, 2364, 2365,
+    2360, 2365, 2361, 2361, 2365, 2366, 2361, 2366,
+    436, 436, 2366, 437, 107, 108, 2367, 107,
+    2367, 2362, 2362, 2367, 2368, 2362, 2368, 2363,
+    2363, 2368, 2369, 2363, 2369, 2364, 2364, 2369,
+    2370, 2364, 2370, 2365, 2365, 2370, 2371, 2365,
+    2371, 2366, 2366, 2371, 2372, 2366, 2372, 437,
+    437, 2372, 438, 108, 109, 2373, 108, 2373,
+    2367, 2367, 2373, 2374, 2367, 2374, 2368, 2368,
+    2374, 2375, 2368, 2375, 2369, 2369, 2375, 2376,
+    2369, 2376, 2370, 2370, 2376, 2377, 2370, 2377,
+    2371, 2371, 2377, 2378, 2371, 2378, 2372, 2372,
+    2378, 2379, 2372, 2379, 438, 438, 2379, 439,
+    109, 110, 2380, 109, 2380, 2373, 2373, 2380,
+    2381, 2373, 2381, 2374, 2374, 2381, 2382, 2374,
+    2382, 2375, 2375, 2382, 2383, 2375, 2383, 2376,
+    2376, 2383, 2384, 2376, 2384, 2377, 2377, 2384,
+    2385, 2377, 2385, 2378, 2378, 2385, 2386, 2378,
+    2386, 2379, 2379, 2386, 2387, 2379, 2387, 439,
+    439, 2387, 440, 110, 111, 2388, 110, 2388,
+    2380, 2380, 2388, 2389, 2380, 2389, 2381, 2381,
+    2389, 2390, 2381, 2390, 2382, 2382, 2390, 2391,
+    2382, 2391, 2383, 2383, 2391, 2392, 2383, 2392,
+    2384, 2384, 2392, 2393, 2384, 2393, 2385, 2385,
+    2393, 2394, 2385, 2394, 2386, 2386, 2394, 2395,
+    2386, 2395, 2387, 2387, 2395, 2396, 2387, 2396,
+    440, 440, 2396, 441, 111, 112, 2397, 111,
+    2397, 2388, 2388, 2397, 2398, 2388, 2398, 2389,
+    2389, 2398, 2399, 2389, 2399, 2390, 2390, 2399,
+    2400, 2390, 2400, 2391, 2391, 2400, 2401, 2391,
+    2401, 2392, 2392, 2401, 2402, 2392, 2402, 2393,
+    2393, 2402, 2403, 2393, 2403, 2394, 2394, 2403,
+    2404, 2394, 2404, 2395, 2395, 2404, 2405, 2395,
+    2405, 2396, 2396, 2405, 2406, 2396, 2406, 441,
+    441, 2406, 442, 112, 113, 2407, 112, 2407,
+    2397, 2397, 2407, 2408, 2397, 2408, 2398, 2398,
+    2408, 2409, 2398, 2409, 2399, 2399, 2409, 2410,
+    2399, 2410, 2400, 2400, 2410, 2411, 2400, 2411,
+    2401, 2401, 2411, 2412, 2401, 2412, 2402, 2402,
+    2412, 2413, 2402, 2413, 2403, 2403, 2413, 2414,
+    2403, 2414, 2404, 2404, 2414, 2415, 2404, 2415,
+    2405, 2405, 2415, 2416, 2405, 2416, 2406, 2406,
+    2416, 2417, 2406, 2417, 442, 442, 2417, 443,
+    113, 114, 2418, 113, 2418, 2407, 2407, 2418,
+    2419, 2407, 2419, 2408, 2408, 2419, 2420, 2408,
+    2420, 2409, 2409, 2420, 2421, 2409, 2421, 2410,
+    2410, 2421, 2422, 2410, 2422, 2411, 2411, 2422,
+    2423, 2411, 2423, 2412, 2412, 2423, 2424, 2412,
+    2424, 2413, 2413, 2424, 2425, 2413, 2425, 2414,
+    2414, 2425, 2426, 2414, 2426, 2415, 2415, 2426,
+    2427, 2415, 2427, 2416, 2416, 2427, 2428, 2416,
+    2428, 2417, 2417, 2428, 2429, 2417, 2429, 443,
+    443, 2429, 444, 114, 115, 2430, 114, 2430,
+    2418, 2418, 2430, 2431, 2418, 2431, 2419, 2419,
+    2431, 2432, 2419, 2432, 2420, 2420, 2432, 2433,
+    2420, 2433, 2421, 2421, 2433, 2434, 2421, 2434,
+    2422, 2422, 2434, 2435, 2422, 2435, 2423, 2423,
+    2435, 2436, 2423, 2436, 2424, 2424, 2436, 2437,
+    2424, 2437, 2425, 2425, 2437, 2438, 2425, 2438,
+    2426, 2426, 2438, 2439, 2426, 2439, 2427, 2427,
+    2439, 2440, 2427, 2440, 2428, 2428, 2440, 2441,
+    2428, 2441, 2429, 2429, 2441, 2442, 2429, 2442,
+    444, 444, 2442, 445, 115, 116, 2443, 115,
+    2443, 2430, 2430, 2443, 2444, 2430, 2444, 2431,
+    2431, 2444, 2445, 2431, 2445, 2432, 2432, 2445,
+    2446, 2432, 2446, 2433, 2433, 2446, 2447, 2433,
+    2447, 2434, 2434, 2447, 2448, 2434, 2448, 2435,
+    2435, 2448, 2449, 2435, 2449, 2436, 2436, 2449,
+    2450, 2436, 2450, 2437, 2437, 2450, 2451, 2437,
+    2451, 2438, 2438, 2451, 2452, 2438, 2452, 2439,
+    2439, 2452, 2453, 2439, 2453, 2440, 2440, 2453,
+    2454, 2440, 2454, 2441, 2441, 2454, 2455, 2441,
+    2455, 2442, 2442, 2455, 2456, 2442, 2456, 445,
+    445, 2456, 446, 116, 5, 252, 116, 252,
+    2443, 2443, 252, 253, 2443, 253, 2444, 2444,
+    253, 254, 2444, 254, 2445, 2445, 254, 255,
+    2445, 255, 2446, 2446, 255, 256, 2446, 256,
+    2447, 2447, 256, 257, 2447, 257, 2448, 2448,
+    257, 258, 2448, 258, 2449, 2449, 258, 259,
+    2449, 259, 2450, 2450, 259, 260, 2450, 260,
+    2451, 2451, 260, 261, 2451, 261, 2452, 2452,
+    261, 262, 2452, 262, 2453, 2453, 262, 263,
+    2453, 263, 2454, 2454, 263, 264, 2454, 264,
+    2455, 2455, 264, 265, 2455, 265, 2456, 2456,
+    265, 266, 2456, 266, 446, 446, 266, 2,
+    7, 357, 296, 357, 358, 2457, 357, 2457,
+    296, 296, 2457, 295, 358, 359, 2458, 358,
+    2458, 2457, 2457, 2458, 2459, 2457, 2459, 295,
+    295, 2459, 294, 359, 360, 2460, 359, 2460,
+    2458, 2458, 2460, 2461, 2458, 2461, 2459, 2459,
+    2461, 2462, 2459, 2462, 294, 294, 2462, 293,
+    360, 361, 2463, 360, 2463, 2460, 2460, 2463,
+    2464, 2460, 2464, 2461, 2461, 2464, 2465, 2461,
+    2465, 2462, 2462, 2465, 2466, 2462, 2466, 293,
+    293, 2466, 292, 361, 362, 2467, 361, 2467,
+    2463, 2463, 2467, 2468, 2463, 2468, 2464, 2464,
+    2468, 2469, 2464, 2469, 2465, 2465, 2469, 2470,
+    2465, 2470, 2466, 2466, 2470, 2471, 2466, 2471,
+    292, 292, 2471, 291, 362, 363, 2472, 362,
+    2472, 2467, 2467, 2472, 2473, 2467, 2473, 2468,
+    2468, 2473, 2474, 2468, 2474, 2469, 2469, 2474,
+    2475, 2469, 2475, 2470, 2470, 2475, 2476, 2470,
+    2476, 2471, 2471, 2476, 2477, 2471, 2477, 291,
+    291, 2477, 290, 363, 364, 2478, 363, 2478,
+    2472, 2472, 2478, 2479, 2472, 2479, 2473, 2473,
+    2479, 2480, 2473, 2480, 2474, 2474, 2480, 2481,
+    2474, 2481, 2475, 2475, 2481, 2482, 2475, 2482,
+    2476, 2476, 2482, 2483, 2476, 2483, 2477, 2477,
+    2483, 2484, 2477, 2484, 290, 290, 2484, 289,
+    364, 365, 2485, 364, 2485, 2478, 2478, 2485,
+    2486, 2478, 2486, 2479, 2479, 2486, 2487, 2479,
+    2487, 2480, 2480, 2487, 2488, 2480, 2488, 2481,
+    2481, 2488, 2489, 2481, 2489, 2482, 2482, 2489,
+    2490, 2482, 2490, 2483, 2483, 2490, 2491, 2483,
+    2491, 2484, 2484, 2491, 2492, 2484, 2492, 289,
+    289, 2492, 288, 365, 366, 2493, 365, 2493,
+    2485, 2485, 2493, 2494, 2485, 2494, 2486, 2486,
+    2494, 2495, 2486, 2495, 2487, 2487, 2495, 2496,
+    2487, 2496, 2488, 2488, 2496, 2497, 2488, 2497,
+    2489, 2489, 2497, 2498, 2489, 2498, 2490, 2490,
+    2498, 2499, 2490, 2499, 2491, 2491, 2499, 2500,
+    2491, 2500, 2492, 2492, 2500, 2501, 2492, 2501,
+    288, 288, 2501, 287, 366, 367, 2502, 366,
+    2502, 2493, 2493, 2502, 2503, 2493, 2503, 2494,
+    2494, 2503, 2504, 2494, 2504, 2495, 2495, 2504,
+    2505, 2495, 2505, 2496, 2496, 2505, 2506, 2496,
+    2506, 2497, 2497, 2506, 2507, 2497, 2507, 2498,
+    2498, 2507, 2508, 2498, 2508, 2499, 2499, 2508,
+    2509, 2499, 2509, 2500, 2500, 2509, 2510, 2500,
+    2510, 2501, 2501, 2510, 2511, 2501, 2511, 287,
+    287, 2511, 286, 367, 368, 2512, 367, 2512,
+    2502, 2502, 2512, 2513, 2502, 2513, 2503, 2503,
+    2513, 2514, 2503, 2514, 2504, 2504, 2514, 2515,
+    2504, 2515, 2505, 2505, 2515, 2516, 2505, 2516,
+    2506, 2506, 2516, 2517, 2506, 2517, 2507, 2507,
+    2517, 2518, 2507, 2518, 2508, 2508, 2518, 2519,
+    2508, 2519, 2509, 2509, 2519, 2520, 2509, 2520,
+    2510, 2510, 2520, 2521, 2510, 2521, 2511, 2511,
+    2521, 2522, 2511, 2522, 286, 286, 2522, 285,
+    368, 369, 2523, 368, 2523, 2512, 2512, 2523,
+    2524, 2512, 2524, 2513, 2513, 2524, 2525, 2513,
+    2525, 2514, 2514, 2525, 2526, 2514, 2526, 2515,
+    2515, 2526, 2527, 2515, 2527, 2516, 2516, 2527,
+    2528, 2516, 2528, 2517, 2517, 2528, 2529, 2517,
+    2529, 2518, 2518, 2529, 2530, 2518, 2530, 2519,
+    2519, 2530, 2531, 2519, 2531, 2520, 2520, 2531,
+    2532, 2520, 2532, 2521, 2521, 2532, 2533, 2521,
+    2533, 2522, 2522, 2533, 2534, 2522, 2534, 285,
+    285, 2534, 284, 369, 370, 2535, 369, 2535,
+    2523, 2523, 2535, 2536, 2523, 2536, 2524, 2524,
+    2536, 2537, 2524, 2537, 2525, 2525, 2537, 2538,
+    2525, 2538, 2526, 2526, 2538, 2539, 2526, 2539,
+    2527, 2527, 2539, 2540, 2527, 2540, 2528, 2528,
+    2540, 2541, 2528, 2541, 2529, 2529, 2541, 2542,
+    2529, 2542, 2530, 2530, 2542, 2543, 2530, 2543,
+    2531, 2531, 2543, 2544, 2531, 2544, 2532, 2532,
+    2544, 2545, 2532, 2545, 2533, 2533, 2545, 2546,
+    2533, 2546, 2534, 2534, 2546, 2547, 2534, 2547,
+    284, 284, 2547, 283, 370, 371, 2548, 370,
+    2548, 2535, 2535, 2548, 2549, 2535, 2549, 2536,
+    2536, 2549, 2550, 2536, 2550, 2537, 2537, 2550,
+    2551, 2537, 2551, 2538, 2538, 2551, 2552, 2538,
+    2552, 2539, 2539, 2552, 2553, 2539, 2553, 2540,
+    2540, 2553, 2554, 2540, 2554, 2541, 2541, 2554,
+    2555, 2541, 2555, 2542, 2542, 2555, 2556, 2542,
+    2556, 2543, 2543, 2556, 2557, 2543, 2557, 2544,
+    2544, 2557, 2558, 2544, 2558, 2545, 2545, 2558,
+    2559, 2545, 2559, 2546, 2546, 2559, 2560, 2546,
+    2560, 2547, 2547, 2560, 2561, 2547, 2561, 283,
+    283, 2561, 282, 371, 11, 461, 371, 461,
+    2548, 2548, 461, 460, 2548, 460, 2549, 2549,
+    460, 459, 2549, 459, 2550, 2550, 459, 458,
+    2550, 458, 2551, 2551, 458, 457, 2551, 457,
+    2552, 2552, 457, 456, 2552, 456, 2553, 2553,
+    456, 455, 2553, 455, 2554, 2554, 455, 454,
+    2554, 454, 2555, 2555, 454, 453, 2555, 453,
+    2556, 2556, 453, 452, 2556, 452, 2557, 2557,
+    452, 451, 2557, 451, 2558, 2558, 451, 450,
+    2558, 450, 2559, 2559, 450, 449, 2559, 449,
+    2560, 2560, 449, 448, 2560, 448, 2561, 2561,
+    448, 447, 2561, 447, 282, 282, 447, 2
+};
+const uint16_t STATIC_ICOSPHERE_4_INDICES[] =
+{
+    0, 12, 42, 12, 13, 462, 12, 462,
+    42, 42, 462, 43, 13, 14, 463, 13,
+    463, 462, 462, 463, 464, 462, 464, 43,
+    43, 464, 44, 14, 15, 465, 14, 465,
+    463, 463, 465, 466, 463, 466, 464, 464,
+    466, 467, 464, 467, 44, 44, 467, 45,
+    15, 16, 468, 15, 468, 465, 465, 468,
+    469, 465, 469, 466, 466, 469, 470, 466,
+    470, 467, 467, 470, 471, 467, 471, 45,
+    45, 471, 46, 16, 17, 472, 16, 472,
+    468, 468, 472, 473, 468, 473, 469, 469,
+    473, 474, 469, 474, 470, 470, 474, 475,
+    470, 475, 471, 471, 475, 476, 471, 476,
+    46, 46, 476, 47, 17, 18, 477, 17,
+    477, 472, 472, 477, 478, 472, 478, 473,
+    473, 478, 479, 473, 479, 474, 474, 479,
+    480, 474, 480, 475, 475, 480, 481, 475,
+    481, 476, 476, 481, 482, 476, 482, 47,
+    47, 482, 48, 18, 19, 483, 18, 483,
+    477, 477, 483, 484, 477, 484, 478, 478,
+    484, 485, 478, 485, 479, 479, 485, 486,
+    479, 486, 480, 480, 486, 487, 480, 487,
+    481, 481, 487, 488, 481, 488, 482, 482,
+    488, 489, 482, 489, 48, 48, 489, 49,
+    19, 20, 490, 19, 490, 483, 483, 490,
+    491, 483, 491, 484, 484, 491, 492, 484,
+    492, 485, 485, 492, 493, 485, 493, 486,
+    486, 493, 494, 486, 494, 487, 487, 494,
+    495, 487, 495, 488, 488, 495, 496, 488,
+    496, 489, 489, 496, 497, 489, 497, 49,
+    49, 497, 50, 20, 21, 498, 20, 498,
+    490, 490, 498, 499, 490, 499, 491, 491,
+    499, 500, 491, 500, 492, 492, 500, 501,
+    492, 501, 493, 493, 501, 502, 493, 502,
+    494, 494, 502, 503, 494, 503, 495, 495,
+    503, 504, 495, 504, 496, 496, 504, 505,
+    496, 505, 497, 497, 505, 506, 497, 506,
+    50, 50, 506, 51, 21, 22, 507, 21,
+    507, 498, 498, 507, 508, 498, 508, 499,
+    499, 508, 509, 499, 509, 500, 500, 509,
+    510, 500, 510, 501, 501, 510, 511, 501,
+    511, 502, 502, 511, 512, 502, 512, 503,
+    503, 512, 513, 503, 513, 504, 504, 513,
+    514, 504, 514, 505, 505, 514, 515, 505,
+    515, 506, 506, 515, 516, 506, 516, 51,
+    51, 516, 52, 22, 23, 517, 22, 517,
+    507, 507, 517, 518, 507, 518, 508, 508,
+    518, 519, 508, 519, 509, 509, 519, 520,
+    509, 520, 510, 510, 520, 521, 510, 521,
+    511, 511, 521, 522, 511, 522, 512, 512,
+    522, 523, 512, 523, 513, 513, 523, 524,
+    513, 524, 514, 514, 524, 525, 514, 525,
+    515, 515, 525, 526, 515, 526, 516, 516,
+    526, 527, 516, 527, 52, 52, 527, 53,
+    23, 24, 528, 23, 528, 517, 517, 528,
+    529, 517, 529, 518, 518, 529, 530, 518,
+    530, 519, 519, 530, 531, 519, 531, 520,
+    520, 531, 532, 520, 532, 521, 521, 532,
+    533, 521, 533, 522, 522, 533, 534, 522,
+    534, 523, 523, 534, 535, 523, 535, 524,
+    524, 535, 536, 524, 536, 525, 525, 536,
+    537, 525, 537, 526, 526, 537, 538, 526,
+    538, 527, 527, 538, 539, 527, 539, 53,
+    53, 539, 54, 24, 25, 540, 24, 540,
+    528, 528, 540, 541, 528, 541, 529, 529,
+    541, 542, 529, 542, 530, 530, 542, 543,
+    530, 543, 531, 531, 543, 544, 531, 544,
+    532, 532, 544, 545, 532, 545, 533, 533,
+    545, 546, 533, 546, 534, 534, 546, 547,
+    534, 547, 535, 535, 547, 548, 535, 548,
+    536, 536, 548, 549, 536, 549, 537, 537,
+    549, 550, 537, 550, 538, 538, 550, 551,
+    538, 551, 539, 539, 551, 552, 539, 552,
+    54, 54, 552, 55, 25, 26, 553, 25,
+    553, 540, 540, 553, 554, 540, 554, 541,
+    541, 554, 555, 541, 555, 542, 542, 555,
+    556, 542, 556, 543, 543, 556, 557, 543,
+    557, 544, 544, 557, 558, 544, 558, 545,
+    545, 558, 559, 545, 559, 546, 546, 559,
+    560, 546, 560, 547, 547, 560, 561, 547,
+    561, 548, 548, 561, 562, 548, 562, 549,
+    549, 562, 563, 549, 563, 550, 550, 563,
+    564, 550, 564, 551, 551, 564, 565, 551,
+    565, 552, 552, 565, 566, 552, 566, 55,
+    55, 566, 56, 26, 1, 27, 26, 27,
+    553, 553, 27, 28, 553, 28, 554, 554,
+    28, 29, 554, 29, 555, 555, 29, 30,
+    555, 30, 556, 556, 30, 31, 556, 31,
+    557, 557, 31, 32, 557, 32, 558, 558,
+    32, 33, 558, 33, 559, 559, 33, 34,
+    559, 34, 560, 560, 34, 35, 560, 35,
+    561, 561, 35, 36, 561, 36, 562, 562,
+    36, 37, 562, 37, 563, 563, 37, 38,
+    563, 38, 564, 564, 38, 39, 564, 39,
+    565, 565, 39, 40, 565, 40, 566, 566,
+    40, 41, 566, 41, 56, 56, 41, 4,
+    0, 42, 72, 42, 43, 567, 42, 567,
+    72, 72, 567, 73, 43, 44, 568, 43,
+    568, 567, 567, 568, 569, 567, 569, 73,
+    73, 569, 74, 44, 45, 570, 44, 570,
+    568, 568, 570, 571, 568, 571, 569, 569,
+    571, 572, 569, 572, 74, 74, 572, 75,
+    45, 46, 573, 45, 573, 570, 570, 573,
+    574, 570, 574, 571, 571, 574, 575, 571,
+    575, 572, 572, 575, 576, 572, 576, 75,
+    75, 576, 76, 46, 47, 577, 46, 577,
+    573, 573, 577, 578, 573, 578, 574, 574,
+    578, 579, 574, 579, 575, 575, 579, 580,
+    575, 580, 576, 576, 580, 581, 576, 581,
+    76, 76, 581, 77, 47, 48, 582, 47,
+    582, 577, 577, 582, 583, 577, 583, 578,
+    578, 583, 584, 578, 584, 579, 579, 584,
+    585, 579, 585, 580, 580, 585, 586, 580,
+    586, 581, 581, 586, 587, 581, 587, 77,
+    77, 587, 78, 48, 49, 588, 48, 588,
+    582, 582, 588, 589, 582, 589, 583, 583,
+    589, 590, 583, 590, 584, 584, 590, 591,
+    584, 591, 585, 585, 591, 592, 585, 592,
+    586, 586, 592, 593, 586, 593, 587, 587,
+    593, 594, 587, 594, 78, 78, 594, 79,
+    49, 50, 595, 49, 595, 588, 588, 595,
+    596, 588, 596, 589, 589, 596, 597, 589,
+    597, 590, 590, 597, 598, 590, 598, 591,
+    591, 598, 599, 591, 599, 592, 592, 599,
+    600, 592, 600, 593, 593, 600, 601, 593,
+    601, 594, 594, 601, 602, 594, 602, 79,
+    79, 602, 80, 50, 51, 603, 50, 603,
+    595, 595, 603, 604, 595, 604, 596, 596,
+    604, 605, 596, 605, 597, 597, 605, 606,
+    597, 606, 598, 598, 606, 607, 598, 607,
+    599, 599, 607, 608, 599, 608, 600, 600,
+    608, 609, 600, 609, 601, 601, 609, 610,
+    601, 610, 602, 602, 610, 611, 602, 611,
+    80, 80, 611, 81, 51, 52, 612, 51,
+    612, 603, 603, 612, 613, 603, 613, 604,
+    604, 613, 614, 604, 614, 605, 605, 614,
+    615, 605, 615, 606, 606, 615, 616, 606,
+    616, 607, 607, 616, 617, 607, 617, 608,
+    608, 617, 618, 608, 618, 609, 609, 618,
+    619, 609, 619, 610, 610, 619, 620, 610,
+    620, 611, 611, 620, 621, 611, 621, 81,
+    81, 621, 82, 52, 53, 622, 52, 622,
+    612, 612, 622, 623, 612, 623, 613, 613,
+    623, 624, 613, 624, 614, 614, 624, 625,
+    614, 625, 615, 615, 625, 626, 615, 626,
+    616, 616, 626, 627, 616, 627, 617, 617,
+    627, 628, 617, 628, 618, 618, 628, 629,
+    618, 629, 619, 619, 629, 630, 619, 630,
+    620, 620, 630, 631, 620, 631, 621, 621,
+    631, 632, 621, 632, 82, 82, 632, 83,
+    53, 54, 633, 53, 633, 622, 622, 633,
+    634, 622, 634, 623, 623, 634, 635, 623,
+    635, 624, 624, 635, 636, 624, 636, 625,
+    625, 636, 637, 625, 637, 626, 626, 637,
+    638, 626, 638, 627, 627, 638, 639, 627,
+    639, 628, 628, 639, 640, 628, 640, 629,
+    629, 640, 641, 629, 641, 630, 630, 641,
+    642, 630, 642, 631, 631, 642, 643, 631,
+    643, 632, 632, 643, 644, 632, 644, 83,
+    83, 644, 84, 54, 55, 645, 54, 645,
+    633, 633, 645, 646, 633, 646, 634, 634,
+    646, 647, 634, 647, 635, 635, 647, 648,
+    635, 648, 636, 636, 648, 649, 636, 649,
+    637, 637, 649, 650, 637, 650, 638, 638,
+    650, 651, 638, 651, 639, 639, 651, 652,
+    639, 652, 640, 640, 652, 653, 640, 653,
+    641, 641, 653, 654, 641, 654, 642, 642,
+    654, 655, 642, 655, 643, 643, 655, 656,
+    643, 656, 644, 644, 656, 657, 644, 657,
+    84, 84, 657, 85, 55, 56, 658, 55,
+    658, 645, 645, 658, 659, 645, 659, 646,
+    646, 659, 660, 646, 660, 647, 647, 660,
+    661, 647, 661, 648, 648, 661, 662, 648,
+    662, 649, 649, 662, 663, 649, 663, 650,
+    650, 663, 664, 650, 664, 651, 651, 664,
+    665, 651, 665, 652, 652, 665, 666, 652,
+    666, 653, 653, 666, 667, 653, 667, 654,
+    654, 667, 668, 654, 668, 655, 655, 668,
+    669, 655, 669, 656, 656, 669, 670, 656,
+    670, 657, 657, 670, 671, 657, 671, 85,
+    85, 671, 86, 56, 4, 57, 56, 57,
+    658, 658, 57, 58, 658, 58, 659, 659,
+    58, 59, 659, 59, 660, 660, 59, 60,
+    660, 60, 661, 661, 60, 61, 661, 61,
+    662, 662, 61, 62, 662, 62, 663, 663,
+    62, 63, 663, 63, 664, 664, 63, 64,
+    664, 64, 665, 665, 64, 65, 665, 65,
+    666, 666, 65, 66, 666, 66, 667, 667,
+    66, 67, 667, 67, 668, 668, 67, 68,
+    668, 68, 669, 669, 68, 69, 669, 69,
+    670, 670, 69, 70, 670, 70, 671, 671,
+    70, 71, 671, 71, 86, 86, 71, 9,
+    9, 71, 2562, 71, 70, 672, 71, 672,
+    2562, 2562, 672, 2563, 70, 69, 673, 70,
+    673, 672, 672, 673, 2564, 672, 2564, 2563,
+    103, 674, 104, 69, 68, 675, 69, 675,
+    673, 673, 675, 676, 673, 676, 2564, 2564,
+    676, 2565, 674, 677, 104, 104, 677, 105,
+    68, 67, 678, 68, 678, 675, 675, 678,
+    679, 675, 679, 676, 676, 679, 2566, 676,
+    2566, 2565, 677, 680, 681, 677, 681, 105,
+    105, 681, 106, 67, 66, 682, 67, 682,
+    678, 678, 682, 683, 678, 683, 679, 679,
+    683, 684, 679, 684, 2566, 2566, 684, 2567,
+    680, 685, 681, 681, 685, 686, 681, 686,
+    106, 106, 686, 107, 66, 65, 687, 66,
+    687, 682, 682, 687, 688, 682, 688, 683,
+    683, 688, 689, 683, 689, 684, 684, 689,
+    2568, 684, 2568, 2567, 685, 690, 691, 685,
+    691, 686, 686, 691, 692, 686, 692, 107,
+    107, 692, 108, 65, 64, 693, 65, 693,
+    687, 687, 693, 694, 687, 694, 688, 688,
+    694, 695, 688, 695, 689, 689, 695, 696,
+    689, 696, 2568, 2568, 696, 2569, 690, 697,
+    691, 691, 697, 698, 691, 698, 692, 692,
+    698, 699, 692, 699, 108, 108, 699, 109,
+    64, 63, 700, 64, 700, 693, 693, 700,
+    701, 693, 701, 694, 694, 701, 702, 694,
+    702, 695, 695, 702, 703, 695, 703, 696,
+    696, 703, 2570, 696, 2570, 2569, 697, 704,
+    705, 697, 705, 698, 698, 705, 706, 698,
+    706, 699, 699, 706, 707, 699, 707, 109,
+    109, 707, 110, 63, 62, 708, 63, 708,
+    700, 700, 708, 709, 700, 709, 701, 701,
+    709, 710, 701, 710, 702, 702, 710, 711,
+    702, 711, 703, 703, 711, 712, 703, 712,
+    2570, 2570, 712, 2571, 704, 713, 705, 705,
+    713, 714, 705, 714, 706, 706, 714, 715,
+    706, 715, 707, 707, 715, 716, 707, 716,
+    110, 110, 716, 111, 62, 61, 717, 62,
+    717, 708, 708, 717, 718, 708, 718, 709,
+    709, 718, 719, 709, 719, 710, 710, 719,
+    720, 710, 720, 711, 711, 720, 721, 711,
+    721, 712, 712, 721, 2572, 712, 2572, 2571,
+    713, 722, 723, 713, 723, 714, 714, 723,
+    724, 714, 724, 715, 715, 724, 725, 715,
+    725, 716, 716, 725, 726, 716, 726, 111,
+    111, 726, 112, 61, 60, 727, 61, 727,
+    717, 717, 727, 728, 717, 728, 718, 718,
+    728, 729, 718, 729, 719, 719, 729, 730,
+    719, 730, 720, 720, 730, 731, 720, 731,
+    721, 721, 731, 732, 721, 732, 2572, 2572,
+    732, 2573, 722, 733, 723, 723, 733, 734,
+    723, 734, 724, 724, 734, 735, 724, 735,
+    725, 725, 735, 736, 725, 736, 726, 726,
+    736, 737, 726, 737, 112, 112, 737, 113,
+    60, 59, 738, 60, 738, 727, 727, 738,
+    739, 727, 739, 728, 728, 739, 740, 728,
+    740, 729, 729, 740, 741, 729, 741, 730,
+    730, 741, 742, 730, 742, 731, 731, 742,
+    743, 731, 743, 732, 732, 743, 2574, 732,
+    2574, 2573, 733, 744, 745, 733, 745, 734,
+    734, 745, 746, 734, 746, 735, 735, 746,
+    747, 735, 747, 736, 736, 747, 748, 736,
+    748, 737, 737, 748, 749, 737, 749, 113,
+    113, 749, 114, 59, 58, 750, 59, 750,
+    738, 738, 750, 751, 738, 751, 739, 739,
+    751, 752, 739, 752, 740, 740, 752, 753,
+    740, 753, 741, 741, 753, 754, 741, 754,
+    742, 742, 754, 755, 742, 755, 743, 743,
+    755, 756, 743, 756, 2574, 2574, 756, 2575,
+    744, 757, 745, 745, 757, 758, 745, 758,
+    746, 746, 758, 759, 746, 759, 747, 747,
+    759, 760, 747, 760, 748, 748, 760, 761,
+    748, 761, 749, 749, 761, 762, 749, 762,
+    114, 114, 762, 115, 58, 57, 763, 58,
+    763, 750, 750, 763, 764, 750, 764, 751,
+    751, 764, 765, 751, 765, 752, 752, 765,
+    766, 752, 766, 753, 753, 766, 767, 753,
+    767, 754, 754, 767, 768, 754, 768, 755,
+    755, 768, 769, 755, 769, 756, 756, 769,
+    2576, 756, 2576, 2575, 757, 770, 771, 757,
+    771, 758, 758, 771, 772, 758, 772, 759,
+    759, 772, 773, 759, 773, 760, 760, 773,
+    774, 760, 774, 761, 761, 774, 775, 761,
+    775, 762, 762, 775, 776, 762, 776, 115,
+    115, 776, 116, 57, 4, 87, 57, 87,
+    763, 763, 87, 88, 763, 88, 764, 764,
+    88, 89, 764, 89, 765, 765, 89, 90,
+    765, 90, 766, 766, 90, 91, 766, 91,
+    767, 767, 91, 92, 767, 92, 768, 768,
+    92, 93, 768, 93, 769, 769, 93, 2608,
+    769, 2609, 2576, 770, 2610, 95, 770, 95,
+    771, 771, 95, 96, 771, 96, 772, 772,
+    96, 97, 772, 97, 773, 773, 97, 98,
+    773, 98, 774, 774, 98, 99, 774, 99,
+    775, 775, 99, 100, 775, 100, 776, 776,
+    100, 101, 776, 101, 116, 116, 101, 5,
+    4, 117, 87, 117, 118, 777, 117, 777,
+    87, 87, 777, 88, 118, 119, 778, 118,
+    778, 777, 777, 778, 779, 777, 779, 88,
+    88, 779, 89, 119, 120, 780, 119, 780,
+    778, 778, 780, 781, 778, 781, 779, 779,
+    781, 782, 779, 782, 89, 89, 782, 90,
+    120, 121, 783, 120, 783, 780, 780, 783,
+    784, 780, 784, 781, 781, 784, 785, 781,
+    785, 782, 782, 785, 786, 782, 786, 90,
+    90, 786, 91, 121, 122, 787, 121, 787,
+    783, 783, 787, 788, 783, 788, 784, 784,
+    788, 789, 784, 789, 785, 785, 789, 790,
+    785, 790, 786, 786, 790, 791, 786, 791,
+    91, 91, 791, 92, 122, 123, 792, 122,
+    792, 787, 787, 792, 793, 787, 793, 788,
+    788, 793, 794, 788, 794, 789, 789, 794,
+    795, 789, 795, 790, 790, 795, 796, 790,
+    796, 791, 791, 796, 797, 791, 797, 92,
+    92, 797, 93, 123, 124, 798, 123, 798,
+    792, 792, 798, 799, 792, 799, 793, 793,
+    799, 800, 793, 800, 794, 794, 800, 801,
+    794, 801, 795, 795, 801, 802, 795, 802,
+    796, 796, 802, 803, 796, 803, 797, 797,
+    803, 804, 797, 804, 93, 93, 804, 2611,
+    124, 125, 805, 124, 805, 798, 798, 805,
+    806, 798, 806, 799, 799, 806, 807, 799,
+    807, 800, 800, 807, 808, 800, 808, 801,
+    801, 808, 809, 801, 809, 802, 802, 809,
+    810, 802, 810, 803, 803, 810, 811, 803,
+    811, 804, 804, 811, 812, 804, 812, 2612,
+    2613, 812, 95, 125, 126, 813, 125, 813,
+    805, 805, 813, 814, 805, 814, 806, 806,
+    814, 815, 806, 815, 807, 807, 815, 816,
+    807, 816, 808, 808, 816, 817, 808, 817,
+    809, 809, 817, 818, 809, 818, 810, 810,
+    818, 819, 810, 819, 811, 811, 819, 820,
+    811, 820, 812, 812, 820, 821, 812, 821,
+    95, 95, 821, 96, 126, 127, 822, 126,
+    822, 813, 813, 822, 823, 813, 823, 814,
+    814, 823, 824, 814, 824, 815, 815, 824,
+    825, 815, 825, 816, 816, 825, 826, 816,
+    826, 817, 817, 826, 827, 817, 827, 818,
+    818, 827, 828, 818, 828, 819, 819, 828,
+    829, 819, 829, 820, 820, 829, 830, 820,
+    830, 821, 821, 830, 831, 821, 831, 96,
+    96, 831, 97, 127, 128, 832, 127, 832,
+    822, 822, 832, 833, 822, 833, 823, 823,
+    833, 834, 823, 834, 824, 824, 834, 835,
+    824, 835, 825, 825, 835, 836, 825, 836,
+    826, 826, 836, 837, 826, 837, 827, 827,
+    837, 838, 827, 838, 828, 828, 838, 839,
+    828, 839, 829, 829, 839, 840, 829, 840,
+    830, 830, 840, 841, 830, 841, 831, 831,
+    841, 842, 831, 842, 97, 97, 842, 98,
+    128, 129, 843, 128, 843, 832, 832, 843,
+    844, 832, 844, 833, 833, 844, 845, 833,
+    845, 834, 834, 845, 846, 834, 846, 835,
+    835, 846, 847, 835, 847, 836, 836, 847,
+    848, 836, 848, 837, 837, 848, 849, 837,
+    849, 838, 838, 849, 850, 838, 850, 839,
+    839, 850, 851, 839, 851, 840, 840, 851,
+    852, 840, 852, 841, 841, 852, 853, 841,
+    853, 842, 842, 853, 854, 842, 854, 98,
+    98, 854, 99, 129, 130, 855, 129, 855,
+    843, 843, 855, 856, 843, 856, 844, 844,
+    856, 857, 844, 857, 845, 845, 857, 858,
+    845, 858, 846, 846, 858, 859, 846, 859,
+    847, 847, 859, 860, 847, 860, 848, 848,
+    860, 861, 848, 861, 849, 849, 861, 862,
+    849, 862, 850, 850, 862, 863, 850, 863,
+    851, 851, 863, 864, 851, 864, 852, 852,
+    864, 865, 852, 865, 853, 853, 865, 866,
+    853, 866, 854, 854, 866, 867, 854, 867,
+    99, 99, 867, 100, 130, 131, 868, 130,
+    868, 855, 855, 868, 869, 855, 869, 856,
+    856, 869, 870, 856, 870, 857, 857, 870,
+    871, 857, 871, 858, 858, 871, 872, 858,
+    872, 859, 859, 872, 873, 859, 873, 860,
+    860, 873, 874, 860, 874, 861, 861, 874,
+    875, 861, 875, 862, 862, 875, 876, 862,
+    876, 863, 863, 876, 877, 863, 877, 864,
+    864, 877, 878, 864, 878, 865, 865, 878,
+    879, 865, 879, 866, 866, 879, 880, 866,
+    880, 867, 867, 880, 881, 867, 881, 100,
+    100, 881, 101, 131, 8, 132, 131, 132,
+    868, 868, 132, 133, 868, 133, 869, 869,
+    133, 134, 869, 134, 870, 870, 134, 135,
+    870, 135, 871, 871, 135, 136, 871, 136,
+    872, 872, 136, 137, 872, 137, 873, 873,
+    137, 138, 873, 138, 874, 874, 138, 139,
+    874, 139, 875, 875, 139, 140, 875, 140,
+    876, 876, 140, 141, 876, 141, 877, 877,
+    141, 142, 877, 142, 878, 878, 142, 143,
+    878, 143, 879, 879, 143, 144, 879, 144,
+    880, 880, 144, 145, 880, 145, 881, 881,
+    145, 146, 881, 146, 101, 101, 146, 5,
+    4, 41, 117, 41, 40, 882, 41, 882,
+    117, 117, 882, 118, 40, 39, 883, 40,
+    883, 882, 882, 883, 884, 882, 884, 118,
+    118, 884, 119, 39, 38, 885, 39, 885,
+    883, 883, 885, 886, 883, 886, 884, 884,
+    886, 887, 884, 887, 119, 119, 887, 120,
+    38, 37, 888, 38, 888, 885, 885, 888,
+    889, 885, 889, 886, 886, 889, 890, 886,
+    890, 887, 887, 890, 891, 887, 891, 120,
+    120, 891, 121, 37, 36, 892, 37, 892,
+    888, 888, 892, 893, 888, 893, 889, 889,
+    893, 894, 889, 894, 890, 890, 894, 895,
+    890, 895, 891, 891, 895, 896, 891, 896,
+    121, 121, 896, 122, 36, 35, 897, 36,
+    897, 892, 892, 897, 898, 892, 898, 893,
+    893, 898, 899, 893, 899, 894, 894, 899,
+    900, 894, 900, 895, 895, 900, 901, 895,
+    901, 896, 896, 901, 902, 896, 902, 122,
+    122, 902, 123, 35, 34, 903, 35, 903,
+    897, 897, 903, 904, 897, 904, 898, 898,
+    904, 905, 898, 905, 899, 899, 905, 906,
+    899, 906, 900, 900, 906, 907, 900, 907,
+    901, 901, 907, 908, 901, 908, 902, 902,
+    908, 909, 902, 909, 123, 123, 909, 124,
+    34, 33, 910, 34, 910, 903, 903, 910,
+    911, 903, 911, 904, 904, 911, 912, 904,
+    912, 905, 905, 912, 913, 905, 913, 906,
+    906, 913, 914, 906, 914, 907, 907, 914,
+    915, 907, 915, 908, 908, 915, 916, 908,
+    916, 909, 909, 916, 917, 909, 917, 124,
+    124, 917, 125, 33, 32, 918, 33, 918,
+    910, 910, 918, 919, 910, 919, 911, 911,
+    919, 920, 911, 920, 912, 912, 920, 921,
+    912, 921, 913, 913, 921, 922, 913, 922,
+    914, 914, 922, 923, 914, 923, 915, 915,
+    923, 924, 915, 924, 916, 916, 924, 925,
+    916, 925, 917, 917, 925, 926, 917, 926,
+    125, 125, 926, 126, 32, 31, 927, 32,
+    927, 918, 918, 927, 928, 918, 928, 919,
+    919, 928, 929, 919, 929, 920, 920, 929,
+    930, 920, 930, 921, 921, 930, 931, 921,
+    931, 922, 922, 931, 932, 922, 932, 923,
+    923, 932, 933, 923, 933, 924, 924, 933,
+    934, 924, 934, 925, 925, 934, 935, 925,
+    935, 926, 926, 935, 936, 926, 936, 126,
+    126, 936, 127, 31, 30, 937, 31, 937,
+    927, 927, 937, 938, 927, 938, 928, 928,
+    938, 939, 928, 939, 929, 929, 939, 940,
+    929, 940, 930, 930, 940, 941, 930, 941,
+    931, 931, 941, 942, 931, 942, 932, 932,
+    942, 943, 932, 943, 933, 933, 943, 944,
+    933, 944, 934, 934, 944, 945, 934, 945,
+    935, 935, 945, 946, 935, 946, 936, 936,
+    946, 947, 936, 947, 127, 127, 947, 128,
+    30, 29, 948, 30, 948, 937, 937, 948,
+    949, 937, 949, 938, 938, 949, 950, 938,
+    950, 939, 939, 950, 951, 939, 951, 940,
+    940, 951, 952, 940, 952, 941, 941, 952,
+    953, 941, 953, 942, 942, 953, 954, 942,
+    954, 943, 943, 954, 955, 943, 955, 944,
+    944, 955, 956, 944, 956, 945, 945, 956,
+    957, 945, 957, 946, 946, 957, 958, 946,
+    958, 947, 947, 958, 959, 947, 959, 128,
+    128, 959, 129, 29, 28, 960, 29, 960,
+    948, 948, 960, 961, 948, 961, 949, 949,
+    961, 962, 949, 962, 950, 950, 962, 963,
+    950, 963, 951, 951, 963, 964, 951, 964,
+    952, 952, 964, 965, 952, 965, 953, 953,
+    965, 966, 953, 966, 954, 954, 966, 967,
+    954, 967, 955, 955, 967, 968, 955, 968,
+    956, 956, 968, 969, 956, 969, 957, 957,
+    969, 970, 957, 970, 958, 958, 970, 971,
+    958, 971, 959, 959, 971, 972, 959, 972,
+    129, 129, 972, 130, 28, 27, 973, 28,
+    973, 960, 960, 973, 974, 960, 974, 961,
+    961, 974, 975, 961, 975, 962, 962, 975,
+    976, 962, 976, 963, 963, 976, 977, 963,
+    977, 964, 964, 977, 978, 964, 978, 965,
+    965, 978, 979, 965, 979, 966, 966, 979,
+    980, 966, 980, 967, 967, 980, 981, 967,
+    981, 968, 968, 981, 982, 968, 982, 969,
+    969, 982, 983, 969, 983, 970, 970, 983,
+    984, 970, 984, 971, 971, 984, 985, 971,
+    985, 972, 972, 985, 986, 972, 986, 130,
+    130, 986, 131, 27, 1, 147, 27, 147,
+    973, 973, 147, 148, 973, 148, 974, 974,
+    148, 149, 974, 149, 975, 975, 149, 150,
+    975, 150, 976, 976, 150, 151, 976, 151,
+    977, 977, 151, 152, 977, 152, 978, 978,
+    152, 153, 978, 153, 979, 979, 153, 154,
+    979, 154, 980, 980, 154, 155, 980, 155,
+    981, 981, 155, 156, 981, 156, 982, 982,
+    156, 157, 982, 157, 983, 983, 157, 158,
+    983, 158, 984, 984, 158, 159, 984, 159,
+    985, 985, 159, 160, 985, 160, 986, 986,
+    160, 161, 986, 161, 131, 131, 161, 8,
+    8, 161, 177, 161, 160, 987, 161, 987,
+    177, 177, 987, 178, 160, 159, 988, 160,
+    988, 987, 987, 988, 989, 987, 989, 178,
+    178, 989, 179, 159, 158, 990, 159, 990,
+    988, 988, 990, 991, 988, 991, 989, 989,
+    991, 992, 989, 992, 179, 179, 992, 180,
+    158, 157, 993, 158, 993, 990, 990, 993,
+    994, 990, 994, 991, 991, 994, 995, 991,
+    995, 992, 992, 995, 996, 992, 996, 180,
+    180, 996, 181, 157, 156, 997, 157, 997,
+    993, 993, 997, 998, 993, 998, 994, 994,
+    998, 999, 994, 999, 995, 995, 999, 1000,
+    995, 1000, 996, 996, 1000, 1001, 996, 1001,
+    181, 181, 1001, 182, 156, 155, 1002, 156,
+    1002, 997, 997, 1002, 1003, 997, 1003, 998,
+    998, 1003, 1004, 998, 1004, 999, 999, 1004,
+    1005, 999, 1005, 1000, 1000, 1005, 1006, 1000,
+    1006, 1001, 1001, 1006, 1007, 1001, 1007, 182,
+    182, 1007, 183, 155, 154, 1008, 155, 1008,
+    1002, 1002, 1008, 1009, 1002, 1009, 1003, 1003,
+    1009, 1010, 1003, 1010, 1004, 1004, 1010, 1011,
+    1004, 1011, 1005, 1005, 1011, 1012, 1005, 1012,
+    1006, 1006, 1012, 1013, 1006, 1013, 1007, 1007,
+    1013, 1014, 1007, 1014, 183, 183, 1014, 184,
+    154, 153, 1015, 154, 1015, 1008, 1008, 1015,
+    1016, 1008, 1016, 1009, 1009, 1016, 1017, 1009,
+    1017, 1010, 1010, 1017, 1018, 1010, 1018, 1011,
+    1011, 1018, 1019, 1011, 1019, 1012, 1012, 1019,
+    1020, 1012, 1020, 1013, 1013, 1020, 1021, 1013,
+    1021, 1014, 1014, 1021, 1022, 1014, 1022, 184,
+    184, 1022, 185, 153, 152, 1023, 153, 1023,
+    1015, 1015, 1023, 1024, 1015, 1024, 1016, 1016,
+    1024, 1025, 1016, 1025, 1017, 1017, 1025, 1026,
+    1017, 1026, 1018, 1018, 1026, 1027, 1018, 1027,
+    1019, 1019, 1027, 1028, 1019, 1028, 1020, 1020,
+    1028, 1029, 1020, 1029, 1021, 1021, 1029, 1030,
+    1021, 1030, 1022, 1022, 1030, 1031, 1022, 1031,
+    185, 185, 1031, 186, 152, 151, 1032, 152,
+    1032, 1023, 1023, 1032, 1033, 1023, 1033, 1024,
+    1024, 1033, 1034, 1024, 1034, 1025, 1025, 1034,
+    1035, 1025, 1035, 1026, 1026, 1035, 1036, 1026,
+    1036, 1027, 1027, 1036, 1037, 1027, 1037, 1028,
+    1028, 1037, 1038, 1028, 1038, 1029, 1029, 1038,
+    1039, 1029, 1039, 1030, 1030, 1039, 1040, 1030,
+    1040, 1031, 1031, 1040, 1041, 1031, 1041, 186,
+    186, 1041, 187, 151, 150, 1042, 151, 1042,
+    1032, 1032, 1042, 1043, 1032, 1043, 1033, 1033,
+    1043, 1044, 1033, 1044, 1034, 1034, 1044, 1045,
+    1034, 1045, 1035, 1035, 1045, 1046, 1035, 1046,
+    1036, 1036, 1046, 1047, 1036, 1047, 1037, 1037,
+    1047, 1048, 1037, 1048, 1038, 1038, 1048, 1049,
+    1038, 1049, 1039, 1039, 1049, 1050, 1039, 1050,
+    1040, 1040, 1050, 1051, 1040, 1051, 1041, 1041,
+    1051, 1052, 1041, 1052, 187, 187, 1052, 188,
+    150, 149, 1053, 150, 1053, 1042, 1042, 1053,
+    1054, 1042, 1054, 1043, 1043, 1054, 1055, 1043,
+    1055, 1044, 1044, 1055, 1056, 1044, 1056, 1045,
+    1045, 1056, 1057, 1045, 1057, 1046, 1046, 1057,
+    1058, 1046, 1058, 1047, 1047, 1058, 1059, 1047,
+    1059, 1048, 1048, 1059, 1060, 1048, 1060, 1049,
+    1049, 1060, 1061, 1049, 1061, 1050, 1050, 1061,
+    1062, 1050, 1062, 1051, 1051, 1062, 1063, 1051,
+    1063, 1052, 1052, 1063, 1064, 1052, 1064, 188,
+    188, 1064, 189, 149, 148, 1065, 149, 1065,
+    1053, 1053, 1065, 1066, 1053, 1066, 1054, 1054,
+    1066, 1067, 1054, 1067, 1055, 1055, 1067, 1068,
+    1055, 1068, 1056, 1056, 1068, 1069, 1056, 1069,
+    1057, 1057, 1069, 1070, 1057, 1070, 1058, 1058,
+    1070, 1071, 1058, 1071, 1059, 1059, 1071, 1072,
+    1059, 1072, 1060, 1060, 1072, 1073, 1060, 1073,
+    1061, 1061, 1073, 1074, 1061, 1074, 1062, 1062,
+    1074, 1075, 1062, 1075, 1063, 1063, 1075, 1076,
+    1063, 1076, 1064, 1064, 1076, 1077, 1064, 1077,
+    189, 189, 1077, 190, 148, 147, 1078, 148,
+    1078, 1065, 1065, 1078, 1079, 1065, 1079, 1066,
+    1066, 1079, 1080, 1066, 1080, 1067, 1067, 1080,
+    1081, 1067, 1081, 1068, 1068, 1081, 1082, 1068,
+    1082, 1069, 1069, 1082, 1083, 1069, 1083, 1070,
+    1070, 1083, 1084, 1070, 1084, 1071, 1071, 1084,
+    1085, 1071, 1085, 1072, 1072, 1085, 1086, 1072,
+    1086, 1073, 1073, 1086, 1087, 1073, 1087, 1074,
+    1074, 1087, 1088, 1074, 1088, 1075, 1075, 1088,
+    1089, 1075, 1089, 1076, 1076, 1089, 1090, 1076,
+    1090, 1077, 1077, 1090, 1091, 1077, 1091, 190,
+    190, 1091, 191, 147, 1, 162, 147, 162,
+    1078, 1078, 162, 163, 1078, 163, 1079, 1079,
+    163, 164, 1079, 164, 1080, 1080, 164, 165,
+    1080, 165, 1081, 1081, 165, 166, 1081, 166,
+    1082, 1082, 166, 167, 1082, 167, 1083, 1083,
+    167, 168, 1083, 168, 1084, 1084, 168, 169,
+    1084, 169, 1085, 1085, 169, 170, 1085, 170,
+    1086, 1086, 170, 171, 1086, 171, 1087, 1087,
+    171, 172, 1087, 172, 1088, 1088, 172, 173,
+    1088, 173, 1089, 1089, 173, 174, 1089, 174,
+    1090, 1090, 174, 175, 1090, 175, 1091, 1091,
+    175, 176, 1091, 176, 191, 191, 176, 10,
+    8, 177, 207, 177, 178, 1092, 177, 1092,
+    207, 207, 1092, 208, 178, 179, 1093, 178,
+    1093, 1092, 1092, 1093, 1094, 1092, 1094, 208,
+    208, 1094, 209, 179, 180, 1095, 179, 1095,
+    1093, 1093, 1095, 1096, 1093, 1096, 1094, 1094,
+    1096, 1097, 1094, 1097, 209, 209, 1097, 210,
+    180, 181, 1098, 180, 1098, 1095, 1095, 1098,
+    1099, 1095, 1099, 1096, 1096, 1099, 1100, 1096,
+    1100, 1097, 1097, 1100, 1101, 1097, 1101, 210,
+    210, 1101, 211, 181, 182, 1102, 181, 1102,
+    1098, 1098, 1102, 1103, 1098, 1103, 1099, 1099,
+    1103, 1104, 1099, 1104, 1100, 1100, 1104, 1105,
+    1100, 1105, 1101, 1101, 1105, 1106, 1101, 1106,
+    211, 211, 1106, 212, 182, 183, 1107, 182,
+    1107, 1102, 1102, 1107, 1108, 1102, 1108, 1103,
+    1103, 1108, 1109, 1103, 1109, 1104, 1104, 1109,
+    1110, 1104, 1110, 1105, 1105, 1110, 1111, 1105,
+    1111, 1106, 1106, 1111, 1112, 1106, 1112, 212,
+    212, 1112, 213, 183, 184, 1113, 183, 1113,
+    1107, 1107, 1113, 1114, 1107, 1114, 1108, 1108,
+    1114, 1115, 1108, 1115, 1109, 1109, 1115, 1116,
+    1109, 1116, 1110, 1110, 1116, 1117, 1110, 1117,
+    1111, 1111, 1117, 1118, 1111, 1118, 1112, 1112,
+    1118, 1119, 1112, 1119, 213, 213, 1119, 214,
+    184, 185, 1120, 184, 1120, 1113, 1113, 1120,
+    1121, 1113, 1121, 1114, 1114, 1121, 1122, 1114,
+    1122, 1115, 1115, 1122, 1123, 1115, 1123, 1116,
+    1116, 1123, 1124, 1116, 1124, 1117, 1117, 1124,
+    1125, 1117, 1125, 1118, 1118, 1125, 1126, 1118,
+    1126, 1119, 1119, 1126, 1127, 1119, 1127, 214,
+    214, 1127, 215, 185, 186, 1128, 185, 1128,
+    1120, 1120, 1128, 1129, 1120, 1129, 1121, 1121,
+    1129, 1130, 1121, 1130, 1122, 1122, 1130, 1131,
+    1122, 1131, 1123, 1123, 1131, 1132, 1123, 1132,
+    1124, 1124, 1132, 1133, 1124, 1133, 1125, 1125,
+    1133, 1134, 1125, 1134, 1126, 1126, 1134, 1135,
+    1126, 1135, 1127, 1127, 1135, 1136, 1127, 1136,
+    215, 215, 1136, 216, 186, 187, 1137, 186,
+    1137, 1128, 1128, 1137, 1138, 1128, 1138, 1129,
+    1129, 1138, 1139, 1129, 1139, 1130, 1130, 1139,
+    1140, 1130, 1140, 1131, 1131, 1140, 1141, 1131,
+    1141, 1132, 1132, 1141, 1142, 1132, 1142, 1133,
+    1133, 1142, 1143, 1133, 1143, 1134, 1134, 1143,
+    1144, 1134, 1144, 1135, 1135, 1144, 1145, 1135,
+    1145, 1136, 1136, 1145, 1146, 1136, 1146, 216,
+    216, 1146, 217, 187, 188, 1147, 187, 1147,
+    1137, 1137, 1147, 1148, 1137, 1148, 1138, 1138,
+    1148, 1149, 1138, 1149, 1139, 1139, 1149, 1150,
+    1139, 1150, 1140, 1140, 1150, 1151, 1140, 1151,
+    1141, 1141, 1151, 1152, 1141, 1152, 1142, 1142,
+    1152, 1153, 1142, 1153, 1143, 1143, 1153, 1154,
+    1143, 1154, 1144, 1144, 1154, 1155, 1144, 1155,
+    1145, 1145, 1155, 1156, 1145, 1156, 1146, 1146,
+    1156, 1157, 1146, 1157, 217, 217, 1157, 218,
+    188, 189, 1158, 188, 1158, 1147, 1147, 1158,
+    1159, 1147, 1159, 1148, 1148, 1159, 1160, 1148,
+    1160, 1149, 1149, 1160, 1161, 1149, 1161, 1150,
+    1150, 1161, 1162, 1150, 1162, 1151, 1151, 1162,
+    1163, 1151, 1163, 1152, 1152, 1163, 1164, 1152,
+    1164, 1153, 1153, 1164, 1165, 1153, 1165, 1154,
+    1154, 1165, 1166, 1154, 1166, 1155, 1155, 1166,
+    1167, 1155, 1167, 1156, 1156, 1167, 1168, 1156,
+    1168, 1157, 1157, 1168, 1169, 1157, 1169, 218,
+    218, 1169, 219, 189, 190, 1170, 189, 1170,
+    1158, 1158, 1170, 1171, 1158, 1171, 1159, 1159,
+    1171, 1172, 1159, 1172, 1160, 1160, 1172, 1173,
+    1160, 1173, 1161, 1161, 1173, 1174, 1161, 1174,
+    1162, 1162, 1174, 1175, 1162, 1175, 1163, 1163,
+    1175, 1176, 1163, 1176, 1164, 1164, 1176, 1177,
+    1164, 1177, 1165, 1165, 1177, 1178, 1165, 1178,
+    1166, 1166, 1178, 1179, 1166, 1179, 1167, 1167,
+    1179, 1180, 1167, 1180, 1168, 1168, 1180, 1181,
+    1168, 1181, 1169, 1169, 1181, 1182, 1169, 1182,
+    219, 219, 1182, 220, 190, 191, 1183, 190,
+    1183, 1170, 1170, 1183, 1184, 1170, 1184, 1171,
+    1171, 1184, 1185, 1171, 1185, 1172, 1172, 1185,
+    1186, 1172, 1186, 1173, 1173, 1186, 1187, 1173,
+    1187, 1174, 1174, 1187, 1188, 1174, 1188, 1175,
+    1175, 1188, 1189, 1175, 1189, 1176, 1176, 1189,
+    1190, 1176, 1190, 1177, 1177, 1190, 1191, 1177,
+    1191, 1178, 1178, 1191, 1192, 1178, 1192, 1179,
+    1179, 1192, 1193, 1179, 1193, 1180, 1180, 1193,
+    1194, 1180, 1194, 1181, 1181, 1194, 1195, 1181,
+    1195, 1182, 1182, 1195, 1196, 1182, 1196, 220,
+    220, 1196, 221, 191, 10, 192, 191, 192,
+    1183, 1183, 192, 193, 1183, 193, 1184, 1184,
+    193, 194, 1184, 194, 1185, 1185, 194, 195,
+    1185, 195, 1186, 1186, 195, 196, 1186, 196,
+    1187, 1187, 196, 197, 1187, 197, 1188, 1188,
+    197, 198, 1188, 198, 1189, 1189, 198, 199,
+    1189, 199, 1190, 1190, 199, 200, 1190, 200,
+    1191, 1191, 200, 201, 1191, 201, 1192, 1192,
+    201, 202, 1192, 202, 1193, 1193, 202, 203,
+    1193, 203, 1194, 1194, 203, 204, 1194, 204,
+    1195, 1195, 204, 205, 1195, 205, 1196, 1196,
+    205, 206, 1196, 206, 221, 221, 206, 3,
+    5, 146, 222, 146, 145, 1197, 146, 1197,
+    222, 222, 1197, 223, 145, 144, 1198, 145,
+    1198, 1197, 1197, 1198, 1199, 1197, 1199, 223,
+    223, 1199, 224, 144, 143, 1200, 144, 1200,
+    1198, 1198, 1200, 1201, 1198, 1201, 1199, 1199,
+    1201, 1202, 1199, 1202, 224, 224, 1202, 225,
+    143, 142, 1203, 143, 1203, 1200, 1200, 1203,
+    1204, 1200, 1204, 1201, 1201, 1204, 1205, 1201,
+    1205, 1202, 1202, 1205, 1206, 1202, 1206, 225,
+    225, 1206, 226, 142, 141, 1207, 142, 1207,
+    1203, 1203, 1207, 1208, 1203, 1208, 1204, 1204,
+    1208, 1209, 1204, 1209, 1205, 1205, 1209, 1210,
+    1205, 1210, 1206, 1206, 1210, 1211, 1206, 1211,
+    226, 226, 1211, 227, 141, 140, 1212, 141,
+    1212, 1207, 1207, 1212, 1213, 1207, 1213, 1208,
+    1208, 1213, 1214, 1208, 1214, 1209, 1209, 1214,
+    1215, 1209, 1215, 1210, 1210, 1215, 1216, 1210,
+    1216, 1211, 1211, 1216, 1217, 1211, 1217, 227,
+    227, 1217, 228, 140, 139, 1218, 140, 1218,
+    1212, 1212, 1218, 1219, 1212, 1219, 1213, 1213,
+    1219, 1220, 1213, 1220, 1214, 1214, 1220, 1221,
+    1214, 1221, 1215, 1215, 1221, 1222, 1215, 1222,
+    1216, 1216, 1222, 1223, 1216, 1223, 1217, 1217,
+    1223, 1224, 1217, 1224, 228, 228, 1224, 229,
+    139, 138, 1225, 139, 1225, 1218, 1218, 1225,
+    1226, 1218, 1226, 1219, 1219, 1226, 1227, 1219,
+    1227, 1220, 1220, 1227, 1228, 1220, 1228, 1221,
+    1221, 1228, 1229, 1221, 1229, 1222, 1222, 1229,
+    1230, 1222, 1230, 1223, 1223, 1230, 1231, 1223,
+    1231, 1224, 1224, 1231, 1232, 1224, 1232, 229,
+    229, 1232, 230, 138, 137, 1233, 138, 1233,
+    1225, 1225, 1233, 1234, 1225, 1234, 1226, 1226,
+    1234, 1235, 1226, 1235, 1227, 1227, 1235, 1236,
+    1227, 1236, 1228, 1228, 1236, 1237, 1228, 1237,
+    1229, 1229, 1237, 1238, 1229, 1238, 1230, 1230,
+    1238, 1239, 1230, 1239, 1231, 1231, 1239, 1240,
+    1231, 1240, 1232, 1232, 1240, 1241, 1232, 1241,
+    230, 230, 1241, 231, 137, 136, 1242, 137,
+    1242, 1233, 1233, 1242, 1243, 1233, 1243, 1234,
+    1234, 1243, 1244, 1234, 1244, 1235, 1235, 1244,
+    1245, 1235, 1245, 1236, 1236, 1245, 1246, 1236,
+    1246, 1237, 1237, 1246, 1247, 1237, 1247, 1238,
+    1238, 1247, 1248, 1238, 1248, 1239, 1239, 1248,
+    1249, 1239, 1249, 1240, 1240, 1249, 1250, 1240,
+    1250, 1241, 1241, 1250, 1251, 1241, 1251, 231,
+    231, 1251, 232, 136, 135, 1252, 136, 1252,
+    1242, 1242, 1252, 1253, 1242, 1253, 1243, 1243,
+    1253, 1254, 1243, 1254, 1244, 1244, 1254, 1255,
+    1244, 1255, 1245, 1245, 1255, 1256, 1245, 1256,
+    1246, 1246, 1256, 1257, 1246, 1257, 1247, 1247,
+    1257, 1258, 1247, 1258, 1248, 1248, 1258, 1259,
+    1248, 1259, 1249, 1249, 1259, 1260, 1249, 1260,
+    1250, 1250, 1260, 1261, 1250, 1261, 1251, 1251,
+    1261, 1262, 1251, 1262, 232, 232, 1262, 233,
+    135, 134, 1263, 135, 1263, 1252, 1252, 1263,
+    1264, 1252, 1264, 1253, 1253, 1264, 1265, 1253,
+    1265, 1254, 1254, 1265, 1266, 1254, 1266, 1255,
+    1255, 1266, 1267, 1255, 1267, 1256, 1256, 1267,
+    1268, 1256, 1268, 1257, 1257, 1268, 1269, 1257,
+    1269, 1258, 1258, 1269, 1270, 1258, 1270, 1259,
+    1259, 1270, 1271, 1259, 1271, 1260, 1260, 1271,
+    1272, 1260, 1272, 1261, 1261, 1272, 1273, 1261,
+    1273, 1262, 1262, 1273, 1274, 1262, 1274, 233,
+    233, 1274, 234, 134, 133, 1275, 134, 1275,
+    1263, 1263, 1275, 1276, 1263, 1276, 1264, 1264,
+    1276, 1277, 1264, 1277, 1265, 1265, 1277, 1278,
+    1265, 1278, 1266, 1266, 1278, 1279, 1266, 1279,
+    1267, 1267, 1279, 1280, 1267, 1280, 1268, 1268,
+    1280, 1281, 1268, 1281, 1269, 1269, 1281, 1282,
+    1269, 1282, 1270, 1270, 1282, 1283, 1270, 1283,
+    1271, 1271, 1283, 1284, 1271, 1284, 1272, 1272,
+    1284, 1285, 1272, 1285, 1273, 1273, 1285, 1286,
+    1273, 1286, 1274, 1274, 1286, 1287, 1274, 1287,
+    234, 234, 1287, 235, 133, 132, 1288, 133,
+    1288, 1275, 1275, 1288, 1289, 1275, 1289, 1276,
+    1276, 1289, 1290, 1276, 1290, 1277, 1277, 1290,
+    1291, 1277, 1291, 1278, 1278, 1291, 1292, 1278,
+    1292, 1279, 1279, 1292, 1293, 1279, 1293, 1280,
+    1280, 1293, 1294, 1280, 1294, 1281, 1281, 1294,
+    1295, 1281, 1295, 1282, 1282, 1295, 1296, 1282,
+    1296, 1283, 1283, 1296, 1297, 1283, 1297, 1284,
+    1284, 1297, 1298, 1284, 1298, 1285, 1285, 1298,
+    1299, 1285, 1299, 1286, 1286, 1299, 1300, 1286,
+    1300, 1287, 1287, 1300, 1301, 1287, 1301, 235,
+    235, 1301, 236, 132, 8, 207, 132, 207,
+    1288, 1288, 207, 208, 1288, 208, 1289, 1289,
+    208, 209, 1289, 209, 1290, 1290, 209, 210,
+    1290, 210, 1291, 1291, 210, 211, 1291, 211,
+    1292, 1292, 211, 212, 1292, 212, 1293, 1293,
+    212, 213, 1293, 213, 1294, 1294, 213, 214,
+    1294, 214, 1295, 1295, 214, 215, 1295, 215,
+    1296, 1296, 215, 216, 1296, 216, 1297, 1297,
+    216, 217, 1297, 217, 1298, 1298, 217, 218,
+    1298, 218, 1299, 1299, 218, 219, 1299, 219,
+    1300, 1300, 219, 220, 1300, 220, 1301, 1301,
+    220, 221, 1301, 221, 236, 236, 221, 3,
+    5, 222, 252, 222, 223, 1302, 222, 1302,
+    252, 252, 1302, 253, 223, 224, 1303, 223,
+    1303, 1302, 1302, 1303, 1304, 1302, 1304, 253,
+    253, 1304, 254, 224, 225, 1305, 224, 1305,
+    1303, 1303, 1305, 1306, 1303, 1306, 1304, 1304,
+    1306, 1307, 1304, 1307, 254, 254, 1307, 255,
+    225, 226, 1308, 225, 1308, 1305, 1305, 1308,
+    1309, 1305, 1309, 1306, 1306, 1309, 1310, 1306,
+    1310, 1307, 1307, 1310, 1311, 1307, 1311, 255,
+    255, 1311, 256, 226, 227, 1312, 226, 1312,
+    1308, 1308, 1312, 1313, 1308, 1313, 1309, 1309,
+    1313, 1314, 1309, 1314, 1310, 1310, 1314, 1315,
+    1310, 1315, 1311, 1311, 1315, 1316, 1311, 1316,
+    256, 256, 1316, 257, 227, 228, 1317, 227,
+    1317, 1312, 1312, 1317, 1318, 1312, 1318, 1313,
+    1313, 1318, 1319, 1313, 1319, 1314, 1314, 1319,
+    1320, 1314, 1320, 1315, 1315, 1320, 1321, 1315,
+    1321, 1316, 1316, 1321, 1322, 1316, 1322, 257,
+    257, 1322, 258, 228, 229, 1323, 228, 1323,
+    1317, 1317, 1323, 1324, 1317, 1324, 1318, 1318,
+    1324, 1325, 1318, 1325, 1319, 1319, 1325, 1326,
+    1319, 1326, 1320, 1320, 1326, 1327, 1320, 1327,
+    1321, 1321, 1327, 1328, 1321, 1328, 1322, 1322,
+    1328, 1329, 1322, 1329, 258, 258, 1329, 259,
+    229, 230, 1330, 229, 1330, 1323, 1323, 1330,
+    1331, 1323, 1331, 1324, 1324, 1331, 1332, 1324,
+    1332, 1325, 1325, 1332, 1333, 1325, 1333, 1326,
+    1326, 1333, 1334, 1326, 1334, 1327, 1327, 1334,
+    1335, 1327, 1335, 1328, 1328, 1335, 1336, 1328,
+    1336, 1329, 1329, 1336, 1337, 1329, 1337, 259,
+    259, 1337, 260, 230, 231, 1338, 230, 1338,
+    1330, 1330, 1338, 1339, 1330, 1339, 1331, 1331,
+    1339, 1340, 1331, 1340, 1332, 1332, 1340, 1341,
+    1332, 1341, 1333, 1333, 1341, 1342, 1333, 1342,
+    1334, 1334, 1342, 1343, 1334, 1343, 1335, 1335,
+    1343, 1344, 1335, 1344, 1336, 1336, 1344, 1345,
+    1336, 1345, 1337, 1337, 1345, 1346, 1337, 1346,
+    260, 260, 1346, 261, 231, 232, 1347, 231,
+    1347, 1338, 1338, 1347, 1348, 1338, 1348, 1339,
+    1339, 1348, 1349, 1339, 1349, 1340, 1340, 1349,
+    1350, 1340, 1350, 1341, 1341, 1350, 1351, 1341,
+    1351, 1342, 1342, 1351, 1352, 1342, 1352, 1343,
+    1343, 1352, 1353, 1343, 1353, 1344, 1344, 1353,
+    1354, 1344, 1354, 1345, 1345, 1354, 1355, 1345,
+    1355, 1346, 1346, 1355, 1356, 1346, 1356, 261,
+    261, 1356, 262, 232, 233, 1357, 232, 1357,
+    1347, 1347, 1357, 1358, 1347, 1358, 1348, 1348,
+    1358, 1359, 1348, 1359, 1349, 1349, 1359, 1360,
+    1349, 1360, 1350, 1350, 1360, 1361, 1350, 1361,
+    1351, 1351, 1361, 1362, 1351, 1362, 1352, 1352,
+    1362, 1363, 1352, 1363, 1353, 1353, 1363, 1364,
+    1353, 1364, 1354, 1354, 1364, 1365, 1354, 1365,
+    1355, 1355, 1365, 1366, 1355, 1366, 1356, 1356,
+    1366, 1367, 1356, 1367, 262, 262, 1367, 263,
+    233, 234, 1368, 233, 1368, 1357, 1357, 1368,
+    1369, 1357, 1369, 1358, 1358, 1369, 1370, 1358,
+    1370, 1359, 1359, 1370, 1371, 1359, 1371, 1360,
+    1360, 1371, 1372, 1360, 1372, 1361, 1361, 1372,
+    1373, 1361, 1373, 1362, 1362, 1373, 1374, 1362,
+    1374, 1363, 1363, 1374, 1375, 1363, 1375, 1364,
+    1364, 1375, 1376, 1364, 1376, 1365, 1365, 1376,
+    1377, 1365, 1377, 1366, 1366, 1377, 1378, 1366,
+    1378, 1367, 1367, 1378, 1379, 1367, 1379, 263,
+    263, 1379, 264, 234, 235, 1380, 234, 1380,
+    1368, 1368, 1380, 1381, 1368, 1381, 1369, 1369,
+    1381, 1382, 1369, 1382, 1370, 1370, 1382, 1383,
+    1370, 1383, 1371, 1371, 1383, 1384, 1371, 1384,
+    1372, 1372, 1384, 1385, 1372, 1385, 1373, 1373,
+    1385, 1386, 1373, 1386, 1374, 1374, 1386, 1387,
+    1374, 1387, 1375, 1375, 1387, 1388, 1375, 1388,
+    1376, 1376, 1388, 1389, 1376, 1389, 1377, 1377,
+    1389, 1390, 1377, 1390, 1378, 1378, 1390, 1391,
+    1378, 1391, 1379, 1379, 1391, 1392, 1379, 1392,
+    264, 264, 1392, 265, 235, 236, 1393, 235,
+    1393, 1380, 1380, 1393, 1394, 1380, 1394, 1381,
+    1381, 1394, 1395, 1381, 1395, 1382, 1382, 1395,
+    1396, 1382, 1396, 1383, 1383, 1396, 1397, 1383,
+    1397, 1384, 1384, 1397, 1398, 1384, 1398, 1385,
+    1385, 1398, 1399, 1385, 1399, 1386, 1386, 1399,
+    1400, 1386, 1400, 1387, 1387, 1400, 1401, 1387,
+    1401, 1388, 1388, 1401, 1402, 1388, 1402, 1389,
+    1389, 1402, 1403, 1389, 1403, 1390, 1390, 1403,
+    1404, 1390, 1404, 1391, 1391, 1404, 1405, 1391,
+    1405, 1392, 1392, 1405, 1406, 1392, 1406, 265,
+    265, 1406, 266, 236, 3, 237, 236, 237,
+    1393, 1393, 237, 238, 1393, 238, 1394, 1394,
+    238, 239, 1394, 239, 1395, 1395, 239, 240,
+    1395, 240, 1396, 1396, 240, 241, 1396, 241,
+    1397, 1397, 241, 242, 1397, 242, 1398, 1398,
+    242, 243, 1398, 243, 1399, 1399, 243, 244,
+    1399, 244, 1400, 1400, 244, 245, 1400, 245,
+    1401, 1401, 245, 246, 1401, 246, 1402, 1402,
+    246, 247, 1402, 247, 1403, 1403, 247, 248,
+    1403, 248, 1404, 1404, 248, 249, 1404, 249,
+    1405, 1405, 249, 250, 1405, 250, 1406, 1406,
+    250, 251, 1406, 251, 266, 266, 251, 2,
+    2, 251, 282, 251, 250, 1407, 251, 1407,
+    282, 282, 1407, 283, 250, 249, 1408, 250,
+    1408, 1407, 1407, 1408, 1409, 1407, 1409, 283,
+    283, 1409, 284, 249, 248, 1410, 249, 1410,
+    1408, 1408, 1410, 1411, 1408, 1411, 1409, 1409,
+    1411, 1412, 1409, 1412, 284, 284, 1412, 285,
+    248, 247, 1413, 248, 1413, 1410, 1410, 1413,
+    1414, 1410, 1414, 1411, 1411, 1414, 1415, 1411,
+    1415, 1412, 1412, 1415, 1416, 1412, 1416, 285,
+    285, 1416, 286, 247, 246, 1417, 247, 1417,
+    1413, 1413, 1417, 1418, 1413, 1418, 1414, 1414,
+    1418, 1419, 1414, 1419, 1415, 1415, 1419, 1420,
+    1415, 1420, 1416, 1416, 1420, 1421, 1416, 1421,
+    286, 286, 1421, 287, 246, 245, 1422, 246,
+    1422, 1417, 1417, 1422, 1423, 1417, 1423, 1418,
+    1418, 1423, 1424, 1418, 1424, 1419, 1419, 1424,
+    1425, 1419, 1425, 1420, 1420, 1425, 1426, 1420,
+    1426, 1421, 1421, 1426, 1427, 1421, 1427, 287,
+    287, 1427, 288, 245, 244, 1428, 245, 1428,
+    1422, 1422, 1428, 1429, 1422, 1429, 1423, 1423,
+    1429, 1430, 1423, 1430, 1424, 1424, 1430, 1431,
+    1424, 1431, 1425, 1425, 1431, 1432, 1425, 1432,
+    1426, 1426, 1432, 1433, 1426, 1433, 1427, 1427,
+    1433, 1434, 1427, 1434, 288, 288, 1434, 289,
+    244, 243, 1435, 244, 1435, 1428, 1428, 1435,
+    1436, 1428, 1436, 1429, 1429, 1436, 1437, 1429,
+    1437, 1430, 1430, 1437, 1438, 1430, 1438, 1431,
+    1431, 1438, 1439, 1431, 1439, 1432, 1432, 1439,
+    1440, 1432, 1440, 1433, 1433, 1440, 1441, 1433,
+    1441, 1434, 1434, 1441, 1442, 1434, 1442, 289,
+    289, 1442, 290, 243, 242, 1443, 243, 1443,
+    1435, 1435, 1443, 1444, 1435, 1444, 1436, 1436,
+    1444, 1445, 1436, 1445, 1437, 1437, 1445, 1446,
+    1437, 1446, 1438, 1438, 1446, 1447, 1438, 1447,
+    1439, 1439, 1447, 1448, 1439, 1448, 1440, 1440,
+    1448, 1449, 1440, 1449, 1441, 1441, 1449, 1450,
+    1441, 1450, 1442, 1442, 1450, 1451, 1442, 1451,
+    290, 290, 1451, 291, 242, 241, 1452, 242,
+    1452, 1443, 1443, 1452, 1453, 1443, 1453, 1444,
+    1444, 1453, 1454, 1444, 1454, 1445, 1445, 1454,
+    1455, 1445, 1455, 1446, 1446, 1455, 1456, 1446,
+    1456, 1447, 1447, 1456, 1457, 1447, 1457, 1448,
+    1448, 1457, 1458, 1448, 1458, 1449, 1449, 1458,
+    1459, 1449, 1459, 1450, 1450, 1459, 1460, 1450,
+    1460, 1451, 1451, 1460, 1461, 1451, 1461, 291,
+    291, 1461, 292, 241, 240, 1462, 241, 1462,
+    1452, 1452, 1462, 1463, 1452, 1463, 1453, 1453,
+    1463, 1464, 1453, 1464, 1454, 1454, 1464, 1465,
+    1454, 1465, 1455, 1455, 1465, 1466, 1455, 1466,
+    1456, 1456, 1466, 1467, 1456, 1467, 1457, 1457,
+    1467, 1468, 1457, 1468, 1458, 1458, 1468, 1469,
+    1458, 1469, 1459, 1459, 1469, 1470, 1459, 1470,
+    1460, 1460, 1470, 1471, 1460, 1471, 1461, 1461,
+    1471, 1472, 1461, 1472, 292, 292, 1472, 293,
+    240, 239, 1473, 240, 1473, 1462, 1462, 1473,
+    1474, 1462, 1474, 1463, 1463, 1474, 1475, 1463,
+    1475, 1464, 1464, 1475, 1476, 1464, 1476, 1465,
+    1465, 1476, 1477, 1465, 1477, 1466, 1466, 1477,
+    1478, 1466, 1478, 1467, 1467, 1478, 1479, 1467,
+    1479, 1468, 1468, 1479, 1480, 1468, 1480, 1469,
+    1469, 1480, 1481, 1469, 1481, 1470, 1470, 1481,
+    1482, 1470, 1482, 1471, 1471, 1482, 1483, 1471,
+    1483, 1472, 1472, 1483, 1484, 1472, 1484, 293,
+    293, 1484, 294, 239, 238, 1485, 239, 1485,
+    1473, 1473, 1485, 1486, 1473, 1486, 1474, 1474,
+    1486, 1487, 1474, 1487, 1475, 1475, 1487, 1488,
+    1475, 1488, 1476, 1476, 1488, 1489, 1476, 1489,
+    1477, 1477, 1489, 1490, 1477, 1490, 1478, 1478,
+    1490, 1491, 1478, 1491, 1479, 1479, 1491, 1492,
+    1479, 1492, 1480, 1480, 1492, 1493, 1480, 1493,
+    1481, 1481, 1493, 1494, 1481, 1494, 1482, 1482,
+    1494, 1495, 1482, 1495, 1483, 1483, 1495, 1496,
+    1483, 1496, 1484, 1484, 1496, 1497, 1484, 1497,
+    294, 294, 1497, 295, 238, 237, 1498, 238,
+    1498, 1485, 1485, 1498, 1499, 1485, 1499, 1486,
+    1486, 1499, 1500, 1486, 1500, 1487, 1487, 1500,
+    1501, 1487, 1501, 1488, 1488, 1501, 1502, 1488,
+    1502, 1489, 1489, 1502, 1503, 1489, 1503, 1490,
+    1490, 1503, 1504, 1490, 1504, 1491, 1491, 1504,
+    1505, 1491, 1505, 1492, 1492, 1505, 1506, 1492,
+    1506, 1493, 1493, 1506, 1507, 1493, 1507, 1494,
+    1494, 1507, 1508, 1494, 1508, 1495, 1495, 1508,
+    1509, 1495, 1509, 1496, 1496, 1509, 1510, 1496,
+    1510, 1497, 1497, 1510, 1511, 1497, 1511, 295,
+    295, 1511, 296, 237, 3, 267, 237, 267,
+    1498, 1498, 267, 268, 1498, 268, 1499, 1499,
+    268, 269, 1499, 269, 1500, 1500, 269, 270,
+    1500, 270, 1501, 1501, 270, 271, 1501, 271,
+    1502, 1502, 271, 272, 1502, 272, 1503, 1503,
+    272, 273, 1503, 273, 1504, 1504, 273, 274,
+    1504, 274, 1505, 1505, 274, 275, 1505, 275,
+    1506, 1506, 275, 276, 1506, 276, 1507, 1507,
+    276, 277, 1507, 277, 1508, 1508, 277, 278,
+    1508, 278, 1509, 1509, 278, 279, 1509, 279,
+    1510, 1510, 279, 280, 1510, 280, 1511, 1511,
+    280, 281, 1511, 281, 296, 296, 281, 7,
+    7, 281, 297, 281, 280, 1512, 281, 1512,
+    297, 297, 1512, 298, 280, 279, 1513, 280,
+    1513, 1512, 1512, 1513, 1514, 1512, 1514, 298,
+    298, 1514, 299, 279, 278, 1515, 279, 1515,
+    1513, 1513, 1515, 1516, 1513, 1516, 1514, 1514,
+    1516, 1517, 1514, 1517, 299, 299, 1517, 300,
+    278, 277, 1518, 278, 1518, 1515, 1515, 1518,
+    1519, 1515, 1519, 1516, 1516, 1519, 1520, 1516,
+    1520, 1517, 1517, 1520, 1521, 1517, 1521, 300,
+    300, 1521, 301, 277, 276, 1522, 277, 1522,
+    1518, 1518, 1522, 1523, 1518, 1523, 1519, 1519,
+    1523, 1524, 1519, 1524, 1520, 1520, 1524, 1525,
+    1520, 1525, 1521, 1521, 1525, 1526, 1521, 1526,
+    301, 301, 1526, 302, 276, 275, 1527, 276,
+    1527, 1522, 1522, 1527, 1528, 1522, 1528, 1523,
+    1523, 1528, 1529, 1523, 1529, 1524, 1524, 1529,
+    1530, 1524, 1530, 1525, 1525, 1530, 1531, 1525,
+    1531, 1526, 1526, 1531, 1532, 1526, 1532, 302,
+    302, 1532, 303, 275, 274, 1533, 275, 1533,
+    1527, 1527, 1533, 1534, 1527, 1534, 1528, 1528,
+    1534, 1535, 1528, 1535, 1529, 1529, 1535, 1536,
+    1529, 1536, 1530, 1530, 1536, 1537, 1530, 1537,
+    1531, 1531, 1537, 1538, 1531, 1538, 1532, 1532,
+    1538, 1539, 1532, 1539, 303, 303, 1539, 304,
+    274, 273, 1540, 274, 1540, 1533, 1533, 1540,
+    1541, 1533, 1541, 1534, 1534, 1541, 1542, 1534,
+    1542, 1535, 1535, 1542, 1543, 1535, 1543, 1536,
+    1536, 1543, 1544, 1536, 1544, 1537, 1537, 1544,
+    1545, 1537, 1545, 1538, 1538, 1545, 1546, 1538,
+    1546, 1539, 1539, 1546, 1547, 1539, 1547, 304,
+    304, 1547, 305, 273, 272, 1548, 273, 1548,
+    1540, 1540, 1548, 1549, 1540, 1549, 1541, 1541,
+    1549, 1550, 1541, 1550, 1542, 1542, 1550, 1551,
+    1542, 1551, 1543, 1543, 1551, 1552, 1543, 1552,
+    1544, 1544, 1552, 1553, 1544, 1553, 1545, 1545,
+    1553, 1554, 1545, 1554, 1546, 1546, 1554, 1555,
+    1546, 1555, 1547, 1547, 1555, 1556, 1547, 1556,
+    305, 305, 1556, 306, 272, 271, 1557, 272,
+    1557, 1548, 1548, 1557, 1558, 1548, 1558, 1549,
+    1549, 1558, 1559, 1549, 1559, 1550, 1550, 1559,
+    1560, 1550, 1560, 1551, 1551, 1560, 1561, 1551,
+    1561, 1552, 1552, 1561, 1562, 1552, 1562, 1553,
+    1553, 1562, 1563, 1553, 1563, 1554, 1554, 1563,
+    1564, 1554, 1564, 1555, 1555, 1564, 1565, 1555,
+    1565, 1556, 1556, 1565, 1566, 1556, 1566, 306,
+    306, 1566, 307, 271, 270, 1567, 271, 1567,
+    1557, 1557, 1567, 1568, 1557, 1568, 1558, 1558,
+    1568, 1569, 1558, 1569, 1559, 1559, 1569, 1570,
+    1559, 1570, 1560, 1560, 1570, 1571, 1560, 1571,
+    1561, 1561, 1571, 1572, 1561, 1572, 1562, 1562,
+    1572, 1573, 1562, 1573, 1563, 1563, 1573, 1574,
+    1563, 1574, 1564, 1564, 1574, 1575, 1564, 1575,
+    1565, 1565, 1575, 1576, 1565, 1576, 1566, 1566,
+    1576, 1577, 1566, 1577, 307, 307, 1577, 308,
+    270, 269, 1578, 270, 1578, 1567, 1567, 1578,
+    1579, 1567, 1579, 1568, 1568, 1579, 1580, 1568,
+    1580, 1569, 1569, 1580, 1581, 1569, 1581, 1570,
+    1570, 1581, 1582, 1570, 1582, 1571, 1571, 1582,
+    1583, 1571, 1583, 1572, 1572, 1583, 1584, 1572,
+    1584, 1573, 1573, 1584, 1585, 1573, 1585, 1574,
+    1574, 1585, 1586, 1574, 1586, 1575, 1575, 1586,
+    1587, 1575, 1587, 1576, 1576, 1587, 1588, 1576,
+    1588, 1577, 1577, 1588, 1589, 1577, 1589, 308,
+    308, 1589, 309, 269, 268, 1590, 269, 1590,
+    1578, 1578, 1590, 1591, 1578, 1591, 1579, 1579,
+    1591, 1592, 1579, 1592, 1580, 1580, 1592, 1593,
+    1580, 1593, 1581, 1581, 1593, 1594, 1581, 1594,
+    1582, 1582, 1594, 1595, 1582, 1595, 1583, 1583,
+    1595, 1596, 1583, 1596, 1584, 1584, 1596, 1597,
+    1584, 1597, 1585, 1585, 1597, 1598, 1585, 1598,
+    1586, 1586, 1598, 1599, 1586, 1599, 1587, 1587,
+    1599, 1600, 1587, 1600, 1588, 1588, 1600, 1601,
+    1588, 1601, 1589, 1589, 1601, 1602, 1589, 1602,
+    309, 309, 1602, 310, 268, 267, 1603, 268,
+    1603, 1590, 1590, 1603, 1604, 1590, 1604, 1591,
+    1591, 1604, 1605, 1591, 1605, 1592, 1592, 1605,
+    1606, 1592, 1606, 1593, 1593, 1606, 1607, 1593,
+    1607, 1594, 1594, 1607, 1608, 1594, 1608, 1595,
+    1595, 1608, 1609, 1595, 1609, 1596, 1596, 1609,
+    1610, 1596, 1610, 1597, 1597, 1610, 1611, 1597,
+    1611, 1598, 1598, 1611, 1612, 1598, 1612, 1599,
+    1599, 1612, 1613, 1599, 1613, 1600, 1600, 1613,
+    1614, 1600, 1614, 1601, 1601, 1614, 1615, 1601,
+    1615, 1602, 1602, 1615, 1616, 1602, 1616, 310,
+    310, 1616, 311, 267, 3, 206, 267, 206,
+    1603, 1603, 206, 205, 1603, 205, 1604, 1604,
+    205, 204, 1604, 204, 1605, 1605, 204, 203,
+    1605, 203, 1606, 1606, 203, 202, 1606, 202,
+    1607, 1607, 202, 201, 1607, 201, 1608, 1608,
+    201, 200, 1608, 200, 1609, 1609, 200, 199,
+    1609, 199, 1610, 1610, 199, 198, 1610, 198,
+    1611, 1611, 198, 197, 1611, 197, 1612, 1612,
+    197, 196, 1612, 196, 1613, 1613, 196, 195,
+    1613, 195, 1614, 1614, 195, 194, 1614, 194,
+    1615, 1615, 194, 193, 1615, 193, 1616, 1616,
+    193, 192, 1616, 192, 311, 311, 192, 10,
+    7, 297, 327, 297, 298, 1617, 297, 1617,
+    327, 327, 1617, 328, 298, 299, 1618, 298,
+    1618, 1617, 1617, 1618, 1619, 1617, 1619, 328,
+    328, 1619, 329, 299, 300, 1620, 299, 1620,
+    1618, 1618, 1620, 1621, 1618, 1621, 1619, 1619,
+    1621, 1622, 1619, 1622, 329, 329, 1622, 330,
+    300, 301, 1623, 300, 1623, 1620, 1620, 1623,
+    1624, 1620, 1624, 1621, 1621, 1624, 1625, 1621,
+    1625, 1622, 1622, 1625, 1626, 1622, 1626, 330,
+    330, 1626, 331, 301, 302, 1627, 301, 1627,
+    1623, 1623, 1627, 1628, 1623, 1628, 1624, 1624,
+    1628, 1629, 1624, 1629, 1625, 1625, 1629, 1630,
+    1625, 1630, 1626, 1626, 1630, 1631, 1626, 1631,
+    331, 331, 1631, 332, 302, 303, 1632, 302,
+    1632, 1627, 1627, 1632, 1633, 1627, 1633, 1628,
+    1628, 1633, 1634, 1628, 1634, 1629, 1629, 1634,
+    1635, 1629, 1635, 1630, 1630, 1635, 1636, 1630,
+    1636, 1631, 1631, 1636, 1637, 1631, 1637, 332,
+    332, 1637, 333, 303, 304, 1638, 303, 1638,
+    1632, 1632, 1638, 1639, 1632, 1639, 1633, 1633,
+    1639, 1640, 1633, 1640, 1634, 1634, 1640, 1641,
+    1634, 1641, 1635, 1635, 1641, 1642, 1635, 1642,
+    1636, 1636, 1642, 1643, 1636, 1643, 1637, 1637,
+    1643, 1644, 1637, 1644, 333, 333, 1644, 2614,
+    304, 305, 1645, 304, 1645, 1638, 1638, 1645,
+    1646, 1638, 1646, 1639, 1639, 1646, 1647, 1639,
+    1647, 1640, 1640, 1647, 1648, 1640, 1648, 1641,
+    1641, 1648, 1649, 1641, 1649, 1642, 1642, 1649,
+    1650, 1642, 1650, 1643, 1643, 1650, 1651, 1643,
+    1651, 1644, 1644, 1651, 1652, 1644, 1652, 2615,
+    2616, 1652, 335, 305, 306, 1653, 305, 1653,
+    1645, 1645, 1653, 1654, 1645, 1654, 1646, 1646,
+    1654, 1655, 1646, 1655, 1647, 1647, 1655, 1656,
+    1647, 1656, 1648, 1648, 1656, 1657, 1648, 1657,
+    1649, 1649, 1657, 1658, 1649, 1658, 1650, 1650,
+    1658, 1659, 1650, 1659, 1651, 1651, 1659, 1660,
+    1651, 1660, 1652, 1652, 1660, 1661, 1652, 1661,
+    335, 335, 1661, 336, 306, 307, 1662, 306,
+    1662, 1653, 1653, 1662, 1663, 1653, 1663, 1654,
+    1654, 1663, 1664, 1654, 1664, 1655, 1655, 1664,
+    1665, 1655, 1665, 1656, 1656, 1665, 1666, 1656,
+    1666, 1657, 1657, 1666, 1667, 1657, 1667, 1658,
+    1658, 1667, 1668, 1658, 1668, 1659, 1659, 1668,
+    1669, 1659, 1669, 1660, 1660, 1669, 1670, 1660,
+    1670, 1661, 1661, 1670, 1671, 1661, 1671, 336,
+    336, 1671, 337, 307, 308, 1672, 307, 1672,
+    1662, 1662, 1672, 1673, 1662, 1673, 1663, 1663,
+    1673, 1674, 1663, 1674, 1664, 1664, 1674, 1675,
+    1664, 1675, 1665, 1665, 1675, 1676, 1665, 1676,
+    1666, 1666, 1676, 1677, 1666, 1677, 1667, 1667,
+    1677, 1678, 1667, 1678, 1668, 1668, 1678, 1679,
+    1668, 1679, 1669, 1669, 1679, 1680, 1669, 1680,
+    1670, 1670, 1680, 1681, 1670, 1681, 1671, 1671,
+    1681, 1682, 1671, 1682, 337, 337, 1682, 338,
+    308, 309, 1683, 308, 1683, 1672, 1672, 1683,
+    1684, 1672, 1684, 1673, 1673, 1684, 1685, 1673,
+    1685, 1674, 1674, 1685, 1686, 1674, 1686, 1675,
+    1675, 1686, 1687, 1675, 1687, 1676, 1676, 1687,
+    1688, 1676, 1688, 1677, 1677, 1688, 1689, 1677,
+    1689, 1678, 1678, 1689, 1690, 1678, 1690, 1679,
+    1679, 1690, 1691, 1679, 1691, 1680, 1680, 1691,
+    1692, 1680, 1692, 1681, 1681, 1692, 1693, 1681,
+    1693, 1682, 1682, 1693, 1694, 1682, 1694, 338,
+    338, 1694, 339, 309, 310, 1695, 309, 1695,
+    1683, 1683, 1695, 1696, 1683, 1696, 1684, 1684,
+    1696, 1697, 1684, 1697, 1685, 1685, 1697, 1698,
+    1685, 1698, 1686, 1686, 1698, 1699, 1686, 1699,
+    1687, 1687, 1699, 1700, 1687, 1700, 1688, 1688,
+    1700, 1701, 1688, 1701, 1689, 1689, 1701, 1702,
+    1689, 1702, 1690, 1690, 1702, 1703, 1690, 1703,
+    1691, 1691, 1703, 1704, 1691, 1704, 1692, 1692,
+    1704, 1705, 1692, 1705, 1693, 1693, 1705, 1706,
+    1693, 1706, 1694, 1694, 1706, 1707, 1694, 1707,
+    339, 339, 1707, 340, 310, 311, 1708, 310,
+    1708, 1695, 1695, 1708, 1709, 1695, 1709, 1696,
+    1696, 1709, 1710, 1696, 1710, 1697, 1697, 1710,
+    1711, 1697, 1711, 1698, 1698, 1711, 1712, 1698,
+    1712, 1699, 1699, 1712, 1713, 1699, 1713, 1700,
+    1700, 1713, 1714, 1700, 1714, 1701, 1701, 1714,
+    1715, 1701, 1715, 1702, 1702, 1715, 1716, 1702,
+    1716, 1703, 1703, 1716, 1717, 1703, 1717, 1704,
+    1704, 1717, 1718, 1704, 1718, 1705, 1705, 1718,
+    1719, 1705, 1719, 1706, 1706, 1719, 1720, 1706,
+    1720, 1707, 1707, 1720, 1721, 1707, 1721, 340,
+    340, 1721, 341, 311, 10, 312, 311, 312,
+    1708, 1708, 312, 313, 1708, 313, 1709, 1709,
+    313, 314, 1709, 314, 1710, 1710, 314, 315,
+    1710, 315, 1711, 1711, 315, 316, 1711, 316,
+    1712, 1712, 316, 317, 1712, 317, 1713, 1713,
+    317, 318, 1713, 318, 1714, 1714, 318, 319,
+    1714, 319, 1715, 1715, 319, 320, 1715, 320,
+    1716, 1716, 320, 321, 1716, 321, 1717, 1717,
+    321, 322, 1717, 322, 1718, 1718, 322, 323,
+    1718, 323, 1719, 1719, 323, 324, 1719, 324,
+    1720, 1720, 324, 325, 1720, 325, 1721, 1721,
+    325, 326, 1721, 326, 341, 341, 326, 6,
+    7, 327, 357, 327, 328, 1722, 327, 1722,
+    357, 357, 1722, 358, 328, 329, 1723, 328,
+    1723, 1722, 1722, 1723, 1724, 1722, 1724, 358,
+    358, 1724, 359, 329, 330, 1725, 329, 1725,
+    1723, 1723, 1725, 1726, 1723, 1726, 1724, 1724,
+    1726, 1727, 1724, 1727, 359, 359, 1727, 360,
+    330, 331, 1728, 330, 1728, 1725, 1725, 1728,
+    1729, 1725, 1729, 1726, 1726, 1729, 1730, 1726,
+    1730, 1727, 1727, 1730, 1731, 1727, 1731, 360,
+    360, 1731, 361, 331, 332, 1732, 331, 1732,
+    1728, 1728, 1732, 1733, 1728, 1733, 1729, 1729,
+    1733, 1734, 1729, 1734, 1730, 1730, 1734, 1735,
+    1730, 1735, 1731, 1731, 1735, 1736, 1731, 1736,
+    361, 361, 1736, 362, 332, 333, 1737, 332,
+    1737, 1732, 1732, 1737, 1738, 1732, 1738, 1733,
+    1733, 1738, 1739, 1733, 1739, 1734, 1734, 1739,
+    1740, 1734, 1740, 1735, 1735, 1740, 1741, 1735,
+    1741, 1736, 1736, 1741, 1742, 1736, 1742, 362,
+    362, 1742, 363, 333, 2617, 1743, 333, 1743,
+    1737, 1737, 1743, 1744, 1737, 1744, 1738, 1738,
+    1744, 1745, 1738, 1745, 1739, 1739, 1745, 1746,
+    1739, 1746, 1740, 1740, 1746, 1747, 1740, 1747,
+    1741, 1741, 1747, 1748, 1741, 1748, 1742, 1742,
+    1748, 1749, 1742, 1749, 363, 363, 1749, 364,
+    2618, 335, 1750, 2619, 1750, 2577, 2577, 1750,
+    1751, 2577, 1751, 2578, 2578, 1751, 2579, 1744,
+    1752, 1745, 1745, 1752, 1753, 1745, 1753, 1746,
+    1746, 1753, 1754, 1746, 1754, 1747, 1747, 1754,
+    1755, 1747, 1755, 1748, 1748, 1755, 1756, 1748,
+    1756, 1749, 1749, 1756, 1757, 1749, 1757, 364,
+    364, 1757, 365, 335, 336, 1758, 335, 1758,
+    1750, 1750, 1758, 1759, 1750, 1759, 1751, 1751,
+    1759, 1760, 1751, 1760, 2579, 2579, 1760, 1761,
+    2579, 1761, 2580, 2580, 1761, 2581, 1753, 1762,
+    1754, 1754, 1762, 1763, 1754, 1763, 1755, 1755,
+    1763, 1764, 1755, 1764, 1756, 1756, 1764, 1765,
+    1756, 1765, 1757, 1757, 1765, 1766, 1757, 1766,
+    365, 365, 1766, 366, 336, 337, 1767, 336,
+    1767, 1758, 1758, 1767, 1768, 1758, 1768, 1759,
+    1759, 1768, 1769, 1759, 1769, 1760, 1760, 1769,
+    1770, 1760, 1770, 1761, 1761, 1770, 1771, 1761,
+    1771, 2581, 2581, 1771, 1772, 2581, 1772, 2582,
+    2582, 1772, 2583, 1763, 1773, 1764, 1764, 1773,
+    1774, 1764, 1774, 1765, 1765, 1774, 1775, 1765,
+    1775, 1766, 1766, 1775, 1776, 1766, 1776, 366,
+    366, 1776, 367, 337, 338, 1777, 337, 1777,
+    1767, 1767, 1777, 1778, 1767, 1778, 1768, 1768,
+    1778, 1779, 1768, 1779, 1769, 1769, 1779, 1780,
+    1769, 1780, 1770, 1770, 1780, 1781, 1770, 1781,
+    1771, 1771, 1781, 1782, 1771, 1782, 1772, 1772,
+    1782, 1783, 1772, 1783, 2583, 2583, 1783, 1784,
+    2583, 1784, 2584, 2584, 1784, 2585, 1774, 1785,
+    1775, 1775, 1785, 1786, 1775, 1786, 1776, 1776,
+    1786, 1787, 1776, 1787, 367, 367, 1787, 368,
+    338, 339, 1788, 338, 1788, 1777, 1777, 1788,
+    1789, 1777, 1789, 1778, 1778, 1789, 1790, 1778,
+    1790, 1779, 1779, 1790, 1791, 1779, 1791, 1780,
+    1780, 1791, 1792, 1780, 1792, 1781, 1781, 1792,
+    1793, 1781, 1793, 1782, 1782, 1793, 1794, 1782,
+    1794, 1783, 1783, 1794, 1795, 1783, 1795, 1784,
+    1784, 1795, 1796, 1784, 1796, 2585, 2585, 1796,
+    1797, 2585, 1797, 2586, 2586, 1797, 2587, 1786,
+    1798, 1787, 1787, 1798, 1799, 1787, 1799, 368,
+    368, 1799, 369, 339, 340, 1800, 339, 1800,
+    1788, 1788, 1800, 1801, 1788, 1801, 1789, 1789,
+    1801, 1802, 1789, 1802, 1790, 1790, 1802, 1803,
+    1790, 1803, 1791, 1791, 1803, 1804, 1791, 1804,
+    1792, 1792, 1804, 1805, 1792, 1805, 1793, 1793,
+    1805, 1806, 1793, 1806, 1794, 1794, 1806, 1807,
+    1794, 1807, 1795, 1795, 1807, 1808, 1795, 1808,
+    1796, 1796, 1808, 1809, 1796, 1809, 1797, 1797,
+    1809, 1810, 1797, 1810, 2587, 2587, 1810, 1811,
+    2587, 1811, 2588, 2588, 1811, 2589, 1799, 1812,
+    369, 369, 1812, 370, 340, 341, 1813, 340,
+    1813, 1800, 1800, 1813, 1814, 1800, 1814, 1801,
+    1801, 1814, 1815, 1801, 1815, 1802, 1802, 1815,
+    1816, 1802, 1816, 1803, 1803, 1816, 1817, 1803,
+    1817, 1804, 1804, 1817, 1818, 1804, 1818, 1805,
+    1805, 1818, 1819, 1805, 1819, 1806, 1806, 1819,
+    1820, 1806, 1820, 1807, 1807, 1820, 1821, 1807,
+    1821, 1808, 1808, 1821, 1822, 1808, 1822, 1809,
+    1809, 1822, 1823, 1809, 1823, 1810, 1810, 1823,
+    1824, 1810, 1824, 1811, 1811, 1824, 1825, 1811,
+    1825, 2589, 2589, 1825, 1826, 2589, 1826, 2590,
+    2590, 1826, 2591, 341, 6, 342, 341, 342,
+    1813, 1813, 342, 343, 1813, 343, 1814, 1814,
+    343, 344, 1814, 344, 1815, 1815, 344, 345,
+    1815, 345, 1816, 1816, 345, 346, 1816, 346,
+    1817, 1817, 346, 347, 1817, 347, 1818, 1818,
+    347, 348, 1818, 348, 1819, 1819, 348, 349,
+    1819, 349, 1820, 1820, 349, 350, 1820, 350,
+    1821, 1821, 350, 351, 1821, 351, 1822, 1822,
+    351, 352, 1822, 352, 1823, 1823, 352, 353,
+    1823, 353, 1824, 1824, 353, 354, 1824, 354,
+    1825, 1825, 354, 355, 1825, 355, 1826, 1826,
+    355, 356, 1826, 356, 2591, 2591, 356, 11,
+    11, 356, 387, 356, 355, 1827, 356, 1827,
+    387, 387, 1827, 388, 355, 354, 1828, 355,
+    1828, 1827, 1827, 1828, 1829, 1827, 1829, 388,
+    388, 1829, 389, 354, 353, 1830, 354, 1830,
+    1828, 1828, 1830, 1831, 1828, 1831, 1829, 1829,
+    1831, 1832, 1829, 1832, 389, 389, 1832, 390,
+    353, 352, 1833, 353, 1833, 1830, 1830, 1833,
+    1834, 1830, 1834, 1831, 1831, 1834, 1835, 1831,
+    1835, 1832, 1832, 1835, 1836, 1832, 1836, 390,
+    390, 1836, 391, 352, 351, 1837, 352, 1837,
+    1833, 1833, 1837, 1838, 1833, 1838, 1834, 1834,
+    1838, 1839, 1834, 1839, 1835, 1835, 1839, 1840,
+    1835, 1840, 1836, 1836, 1840, 1841, 1836, 1841,
+    391, 391, 1841, 392, 351, 350, 1842, 351,
+    1842, 1837, 1837, 1842, 1843, 1837, 1843, 1838,
+    1838, 1843, 1844, 1838, 1844, 1839, 1839, 1844,
+    1845, 1839, 1845, 1840, 1840, 1845, 1846, 1840,
+    1846, 1841, 1841, 1846, 1847, 1841, 1847, 392,
+    392, 1847, 393, 350, 349, 1848, 350, 1848,
+    1842, 1842, 1848, 1849, 1842, 1849, 1843, 1843,
+    1849, 1850, 1843, 1850, 1844, 1844, 1850, 1851,
+    1844, 1851, 1845, 1845, 1851, 1852, 1845, 1852,
+    1846, 1846, 1852, 1853, 1846, 1853, 1847, 1847,
+    1853, 1854, 1847, 1854, 393, 393, 1854, 394,
+    349, 348, 1855, 349, 1855, 1848, 1848, 1855,
+    1856, 1848, 1856, 1849, 1849, 1856, 1857, 1849,
+    1857, 1850, 1850, 1857, 1858, 1850, 1858, 1851,
+    1851, 1858, 1859, 1851, 1859, 1852, 1852, 1859,
+    1860, 1852, 1860, 1853, 1853, 1860, 1861, 1853,
+    1861, 1854, 1854, 1861, 1862, 1854, 1862, 394,
+    394, 1862, 395, 348, 347, 1863, 348, 1863,
+    1855, 1855, 1863, 1864, 1855, 1864, 1856, 1856,
+    1864, 1865, 1856, 1865, 1857, 1857, 1865, 1866,
+    1857, 1866, 1858, 1858, 1866, 1867, 1858, 1867,
+    1859, 1859, 1867, 1868, 1859, 1868, 1860, 1860,
+    1868, 1869, 1860, 1869, 1861, 1861, 1869, 1870,
+    1861, 1870, 1862, 1862, 1870, 1871, 1862, 1871,
+    395, 395, 1871, 396, 347, 346, 1872, 347,
+    1872, 1863, 1863, 1872, 1873, 1863, 1873, 1864,
+    1864, 1873, 1874, 1864, 1874, 1865, 1865, 1874,
+    1875, 1865, 1875, 1866, 1866, 1875, 1876, 1866,
+    1876, 1867, 1867, 1876, 1877, 1867, 1877, 1868,
+    1868, 1877, 1878, 1868, 1878, 1869, 1869, 1878,
+    1879, 1869, 1879, 1870, 1870, 1879, 1880, 1870,
+    1880, 1871, 1871, 1880, 1881, 1871, 1881, 396,
+    396, 1881, 397, 346, 345, 1882, 346, 1882,
+    1872, 1872, 1882, 1883, 1872, 1883, 1873, 1873,
+    1883, 1884, 1873, 1884, 1874, 1874, 1884, 1885,
+    1874, 1885, 1875, 1875, 1885, 1886, 1875, 1886,
+    1876, 1876, 1886, 1887, 1876, 1887, 1877, 1877,
+    1887, 1888, 1877, 1888, 1878, 1878, 1888, 1889,
+    1878, 1889, 1879, 1879, 1889, 1890, 1879, 1890,
+    1880, 1880, 1890, 1891, 1880, 1891, 1881, 1881,
+    1891, 1892, 1881, 1892, 397, 397, 1892, 398,
+    345, 344, 1893, 345, 1893, 1882, 1882, 1893,
+    1894, 1882, 1894, 1883, 1883, 1894, 1895, 1883,
+    1895, 1884, 1884, 1895, 1896, 1884, 1896, 1885,
+    1885, 1896, 1897, 1885, 1897, 1886, 1886, 1897,
+    1898, 1886, 1898, 1887, 1887, 1898, 1899, 1887,
+    1899, 1888, 1888, 1899, 1900, 1888, 1900, 1889,
+    1889, 1900, 1901, 1889, 1901, 1890, 1890, 1901,
+    1902, 1890, 1902, 1891, 1891, 1902, 1903, 1891,
+    1903, 1892, 1892, 1903, 1904, 1892, 1904, 398,
+    398, 1904, 399, 344, 343, 1905, 344, 1905,
+    1893, 1893, 1905, 1906, 1893, 1906, 1894, 1894,
+    1906, 1907, 1894, 1907, 1895, 1895, 1907, 1908,
+    1895, 1908, 1896, 1896, 1908, 1909, 1896, 1909,
+    1897, 1897, 1909, 1910, 1897, 1910, 1898, 1898,
+    1910, 1911, 1898, 1911, 1899, 1899, 1911, 1912,
+    1899, 1912, 1900, 1900, 1912, 1913, 1900, 1913,
+    1901, 1901, 1913, 1914, 1901, 1914, 1902, 1902,
+    1914, 1915, 1902, 1915, 1903, 1903, 1915, 1916,
+    1903, 1916, 1904, 1904, 1916, 1917, 1904, 1917,
+    399, 399, 1917, 400, 343, 342, 1918, 343,
+    1918, 1905, 1905, 1918, 1919, 1905, 1919, 1906,
+    1906, 1919, 1920, 1906, 1920, 1907, 1907, 1920,
+    1921, 1907, 1921, 1908, 1908, 1921, 1922, 1908,
+    1922, 1909, 1909, 1922, 1923, 1909, 1923, 1910,
+    1910, 1923, 1924, 1910, 1924, 1911, 1911, 1924,
+    1925, 1911, 1925, 1912, 1912, 1925, 1926, 1912,
+    1926, 1913, 1913, 1926, 1927, 1913, 1927, 1914,
+    1914, 1927, 1928, 1914, 1928, 1915, 1915, 1928,
+    1929, 1915, 1929, 1916, 1916, 1929, 1930, 1916,
+    1930, 1917, 1917, 1930, 1931, 1917, 1931, 400,
+    400, 1931, 401, 342, 6, 372, 342, 372,
+    1918, 1918, 372, 373, 1918, 373, 1919, 1919,
+    373, 374, 1919, 374, 1920, 1920, 374, 375,
+    1920, 375, 1921, 1921, 375, 376, 1921, 376,
+    1922, 1922, 376, 377, 1922, 377, 1923, 1923,
+    377, 378, 1923, 378, 1924, 1924, 378, 379,
+    1924, 379, 1925, 1925, 379, 380, 1925, 380,
+    1926, 1926, 380, 381, 1926, 381, 1927, 1927,
+    381, 382, 1927, 382, 1928, 1928, 382, 383,
+    1928, 383, 1929, 1929, 383, 384, 1929, 384,
+    1930, 1930, 384, 385, 1930, 385, 1931, 1931,
+    385, 386, 1931, 386, 401, 401, 386, 0,
+    0, 386, 12, 386, 385, 1932, 386, 1932,
+    12, 12, 1932, 13, 385, 384, 1933, 385,
+    1933, 1932, 1932, 1933, 1934, 1932, 1934, 13,
+    13, 1934, 14, 384, 383, 1935, 384, 1935,
+    1933, 1933, 1935, 1936, 1933, 1936, 1934, 1934,
+    1936, 1937, 1934, 1937, 14, 14, 1937, 15,
+    383, 382, 1938, 383, 1938, 1935, 1935, 1938,
+    1939, 1935, 1939, 1936, 1936, 1939, 1940, 1936,
+    1940, 1937, 1937, 1940, 1941, 1937, 1941, 15,
+    15, 1941, 16, 382, 381, 1942, 382, 1942,
+    1938, 1938, 1942, 1943, 1938, 1943, 1939, 1939,
+    1943, 1944, 1939, 1944, 1940, 1940, 1944, 1945,
+    1940, 1945, 1941, 1941, 1945, 1946, 1941, 1946,
+    16, 16, 1946, 17, 381, 380, 1947, 381,
+    1947, 1942, 1942, 1947, 1948, 1942, 1948, 1943,
+    1943, 1948, 1949, 1943, 1949, 1944, 1944, 1949,
+    1950, 1944, 1950, 1945, 1945, 1950, 1951, 1945,
+    1951, 1946, 1946, 1951, 1952, 1946, 1952, 17,
+    17, 1952, 18, 380, 379, 1953, 380, 1953,
+    1947, 1947, 1953, 1954, 1947, 1954, 1948, 1948,
+    1954, 1955, 1948, 1955, 1949, 1949, 1955, 1956,
+    1949, 1956, 1950, 1950, 1956, 1957, 1950, 1957,
+    1951, 1951, 1957, 1958, 1951, 1958, 1952, 1952,
+    1958, 1959, 1952, 1959, 18, 18, 1959, 19,
+    379, 378, 1960, 379, 1960, 1953, 1953, 1960,
+    1961, 1953, 1961, 1954, 1954, 1961, 1962, 1954,
+    1962, 1955, 1955, 1962, 1963, 1955, 1963, 1956,
+    1956, 1963, 1964, 1956, 1964, 1957, 1957, 1964,
+    1965, 1957, 1965, 1958, 1958, 1965, 1966, 1958,
+    1966, 1959, 1959, 1966, 1967, 1959, 1967, 19,
+    19, 1967, 20, 378, 377, 1968, 378, 1968,
+    1960, 1960, 1968, 1969, 1960, 1969, 1961, 1961,
+    1969, 1970, 1961, 1970, 1962, 1962, 1970, 1971,
+    1962, 1971, 1963, 1963, 1971, 1972, 1963, 1972,
+    1964, 1964, 1972, 1973, 1964, 1973, 1965, 1965,
+    1973, 1974, 1965, 1974, 1966, 1966, 1974, 1975,
+    1966, 1975, 1967, 1967, 1975, 1976, 1967, 1976,
+    20, 20, 1976, 21, 377, 376, 1977, 377,
+    1977, 1968, 1968, 1977, 1978, 1968, 1978, 1969,
+    1969, 1978, 1979, 1969, 1979, 1970, 1970, 1979,
+    1980, 1970, 1980, 1971, 1971, 1980, 1981, 1971,
+    1981, 1972, 1972, 1981, 1982, 1972, 1982, 1973,
+    1973, 1982, 1983, 1973, 1983, 1974, 1974, 1983,
+    1984, 1974, 1984, 1975, 1975, 1984, 1985, 1975,
+    1985, 1976, 1976, 1985, 1986, 1976, 1986, 21,
+    21, 1986, 22, 376, 375, 1987, 376, 1987,
+    1977, 1977, 1987, 1988, 1977, 1988, 1978, 1978,
+    1988, 1989, 1978, 1989, 1979, 1979, 1989, 1990,
+    1979, 1990, 1980, 1980, 1990, 1991, 1980, 1991,
+    1981, 1981, 1991, 1992, 1981, 1992, 1982, 1982,
+    1992, 1993, 1982, 1993, 1983, 1983, 1993, 1994,
+    1983, 1994, 1984, 1984, 1994, 1995, 1984, 1995,
+    1985, 1985, 1995, 1996, 1985, 1996, 1986, 1986,
+    1996, 1997, 1986, 1997, 22, 22, 1997, 23,
+    375, 374, 1998, 375, 1998, 1987, 1987, 1998,
+    1999, 1987, 1999, 1988, 1988, 1999, 2000, 1988,
+    2000, 1989, 1989, 2000, 2001, 1989, 2001, 1990,
+    1990, 2001, 2002, 1990, 2002, 1991, 1991, 2002,
+    2003, 1991, 2003, 1992, 1992, 2003, 2004, 1992,
+    2004, 1993, 1993, 2004, 2005, 1993, 2005, 1994,
+    1994, 2005, 2006, 1994, 2006, 1995, 1995, 2006,
+    2007, 1995, 2007, 1996, 1996, 2007, 2008, 1996,
+    2008, 1997, 1997, 2008, 2009, 1997, 2009, 23,
+    23, 2009, 24, 374, 373, 2010, 374, 2010,
+    1998, 1998, 2010, 2011, 1998, 2011, 1999, 1999,
+    2011, 2012, 1999, 2012, 2000, 2000, 2012, 2013,
+    2000, 2013, 2001, 2001, 2013, 2014, 2001, 2014,
+    2002, 2002, 2014, 2015, 2002, 2015, 2003, 2003,
+    2015, 2016, 2003, 2016, 2004, 2004, 2016, 2017,
+    2004, 2017, 2005, 2005, 2017, 2018, 2005, 2018,
+    2006, 2006, 2018, 2019, 2006, 2019, 2007, 2007,
+    2019, 2020, 2007, 2020, 2008, 2008, 2020, 2021,
+    2008, 2021, 2009, 2009, 2021, 2022, 2009, 2022,
+    24, 24, 2022, 25, 373, 372, 2023, 373,
+    2023, 2010, 2010, 2023, 2024, 2010, 2024, 2011,
+    2011, 2024, 2025, 2011, 2025, 2012, 2012, 2025,
+    2026, 2012, 2026, 2013, 2013, 2026, 2027, 2013,
+    2027, 2014, 2014, 2027, 2028, 2014, 2028, 2015,
+    2015, 2028, 2029, 2015, 2029, 2016, 2016, 2029,
+    2030, 2016, 2030, 2017, 2017, 2030, 2031, 2017,
+    2031, 2018, 2018, 2031, 2032, 2018, 2032, 2019,
+    2019, 2032, 2033, 2019, 2033, 2020, 2020, 2033,
+    2034, 2020, 2034, 2021, 2021, 2034, 2035, 2021,
+    2035, 2022, 2022, 2035, 2036, 2022, 2036, 25,
+    25, 2036, 26, 372, 6, 402, 372, 402,
+    2023, 2023, 402, 403, 2023, 403, 2024, 2024,
+    403, 404, 2024, 404, 2025, 2025, 404, 405,
+    2025, 405, 2026, 2026, 405, 406, 2026, 406,
+    2027, 2027, 406, 407, 2027, 407, 2028, 2028,
+    407, 408, 2028, 408, 2029, 2029, 408, 409,
+    2029, 409, 2030, 2030, 409, 410, 2030, 410,
+    2031, 2031, 410, 411, 2031, 411, 2032, 2032,
+    411, 412, 2032, 412, 2033, 2033, 412, 413,
+    2033, 413, 2034, 2034, 413, 414, 2034, 414,
+    2035, 2035, 414, 415, 2035, 415, 2036, 2036,
+    415, 416, 2036, 416, 26, 26, 416, 1,
+    6, 326, 402, 326, 325, 2037, 326, 2037,
+    402, 402, 2037, 403, 325, 324, 2038, 325,
+    2038, 2037, 2037, 2038, 2039, 2037, 2039, 403,
+    403, 2039, 404, 324, 323, 2040, 324, 2040,
+    2038, 2038, 2040, 2041, 2038, 2041, 2039, 2039,
+    2041, 2042, 2039, 2042, 404, 404, 2042, 405,
+    323, 322, 2043, 323, 2043, 2040, 2040, 2043,
+    2044, 2040, 2044, 2041, 2041, 2044, 2045, 2041,
+    2045, 2042, 2042, 2045, 2046, 2042, 2046, 405,
+    405, 2046, 406, 322, 321, 2047, 322, 2047,
+    2043, 2043, 2047, 2048, 2043, 2048, 2044, 2044,
+    2048, 2049, 2044, 2049, 2045, 2045, 2049, 2050,
+    2045, 2050, 2046, 2046, 2050, 2051, 2046, 2051,
+    406, 406, 2051, 407, 321, 320, 2052, 321,
+    2052, 2047, 2047, 2052, 2053, 2047, 2053, 2048,
+    2048, 2053, 2054, 2048, 2054, 2049, 2049, 2054,
+    2055, 2049, 2055, 2050, 2050, 2055, 2056, 2050,
+    2056, 2051, 2051, 2056, 2057, 2051, 2057, 407,
+    407, 2057, 408, 320, 319, 2058, 320, 2058,
+    2052, 2052, 2058, 2059, 2052, 2059, 2053, 2053,
+    2059, 2060, 2053, 2060, 2054, 2054, 2060, 2061,
+    2054, 2061, 2055, 2055, 2061, 2062, 2055, 2062,
+    2056, 2056, 2062, 2063, 2056, 2063, 2057, 2057,
+    2063, 2064, 2057, 2064, 408, 408, 2064, 409,
+    319, 318, 2065, 319, 2065, 2058, 2058, 2065,
+    2066, 2058, 2066, 2059, 2059, 2066, 2067, 2059,
+    2067, 2060, 2060, 2067, 2068, 2060, 2068, 2061,
+    2061, 2068, 2069, 2061, 2069, 2062, 2062, 2069,
+    2070, 2062, 2070, 2063, 2063, 2070, 2071, 2063,
+    2071, 2064, 2064, 2071, 2072, 2064, 2072, 409,
+    409, 2072, 410, 318, 317, 2073, 318, 2073,
+    2065, 2065, 2073, 2074, 2065, 2074, 2066, 2066,
+    2074, 2075, 2066, 2075, 2067, 2067, 2075, 2076,
+    2067, 2076, 2068, 2068, 2076, 2077, 2068, 2077,
+    2069, 2069, 2077, 2078, 2069, 2078, 2070, 2070,
+    2078, 2079, 2070, 2079, 2071, 2071, 2079, 2080,
+    2071, 2080, 2072, 2072, 2080, 2081, 2072, 2081,
+    410, 410, 2081, 411, 317, 316, 2082, 317,
+    2082, 2073, 2073, 2082, 2083, 2073, 2083, 2074,
+    2074, 2083, 2084, 2074, 2084, 2075, 2075, 2084,
+    2085, 2075, 2085, 2076, 2076, 2085, 2086, 2076,
+    2086, 2077, 2077, 2086, 2087, 2077, 2087, 2078,
+    2078, 2087, 2088, 2078, 2088, 2079, 2079, 2088,
+    2089, 2079, 2089, 2080, 2080, 2089, 2090, 2080,
+    2090, 2081, 2081, 2090, 2091, 2081, 2091, 411,
+    411, 2091, 412, 316, 315, 2092, 316, 2092,
+    2082, 2082, 2092, 2093, 2082, 2093, 2083, 2083,
+    2093, 2094, 2083, 2094, 2084, 2084, 2094, 2095,
+    2084, 2095, 2085, 2085, 2095, 2096, 2085, 2096,
+    2086, 2086, 2096, 2097, 2086, 2097, 2087, 2087,
+    2097, 2098, 2087, 2098, 2088, 2088, 2098, 2099,
+    2088, 2099, 2089, 2089, 2099, 2100, 2089, 2100,
+    2090, 2090, 2100, 2101, 2090, 2101, 2091, 2091,
+    2101, 2102, 2091, 2102, 412, 412, 2102, 413,
+    315, 314, 2103, 315, 2103, 2092, 2092, 2103,
+    2104, 2092, 2104, 2093, 2093, 2104, 2105, 2093,
+    2105, 2094, 2094, 2105, 2106, 2094, 2106, 2095,
+    2095, 2106, 2107, 2095, 2107, 2096, 2096, 2107,
+    2108, 2096, 2108, 2097, 2097, 2108, 2109, 2097,
+    2109, 2098, 2098, 2109, 2110, 2098, 2110, 2099,
+    2099, 2110, 2111, 2099, 2111, 2100, 2100, 2111,
+    2112, 2100, 2112, 2101, 2101, 2112, 2113, 2101,
+    2113, 2102, 2102, 2113, 2114, 2102, 2114, 413,
+    413, 2114, 414, 314, 313, 2115, 314, 2115,
+    2103, 2103, 2115, 2116, 2103, 2116, 2104, 2104,
+    2116, 2117, 2104, 2117, 2105, 2105, 2117, 2118,
+    2105, 2118, 2106, 2106, 2118, 2119, 2106, 2119,
+    2107, 2107, 2119, 2120, 2107, 2120, 2108, 2108,
+    2120, 2121, 2108, 2121, 2109, 2109, 2121, 2122,
+    2109, 2122, 2110, 2110, 2122, 2123, 2110, 2123,
+    2111, 2111, 2123, 2124, 2111, 2124, 2112, 2112,
+    2124, 2125, 2112, 2125, 2113, 2113, 2125, 2126,
+    2113, 2126, 2114, 2114, 2126, 2127, 2114, 2127,
+    414, 414, 2127, 415, 313, 312, 2128, 313,
+    2128, 2115, 2115, 2128, 2129, 2115, 2129, 2116,
+    2116, 2129, 2130, 2116, 2130, 2117, 2117, 2130,
+    2131, 2117, 2131, 2118, 2118, 2131, 2132, 2118,
+    2132, 2119, 2119, 2132, 2133, 2119, 2133, 2120,
+    2120, 2133, 2134, 2120, 2134, 2121, 2121, 2134,
+    2135, 2121, 2135, 2122, 2122, 2135, 2136, 2122,
+    2136, 2123, 2123, 2136, 2137, 2123, 2137, 2124,
+    2124, 2137, 2138, 2124, 2138, 2125, 2125, 2138,
+    2139, 2125, 2139, 2126, 2126, 2139, 2140, 2126,
+    2140, 2127, 2127, 2140, 2141, 2127, 2141, 415,
+    415, 2141, 416, 312, 10, 176, 312, 176,
+    2128, 2128, 176, 175, 2128, 175, 2129, 2129,
+    175, 174, 2129, 174, 2130, 2130, 174, 173,
+    2130, 173, 2131, 2131, 173, 172, 2131, 172,
+    2132, 2132, 172, 171, 2132, 171, 2133, 2133,
+    171, 170, 2133, 170, 2134, 2134, 170, 169,
+    2134, 169, 2135, 2135, 169, 168, 2135, 168,
+    2136, 2136, 168, 167, 2136, 167, 2137, 2137,
+    167, 166, 2137, 166, 2138, 2138, 166, 165,
+    2138, 165, 2139, 2139, 165, 164, 2139, 164,
+    2140, 2140, 164, 163, 2140, 163, 2141, 2141,
+    163, 162, 2141, 162, 416, 416, 162, 1,
+    9, 417, 86, 417, 418, 2142, 417, 2142,
+    86, 86, 2142, 85, 418, 419, 2143, 418,
+    2143, 2142, 2142, 2143, 2144, 2142, 2144, 85,
+    85, 2144, 84, 419, 420, 2145, 419, 2145,
+    2143, 2143, 2145, 2146, 2143, 2146, 2144, 2144,
+    2146, 2147, 2144, 2147, 84, 84, 2147, 83,
+    420, 421, 2148, 420, 2148, 2145, 2145, 2148,
+    2149, 2145, 2149, 2146, 2146, 2149, 2150, 2146,
+    2150, 2147, 2147, 2150, 2151, 2147, 2151, 83,
+    83, 2151, 82, 421, 422, 2152, 421, 2152,
+    2148, 2148, 2152, 2153, 2148, 2153, 2149, 2149,
+    2153, 2154, 2149, 2154, 2150, 2150, 2154, 2155,
+    2150, 2155, 2151, 2151, 2155, 2156, 2151, 2156,
+    82, 82, 2156, 81, 422, 423, 2157, 422,
+    2157, 2152, 2152, 2157, 2158, 2152, 2158, 2153,
+    2153, 2158, 2159, 2153, 2159, 2154, 2154, 2159,
+    2160, 2154, 2160, 2155, 2155, 2160, 2161, 2155,
+    2161, 2156, 2156, 2161, 2162, 2156, 2162, 81,
+    81, 2162, 80, 423, 424, 2163, 423, 2163,
+    2157, 2157, 2163, 2164, 2157, 2164, 2158, 2158,
+    2164, 2165, 2158, 2165, 2159, 2159, 2165, 2166,
+    2159, 2166, 2160, 2160, 2166, 2167, 2160, 2167,
+    2161, 2161, 2167, 2168, 2161, 2168, 2162, 2162,
+    2168, 2169, 2162, 2169, 80, 80, 2169, 79,
+    424, 425, 2170, 424, 2170, 2163, 2163, 2170,
+    2171, 2163, 2171, 2164, 2164, 2171, 2172, 2164,
+    2172, 2165, 2165, 2172, 2173, 2165, 2173, 2166,
+    2166, 2173, 2174, 2166, 2174, 2167, 2167, 2174,
+    2175, 2167, 2175, 2168, 2168, 2175, 2176, 2168,
+    2176, 2169, 2169, 2176, 2177, 2169, 2177, 79,
+    79, 2177, 78, 425, 426, 2178, 425, 2178,
+    2170, 2170, 2178, 2179, 2170, 2179, 2171, 2171,
+    2179, 2180, 2171, 2180, 2172, 2172, 2180, 2181,
+    2172, 2181, 2173, 2173, 2181, 2182, 2173, 2182,
+    2174, 2174, 2182, 2183, 2174, 2183, 2175, 2175,
+    2183, 2184, 2175, 2184, 2176, 2176, 2184, 2185,
+    2176, 2185, 2177, 2177, 2185, 2186, 2177, 2186,
+    78, 78, 2186, 77, 426, 427, 2187, 426,
+    2187, 2178, 2178, 2187, 2188, 2178, 2188, 2179,
+    2179, 2188, 2189, 2179, 2189, 2180, 2180, 2189,
+    2190, 2180, 2190, 2181, 2181, 2190, 2191, 2181,
+    2191, 2182, 2182, 2191, 2192, 2182, 2192, 2183,
+    2183, 2192, 2193, 2183, 2193, 2184, 2184, 2193,
+    2194, 2184, 2194, 2185, 2185, 2194, 2195, 2185,
+    2195, 2186, 2186, 2195, 2196, 2186, 2196, 77,
+    77, 2196, 76, 427, 428, 2197, 427, 2197,
+    2187, 2187, 2197, 2198, 2187, 2198, 2188, 2188,
+    2198, 2199, 2188, 2199, 2189, 2189, 2199, 2200,
+    2189, 2200, 2190, 2190, 2200, 2201, 2190, 2201,
+    2191, 2191, 2201, 2202, 2191, 2202, 2192, 2192,
+    2202, 2203, 2192, 2203, 2193, 2193, 2203, 2204,
+    2193, 2204, 2194, 2194, 2204, 2205, 2194, 2205,
+    2195, 2195, 2205, 2206, 2195, 2206, 2196, 2196,
+    2206, 2207, 2196, 2207, 76, 76, 2207, 75,
+    428, 429, 2208, 428, 2208, 2197, 2197, 2208,
+    2209, 2197, 2209, 2198, 2198, 2209, 2210, 2198,
+    2210, 2199, 2199, 2210, 2211, 2199, 2211, 2200,
+    2200, 2211, 2212, 2200, 2212, 2201, 2201, 2212,
+    2213, 2201, 2213, 2202, 2202, 2213, 2214, 2202,
+    2214, 2203, 2203, 2214, 2215, 2203, 2215, 2204,
+    2204, 2215, 2216, 2204, 2216, 2205, 2205, 2216,
+    2217, 2205, 2217, 2206, 2206, 2217, 2218, 2206,
+    2218, 2207, 2207, 2218, 2219, 2207, 2219, 75,
+    75, 2219, 74, 429, 430, 2220, 429, 2220,
+    2208, 2208, 2220, 2221, 2208, 2221, 2209, 2209,
+    2221, 2222, 2209, 2222, 2210, 2210, 2222, 2223,
+    2210, 2223, 2211, 2211, 2223, 2224, 2211, 2224,
+    2212, 2212, 2224, 2225, 2212, 2225, 2213, 2213,
+    2225, 2226, 2213, 2226, 2214, 2214, 2226, 2227,
+    2214, 2227, 2215, 2215, 2227, 2228, 2215, 2228,
+    2216, 2216, 2228, 2229, 2216, 2229, 2217, 2217,
+    2229, 2230, 2217, 2230, 2218, 2218, 2230, 2231,
+    2218, 2231, 2219, 2219, 2231, 2232, 2219, 2232,
+    74, 74, 2232, 73, 430, 431, 2233, 430,
+    2233, 2220, 2220, 2233, 2234, 2220, 2234, 2221,
+    2221, 2234, 2235, 2221, 2235, 2222, 2222, 2235,
+    2236, 2222, 2236, 2223, 2223, 2236, 2237, 2223,
+    2237, 2224, 2224, 2237, 2238, 2224, 2238, 2225,
+    2225, 2238, 2239, 2225, 2239, 2226, 2226, 2239,
+    2240, 2226, 2240, 2227, 2227, 2240, 2241, 2227,
+    2241, 2228, 2228, 2241, 2242, 2228, 2242, 2229,
+    2229, 2242, 2243, 2229, 2243, 2230, 2230, 2243,
+    2244, 2230, 2244, 2231, 2231, 2244, 2245, 2231,
+    2245, 2232, 2232, 2245, 2246, 2232, 2246, 73,
+    73, 2246, 72, 431, 11, 387, 431, 387,
+    2233, 2233, 387, 388, 2233, 388, 2234, 2234,
+    388, 389, 2234, 389, 2235, 2235, 389, 390,
+    2235, 390, 2236, 2236, 390, 391, 2236, 391,
+    2237, 2237, 391, 392, 2237, 392, 2238, 2238,
+    392, 393, 2238, 393, 2239, 2239, 393, 394,
+    2239, 394, 2240, 2240, 394, 395, 2240, 395,
+    2241, 2241, 395, 396, 2241, 396, 2242, 2242,
+    396, 397, 2242, 397, 2243, 2243, 397, 398,
+    2243, 398, 2244, 2244, 398, 399, 2244, 399,
+    2245, 2245, 399, 400, 2245, 400, 2246, 2246,
+    400, 401, 2246, 401, 72, 72, 401, 0,
+    9, 2592, 417, 432, 433, 2247, 2592, 2593,
+    417, 417, 2593, 418, 433, 434, 2248, 433,
+    2248, 2247, 2247, 2248, 2249, 2593, 2594, 418,
+    418, 2594, 419, 434, 435, 2250, 434, 2250,
+    2248, 2248, 2250, 2251, 2248, 2251, 2249, 2249,
+    2251, 2252, 2594, 2595, 419, 419, 2595, 420,
+    435, 436, 2253, 435, 2253, 2250, 2250, 2253,
+    2254, 2250, 2254, 2251, 2251, 2254, 2255, 2251,
+    2255, 2252, 2252, 2255, 2256, 2595, 2596, 420,
+    420, 2596, 421, 436, 437, 2257, 436, 2257,
+    2253, 2253, 2257, 2258, 2253, 2258, 2254, 2254,
+    2258, 2259, 2254, 2259, 2255, 2255, 2259, 2260,
+    2255, 2260, 2256, 2256, 2260, 2261, 2596, 2597,
+    421, 421, 2597, 422, 437, 438, 2262, 437,
+    2262, 2257, 2257, 2262, 2263, 2257, 2263, 2258,
+    2258, 2263, 2264, 2258, 2264, 2259, 2259, 2264,
+    2265, 2259, 2265, 2260, 2260, 2265, 2266, 2260,
+    2266, 2261, 2261, 2266, 2267, 2597, 2598, 422,
+    422, 2598, 423, 438, 439, 2268, 438, 2268,
+    2262, 2262, 2268, 2269, 2262, 2269, 2263, 2263,
+    2269, 2270, 2263, 2270, 2264, 2264, 2270, 2271,
+    2264, 2271, 2265, 2265, 2271, 2272, 2265, 2272,
+    2266, 2266, 2272, 2273, 2266, 2273, 2267, 2267,
+    2273, 2274, 2598, 2599, 423, 423, 2599, 424,
+    439, 440, 2275, 439, 2275, 2268, 2268, 2275,
+    2276, 2268, 2276, 2269, 2269, 2276, 2277, 2269,
+    2277, 2270, 2270, 2277, 2278, 2270, 2278, 2271,
+    2271, 2278, 2279, 2271, 2279, 2272, 2272, 2279,
+    2280, 2272, 2280, 2273, 2273, 2280, 2281, 2273,
+    2281, 2274, 2274, 2281, 2282, 2599, 2600, 424,
+    424, 2600, 425, 440, 441, 2283, 440, 2283,
+    2275, 2275, 2283, 2284, 2275, 2284, 2276, 2276,
+    2284, 2285, 2276, 2285, 2277, 2277, 2285, 2286,
+    2277, 2286, 2278, 2278, 2286, 2287, 2278, 2287,
+    2279, 2279, 2287, 2288, 2279, 2288, 2280, 2280,
+    2288, 2289, 2280, 2289, 2281, 2281, 2289, 2290,
+    2281, 2290, 2282, 2282, 2290, 2291, 2600, 2601,
+    425, 425, 2601, 426, 441, 442, 2292, 441,
+    2292, 2283, 2283, 2292, 2293, 2283, 2293, 2284,
+    2284, 2293, 2294, 2284, 2294, 2285, 2285, 2294,
+    2295, 2285, 2295, 2286, 2286, 2295, 2296, 2286,
+    2296, 2287, 2287, 2296, 2297, 2287, 2297, 2288,
+    2288, 2297, 2298, 2288, 2298, 2289, 2289, 2298,
+    2299, 2289, 2299, 2290, 2290, 2299, 2300, 2290,
+    2300, 2291, 2291, 2300, 2301, 2601, 2602, 426,
+    426, 2602, 427, 442, 443, 2302, 442, 2302,
+    2292, 2292, 2302, 2303, 2292, 2303, 2293, 2293,
+    2303, 2304, 2293, 2304, 2294, 2294, 2304, 2305,
+    2294, 2305, 2295, 2295, 2305, 2306, 2295, 2306,
+    2296, 2296, 2306, 2307, 2296, 2307, 2297, 2297,
+    2307, 2308, 2297, 2308, 2298, 2298, 2308, 2309,
+    2298, 2309, 2299, 2299, 2309, 2310, 2299, 2310,
+    2300, 2300, 2310, 2311, 2300, 2311, 2301, 2301,
+    2311, 2312, 2602, 2603, 427, 427, 2603, 428,
+    443, 444, 2313, 443, 2313, 2302, 2302, 2313,
+    2314, 2302, 2314, 2303, 2303, 2314, 2315, 2303,
+    2315, 2304, 2304, 2315, 2316, 2304, 2316, 2305,
+    2305, 2316, 2317, 2305, 2317, 2306, 2306, 2317,
+    2318, 2306, 2318, 2307, 2307, 2318, 2319, 2307,
+    2319, 2308, 2308, 2319, 2320, 2308, 2320, 2309,
+    2309, 2320, 2321, 2309, 2321, 2310, 2310, 2321,
+    2322, 2310, 2322, 2311, 2311, 2322, 2323, 2311,
+    2323, 2312, 2312, 2323, 2324, 2603, 2604, 428,
+    428, 2604, 429, 444, 445, 2325, 444, 2325,
+    2313, 2313, 2325, 2326, 2313, 2326, 2314, 2314,
+    2326, 2327, 2314, 2327, 2315, 2315, 2327, 2328,
+    2315, 2328, 2316, 2316, 2328, 2329, 2316, 2329,
+    2317, 2317, 2329, 2330, 2317, 2330, 2318, 2318,
+    2330, 2331, 2318, 2331, 2319, 2319, 2331, 2332,
+    2319, 2332, 2320, 2320, 2332, 2333, 2320, 2333,
+    2321, 2321, 2333, 2334, 2321, 2334, 2322, 2322,
+    2334, 2335, 2322, 2335, 2323, 2323, 2335, 2336,
+    2323, 2336, 2324, 2324, 2336, 2337, 2604, 2605,
+    429, 429, 2605, 430, 445, 446, 2338, 445,
+    2338, 2325, 2325, 2338, 2339, 2325, 2339, 2326,
+    2326, 2339, 2340, 2326, 2340, 2327, 2327, 2340,
+    2341, 2327, 2341, 2328, 2328, 2341, 2342, 2328,
+    2342, 2329, 2329, 2342, 2343, 2329, 2343, 2330,
+    2330, 2343, 2344, 2330, 2344, 2331, 2331, 2344,
+    2345, 2331, 2345, 2332, 2332, 2345, 2346, 2332,
+    2346, 2333, 2333, 2346, 2347, 2333, 2347, 2334,
+    2334, 2347, 2348, 2334, 2348, 2335, 2335, 2348,
+    2349, 2335, 2349, 2336, 2336, 2349, 2350, 2336,
+    2350, 2337, 2337, 2350, 2351, 2605, 2606, 430,
+    430, 2606, 431, 446, 2, 447, 446, 447,
+    2338, 2338, 447, 448, 2338, 448, 2339, 2339,
+    448, 449, 2339, 449, 2340, 2340, 449, 450,
+    2340, 450, 2341, 2341, 450, 451, 2341, 451,
+    2342, 2342, 451, 452, 2342, 452, 2343, 2343,
+    452, 453, 2343, 453, 2344, 2344, 453, 454,
+    2344, 454, 2345, 2345, 454, 455, 2345, 455,
+    2346, 2346, 455, 456, 2346, 456, 2347, 2347,
+    456, 457, 2347, 457, 2348, 2348, 457, 458,
+    2348, 458, 2349, 2349, 458, 459, 2349, 459,
+    2350, 2350, 459, 460, 2350, 460, 2351, 2351,
+    460, 461, 2606, 2607, 431, 431, 2607, 11,
+    9, 2562, 2592, 102, 103, 2352, 102, 2352,
+    432, 432, 2352, 433, 103, 104, 2353, 103,
+    2353, 2352, 2352, 2353, 2354, 2352, 2354, 433,
+    433, 2354, 434, 104, 105, 2355, 104, 2355,
+    2353, 2353, 2355, 2356, 2353, 2356, 2354, 2354,
+    2356, 2357, 2354, 2357, 434, 434, 2357, 435,
+    105, 106, 2358, 105, 2358, 2355, 2355, 2358,
+    2359, 2355, 2359, 2356, 2356, 2359, 2360, 2356,
+    2360, 2357, 2357, 2360, 2361, 2357, 2361, 435,
+    435, 2361, 436, 106, 107, 2362, 106, 2362,
+    2358, 2358, 2362, 2363, 2358, 2363, 2359, 2359,
+    2363, 2364, 2359, 2364, 2360, 2360, 2364, 2365,
+    2360, 2365, 2361, 2361, 2365, 2366, 2361, 2366,
+    436, 436, 2366, 437, 107, 108, 2367, 107,
+    2367, 2362, 2362, 2367, 2368, 2362, 2368, 2363,
+    2363, 2368, 2369, 2363, 2369, 2364, 2364, 2369,
+    2370, 2364, 2370, 2365, 2365, 2370, 2371, 2365,
+    2371, 2366, 2366, 2371, 2372, 2366, 2372, 437,
+    437, 2372, 438, 108, 109, 2373, 108, 2373,
+    2367, 2367, 2373, 2374, 2367, 2374, 2368, 2368,
+    2374, 2375, 2368, 2375, 2369, 2369, 2375, 2376,
+    2369, 2376, 2370, 2370, 2376, 2377, 2370, 2377,
+    2371, 2371, 2377, 2378, 2371, 2378, 2372, 2372,
+    2378, 2379, 2372, 2379, 438, 438, 2379, 439,
+    109, 110, 2380, 109, 2380, 2373, 2373, 2380,
+    2381, 2373, 2381, 2374, 2374, 2381, 2382, 2374,
+    2382, 2375, 2375, 2382, 2383, 2375, 2383, 2376,
+    2376, 2383, 2384, 2376, 2384, 2377, 2377, 2384,
+    2385, 2377, 2385, 2378, 2378, 2385, 2386, 2378,
+    2386, 2379, 2379, 2386, 2387, 2379, 2387, 439,
+    439, 2387, 440, 110, 111, 2388, 110, 2388,
+    2380, 2380, 2388, 2389, 2380, 2389, 2381, 2381,
+    2389, 2390, 2381, 2390, 2382, 2382, 2390, 2391,
+    2382, 2391, 2383, 2383, 2391, 2392, 2383, 2392,
+    2384, 2384, 2392, 2393, 2384, 2393, 2385, 2385,
+    2393, 2394, 2385, 2394, 2386, 2386, 2394, 2395,
+    2386, 2395, 2387, 2387, 2395, 2396, 2387, 2396,
+    440, 440, 2396, 441, 111, 112, 2397, 111,
+    2397, 2388, 2388, 2397, 2398, 2388, 2398, 2389,
+    2389, 2398, 2399, 2389, 2399, 2390, 2390, 2399,
+    2400, 2390, 2400, 2391, 2391, 2400, 2401, 2391,
+    2401, 2392, 2392, 2401, 2402, 2392, 2402, 2393,
+    2393, 2402, 2403, 2393, 2403, 2394, 2394, 2403,
+    2404, 2394, 2404, 2395, 2395, 2404, 2405, 2395,
+    2405, 2396, 2396, 2405, 2406, 2396, 2406, 441,
+    441, 2406, 442, 112, 113, 2407, 112, 2407,
+    2397, 2397, 2407, 2408, 2397, 2408, 2398, 2398,
+    2408, 2409, 2398, 2409, 2399, 2399, 2409, 2410,
+    2399, 2410, 2400, 2400, 2410, 2411, 2400, 2411,
+    2401, 2401, 2411, 2412, 2401, 2412, 2402, 2402,
+    2412, 2413, 2402, 2413, 2403, 2403, 2413, 2414,
+    2403, 2414, 2404, 2404, 2414, 2415, 2404, 2415,
+    2405, 2405, 2415, 2416, 2405, 2416, 2406, 2406,
+    2416, 2417, 2406, 2417, 442, 442, 2417, 443,
+    113, 114, 2418, 113, 2418, 2407, 2407, 2418,
+    2419, 2407, 2419, 2408, 2408, 2419, 2420, 2408,
+    2420, 2409, 2409, 2420, 2421, 2409, 2421, 2410,
+    2410, 2421, 2422, 2410, 2422, 2411, 2411, 2422,
+    2423, 2411, 2423, 2412, 2412, 2423, 2424, 2412,
+    2424, 2413, 2413, 2424, 2425, 2413, 2425, 2414,
+    2414, 2425, 2426, 2414, 2426, 2415, 2415, 2426,
+    2427, 2415, 2427, 2416, 2416, 2427, 2428, 2416,
+    2428, 2417, 2417, 2428, 2429, 2417, 2429, 443,
+    443, 2429, 444, 114, 115, 2430, 114, 2430,
+    2418, 2418, 2430, 2431, 2418, 2431, 2419, 2419,
+    2431, 2432, 2419, 2432, 2420, 2420, 2432, 2433,
+    2420, 2433, 2421, 2421, 2433, 2434, 2421, 2434,
+    2422, 2422, 2434, 2435, 2422, 2435, 2423, 2423,
+    2435, 2436, 2423, 2436, 2424, 2424, 2436, 2437,
+    2424, 2437, 2425, 2425, 2437, 2438, 2425, 2438,
+    2426, 2426, 2438, 2439, 2426, 2439, 2427, 2427,
+    2439, 2440, 2427, 2440, 2428, 2428, 2440, 2441,
+    2428, 2441, 2429, 2429, 2441, 2442, 2429, 2442,
+    444, 444, 2442, 445, 115, 116, 2443, 115,
+    2443, 2430, 2430, 2443, 2444, 2430, 2444, 2431,
+    2431, 2444, 2445, 2431, 2445, 2432, 2432, 2445,
+    2446, 2432, 2446, 2433, 2433, 2446, 2447, 2433,
+    2447, 2434, 2434, 2447, 2448, 2434, 2448, 2435,
+    2435, 2448, 2449, 2435, 2449, 2436, 2436, 2449,
+    2450, 2436, 2450, 2437, 2437, 2450, 2451, 2437,
+    2451, 2438, 2438, 2451, 2452, 2438, 2452, 2439,
+    2439, 2452, 2453, 2439, 2453, 2440, 2440, 2453,
+    2454, 2440, 2454, 2441, 2441, 2454, 2455, 2441,
+    2455, 2442, 2442, 2455, 2456, 2442, 2456, 445,
+    445, 2456, 446, 116, 5, 252, 116, 252,
+    2443, 2443, 252, 253, 2443, 253, 2444, 2444,
+    253, 254, 2444, 254, 2445, 2445, 254, 255,
+    2445, 255, 2446, 2446, 255, 256, 2446, 256,
+    2447, 2447, 256, 257, 2447, 257, 2448, 2448,
+    257, 258, 2448, 258, 2449, 2449, 258, 259,
+    2449, 259, 2450, 2450, 259, 260, 2450, 260,
+    2451, 2451, 260, 261, 2451, 261, 2452, 2452,
+    261, 262, 2452, 262, 2453, 2453, 262, 263,
+    2453, 263, 2454, 2454, 263, 264, 2454, 264,
+    2455, 2455, 264, 265, 2455, 265, 2456, 2456,
+    265, 266, 2456, 266, 446, 446, 266, 2,
+    7, 357, 296, 357, 358, 2457, 357, 2457,
+    296, 296, 2457, 295, 358, 359, 2458, 358,
+    2458, 2457, 2457, 2458, 2459, 2457, 2459, 295,
+    295, 2459, 294, 359, 360, 2460, 359, 2460,
+    2458, 2458, 2460, 2461, 2458, 2461, 2459, 2459,
+    2461, 2462, 2459, 2462, 294, 294, 2462, 293,
+    360, 361, 2463, 360, 2463, 2460, 2460, 2463,
+    2464, 2460, 2464, 2461, 2461, 2464, 2465, 2461,
+    2465, 2462, 2462, 2465, 2466, 2462, 2466, 293,
+    293, 2466, 292, 361, 362, 2467, 361, 2467,
+    2463, 2463, 2467, 2468, 2463, 2468, 2464, 2464,
+    2468, 2469, 2464, 2469, 2465, 2465, 2469, 2470,
+    2465, 2470, 2466, 2466, 2470, 2471, 2466, 2471,
+    292, 292, 2471, 291, 362, 363, 2472, 362,
+    2472, 2467, 2467, 2472, 2473, 2467, 2473, 2468,
+    2468, 2473, 2474, 2468, 2474, 2469, 2469, 2474,
+    2475, 2469, 2475, 2470, 2470, 2475, 2476, 2470,
+    2476, 2471, 2471, 2476, 2477, 2471, 2477, 291,
+    291, 2477, 290, 363, 364, 2478, 363, 2478,
+    2472, 2472, 2478, 2479, 2472, 2479, 2473, 2473,
+    2479, 2480, 2473, 2480, 2474, 2474, 2480, 2481,
+    2474, 2481, 2475, 2475, 2481, 2482, 2475, 2482,
+    2476, 2476, 2482, 2483, 2476, 2483, 2477, 2477,
+    2483, 2484, 2477, 2484, 290, 290, 2484, 289,
+    364, 365, 2485, 364, 2485, 2478, 2478, 2485,
+    2486, 2478, 2486, 2479, 2479, 2486, 2487, 2479,
+    2487, 2480, 2480, 2487, 2488, 2480, 2488, 2481,
+    2481, 2488, 2489, 2481, 2489, 2482, 2482, 2489,
+    2490, 2482, 2490, 2483, 2483, 2490, 2491, 2483,
+    2491, 2484, 2484, 2491, 2492, 2484, 2492, 289,
+    289, 2492, 288, 365, 366, 2493, 365, 2493,
+    2485, 2485, 2493, 2494, 2485, 2494, 2486, 2486,
+    2494, 2495, 2486, 2495, 2487, 2487, 2495, 2496,
+    2487, 2496, 2488, 2488, 2496, 2497, 2488, 2497,
+    2489, 2489, 2497, 2498, 2489, 2498, 2490, 2490,
+    2498, 2499, 2490, 2499, 2491, 2491, 2499, 2500,
+    2491, 2500, 2492, 2492, 2500, 2501, 2492, 2501,
+    288, 288, 2501, 287, 366, 367, 2502, 366,
+    2502, 2493, 2493, 2502, 2503, 2493, 2503, 2494,
+    2494, 2503, 2504, 2494, 2504, 2495, 2495, 2504,
+    2505, 2495, 2505, 2496, 2496, 2505, 2506, 2496,
+    2506, 2497, 2497, 2506, 2507, 2497, 2507, 2498,
+    2498, 2507, 2508, 2498, 2508, 2499, 2499, 2508,
+    2509, 2499, 2509, 2500, 2500, 2509, 2510, 2500,
+    2510, 2501, 2501, 2510, 2511, 2501, 2511, 287,
+    287, 2511, 286, 367, 368, 2512, 367, 2512,
+    2502, 2502, 2512, 2513, 2502, 2513, 2503, 2503,
+    2513, 2514, 2503, 2514, 2504, 2504, 2514, 2515,
+    2504, 2515, 2505, 2505, 2515, 2516, 2505, 2516,
+    2506, 2506, 2516, 2517, 2506, 2517, 2507, 2507,
+    2517, 2518, 2507, 2518, 2508, 2508, 2518, 2519,
+    2508, 2519, 2509, 2509, 2519, 2520, 2509, 2520,
+    2510, 2510, 2520, 2521, 2510, 2521, 2511, 2511,
+    2521, 2522, 2511, 2522, 286, 286, 2522, 285,
+    368, 369, 2523, 368, 2523, 2512, 2512, 2523,
+    2524, 2512, 2524, 2513, 2513, 2524, 2525, 2513,
+    2525, 2514, 2514, 2525, 2526, 2514, 2526, 2515,
+    2515, 2526, 2527, 2515, 2527, 2516, 2516, 2527,
+    2528, 2516, 2528, 2517, 2517, 2528, 2529, 2517,
+    2529, 2518, 2518, 2529, 2530, 2518, 2530, 2519,
+    2519, 2530, 2531, 2519, 2531, 2520, 2520, 2531,
+    2532, 2520, 2532, 2521, 2521, 2532, 2533, 2521,
+    2533, 2522, 2522, 2533, 2534, 2522, 2534, 285,
+    285, 2534, 284, 369, 370, 2535, 369, 2535,
+    2523, 2523, 2535, 2536, 2523, 2536, 2524, 2524,
+    2536, 2537, 2524, 2537, 2525, 2525, 2537, 2538,
+    2525, 2538, 2526, 2526, 2538, 2539, 2526, 2539,
+    2527, 2527, 2539, 2540, 2527, 2540, 2528, 2528,
+    2540, 2541, 2528, 2541, 2529, 2529, 2541, 2542,
+    2529, 2542, 2530, 2530, 2542, 2543, 2530, 2543,
+    2531, 2531, 2543, 2544, 2531, 2544, 2532, 2532,
+    2544, 2545, 2532, 2545, 2533, 2533, 2545, 2546,
+    2533, 2546, 2534, 2534, 2546, 2547, 2534, 2547,
+    284, 284, 2547, 283, 370, 371, 2548, 370,
+    2548, 2535, 2535, 2548, 2549, 2535, 2549, 2536,
+    2536, 2549, 2550, 2536, 2550, 2537, 2537, 2550,
+    2551, 2537, 2551, 2538, 2538, 2551, 2552, 2538,
+    2552, 2539, 2539, 2552, 2553, 2539, 2553, 2540,
+    2540, 2553, 2554, 2540, 2554, 2541, 2541, 2554,
+    2555, 2541, 2555, 2542, 2542, 2555, 2556, 2542,
+    2556, 2543, 2543, 2556, 2557, 2543, 2557, 2544,
+    2544, 2557, 2558, 2544, 2558, 2545, 2545, 2558,
+    2559, 2545, 2559, 2546, 2546, 2559, 2560, 2546,
+    2560, 2547, 2547, 2560, 2561, 2547, 2561, 283,
+    283, 2561, 282, 2591, 11, 2607, 371, 461,
+    2548, 2548, 461, 460, 2548, 460, 2549, 2549,
+    460, 459, 2549, 459, 2550, 2550, 459, 458,
+    2550, 458, 2551, 2551, 458, 457, 2551, 457,
+    2552, 2552, 457, 456, 2552, 456, 2553, 2553,
+    456, 455, 2553, 455, 2554, 2554, 455, 454,
+    2554, 454, 2555, 2555, 454, 453, 2555, 453,
+    2556, 2556, 453, 452, 2556, 452, 2557, 2557,
+    452, 451, 2557, 451, 2558, 2558, 451, 450,
+    2558, 450, 2559, 2559, 450, 449, 2559, 449,
+    2560, 2560, 449, 448, 2560, 448, 2561, 2561,
+    448, 447, 2561, 447, 282, 282, 447, 2
+};
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "IkosaederUtil.h"
+#include "UvUtil.h"
+
+// Icosphere Levels embedded in the Executable (include/StaticIcosphereData.h, written by writeStaticIcosphereHeader)
+// -----------------------------------------------------------------------------------------------------------------
+const unsigned int STATIC_ICOSPHERE_MAX_LEVEL = 4;
+
+// Unique Edges of the Icosahedron and the Edges of every Face (AB, BC, AC), as found by generateIcosphere()
+// ---------------------------------------------------------------------------------------------------------
+struct IcosahedronEdges
+{
+    unsigned int corners[30][2];
+    unsigned int faceEdges[20][3];
+    bool reversed[20][3];
+};
+
+/**
+ * Find the 30 unique Edges in the same Order as generateIcosphere()
+ * @return Edge Tables
+ */
+constexpr IcosahedronEdges findIcosahedronEdges()
+{
+    IcosahedronEdges edges{};
+    unsigned int edgeCount = 0;
+    for (unsigned int f = 0; f < 20; f++)
+    {
+        const unsigned int ends[3][2] =
+        {
+            { ICOSAHEDRON_INDICES[f * 3], ICOSAHEDRON_INDICES[f * 3 + 1] },
+            { ICOSAHEDRON_INDICES[f * 3 + 1], ICOSAHEDRON_INDICES[f * 3 + 2] },
+            { ICOSAHEDRON_INDICES[f * 3], ICOSAHEDRON_INDICES[f * 3 + 2] }
+        };
+        for (unsigned int e = 0; e < 3; e++)
+        {
+            unsigned int found = edgeCount;
+            for (unsigned int k = 0; k < edgeCount; k++)
+            {
+                if (std::min(edges.corners[k][0], edges.corners[k][1]) == std::min(ends[e][0], ends[e][1]) &&
+                    std::max(edges.corners[k][0], edges.corners[k][1]) == std::max(ends[e][0], ends[e][1]))
+                    found = k;
+            }
+            if (found == edgeCount)
+            {
+                edges.corners[edgeCount][0] = ends[e][0];
+                edges.corners[edgeCount][1] = ends[e][1];
+                edgeCount++;
+            }
+            edges.faceEdges[f][e] = found;
+            edges.reversed[f][e] = edges.corners[found][0] != ends[e][0];
+        }
+    }
+    return edges;
+}
+
+/**
+ * atan2 with the Polynomial and Operation Order of atan2Simd in UvUtil.cpp, so the UVs are bit-identical
+ */
+constexpr float staticAtan2(float y, float x)
+{
+    float ax = x < 0.0f ? -x : x, ay = y < 0.0f ? -y : y;
+    float mx = std::max(ax, ay), mn = std::min(ax, ay);
+    float ratio = mx > 0.0f ? mn / mx : 0.0f;
+    float x2 = ratio * ratio;
+    float p = (float)UV_ATAN_COEFFICIENTS[0];
+    for (int k = 1; k < 9; k++)
+        p = p * x2 + (float)UV_ATAN_COEFFICIENTS[k];
+    float r = p * ratio;
+    if (ay > ax)
+        r = (float)(M_PI / 2.0) - r;
+    if (x < 0.0f)
+        r = (float)M_PI - r;
+    return y < 0.0f ? -r : r;
+}
+
+/**
+ * Welded Vertex Index of Lattice Point (r, col) of a Face, as point() in generateIcosphere()
+ */
+constexpr unsigned int staticLatticeIndex(const IcosahedronEdges& edges, unsigned int n, unsigned int f, unsigned int r, unsigned int col)
+{
+    const unsigned int* face = &ICOSAHEDRON_INDICES[f * 3];
+    unsigned int edge = 0, k = 0;
+    if (r == 0) return face[0];
+    if (r == n && col == 0) return face[1];
+    if (r == n && col == n) return face[2];
+    if (col == 0) { edge = 0; k = r; }
+    else if (r == n) { edge = 1; k = col; }
+    else if (col == r) { edge = 2; k = r; }
+    else return 12 + 30 * (n - 1) + f * ((n - 1) * (n - 2) / 2) + (r - 1) * (r - 2) / 2 + (col - 1);
+    if (edges.reversed[f][edge])
+        k = n - k;
+    return 12 + edges.faceEdges[f][edge] * (n - 1) + (k - 1);
+}
+
+bool loadStaticIcosphere(unsigned int level, std::vector<float>& vertices, std::vector<float>& normals, std::vector<unsigned int>& indices);
+void generateSphereMesh(unsigned int level, std::vector<float>& vertices, std::vector<float>& normals, std::vector<unsigned int>& indices, std::vector<float>& uvs);
+bool writeStaticIcosphereHeader(const std::string& path);
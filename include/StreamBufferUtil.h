@@ -0,0 +1,36 @@
+#pragma once
+
+#include "IkosaederUtil.h"
+
+// Streaming Buffers: a Ring of STREAM_RING_REGIONS Regions per Buffer, one written per Frame while the GPU
+// still reads the others; a Fence per Region makes the CPU wait only if it laps the GPU
+// --------------------------------------------------------------------------------------------------------
+const unsigned int STREAM_RING_REGIONS = 3;
+const size_t STREAM_ALIGNMENT = 256;    // Offset Alignment of every Write (covers Uniform Buffer Offsets)
+
+typedef unsigned int StreamHandle;
+const StreamHandle INVALID_STREAM_HANDLE = 0xFFFFFFFFu;
+
+// Where a Write landed: Buffer and Byte Offset to bind or point Attributes at (the Buffer changes when the Ring grows)
+// ------------------------------------------------------------------------------------------------------------------
+struct StreamRange
+{
+    unsigned int buffer;
+    size_t offset;
+};
+
+// Instrumentation of the last finished Frame
+// ------------------------------------------
+struct StreamStats
+{
+    size_t bytesStreamed;
+    double waitMilliseconds;    // CPU Time blocked on Fences of Regions the GPU was still reading
+    unsigned int stalls;        // Fences not yet signaled when their Region came up again
+};
+
+void initStreamBuffers();
+StreamHandle createStreamBuffer(size_t regionBytes);
+StreamRange streamData(StreamHandle handle, const void* data, size_t bytes);
+void endStreamFrame();
+const StreamStats& streamStats();
+void releaseStreamBuffers();
@@ -0,0 +1,10 @@
+#pragma once
+
+#include "IkosaederUtil.h"
+
+void generateTangents(
+    const std::vector<float>& vertices,
+    const std::vector<float>& normals,
+    const std::vector<float>& uvs,
+    const std::vector<unsigned int>& indices,
+    std::vector<float>& tangents);
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "IkosaederUtil.h"
+
+// Planetary Terrain: a Quadtree of Chunks on each of the six Cube Sphere Faces
+// ----------------------------------------------------------------------------
+const int TERRAIN_GRID = 32;                            // Quads per Chunk Edge
+const int TERRAIN_TILE_SIZE = TERRAIN_GRID + 1;         // Elevation Samples per Tile Edge (one per Grid Point)
+const unsigned int TERRAIN_MAX_LEVEL = 12;              // ~76 m Grid Spacing on the Earth
+const float TERRAIN_TARGET_EDGE_PIXELS = 6.0f;          // Chunks split while their Grid Spacing is larger on Screen
+const float TERRAIN_MORPH_START = 0.7f;                 // Fraction of the Parent's Distance where the Geomorph starts
+const float TERRAIN_ACTIVATION_DISTANCE = 2.0f;         // Camera Distance to the Earth Center (Radii) below which the Terrain is drawn
+const float TERRAIN_STREAM_DISTANCE = 2.5f;             // ... below which the Root Tiles are streamed in
+const size_t TERRAIN_CACHE_TILES = 1024;                // LRU Cache Capacity (33 x 33 floats each -> ~4.3 MiB)
+const unsigned int TERRAIN_WORKER_THREADS = 2;
+const unsigned int TERRAIN_UPLOADS_PER_FRAME = 16;
+
+// Elevation: Tiles are 33 x 33 little-endian int16 Meters, Row-major along the Face Axes U (Columns) and V (Rows),
+// stored as <directory>/<face>/<level>/<x>_<y>.r16; missing Tiles fall back to procedural Elevation
+// ---------------------------------------------------------------------------------------------------------------
+const char* const TERRAIN_TILE_DIRECTORY = "resources/terrain";
+const float EARTH_RADIUS_METERS = 6371000.0f;
+const float TERRAIN_EXAGGERATION = 10.0f;
+const float TERRAIN_MAX_HEIGHT = 9000.0f / EARTH_RADIUS_METERS * TERRAIN_EXAGGERATION;   // in Earth Radii
+
+bool initTerrain();
+bool updateTerrain(float cameraDistance);
+bool terrainActive();
+void sampleTerrainHeights(const std::vector<float>& directions, unsigned int level, std::vector<float>& heights);
+unsigned int terrainShaderProgram();
+void drawTerrain(unsigned int shaderProgram, const glm::mat4& model, const glm::mat4& view, const glm::mat4& projection);
+void shutdownTerrain();
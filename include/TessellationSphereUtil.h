@@ -0,0 +1,12 @@
+#pragma once
+
+#include "IkosaederUtil.h"
+
+// Icosphere Level the Patches start from: 4 Segments per Base Edge x Tessellation Level 64 = Level 8
+// --------------------------------------------------------------------------------------------------
+const unsigned int TESSELLATION_BASE_LEVEL = 2;
+const float TESSELLATION_MAX_ERROR_PIXELS = 0.5f;   // allowed Gap between Patch Surface and Sphere on Screen
+
+unsigned int initTessellationShaders();
+void initTessellatedSphere();
+void drawTessellatedSphere(unsigned int shaderProgram);
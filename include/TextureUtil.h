@@ -2,6 +2,10 @@
 
 #include "IkosaederUtil.h"
 
+const int FLAT_NORMAL_CUBE_FACE_SIZE = 64;      // Face Texels of the flat Normal Cube Map (one Sphere Normal per Texel)
+
 void calculateUVs(std::vector<float>& vertices, std::vector<float>& uvs);
 unsigned int loadTexture(const char* path);
 unsigned int loadCubeMap(std::vector<std::string> faces);
+unsigned int loadEquirectCubeMap(const char* path, bool tangentSpaceNormals);
+unsigned int createFlatNormalMap(bool cubeMap);
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "IkosaederUtil.h"
+
+// Uniforms of all Shader Programs, in the Order of UNIFORM_NAMES in UniformUtil.cpp
+// ---------------------------------------------------------------------------------
+enum class Uniform
+{
+    // Transforms (View and Projection are in the Frame Block)
+    Model, ObjectFromView,
+
+    // Samplers
+    Texture1, NormalMap, HeightTile, Skybox,
+
+    // Sphere Generation (procedural, Compute and Tessellation)
+    Subdivisions, IcosahedronVertices, IcosahedronFaces, WordsPerVertex, BaseWord,
+    BlockSide, BlockLattice, BlockIndices,
+    ViewportHeight, MaxErrorPixels, MaxTessellationLevel,
+
+    // Terrain Chunks
+    FaceNormal, FaceU, FaceV, ChunkOrigin, ChunkSize, ChunkCenter,
+    MorphDistance, SkirtDepth, GridSize, MorphStart, CameraObjectPos,
+
+    // Simulation Overlay
+    OverlayRadius, TerrainHeightScale,
+
+    Count
+};
+
+// Per-Frame Camera and Light, shared by all Programs through the Uniform Block "Frame"
+// (std140: vec3 Members take 16 Bytes, hence vec4 here)
+// -----------------------------------------------------------------------------------
+struct FrameUniforms
+{
+    glm::mat4 view;
+    glm::mat4 projection;
+    glm::vec4 lightPos;
+    glm::vec4 lightColor;
+    glm::vec4 viewPos;
+    glm::vec4 earthPos;
+};
+static_assert(sizeof(FrameUniforms) == 192, "std140 Layout of the Frame Block");
+
+const unsigned int FRAME_UNIFORM_BINDING = 0;
+const char* const FRAME_UNIFORM_BLOCK = "Frame";
+
+void reflectUniforms(unsigned int program);
+int uniformLocation(unsigned int program, Uniform uniform);
+void initFrameUniforms();
+void updateFrameUniforms(const glm::mat4& view, const glm::mat4& projection,
+    const glm::vec3& lightPos, const glm::vec3& lightColor, const glm::vec3& viewPos, const glm::vec3& earthPos);
+void releaseFrameUniforms();
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "IkosaederUtil.h"
+
+// Polynomials of the SIMD UV Pass, highest Power first (Horner Order):
+// atan(x) = x * P(x^2) on [0, 1] (Abramowitz & Stegun 4.4.49, leading Coefficient 1),
+// asin(x) = PI / 2 - sqrt(1 - x) * P(x) on [0, 1] (Abramowitz & Stegun 4.4.46)
+// -------------------------------------------------------------------------------------
+constexpr double UV_ATAN_COEFFICIENTS[9] =
+{
+    0.0028662257, -0.0161657367, 0.0429096138, -0.0752896400, 0.1065626393,
+    -0.1420889944, 0.1999355085, -0.3333314528, 1.0
+};
+constexpr double UV_ASIN_COEFFICIENTS[8] =
+{
+    -0.0012624911, 0.0066700901, -0.0170881256, 0.0308918810,
+    -0.0501743046, 0.0889789874, -0.2145988016, 1.5707963050
+};
+
+// Worst-Case Errors of these Polynomials before float Rounding, measured in double (checked by benchmarkUVs)
+// ---------------------------------------------------------------------------------------------------------
+const float UV_ATAN_MAX_ERROR = 1.4e-8f;   // Radians, atan on [0, 1]
+const float UV_ASIN_MAX_ERROR = 2.2e-8f;   // Radians, asin on [0, 1]
+
+void calculateUVsSimd(const std::vector<float>& vertices, std::vector<float>& uvs);
+void calculateSphereUVs(
+    std::vector<float>& vertices,
+    std::vector<float>& normals,
+    std::vector<unsigned int>& indices,
+    std::vector<float>& uvs);
+bool benchmarkUVs();
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "IkosaederUtil.h"
+
+// Simulated FIFO Post-Transform Cache (Tipsify Reordering and Metrics)
+// --------------------------------------------------------------------
+const unsigned int VERTEX_CACHE_SIZE = 32;
+
+struct VertexCacheStats
+{
+    float acmr;     // Cache Misses per Triangle (0.5 is the Limit for large regular Meshes)
+    float atvr;     // Cache Misses per Vertex (1.0 is optimal)
+};
+
+void optimizeVertexCache(unsigned int* indices, size_t indexCount, size_t vertexCount);
+void optimizeVertexFetch(unsigned int* indices, size_t indexCount, std::vector<unsigned int>& vertexRemap);
+VertexCacheStats analyzeVertexCache(const unsigned int* indices, size_t indexCount, size_t vertexCount, unsigned int cacheSize = VERTEX_CACHE_SIZE);
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "IkosaederUtil.h"
+
+// One Vertex Attribute inside an interleaved Buffer
+// -------------------------------------------------
+struct VertexAttribute
+{
+    unsigned int location;
+    int components;
+    GLenum type;
+    GLboolean normalized;
+    unsigned int offset;
+};
+
+struct VertexLayout
+{
+    unsigned int stride;
+    std::vector<VertexAttribute> attributes;
+};
+
+// Packed Sphere Vertex (24 Bytes instead of 56 in five float Streams)
+// -------------------------------------------------------------------
+struct PackedVertex
+{
+    float position[3];      // location 0: 3 x float
+    uint32_t normal;        // location 1: 10_10_10_2 signed normalized
+    uint16_t uv[2];         // location 2: 2 x half float
+    uint32_t tangent;       // location 3: 10_10_10_2 signed normalized, w = Bitangent Handedness
+};
+static_assert(sizeof(PackedVertex) == 24, "PackedVertex must stay tightly packed");
+
+// Packed Sphere Vertex without Tangent (20 Bytes); the Shader derives the TBN from the Normal
+// -------------------------------------------------------------------------------------------
+struct SlimVertex
+{
+    float position[3];      // location 0: 3 x float
+    uint32_t normal;        // location 1: 10_10_10_2 signed normalized
+    uint16_t uv[2];         // location 2: 2 x half float
+};
+static_assert(sizeof(SlimVertex) == 20, "SlimVertex must stay tightly packed");
+
+extern const VertexLayout PACKED_VERTEX_LAYOUT;
+extern const VertexLayout SLIM_VERTEX_LAYOUT;
+extern const VertexLayout POSITION_VERTEX_LAYOUT;   // Tessellation Patches: Position only
+
+void packVertices(
+    const std::vector<float>& vertices,
+    const std::vector<float>& normals,
+    const std::vector<float>& uvs,
+    const std::vector<float>& tangents,
+    std::vector<PackedVertex>& packed);
+void packVertices(
+    const std::vector<float>& vertices,
+    const std::vector<float>& normals,
+    const std::vector<float>& uvs,
+    std::vector<SlimVertex>& packed);
+void applyVertexLayout(const VertexLayout& layout);
@@ -0,0 +1,26 @@
+#version 430 core
+// One Invocation per Index Word (two 16 bit local Indices) of one Sphere Level;
+// every Block (Meshlet) repeats the same cache-ordered local Indices
+layout (local_size_x = 64) in;
+
+layout (std430, binding = 1) buffer IndexBuffer { uint indexWords[]; };
+
+uniform int subdivisions;       // n = 2^level
+uniform int blockSide;          // s = min(n, COMPUTE_BLOCK_SIDE)
+uniform uint blockIndices[96];  // local Indices of one Block, two per Word (low Half first)
+uniform uint baseWord;          // first Word of this Level in the EBO
+
+uint blockIndex(int i)
+{
+    int j = i % (blockSide * blockSide * 3);
+    return (blockIndices[j / 2] >> (16 * (j & 1))) & 0xFFFFu;
+}
+
+void main()
+{
+    int n = subdivisions;
+    int id = int(gl_GlobalInvocationID.x);
+    if (id * 2 >= 20 * n * n * 3)
+        return;
+    indexWords[baseWord + uint(id)] = blockIndex(id * 2) | (blockIndex(id * 2 + 1) << 16);
+}
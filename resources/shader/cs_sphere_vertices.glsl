@@ -0,0 +1,79 @@
+#version 430 core
+// One Invocation per Vertex of one Sphere Level: every Face Lattice is tiled into Blocks (Lattice Triangles
+// of blockSide Edges, upright and upside down by Turns in Row Order), every Block is one Meshlet whose
+// Vertices are written in the Fetch Order of blockLattice straight into the VBO as PackedVertex or SlimVertex Words
+layout (local_size_x = 64) in;
+
+layout (std430, binding = 0) buffer VertexBuffer { uint vertexWords[]; };
+
+uniform vec3 icosahedronVertices[12];
+uniform ivec3 icosahedronFaces[20];
+uniform int subdivisions;       // n = 2^level
+uniform int blockSide;          // s = min(n, COMPUTE_BLOCK_SIDE)
+uniform ivec2 blockLattice[45]; // (Row, Column) inside an upright Block for every Block Vertex
+uniform uint baseWord;          // first Word of this Level in the VBO
+uniform int wordsPerVertex;       // 6 = PackedVertex (with Tangent), 5 = SlimVertex
+
+const float PI = 3.14159265358979;
+
+// Same Quantization as glm::packSnorm3x10_1x2
+uint packSnorm3x10_1x2(vec4 v)
+{
+    ivec4 q = ivec4(round(clamp(v, -1.0, 1.0) * vec4(511.0, 511.0, 511.0, 1.0)));
+    return uint(q.x & 0x3FF) | (uint(q.y & 0x3FF) << 10) | (uint(q.z & 0x3FF) << 20) | (uint(q.w & 0x3) << 30);
+}
+
+float longitudeU(vec3 p)
+{
+    return 0.5 + atan(p.z, p.x) / (2.0 * PI);
+}
+
+void main()
+{
+    int n = subdivisions;
+    int s = blockSide;
+    int perBlock = (s + 1) * (s + 2) / 2;
+    int blocksPerFace = (n / s) * (n / s);
+    int id = int(gl_GlobalInvocationID.x);
+    if (id >= 20 * blocksPerFace * perBlock)
+        return;
+
+    // Face, Block (Block Row R holds 2R+1 Blocks, even k upright, odd k upside down) and Lattice Point;
+    // upside-down Blocks are upright ones turned by 180 Degrees, which keeps the Winding
+    // -------------------------------------------------------------------------------------------------
+    int block = id / perBlock;
+    int f = block / blocksPerFace;
+    int b = block - f * blocksPerFace;
+    int R = int(sqrt(float(b)));
+    if (R * R > b) R--;
+    if ((R + 1) * (R + 1) <= b) R++;
+    int k = b - R * R;
+    ivec2 lattice = blockLattice[id - block * perBlock];
+    int r = (k & 1) == 0 ? R * s + lattice.x : R * s + s - lattice.x;
+    int c = (k & 1) == 0 ? (k / 2) * s + lattice.y : (k / 2) * s + s - lattice.y;
+
+    ivec3 face = icosahedronFaces[f];
+    vec3 a = icosahedronVertices[face.x], bb = icosahedronVertices[face.y], cc = icosahedronVertices[face.z];
+    vec3 p = normalize(a * float(n - r) + bb * float(r - c) + cc * float(c));
+
+    // UV unwrapped towards the Face Center, so no Face spans the Date Line; Poles take the Center's u
+    // -----------------------------------------------------------------------------------------------
+    float uFace = longitudeU(normalize(a + bb + cc));
+    float u = abs(p.y) > 1.0 - 1e-6 ? uFace : longitudeU(p);
+    u += round(uFace - u);
+    float v = 0.5 - asin(clamp(p.y, -1.0, 1.0)) / PI;
+
+    // Analytic Tangent of the equirectangular Mapping, Handedness +1 (B = cross(N, T))
+    // --------------------------------------------------------------------------------
+    vec3 t = vec3(-p.z, 0.0, p.x);
+    t = dot(t, t) > 1e-12 ? normalize(t) : vec3(1.0, 0.0, 0.0);
+
+    uint word = baseWord + uint(id * wordsPerVertex);
+    vertexWords[word] = floatBitsToUint(p.x);
+    vertexWords[word + 1u] = floatBitsToUint(p.y);
+    vertexWords[word + 2u] = floatBitsToUint(p.z);
+    vertexWords[word + 3u] = packSnorm3x10_1x2(vec4(p, 0.0));
+    vertexWords[word + 4u] = packHalf2x16(vec2(u, v));
+    if (wordsPerVertex == 6)
+        vertexWords[word + 5u] = packSnorm3x10_1x2(vec4(t, 1.0));
+}
@@ -7,10 +7,15 @@ in vec2 TexCoord;
 in vec3 Tangent;
 in vec3 Bitangent;
 
-uniform vec3 lightPos;
-uniform vec3 lightColor;
-uniform vec3 viewPos;
-uniform vec3 earthPos;
+layout (std140) uniform Frame              // per-Frame Camera and Light (FrameUniforms, UniformUtil.h)
+{
+    mat4 view;
+    mat4 projection;
+    vec3 lightPos;
+    vec3 lightColor;
+    vec3 viewPos;
+    vec3 earthPos;
+};
 
 uniform sampler2D texture1;
 uniform sampler2D normalMap;
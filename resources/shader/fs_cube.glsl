@@ -0,0 +1,62 @@
+#version 330 core
+out vec4 FragColor;
+
+in vec3 FragPos;
+in vec3 Normal;
+in vec3 SurfaceDir;
+
+layout (std140) uniform Frame              // per-Frame Camera and Light (FrameUniforms, UniformUtil.h)
+{
+    mat4 view;
+    mat4 projection;
+    vec3 lightPos;
+    vec3 lightColor;
+    vec3 viewPos;
+    vec3 earthPos;
+};
+
+uniform mat4 model;
+uniform samplerCube texture1;
+uniform samplerCube normalMap;      // object-space Normals (see loadEquirectCubeMap)
+
+const float PI = 3.14159265358979;
+
+// Inverse of the equal-angle Warp the Cube Maps were baked with:
+// Face Coordinate a = d / |d_major| -> (4 / PI) atan(a); the major Component stays +-1
+vec3 equalAngleDirection(vec3 d)
+{
+    vec3 a = abs(d);
+    return (4.0 / PI) * atan(d / max(a.x, max(a.y, a.z)));
+}
+
+void main()
+{
+    vec3 dir = equalAngleDirection(SurfaceDir);
+
+    // Object-space Normal from the Cube Map, into World Space (Model is Rotation and uniform Scale)
+    // ---------------------------------------------------------------------------------------------
+    vec3 normal = texture(normalMap, dir).rgb * 2.0 - 1.0;
+    normal = normalize(mat3(model) * normal);
+
+    // Ambient Light
+    // -------------
+    float ambientStrength = 0.15;
+    vec3 ambient = ambientStrength * lightColor;
+
+    // Diffuse Light
+    // -------------
+    vec3 lightDir = normalize(lightPos - FragPos);
+    float diff = max(dot(normal, lightDir), 0.0);
+    vec3 diffuse = diff * lightColor;
+
+    // Specular Light
+    // --------------
+    float specularStrength = 0.1;
+    vec3 viewDir = normalize(viewPos - FragPos);
+    vec3 reflectDir = reflect(-lightDir, normal);
+    float spec = pow(max(dot(viewDir, reflectDir), 0.0), 32.0);
+    vec3 specular = spec * specularStrength * lightColor;
+
+    vec3 result = (ambient + diffuse + specular) * texture(texture1, dir).rgb;
+    FragColor = vec4(result, 1.0f);
+}
@@ -0,0 +1,84 @@
+#version 330 core
+out vec4 FragColor;
+
+in vec3 ViewRay;
+
+layout (std140) uniform Frame              // per-Frame Camera and Light (FrameUniforms, UniformUtil.h)
+{
+    mat4 view;
+    mat4 projection;
+    vec3 lightPos;
+    vec3 lightColor;
+    vec3 viewPos;
+    vec3 earthPos;
+};
+
+uniform mat4 model;
+uniform mat4 objectFromView;                // inverse(view * model)
+
+uniform sampler2D texture1;
+uniform sampler2D normalMap;
+
+const float PI = 3.14159265358979;
+
+void main()
+{
+    // Ray against the unit Sphere in Object Space, nearest Hit; Misses are discarded
+    // only at the End, so the Derivatives below stay defined for the whole Pixel Quad
+    // -------------------------------------------------------------------------------
+    vec3 origin = vec3(objectFromView * vec4(0.0, 0.0, 0.0, 1.0));
+    vec3 direction = normalize(mat3(objectFromView) * ViewRay);
+    float b = dot(origin, direction);
+    float discriminant = b * b - (dot(origin, origin) - 1.0);
+    vec3 position = normalize(origin + direction * (-b - sqrt(max(discriminant, 0.0))));
+
+    // Depth of the Hit instead of the Quad (default Depth Range)
+    // ----------------------------------------------------------
+    vec4 clip = projection * view * model * vec4(position, 1.0);
+    gl_FragDepth = clip.z / clip.w * 0.5 + 0.5;
+
+    // UV of vs_procedural.glsl; the Gradient of u is taken from u or fract(u + 0.5),
+    // whichever is continuous here, so the Date Line doesn't drop to the smallest Mip Level
+    // -------------------------------------------------------------------------------------
+    float u = 0.5 + atan(position.z, position.x) / (2.0 * PI);
+    float v = 0.5 - asin(clamp(position.y, -1.0, 1.0)) / PI;
+    vec2 TexCoord = vec2(-u, v);
+    vec2 wrapped = vec2(-fract(u + 0.5), v);
+    vec2 dx = dFdx(TexCoord), dy = dFdy(TexCoord);
+    vec2 dxWrapped = dFdx(wrapped), dyWrapped = dFdy(wrapped);
+    dx.x = abs(dx.x) <= abs(dxWrapped.x) ? dx.x : dxWrapped.x;
+    dy.x = abs(dy.x) <= abs(dyWrapped.x) ? dy.x : dyWrapped.x;
+
+    // Analytic Tangent Frame of vs_analytic.glsl, into World Space (Model is Rotation and uniform Scale)
+    // -------------------------------------------------------------------------------------------------
+    vec3 tangent = vec3(-position.z, 0.0, position.x);
+    tangent = dot(tangent, tangent) > 1e-12 ? normalize(tangent) : vec3(1.0, 0.0, 0.0);
+    vec3 FragPos = vec3(model * vec4(position, 1.0));
+    vec3 T = normalize(mat3(model) * tangent);
+    vec3 B = normalize(mat3(model) * cross(position, tangent));
+    vec3 N = normalize(mat3(model) * position);
+
+    // From here on as in fs.glsl
+    // --------------------------
+    vec3 normal = textureGrad(normalMap, TexCoord, dx, dy).rgb;
+    normal = normalize(normal * 2.0 - 1.0);
+    normal = normalize(mat3(T, B, N) * normal);
+
+    float ambientStrength = 0.15;
+    vec3 ambient = ambientStrength * lightColor;
+
+    vec3 lightDir = normalize(lightPos - FragPos);
+    float diff = max(dot(normal, lightDir), 0.0);
+    vec3 diffuse = diff * lightColor;
+
+    float specularStrength = 0.1;
+    vec3 viewDir = normalize(viewPos - FragPos);
+    vec3 reflectDir = reflect(-lightDir, normal);
+    float spec = pow(max(dot(viewDir, reflectDir), 0.0), 32.0);
+    vec3 specular = spec * specularStrength * lightColor;
+
+    vec3 result = (ambient + diffuse + specular) * textureGrad(texture1, TexCoord, dx, dy).rgb;
+    if (discriminant < 0.0)
+        discard;
+    FragColor = vec4(result, 1.0f);
+}
@@ -0,0 +1,69 @@
+#version 330 core
+out vec4 FragColor;
+
+in vec3 ViewRay;
+
+layout (std140) uniform Frame              // per-Frame Camera and Light (FrameUniforms, UniformUtil.h)
+{
+    mat4 view;
+    mat4 projection;
+    vec3 lightPos;
+    vec3 lightColor;
+    vec3 viewPos;
+    vec3 earthPos;
+};
+
+uniform mat4 model;
+uniform mat4 objectFromView;                // inverse(view * model)
+
+uniform samplerCube texture1;
+uniform samplerCube normalMap;              // object-space Normals (see loadEquirectCubeMap)
+
+const float PI = 3.14159265358979;
+
+// Inverse of the equal-angle Warp as in fs_cube.glsl
+vec3 equalAngleDirection(vec3 d)
+{
+    vec3 a = abs(d);
+    return (4.0 / PI) * atan(d / max(a.x, max(a.y, a.z)));
+}
+
+void main()
+{
+    // Ray against the unit Sphere in Object Space as in fs_impostor.glsl
+    // -------------------------------------------------------------------
+    vec3 origin = vec3(objectFromView * vec4(0.0, 0.0, 0.0, 1.0));
+    vec3 direction = normalize(mat3(objectFromView) * ViewRay);
+    float b = dot(origin, direction);
+    float discriminant = b * b - (dot(origin, origin) - 1.0);
+    vec3 position = normalize(origin + direction * (-b - sqrt(max(discriminant, 0.0))));
+
+    vec4 clip = projection * view * model * vec4(position, 1.0);
+    gl_FragDepth = clip.z / clip.w * 0.5 + 0.5;
+
+    // From here on as in fs_cube.glsl
+    // -------------------------------
+    vec3 FragPos = vec3(model * vec4(position, 1.0));
+    vec3 dir = equalAngleDirection(position);
+
+    vec3 normal = texture(normalMap, dir).rgb * 2.0 - 1.0;
+    normal = normalize(mat3(model) * normal);
+
+    float ambientStrength = 0.15;
+    vec3 ambient = ambientStrength * lightColor;
+
+    vec3 lightDir = normalize(lightPos - FragPos);
+    float diff = max(dot(normal, lightDir), 0.0);
+    vec3 diffuse = diff * lightColor;
+
+    float specularStrength = 0.1;
+    vec3 viewDir = normalize(viewPos - FragPos);
+    vec3 reflectDir = reflect(-lightDir, normal);
+    float spec = pow(max(dot(viewDir, reflectDir), 0.0), 32.0);
+    vec3 specular = spec * specularStrength * lightColor;
+
+    vec3 result = (ambient + diffuse + specular) * texture(texture1, dir).rgb;
+    if (discriminant < 0.0)
+        discard;
+    FragColor = vec4(result, 1.0f);
+}
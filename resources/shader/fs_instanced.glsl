@@ -0,0 +1,60 @@
+#version 330 core
+out vec4 FragColor;
+
+in vec3 FragPos;
+in vec3 Normal;
+in vec2 TexCoord;
+in vec3 Tangent;
+in vec3 Bitangent;
+flat in uvec3 Body;                         // Texture Layer, Normal Map Layer, Flags
+
+layout (std140) uniform Frame              // per-Frame Camera and Light (FrameUniforms, UniformUtil.h)
+{
+    mat4 view;
+    mat4 projection;
+    vec3 lightPos;
+    vec3 lightColor;
+    vec3 viewPos;
+    vec3 earthPos;
+};
+
+uniform sampler2DArray texture1;            // one Layer per Body Surface (BodyRendererUtil.h)
+uniform sampler2DArray normalMap;
+
+const uint BODY_FLAG_NORMAL_MAP = 1u;
+
+void main()
+{
+    // Normal from the Body's Normal Map Layer, Bodies without Relief keep the Surface Normal
+    // --------------------------------------------------------------------------------------
+    vec3 normal = normalize(Normal);
+    if ((Body.z & BODY_FLAG_NORMAL_MAP) != 0u)
+    {
+        vec3 mapped = texture(normalMap, vec3(TexCoord, float(Body.y))).rgb;
+        mapped = normalize(mapped * 2.0 - 1.0);
+        mat3 TBN = mat3(normalize(Tangent), normalize(Bitangent), normal);
+        normal = normalize(TBN * mapped);
+    }
+
+    // Ambient Light
+    // -------------
+    float ambientStrength = 0.15;
+    vec3 ambient = ambientStrength * lightColor;
+
+    // Diffuse Light
+    // -------------
+    vec3 lightDir = normalize(lightPos - FragPos);
+    float diff = max(dot(normal, lightDir), 0.0);
+    vec3 diffuse = diff * lightColor;
+
+    // Specular Light
+    // --------------
+    float specularStrength = 0.1;
+    vec3 viewDir = normalize(viewPos - FragPos);
+    vec3 reflectDir = reflect(-lightDir, normal);
+    float spec = pow(max(dot(viewDir, reflectDir), 0.0), 32.0);
+    vec3 specular = spec * specularStrength * lightColor;
+
+    vec3 result = (ambient + diffuse + specular) * texture(texture1, vec3(TexCoord, float(Body.x))).rgb;
+    FragColor = vec4(result, 1.0f);
+}
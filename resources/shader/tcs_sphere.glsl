@@ -0,0 +1,77 @@
+#version 400 core
+layout (vertices = 3) out;
+
+in vec3 vPosition[];
+out vec3 tcPosition[];
+
+uniform mat4 model;
+
+layout (std140) uniform Frame              // per-Frame Camera and Light (FrameUniforms, UniformUtil.h)
+{
+    mat4 view;
+    mat4 projection;
+    vec3 lightPos;
+    vec3 lightColor;
+    vec3 viewPos;
+    vec3 earthPos;
+};
+
+uniform float viewportHeight;
+uniform float maxErrorPixels;               // allowed Gap between flat Triangles and Sphere on Screen
+uniform float maxTessellationLevel;
+
+const float NEAR_PLANE = 0.1;
+
+// Segments for the Edge a-b (unit Sphere Points): a Chord spanning the Angle t lies
+// r * (1 - cos(t / 2)) ~ r * t^2 / 8 inside the Sphere, so k Segments keep the Gap
+// below the Limit for k = t * sqrt(r * pixelsPerUnit / (8 * maxError)).
+// Only depends on the Edge itself (symmetric in a and b) -> neighbouring Patches agree, no Cracks
+float edgeLevel(vec3 a, vec3 b)
+{
+    float angle = acos(clamp(dot(a, b), -1.0, 1.0));
+    vec3 middle = normalize(a + b);
+    float radius = length(mat3(model) * middle);
+    float depth = max(-(view * model * vec4(middle, 1.0)).z, NEAR_PLANE);
+    float pixelsPerUnit = projection[1][1] * 0.5 * viewportHeight / depth;
+    float level = angle * sqrt(radius * pixelsPerUnit / (8.0 * maxErrorPixels));
+    return clamp(level, 1.0, maxTessellationLevel);
+}
+
+// Patch faces away from the Camera: same Normal Cone Test as the Meshlets (drawMeshlets)
+bool backFacing(vec3 a, vec3 b, vec3 c)
+{
+    vec3 axis = normalize(a + b + c);
+    vec3 center = (a + b + c) / 3.0;
+    float radius = max(max(length(a - center), length(b - center)), max(length(c - center), length(axis - center)));
+    float minDot = min(min(dot(a, axis), dot(b, axis)), dot(c, axis));
+    float cutoff = sqrt(1.0 - minDot * minDot);
+
+    float scale = length(mat3(model) * axis);
+    vec3 cameraPos = vec3(inverse(view) * vec4(0.0, 0.0, 0.0, 1.0));
+    vec3 toCenter = vec3(model * vec4(center, 1.0)) - cameraPos;
+    return dot(toCenter, normalize(mat3(model) * axis)) >= cutoff * length(toCenter) + radius * scale;
+}
+
+void main()
+{
+    tcPosition[gl_InvocationID] = vPosition[gl_InvocationID];
+
+    // Tessellation Levels once per Patch; Outer Level i belongs to the Edge opposite Corner i
+    // ---------------------------------------------------------------------------------------
+    if (gl_InvocationID == 0)
+    {
+        vec3 a = vPosition[0], b = vPosition[1], c = vPosition[2];
+        if (backFacing(a, b, c))
+        {
+            gl_TessLevelOuter[0] = 0.0;
+            gl_TessLevelOuter[1] = 0.0;
+            gl_TessLevelOuter[2] = 0.0;
+            gl_TessLevelInner[0] = 0.0;
+            return;
+        }
+        gl_TessLevelOuter[0] = edgeLevel(b, c);
+        gl_TessLevelOuter[1] = edgeLevel(c, a);
+        gl_TessLevelOuter[2] = edgeLevel(a, b);
+        gl_TessLevelInner[0] = max(max(gl_TessLevelOuter[0], gl_TessLevelOuter[1]), gl_TessLevelOuter[2]);
+    }
+}
@@ -0,0 +1,56 @@
+#version 400 core
+layout (triangles, fractional_odd_spacing, ccw) in;
+
+in vec3 tcPosition[];
+
+out vec3 FragPos;
+out vec3 Normal;
+out vec2 TexCoord;
+out vec3 Tangent;
+out vec3 Bitangent;
+
+uniform mat4 model;
+
+layout (std140) uniform Frame              // per-Frame Camera and Light (FrameUniforms, UniformUtil.h)
+{
+    mat4 view;
+    mat4 projection;
+    vec3 lightPos;
+    vec3 lightColor;
+    vec3 viewPos;
+    vec3 earthPos;
+};
+
+const float PI = 3.14159265358979;
+
+float longitudeU(vec3 p)
+{
+    return 0.5 + atan(p.z, p.x) / (2.0 * PI);
+}
+
+void main()
+{
+    // New Vertex: barycentric Point of the Patch, projected onto the unit Sphere
+    // --------------------------------------------------------------------------
+    vec3 position = normalize(gl_TessCoord.x * tcPosition[0] + gl_TessCoord.y * tcPosition[1] + gl_TessCoord.z * tcPosition[2]);
+
+    // UV as in vs_procedural.glsl, u unwrapped towards the Patch Center
+    // -----------------------------------------------------------------
+    float uCenter = longitudeU(normalize(tcPosition[0] + tcPosition[1] + tcPosition[2]));
+    float u = abs(position.y) > 1.0 - 1e-6 ? uCenter : longitudeU(position);
+    u += round(uCenter - u);
+    float v = 0.5 - asin(clamp(position.y, -1.0, 1.0)) / PI;
+
+    // Analytic Tangent Frame as in vs_analytic.glsl
+    // ---------------------------------------------
+    vec3 tangent = vec3(-position.z, 0.0, position.x);
+    tangent = dot(tangent, tangent) > 1e-12 ? normalize(tangent) : vec3(1.0, 0.0, 0.0);
+
+    FragPos = vec3(model * vec4(position, 1.0));
+    Normal = mat3(transpose(inverse(model))) * position;
+    Tangent = mat3(transpose(inverse(model))) * tangent;
+    Bitangent = mat3(transpose(inverse(model))) * cross(position, tangent);
+    TexCoord = vec2(-u, v);
+
+    gl_Position = projection * view * vec4(FragPos, 1.0);
+}
@@ -2,8 +2,7 @@
 layout (location = 0) in vec3 aPos;
 layout (location = 1) in vec3 aNormal;
 layout (location = 2) in vec2 aTexCoord;
-layout (location = 3) in vec3 aTangent;
-layout (location = 4) in vec3 aBitangent;
+layout (location = 3) in vec4 aTangent;     // w = Bitangent Handedness
 
 out vec3 FragPos;
 out vec3 Normal;
@@ -12,15 +11,23 @@ out vec3 Tangent;
 out vec3 Bitangent;
 
 uniform mat4 model;
-uniform mat4 view;
-uniform mat4 projection;
+
+layout (std140) uniform Frame              // per-Frame Camera and Light (FrameUniforms, UniformUtil.h)
+{
+    mat4 view;
+    mat4 projection;
+    vec3 lightPos;
+    vec3 lightColor;
+    vec3 viewPos;
+    vec3 earthPos;
+};
 
 void main()
 {
     FragPos = vec3(model * vec4(aPos, 1.0));
     Normal = mat3(transpose(inverse(model))) * aNormal;
-    Tangent = mat3(transpose(inverse(model))) * aTangent;
-    Bitangent = mat3(transpose(inverse(model))) * aBitangent;
+    Tangent = mat3(transpose(inverse(model))) * aTangent.xyz;
+    Bitangent = mat3(transpose(inverse(model))) * (cross(aNormal, aTangent.xyz) * aTangent.w);
     TexCoord = vec2(-aTexCoord.x, aTexCoord.y);
 
     gl_Position = projection * view * vec4(FragPos, 1.0);
@@ -0,0 +1,39 @@
+#version 330 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aNormal;
+layout (location = 2) in vec2 aTexCoord;
+
+out vec3 FragPos;
+out vec3 Normal;
+out vec2 TexCoord;
+out vec3 Tangent;
+out vec3 Bitangent;
+
+uniform mat4 model;
+
+layout (std140) uniform Frame              // per-Frame Camera and Light (FrameUniforms, UniformUtil.h)
+{
+    mat4 view;
+    mat4 projection;
+    vec3 lightPos;
+    vec3 lightColor;
+    vec3 viewPos;
+    vec3 earthPos;
+};
+
+void main()
+{
+    // Tangent Frame of the equirectangular Mapping (u = atan2(z, x), v = -asin(y)):
+    // T = dP/du points east, B = dP/dv = cross(N, T) points south; at the Poles any Perpendicular will do
+    // ---------------------------------------------------------------------------------------------------
+    vec3 tangent = vec3(-aNormal.z, 0.0, aNormal.x);
+    tangent = dot(tangent, tangent) > 1e-12 ? normalize(tangent) : vec3(1.0, 0.0, 0.0);
+
+    FragPos = vec3(model * vec4(aPos, 1.0));
+    Normal = mat3(transpose(inverse(model))) * aNormal;
+    Tangent = mat3(transpose(inverse(model))) * tangent;
+    Bitangent = mat3(transpose(inverse(model))) * cross(aNormal, tangent);
+    TexCoord = vec2(-aTexCoord.x, aTexCoord.y);
+
+    gl_Position = projection * view * vec4(FragPos, 1.0);
+}
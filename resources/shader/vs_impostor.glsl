@@ -0,0 +1,37 @@
+#version 330 core
+// No Vertex Attributes: gl_VertexID 0 - 3 are the Corners of a camera-facing Quad (Triangle Strip)
+// around the Body's Silhouette; fs_impostor.glsl ray traces the Sphere inside it
+
+out vec3 ViewRay;                           // View-space Point on the Quad, the Ray runs from the Camera through it
+
+uniform mat4 model;
+
+layout (std140) uniform Frame              // per-Frame Camera and Light (FrameUniforms, UniformUtil.h)
+{
+    mat4 view;
+    mat4 projection;
+    vec3 lightPos;
+    vec3 lightColor;
+    vec3 viewPos;
+    vec3 earthPos;
+};
+
+void main()
+{
+    vec3 center = vec3(view * model * vec4(0.0, 0.0, 0.0, 1.0));
+    float radius = length(vec3(model[0]));
+    float distance = length(center);
+
+    // Quad through the Center, perpendicular to the Ray towards it: the Cone of Rays touching
+    // the Sphere cuts this Plane in a Circle of Radius r * d / sqrt(d^2 - r^2)
+    // ---------------------------------------------------------------------------------------
+    vec3 forward = center / distance;
+    vec3 right = normalize(cross(forward, abs(forward.y) < 0.99 ? vec3(0.0, 1.0, 0.0) : vec3(1.0, 0.0, 0.0)));
+    vec3 up = cross(right, forward);
+    float extent = radius * distance / sqrt(max(distance * distance - radius * radius, 1e-6));
+
+    vec2 corner = vec2(gl_VertexID & 1, gl_VertexID >> 1) * 2.0 - 1.0;
+    ViewRay = center + (right * corner.x + up * corner.y) * extent;
+
+    gl_Position = projection * vec4(ViewRay, 1.0);
+}
@@ -0,0 +1,37 @@
+#version 330 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aNormal;
+layout (location = 2) in vec2 aTexCoord;
+layout (location = 3) in vec4 aTangent;     // w = Bitangent Handedness
+layout (location = 4) in mat4 aModel;       // per Instance (BodyInstance), Locations 4 - 7
+layout (location = 8) in uvec4 aBody;       // Texture Layer, Normal Map Layer, Flags
+
+out vec3 FragPos;
+out vec3 Normal;
+out vec2 TexCoord;
+out vec3 Tangent;
+out vec3 Bitangent;
+flat out uvec3 Body;
+
+layout (std140) uniform Frame              // per-Frame Camera and Light (FrameUniforms, UniformUtil.h)
+{
+    mat4 view;
+    mat4 projection;
+    vec3 lightPos;
+    vec3 lightColor;
+    vec3 viewPos;
+    vec3 earthPos;
+};
+
+void main()
+{
+    mat3 normalMatrix = mat3(transpose(inverse(aModel)));
+    FragPos = vec3(aModel * vec4(aPos, 1.0));
+    Normal = normalMatrix * aNormal;
+    Tangent = normalMatrix * aTangent.xyz;
+    Bitangent = normalMatrix * (cross(aNormal, aTangent.xyz) * aTangent.w);
+    TexCoord = vec2(-aTexCoord.x, aTexCoord.y);
+    Body = aBody.xyz;
+
+    gl_Position = projection * view * vec4(FragPos, 1.0);
+}
@@ -0,0 +1,27 @@
+#version 330 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec4 aColor;      // streamed per Frame (RGBA8)
+layout (location = 2) in float aHeight;    // Terrain Height in Earth Radii
+
+out vec4 OverlayColor;
+
+uniform mat4 model;
+
+layout (std140) uniform Frame              // per-Frame Camera and Light (FrameUniforms, UniformUtil.h)
+{
+    mat4 view;
+    mat4 projection;
+    vec3 lightPos;
+    vec3 lightColor;
+    vec3 viewPos;
+    vec3 earthPos;
+};
+
+uniform float overlayRadius;                // slightly above the Surface
+uniform float terrainHeightScale;           // 1 while the Terrain is drawn, else 0
+
+void main()
+{
+    OverlayColor = aColor;
+    gl_Position = projection * view * model * vec4(aPos * (overlayRadius + terrainHeightScale * aHeight), 1.0);
+}
@@ -0,0 +1,96 @@
+#version 330 core
+// No Vertex Attributes: gl_InstanceID selects the Icosahedron Face,
+// gl_VertexID the Triangle and Corner inside the Face's Lattice (same Order as generateIcosphere)
+
+out vec3 FragPos;
+out vec3 Normal;
+out vec2 TexCoord;
+out vec3 Tangent;
+out vec3 Bitangent;
+
+uniform mat4 model;
+
+layout (std140) uniform Frame              // per-Frame Camera and Light (FrameUniforms, UniformUtil.h)
+{
+    mat4 view;
+    mat4 projection;
+    vec3 lightPos;
+    vec3 lightColor;
+    vec3 viewPos;
+    vec3 earthPos;
+};
+
+uniform vec3 icosahedronVertices[12];
+uniform ivec3 icosahedronFaces[20];
+uniform int subdivisions;                   // n = 2^level Segments per Face Edge
+
+const float PI = 3.14159265358979;
+
+// Lattice Point A*wa + B*wb + C*wc on the Sphere; summed in ascending Corner Index,
+// so Faces sharing an Edge compute bit-identical Points (no Cracks)
+vec3 latticePoint(ivec3 face, ivec3 weights)
+{
+    int i0 = face.x, i1 = face.y, i2 = face.z;
+    int w0 = weights.x, w1 = weights.y, w2 = weights.z;
+    int t;
+    if (i0 > i1) { t = i0; i0 = i1; i1 = t; t = w0; w0 = w1; w1 = t; }
+    if (i1 > i2) { t = i1; i1 = i2; i2 = t; t = w1; w1 = w2; w2 = t; }
+    if (i0 > i1) { t = i0; i0 = i1; i1 = t; t = w0; w0 = w1; w1 = t; }
+    return normalize(icosahedronVertices[i0] * float(w0) + icosahedronVertices[i1] * float(w1) + icosahedronVertices[i2] * float(w2));
+}
+
+ivec3 latticeWeights(ivec2 rc)
+{
+    return ivec3(subdivisions - rc.x, rc.x - rc.y, rc.y);
+}
+
+float longitudeU(vec3 p)
+{
+    return 0.5 + atan(p.z, p.x) / (2.0 * PI);
+}
+
+void main()
+{
+    ivec3 face = icosahedronFaces[gl_InstanceID];
+
+    // Triangle t of the Face: Row r = floor(sqrt(t)) holds 2r+1 Triangles,
+    // even k = t - r^2 is an upward, odd k a downward Triangle
+    // -------------------------------------------------------------------
+    int triangle = gl_VertexID / 3;
+    int corner = gl_VertexID - triangle * 3;
+    int r = int(sqrt(float(triangle)));
+    if (r * r > triangle) r--;
+    if ((r + 1) * (r + 1) <= triangle) r++;
+    int k = triangle - r * r;
+    int c = k / 2;
+
+    ivec2 corners[3];
+    corners[0] = ivec2(r, c);
+    corners[1] = (k & 1) == 0 ? ivec2(r + 1, c) : ivec2(r + 1, c + 1);
+    corners[2] = (k & 1) == 0 ? ivec2(r + 1, c + 1) : ivec2(r, c + 1);
+
+    vec3 position = latticePoint(face, latticeWeights(corners[corner]));
+
+    // UV: u is unwrapped towards the Triangle Centroid, so no Triangle spans the Date Line;
+    // Pole Vertices take the Centroid's u
+    // ------------------------------------------------------------------------------------
+    vec3 centerWeights = vec3(latticeWeights(corners[0]) + latticeWeights(corners[1]) + latticeWeights(corners[2]));
+    vec3 centroidPoint = normalize(icosahedronVertices[face.x] * centerWeights.x + icosahedronVertices[face.y] * centerWeights.y + icosahedronVertices[face.z] * centerWeights.z);
+    float uCentroid = longitudeU(centroidPoint);
+    float u = abs(position.y) > 1.0 - 1e-6 ? uCentroid : longitudeU(position);
+    u += round(uCentroid - u);
+    float v = 0.5 - asin(clamp(position.y, -1.0, 1.0)) / PI;
+
+    // Analytic Tangent Frame as in vs_analytic.glsl
+    // ---------------------------------------------
+    vec3 tangent = vec3(-position.z, 0.0, position.x);
+    tangent = dot(tangent, tangent) > 1e-12 ? normalize(tangent) : vec3(1.0, 0.0, 0.0);
+
+    FragPos = vec3(model * vec4(position, 1.0));
+    Normal = mat3(transpose(inverse(model))) * position;
+    Tangent = mat3(transpose(inverse(model))) * tangent;
+    Bitangent = mat3(transpose(inverse(model))) * cross(position, tangent);
+    TexCoord = vec2(-u, v);
+
+    gl_Position = projection * view * vec4(FragPos, 1.0);
+}
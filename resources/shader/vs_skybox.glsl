@@ -3,12 +3,19 @@ layout (location = 0) in vec3 aPos;
 
 out vec3 TexCoords;
 
-uniform mat4 view;
-uniform mat4 projection;
+layout (std140) uniform Frame              // per-Frame Camera and Light (FrameUniforms, UniformUtil.h)
+{
+    mat4 view;
+    mat4 projection;
+    vec3 lightPos;
+    vec3 lightColor;
+    vec3 viewPos;
+    vec3 earthPos;
+};
 
 void main()
 {
-	vec4 pos = projection * view * vec4(aPos, 1.0);
+	vec4 pos = projection * mat4(mat3(view)) * vec4(aPos, 1.0);   // Rotation only, the Skybox moves with the Camera
 	gl_Position = pos.xyww;
 	TexCoords = vec3(aPos.x, aPos.y, -aPos.z);
 }
@@ -0,0 +1,96 @@
+#version 330 core
+layout (location = 0) in vec3 aGrid;        // Grid Column and Row (0 - gridSize), 1 for Skirt Vertices
+
+out vec3 FragPos;
+out vec3 Normal;
+out vec2 TexCoord;
+out vec3 Tangent;
+out vec3 Bitangent;
+
+uniform mat4 model;
+
+layout (std140) uniform Frame              // per-Frame Camera and Light (FrameUniforms, UniformUtil.h)
+{
+    mat4 view;
+    mat4 projection;
+    vec3 lightPos;
+    vec3 lightColor;
+    vec3 viewPos;
+    vec3 earthPos;
+};
+
+uniform sampler2D heightTile;               // (gridSize + 1)^2 Heights in Earth Radii, one per Grid Point
+uniform vec3 faceNormal;                    // Cube Face Axes (CUBE_FACE_AXES), V = N x U
+uniform vec3 faceU;
+uniform vec3 faceV;
+uniform vec2 chunkOrigin;                   // Face Coordinates of the Chunk's first Grid Point
+uniform float chunkSize;                    // Face Coordinate Extent of the Chunk
+uniform vec3 chunkCenter;                   // Chunk Center on the unit Sphere
+uniform float gridSize;
+uniform vec3 cameraObjectPos;
+uniform float morphDistance;                // Distance at which the Chunk has to look like its Parent
+uniform float morphStart;
+uniform float skirtDepth;
+
+const float PI = 3.14159265358979;
+
+// Equal-angle Cube Sphere Warp as in generateCubeSphere
+vec3 surfaceDirection(vec2 grid)
+{
+    vec2 warped = tan((chunkOrigin + grid / gridSize * chunkSize) * PI / 4.0);
+    return normalize(faceNormal + faceU * warped.x + faceV * warped.y);
+}
+
+// Bilinear between Grid Points, so half-way Points match the coarser Parent Grid
+vec3 surfacePoint(vec2 grid)
+{
+    float height = texture(heightTile, (grid + 0.5) / (gridSize + 1.0)).r;
+    return surfaceDirection(grid) * (1.0 + height);
+}
+
+float longitudeU(vec3 p)
+{
+    return 0.5 + atan(p.z, p.x) / (2.0 * PI);
+}
+
+void main()
+{
+    // Geomorph: odd Grid Lines slide onto their even Neighbours towards the Parent's Distance,
+    // so switching to the Parent Chunk doesn't pop
+    // ----------------------------------------------------------------------------------------
+    vec2 grid = aGrid.xy;
+    float distance = length(surfacePoint(grid) - cameraObjectPos);
+    float morph = clamp((distance / morphDistance - morphStart) / (1.0 - morphStart), 0.0, 1.0);
+    grid -= fract(grid * 0.5) * 2.0 * morph;
+
+    // Normal from the neighbouring Points (Parent Spacing once morphed), clamped at the Chunk Border
+    // ---------------------------------------------------------------------------------------------
+    float step = 1.0 + morph;
+    vec3 dx = surfacePoint(min(grid + vec2(step, 0.0), vec2(gridSize))) - surfacePoint(max(grid - vec2(step, 0.0), vec2(0.0)));
+    vec3 dy = surfacePoint(min(grid + vec2(0.0, step), vec2(gridSize))) - surfacePoint(max(grid - vec2(0.0, step), vec2(0.0)));
+    vec3 normal = normalize(cross(dx, dy));
+
+    vec3 direction = surfaceDirection(grid);
+    vec3 position = surfacePoint(grid) - direction * skirtDepth * aGrid.z;
+
+    // UV as in vs_procedural.glsl, u unwrapped towards the Chunk Center
+    // -----------------------------------------------------------------
+    float uCenter = longitudeU(chunkCenter);
+    float u = abs(direction.y) > 1.0 - 1e-6 ? uCenter : longitudeU(direction);
+    u += round(uCenter - u);
+    float v = 0.5 - asin(clamp(direction.y, -1.0, 1.0)) / PI;
+
+    // Analytic Tangent Frame as in vs_analytic.glsl, tilted onto the Relief
+    // ---------------------------------------------------------------------
+    vec3 tangent = vec3(-direction.z, 0.0, direction.x);
+    tangent = dot(tangent, tangent) > 1e-12 ? normalize(tangent) : vec3(1.0, 0.0, 0.0);
+    tangent = normalize(tangent - normal * dot(normal, tangent));
+
+    FragPos = vec3(model * vec4(position, 1.0));
+    Normal = mat3(transpose(inverse(model))) * normal;
+    Tangent = mat3(transpose(inverse(model))) * tangent;
+    Bitangent = mat3(transpose(inverse(model))) * cross(normal, tangent);
+    TexCoord = vec2(-u, v);
+
+    gl_Position = projection * view * vec4(FragPos, 1.0);
+}
@@ -0,0 +1,10 @@
+#version 400 core
+layout (location = 0) in vec3 aPos;
+
+// Patch Corners stay in Object Space; the Control Shader measures and the Evaluation Shader projects them
+out vec3 vPosition;
+
+void main()
+{
+    vPosition = aPos;
+}
@@ -100,7 +100,7 @@ void processInput(GLFWwindow* window)
 	float currentFrame = glfwGetTime();
 	deltaTime = currentFrame - lastFrame;
 	lastFrame = currentFrame;
-	float cameraSpeed = 2.5f * deltaTime;
+	float cameraSpeed = 2.5f * deltaTime * glm::clamp(cameraAltitude(), CAMERA_MIN_NEAR, 1.0f);   // slower near the Surface
 
 	// Camera Movement on button press
 	// -------------------------------
@@ -119,3 +119,22 @@ void processInput(GLFWwindow* window)
 	if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
 		glfwSetWindowShouldClose(window, true);
 }
+
+/**
+ * Altitude of the Camera above the Earth Sphere (Sea Level)
+ * @return Altitude in Earth Radii, negative below the Surface
+ */
+float cameraAltitude()
+{
+	return glm::length(cameraPos - earthPos) - 1.0f;
+}
+
+/**
+ * Near Plane Distance for the current Altitude: CAMERA_NEAR_ALTITUDE_RATIO of it,
+ * clamped to CAMERA_MIN_NEAR - CAMERA_MAX_NEAR
+ * @return Near Plane Distance in Earth Radii
+ */
+float cameraNearPlane()
+{
+	return glm::clamp(cameraAltitude() * CAMERA_NEAR_ALTITUDE_RATIO, CAMERA_MIN_NEAR, CAMERA_MAX_NEAR);
+}
@@ -0,0 +1,378 @@
+#include "../include/BodyRendererUtil.h"
+#include "../include/Init.h"
+#include "../include/ImpostorUtil.h"
+#include "../include/UniformUtil.h"
+#include "../include/RenderQueueUtil.h"
+#include "../include/StreamBufferUtil.h"
+
+// Texture Array with its used and allocated Layers
+// ------------------------------------------------
+struct LayerArray
+{
+    unsigned int texture = 0;
+    unsigned int layers = 0;
+    unsigned int capacity = 0;
+    int width = 0;
+    int height = 0;
+};
+
+// Index Range of one LOD Level in the flat Index Buffer
+// -----------------------------------------------------
+struct LevelRange
+{
+    size_t firstIndex;
+    size_t indexCount;
+};
+
+// Instanced Path for one Meshlets Mesh: its VBO with flat 32 bit Indices per LOD Level
+// (Meshlet-local Index plus Base Vertex) and the Instance Buffer, in a VAO of their own
+// -------------------------------------------------------------------------------------
+static MeshHandle instancedMesh = INVALID_MESH_HANDLE;
+static unsigned int instancedProgram = 0;
+static unsigned int instancedVAO = 0, instancedEBO = 0;
+static StreamHandle instanceStream = INVALID_STREAM_HANDLE;
+static unsigned int blitFBOs[2] = { 0, 0 };
+static LevelRange levelRanges[LOD_LEVEL_COUNT];
+static LayerArray surfaceLayers, normalMapLayers;
+
+// Bodies queued by submitBody, per LOD Level
+// ------------------------------------------
+static std::vector<BodyInstance> levelInstances[LOD_LEVEL_COUNT];
+static std::vector<BodyInstance> frameInstances;
+
+/**
+ * Point the Instance Attributes at a Body in the streamed Instance Buffer (bound to GL_ARRAY_BUFFER)
+ * @param base Byte Offset of the first Instance of the next Draw
+ */
+static void pointInstanceAttributes(size_t base)
+{
+    for (unsigned int column = 0; column < 4; column++)
+        glVertexAttribPointer(4 + column, 4, GL_FLOAT, GL_FALSE, sizeof(BodyInstance), (void*)(base + column * sizeof(glm::vec4)));
+    glVertexAttribIPointer(8, 4, GL_UNSIGNED_INT, sizeof(BodyInstance), (void*)(base + sizeof(glm::mat4)));
+}
+
+/**
+ * Bilinear Resampling of an RGB Image (Texel Centers aligned, as glBlitFramebuffer with GL_LINEAR)
+ * @param source Source Texels
+ * @param width Source Width
+ * @param height Source Height
+ * @param resampled Destination Texels
+ * @param targetWidth Destination Width
+ * @param targetHeight Destination Height
+ */
+static void resampleRGB(const unsigned char* source, int width, int height,
+    std::vector<unsigned char>& resampled, int targetWidth, int targetHeight)
+{
+    resampled.resize((size_t)targetWidth * targetHeight * 3);
+    for (int y = 0; y < targetHeight; y++)
+    {
+        float sy = glm::clamp((y + 0.5f) * height / targetHeight - 0.5f, 0.0f, (float)(height - 1));
+        int y0 = (int)sy, y1 = std::min(y0 + 1, height - 1);
+        for (int x = 0; x < targetWidth; x++)
+        {
+            float sx = glm::clamp((x + 0.5f) * width / targetWidth - 0.5f, 0.0f, (float)(width - 1));
+            int x0 = (int)sx, x1 = std::min(x0 + 1, width - 1);
+            for (int c = 0; c < 3; c++)
+            {
+                auto texel = [&](int px, int py) { return (float)source[((size_t)py * width + px) * 3 + c]; };
+                float top = glm::mix(texel(x0, y0), texel(x1, y0), sx - x0);
+                float bottom = glm::mix(texel(x0, y1), texel(x1, y1), sx - x0);
+                resampled[((size_t)y * targetWidth + x) * 3 + c] = (unsigned char)(glm::mix(top, bottom, sy - y0) + 0.5f);
+            }
+        }
+    }
+}
+
+/**
+ * Resample a 2D Texture or an Array Layer into an Array Layer: glBlitFramebuffer where both Framebuffers
+ * are complete, else glCopyTexSubImage3D (same Size, readable Source) or a CPU Copy through glGetTexImage
+ * @param source Source Texture
+ * @param sourceLayer Layer of a Source Array, -1 for a 2D Texture
+ * @param width Source Width
+ * @param height Source Height
+ * @param array Destination Array
+ * @param layer Destination Layer
+ */
+static void blitIntoLayer(unsigned int source, int sourceLayer, int width, int height, const LayerArray& array, unsigned int layer)
+{
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, blitFBOs[0]);
+    if (sourceLayer < 0)
+        glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, source, 0);
+    else
+        glFramebufferTextureLayer(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, source, 0, sourceLayer);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, blitFBOs[1]);
+    glFramebufferTextureLayer(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, array.texture, 0, layer);
+    bool readable = glCheckFramebufferStatus(GL_READ_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+    bool drawable = glCheckFramebufferStatus(GL_DRAW_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+    bool resample = width != array.width || height != array.height;
+
+    if (readable && drawable)
+    {
+        glBlitFramebuffer(0, 0, width, height, 0, 0, array.width, array.height, GL_COLOR_BUFFER_BIT, resample ? GL_LINEAR : GL_NEAREST);
+    }
+    else if (readable && !resample)
+    {
+        glBindTexture(GL_TEXTURE_2D_ARRAY, array.texture);
+        glCopyTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, layer, 0, 0, width, height);
+    }
+    else
+    {
+        // Texels through Client Memory (an Array Source is read whole, then its Layer taken)
+        // ----------------------------------------------------------------------------------
+        int depth = 1;
+        if (sourceLayer >= 0)
+        {
+            glBindTexture(GL_TEXTURE_2D_ARRAY, source);
+            glGetTexLevelParameteriv(GL_TEXTURE_2D_ARRAY, 0, GL_TEXTURE_DEPTH, &depth);
+        }
+        std::vector<unsigned char> texels((size_t)width * height * depth * 3), resampled;
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        if (sourceLayer < 0)
+        {
+            glBindTexture(GL_TEXTURE_2D, source);
+            glGetTexImage(GL_TEXTURE_2D, 0, GL_RGB, GL_UNSIGNED_BYTE, texels.data());
+        }
+        else
+        {
+            glGetTexImage(GL_TEXTURE_2D_ARRAY, 0, GL_RGB, GL_UNSIGNED_BYTE, texels.data());
+        }
+        const unsigned char* slice = &texels[(size_t)width * height * 3 * std::max(sourceLayer, 0)];
+        if (resample)
+            resampleRGB(slice, width, height, resampled, array.width, array.height);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, array.texture);
+        glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, layer, array.width, array.height, 1, GL_RGB, GL_UNSIGNED_BYTE,
+            resample ? resampled.data() : slice);
+        glPixelStorei(GL_PACK_ALIGNMENT, 4);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+/**
+ * Copy a 2D Texture into the next Layer of an Array; the Array is reallocated with twice the Layers
+ * when full and at the larger Size when the Texture is larger than its Layers (present Layers are resampled)
+ * @param array Texture Array
+ * @param texture 2D Texture (any Size)
+ * @return Layer
+ */
+static unsigned int addLayer(LayerArray& array, unsigned int texture)
+{
+    int width = 0, height = 0;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);
+    glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height);
+
+    if (array.layers == array.capacity || width > array.width || height > array.height)
+    {
+        LayerArray grown;
+        grown.capacity = array.layers == array.capacity ? std::max(2u, array.capacity * 2) : array.capacity;
+        grown.width = std::max(array.width, width);
+        grown.height = std::max(array.height, height);
+        glGenTextures(1, &grown.texture);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, grown.texture);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGB8, grown.width, grown.height, grown.capacity, 0, GL_RGB, GL_UNSIGNED_BYTE, NULL);
+
+        for (grown.layers = 0; grown.layers < array.layers; grown.layers++)
+            blitIntoLayer(array.texture, (int)grown.layers, array.width, array.height, grown, grown.layers);
+        if (array.texture != 0)
+            glDeleteTextures(1, &array.texture);
+        array = grown;
+    }
+
+    blitIntoLayer(texture, -1, width, height, array, array.layers);
+    return array.layers++;
+}
+
+/**
+ * Set up instanced Drawing of a registered Mesh for all Bodies using it
+ *
+ * Needs a Meshlets Mesh (the Sphere LOD Chain) and 2D Surfaces; Meshlet-local 16 bit Indices
+ * are read back once and flattened to 32 bit per LOD Level, so one Level of any Number of
+ * Bodies is a single glDrawElementsInstanced. Other Geometry Modes keep drawing Body by Body.
+ * @param mesh Mesh shared by the Bodies
+ * @return False if the Bodies are drawn one by one
+ */
+bool initBodyRenderer(MeshHandle mesh)
+{
+    const GpuMesh& gpuMesh = meshByHandle(mesh);
+    if (gpuMesh.kind != MeshKind::Meshlets || surfaceTextureTarget() != GL_TEXTURE_2D)
+    {
+        std::cout << "Bodies drawn one by one (instancing needs the sphere LOD chain with 2D surfaces)" << std::endl;
+        return false;
+    }
+
+    // Flatten the Meshlets of every Level into one 32 bit Index Range
+    // ---------------------------------------------------------------
+    int eboBytes = 0;
+    glBindBuffer(GL_COPY_READ_BUFFER, gpuMesh.EBO);
+    glGetBufferParameteriv(GL_COPY_READ_BUFFER, GL_BUFFER_SIZE, &eboBytes);
+    std::vector<uint16_t> localIndices(eboBytes / sizeof(uint16_t));
+    glGetBufferSubData(GL_COPY_READ_BUFFER, 0, eboBytes, localIndices.data());
+
+    std::vector<uint32_t> flatIndices;
+    flatIndices.reserve(localIndices.size());
+    for (unsigned int level = 0; level < LOD_LEVEL_COUNT; level++)
+    {
+        levelRanges[level].firstIndex = flatIndices.size();
+        for (const Meshlet& meshlet : gpuMesh.lodMeshlets[level])
+            for (unsigned int i = 0; i < meshlet.indexCount; i++)
+                flatIndices.push_back(meshlet.vertexOffset + localIndices[meshlet.indexOffset + i]);
+        levelRanges[level].indexCount = flatIndices.size() - levelRanges[level].firstIndex;
+    }
+
+    // VAO: Mesh Vertices, flat Indices, Instance Attributes advancing once per Body
+    // -----------------------------------------------------------------------------
+    glGenVertexArrays(1, &instancedVAO);
+    glGenBuffers(1, &instancedEBO);
+    glBindVertexArray(instancedVAO);
+    glBindBuffer(GL_ARRAY_BUFFER, gpuMesh.VBO);
+    applyVertexLayout(sphereVertexLayout());
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, instancedEBO);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, flatIndices.size() * sizeof(uint32_t), flatIndices.data(), GL_STATIC_DRAW);
+
+    for (unsigned int location = 4; location <= 8; location++)
+    {
+        glEnableVertexAttribArray(location);
+        glVertexAttribDivisor(location, 1);
+    }
+    glBindVertexArray(0);
+    instanceStream = createStreamBuffer(BODY_STREAM_INSTANCES * sizeof(BodyInstance));
+
+    glGenFramebuffers(2, blitFBOs);
+    instancedProgram = loadShader(tangentFrameMode == TangentFrameMode::Analytic ? "resources/shader/vs_instanced_analytic.glsl"
+        : "resources/shader/vs_instanced.glsl", "resources/shader/fs_instanced.glsl");
+    instancedMesh = mesh;
+
+    std::cout << "Bodies instanced: one draw per LOD level, flat indices " << flatIndices.size() * sizeof(uint32_t) / (1024.0 * 1024.0)
+        << " MiB" << std::endl;
+    return true;
+}
+
+/**
+ * Load the Surfaces of a Body for the current Geometry Mode, plus their Texture Array Layers
+ * if the Bodies are instanced
+ * @param texturePath Path to the Color Texture
+ * @param normalMapPath Path to the tangent-space Normal Map, nullptr for Bodies without Relief
+ * @return Material
+ */
+Material loadBodyMaterial(const char* texturePath, const char* normalMapPath)
+{
+    Material material;
+    material.texture = loadSurfaceTexture(texturePath, false);
+    material.normalMap = normalMapPath != nullptr ? loadSurfaceTexture(normalMapPath, true)
+        : createFlatNormalMap(surfaceTextureTarget() == GL_TEXTURE_CUBE_MAP);
+
+    if (instancedMesh != INVALID_MESH_HANDLE)
+    {
+        material.textureLayer = addLayer(surfaceLayers, material.texture);
+        if (normalMapPath != nullptr)
+            material.normalLayer = addLayer(normalMapLayers, material.normalMap);
+    }
+    invalidateRenderState();    // Loading binds Textures directly
+    return material;
+}
+
+/**
+ * Queue a Body for drawBodies(), or as a Draw of its own if it is an Impostor
+ * or its Mesh is not instanced
+ * @param shaderProgram Shader Program for Bodies drawn one by one
+ * @param mesh Mesh of the Body
+ * @param lod LOD State of the Body
+ * @param material Material of the Body
+ * @param model Model Matrix of the Body
+ * @param view View Matrix
+ * @param projection Projection Matrix
+ */
+void submitBody(unsigned int shaderProgram, MeshHandle mesh, LodState& lod, const Material& material,
+    const glm::mat4& model, const glm::mat4& view, const glm::mat4& projection)
+{
+    float radiusPixels = projectedRadius(model, view, projection);
+    if (selectImpostor(lod, radiusPixels))
+    {
+        shaderProgram = impostorShaderProgram();
+    }
+    else if (mesh == instancedMesh && material.textureLayer != NO_TEXTURE_LAYER)
+    {
+        bool normalMapped = material.normalLayer != NO_TEXTURE_LAYER;
+        BodyInstance instance = { model, material.textureLayer, normalMapped ? material.normalLayer : 0,
+            normalMapped ? BODY_FLAG_NORMAL_MAP : 0u, 0 };
+        levelInstances[selectLodLevel(lod, radiusPixels)].push_back(instance);
+        return;
+    }
+
+    LodState* state = &lod;
+    submitDraw(renderSortKey(RenderPass::Opaque, shaderProgram, material.texture, meshByHandle(mesh).VAO),
+        [=]()
+    {
+        useProgram(shaderProgram);
+        glUniformMatrix4fv(uniformLocation(shaderProgram, Uniform::Model), 1, GL_FALSE, glm::value_ptr(model));
+        bindMaterial(shaderProgram, material, surfaceTextureTarget());
+        drawMesh(shaderProgram, mesh, *state, model, view, projection);
+    });
+}
+
+/**
+ * Stream all queued Bodies at once and queue one instanced Draw per LOD Level in use.
+ * Back Faces are culled by OpenGL instead of per Body and Meshlet
+ */
+void drawBodies()
+{
+    frameInstances.clear();
+    size_t firstInstance[LOD_LEVEL_COUNT], instanceCount[LOD_LEVEL_COUNT];
+    for (unsigned int level = 0; level < LOD_LEVEL_COUNT; level++)
+    {
+        firstInstance[level] = frameInstances.size();
+        instanceCount[level] = levelInstances[level].size();
+        frameInstances.insert(frameInstances.end(), levelInstances[level].begin(), levelInstances[level].end());
+        levelInstances[level].clear();
+    }
+    if (frameInstances.empty())
+        return;
+
+    StreamRange range = streamData(instanceStream, frameInstances.data(), frameInstances.size() * sizeof(BodyInstance));
+
+    submitDraw(renderSortKey(RenderPass::Opaque, instancedProgram, surfaceLayers.texture, instancedVAO),
+        [firstInstance, instanceCount, range]()
+    {
+        useProgram(instancedProgram);
+        bindTexture(0, GL_TEXTURE_2D_ARRAY, surfaceLayers.texture);
+        glUniform1i(uniformLocation(instancedProgram, Uniform::Texture1), 0);
+        bindTexture(1, GL_TEXTURE_2D_ARRAY, normalMapLayers.texture);
+        glUniform1i(uniformLocation(instancedProgram, Uniform::NormalMap), 1);
+
+        bindVertexArray(instancedVAO);
+        glBindBuffer(GL_ARRAY_BUFFER, range.buffer);
+        glEnable(GL_CULL_FACE);
+        for (unsigned int level = 0; level < LOD_LEVEL_COUNT; level++)
+        {
+            if (instanceCount[level] == 0)
+                continue;
+            pointInstanceAttributes(range.offset + firstInstance[level] * sizeof(BodyInstance));
+            glDrawElementsInstanced(GL_TRIANGLES, (GLsizei)levelRanges[level].indexCount, GL_UNSIGNED_INT,
+                (void*)(levelRanges[level].firstIndex * sizeof(uint32_t)), (GLsizei)instanceCount[level]);
+        }
+        glDisable(GL_CULL_FACE);
+    });
+}
+
+/**
+ * Delete the Instancing Buffers, Texture Arrays and Program
+ */
+void releaseBodyRenderer()
+{
+    if (instancedMesh == INVALID_MESH_HANDLE)
+        return;
+    glDeleteVertexArrays(1, &instancedVAO);
+    glDeleteBuffers(1, &instancedEBO);
+    glDeleteFramebuffers(2, blitFBOs);
+    glDeleteTextures(1, &surfaceLayers.texture);
+    if (normalMapLayers.texture != 0)
+        glDeleteTextures(1, &normalMapLayers.texture);
+    glDeleteProgram(instancedProgram);
+    instancedMesh = INVALID_MESH_HANDLE;
+}
@@ -0,0 +1,399 @@
+#include "../include/ComputeSphereUtil.h"
+#include "../include/UvUtil.h"
+#include "../include/TangentUtil.h"
+#include "../include/StaticIcosphereUtil.h"
+#include "../include/UniformUtil.h"
+#include "../include/VertexCacheUtil.h"
+
+#include <glm/gtc/packing.hpp>
+
+// OpenGL 4.3 Parts missing in the 3.3 GLAD Loader
+// -----------------------------------------------
+#define GL_COMPUTE_SHADER 0x91B9
+#define GL_SHADER_STORAGE_BUFFER 0x90D2
+#define GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT 0x00000001
+#define GL_ELEMENT_ARRAY_BARRIER_BIT 0x00000002
+#define GL_BUFFER_UPDATE_BARRIER_BIT 0x00000200
+
+typedef void (APIENTRYP PFNGLDISPATCHCOMPUTEPROC)(GLuint numGroupsX, GLuint numGroupsY, GLuint numGroupsZ);
+typedef void (APIENTRYP PFNGLMEMORYBARRIERPROC)(GLbitfield barriers);
+static PFNGLDISPATCHCOMPUTEPROC dispatchCompute = nullptr;
+static PFNGLMEMORYBARRIERPROC memoryBarrier = nullptr;
+
+static unsigned int vertexProgram = 0, indexProgram = 0;
+
+/**
+ * Compile and link one Compute Shader
+ * @param path Path to the Compute Shader
+ * @return Shader Program ID, 0 on Failure
+ */
+static unsigned int loadComputeShader(const char* path)
+{
+    std::string code = readFile(path);
+    const char* source = code.c_str();
+    int success;
+    char infoLog[512];
+
+    unsigned int shader = glCreateShader(GL_COMPUTE_SHADER);
+    glShaderSource(shader, 1, &source, NULL);
+    glCompileShader(shader);
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+    if (!success)
+    {
+        glGetShaderInfoLog(shader, 512, NULL, infoLog);
+        std::cout << "ERROR::SHADER::COMPUTE::COMPILATION_FAILED\n" << infoLog << std::endl;
+        glDeleteShader(shader);
+        return 0;
+    }
+
+    unsigned int program = glCreateProgram();
+    glAttachShader(program, shader);
+    glLinkProgram(program);
+    glDeleteShader(shader);
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (!success)
+    {
+        glGetProgramInfoLog(program, 512, NULL, infoLog);
+        std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infoLog << std::endl;
+        glDeleteProgram(program);
+        return 0;
+    }
+    reflectUniforms(program);
+    return program;
+}
+
+/**
+ * Check for an OpenGL 4.3 Context, load the Compute Entry Points and the Sphere Compute Shaders
+ * @return True if the Compute Path can be used
+ */
+bool initComputeShaders()
+{
+    int major = 0, minor = 0;
+    glGetIntegerv(GL_MAJOR_VERSION, &major);
+    glGetIntegerv(GL_MINOR_VERSION, &minor);
+    if (major * 10 + minor < 43)
+        return false;
+
+    dispatchCompute = (PFNGLDISPATCHCOMPUTEPROC)glfwGetProcAddress("glDispatchCompute");
+    memoryBarrier = (PFNGLMEMORYBARRIERPROC)glfwGetProcAddress("glMemoryBarrier");
+    if (dispatchCompute == nullptr || memoryBarrier == nullptr)
+        return false;
+
+    vertexProgram = loadComputeShader("resources/shader/cs_sphere_vertices.glsl");
+    indexProgram = loadComputeShader("resources/shader/cs_sphere_indices.glsl");
+    return vertexProgram != 0 && indexProgram != 0;
+}
+
+/**
+ * Vertices per Face and Level in the Lattice (Row r holds r + 1 Points)
+ */
+static size_t faceVertexCount(unsigned int level)
+{
+    size_t n = (size_t)1 << level;
+    return (n + 1) * (n + 2) / 2;
+}
+
+/**
+ * Row of a Triangle Number: Row R of a Lattice Triangle holds 2R + 1 Triangles (or Blocks)
+ */
+static int latticeRow(int t)
+{
+    int row = (int)std::sqrt((double)t);
+    if (row * row > t)
+        row--;
+    if ((row + 1) * (row + 1) <= t)
+        row++;
+    return row;
+}
+
+// One Block of the GPU Tiling: local Indices and the Lattice Point of every local Vertex
+// --------------------------------------------------------------------------------------
+struct SphereBlock
+{
+    int side;                           // s = min(n, COMPUTE_BLOCK_SIDE)
+    std::vector<unsigned int> indices;  // s^2 Triangles, cache-ordered
+    std::vector<glm::ivec2> lattice;    // (Row, Column) inside an upright Block, in Fetch Order
+};
+
+/**
+ * Build the Block of a Level: Triangles of an upright Lattice Triangle in Row Order
+ * (as generateIcosphere emits a Face), reordered by Tipsify and renumbered in first-use Order
+ * @param level Subdivision Level
+ * @param block Block
+ */
+static void buildSphereBlock(unsigned int level, SphereBlock& block)
+{
+    int s = std::min(1 << level, (int)COMPUTE_BLOCK_SIDE);
+    auto point = [](int r, int c) { return (unsigned int)(r * (r + 1) / 2 + c); };
+    block.side = s;
+    block.indices.clear();
+    for (int r = 0; r < s; r++)
+        for (int k = 0; k < 2 * r + 1; k++)
+        {
+            int c = k / 2;
+            unsigned int triangle[3] = { point(r, c), point(r + 1, c + 1), point(r, c + 1) };
+            if ((k & 1) == 0)
+            {
+                triangle[1] = point(r + 1, c);
+                triangle[2] = point(r + 1, c + 1);
+            }
+            block.indices.insert(block.indices.end(), triangle, triangle + 3);
+        }
+
+    std::vector<unsigned int> vertexRemap;
+    optimizeVertexCache(block.indices.data(), block.indices.size(), (s + 1) * (s + 2) / 2);
+    optimizeVertexFetch(block.indices.data(), block.indices.size(), vertexRemap);
+    block.lattice.resize(vertexRemap.size());
+    for (size_t i = 0; i < vertexRemap.size(); i++)
+    {
+        int r = 0;
+        while ((r + 1) * (r + 2) / 2 <= (int)vertexRemap[i])
+            r++;
+        block.lattice[i] = glm::ivec2(r, (int)vertexRemap[i] - r * (r + 1) / 2);
+    }
+}
+
+/**
+ * Face Lattice Point of a Block Vertex (same Mapping as cs_sphere_vertices.glsl)
+ * @param s Block Side
+ * @param b Block inside its Face
+ * @param lattice (Row, Column) inside an upright Block
+ * @return (Row, Column) in the Face Lattice
+ */
+static glm::ivec2 blockLatticePoint(int s, int b, const glm::ivec2& lattice)
+{
+    int R = latticeRow(b), k = b - R * R;
+    if ((k & 1) == 0)
+        return glm::ivec2(R * s + lattice.x, (k / 2) * s + lattice.y);
+    return glm::ivec2(R * s + s - lattice.x, (k / 2) * s + s - lattice.y);
+}
+
+/**
+ * Meshlets of a GPU-generated Level, one per Block in the Order the Compute Shaders write them
+ * (Offsets relative to the Level). All Vertices lie on the unit Sphere inside the spherical Triangle of the
+ * Block Corners, so the smallest Cap around their mean Direction that holds the Corners bounds them:
+ * Bounding Sphere at the Cap's Base Circle, Normal Cone of the Cap's Angle
+ * @param level Subdivision Level
+ * @param meshlets Meshlets
+ */
+void sphereLevelMeshletsGpu(unsigned int level, std::vector<Meshlet>& meshlets)
+{
+    int n = 1 << level;
+    int s = std::min(n, (int)COMPUTE_BLOCK_SIDE);
+    int blocksPerFace = (n / s) * (n / s);
+    uint32_t vertexCount = (uint32_t)((s + 1) * (s + 2) / 2), indexCount = (uint32_t)(s * s * 3);
+    const glm::ivec2 corners[3] = { glm::ivec2(0, 0), glm::ivec2(s, 0), glm::ivec2(s, s) };
+
+    meshlets.resize((size_t)20 * blocksPerFace);
+    for (int f = 0; f < 20; f++)
+    {
+        const float* a = &ICOSAHEDRON_VERTICES[ICOSAHEDRON_INDICES[f * 3] * 3];
+        const float* b = &ICOSAHEDRON_VERTICES[ICOSAHEDRON_INDICES[f * 3 + 1] * 3];
+        const float* c = &ICOSAHEDRON_VERTICES[ICOSAHEDRON_INDICES[f * 3 + 2] * 3];
+        for (int block = 0; block < blocksPerFace; block++)
+        {
+            glm::vec3 directions[3], axis(0.0f);
+            for (int k = 0; k < 3; k++)
+            {
+                glm::ivec2 p = blockLatticePoint(s, block, corners[k]);
+                directions[k] = glm::normalize(glm::vec3(a[0], a[1], a[2]) * (float)(n - p.x)
+                    + glm::vec3(b[0], b[1], b[2]) * (float)(p.x - p.y) + glm::vec3(c[0], c[1], c[2]) * (float)p.y);
+                axis += directions[k];
+            }
+            axis = glm::normalize(axis);
+            float minDot = std::min(glm::dot(directions[0], axis), std::min(glm::dot(directions[1], axis), glm::dot(directions[2], axis)));
+
+            Meshlet& meshlet = meshlets[(size_t)f * blocksPerFace + block];
+            uint32_t index = (uint32_t)(f * blocksPerFace + block);
+            meshlet.vertexOffset = index * vertexCount;
+            meshlet.vertexCount = vertexCount;
+            meshlet.indexOffset = index * indexCount;
+            meshlet.indexCount = indexCount;
+            meshlet.center[0] = axis.x * minDot;
+            meshlet.center[1] = axis.y * minDot;
+            meshlet.center[2] = axis.z * minDot;
+            meshlet.radius = std::sqrt(std::max(0.0f, 1.0f - minDot * minDot));
+            meshlet.coneAxis[0] = axis.x;
+            meshlet.coneAxis[1] = axis.y;
+            meshlet.coneAxis[2] = axis.z;
+            meshlet.coneCutoff = minDot <= 0.1f ? 1.0f : meshlet.radius;
+        }
+    }
+}
+
+/**
+ * Generate one Sphere Level with the Compute Shaders straight into the shared Vertex and Index Buffers
+ *
+ * cs_sphere_vertices.glsl writes every Block's Lattice Points (Position, Normal, UV, Tangent) in the given Layout,
+ * cs_sphere_indices.glsl the 16 bit Block-local Indices; the Level's Meshlets come from sphereLevelMeshletsGpu.
+ * Nothing is read back, the Barrier only orders the Writes before the Draws
+ * @param level Subdivision Level
+ * @param layout PACKED_VERTEX_LAYOUT or SLIM_VERTEX_LAYOUT
+ * @param vertexBuffer Vertex Buffer (large enough)
+ * @param vertexByteOffset first Byte of the Level in the Vertex Buffer (Multiple of 4)
+ * @param indexBuffer Index Buffer (large enough)
+ * @param indexByteOffset first Byte of the Level in the Index Buffer (Multiple of 4)
+ */
+void generateSphereLevelGpu(unsigned int level, const VertexLayout& layout,
+    unsigned int vertexBuffer, size_t vertexByteOffset, unsigned int indexBuffer, size_t indexByteOffset)
+{
+    int n = 1 << level;
+    SphereBlock block;
+    buildSphereBlock(level, block);
+    size_t vertexCount = (size_t)20 * (n / block.side) * (n / block.side) * block.lattice.size();
+    size_t indexCount = (size_t)20 * n * n * 3;
+
+    int faces[20 * 3];
+    for (int i = 0; i < 20 * 3; i++)
+        faces[i] = (int)ICOSAHEDRON_INDICES[i];
+    uint32_t indexPairs[(COMPUTE_BLOCK_TRIANGLES * 3 + 1) / 2] = {};
+    for (size_t i = 0; i < block.indices.size(); i++)
+        indexPairs[i / 2] |= block.indices[i] << (16 * (i & 1));
+
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, vertexBuffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, indexBuffer);
+
+    glUseProgram(vertexProgram);
+    glUniform3fv(uniformLocation(vertexProgram, Uniform::IcosahedronVertices), 12, ICOSAHEDRON_VERTICES);
+    glUniform3iv(uniformLocation(vertexProgram, Uniform::IcosahedronFaces), 20, faces);
+    glUniform1i(uniformLocation(vertexProgram, Uniform::WordsPerVertex), (int)(layout.stride / 4));
+    glUniform1i(uniformLocation(vertexProgram, Uniform::Subdivisions), n);
+    glUniform1i(uniformLocation(vertexProgram, Uniform::BlockSide), block.side);
+    glUniform2iv(uniformLocation(vertexProgram, Uniform::BlockLattice), (GLsizei)block.lattice.size(), glm::value_ptr(block.lattice[0]));
+    glUniform1ui(uniformLocation(vertexProgram, Uniform::BaseWord), (GLuint)(vertexByteOffset / 4));
+    dispatchCompute((GLuint)((vertexCount + 63) / 64), 1, 1);
+
+    glUseProgram(indexProgram);
+    glUniform1i(uniformLocation(indexProgram, Uniform::Subdivisions), n);
+    glUniform1i(uniformLocation(indexProgram, Uniform::BlockSide), block.side);
+    glUniform1uiv(uniformLocation(indexProgram, Uniform::BlockIndices), (GLsizei)((block.indices.size() + 1) / 2), indexPairs);
+    glUniform1ui(uniformLocation(indexProgram, Uniform::BaseWord), (GLuint)(indexByteOffset / 4));
+    dispatchCompute((GLuint)((indexCount / 2 + 63) / 64), 1, 1);
+    memoryBarrier(GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT | GL_ELEMENT_ARRAY_BARRIER_BIT);
+}
+
+/**
+ * Generate one Level into Scratch Buffers, read it back and compare it with the CPU Generator
+ * Vertex by Vertex (through the Face Lattice Point every Block Vertex stands for); every Triangle
+ * has to face outwards and stay inside its Meshlet's Bounding Sphere and Normal Cone
+ * @param level Subdivision Level
+ * @param layout Vertex Layout the GPU writes
+ * @return True if Positions, Normals, UVs and Tangents agree within Quantization and the Bounds hold
+ */
+bool checkSphereLevelGpu(unsigned int level, const VertexLayout& layout)
+{
+    std::vector<float> vertices, normals, uvs, tangents;
+    std::vector<unsigned int> indices;
+    generateSphereMesh(level, vertices, normals, indices, uvs);
+    generateTangents(vertices, normals, uvs, indices, tangents);
+
+    // CPU Vertex of every Face Lattice Point (generateIcosphere emits every Face's Triangles in Row Order)
+    // ---------------------------------------------------------------------------------------------------
+    int n = 1 << level;
+    size_t perFace = faceVertexCount(level);
+    std::vector<unsigned int> cpuVertex(perFace * 20);
+    auto point = [](int r, int c) { return (size_t)(r * (r + 1) / 2 + c); };
+    for (size_t i = 0; i < indices.size(); i++)
+    {
+        int triangle = (int)(i / 3), face = triangle / (n * n), t = triangle % (n * n), corner = (int)(i % 3);
+        int r = latticeRow(t), k = t - r * r, c = k / 2;
+        size_t lattice = corner == 0 ? point(r, c)
+            : (k & 1) == 0 ? (corner == 1 ? point(r + 1, c) : point(r + 1, c + 1))
+            : (corner == 1 ? point(r + 1, c + 1) : point(r, c + 1));
+        cpuVertex[face * perFace + lattice] = indices[i];
+    }
+
+    // Generate into Scratch Buffers and read back
+    // -------------------------------------------
+    std::vector<Meshlet> meshlets;
+    sphereLevelMeshletsGpu(level, meshlets);
+    SphereBlock block;
+    buildSphereBlock(level, block);
+    size_t vertexCount = (size_t)meshlets.back().vertexOffset + meshlets.back().vertexCount;
+    size_t indexCount = (size_t)meshlets.back().indexOffset + meshlets.back().indexCount;
+
+    unsigned int buffers[2];
+    glGenBuffers(2, buffers);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, buffers[0]);
+    glBufferData(GL_COPY_WRITE_BUFFER, vertexCount * layout.stride, NULL, GL_STREAM_READ);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, buffers[1]);
+    glBufferData(GL_COPY_WRITE_BUFFER, indexCount * sizeof(uint16_t), NULL, GL_STREAM_READ);
+    generateSphereLevelGpu(level, layout, buffers[0], 0, buffers[1], 0);
+    memoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+
+    std::vector<unsigned char> gpuVertices(vertexCount * layout.stride);
+    std::vector<uint16_t> gpuIndices(indexCount);
+    glBindBuffer(GL_COPY_READ_BUFFER, buffers[0]);
+    glGetBufferSubData(GL_COPY_READ_BUFFER, 0, gpuVertices.size(), gpuVertices.data());
+    glBindBuffer(GL_COPY_READ_BUFFER, buffers[1]);
+    glGetBufferSubData(GL_COPY_READ_BUFFER, 0, gpuIndices.size() * sizeof(uint16_t), gpuIndices.data());
+    glDeleteBuffers(2, buffers);
+
+    float positionError = 0.0f, normalError = 0.0f, uvError = 0.0f, tangentDot = 1.0f;
+    size_t blocksPerFace = meshlets.size() / 20, inwardTriangles = 0, outsideBounds = 0;
+    for (size_t m = 0; m < meshlets.size(); m++)
+    {
+        const Meshlet& meshlet = meshlets[m];
+        for (uint32_t i = 0; i < meshlet.vertexCount; i++)
+        {
+            glm::ivec2 lattice = blockLatticePoint(block.side, (int)(m % blocksPerFace), block.lattice[i]);
+            unsigned int cpu = cpuVertex[m / blocksPerFace * perFace + point(lattice.x, lattice.y)];
+            const unsigned char* packed = &gpuVertices[((size_t)meshlet.vertexOffset + i) * layout.stride];
+            float position[3];
+            uint32_t normal, uv, tangent = 0;
+            memcpy(position, packed, sizeof(position));
+            memcpy(&normal, packed + 12, 4);
+            memcpy(&uv, packed + 16, 4);
+            if (layout.stride == sizeof(PackedVertex))
+                memcpy(&tangent, packed + 20, 4);
+
+            glm::vec3 p(vertices[cpu * 3], vertices[cpu * 3 + 1], vertices[cpu * 3 + 2]);
+            glm::vec3 center(meshlet.center[0], meshlet.center[1], meshlet.center[2]);
+            positionError = std::max(positionError, glm::length(glm::vec3(position[0], position[1], position[2]) - p));
+            outsideBounds += glm::length(p - center) > meshlet.radius + 1e-5f;
+            normalError = std::max(normalError, glm::length(glm::vec3(glm::unpackSnorm3x10_1x2(normal)) - p));
+
+            // u only up to whole Turns (both Paths unwrap the Date Line differently), not at the Poles
+            // ----------------------------------------------------------------------------------------
+            glm::vec2 gpuUV = glm::unpackHalf2x16(uv);
+            float du = std::abs(gpuUV.x - uvs[cpu * 2]);
+            du = std::abs(du - std::round(du));
+            if (std::abs(p.y) < 0.99f)
+                uvError = std::max(uvError, du);
+            uvError = std::max(uvError, std::abs(gpuUV.y - uvs[cpu * 2 + 1]));
+
+            // analytic (GPU) against summed Triangle (CPU) Tangents, away from the Poles
+            // --------------------------------------------------------------------------
+            if (layout.stride == sizeof(PackedVertex) && std::abs(p.y) < 0.9f)
+            {
+                glm::vec4 t = glm::unpackSnorm3x10_1x2(tangent);
+                glm::vec4 expected(tangents[cpu * 4], tangents[cpu * 4 + 1], tangents[cpu * 4 + 2], tangents[cpu * 4 + 3]);
+                tangentDot = std::min(tangentDot, glm::dot(glm::vec3(t), glm::vec3(expected)) * (t.w == expected.w ? 1.0f : -1.0f));
+            }
+        }
+
+        // Winding: every Triangle faces away from the Center, and its Normal lies inside the Normal Cone
+        // ---------------------------------------------------------------------------------------------
+        auto gpuPosition = [&](uint16_t local)
+        {
+            glm::vec3 p;
+            memcpy(&p, &gpuVertices[((size_t)meshlet.vertexOffset + local) * layout.stride], sizeof(p));
+            return p;
+        };
+        for (uint32_t i = 0; i < meshlet.indexCount; i += 3)
+        {
+            const uint16_t* triangle = &gpuIndices[meshlet.indexOffset + i];
+            glm::vec3 a = gpuPosition(triangle[0]), b = gpuPosition(triangle[1]), c = gpuPosition(triangle[2]);
+            glm::vec3 normal = glm::cross(b - a, c - a);
+            inwardTriangles += glm::dot(normal, a + b + c) <= 0.0f;
+            float cosine = glm::dot(glm::normalize(normal), glm::vec3(meshlet.coneAxis[0], meshlet.coneAxis[1], meshlet.coneAxis[2]));
+            outsideBounds += meshlet.coneCutoff < 1.0f && cosine < std::sqrt(1.0f - meshlet.coneCutoff * meshlet.coneCutoff) - 1e-5f;
+        }
+    }
+
+    bool ok = positionError < 1e-5f && normalError < 4e-3f && uvError < 2e-3f && tangentDot > 0.9f && inwardTriangles == 0 && outsideBounds == 0;
+    std::cout << "GPU sphere check (level " << level << "): position " << positionError << ", normal " << normalError
+        << ", uv " << uvError << ", tangent dot " << tangentDot << ", inward triangles " << inwardTriangles << ", outside bounds " << outsideBounds
+        << (ok ? " -> ok" : " -> mismatch") << std::endl;
+    return ok;
+}
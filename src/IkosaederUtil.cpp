@@ -1,4 +1,12 @@
 #include "../include/IkosaederUtil.h"
+#include "../include/UniformUtil.h"
+
+const int CUBE_FACE_AXES[6][2][3] =
+{
+    { {  1, 0, 0 }, { 0, 0, -1 } }, { { -1, 0, 0 }, { 0, 0,  1 } },
+    { {  0, 1, 0 }, { 1, 0,  0 } }, { {  0, -1, 0 }, { 1, 0, 0 } },
+    { {  0, 0, 1 }, { 1, 0,  0 } }, { {  0, 0, -1 }, { -1, 0, 0 } }
+};
 
 /**
  * Callback function for window resizing
@@ -28,7 +36,7 @@ std::string readFile(const char* filePath)
  * Utility function to load and compile shaders
  * @param vertexPath Path to the vertex shader
  * @param fragtmentPath Path to the fragment shader
- * @return Shader Program ID
+ * @return Shader Program ID (Uniform Locations reflected, see uniformLocation)
  */
 unsigned int loadShader(const char* vertexPath, const char* fragtmentPath)
 {
@@ -82,6 +90,8 @@ unsigned int loadShader(const char* vertexPath, const char* fragtmentPath)
         glGetProgramInfoLog(shaderProgram, 512, NULL, infoLog);
         std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infoLog << std::endl;
     }
+    else
+        reflectUniforms(shaderProgram);
 
     glDeleteShader(vertexShader);
     glDeleteShader(fragmentShader);
@@ -91,15 +101,56 @@ unsigned int loadShader(const char* vertexPath, const char* fragtmentPath)
 
 /**
  * Function to Subdivide one Triangle into four Triangles and updating Normals and Indices
+ *
+ * In Welded Mode every Edge Midpoint is looked up in a Cache keyed by the two
+ * Edge Indices, so the Midpoint shared by two neighboring Triangles is stored once.
  * @param vertices Vertices of the Mesh
  * @param normals Normals of the Mesh
  * @param indices Indices of the Mesh
+ * @param mode Duplicate or Welded Edge Midpoints
  */
-void subdivide(std::vector<float>& vertices, std::vector<float>& normals, std::vector<unsigned int>& indices)
+void subdivide(std::vector<float>& vertices, std::vector<float>& normals, std::vector<unsigned int>& indices, SubdivisionMode mode)
 {
     std::vector<unsigned int> newIndices;
     std::vector<float> newVertices = vertices;
     std::vector<float> newNormals = normals;
+    newIndices.reserve(indices.size() * 4);
+
+    // Closed Mesh: every Edge is shared by two Triangles -> E = 3F / 2
+    // -----------------------------------------------------------------
+    std::unordered_map<uint64_t, unsigned int> midpointCache;
+    size_t newVertexCount = (mode == SubdivisionMode::Welded) ? indices.size() / 2 : indices.size();
+    if (mode == SubdivisionMode::Welded)
+        midpointCache.reserve(indices.size() / 2);
+    newVertices.reserve(vertices.size() + newVertexCount * 3);
+    newNormals.reserve(normals.size() + newVertexCount * 3);
+
+    // Add (or reuse) the normalized Center Point of an Edge
+    // -----------------------------------------------------
+    auto midpoint = [&](unsigned int a, unsigned int b, const glm::vec3& va, const glm::vec3& vb) -> unsigned int
+    {
+        uint64_t key = 0;
+        if (mode == SubdivisionMode::Welded)
+        {
+            key = (uint64_t)std::min(a, b) << 32 | std::max(a, b);
+            auto it = midpointCache.find(key);
+            if (it != midpointCache.end())
+                return it->second;
+        }
+
+        glm::vec3 v = glm::normalize((va + vb) * 0.5f);
+        unsigned int index = newVertices.size() / 3;
+        newVertices.push_back(v.x);
+        newVertices.push_back(v.y);
+        newVertices.push_back(v.z);
+        newNormals.push_back(v.x);
+        newNormals.push_back(v.y);
+        newNormals.push_back(v.z);
+
+        if (mode == SubdivisionMode::Welded)
+            midpointCache.emplace(key, index);
+        return index;
+    };
 
     for (size_t i = 0; i < indices.size(); i += 3)
     {
@@ -115,37 +166,11 @@ void subdivide(std::vector<float>& vertices, std::vector<float>& normals, std::v
         glm::vec3 v1(vertices[i1 * 3], vertices[i1 * 3 + 1], vertices[i1 * 3 + 2]);
         glm::vec3 v2(vertices[i2 * 3], vertices[i2 * 3 + 1], vertices[i2 * 3 + 2]);
 
-        // Calculate center Points of the Edges and normalize
-        // --------------------------------------------------
-        glm::vec3 v01 = glm::normalize((v0 + v1) * 0.5f);
-        glm::vec3 v12 = glm::normalize((v1 + v2) * 0.5f);
-        glm::vec3 v20 = glm::normalize((v2 + v0) * 0.5f);
-
-        // Add new Vertices and Normals
-        // ----------------------------
-        unsigned int i01 = newVertices.size() / 3;
-        newVertices.push_back(v01.x);
-        newVertices.push_back(v01.y);
-        newVertices.push_back(v01.z);
-        newNormals.push_back(v01.x);
-        newNormals.push_back(v01.y);
-        newNormals.push_back(v01.z);
-
-        unsigned int i12 = newVertices.size() / 3;
-        newVertices.push_back(v12.x);
-        newVertices.push_back(v12.y);
-        newVertices.push_back(v12.z);
-        newNormals.push_back(v12.x);
-        newNormals.push_back(v12.y);
-        newNormals.push_back(v12.z);
-
-        unsigned int i20 = newVertices.size() / 3;
-        newVertices.push_back(v20.x);
-        newVertices.push_back(v20.y);
-        newVertices.push_back(v20.z);
-        newNormals.push_back(v20.x);
-        newNormals.push_back(v20.y);
-        newNormals.push_back(v20.z);
+        // Add new Vertices and Normals at the normalized Center Points of the Edges
+        // -------------------------------------------------------------------------
+        unsigned int i01 = midpoint(i0, i1, v0, v1);
+        unsigned int i12 = midpoint(i1, i2, v1, v2);
+        unsigned int i20 = midpoint(i2, i0, v2, v0);
 
         // Add new Indices
         // ---------------
@@ -169,3 +194,231 @@ void subdivide(std::vector<float>& vertices, std::vector<float>& normals, std::v
     normals = newNormals;
     indices = newIndices;
 }
+
+/**
+ * Generate a Level-N Icosphere directly from the 20 Icosahedron Faces
+ *
+ * Every Face is a triangular Lattice with n = 2^level Segments per Edge.
+ * Lattice Point (r, c) with 0 <= c <= r <= n lies at A*(n-r) + B*(r-c) + C*c
+ * (normalized), Row r holds 2r+1 Triangles. Vertices are stored welded:
+ * 12 Corners, then (n-1) Points per Edge (30 Edges), then the inner Points
+ * of every Face -> 10n^2 + 2 Vertices and 20n^2 Triangles in total.
+ * Corners and Edges are written first, then every Face is filled by a Worker Thread.
+ * @param level Subdivision Level (same Result Size as calling subdivide() level Times)
+ * @param vertices Vertices of the Mesh
+ * @param normals Normals of the Mesh
+ * @param indices Indices of the Mesh
+ */
+void generateIcosphere(unsigned int level, std::vector<float>& vertices, std::vector<float>& normals, std::vector<unsigned int>& indices)
+{
+    const unsigned int n = 1u << level;
+    const size_t edgeStart = 12;
+    const size_t faceStart = edgeStart + 30 * (size_t)(n - 1);
+    const size_t innerPerFace = (size_t)(n - 1) * (n - 2) / 2;
+
+    vertices.resize((10 * (size_t)n * n + 2) * 3);
+    normals.resize(vertices.size());
+    indices.resize(20 * (size_t)n * n * 3);
+
+    // Write one normalized Lattice Point as Vertex and Normal
+    // -------------------------------------------------------
+    auto writeVertex = [&](size_t index, const glm::vec3& p)
+    {
+        glm::vec3 v = glm::normalize(p);
+        vertices[index * 3] = normals[index * 3] = v.x;
+        vertices[index * 3 + 1] = normals[index * 3 + 1] = v.y;
+        vertices[index * 3 + 2] = normals[index * 3 + 2] = v.z;
+    };
+    auto corner = [](unsigned int i)
+    {
+        return glm::vec3(ICOSAHEDRON_VERTICES[i * 3], ICOSAHEDRON_VERTICES[i * 3 + 1], ICOSAHEDRON_VERTICES[i * 3 + 2]);
+    };
+
+    // Find the 30 unique Edges; per Face Edge AB, BC, AC and whether it runs reversed
+    // -------------------------------------------------------------------------------
+    unsigned int edgeCorners[30][2];
+    unsigned int faceEdges[20][3];
+    bool faceEdgeReversed[20][3];
+    unsigned int edgeCount = 0;
+    for (unsigned int f = 0; f < 20; f++)
+    {
+        const unsigned int* face = &ICOSAHEDRON_INDICES[f * 3];
+        const unsigned int ends[3][2] = { { face[0], face[1] }, { face[1], face[2] }, { face[0], face[2] } };
+        for (unsigned int e = 0; e < 3; e++)
+        {
+            unsigned int found = edgeCount;
+            for (unsigned int k = 0; k < edgeCount; k++)
+            {
+                if (std::min(edgeCorners[k][0], edgeCorners[k][1]) == std::min(ends[e][0], ends[e][1]) &&
+                    std::max(edgeCorners[k][0], edgeCorners[k][1]) == std::max(ends[e][0], ends[e][1]))
+                    found = k;
+            }
+            if (found == edgeCount)
+            {
+                edgeCorners[edgeCount][0] = ends[e][0];
+                edgeCorners[edgeCount][1] = ends[e][1];
+                edgeCount++;
+            }
+            faceEdges[f][e] = found;
+            faceEdgeReversed[f][e] = edgeCorners[found][0] != ends[e][0];
+        }
+    }
+
+    // Corners and Edge Points
+    // -----------------------
+    for (unsigned int i = 0; i < 12; i++)
+        writeVertex(i, corner(i));
+    for (unsigned int e = 0; e < 30; e++)
+    {
+        glm::vec3 a = corner(edgeCorners[e][0]);
+        glm::vec3 b = corner(edgeCorners[e][1]);
+        for (unsigned int k = 1; k < n; k++)
+            writeVertex(edgeStart + (size_t)e * (n - 1) + (k - 1), a * (float)(n - k) + b * (float)k);
+    }
+
+    // Fill the inner Points and Triangles of one Face
+    // -----------------------------------------------
+    auto fillFace = [&](unsigned int f)
+    {
+        const unsigned int* face = &ICOSAHEDRON_INDICES[f * 3];
+        glm::vec3 a = corner(face[0]), b = corner(face[1]), c = corner(face[2]);
+        size_t innerStart = faceStart + f * innerPerFace;
+
+        auto edgePoint = [&](unsigned int e, unsigned int k) -> unsigned int
+        {
+            if (faceEdgeReversed[f][e])
+                k = n - k;
+            return (unsigned int)(edgeStart + (size_t)faceEdges[f][e] * (n - 1) + (k - 1));
+        };
+        auto point = [&](unsigned int r, unsigned int col) -> unsigned int
+        {
+            if (r == 0) return face[0];
+            if (r == n && col == 0) return face[1];
+            if (r == n && col == n) return face[2];
+            if (col == 0) return edgePoint(0, r);
+            if (r == n) return edgePoint(1, col);
+            if (col == r) return edgePoint(2, r);
+            return (unsigned int)(innerStart + (size_t)(r - 1) * (r - 2) / 2 + (col - 1));
+        };
+
+        for (unsigned int r = 2; r < n; r++)
+            for (unsigned int col = 1; col < r; col++)
+                writeVertex(point(r, col), a * (float)(n - r) + b * (float)(r - col) + c * (float)col);
+
+        unsigned int* out = &indices[(size_t)f * n * n * 3];
+        for (unsigned int r = 0; r < n; r++)
+        {
+            for (unsigned int col = 0; col <= r; col++)
+            {
+                *out++ = point(r, col);
+                *out++ = point(r + 1, col);
+                *out++ = point(r + 1, col + 1);
+                if (col < r)
+                {
+                    *out++ = point(r, col);
+                    *out++ = point(r + 1, col + 1);
+                    *out++ = point(r, col + 1);
+                }
+            }
+        }
+    };
+
+    // Worker Threads take the next free Face until all 20 are done
+    // ------------------------------------------------------------
+    std::atomic<unsigned int> nextFace(0);
+    unsigned int workerCount = std::max(1u, std::min(20u, std::thread::hardware_concurrency()));
+    std::vector<std::thread> workers;
+    for (unsigned int w = 0; w < workerCount; w++)
+    {
+        workers.emplace_back([&]()
+            {
+                for (unsigned int f = nextFace++; f < 20; f = nextFace++)
+                    fillFace(f);
+            });
+    }
+    for (std::thread& worker : workers)
+        worker.join();
+}
+
+/**
+ * Generate a Level-N Cube Sphere: the six Faces of a Cube as n x n Grids (n = 2^level),
+ * warped equal-angle (Grid Coordinate a -> tan(a * PI/4)) and normalized onto the Sphere.
+ *
+ * Grid Points are keyed by their integer Position on the Cube Surface, so Points on
+ * Cube Edges and Corners are generated once and shared (welded) -> 6n^2 + 2 Vertices and
+ * 12n^2 Triangles, counter-clockwise seen from outside. Each Quad is split along the
+ * Diagonal that points to its Face Center, which keeps the four Quadrants symmetric.
+ * @param level Subdivision Level
+ * @param vertices Vertices of the Mesh
+ * @param normals Normals of the Mesh
+ * @param indices Indices of the Mesh
+ */
+void generateCubeSphere(unsigned int level, std::vector<float>& vertices, std::vector<float>& normals, std::vector<unsigned int>& indices)
+{
+    const int n = 1 << level;
+
+    // Equal-angle Warp of one integer Cube Coordinate in [-n, n] (exact at the Cube Edges)
+    // ------------------------------------------------------------------------------------
+    auto warp = [n](int k) -> float
+    {
+        if (k == n || k == -n)
+            return (float)(k / n);
+        return (float)std::tan((double)k / n * M_PI / 4.0);
+    };
+
+    vertices.clear();
+    normals.clear();
+    indices.clear();
+    vertices.reserve((6 * (size_t)n * n + 2) * 3);
+    normals.reserve(vertices.capacity());
+    indices.reserve(12 * (size_t)n * n * 3);
+    std::unordered_map<uint64_t, unsigned int> pointIndex;
+
+    // Index of the Grid Point at integer Cube Position (x, y, z), each in [-n, n] with Step 2
+    // ---------------------------------------------------------------------------------------
+    auto point = [&](int x, int y, int z) -> unsigned int
+    {
+        uint64_t key = ((uint64_t)(x + n) << 32) | ((uint64_t)(y + n) << 16) | (uint64_t)(z + n);
+        auto found = pointIndex.find(key);
+        if (found != pointIndex.end())
+            return found->second;
+
+        glm::vec3 v = glm::normalize(glm::vec3(warp(x), warp(y), warp(z)));
+        unsigned int index = (unsigned int)(vertices.size() / 3);
+        for (int c = 0; c < 3; c++)
+        {
+            vertices.push_back(v[c]);
+            normals.push_back(v[c]);
+        }
+        pointIndex.emplace(key, index);
+        return index;
+    };
+
+    for (int f = 0; f < 6; f++)
+    {
+        const int* N = CUBE_FACE_AXES[f][0];
+        const int* U = CUBE_FACE_AXES[f][1];
+        const int V[3] = { N[1] * U[2] - N[2] * U[1], N[2] * U[0] - N[0] * U[2], N[0] * U[1] - N[1] * U[0] };
+        auto gridPoint = [&](int i, int j)
+        {
+            int a = 2 * i - n, b = 2 * j - n;
+            return point(N[0] * n + U[0] * a + V[0] * b, N[1] * n + U[1] * a + V[1] * b, N[2] * n + U[2] * a + V[2] * b);
+        };
+
+        for (int j = 0; j < n; j++)
+        {
+            for (int i = 0; i < n; i++)
+            {
+                unsigned int p00 = gridPoint(i, j), p10 = gridPoint(i + 1, j);
+                unsigned int p11 = gridPoint(i + 1, j + 1), p01 = gridPoint(i, j + 1);
+                const unsigned int quad[2][6] =
+                {
+                    { p00, p10, p11, p00, p11, p01 },   // Diagonal p00 - p11
+                    { p00, p10, p01, p10, p11, p01 }    // Diagonal p10 - p01
+                };
+                bool towardsCenter = (2 * i + 1 < n) == (2 * j + 1 < n);
+                indices.insert(indices.end(), quad[towardsCenter ? 0 : 1], quad[towardsCenter ? 0 : 1] + 6);
+            }
+        }
+    }
+}
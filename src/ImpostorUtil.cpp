@@ -0,0 +1,56 @@
+#include "../include/ImpostorUtil.h"
+#include "../include/Init.h"
+#include "../include/UniformUtil.h"
+#include "../include/RenderQueueUtil.h"
+
+static unsigned int impostorProgram = 0, impostorVAO = 0;
+
+/**
+ * Load the Impostor Shader Program for the current Geometry Mode (Cube Map Surfaces for Cube Spheres)
+ * and create the empty VAO the Quads are drawn from
+ */
+void initImpostors()
+{
+    bool cube = sphereGeometryMode == SphereGeometryMode::CubeSphere;
+    impostorProgram = loadShader("resources/shader/vs_impostor.glsl",
+        cube ? "resources/shader/fs_impostor_cube.glsl" : "resources/shader/fs_impostor.glsl");
+    glGenVertexArrays(1, &impostorVAO);
+}
+
+/**
+ * Shader Program for Bodies drawn as Impostors; takes the same Uniforms and Material as the Sphere Program
+ * @return Shader Program
+ */
+unsigned int impostorShaderProgram()
+{
+    return impostorProgram;
+}
+
+/**
+ * Decide whether a Body is drawn as Impostor: below IMPOSTOR_MAX_RADIUS_PIXELS,
+ * back to the Mesh only once it is IMPOSTOR_HYSTERESIS_PIXELS larger
+ * @param state LOD State of the Body
+ * @param radiusPixels projected Radius in Pixels
+ * @return True for an Impostor
+ */
+bool selectImpostor(LodState& state, float radiusPixels)
+{
+    float threshold = IMPOSTOR_MAX_RADIUS_PIXELS + (state.impostor ? IMPOSTOR_HYSTERESIS_PIXELS : 0.0f);
+    state.impostor = impostorProgram != 0 && radiusPixels < threshold;
+    return state.impostor;
+}
+
+/**
+ * Draw a Body as Impostor: one Quad of 4 Vertices, the Fragment Shader intersects the Sphere
+ * and writes its Depth, so the Body still occludes and is occluded correctly
+ * @param shaderProgram Impostor Shader Program, Uniforms and Material of the Body already set
+ * @param model Model Matrix of the Body
+ * @param view View Matrix
+ */
+void drawImpostor(unsigned int shaderProgram, const glm::mat4& model, const glm::mat4& view)
+{
+    glm::mat4 objectFromView = glm::inverse(view * model);
+    glUniformMatrix4fv(uniformLocation(shaderProgram, Uniform::ObjectFromView), 1, GL_FALSE, glm::value_ptr(objectFromView));
+    bindVertexArray(impostorVAO);
+    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+}
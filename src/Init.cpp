@@ -1,9 +1,22 @@
 #include "../include/Init.h"
 #include "../include/BackgroundUtil.h"
-
-extern std::vector<float> vertices, normals, uvs, moonVertices, moonNormals, moonUVs;
-extern std::vector<unsigned int> indices, moonIndices;
-extern unsigned int VBO, VAO, EBO, normalVBO, uvVBO;
+#include "../include/MeshCacheUtil.h"
+#include "../include/VertexLayoutUtil.h"
+#include "../include/MeshletUtil.h"
+#include "../include/LodUtil.h"
+#include "../include/VertexCacheUtil.h"
+#include "../include/TangentUtil.h"
+#include "../include/UvUtil.h"
+#include "../include/ProceduralSphereUtil.h"
+#include "../include/ComputeSphereUtil.h"
+#include "../include/TessellationSphereUtil.h"
+#include "../include/MeshRegistryUtil.h"
+#include "../include/StaticIcosphereUtil.h"
+
+extern unsigned int VBO, VAO, EBO;
+
+TangentFrameMode tangentFrameMode = TangentFrameMode::Stored;
+SphereGeometryMode sphereGeometryMode = SphereGeometryMode::Buffers;
 
 /**
  * Initialize GLFW and GLAD
@@ -14,7 +27,7 @@ GLFWwindow* initGLFW_GLAD()
     // Initialize and Configure GLFW
     // ------------------------------
     glfwInit();
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
@@ -22,10 +35,16 @@ GLFWwindow* initGLFW_GLAD()
         glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
     #endif
 
-    // GLFW Window Creation
-    // --------------------
+    // GLFW Window Creation: OpenGL 4.3 for Compute Shaders if available, else 3.3
+    // ---------------------------------------------------------------------------
     GLFWwindow* window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "Orbit", NULL, NULL);
     if (window == NULL)
+    {
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "Orbit", NULL, NULL);
+    }
+    if (window == NULL)
     {
         std::cout << "Failed to create GLFW window" << std::endl;
         glfwTerminate();
@@ -52,191 +71,385 @@ GLFWwindow* initGLFW_GLAD()
 }
 
 /**
-* Calculate the Tangent and Bitangent of a Triangle
-* @param tangent Tangent
-* @param bitangent Bitangent
-* @param pos1 Vertex 1
-* @param pos2 Vertex 2
-* @param pos3 Vertex 3
-* @param uv1 UV 1
-* @param uv2 UV 2
-* @param uv3 UV 3
-*/
-void calculateTangent_Bitangent(
-    glm::vec3& tangent, glm::vec3& bitangent,
-    glm::vec3 pos1, glm::vec3 pos2, glm::vec3 pos3,
-    glm::vec2 uv1, glm::vec2 uv2, glm::vec2 uv3)
+ * CPU Side of one LOD Level: either mapped from the Cache File or freshly generated
+ */
+struct SphereLevel
 {
-    // Edges of the triangle; position delta (diff)
-    // --------------------------------------------
-    glm::vec3 edge1 = pos2 - pos1;
-    glm::vec3 edge2 = pos3 - pos1;
-    glm::vec2 deltaUV1 = uv2 - uv1;
-    glm::vec2 deltaUV2 = uv3 - uv1;
-
-    // Scale
-    // -----
-    float f = 1.0f / (deltaUV1.x * deltaUV2.y - deltaUV2.x * deltaUV1.y);
-
-    // Calculate Tangent and Bitangent ->
-    // UV-Differences combined with Edge Differences
-    // ---------------------------------------------
-    tangent.x = f * (deltaUV2.y * edge1.x - deltaUV1.y * edge2.x);
-    tangent.y = f * (deltaUV2.y * edge1.y - deltaUV1.y * edge2.y);
-    tangent.z = f * (deltaUV2.y * edge1.z - deltaUV1.y * edge2.z);
-    tangent = glm::normalize(tangent);
-
-    bitangent.x = f * (-deltaUV2.x * edge1.x + deltaUV1.x * edge2.x);
-    bitangent.y = f * (-deltaUV2.x * edge1.y + deltaUV1.x * edge2.y);
-    bitangent.z = f * (-deltaUV2.x * edge1.z + deltaUV1.x * edge2.z);
-    bitangent = glm::normalize(bitangent);
+    MeshCache cache;
+    std::vector<MeshStream> streams;
+    std::vector<unsigned char> vertices;
+    std::vector<uint16_t> indices;
+    std::vector<Meshlet> meshlets;
+};
+
+/**
+ * Vertex Layout of the Sphere in the current Tangent Frame Mode
+ * @return Vertex Layout
+ */
+const VertexLayout& sphereVertexLayout()
+{
+    if (sphereGeometryMode == SphereGeometryMode::CubeSphere)
+        return SLIM_VERTEX_LAYOUT;
+    if (sphereGeometryMode == SphereGeometryMode::Tessellated)
+        return POSITION_VERTEX_LAYOUT;
+    return tangentFrameMode == TangentFrameMode::Analytic ? SLIM_VERTEX_LAYOUT : PACKED_VERTEX_LAYOUT;
 }
 
 /**
- * Calculate Tangents and Bitangents for a Mesh.
- * Calculation based on Vertices, UVs and Indices
- * @param vertices Vertices
- * @param uvs UVs
- * @param indices Indices
- * @param tangents Tangents
- * @param bitangents Bitangents
+ * Texture Target of the Body Surfaces in the current Geometry Mode
+ * @return GL_TEXTURE_CUBE_MAP for Cube Spheres, else GL_TEXTURE_2D
  */
-void tangentStuff(
-    const std::vector<float>& vertices,
-    const std::vector<float>& uvs,
-    const std::vector<unsigned int>& indices,
-    std::vector<float>& tangents,
-    std::vector<float>& bitangents)
+GLenum surfaceTextureTarget()
 {
-    tangents.resize(vertices.size(), 0.0f);
-    bitangents.resize(vertices.size(), 0.0f);
+    return sphereGeometryMode == SphereGeometryMode::CubeSphere ? GL_TEXTURE_CUBE_MAP : GL_TEXTURE_2D;
+}
 
-    // Loop through all Triangles
-    // --------------------------
-    for (int i = 0; i < indices.size(); i += 3)
+/**
+ * Load an equirectangular Body Texture for the current Geometry Mode
+ * @param path Path to the Texture
+ * @param normalMap True for a tangent-space Normal Map
+ * @return Texture ID (bound to surfaceTextureTarget())
+ */
+unsigned int loadSurfaceTexture(const char* path, bool normalMap)
+{
+    if (sphereGeometryMode == SphereGeometryMode::CubeSphere)
+        return loadEquirectCubeMap(path, normalMap);
+    return loadTexture(path);
+}
+
+/**
+ * Copy packed Vertices into a Byte Stream in a new Order
+ * @param packed packed Vertices
+ * @param stride Bytes per Vertex
+ * @param order Source Vertex for every Output Vertex
+ * @param bytes Output Byte Stream
+ */
+static void reorderVertices(const unsigned char* packed, size_t stride, const std::vector<unsigned int>& order, std::vector<unsigned char>& bytes)
+{
+    bytes.resize(order.size() * stride);
+    for (size_t i = 0; i < order.size(); i++)
+        memcpy(&bytes[i * stride], packed + order[i] * stride, stride);
+}
+
+/**
+ * Index Stream as drawn: every Meshlet's local Indices offset by its Base Vertex
+ * @param meshlets Meshlets
+ * @param meshletIndices local Indices
+ * @param drawnIndices Indices into the meshlet-ordered Vertices
+ */
+static void drawnMeshletIndices(const std::vector<Meshlet>& meshlets, const std::vector<uint16_t>& meshletIndices, std::vector<unsigned int>& drawnIndices)
+{
+    drawnIndices.resize(meshletIndices.size());
+    for (const Meshlet& meshlet : meshlets)
+        for (unsigned int i = 0; i < meshlet.indexCount; i++)
+            drawnIndices[meshlet.indexOffset + i] = meshlet.vertexOffset + meshletIndices[meshlet.indexOffset + i];
+}
+
+/**
+ * Check that every Meshlet of a cached Level stays inside the Vertex and Index Streams
+ * and its local Indices inside its own Vertex Range
+ * @param streams packed Vertices, local Indices, Meshlets
+ * @param stride Bytes per Vertex
+ * @return True if the Level can be drawn without reading out of Bounds
+ */
+static bool meshletsInRange(const std::vector<MeshStream>& streams, size_t stride)
+{
+    size_t vertexCount = streams[0].size / stride, indexCount = streams[1].size / sizeof(uint16_t);
+    const uint16_t* indices = (const uint16_t*)streams[1].data;
+    const Meshlet* meshlets = (const Meshlet*)streams[2].data;
+    for (size_t m = 0; m < streams[2].size / sizeof(Meshlet); m++)
+    {
+        const Meshlet& meshlet = meshlets[m];
+        if ((size_t)meshlet.vertexOffset + meshlet.vertexCount > vertexCount || (size_t)meshlet.indexOffset + meshlet.indexCount > indexCount)
+            return false;
+        for (uint32_t i = 0; i < meshlet.indexCount; i++)
+            if (indices[meshlet.indexOffset + i] >= meshlet.vertexCount)
+                return false;
+    }
+    return true;
+}
+
+/**
+ * Map one Sphere Level from its Cache File, or generate it on the CPU,
+ * pack it into Meshlets and write the Cache File
+ * Stream Order: meshlet-ordered packed Vertices, local Indices, Meshlets
+ * @param level Subdivision Level
+ * @param sphere CPU Side of the Level; Streams stay valid until its Cache is closed
+ * @return True if the Level was mapped from the Cache
+ */
+static bool loadSphereLevel(unsigned int level, SphereLevel& sphere)
+{
+    bool cube = sphereGeometryMode == SphereGeometryMode::CubeSphere;
+    bool analytic = tangentFrameMode == TangentFrameMode::Analytic;
+    uint32_t vertexFormat = cube ? VERTEX_FORMAT_CUBE_SPHERE_20
+        : analytic ? VERTEX_FORMAT_PACKED_20 : VERTEX_FORMAT_PACKED_24;
+    size_t stride = sphereVertexLayout().stride;
+    std::string cachePath = meshCachePath(level, vertexFormat);
+    const std::vector<MeshStreamSpec> expectedStreams =
+    {
+        { stride, MeshStreamCount::Vertices },
+        { sizeof(uint16_t), MeshStreamCount::Indices },
+        { sizeof(Meshlet), MeshStreamCount::Any }
+    };
+    if (openMeshCache(cachePath, level, vertexFormat, expectedStreams, sphere.cache))
+    {
+        if (meshletsInRange(sphere.cache.streams, stride))
+        {
+            sphere.streams = sphere.cache.streams;
+            return true;
+        }
+        std::cout << "Mesh cache " << cachePath << " has meshlets outside its streams, regenerating" << std::endl;
+        closeMeshCache(sphere.cache);
+    }
+
+    // Generate the Sphere straight from the Icosahedron Faces
+    // (Levels up to STATIC_ICOSPHERE_MAX_LEVEL are copied from the Executable)
+    // ------------------------------------------------------------------------
+    std::vector<float> vertices, normals, uvs, tangents;
+    std::vector<unsigned int> indices;
+    std::vector<unsigned char> packedVertices;
+
+    // Cube Spheres are textured by Direction and need no UVs
+    // ------------------------------------------------------
+    if (cube)
+    {
+        generateCubeSphere(level, vertices, normals, indices);
+        uvs.assign(vertices.size() / 3 * 2, 0.0f);
+    }
+    else
+    {
+        generateSphereMesh(level, vertices, normals, indices, uvs);
+    }
+
+    // Tangent Requirements for Normal Mapping (skipped if the Shader derives them)
+    // ----------------------------------------------------------------------------
+    if (cube || analytic)
+    {
+        std::vector<SlimVertex> packed;
+        packVertices(vertices, normals, uvs, packed);
+        packedVertices.assign((const unsigned char*)packed.data(), (const unsigned char*)(packed.data() + packed.size()));
+    }
+    else
     {
-        unsigned int i0 = indices[i] * 3;
-        unsigned int i1 = indices[i + 1] * 3;
-        unsigned int i2 = indices[i + 2] * 3;
+        generateTangents(vertices, normals, uvs, indices, tangents);
+        std::vector<PackedVertex> packed;
+        packVertices(vertices, normals, uvs, tangents, packed);
+        packedVertices.assign((const unsigned char*)packed.data(), (const unsigned char*)(packed.data() + packed.size()));
+    }
 
-        // Defining the Vertices and UV-Coords of the Triangle
-        // ---------------------------------------------------
-        glm::vec3 pos1(vertices[i0], vertices[i0 + 1], vertices[i0 + 2]);
-        glm::vec3 pos2(vertices[i1], vertices[i1 + 1], vertices[i1 + 2]);
-        glm::vec3 pos3(vertices[i2], vertices[i2 + 1], vertices[i2 + 2]);
+    // Reorder the welded Triangles for the Vertex Cache (Tipsify), then cut the Meshlets from that Stream;
+    // every Meshlet gets its own contiguous Vertex Range, renumbered in first-use Order
+    // -----------------------------------------------------------------------------------------------------
+    size_t vertexCount = vertices.size() / 3;
+    VertexCacheStats before = analyzeVertexCache(indices.data(), indices.size(), vertexCount);
+    optimizeVertexCache(indices.data(), indices.size(), vertexCount);
+    VertexCacheStats after = analyzeVertexCache(indices.data(), indices.size(), vertexCount);
+
+    std::vector<unsigned int> meshletVertices, drawnIndices;
+    buildMeshlets(vertices, indices, sphere.meshlets, meshletVertices, sphere.indices);
+    optimizeMeshlets(sphere.meshlets, meshletVertices, sphere.indices);
+    reorderVertices(packedVertices.data(), stride, meshletVertices, sphere.vertices);
+
+    // Report Vertex Cache Efficiency of the welded Stream before and after Tipsify, and of the drawn Meshlets
+    // against their Floor (every duplicated Meshlet Vertex is transformed at least once)
+    // -------------------------------------------------------------------------------------------------------
+    drawnMeshletIndices(sphere.meshlets, sphere.indices, drawnIndices);
+    VertexCacheStats drawn = analyzeVertexCache(drawnIndices.data(), drawnIndices.size(), meshletVertices.size());
+    std::cout << "Sphere Level " << level << " vertex cache (FIFO " << VERTEX_CACHE_SIZE << "): ACMR "
+        << before.acmr << " -> " << after.acmr << ", ATVR " << before.atvr << " -> " << after.atvr
+        << "; meshlets ACMR " << drawn.acmr << " (floor " << meshletVertices.size() * 3.0f / drawnIndices.size() << ")" << std::endl;
+
+    sphere.streams =
+    {
+        { sphere.vertices.data(), sphere.vertices.size() },
+        { sphere.indices.data(), sphere.indices.size() * sizeof(uint16_t) },
+        { sphere.meshlets.data(), sphere.meshlets.size() * sizeof(Meshlet) }
+    };
+    if (!writeMeshCache(cachePath, level, vertexFormat, meshletVertices.size(), sphere.indices.size(), sphere.streams))
+        std::cout << "Failed to write mesh cache " << cachePath << std::endl;
+    return false;
+}
 
-        glm::vec2 uv1(uvs[i0 / 3 * 2], uvs[i0 / 3 * 2 + 1]);
-        glm::vec2 uv2(uvs[i1 / 3 * 2], uvs[i1 / 3 * 2 + 1]);
-        glm::vec2 uv3(uvs[i2 / 3 * 2], uvs[i2 / 3 * 2 + 1]);
+/**
+ * Fill the bound VAO's VBO and EBO with the Sphere LOD Chain on the GPU: the Compute Shaders write
+ * every Level's Meshlets (fixed Face Lattice Tiling) straight into the shared Buffers, Nothing is read back
+ * @param layout Vertex Layout of the Tangent Frame Mode
+ * @param vboBytes VBO Size
+ * @param eboBytes EBO Size
+ */
+static void generateSphereBuffersGpu(const VertexLayout& layout, size_t& vboBytes, size_t& eboBytes)
+{
+    std::vector<Meshlet> levels[LOD_LEVEL_COUNT];
+    for (unsigned int level = 0; level < LOD_LEVEL_COUNT; level++)
+    {
+        sphereLevelMeshletsGpu(level, levels[level]);
+        vboBytes += ((size_t)levels[level].back().vertexOffset + levels[level].back().vertexCount) * layout.stride;
+        eboBytes += ((size_t)levels[level].back().indexOffset + levels[level].back().indexCount) * sizeof(uint16_t);
+    }
 
-        glm::vec3 tangent, bitangent;
-        calculateTangent_Bitangent(tangent, bitangent, pos1, pos2, pos3, uv1, uv2, uv3);
+    glBufferData(GL_ARRAY_BUFFER, vboBytes, NULL, GL_STATIC_DRAW);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, eboBytes, NULL, GL_STATIC_DRAW);
 
-        for (int j = 0; j < 3; j++)
+    // Dispatch Level by Level and move its Meshlets to their Place (Level Sizes are Multiples of 4 Bytes)
+    // ---------------------------------------------------------------------------------------------------
+    size_t vboOffset = 0, eboOffset = 0;
+    for (unsigned int level = 0; level < LOD_LEVEL_COUNT; level++)
+    {
+        generateSphereLevelGpu(level, layout, VBO, vboOffset, EBO, eboOffset);
+        sphereLodMeshlets[level] = levels[level];
+        for (Meshlet& meshlet : sphereLodMeshlets[level])
         {
-            tangents[i0 + j] += tangent[j];
-            tangents[i1 + j] += tangent[j];
-            tangents[i2 + j] += tangent[j];
+            meshlet.vertexOffset += (uint32_t)(vboOffset / layout.stride);
+            meshlet.indexOffset += (uint32_t)(eboOffset / sizeof(uint16_t));
+        }
+        vboOffset += ((size_t)levels[level].back().vertexOffset + levels[level].back().vertexCount) * layout.stride;
+        eboOffset += ((size_t)levels[level].back().indexOffset + levels[level].back().indexCount) * sizeof(uint16_t);
+    }
+}
+
+/**
+ * Fill the bound VAO's VBO and EBO with the Sphere LOD Chain from the CPU
+ * (Levels mapped from the Cache or generated), Meshlets offset into the shared Buffers
+ * @param layout Vertex Layout of the Tangent Frame Mode
+ * @param vboBytes VBO Size
+ * @param eboBytes EBO Size
+ * @return Number of Levels mapped from the Cache
+ */
+static unsigned int loadSphereBuffersCpu(const VertexLayout& layout, size_t& vboBytes, size_t& eboBytes)
+{
+    // Load all Levels and sum up the Buffer Sizes
+    // -------------------------------------------
+    std::vector<SphereLevel> levels(LOD_LEVEL_COUNT);
+    unsigned int cachedLevels = 0;
+    for (unsigned int level = 0; level < LOD_LEVEL_COUNT; level++)
+    {
+        cachedLevels += loadSphereLevel(level, levels[level]);
+        vboBytes += levels[level].streams[0].size;
+        eboBytes += levels[level].streams[1].size;
+    }
+
+    glBufferData(GL_ARRAY_BUFFER, vboBytes, NULL, GL_STATIC_DRAW);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, eboBytes, NULL, GL_STATIC_DRAW);
+
+    // Upload Level by Level and move its Meshlets to their Place in the shared Buffers
+    // --------------------------------------------------------------------------------
+    size_t vboOffset = 0, eboOffset = 0;
+    for (unsigned int level = 0; level < LOD_LEVEL_COUNT; level++)
+    {
+        const std::vector<MeshStream>& streams = levels[level].streams;
+        glBufferSubData(GL_ARRAY_BUFFER, vboOffset, streams[0].size, streams[0].data);
+        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, eboOffset, streams[1].size, streams[1].data);
 
-            bitangents[i0 + j] += bitangent[j];
-            bitangents[i1 + j] += bitangent[j];
-            bitangents[i2 + j] += bitangent[j];
+        const Meshlet* meshlets = (const Meshlet*)streams[2].data;
+        sphereLodMeshlets[level].assign(meshlets, meshlets + streams[2].size / sizeof(Meshlet));
+        for (Meshlet& meshlet : sphereLodMeshlets[level])
+        {
+            meshlet.vertexOffset += (uint32_t)(vboOffset / layout.stride);
+            meshlet.indexOffset += (uint32_t)(eboOffset / sizeof(uint16_t));
         }
+
+        vboOffset += streams[0].size;
+        eboOffset += streams[1].size;
+        closeMeshCache(levels[level].cache);
     }
+    return cachedLevels;
+}
+
+/**
+ * Fill the bound VAO's VBO and EBO with the Sphere LOD Chain and report it
+ * @param layout Vertex Layout of the Tangent Frame Mode
+ * @param gpu True to generate the Levels with the Compute Shaders (checked already), else on the CPU or from the Cache
+ */
+static void initSphereBuffers(const VertexLayout& layout, bool gpu)
+{
+    auto meshStart = std::chrono::steady_clock::now();
+    size_t vboBytes = 0, eboBytes = 0;
+    unsigned int cachedLevels = 0;
+    if (gpu)
+        generateSphereBuffersGpu(layout, vboBytes, eboBytes);
+    else
+        cachedLevels = loadSphereBuffersCpu(layout, vboBytes, eboBytes);
+
+    // Report Load Time and Buffer Sizes
+    // ---------------------------------
+    double meshMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - meshStart).count();
+    std::cout << "Sphere LOD Chain (levels 0-" << LOD_MAX_LEVEL << ", ";
+    if (gpu)
+        std::cout << "compute shaders";
+    else
+        std::cout << cachedLevels << " mapped from cache";
+    std::cout << "): " << vboBytes / layout.stride << " vertices (" << layout.stride << " bytes each), "
+        << eboBytes / (3 * sizeof(uint16_t)) << " triangles, " << meshMs << " ms, VBO " << vboBytes / (1024.0 * 1024.0)
+        << " MiB, EBO " << eboBytes / (1024.0 * 1024.0) << " MiB" << std::endl;
 }
 
 /**
  * Initialize Shaders and Buffers
  *
- * Sets the initial vertices, normals and indices
+ * Loads the Sphere LOD Chain (Levels 0 - LOD_MAX_LEVEL) into one shared VBO and EBO: on OpenGL 4.3+
+ * Compute Shaders write it there as fixed Meshlet Tiles, else the CPU generates it, splits it into
+ * cache-optimized Meshlets and caches it; the Meshlets of every Level are offset into these Buffers.
+ * Shader and Vertex Layout follow the Tangent Frame Mode.
+ * In procedural Geometry Mode only an empty VAO is created, in tessellated Mode
+ * the Buffers hold the Patch Mesh (falls back to the LOD Chain below OpenGL 4.0).
+ * The Sphere is registered once as SPHERE_MESH_NAME and shared by all Bodies
  * @return Shader Program
  */
 unsigned int initShaders_Buffers()
 {
-    unsigned int shaderProgram = loadShader("resources/shader/vs.glsl", "resources/shader/fs.glsl");
-
-    // set up vertex data and buffers
-    // ------------------------------
-    float X = 0.52573111212f, Z = 0.85065080835f;
-    vertices =
+    if (sphereGeometryMode == SphereGeometryMode::Procedural)
     {
-        -X, 0, Z,   X, 0, Z,    -X, 0, -Z,
-         X, 0, -Z,  0, Z, X,    0, Z, -X,
-         0, -Z, X,  0, -Z, -X,  Z, X, 0,
-         -Z, X, 0,  Z, -X, 0,   -Z, -X, 0
-    };
-    normals = vertices;
-    indices =
-    {
-        0,4,1,  0,9,4,  9,5,4,  4,5,8,  4,8,1,
-        8,10,1, 8,3,10, 5,3,8,  5,2,3,  2,7,3,
-        7,10,3, 7,6,10, 7,11,6, 11,0,6, 0,1,6,
-        6,1,10, 9,0,11, 9,11,2, 9,2,5,  7,2,11
-    };
+        unsigned int shaderProgram = loadShader("resources/shader/vs_procedural.glsl", "resources/shader/fs.glsl");
+        initProceduralSphere(shaderProgram);
+        glGenVertexArrays(1, &VAO);
+        registerMesh(SPHERE_MESH_NAME, MeshKind::Procedural, VAO, 0, 0, nullptr);
+        std::cout << "Sphere procedural: no vertex or index buffers" << std::endl;
+        return shaderProgram;
+    }
 
-    for (size_t i = 0; i < 8; i++)
+    if (sphereGeometryMode == SphereGeometryMode::Tessellated)
     {
-        subdivide(vertices, normals, indices);
+        unsigned int shaderProgram = initTessellationShaders();
+        if (shaderProgram != 0)
+        {
+            glGenVertexArrays(1, &VAO);
+            glGenBuffers(1, &VBO);
+            glGenBuffers(1, &EBO);
+            glBindVertexArray(VAO);
+            glBindBuffer(GL_ARRAY_BUFFER, VBO);
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+            initTessellatedSphere();
+            applyVertexLayout(POSITION_VERTEX_LAYOUT);
+            registerMesh(SPHERE_MESH_NAME, MeshKind::Patches, VAO, VBO, EBO, nullptr);
+            return shaderProgram;
+        }
+        std::cout << "Tessellation needs OpenGL 4.0, using the sphere LOD chain" << std::endl;
+        sphereGeometryMode = SphereGeometryMode::Buffers;
     }
-    calculateUVs(vertices, uvs);
 
-    // Tangent Requirements for Normal Mapping
-    // ---------------------------------------
-    std::vector<float> tangents;
-    std::vector<float> bitangents;
-    tangentStuff(vertices, uvs, indices, tangents, bitangents);
+    bool cube = sphereGeometryMode == SphereGeometryMode::CubeSphere;
+    const char* vertexShader = cube ? "resources/shader/vs_cube.glsl"
+        : tangentFrameMode == TangentFrameMode::Analytic ? "resources/shader/vs_analytic.glsl" : "resources/shader/vs.glsl";
+    unsigned int shaderProgram = loadShader(vertexShader, cube ? "resources/shader/fs_cube.glsl" : "resources/shader/fs.glsl");
+    const VertexLayout& layout = sphereVertexLayout();
 
     glGenVertexArrays(1, &VAO);
     glGenBuffers(1, &VBO);
-    glGenBuffers(1, &normalVBO);
-    glGenBuffers(1, &uvVBO);
     glGenBuffers(1, &EBO);
 
-	unsigned int tangentVBO, bitangentVBO;
-	glGenBuffers(1, &tangentVBO);
-	glGenBuffers(1, &bitangentVBO);
-
     // bind the Vertex Array Object first, then bind and set vertex buffers, and then configure vertex attributes
     // ----------------------------------------------------------------------------------------------------------
     glBindVertexArray(VAO);
-
     glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_STATIC_DRAW);
-
-    glBindBuffer(GL_ARRAY_BUFFER, normalVBO);
-    glBufferData(GL_ARRAY_BUFFER, normals.size() * sizeof(float), normals.data(), GL_STATIC_DRAW);
-
-    glBindBuffer(GL_ARRAY_BUFFER, uvVBO);
-    glBufferData(GL_ARRAY_BUFFER, uvs.size() * sizeof(float), uvs.data(), GL_STATIC_DRAW);
-
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
-
-	glBindBuffer(GL_ARRAY_BUFFER, tangentVBO);
-	glBufferData(GL_ARRAY_BUFFER, tangents.size() * sizeof(float), tangents.data(), GL_STATIC_DRAW);
-
-	glBindBuffer(GL_ARRAY_BUFFER, bitangentVBO);
-	glBufferData(GL_ARRAY_BUFFER, bitangents.size() * sizeof(float), bitangents.data(), GL_STATIC_DRAW);
-
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-
-    glBindBuffer(GL_ARRAY_BUFFER, normalVBO);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(1);
-
-    glBindBuffer(GL_ARRAY_BUFFER, uvVBO);
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(2);
 
-	glBindBuffer(GL_ARRAY_BUFFER, tangentVBO);
-	glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
-	glEnableVertexAttribArray(3);
+    // Compute Shaders on OpenGL 4.3+ (Icosphere only), else (or if their Output fails the Check) the CPU Generator
+    // -------------------------------------------------------------------------------------------------------------
+    bool gpu = !cube && initComputeShaders() && checkSphereLevelGpu(COMPUTE_CHECK_LEVEL, layout);
+    initSphereBuffers(layout, gpu);
 
-	glBindBuffer(GL_ARRAY_BUFFER, bitangentVBO);
-	glVertexAttribPointer(4, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
-	glEnableVertexAttribArray(4);
+    applyVertexLayout(layout);
+    registerMesh(SPHERE_MESH_NAME, MeshKind::Meshlets, VAO, VBO, EBO, sphereLodMeshlets);
 
 	return shaderProgram;
 }
@@ -0,0 +1,43 @@
+#include "../include/LodUtil.h"
+
+/**
+ * Projected Radius of a unit Sphere Body in Pixels
+ * @param model Model Matrix of the Body (uniform Scale = World Radius)
+ * @param view View Matrix
+ * @param projection Projection Matrix
+ * @return Radius on Screen in Pixels (huge if the Camera is inside the Body)
+ */
+float projectedRadius(const glm::mat4& model, const glm::mat4& view, const glm::mat4& projection)
+{
+    glm::vec3 center = glm::vec3(view * model * glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
+    float radius = glm::length(glm::vec3(model[0]));
+    float distance = glm::length(center);
+    if (distance <= radius)
+        return 1e9f;
+
+    // Sphere seen under the half Angle asin(r / d); projection[1][1] = 1 / tan(fov / 2)
+    // ---------------------------------------------------------------------------------
+    float tanHalfAngle = radius / std::sqrt(distance * distance - radius * radius);
+    return tanHalfAngle * projection[1][1] * SCR_HEIGHT * 0.5f;
+}
+
+/**
+ * Choose the Icosphere Level for a Body from its projected Radius
+ *
+ * A Level-L Edge spans about ICOSAHEDRON_EDGE_ANGLE / 2^L Radians, so the wanted
+ * Level is log2(radius * angle / targetEdge). The Level only changes once the wanted
+ * Level leaves the current one by more than LOD_HYSTERESIS.
+ * @param state LOD State of the Body (current Level)
+ * @param radiusPixels projected Radius in Pixels
+ * @return Level to draw
+ */
+unsigned int selectLodLevel(LodState& state, float radiusPixels)
+{
+    float wanted = std::log2(std::max(radiusPixels, 1e-3f) * ICOSAHEDRON_EDGE_ANGLE / LOD_TARGET_EDGE_PIXELS);
+
+    // Level L is right for wanted in (L - 1, L]
+    // -----------------------------------------
+    if (wanted > state.level + LOD_HYSTERESIS || wanted < (float)state.level - 1.0f - LOD_HYSTERESIS)
+        state.level = (unsigned int)glm::clamp(std::ceil(wanted), 0.0f, (float)LOD_MAX_LEVEL);
+    return state.level;
+}
@@ -0,0 +1,135 @@
+#include "../include/MeshAdjacencyUtil.h"
+
+/**
+ * Build the Vertex Adjacency of a Mesh from its Triangle Edges
+ *
+ * Every Triangle Edge is added in both Directions, then each Vertex's List is sorted and
+ * Duplicates (the same Edge seen from both of its Triangles) are removed in Place.
+ * @param vertexCount Number of Vertices
+ * @param indices Indices of the Mesh (welded, e.g. from subdivide() in Welded Mode)
+ * @param adjacency CSR Adjacency
+ */
+void buildAdjacency(size_t vertexCount, const std::vector<unsigned int>& indices, MeshAdjacency& adjacency)
+{
+    // Count and scatter both Directions of every Edge
+    // -----------------------------------------------
+    std::vector<unsigned int> offsets(vertexCount + 1, 0);
+    for (size_t i = 0; i < indices.size(); i++)
+        offsets[indices[i] + 1] += 2;
+    for (size_t v = 0; v < vertexCount; v++)
+        offsets[v + 1] += offsets[v];
+
+    std::vector<unsigned int> cursor(offsets.begin(), offsets.end() - 1);
+    std::vector<unsigned int> edges(offsets[vertexCount]);
+    for (size_t t = 0; t < indices.size(); t += 3)
+    {
+        for (int k = 0; k < 3; k++)
+        {
+            unsigned int a = indices[t + k], b = indices[t + (k + 1) % 3];
+            edges[cursor[a]++] = b;
+            edges[cursor[b]++] = a;
+        }
+    }
+
+    // Sort, drop Duplicates and compact
+    // ---------------------------------
+    adjacency.offsets.assign(vertexCount + 1, 0);
+    adjacency.neighbors.clear();
+    adjacency.neighbors.reserve(edges.size() / 2);
+    for (size_t v = 0; v < vertexCount; v++)
+    {
+        auto begin = edges.begin() + offsets[v], end = edges.begin() + offsets[v + 1];
+        std::sort(begin, end);
+        adjacency.neighbors.insert(adjacency.neighbors.end(), begin, std::unique(begin, end));
+        adjacency.offsets[v + 1] = (unsigned int)adjacency.neighbors.size();
+    }
+}
+
+/**
+ * Renumber the Vertices for Memory Locality (Reverse Cuthill-McKee)
+ *
+ * Breadth-first from a Vertex of lowest Degree, Neighbors visited by ascending Degree,
+ * then the Order is reversed: Neighbors get close Indices, so Stencil Kernels
+ * read their Neighbor Values from a narrow Band instead of all over the Mesh.
+ * @param vertices Vertices of the Mesh (permuted)
+ * @param normals Normals of the Mesh (permuted)
+ * @param indices Indices of the Mesh (remapped)
+ * @param adjacency CSR Adjacency (rebuilt for the new Order)
+ */
+void reorderForLocality(std::vector<float>& vertices, std::vector<float>& normals, std::vector<unsigned int>& indices, MeshAdjacency& adjacency)
+{
+    size_t vertexCount = vertices.size() / 3;
+    auto degree = [&](unsigned int v) { return adjacency.offsets[v + 1] - adjacency.offsets[v]; };
+
+    std::vector<unsigned int> order;
+    order.reserve(vertexCount);
+    std::vector<bool> visited(vertexCount, false);
+    std::vector<unsigned int> candidates;
+
+    // One Breadth-first Sweep per connected Component
+    // -----------------------------------------------
+    while (order.size() < vertexCount)
+    {
+        unsigned int start = (unsigned int)vertexCount;
+        for (unsigned int v = 0; v < vertexCount; v++)
+            if (!visited[v] && (start == vertexCount || degree(v) < degree(start)))
+                start = v;
+
+        visited[start] = true;
+        order.push_back(start);
+        for (size_t head = order.size() - 1; head < order.size(); head++)
+        {
+            unsigned int v = order[head];
+            candidates.clear();
+            for (unsigned int i = adjacency.offsets[v]; i < adjacency.offsets[v + 1]; i++)
+                if (!visited[adjacency.neighbors[i]])
+                    candidates.push_back(adjacency.neighbors[i]);
+            std::stable_sort(candidates.begin(), candidates.end(), [&](unsigned int a, unsigned int b) { return degree(a) < degree(b); });
+            for (unsigned int n : candidates)
+            {
+                visited[n] = true;
+                order.push_back(n);
+            }
+        }
+    }
+    std::reverse(order.begin(), order.end());
+
+    // Apply the Permutation
+    // ---------------------
+    std::vector<unsigned int> remap(vertexCount);
+    std::vector<float> newVertices(vertices.size()), newNormals(normals.size());
+    for (size_t i = 0; i < vertexCount; i++)
+    {
+        remap[order[i]] = (unsigned int)i;
+        std::copy(&vertices[order[i] * 3], &vertices[order[i] * 3] + 3, &newVertices[i * 3]);
+        std::copy(&normals[order[i] * 3], &normals[order[i] * 3] + 3, &newNormals[i * 3]);
+    }
+    for (unsigned int& index : indices)
+        index = remap[index];
+    vertices.swap(newVertices);
+    normals.swap(newNormals);
+    buildAdjacency(vertexCount, indices, adjacency);
+}
+
+/**
+ * Index Distance between neighboring Vertices (smaller -> Neighbor Reads stay in Cache)
+ * @param adjacency CSR Adjacency
+ * @return Maximum and average Distance
+ */
+AdjacencyBandwidth analyzeBandwidth(const MeshAdjacency& adjacency)
+{
+    AdjacencyBandwidth bandwidth = { 0, 0.0f };
+    double sum = 0.0;
+    for (size_t v = 0; v + 1 < adjacency.offsets.size(); v++)
+    {
+        for (unsigned int i = adjacency.offsets[v]; i < adjacency.offsets[v + 1]; i++)
+        {
+            unsigned int distance = (unsigned int)std::abs((long long)adjacency.neighbors[i] - (long long)v);
+            bandwidth.maximum = std::max(bandwidth.maximum, distance);
+            sum += distance;
+        }
+    }
+    if (!adjacency.neighbors.empty())
+        bandwidth.average = (float)(sum / adjacency.neighbors.size());
+    return bandwidth;
+}
@@ -0,0 +1,182 @@
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "../include/MeshCacheUtil.h"
+
+/**
+ * Path of the Cache File for one Subdivision Level and Vertex Format
+ * @param level Subdivision Level
+ * @param vertexFormat Vertex Format
+ * @return Path relative to the Working Directory
+ */
+std::string meshCachePath(uint32_t level, uint32_t vertexFormat)
+{
+    return "resources/icosphere_l" + std::to_string(level) + "_f" + std::to_string(vertexFormat) + ".meshcache";
+}
+
+/**
+ * Write a Mesh into a versioned Cache File
+ *
+ * Layout: Header, then every Stream at a 16 Byte aligned Offset,
+ * so a mapped File can be handed to glBufferData Stream by Stream.
+ * @param path Path of the Cache File
+ * @param level Subdivision Level
+ * @param vertexFormat Vertex Format
+ * @param vertexCount Number of Vertices
+ * @param indexCount Number of Indices
+ * @param streams Streams to store (at most MESH_CACHE_MAX_STREAMS)
+ * @return True if the File was written completely
+ */
+bool writeMeshCache(const std::string& path, uint32_t level, uint32_t vertexFormat,
+    uint64_t vertexCount, uint64_t indexCount, const std::vector<MeshStream>& streams)
+{
+    if (streams.size() > MESH_CACHE_MAX_STREAMS)
+        return false;
+
+    MeshCacheHeader header = {};
+    header.magic = MESH_CACHE_MAGIC;
+    header.version = MESH_CACHE_VERSION;
+    header.level = level;
+    header.vertexFormat = vertexFormat;
+    header.vertexCount = vertexCount;
+    header.indexCount = indexCount;
+    header.streamCount = (uint32_t)streams.size();
+
+    uint64_t offset = sizeof(MeshCacheHeader);
+    for (size_t i = 0; i < streams.size(); i++)
+    {
+        offset = (offset + MESH_CACHE_ALIGNMENT - 1) & ~(MESH_CACHE_ALIGNMENT - 1);
+        header.streamOffset[i] = offset;
+        header.streamSize[i] = streams[i].size;
+        offset += streams[i].size;
+    }
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file)
+        return false;
+
+    // Header and Streams with Zero Padding in between
+    // -----------------------------------------------
+    const char padding[MESH_CACHE_ALIGNMENT] = {};
+    uint64_t written = sizeof(MeshCacheHeader);
+    file.write((const char*)&header, sizeof(MeshCacheHeader));
+    for (size_t i = 0; i < streams.size(); i++)
+    {
+        file.write(padding, header.streamOffset[i] - written);
+        file.write((const char*)streams[i].data, streams[i].size);
+        written = header.streamOffset[i] + streams[i].size;
+    }
+    return (bool)file;
+}
+
+/**
+ * Map a Cache File read-only and validate its Header
+ * @param path Path of the Cache File
+ * @param level Expected Subdivision Level
+ * @param vertexFormat Expected Vertex Format
+ * @param expected Expected Streams: their Number and the Size of each
+ * @param cache Mapping; its Streams point directly into the mapped File
+ * @return True if the File exists, matches the Key and has exactly the expected, complete Streams
+ */
+bool openMeshCache(const std::string& path, uint32_t level, uint32_t vertexFormat,
+    const std::vector<MeshStreamSpec>& expected, MeshCache& cache)
+{
+    cache = MeshCache();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+    LARGE_INTEGER fileSize;
+    GetFileSizeEx(file, &fileSize);
+    HANDLE mapping = fileSize.QuadPart > 0 ? CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL) : NULL;
+    cache.fileHandle = file;
+    cache.mappingHandle = mapping;
+    if (mapping == NULL)
+    {
+        closeMeshCache(cache);
+        return false;
+    }
+    cache.mapping = (const unsigned char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    cache.mappingSize = (size_t)fileSize.QuadPart;
+#else
+    int file = open(path.c_str(), O_RDONLY);
+    if (file < 0)
+        return false;
+    struct stat fileStat;
+    if (fstat(file, &fileStat) == 0 && fileStat.st_size > 0)
+    {
+        void* mapping = mmap(NULL, fileStat.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+        if (mapping != MAP_FAILED)
+        {
+            cache.mapping = (const unsigned char*)mapping;
+            cache.mappingSize = fileStat.st_size;
+        }
+    }
+    close(file);
+#endif
+    if (cache.mapping == nullptr)
+    {
+        closeMeshCache(cache);
+        return false;
+    }
+
+    // Validate Key, Version, Stream Count, Stream Sizes and Bounds
+    // ------------------------------------------------------------
+    const MeshCacheHeader* header = (const MeshCacheHeader*)cache.mapping;
+    bool valid = cache.mappingSize >= sizeof(MeshCacheHeader) &&
+        header->magic == MESH_CACHE_MAGIC && header->version == MESH_CACHE_VERSION &&
+        header->level == level && header->vertexFormat == vertexFormat &&
+        header->streamCount == expected.size() && header->streamCount <= MESH_CACHE_MAX_STREAMS;
+    for (uint32_t i = 0; valid && i < header->streamCount; i++)
+    {
+        const MeshStreamSpec& spec = expected[i];
+        uint64_t size = header->streamSize[i];
+        if (spec.count == MeshStreamCount::Vertices)
+            valid = size == header->vertexCount * spec.elementSize;
+        else if (spec.count == MeshStreamCount::Indices)
+            valid = size == header->indexCount * spec.elementSize;
+        else
+            valid = size % spec.elementSize == 0;
+        valid = valid && header->streamOffset[i] <= cache.mappingSize && size <= cache.mappingSize - header->streamOffset[i];
+    }
+    if (!valid)
+    {
+        std::cout << "Mesh cache " << path << " is outdated or damaged" << std::endl;
+        closeMeshCache(cache);
+        return false;
+    }
+
+    cache.header = header;
+    for (uint32_t i = 0; i < header->streamCount; i++)
+        cache.streams.push_back({ cache.mapping + header->streamOffset[i], (size_t)header->streamSize[i] });
+    return true;
+}
+
+/**
+ * Unmap a Cache File; its Streams are invalid afterwards
+ * @param cache Mapping
+ */
+void closeMeshCache(MeshCache& cache)
+{
+#ifdef _WIN32
+    if (cache.mapping)
+        UnmapViewOfFile(cache.mapping);
+    if (cache.mappingHandle)
+        CloseHandle((HANDLE)cache.mappingHandle);
+    if (cache.fileHandle)
+        CloseHandle((HANDLE)cache.fileHandle);
+#else
+    if (cache.mapping)
+        munmap((void*)cache.mapping, cache.mappingSize);
+#endif
+    cache = MeshCache();
+}
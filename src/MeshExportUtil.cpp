@@ -0,0 +1,363 @@
+#include "../include/MeshExportUtil.h"
+#include "../include/StaticIcosphereUtil.h"
+#include "../include/UvUtil.h"
+
+// Seam Copies of a Level, found by one Pass over the Triangles without building the Mesh:
+// as calculateSphereUVs(), Date Line Copies follow the welded Vertices in the Order of first Use,
+// then one Copy per Pole Corner; only the Triangles using Copies are kept with their new Indices
+// ------------------------------------------------------------------------------------------------
+struct SeamLayout
+{
+    std::vector<glm::vec3> copyPositions;
+    std::vector<float> copyUs;
+    std::unordered_map<size_t, glm::uvec3> triangles;   // Triangle Number -> Indices with Copies
+    glm::vec3 boundsMin, boundsMax;
+};
+
+static glm::vec3 icosahedronCorner(unsigned int i)
+{
+    return glm::vec3(ICOSAHEDRON_VERTICES[i * 3], ICOSAHEDRON_VERTICES[i * 3 + 1], ICOSAHEDRON_VERTICES[i * 3 + 2]);
+}
+
+/**
+ * Point k of an Edge, in the same Float Operations as generateIcosphere()
+ */
+static glm::vec3 edgePosition(const IcosahedronEdges& edges, unsigned int n, unsigned int e, unsigned int k)
+{
+    return glm::normalize(icosahedronCorner(edges.corners[e][0]) * (float)(n - k) + icosahedronCorner(edges.corners[e][1]) * (float)k);
+}
+
+/**
+ * Position of Lattice Point (r, col) of a Face; Corners and Edge Points are taken from their
+ * shared Edge so every Face gets the same Bits as generateIcosphere() writes once
+ */
+static glm::vec3 latticePosition(const IcosahedronEdges& edges, unsigned int n, unsigned int f, unsigned int r, unsigned int col)
+{
+    const unsigned int* face = &ICOSAHEDRON_INDICES[f * 3];
+    unsigned int edge = 0, k = 0;
+    if (r == 0) return glm::normalize(icosahedronCorner(face[0]));
+    if (r == n && col == 0) return glm::normalize(icosahedronCorner(face[1]));
+    if (r == n && col == n) return glm::normalize(icosahedronCorner(face[2]));
+    if (col == 0) { edge = 0; k = r; }
+    else if (r == n) { edge = 1; k = col; }
+    else if (col == r) { edge = 2; k = r; }
+    else return glm::normalize(icosahedronCorner(face[0]) * (float)(n - r) + icosahedronCorner(face[1]) * (float)(r - col) + icosahedronCorner(face[2]) * (float)col);
+    if (edges.reversed[f][edge])
+        k = n - k;
+    return edgePosition(edges, n, edges.faceEdges[f][edge], k);
+}
+
+/**
+ * Visit all Triangles in the Order of generateIcosphere() with their Lattice Points (r, col)
+ * @param visit Callback (Triangle Number, Face, Lattice Points)
+ */
+template <typename Visit>
+static void forEachLatticeTriangle(unsigned int n, Visit visit)
+{
+    size_t t = 0;
+    for (unsigned int f = 0; f < 20; f++)
+    {
+        for (unsigned int r = 0; r < n; r++)
+        {
+            for (unsigned int col = 0; col <= r; col++)
+            {
+                const unsigned int down[3][2] = { { r, col }, { r + 1, col }, { r + 1, col + 1 } };
+                visit(t++, f, down);
+                if (col < r)
+                {
+                    const unsigned int up[3][2] = { { r, col }, { r + 1, col + 1 }, { r, col + 1 } };
+                    visit(t++, f, up);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Find the Seam Copies and Bounds of a Level (Date Line and Pole Passes of calculateSphereUVs())
+ * @param edges Icosahedron Edges
+ * @param n Segments per Edge
+ * @param seams Seam Layout
+ */
+static void findSeams(const IcosahedronEdges& edges, unsigned int n, SeamLayout& seams)
+{
+    struct PoleTriangle
+    {
+        size_t t;
+        glm::uvec3 indices;
+        float u[3];
+        bool pole[3];
+        glm::vec3 position[3];
+    };
+    const unsigned int weldedCount = 10 * n * n + 2;
+    std::unordered_map<unsigned int, unsigned int> wrapped;
+    std::vector<PoleTriangle> poleTriangles;
+    seams.boundsMin = seams.boundsMax = glm::normalize(icosahedronCorner(0));
+
+    // Date Line: Copies with u + 1 for the small Side of wrapping Triangles
+    // ---------------------------------------------------------------------
+    forEachLatticeTriangle(n, [&](size_t t, unsigned int f, const unsigned int lattice[3][2])
+        {
+            PoleTriangle triangle = {};
+            triangle.t = t;
+            float uMin = 1.0f, uMax = 0.0f;
+            for (int c = 0; c < 3; c++)
+            {
+                glm::vec3 p = latticePosition(edges, n, f, lattice[c][0], lattice[c][1]);
+                triangle.indices[c] = staticLatticeIndex(edges, n, f, lattice[c][0], lattice[c][1]);
+                triangle.position[c] = p;
+                triangle.pole[c] = std::abs(p.y) > 1.0f - 1e-6f;
+                triangle.u[c] = 0.5f + staticAtan2(p.z, p.x) * (float)(0.5 / M_PI);
+                seams.boundsMin = glm::min(seams.boundsMin, p);
+                seams.boundsMax = glm::max(seams.boundsMax, p);
+                if (triangle.pole[c])
+                    continue;
+                uMin = std::min(uMin, triangle.u[c]);
+                uMax = std::max(uMax, triangle.u[c]);
+            }
+
+            if (uMax - uMin > 0.5f)
+            {
+                for (int c = 0; c < 3; c++)
+                {
+                    if (triangle.pole[c] || triangle.u[c] >= 0.5f)
+                        continue;
+                    auto found = wrapped.find(triangle.indices[c]);
+                    if (found == wrapped.end())
+                    {
+                        found = wrapped.emplace(triangle.indices[c], weldedCount + (unsigned int)seams.copyUs.size()).first;
+                        seams.copyPositions.push_back(triangle.position[c]);
+                        seams.copyUs.push_back(triangle.u[c] + 1.0f);
+                    }
+                    triangle.indices[c] = found->second;
+                    triangle.u[c] += 1.0f;
+                }
+                seams.triangles[t] = triangle.indices;
+            }
+            if (triangle.pole[0] || triangle.pole[1] || triangle.pole[2])
+                poleTriangles.push_back(triangle);
+        });
+
+    // Poles: one Copy per Triangle, u in the Middle of the two other Corners
+    // ----------------------------------------------------------------------
+    for (PoleTriangle& triangle : poleTriangles)
+    {
+        for (int c = 0; c < 3; c++)
+        {
+            if (!triangle.pole[c])
+                continue;
+            triangle.indices[c] = weldedCount + (unsigned int)seams.copyUs.size();
+            seams.copyPositions.push_back(triangle.position[c]);
+            seams.copyUs.push_back(0.5f * (triangle.u[(c + 1) % 3] + triangle.u[(c + 2) % 3]));
+        }
+        seams.triangles[triangle.t] = triangle.indices;
+    }
+}
+
+/**
+ * Append to both Files (binary Streams of a little-endian Host)
+ */
+static void writeBoth(std::ofstream& glb, std::ofstream& ply, const void* data, size_t bytes)
+{
+    glb.write((const char*)data, bytes);
+    ply.write((const char*)data, bytes);
+}
+
+static void writeUint32(std::ofstream& file, uint32_t value)
+{
+    file.write((const char*)&value, sizeof(value));
+}
+
+/**
+ * glTF Scene of one indexed Mesh: interleaved Vertex View (Position, Normal, UV, Tangent), Index View
+ */
+static std::string buildGltfJson(unsigned int level, size_t vertexCount, size_t indexCount, const SeamLayout& seams)
+{
+    const size_t vertexBytes = vertexCount * EXPORT_VERTEX_FLOATS * sizeof(float);
+    std::ostringstream json;
+    json.precision(9);
+    json << "{\"asset\":{\"version\":\"2.0\",\"generator\":\"OpenGL_Orbit\"},"
+        << "\"scene\":0,\"scenes\":[{\"nodes\":[0]}],\"nodes\":[{\"mesh\":0,\"name\":\"Icosphere\"}],"
+        << "\"meshes\":[{\"name\":\"Icosphere level " << level << "\",\"primitives\":[{\"attributes\":"
+        << "{\"POSITION\":0,\"NORMAL\":1,\"TEXCOORD_0\":2,\"TANGENT\":3},\"indices\":4,\"mode\":4}]}],"
+        << "\"buffers\":[{\"byteLength\":" << vertexBytes + indexCount * sizeof(uint32_t) << "}],"
+        << "\"bufferViews\":["
+        << "{\"buffer\":0,\"byteOffset\":0,\"byteLength\":" << vertexBytes << ",\"byteStride\":" << EXPORT_VERTEX_FLOATS * sizeof(float) << ",\"target\":34962},"
+        << "{\"buffer\":0,\"byteOffset\":" << vertexBytes << ",\"byteLength\":" << indexCount * sizeof(uint32_t) << ",\"target\":34963}],"
+        << "\"accessors\":["
+        << "{\"bufferView\":0,\"byteOffset\":0,\"componentType\":5126,\"count\":" << vertexCount << ",\"type\":\"VEC3\","
+        << "\"min\":[" << seams.boundsMin.x << "," << seams.boundsMin.y << "," << seams.boundsMin.z << "],"
+        << "\"max\":[" << seams.boundsMax.x << "," << seams.boundsMax.y << "," << seams.boundsMax.z << "]},"
+        << "{\"bufferView\":0,\"byteOffset\":12,\"componentType\":5126,\"count\":" << vertexCount << ",\"type\":\"VEC3\"},"
+        << "{\"bufferView\":0,\"byteOffset\":24,\"componentType\":5126,\"count\":" << vertexCount << ",\"type\":\"VEC2\"},"
+        << "{\"bufferView\":0,\"byteOffset\":32,\"componentType\":5126,\"count\":" << vertexCount << ",\"type\":\"VEC4\"},"
+        << "{\"bufferView\":1,\"byteOffset\":0,\"componentType\":5125,\"count\":" << indexCount << ",\"type\":\"SCALAR\"}]}";
+
+    // JSON Chunks are padded with Spaces to 4 Bytes
+    // ---------------------------------------------
+    std::string text = json.str();
+    text.append((4 - text.size() % 4) % 4, ' ');
+    return text;
+}
+
+/**
+ * Export the seam-corrected Sphere of a Level (generateIcosphere(), calculateSphereUVs() and the
+ * analytic Tangent Frame) as <basePath>.glb and <basePath>.ply
+ *
+ * First Pass: Seam Copies and Bounds, so all Counts and Lengths of both Headers are known.
+ * Second Pass: Vertices in Chunks (UVs by calculateUVsSimd()), then Triangles in Chunks.
+ * @param level Subdivision Level (0 - EXPORT_MAX_LEVEL)
+ * @param basePath Path without Extension
+ * @return False if the Level is out of Range or a File could not be written
+ */
+bool exportSphereMesh(unsigned int level, const std::string& basePath)
+{
+    if (level > EXPORT_MAX_LEVEL)
+    {
+        std::cout << "Export level " << level << " exceeds the maximum of " << EXPORT_MAX_LEVEL << std::endl;
+        return false;
+    }
+    auto start = std::chrono::steady_clock::now();
+    const unsigned int n = 1u << level;
+    const IcosahedronEdges edges = findIcosahedronEdges();
+    SeamLayout seams;
+    findSeams(edges, n, seams);
+
+    const size_t weldedCount = 10 * (size_t)n * n + 2;
+    const size_t vertexCount = weldedCount + seams.copyUs.size();
+    const size_t triangleCount = 20 * (size_t)n * n;
+
+    std::ofstream glb(basePath + ".glb", std::ios::binary);
+    std::ofstream ply(basePath + ".ply", std::ios::binary);
+    if (!glb || !ply)
+    {
+        std::cout << "Failed to open " << basePath << ".glb / .ply for writing" << std::endl;
+        return false;
+    }
+
+    // Headers
+    // -------
+    std::string json = buildGltfJson(level, vertexCount, triangleCount * 3, seams);
+    const size_t binaryBytes = vertexCount * EXPORT_VERTEX_FLOATS * sizeof(float) + triangleCount * 3 * sizeof(uint32_t);
+    writeUint32(glb, 0x46546C67);   // "glTF"
+    writeUint32(glb, 2);
+    writeUint32(glb, (uint32_t)(12 + 8 + json.size() + 8 + binaryBytes));
+    writeUint32(glb, (uint32_t)json.size());
+    writeUint32(glb, 0x4E4F534A);   // "JSON"
+    glb.write(json.data(), json.size());
+    writeUint32(glb, (uint32_t)binaryBytes);
+    writeUint32(glb, 0x004E4942);   // "BIN"
+
+    ply << "ply\nformat binary_little_endian 1.0\n"
+        << "comment Icosphere level " << level << ", UVs and tangents in glTF convention\n"
+        << "element vertex " << vertexCount << "\n"
+        << "property float x\nproperty float y\nproperty float z\n"
+        << "property float nx\nproperty float ny\nproperty float nz\n"
+        << "property float s\nproperty float t\n"
+        << "property float tx\nproperty float ty\nproperty float tz\nproperty float tw\n"
+        << "element face " << triangleCount << "\n"
+        << "property list uchar uint vertex_indices\nend_header\n";
+
+    // Vertices: welded Corners, Edge Points and inner Face Points, then the Seam Copies
+    // ----------------------------------------------------------------------------------
+    std::vector<float> positions, uvs, records(EXPORT_CHUNK_SIZE * EXPORT_VERTEX_FLOATS);
+    positions.reserve(EXPORT_CHUNK_SIZE * 3);
+    const float* copyUs = nullptr;
+    auto flushVertices = [&]()
+    {
+        calculateUVsSimd(positions, uvs);
+        size_t count = positions.size() / 3;
+        for (size_t i = 0; i < count; i++)
+        {
+            glm::vec3 p(positions[i * 3], positions[i * 3 + 1], positions[i * 3 + 2]);
+            glm::vec3 tangent(p.z, 0.0f, -p.x);     // -dP/du, as s = 1 - u
+            tangent = glm::dot(tangent, tangent) > 1e-12f ? glm::normalize(tangent) : glm::vec3(-1.0f, 0.0f, 0.0f);
+            float u = copyUs != nullptr ? copyUs[i] : uvs[i * 2];
+
+            float* out = &records[i * EXPORT_VERTEX_FLOATS];
+            out[0] = out[3] = p.x;
+            out[1] = out[4] = p.y;
+            out[2] = out[5] = p.z;
+            out[6] = 1.0f - u;
+            out[7] = uvs[i * 2 + 1];
+            out[8] = tangent.x;
+            out[9] = tangent.y;
+            out[10] = tangent.z;
+            out[11] = -1.0f;                        // Bitangent = -cross(N, T) points south with v
+        }
+        writeBoth(glb, ply, records.data(), count * EXPORT_VERTEX_FLOATS * sizeof(float));
+        positions.clear();
+    };
+    auto addVertex = [&](const glm::vec3& p)
+    {
+        positions.push_back(p.x);
+        positions.push_back(p.y);
+        positions.push_back(p.z);
+        if (positions.size() == EXPORT_CHUNK_SIZE * 3)
+            flushVertices();
+    };
+
+    for (unsigned int i = 0; i < 12; i++)
+        addVertex(glm::normalize(icosahedronCorner(i)));
+    for (unsigned int e = 0; e < 30; e++)
+        for (unsigned int k = 1; k < n; k++)
+            addVertex(edgePosition(edges, n, e, k));
+    for (unsigned int f = 0; f < 20; f++)
+        for (unsigned int r = 2; r < n; r++)
+            for (unsigned int col = 1; col < r; col++)
+                addVertex(latticePosition(edges, n, f, r, col));
+    flushVertices();
+
+    for (size_t first = 0; first < seams.copyPositions.size(); first += EXPORT_CHUNK_SIZE)
+    {
+        size_t last = std::min(first + EXPORT_CHUNK_SIZE, seams.copyPositions.size());
+        copyUs = &seams.copyUs[first];
+        for (size_t i = first; i < last; i++)
+            addVertex(seams.copyPositions[i]);
+        flushVertices();
+    }
+
+    // Triangles: GLB takes the plain Index List, PLY a Count Byte before every Face
+    // ------------------------------------------------------------------------------
+    std::vector<uint32_t> glbIndices;
+    std::vector<char> plyFaces;
+    glbIndices.reserve(EXPORT_CHUNK_SIZE * 3);
+    plyFaces.reserve(EXPORT_CHUNK_SIZE * 13);
+    auto flushTriangles = [&]()
+    {
+        glb.write((const char*)glbIndices.data(), glbIndices.size() * sizeof(uint32_t));
+        ply.write(plyFaces.data(), plyFaces.size());
+        glbIndices.clear();
+        plyFaces.clear();
+    };
+    forEachLatticeTriangle(n, [&](size_t t, unsigned int f, const unsigned int lattice[3][2])
+        {
+            glm::uvec3 indices;
+            auto rewritten = seams.triangles.find(t);
+            if (rewritten != seams.triangles.end())
+                indices = rewritten->second;
+            else
+                for (int c = 0; c < 3; c++)
+                    indices[c] = staticLatticeIndex(edges, n, f, lattice[c][0], lattice[c][1]);
+
+            plyFaces.push_back(3);
+            for (int c = 0; c < 3; c++)
+            {
+                glbIndices.push_back(indices[c]);
+                plyFaces.insert(plyFaces.end(), (const char*)&indices[c], (const char*)&indices[c] + sizeof(uint32_t));
+            }
+            if (glbIndices.size() == EXPORT_CHUNK_SIZE * 3)
+                flushTriangles();
+        });
+    flushTriangles();
+
+    if (!glb || !ply)
+    {
+        std::cout << "Failed to write " << basePath << ".glb / .ply" << std::endl;
+        return false;
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "Exported level " << level << " (" << vertexCount << " vertices, " << triangleCount << " triangles) to "
+        << basePath << ".glb / .ply in " << seconds << " s" << std::endl;
+    return true;
+}
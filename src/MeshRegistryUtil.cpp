@@ -0,0 +1,127 @@
+#include "../include/MeshRegistryUtil.h"
+#include "../include/ProceduralSphereUtil.h"
+#include "../include/TessellationSphereUtil.h"
+#include "../include/ImpostorUtil.h"
+#include "../include/UniformUtil.h"
+#include "../include/RenderQueueUtil.h"
+
+extern glm::vec3 cameraPos;
+
+static std::vector<GpuMesh> meshes;
+
+/**
+ * Size of a Buffer on the GPU
+ * @param buffer Buffer (0 -> no Buffer)
+ * @return Size in Bytes
+ */
+static int bufferSize(unsigned int buffer)
+{
+    int size = 0;
+    if (buffer == 0)
+        return size;
+    glBindBuffer(GL_COPY_READ_BUFFER, buffer);
+    glGetBufferParameteriv(GL_COPY_READ_BUFFER, GL_BUFFER_SIZE, &size);
+    return size;
+}
+
+/**
+ * Register uploaded Geometry; the Registry owns its VAO and Buffers from now on
+ * @param name Name to find the Mesh by
+ * @param kind How the Mesh is drawn
+ * @param VAO Vertex Array Object with the Vertex Layout set up
+ * @param VBO Vertex Buffer (0 for procedural Meshes)
+ * @param EBO Index Buffer (0 for procedural Meshes)
+ * @param lodMeshlets LOD_LEVEL_COUNT Meshlet Lists for MeshKind::Meshlets, else nullptr
+ * @return Handle of the Mesh
+ */
+MeshHandle registerMesh(const std::string& name, MeshKind kind, unsigned int VAO, unsigned int VBO, unsigned int EBO, const std::vector<Meshlet>* lodMeshlets)
+{
+    meshes.push_back({ name, kind, VAO, VBO, EBO, lodMeshlets });
+    std::cout << "Mesh " << name << " registered: " << (bufferSize(VBO) + bufferSize(EBO)) / (1024.0 * 1024.0)
+        << " MiB on the GPU, shared by all Bodies" << std::endl;
+    return (MeshHandle)(meshes.size() - 1);
+}
+
+/**
+ * Look up a registered Mesh by Name
+ * @param name Name the Mesh was registered with
+ * @return Handle of the Mesh, INVALID_MESH_HANDLE if there is none
+ */
+MeshHandle findMesh(const std::string& name)
+{
+    for (size_t i = 0; i < meshes.size(); i++)
+        if (meshes[i].name == name)
+            return (MeshHandle)i;
+    std::cout << "Mesh " << name << " is not registered" << std::endl;
+    return INVALID_MESH_HANDLE;
+}
+
+/**
+ * Registered Mesh of a Handle
+ * @param handle Handle from registerMesh or findMesh
+ * @return Mesh
+ */
+const GpuMesh& meshByHandle(MeshHandle handle)
+{
+    return meshes[handle];
+}
+
+/**
+ * Bind the Textures of a Material to Units 0 (texture1) and 1 (normalMap)
+ * @param shaderProgram Shader Program in use
+ * @param material Material of the Body
+ * @param textureTarget Texture Target of the Surfaces (surfaceTextureTarget())
+ */
+void bindMaterial(unsigned int shaderProgram, const Material& material, GLenum textureTarget)
+{
+    bindTexture(0, textureTarget, material.texture);
+    glUniform1i(uniformLocation(shaderProgram, Uniform::Texture1), 0);
+
+    bindTexture(1, textureTarget, material.normalMap);
+    glUniform1i(uniformLocation(shaderProgram, Uniform::NormalMap), 1);
+}
+
+/**
+ * Draw a registered Mesh for one Body (LOD Level by Screen Size, Meshlets facing the Camera only),
+ * or its Impostor if selectImpostor chose one for the Body
+ * @param shaderProgram Shader Program in use (impostorShaderProgram() for Impostors), Uniforms of the Body already set
+ * @param handle Mesh
+ * @param lod LOD State of the Body
+ * @param model Model Matrix of the Body
+ * @param view View Matrix
+ * @param projection Projection Matrix
+ */
+void drawMesh(unsigned int shaderProgram, MeshHandle handle, LodState& lod, const glm::mat4& model, const glm::mat4& view, const glm::mat4& projection)
+{
+    if (lod.impostor)
+    {
+        drawImpostor(shaderProgram, model, view);
+        return;
+    }
+
+    const GpuMesh& mesh = meshes[handle];
+    unsigned int level = selectLodLevel(lod, projectedRadius(model, view, projection));
+    bindVertexArray(mesh.VAO);
+    if (mesh.kind == MeshKind::Procedural)
+        drawProceduralSphere(shaderProgram, level);
+    else if (mesh.kind == MeshKind::Patches)
+        drawTessellatedSphere(shaderProgram);
+    else
+        drawMeshlets(mesh.lodMeshlets[level], model, cameraPos);
+}
+
+/**
+ * Delete the VAOs and Buffers of all registered Meshes
+ */
+void releaseMeshes()
+{
+    for (GpuMesh& mesh : meshes)
+    {
+        glDeleteVertexArrays(1, &mesh.VAO);
+        if (mesh.VBO != 0)
+            glDeleteBuffers(1, &mesh.VBO);
+        if (mesh.EBO != 0)
+            glDeleteBuffers(1, &mesh.EBO);
+    }
+    meshes.clear();
+}
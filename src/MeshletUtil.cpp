@@ -0,0 +1,277 @@
+#include "../include/MeshletUtil.h"
+#include "../include/VertexCacheUtil.h"
+
+/**
+ * Compute Bounding Sphere and Normal Cone of a finished Meshlet
+ * @param meshlet Meshlet
+ * @param vertices Vertices of the Mesh
+ * @param meshletVertices global Vertex Index for every Meshlet Vertex
+ * @param meshletIndices local Indices
+ */
+static void computeMeshletBounds(
+    Meshlet& meshlet,
+    const std::vector<float>& vertices,
+    const std::vector<unsigned int>& meshletVertices,
+    const std::vector<uint16_t>& meshletIndices)
+{
+    auto position = [&](unsigned int local)
+    {
+        unsigned int v = meshletVertices[meshlet.vertexOffset + local];
+        return glm::vec3(vertices[v * 3], vertices[v * 3 + 1], vertices[v * 3 + 2]);
+    };
+
+    // Bounding Sphere around the Vertex Centroid
+    // ------------------------------------------
+    glm::vec3 center(0.0f);
+    for (unsigned int i = 0; i < meshlet.vertexCount; i++)
+        center += position(i);
+    center /= (float)meshlet.vertexCount;
+    float radius = 0.0f;
+    for (unsigned int i = 0; i < meshlet.vertexCount; i++)
+        radius = std::max(radius, glm::length(position(i) - center));
+
+    // Normal Cone: Axis is the mean Triangle Normal, Spread the widest Deviation
+    // --------------------------------------------------------------------------
+    std::vector<glm::vec3> triangleNormals;
+    glm::vec3 axis(0.0f);
+    for (unsigned int i = 0; i < meshlet.indexCount; i += 3)
+    {
+        const uint16_t* tri = &meshletIndices[meshlet.indexOffset + i];
+        glm::vec3 n = glm::cross(position(tri[1]) - position(tri[0]), position(tri[2]) - position(tri[0]));
+        float length = glm::length(n);
+        if (length > 0.0f)
+        {
+            triangleNormals.push_back(n / length);
+            axis += n / length;
+        }
+    }
+    float axisLength = glm::length(axis);
+    axis = axisLength > 0.0f ? axis / axisLength : glm::vec3(1.0f, 0.0f, 0.0f);
+
+    float minDot = 1.0f;
+    for (const glm::vec3& n : triangleNormals)
+        minDot = std::min(minDot, glm::dot(axis, n));
+
+    meshlet.center[0] = center.x;
+    meshlet.center[1] = center.y;
+    meshlet.center[2] = center.z;
+    meshlet.radius = radius;
+    meshlet.coneAxis[0] = axis.x;
+    meshlet.coneAxis[1] = axis.y;
+    meshlet.coneAxis[2] = axis.z;
+    meshlet.coneCutoff = (axisLength == 0.0f || minDot <= 0.1f) ? 1.0f : std::sqrt(1.0f - minDot * minDot);
+}
+
+/**
+ * Split an indexed Mesh into Meshlets
+ *
+ * Greedy Growth: starting at the first unused Triangle, the Meshlet takes the adjacent
+ * Triangle that adds the fewest new Vertices (closest to the Meshlet Center on a Tie)
+ * until MESHLET_MAX_VERTICES or MESHLET_MAX_TRIANGLES is reached.
+ * Vertices on Meshlet Borders are duplicated so every Meshlet owns a contiguous Vertex Range.
+ * @param vertices Vertices of the Mesh
+ * @param indices Indices of the Mesh
+ * @param meshlets Meshlets
+ * @param meshletVertices global Vertex Index for every Meshlet Vertex (Remap for the Vertex Buffer)
+ * @param meshletIndices local 16 bit Indices of all Meshlets
+ */
+void buildMeshlets(
+    const std::vector<float>& vertices,
+    const std::vector<unsigned int>& indices,
+    std::vector<Meshlet>& meshlets,
+    std::vector<unsigned int>& meshletVertices,
+    std::vector<uint16_t>& meshletIndices)
+{
+    size_t vertexCount = vertices.size() / 3;
+    size_t triangleCount = indices.size() / 3;
+    meshlets.clear();
+    meshletVertices.clear();
+    meshletIndices.clear();
+    meshletIndices.reserve(indices.size());
+
+    // Vertex -> Triangle Adjacency (CSR)
+    // ----------------------------------
+    std::vector<unsigned int> adjacencyOffset(vertexCount + 1, 0);
+    std::vector<unsigned int> adjacency(indices.size());
+    for (unsigned int index : indices)
+        adjacencyOffset[index + 1]++;
+    for (size_t v = 0; v < vertexCount; v++)
+        adjacencyOffset[v + 1] += adjacencyOffset[v];
+    std::vector<unsigned int> cursor(adjacencyOffset.begin(), adjacencyOffset.end() - 1);
+    for (size_t i = 0; i < indices.size(); i++)
+        adjacency[cursor[indices[i]]++] = (unsigned int)(i / 3);
+
+    auto position = [&](unsigned int v)
+    {
+        return glm::vec3(vertices[v * 3], vertices[v * 3 + 1], vertices[v * 3 + 2]);
+    };
+
+    std::vector<char> triangleUsed(triangleCount, 0);
+    std::vector<unsigned int> candidateStamp(triangleCount, 0);
+    std::vector<int> localIndex(vertexCount, -1);
+    std::vector<unsigned int> candidates;
+    size_t seed = 0;
+
+    while (true)
+    {
+        while (seed < triangleCount && triangleUsed[seed])
+            seed++;
+        if (seed == triangleCount)
+            break;
+
+        Meshlet meshlet = {};
+        meshlet.vertexOffset = (uint32_t)meshletVertices.size();
+        meshlet.indexOffset = (uint32_t)meshletIndices.size();
+        unsigned int stamp = (unsigned int)meshlets.size() + 1;
+        glm::vec3 centroidSum(0.0f);
+
+        candidates.clear();
+        candidates.push_back((unsigned int)seed);
+        candidateStamp[seed] = stamp;
+
+        while (meshlet.indexCount / 3 < MESHLET_MAX_TRIANGLES)
+        {
+            // Pick the Candidate with the fewest new Vertices, then the closest one
+            // ---------------------------------------------------------------------
+            glm::vec3 center = centroidSum / (float)std::max(1u, meshlet.vertexCount);
+            size_t best = candidates.size();
+            unsigned int bestNew = 4;
+            float bestDistance = 0.0f;
+            for (size_t k = 0; k < candidates.size();)
+            {
+                unsigned int t = candidates[k];
+                if (triangleUsed[t])
+                {
+                    candidates[k] = candidates.back();
+                    candidates.pop_back();
+                    continue;
+                }
+                const unsigned int* tri = &indices[t * 3];
+                unsigned int newVertices = (localIndex[tri[0]] < 0) + (localIndex[tri[1]] < 0) + (localIndex[tri[2]] < 0);
+                float distance = 0.0f;
+                if (newVertices <= bestNew)
+                {
+                    glm::vec3 d = (position(tri[0]) + position(tri[1]) + position(tri[2])) / 3.0f - center;
+                    distance = glm::dot(d, d);
+                }
+                if (newVertices < bestNew || (newVertices == bestNew && distance < bestDistance))
+                {
+                    best = k;
+                    bestNew = newVertices;
+                    bestDistance = distance;
+                }
+                k++;
+            }
+            if (best == candidates.size() || meshlet.vertexCount + bestNew > MESHLET_MAX_VERTICES)
+                break;
+
+            // Add the Triangle and collect its Neighbors as new Candidates
+            // ------------------------------------------------------------
+            unsigned int t = candidates[best];
+            candidates[best] = candidates.back();
+            candidates.pop_back();
+            triangleUsed[t] = 1;
+
+            for (unsigned int corner = 0; corner < 3; corner++)
+            {
+                unsigned int v = indices[t * 3 + corner];
+                if (localIndex[v] < 0)
+                {
+                    localIndex[v] = (int)meshlet.vertexCount++;
+                    meshletVertices.push_back(v);
+                    centroidSum += position(v);
+
+                    for (unsigned int a = adjacencyOffset[v]; a < adjacencyOffset[v + 1]; a++)
+                    {
+                        unsigned int neighbor = adjacency[a];
+                        if (!triangleUsed[neighbor] && candidateStamp[neighbor] != stamp)
+                        {
+                            candidateStamp[neighbor] = stamp;
+                            candidates.push_back(neighbor);
+                        }
+                    }
+                }
+                meshletIndices.push_back((uint16_t)localIndex[v]);
+            }
+            meshlet.indexCount += 3;
+        }
+
+        for (unsigned int i = 0; i < meshlet.vertexCount; i++)
+            localIndex[meshletVertices[meshlet.vertexOffset + i]] = -1;
+
+        computeMeshletBounds(meshlet, vertices, meshletVertices, meshletIndices);
+        meshlets.push_back(meshlet);
+    }
+}
+
+/**
+ * Renumber the Vertices of every Meshlet in first-use Order for linear Vertex Fetch
+ * (the Triangle Order comes from the cache-optimized Index Buffer the Meshlets were cut from).
+ * Bounds and Cones stay valid since only the Order inside a Meshlet changes.
+ * @param meshlets Meshlets
+ * @param meshletVertices global Vertex Index for every Meshlet Vertex (permuted per Meshlet)
+ * @param meshletIndices local Indices (rewritten)
+ */
+void optimizeMeshlets(
+    const std::vector<Meshlet>& meshlets,
+    std::vector<unsigned int>& meshletVertices,
+    std::vector<uint16_t>& meshletIndices)
+{
+    std::vector<unsigned int> localIndices, vertexRemap, oldVertices;
+    for (const Meshlet& meshlet : meshlets)
+    {
+        localIndices.assign(meshletIndices.begin() + meshlet.indexOffset, meshletIndices.begin() + meshlet.indexOffset + meshlet.indexCount);
+        optimizeVertexFetch(localIndices.data(), localIndices.size(), vertexRemap);
+
+        for (unsigned int i = 0; i < meshlet.indexCount; i++)
+            meshletIndices[meshlet.indexOffset + i] = (uint16_t)localIndices[i];
+        oldVertices.assign(meshletVertices.begin() + meshlet.vertexOffset, meshletVertices.begin() + meshlet.vertexOffset + meshlet.vertexCount);
+        for (size_t i = 0; i < vertexRemap.size(); i++)
+            meshletVertices[meshlet.vertexOffset + i] = oldVertices[vertexRemap[i]];
+    }
+}
+
+/**
+ * Normal Cone Test: true if every Triangle of the Meshlet faces away from the Camera
+ * @param meshlet Meshlet
+ * @param cameraPosition Camera Position in Model Space
+ * @return True if the Meshlet can be skipped
+ */
+bool isMeshletBackfacing(const Meshlet& meshlet, const glm::vec3& cameraPosition)
+{
+    glm::vec3 center(meshlet.center[0], meshlet.center[1], meshlet.center[2]);
+    glm::vec3 axis(meshlet.coneAxis[0], meshlet.coneAxis[1], meshlet.coneAxis[2]);
+    glm::vec3 toCenter = center - cameraPosition;
+    return glm::dot(toCenter, axis) >= meshlet.coneCutoff * glm::length(toCenter) + meshlet.radius;
+}
+
+/**
+ * Draw all Meshlets of the bound VAO that can be visible (one glMultiDrawElementsBaseVertex)
+ * @param meshlets Meshlets of the bound Mesh
+ * @param model Model Matrix of the Body
+ * @param cameraPosition Camera Position in World Space
+ * @return Number of submitted Meshlets
+ */
+unsigned int drawMeshlets(const std::vector<Meshlet>& meshlets, const glm::mat4& model, const glm::vec3& cameraPosition)
+{
+    static std::vector<GLsizei> counts;
+    static std::vector<const void*> offsets;
+    static std::vector<GLint> baseVertices;
+    counts.clear();
+    offsets.clear();
+    baseVertices.clear();
+
+    glm::vec3 cameraInModel = glm::vec3(glm::inverse(model) * glm::vec4(cameraPosition, 1.0f));
+    for (const Meshlet& meshlet : meshlets)
+    {
+        if (isMeshletBackfacing(meshlet, cameraInModel))
+            continue;
+        counts.push_back((GLsizei)meshlet.indexCount);
+        offsets.push_back((const void*)((size_t)meshlet.indexOffset * sizeof(uint16_t)));
+        baseVertices.push_back((GLint)meshlet.vertexOffset);
+    }
+
+    if (!counts.empty())
+        glMultiDrawElementsBaseVertex(GL_TRIANGLES, counts.data(), GL_UNSIGNED_SHORT, offsets.data(), (GLsizei)counts.size(), baseVertices.data());
+    return (unsigned int)counts.size();
+}
@@ -0,0 +1,30 @@
+#include "../include/ProceduralSphereUtil.h"
+#include "../include/UniformUtil.h"
+
+/**
+ * Upload the Icosahedron Corner and Face Tables the procedural Vertex Shader builds the Sphere from
+ * @param shaderProgram Shader Program (vs_procedural.glsl)
+ */
+void initProceduralSphere(unsigned int shaderProgram)
+{
+    int faces[20 * 3];
+    for (int i = 0; i < 20 * 3; i++)
+        faces[i] = (int)ICOSAHEDRON_INDICES[i];
+
+    glUseProgram(shaderProgram);
+    glUniform3fv(uniformLocation(shaderProgram, Uniform::IcosahedronVertices), 12, ICOSAHEDRON_VERTICES);
+    glUniform3iv(uniformLocation(shaderProgram, Uniform::IcosahedronFaces), 20, faces);
+}
+
+/**
+ * Draw the Sphere without Vertex Buffers: one Instance per Icosahedron Face, 3 Vertices per Lattice Triangle
+ * (an empty VAO has to be bound)
+ * @param shaderProgram Shader Program (vs_procedural.glsl)
+ * @param level Subdivision Level
+ */
+void drawProceduralSphere(unsigned int shaderProgram, unsigned int level)
+{
+    int n = 1 << level;
+    glUniform1i(uniformLocation(shaderProgram, Uniform::Subdivisions), n);
+    glDrawArraysInstanced(GL_TRIANGLES, 0, 3 * n * n, 20);
+}
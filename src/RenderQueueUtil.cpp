@@ -0,0 +1,169 @@
+#include "../include/RenderQueueUtil.h"
+
+// Queued Draw: Sort Key and the Code issuing it
+// ---------------------------------------------
+struct RenderCommand
+{
+    uint64_t key;
+    std::function<void()> draw;
+};
+
+// Shadow Copy of the bound OpenGL State (UNKNOWN_BINDING: must be sent on the next Bind)
+// -------------------------------------------------------------------------------------
+const unsigned int UNKNOWN_BINDING = 0xFFFFFFFFu;
+const size_t TEXTURE_TARGET_COUNT = sizeof(RENDER_TEXTURE_TARGETS) / sizeof(RENDER_TEXTURE_TARGETS[0]);
+
+struct RenderState
+{
+    unsigned int program;
+    unsigned int vertexArray;
+    unsigned int activeUnit;
+    unsigned int textures[RENDER_TEXTURE_UNITS][TEXTURE_TARGET_COUNT];
+};
+
+static std::vector<RenderCommand> renderQueue;
+static RenderState renderState;
+static RenderStats frameStats = {}, lastFrameStats = {};
+static bool firstFlush = true;
+
+/**
+ * Build the Sort Key of a Draw; Names beyond 20 bits only lose their Grouping, not their Order by Pass
+ * @param pass Render Pass
+ * @param program Shader Program
+ * @param material Material ID (its Color Texture)
+ * @param mesh Mesh ID (its VAO)
+ * @return Sort Key
+ */
+uint64_t renderSortKey(RenderPass pass, unsigned int program, unsigned int material, unsigned int mesh)
+{
+    return (uint64_t)pass << (3 * SORT_KEY_FIELD_BITS)
+        | (program & SORT_KEY_FIELD_MASK) << (2 * SORT_KEY_FIELD_BITS)
+        | (material & SORT_KEY_FIELD_MASK) << SORT_KEY_FIELD_BITS
+        | (mesh & SORT_KEY_FIELD_MASK);
+}
+
+/**
+ * Queue a Draw for flushRenderQueue(); its Code binds through the State Cache
+ * @param key Sort Key (renderSortKey)
+ * @param draw Code issuing the Draw, run once at the Flush
+ */
+void submitDraw(uint64_t key, std::function<void()> draw)
+{
+    renderQueue.push_back({ key, std::move(draw) });
+}
+
+/**
+ * Run all queued Draws in Key Order (Draws with equal Keys keep their Submission Order)
+ * and close the Frame's Statistics; the Cache starts from unknown State, as Initialization binds directly
+ */
+void flushRenderQueue()
+{
+    if (firstFlush)
+        invalidateRenderState();
+
+    std::stable_sort(renderQueue.begin(), renderQueue.end(),
+        [](const RenderCommand& a, const RenderCommand& b) { return a.key < b.key; });
+    for (const RenderCommand& command : renderQueue)
+        command.draw();
+
+    frameStats.commands = (unsigned int)renderQueue.size();
+    lastFrameStats = frameStats;
+    frameStats = {};
+    renderQueue.clear();
+
+    if (firstFlush)
+    {
+        std::cout << "Render queue: " << lastFrameStats.commands << " draws, " << lastFrameStats.stateChanges
+            << " state changes, " << lastFrameStats.skippedStateChanges << " redundant binds skipped" << std::endl;
+        firstFlush = false;
+    }
+}
+
+/**
+ * Statistics of the last flushed Frame
+ * @return Draws, sent and skipped State Changes
+ */
+const RenderStats& renderStats()
+{
+    return lastFrameStats;
+}
+
+/**
+ * Count a Bind and tell whether it changes the cached Binding
+ * @param cached cached Binding, updated
+ * @param wanted wanted Binding
+ * @return True if the Bind has to be sent to OpenGL
+ */
+static bool changeBinding(unsigned int& cached, unsigned int wanted)
+{
+    if (cached == wanted)
+    {
+        frameStats.skippedStateChanges++;
+        return false;
+    }
+    cached = wanted;
+    frameStats.stateChanges++;
+    return true;
+}
+
+/**
+ * glUseProgram, skipped if the Program is already in use
+ * @param program Shader Program
+ */
+void useProgram(unsigned int program)
+{
+    if (changeBinding(renderState.program, program))
+        glUseProgram(program);
+}
+
+/**
+ * glBindVertexArray, skipped if the VAO is already bound
+ * @param vertexArray VAO
+ */
+void bindVertexArray(unsigned int vertexArray)
+{
+    if (changeBinding(renderState.vertexArray, vertexArray))
+        glBindVertexArray(vertexArray);
+}
+
+/**
+ * Bind a Texture to a Unit, skipped if it is already bound there; the active Unit is only
+ * switched for Binds that are sent
+ * @param unit Texture Unit (0 = GL_TEXTURE0)
+ * @param target Texture Target
+ * @param texture Texture
+ */
+void bindTexture(unsigned int unit, GLenum target, unsigned int texture)
+{
+    const GLenum* slot = std::find(std::begin(RENDER_TEXTURE_TARGETS), std::end(RENDER_TEXTURE_TARGETS), target);
+    if (unit >= RENDER_TEXTURE_UNITS || slot == std::end(RENDER_TEXTURE_TARGETS))
+    {
+        glActiveTexture(GL_TEXTURE0 + unit);
+        glBindTexture(target, texture);
+        renderState.activeUnit = unit;
+        frameStats.stateChanges++;
+        return;
+    }
+
+    if (!changeBinding(renderState.textures[unit][slot - std::begin(RENDER_TEXTURE_TARGETS)], texture))
+        return;
+    if (renderState.activeUnit != unit)
+    {
+        glActiveTexture(GL_TEXTURE0 + unit);
+        renderState.activeUnit = unit;
+    }
+    glBindTexture(target, texture);
+}
+
+/**
+ * Forget the cached State, e.g. after Code bound Programs, VAOs or Textures directly or deleted bound Objects
+ * (OpenGL reuses their Names)
+ */
+void invalidateRenderState()
+{
+    renderState.program = UNKNOWN_BINDING;
+    renderState.vertexArray = UNKNOWN_BINDING;
+    renderState.activeUnit = UNKNOWN_BINDING;
+    for (unsigned int unit = 0; unit < RENDER_TEXTURE_UNITS; unit++)
+        std::fill(std::begin(renderState.textures[unit]), std::end(renderState.textures[unit]), UNKNOWN_BINDING);
+}
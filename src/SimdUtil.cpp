@@ -0,0 +1,103 @@
+#include "../include/SimdUtil.h"
+
+// Worker Pool: started on first Use, one Thread less than the Hardware Threads (the Caller works too).
+// A Call publishes its Task under a new Generation, Workers and Caller take Task Indices until none are left
+// ----------------------------------------------------------------------------------------------------------
+struct WorkerPool
+{
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::mutex callMutex;                   // one Call at a Time
+    std::condition_variable wake, done;
+    const std::function<void(size_t)>* task = nullptr;
+    size_t taskCount = 0;
+    std::atomic<size_t> nextTask{ 0 };
+    uint64_t generation = 0;
+    unsigned int active = 0;                // Threads (Caller included) inside the current Generation
+    bool stopping = false;
+
+    ~WorkerPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (std::thread& thread : threads)
+            thread.join();
+    }
+};
+
+static WorkerPool workerPool;
+
+/**
+ * Take Task Indices of the current Generation until none are left
+ */
+static void drainTasks()
+{
+    for (size_t i = workerPool.nextTask.fetch_add(1); i < workerPool.taskCount; i = workerPool.nextTask.fetch_add(1))
+        (*workerPool.task)(i);
+}
+
+/**
+ * Pool Worker: wait for a new Generation, work on it outside the Lock, report when leaving it
+ */
+static void poolWorker()
+{
+    std::unique_lock<std::mutex> lock(workerPool.mutex);
+    uint64_t seen = 0;
+    while (true)
+    {
+        workerPool.wake.wait(lock, [&] { return workerPool.stopping || workerPool.generation != seen; });
+        if (workerPool.stopping)
+            return;
+        seen = workerPool.generation;
+        workerPool.active++;
+
+        lock.unlock();
+        drainTasks();
+        lock.lock();
+        if (--workerPool.active == 0)
+            workerPool.done.notify_all();
+    }
+}
+
+/**
+ * Run task(0) ... task(taskCount - 1) on the persistent Worker Pool and the calling Thread, return when all are done
+ * @param taskCount Number of Tasks
+ * @param task Called once per Task Index, concurrently
+ */
+void runParallel(size_t taskCount, const std::function<void(size_t)>& task)
+{
+    if (taskCount <= 1)
+    {
+        if (taskCount == 1)
+            task(0);
+        return;
+    }
+
+    std::lock_guard<std::mutex> call(workerPool.callMutex);
+    {
+        // Workers late for the last Generation leave it before the next one is published
+        // ------------------------------------------------------------------------------
+        std::unique_lock<std::mutex> lock(workerPool.mutex);
+        workerPool.done.wait(lock, [] { return workerPool.active == 0; });
+        if (workerPool.threads.empty())
+        {
+            unsigned int workerCount = std::max(1u, std::thread::hardware_concurrency()) - 1;
+            for (unsigned int i = 0; i < workerCount; i++)
+                workerPool.threads.emplace_back(poolWorker);
+        }
+        workerPool.task = &task;
+        workerPool.taskCount = taskCount;
+        workerPool.nextTask = 0;
+        workerPool.generation++;
+        workerPool.active++;
+    }
+    workerPool.wake.notify_all();
+
+    drainTasks();
+    std::unique_lock<std::mutex> lock(workerPool.mutex);
+    workerPool.active--;
+    workerPool.done.wait(lock, [] { return workerPool.active == 0; });
+}
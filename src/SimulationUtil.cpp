@@ -0,0 +1,284 @@
+#include "../include/SimulationUtil.h"
+#include "../include/SimdUtil.h"
+#include "../include/UniformUtil.h"
+#include "../include/RenderQueueUtil.h"
+#include "../include/StreamBufferUtil.h"
+#include "../include/TerrainUtil.h"
+
+SimulationMode simulationMode = SimulationMode::None;
+
+// Simulation Mesh (welded, locality-ordered) and State; Arrays padded to StencilMatrix::vertexCount
+// -------------------------------------------------------------------------------------------------
+static size_t simulationVertexCount = 0;
+static StencilMatrix simulationStencil;
+static std::vector<float> normalX, normalY, normalZ;
+static std::vector<float> values, scratch;
+static std::vector<uint32_t> overlayColors;
+static bool heatStarted = false;
+
+static unsigned int overlayProgram = 0, overlayVAO = 0, overlayPositionVBO = 0, overlayHeightVBO = 0, overlayEBO = 0;
+static StreamHandle overlayColorStream = INVALID_STREAM_HANDLE;
+static unsigned int overlayIndexCount = 0;
+
+/**
+ * One Stencil Step: SIMD over SIMD_WIDTH Vertices (one Gather per Column), Threads over Vertex Ranges
+ * @param stencil Stencil Matrix
+ * @param in Values (stencil.vertexCount)
+ * @param out Result (stencil.vertexCount, not aliasing in)
+ */
+void applyStencil(const StencilMatrix& stencil, const float* in, float* out)
+{
+    size_t blockCount = stencil.vertexCount / SIMD_WIDTH;
+    parallelFor(blockCount, [&](size_t begin, size_t end)
+        {
+            for (size_t block = begin; block < end; block++)
+            {
+                size_t v = block * SIMD_WIDTH;
+                floatN center = loadN(in + v);
+                floatN sum = loadN(0.0f);
+                for (unsigned int k = 0; k < STENCIL_WIDTH; k++)
+                {
+                    size_t column = k * stencil.vertexCount + v;
+                    floatN neighbor = gatherN(in, &stencil.neighbors[column], 1, 0);
+                    sum = addN(sum, mulN(loadN(&stencil.weights[column]), subN(neighbor, center)));
+                }
+                storeN(out + v, addN(center, sum));
+            }
+        }, STENCIL_MIN_VERTICES_PER_THREAD / SIMD_WIDTH);
+}
+
+/**
+ * Fill a Stencil from the CSR Adjacency with a Weight per Edge
+ * @param adjacency CSR Adjacency (Degree at most STENCIL_WIDTH)
+ * @param vertices Positions
+ * @param weight Called as weight(v, n, positionV, positionN)
+ * @param stencil Stencil Matrix (vertexCount padded to SIMD_WIDTH)
+ */
+template <typename Weight>
+static void buildStencil(const MeshAdjacency& adjacency, const std::vector<float>& vertices, Weight weight, StencilMatrix& stencil)
+{
+    size_t count = adjacency.offsets.size() - 1;
+    stencil.vertexCount = (count + SIMD_WIDTH - 1) / SIMD_WIDTH * SIMD_WIDTH;
+    stencil.neighbors.resize(STENCIL_WIDTH * stencil.vertexCount);
+    stencil.weights.assign(STENCIL_WIDTH * stencil.vertexCount, 0.0f);
+    for (size_t v = 0; v < stencil.vertexCount; v++)
+    {
+        unsigned int degree = v < count ? adjacency.offsets[v + 1] - adjacency.offsets[v] : 0;
+        glm::vec3 p = v < count ? glm::vec3(vertices[v * 3], vertices[v * 3 + 1], vertices[v * 3 + 2]) : glm::vec3(0.0f);
+        for (unsigned int k = 0; k < STENCIL_WIDTH; k++)
+        {
+            size_t column = k * stencil.vertexCount + v;
+            stencil.neighbors[column] = (unsigned int)v;
+            if (k >= degree)
+                continue;
+            unsigned int n = adjacency.neighbors[adjacency.offsets[v] + k];
+            stencil.neighbors[column] = n;
+            stencil.weights[column] = weight((unsigned int)v, n, p, glm::vec3(vertices[n * 3], vertices[n * 3 + 1], vertices[n * 3 + 2]));
+        }
+    }
+}
+
+/**
+ * Initialize the Simulation: welded Mesh from subdivide(), Adjacency in Locality Order,
+ * Stencil Weights of the Mode, initial State and the Overlay Buffers
+ */
+void initSimulation()
+{
+    if (simulationMode == SimulationMode::None)
+        return;
+
+    // Welded Icosphere and its Adjacency, renumbered for Locality
+    // -----------------------------------------------------------
+    std::vector<float> vertices(ICOSAHEDRON_VERTICES, ICOSAHEDRON_VERTICES + 12 * 3);
+    std::vector<float> normals = vertices;
+    std::vector<unsigned int> indices(ICOSAHEDRON_INDICES, ICOSAHEDRON_INDICES + 20 * 3);
+    for (unsigned int level = 0; level < SIMULATION_LEVEL; level++)
+        subdivide(vertices, normals, indices, SubdivisionMode::Welded);
+
+    MeshAdjacency adjacency;
+    buildAdjacency(vertices.size() / 3, indices, adjacency);
+    AdjacencyBandwidth before = analyzeBandwidth(adjacency);
+    reorderForLocality(vertices, normals, indices, adjacency);
+    AdjacencyBandwidth after = analyzeBandwidth(adjacency);
+    simulationVertexCount = vertices.size() / 3;
+
+    // Stencil Weights
+    // ---------------
+    if (simulationMode == SimulationMode::Heat)
+    {
+        buildStencil(adjacency, vertices, [&](unsigned int v, unsigned int, const glm::vec3&, const glm::vec3&)
+            {
+                return HEAT_DIFFUSION / (float)(adjacency.offsets[v + 1] - adjacency.offsets[v]);
+            }, simulationStencil);
+    }
+    else
+    {
+        // Upwind: Vertex v takes from Neighbor n in Proportion to the Flow from n towards v,
+        // scaled so the largest Inflow Sum equals TRACER_COURANT (stable)
+        // -----------------------------------------------------------------------------------
+        glm::vec3 axis = glm::normalize(glm::vec3(0.4f, 1.0f, 0.2f));
+        buildStencil(adjacency, vertices, [&](unsigned int, unsigned int, const glm::vec3& p, const glm::vec3& q)
+            {
+                glm::vec3 edge = q - p;
+                glm::vec3 velocity = glm::cross(axis, (p + q) * 0.5f);
+                return std::max(0.0f, -glm::dot(velocity, edge)) / glm::dot(edge, edge);
+            }, simulationStencil);
+
+        float maxInflow = 0.0f;
+        for (size_t v = 0; v < simulationStencil.vertexCount; v++)
+        {
+            float inflow = 0.0f;
+            for (unsigned int k = 0; k < STENCIL_WIDTH; k++)
+                inflow += simulationStencil.weights[k * simulationStencil.vertexCount + v];
+            maxInflow = std::max(maxInflow, inflow);
+        }
+        for (float& weight : simulationStencil.weights)
+            weight *= TRACER_COURANT / maxInflow;
+    }
+
+    // State: Normals in SoA for the Insolation, Tracer starts as two Cosine Bells
+    // ---------------------------------------------------------------------------
+    size_t padded = simulationStencil.vertexCount;
+    normalX.assign(padded, 0.0f);
+    normalY.assign(padded, 0.0f);
+    normalZ.assign(padded, 0.0f);
+    values.assign(padded, 0.0f);
+    scratch.assign(padded, 0.0f);
+    const glm::vec3 bells[2] = { glm::normalize(glm::vec3(1.0f, 0.3f, 0.0f)), glm::normalize(glm::vec3(-0.5f, -0.2f, 1.0f)) };
+    for (size_t v = 0; v < simulationVertexCount; v++)
+    {
+        glm::vec3 n(normals[v * 3], normals[v * 3 + 1], normals[v * 3 + 2]);
+        normalX[v] = n.x;
+        normalY[v] = n.y;
+        normalZ[v] = n.z;
+        if (simulationMode == SimulationMode::Tracer)
+            for (const glm::vec3& bell : bells)
+                values[v] += 0.5f * (1.0f + std::cos(std::min(std::acos(glm::clamp(glm::dot(n, bell), -1.0f, 1.0f)) / 0.5f, 1.0f) * (float)M_PI));
+    }
+
+    // Overlay: static Positions and Terrain Heights, Colors streamed every Frame
+    // -------------------------------------------------------------------------
+    std::vector<float> terrainHeights;
+    sampleTerrainHeights(vertices, OVERLAY_TERRAIN_LEVEL, terrainHeights);
+    overlayProgram = loadShader("resources/shader/vs_overlay.glsl", "resources/shader/fs_overlay.glsl");
+    overlayColors.resize(simulationVertexCount);
+    overlayIndexCount = (unsigned int)indices.size();
+
+    glGenVertexArrays(1, &overlayVAO);
+    glGenBuffers(1, &overlayPositionVBO);
+    glGenBuffers(1, &overlayHeightVBO);
+    glGenBuffers(1, &overlayEBO);
+    glBindVertexArray(overlayVAO);
+
+    glBindBuffer(GL_ARRAY_BUFFER, overlayPositionVBO);
+    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+
+    glBindBuffer(GL_ARRAY_BUFFER, overlayHeightVBO);
+    glBufferData(GL_ARRAY_BUFFER, terrainHeights.size() * sizeof(float), terrainHeights.data(), GL_STATIC_DRAW);
+    glVertexAttribPointer(2, 1, GL_FLOAT, GL_FALSE, sizeof(float), (void*)0);
+    glEnableVertexAttribArray(2);
+
+    overlayColorStream = createStreamBuffer(overlayColors.size() * sizeof(uint32_t));
+    glEnableVertexAttribArray(1);   // pointed at the Frame's Colors by drawSimulationOverlay
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, overlayEBO);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
+    glBindVertexArray(0);
+
+    std::cout << "Simulation mesh (level " << SIMULATION_LEVEL << "): " << simulationVertexCount << " vertices, "
+        << adjacency.neighbors.size() << " neighbor entries, bandwidth max " << before.maximum << " -> " << after.maximum
+        << ", average " << before.average << " -> " << after.average << std::endl;
+}
+
+/**
+ * Insolation max(0, N * sun) and Relaxation of the Heat towards it, SIMD over the padded Range
+ * @param sun Sun Direction in Object Space
+ */
+static void relaxHeat(const glm::vec3& sun)
+{
+    floatN sx = loadN(sun.x), sy = loadN(sun.y), sz = loadN(sun.z), zero = loadN(0.0f), rate = loadN(HEAT_RELAXATION);
+    for (size_t v = 0; v < simulationStencil.vertexCount; v += SIMD_WIDTH)
+    {
+        floatN light = maxN(zero, addN(addN(mulN(loadN(&normalX[v]), sx), mulN(loadN(&normalY[v]), sy)), mulN(loadN(&normalZ[v]), sz)));
+        floatN heat = loadN(&values[v]);
+        storeN(&values[v], addN(heat, mulN(rate, subN(light, heat))));
+    }
+}
+
+/**
+ * Advance the Simulation by SIMULATION_STEPS_PER_FRAME Stencil Steps
+ * @param sunDirection Direction to the Sun in the Earth's Object Space
+ */
+void stepSimulation(const glm::vec3& sunDirection)
+{
+    if (simulationMode == SimulationMode::None)
+        return;
+
+    // Heat starts at the Insolation of the first Frame
+    // ------------------------------------------------
+    if (simulationMode == SimulationMode::Heat && !heatStarted)
+    {
+        for (size_t v = 0; v < simulationVertexCount; v++)
+            values[v] = std::max(0.0f, normalX[v] * sunDirection.x + normalY[v] * sunDirection.y + normalZ[v] * sunDirection.z);
+        heatStarted = true;
+    }
+
+    for (unsigned int step = 0; step < SIMULATION_STEPS_PER_FRAME; step++)
+    {
+        applyStencil(simulationStencil, values.data(), scratch.data());
+        values.swap(scratch);
+        if (simulationMode == SimulationMode::Heat)
+            relaxHeat(sunDirection);
+    }
+}
+
+/**
+ * Color Ramp of a Simulation Value, packed as RGBA8
+ * @param value Value (0 - 1)
+ * @return Color (Heat: blue -> red, Tracer: transparent -> yellow)
+ */
+static uint32_t overlayColor(float value)
+{
+    float t = glm::clamp(value, 0.0f, 1.0f);
+    glm::vec4 color = simulationMode == SimulationMode::Heat
+        ? glm::vec4(t, 0.3f * (1.0f - std::abs(2.0f * t - 1.0f)), 1.0f - t, 0.45f)
+        : glm::vec4(1.0f, 0.85f, 0.2f, 0.85f * t);
+    return (uint32_t)(color.r * 255.0f + 0.5f) | (uint32_t)(color.g * 255.0f + 0.5f) << 8
+        | (uint32_t)(color.b * 255.0f + 0.5f) << 16 | (uint32_t)(color.a * 255.0f + 0.5f) << 24;
+}
+
+/**
+ * Stream the current Values as Colors and queue them blended over the Earth
+ * (lifted by the Terrain Heights while the Terrain replaces the Sphere, so it isn't buried under it)
+ * @param model Model Matrix of the Earth
+ */
+void drawSimulationOverlay(const glm::mat4& model)
+{
+    if (simulationMode == SimulationMode::None)
+        return;
+
+    for (size_t v = 0; v < simulationVertexCount; v++)
+        overlayColors[v] = overlayColor(values[v]);
+    StreamRange colors = streamData(overlayColorStream, overlayColors.data(), overlayColors.size() * sizeof(uint32_t));
+
+    float heightScale = terrainActive() ? 1.0f : 0.0f;
+    submitDraw(renderSortKey(RenderPass::Overlay, overlayProgram, 0, overlayVAO), [model, colors, heightScale]()
+    {
+        useProgram(overlayProgram);
+        glUniformMatrix4fv(uniformLocation(overlayProgram, Uniform::Model), 1, GL_FALSE, glm::value_ptr(model));
+        glUniform1f(uniformLocation(overlayProgram, Uniform::OverlayRadius), OVERLAY_RADIUS);
+        glUniform1f(uniformLocation(overlayProgram, Uniform::TerrainHeightScale), heightScale);
+
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        glDepthMask(GL_FALSE);
+        bindVertexArray(overlayVAO);
+        glBindBuffer(GL_ARRAY_BUFFER, colors.buffer);
+        glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(uint32_t), (void*)colors.offset);
+        glDrawElements(GL_TRIANGLES, overlayIndexCount, GL_UNSIGNED_INT, 0);
+        glDepthMask(GL_TRUE);
+        glDisable(GL_BLEND);
+    });
+}
@@ -1,5 +1,6 @@
 #include "../include/SkyboxUtil.h"
 #include "../include/TextureUtil.h"
+#include "../include/RenderQueueUtil.h"
 
 /**
  * Utility Function to load a Skybox
@@ -83,23 +84,19 @@ void initSkybox()
 }
 
 /**
- * Function to draw the Skybox
- * @param view View Matrix
- * @param projection Projection Matrix
+ * Function to queue the Skybox (View and Projection from the Frame Uniforms); it runs after the opaque
+ * Bodies, so it only shades the Pixels still at the far Plane
  */
-void drawSkybox(glm::mat4 view, glm::mat4 projection)
+void drawSkybox()
 {
-    glDepthFunc(GL_LEQUAL);             // Skybox is drawn behind everything else
-
-    glUseProgram(skyboxShaderProgram);
-    view = glm::mat4(glm::mat3(view));
-    glUniformMatrix4fv(glGetUniformLocation(skyboxShaderProgram, "view"), 1, GL_FALSE, glm::value_ptr(view));
-    glUniformMatrix4fv(glGetUniformLocation(skyboxShaderProgram, "projection"), 1, GL_FALSE, glm::value_ptr(projection));
+    submitDraw(renderSortKey(RenderPass::Sky, skyboxShaderProgram, cubemapTexture, skyboxVAO), []()
+    {
+        glDepthFunc(GL_LEQUAL);             // Skybox is drawn behind everything else
 
-    glBindVertexArray(skyboxVAO);
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, cubemapTexture);
-    glDrawArrays(GL_TRIANGLES, 0, 36);
-    glBindVertexArray(0);
-    glDepthFunc(GL_LESS);               // Reset Depth Function
+        useProgram(skyboxShaderProgram);
+        bindVertexArray(skyboxVAO);
+        bindTexture(0, GL_TEXTURE_CUBE_MAP, cubemapTexture);
+        glDrawArrays(GL_TRIANGLES, 0, 36);
+        glDepthFunc(GL_LESS);               // Reset Depth Function
+    });
 }
@@ -0,0 +1,164 @@
+#include "../include/StaticIcosphereUtil.h"
+#include "../include/StaticIcosphereData.h"
+#include "../include/UvUtil.h"
+
+// Levels 0 - STATIC_ICOSPHERE_MAX_LEVEL as read-only Data; the Tables are generated Source
+// (--generate-static-icosphere), so no Compiler has to evaluate the Meshes at Compile Time
+// ----------------------------------------------------------------------------------------
+struct StaticIcosphereLevel
+{
+    const float* positions;
+    const float* uvs;
+    const uint16_t* weldedIndices;      // as generateIcosphere()
+    const uint16_t* indices;            // rewritten to the Seam Copies
+    unsigned int vertexCount;           // welded Vertices + Seam Copies
+    unsigned int indexCount;
+};
+
+#define STATIC_ICOSPHERE_LEVEL(level) \
+    { STATIC_ICOSPHERE_##level##_POSITIONS, STATIC_ICOSPHERE_##level##_UVS, \
+      STATIC_ICOSPHERE_##level##_WELDED_INDICES, STATIC_ICOSPHERE_##level##_INDICES, \
+      sizeof(STATIC_ICOSPHERE_##level##_POSITIONS) / sizeof(float) / 3, \
+      sizeof(STATIC_ICOSPHERE_##level##_INDICES) / sizeof(uint16_t) }
+
+static const StaticIcosphereLevel STATIC_ICOSPHERE_LEVELS[] =
+{
+    STATIC_ICOSPHERE_LEVEL(0), STATIC_ICOSPHERE_LEVEL(1), STATIC_ICOSPHERE_LEVEL(2), STATIC_ICOSPHERE_LEVEL(3), STATIC_ICOSPHERE_LEVEL(4)
+};
+static_assert(sizeof(STATIC_ICOSPHERE_LEVELS) / sizeof(STATIC_ICOSPHERE_LEVELS[0]) == STATIC_ICOSPHERE_MAX_LEVEL + 1, "one Entry per embedded Level");
+
+// Counts of the generated Arrays against the Icosphere Formulas: 10n^2 + 2 welded Vertices, 20n^2 Triangles;
+// Seam Copies: 3 at Level 0 (no Pole Vertices yet), from Level 1 on 6 per Pole and 3n - 2 along the Date Line
+// -----------------------------------------------------------------------------------------------------------
+#define CHECK_STATIC_ICOSPHERE(level) \
+    static_assert(sizeof(STATIC_ICOSPHERE_##level##_WELDED_INDICES) / sizeof(uint16_t) == 20 * 3 * (1u << level) * (1u << level), "welded Index Count of Level " #level); \
+    static_assert(sizeof(STATIC_ICOSPHERE_##level##_INDICES) / sizeof(uint16_t) == 20 * 3 * (1u << level) * (1u << level), "Index Count of Level " #level); \
+    static_assert(sizeof(STATIC_ICOSPHERE_##level##_POSITIONS) / sizeof(float) == 3 * (10 * (1u << level) * (1u << level) + 2 + (level == 0 ? 3 : 12 + 3 * (1u << level) - 2)), "Vertex Count of Level " #level); \
+    static_assert(sizeof(STATIC_ICOSPHERE_##level##_UVS) / sizeof(float) / 2 == sizeof(STATIC_ICOSPHERE_##level##_POSITIONS) / sizeof(float) / 3, "UV Count of Level " #level)
+
+CHECK_STATIC_ICOSPHERE(0);
+CHECK_STATIC_ICOSPHERE(1);
+CHECK_STATIC_ICOSPHERE(2);
+CHECK_STATIC_ICOSPHERE(3);
+CHECK_STATIC_ICOSPHERE(4);
+
+/**
+ * Copy an embedded Level into Vectors
+ * @param level Subdivision Level
+ * @param seams True for the seam-corrected Mesh with UVs, false for the welded Mesh
+ * @return False if the Level is not embedded
+ */
+static bool copyStaticLevel(unsigned int level, bool seams,
+    std::vector<float>& vertices, std::vector<float>& normals, std::vector<unsigned int>& indices, std::vector<float>* uvs)
+{
+    if (level > STATIC_ICOSPHERE_MAX_LEVEL)
+        return false;
+
+    const StaticIcosphereLevel& mesh = STATIC_ICOSPHERE_LEVELS[level];
+    unsigned int segments = 1u << level;
+    unsigned int vertexCount = seams ? mesh.vertexCount : 10 * segments * segments + 2;
+    vertices.assign(mesh.positions, mesh.positions + vertexCount * 3);
+    normals = vertices;
+    const uint16_t* source = seams ? mesh.indices : mesh.weldedIndices;
+    indices.assign(source, source + mesh.indexCount);
+    if (uvs != nullptr)
+        uvs->assign(mesh.uvs, mesh.uvs + vertexCount * 2);
+    return true;
+}
+
+/**
+ * Welded Icosphere of a Level from the Executable, same Result as generateIcosphere()
+ * @param level Subdivision Level (0 - STATIC_ICOSPHERE_MAX_LEVEL)
+ * @param vertices Vertices of the Mesh
+ * @param normals Normals of the Mesh
+ * @param indices Indices of the Mesh
+ * @return False if the Level is not embedded (Vectors untouched)
+ */
+bool loadStaticIcosphere(unsigned int level, std::vector<float>& vertices, std::vector<float>& normals, std::vector<unsigned int>& indices)
+{
+    return copyStaticLevel(level, false, vertices, normals, indices, nullptr);
+}
+
+/**
+ * Sphere Mesh with seam-correct UVs: copied from the Executable up to STATIC_ICOSPHERE_MAX_LEVEL,
+ * else generateIcosphere() and calculateSphereUVs() at Runtime (same Result either way)
+ * @param level Subdivision Level
+ * @param vertices Vertices of the Mesh
+ * @param normals Normals of the Mesh
+ * @param indices Indices of the Mesh
+ * @param uvs UVs (2 floats per Vertex)
+ */
+void generateSphereMesh(unsigned int level, std::vector<float>& vertices, std::vector<float>& normals, std::vector<unsigned int>& indices, std::vector<float>& uvs)
+{
+    if (copyStaticLevel(level, true, vertices, normals, indices, &uvs))
+        return;
+    generateIcosphere(level, vertices, normals, indices);
+    calculateSphereUVs(vertices, normals, indices, uvs);
+}
+
+/**
+ * Shortest Literal that reads back as exactly this Float
+ */
+static std::string floatLiteral(float value)
+{
+    char text[32];
+    std::snprintf(text, sizeof(text), "%.9g", value);
+    std::string literal = text;
+    if (literal.find_first_of(".en") == std::string::npos)
+        literal += ".0";
+    return literal + "f";
+}
+
+/**
+ * Write one Array Definition, 8 Values per Line
+ */
+template <typename T, typename Format>
+static void writeArray(std::ofstream& file, const char* type, const std::string& name, const std::vector<T>& values, Format format)
+{
+    file << "const " << type << " " << name << "[] =\n{";
+    for (size_t i = 0; i < values.size(); i++)
+        file << (i % 8 == 0 ? "\n    " : " ") << format(values[i]) << (i + 1 < values.size() ? "," : "");
+    file << "\n};\n";
+}
+
+/**
+ * Write the embedded Levels 0 - STATIC_ICOSPHERE_MAX_LEVEL as C++ Arrays (include/StaticIcosphereData.h),
+ * built by the Runtime Path: generateIcosphere(), then calculateSphereUVs()
+ * @param path Path of the Header
+ * @return False if the File can't be written
+ */
+bool writeStaticIcosphereHeader(const std::string& path)
+{
+    std::ofstream file(path, std::ios::trunc);
+    if (!file)
+    {
+        std::cout << "Failed to write " << path << std::endl;
+        return false;
+    }
+
+    file << "#pragma once\n\n"
+        << "#include \"IkosaederUtil.h\"\n\n"
+        << "// Icosphere Levels 0 - " << STATIC_ICOSPHERE_MAX_LEVEL << " as generateIcosphere() and calculateSphereUVs() build them:\n"
+        << "// the welded Mesh, then the Seam Copies (Normals are the Positions).\n"
+        << "// Generated by --generate-static-icosphere, do not edit\n"
+        << "// " << std::string(82, '-') << "\n";
+    for (unsigned int level = 0; level <= STATIC_ICOSPHERE_MAX_LEVEL; level++)
+    {
+        std::vector<float> vertices, normals, uvs;
+        std::vector<unsigned int> indices;
+        generateIcosphere(level, vertices, normals, indices);
+        std::vector<unsigned int> weldedIndices = indices;
+        calculateSphereUVs(vertices, normals, indices, uvs);
+
+        std::string prefix = "STATIC_ICOSPHERE_" + std::to_string(level) + "_";
+        auto writeFloat = [](float value) { return floatLiteral(value); };
+        auto writeIndex = [](unsigned int value) { return std::to_string(value); };
+        file << "\n";
+        writeArray(file, "float", prefix + "POSITIONS", vertices, writeFloat);
+        writeArray(file, "float", prefix + "UVS", uvs, writeFloat);
+        writeArray(file, "uint16_t", prefix + "WELDED_INDICES", weldedIndices, writeIndex);
+        writeArray(file, "uint16_t", prefix + "INDICES", indices, writeIndex);
+    }
+    std::cout << "Wrote icosphere levels 0-" << STATIC_ICOSPHERE_MAX_LEVEL << " to " << path << std::endl;
+    return true;
+}
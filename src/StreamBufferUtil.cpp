@@ -0,0 +1,225 @@
+#include "../include/StreamBufferUtil.h"
+
+// OpenGL 4.4 Parts missing in the 3.3 GLAD Loader
+// -----------------------------------------------
+#define GL_MAP_PERSISTENT_BIT 0x0040
+#define GL_MAP_COHERENT_BIT 0x0080
+
+typedef void (APIENTRYP PFNGLBUFFERSTORAGEPROC)(GLenum target, GLsizeiptr size, const void* data, GLbitfield flags);
+static PFNGLBUFFERSTORAGEPROC bufferStorage = nullptr;
+
+const GLbitfield PERSISTENT_MAP_FLAGS = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+const GLuint64 STREAM_WAIT_TIMEOUT = 1000000000;    // 1 s per Wait Call, repeated until signaled
+
+// Ring Buffer: Region i spans [i * regionBytes, (i + 1) * regionBytes)
+// --------------------------------------------------------------------
+struct StreamBuffer
+{
+    unsigned int buffer;
+    size_t regionBytes;
+    unsigned int region;                    // Region written this Frame
+    size_t used;                            // Bytes written into it so far
+    GLsync fences[STREAM_RING_REGIONS];     // set when the GPU got the last Draws reading the Region
+    char* mapped;                           // whole Ring, persistently mapped (nullptr: mapped per Write)
+};
+
+static std::vector<StreamBuffer> streamBuffers;
+static std::vector<unsigned int> retiredBuffers;    // outgrown this Frame, still referenced by queued Draws
+static StreamStats frameStats = {}, lastFrameStats = {};
+static StreamStats totalStats = {};
+static unsigned int streamedFrames = 0;
+
+/**
+ * Use persistent Mapping where OpenGL 4.4 Buffer Storage is available, else map each Write unsynchronized
+ */
+void initStreamBuffers()
+{
+    int major = 0, minor = 0;
+    glGetIntegerv(GL_MAJOR_VERSION, &major);
+    glGetIntegerv(GL_MINOR_VERSION, &minor);
+    if (major * 10 + minor >= 44)
+        bufferStorage = (PFNGLBUFFERSTORAGEPROC)glfwGetProcAddress("glBufferStorage");
+
+    std::cout << "Stream buffers: " << STREAM_RING_REGIONS << " fenced regions, "
+        << (bufferStorage != nullptr ? "persistent mapping" : "unsynchronized mapping per write") << std::endl;
+}
+
+/**
+ * Allocate the Ring of a Stream Buffer (bound to GL_COPY_WRITE_BUFFER, which no VAO or Program watches)
+ * @param stream Stream Buffer with regionBytes set
+ */
+static void allocateRing(StreamBuffer& stream)
+{
+    size_t ringBytes = stream.regionBytes * STREAM_RING_REGIONS;
+    glGenBuffers(1, &stream.buffer);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, stream.buffer);
+    if (bufferStorage != nullptr)
+    {
+        bufferStorage(GL_COPY_WRITE_BUFFER, ringBytes, NULL, PERSISTENT_MAP_FLAGS);
+        stream.mapped = (char*)glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, ringBytes, PERSISTENT_MAP_FLAGS);
+    }
+    else
+    {
+        glBufferData(GL_COPY_WRITE_BUFFER, ringBytes, NULL, GL_STREAM_DRAW);
+        stream.mapped = nullptr;
+    }
+    stream.region = 0;
+    stream.used = 0;
+    std::fill(std::begin(stream.fences), std::end(stream.fences), (GLsync)0);
+}
+
+/**
+ * Unmap a Ring and hand its Buffer to the retired Buffers; Draws still queued this Frame keep reading it
+ * @param stream Stream Buffer
+ */
+static void retireRing(StreamBuffer& stream)
+{
+    if (stream.mapped != nullptr)
+    {
+        glBindBuffer(GL_COPY_WRITE_BUFFER, stream.buffer);
+        glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+    }
+    for (GLsync& fence : stream.fences)
+        if (fence != 0)
+            glDeleteSync(fence);
+    retiredBuffers.push_back(stream.buffer);
+}
+
+/**
+ * Create a Stream Buffer
+ * @param regionBytes Bytes per Frame expected; the Ring grows if a Frame needs more
+ * @return Handle
+ */
+StreamHandle createStreamBuffer(size_t regionBytes)
+{
+    StreamBuffer stream;
+    stream.regionBytes = (regionBytes + STREAM_ALIGNMENT - 1) / STREAM_ALIGNMENT * STREAM_ALIGNMENT;
+    allocateRing(stream);
+    streamBuffers.push_back(stream);
+    return (StreamHandle)(streamBuffers.size() - 1);
+}
+
+/**
+ * Wait until the GPU is done with the Region about to be written, if it was used STREAM_RING_REGIONS Frames ago
+ * @param stream Stream Buffer
+ */
+static void waitForRegion(StreamBuffer& stream)
+{
+    GLsync& fence = stream.fences[stream.region];
+    if (fence == 0)
+        return;
+
+    GLenum status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+    if (status == GL_TIMEOUT_EXPIRED)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+        while (status == GL_TIMEOUT_EXPIRED)
+            status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, STREAM_WAIT_TIMEOUT);
+        frameStats.waitMilliseconds += std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+        frameStats.stalls++;
+    }
+    glDeleteSync(fence);
+    fence = 0;
+}
+
+/**
+ * Write Data into the current Region of a Stream Buffer; a Region too small for the Frame
+ * makes the Ring grow into a new Buffer (the old one lives until the Frame ends)
+ * @param handle Stream Buffer
+ * @param data Data
+ * @param bytes Size in Bytes
+ * @return Buffer and Byte Offset of the Data, valid for Draws of this Frame
+ */
+StreamRange streamData(StreamHandle handle, const void* data, size_t bytes)
+{
+    StreamBuffer& stream = streamBuffers[handle];
+    if (stream.used + bytes > stream.regionBytes)
+    {
+        retireRing(stream);
+        size_t needed = (stream.used + bytes + STREAM_ALIGNMENT - 1) / STREAM_ALIGNMENT * STREAM_ALIGNMENT;
+        stream.regionBytes = std::max(stream.regionBytes * 2, needed);
+        allocateRing(stream);
+    }
+    if (stream.used == 0)
+        waitForRegion(stream);
+
+    StreamRange range = { stream.buffer, stream.region * stream.regionBytes + stream.used };
+    if (stream.mapped != nullptr)
+    {
+        std::memcpy(stream.mapped + range.offset, data, bytes);
+    }
+    else
+    {
+        // The Fence already guarantees the GPU is done with the Range: no Synchronization by the Driver
+        // ----------------------------------------------------------------------------------------------
+        glBindBuffer(GL_COPY_WRITE_BUFFER, stream.buffer);
+        void* target = glMapBufferRange(GL_COPY_WRITE_BUFFER, range.offset, bytes,
+            GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+        if (target != nullptr)
+        {
+            std::memcpy(target, data, bytes);
+            glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+        }
+        else
+        {
+            glBufferSubData(GL_COPY_WRITE_BUFFER, range.offset, bytes, data);
+        }
+    }
+
+    stream.used += (bytes + STREAM_ALIGNMENT - 1) / STREAM_ALIGNMENT * STREAM_ALIGNMENT;
+    frameStats.bytesStreamed += bytes;
+    return range;
+}
+
+/**
+ * Close the Frame after its Draws were issued: fence every written Region, move on to the next Region
+ * and delete the Buffers outgrown this Frame
+ */
+void endStreamFrame()
+{
+    for (StreamBuffer& stream : streamBuffers)
+    {
+        if (stream.used == 0)
+            continue;
+        stream.fences[stream.region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        stream.region = (stream.region + 1) % STREAM_RING_REGIONS;
+        stream.used = 0;
+    }
+    if (!retiredBuffers.empty())
+    {
+        glDeleteBuffers((GLsizei)retiredBuffers.size(), retiredBuffers.data());
+        retiredBuffers.clear();
+    }
+
+    totalStats.bytesStreamed += frameStats.bytesStreamed;
+    totalStats.waitMilliseconds += frameStats.waitMilliseconds;
+    totalStats.stalls += frameStats.stalls;
+    streamedFrames++;
+    lastFrameStats = frameStats;
+    frameStats = {};
+}
+
+/**
+ * Statistics of the last finished Frame
+ * @return Bytes streamed, Time waited on Fences and Number of Stalls
+ */
+const StreamStats& streamStats()
+{
+    return lastFrameStats;
+}
+
+/**
+ * Delete all Stream Buffers and report the Totals
+ */
+void releaseStreamBuffers()
+{
+    for (StreamBuffer& stream : streamBuffers)
+        retireRing(stream);
+    glDeleteBuffers((GLsizei)retiredBuffers.size(), retiredBuffers.data());
+    retiredBuffers.clear();
+    streamBuffers.clear();
+
+    if (streamedFrames > 0)
+        std::cout << "Streamed " << totalStats.bytesStreamed / (1024.0 * 1024.0) << " MiB in " << streamedFrames << " frames, "
+            << totalStats.stalls << " stalls, " << totalStats.waitMilliseconds << " ms waited" << std::endl;
+}
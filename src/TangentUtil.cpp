@@ -0,0 +1,143 @@
+#include "../include/TangentUtil.h"
+#include "../include/SimdUtil.h"
+
+/**
+ * Tangent and Bitangent of SIMD_WIDTH consecutive Triangles at once
+ * @param frame Output Block: tx, ty, tz, bx, by, bz with SIMD_WIDTH floats each (SoA)
+ * @param vertices Positions
+ * @param uvs UVs
+ * @param corners Corner Indices of the Triangles in SoA Layout (corner0[SIMD_WIDTH], corner1, corner2)
+ */
+static void triangleFramesSimd(float* frame, const float* vertices, const float* uvs, const unsigned int* corners)
+{
+    const unsigned int* c0 = corners;
+    const unsigned int* c1 = corners + SIMD_WIDTH;
+    const unsigned int* c2 = corners + 2 * SIMD_WIDTH;
+
+    floatN p0x = gatherN(vertices, c0, 3, 0), p0y = gatherN(vertices, c0, 3, 1), p0z = gatherN(vertices, c0, 3, 2);
+    floatN e1x = subN(gatherN(vertices, c1, 3, 0), p0x), e1y = subN(gatherN(vertices, c1, 3, 1), p0y), e1z = subN(gatherN(vertices, c1, 3, 2), p0z);
+    floatN e2x = subN(gatherN(vertices, c2, 3, 0), p0x), e2y = subN(gatherN(vertices, c2, 3, 1), p0y), e2z = subN(gatherN(vertices, c2, 3, 2), p0z);
+
+    floatN uv0u = gatherN(uvs, c0, 2, 0), uv0v = gatherN(uvs, c0, 2, 1);
+    floatN du1 = subN(gatherN(uvs, c1, 2, 0), uv0u), dv1 = subN(gatherN(uvs, c1, 2, 1), uv0v);
+    floatN du2 = subN(gatherN(uvs, c2, 2, 0), uv0u), dv2 = subN(gatherN(uvs, c2, 2, 1), uv0v);
+
+    // f = 1 / det, T = f (dv2 e1 - dv1 e2), B = f (du1 e2 - du2 e1); degenerate UVs give a zero Frame
+    // ------------------------------------------------------------------------------------------------
+    floatN f = safeInverseN(subN(mulN(du1, dv2), mulN(du2, dv1)));
+    floatN tx = mulN(f, subN(mulN(dv2, e1x), mulN(dv1, e2x)));
+    floatN ty = mulN(f, subN(mulN(dv2, e1y), mulN(dv1, e2y)));
+    floatN tz = mulN(f, subN(mulN(dv2, e1z), mulN(dv1, e2z)));
+    floatN bx = mulN(f, subN(mulN(du1, e2x), mulN(du2, e1x)));
+    floatN by = mulN(f, subN(mulN(du1, e2y), mulN(du2, e1y)));
+    floatN bz = mulN(f, subN(mulN(du1, e2z), mulN(du2, e1z)));
+
+    // Normalize, so every Triangle weighs the same
+    // --------------------------------------------
+    floatN tInverse = safeInverseN(sqrtN(addN(addN(mulN(tx, tx), mulN(ty, ty)), mulN(tz, tz))));
+    floatN bInverse = safeInverseN(sqrtN(addN(addN(mulN(bx, bx), mulN(by, by)), mulN(bz, bz))));
+    storeN(frame, mulN(tx, tInverse));
+    storeN(frame + SIMD_WIDTH, mulN(ty, tInverse));
+    storeN(frame + 2 * SIMD_WIDTH, mulN(tz, tInverse));
+    storeN(frame + 3 * SIMD_WIDTH, mulN(bx, bInverse));
+    storeN(frame + 4 * SIMD_WIDTH, mulN(by, bInverse));
+    storeN(frame + 5 * SIMD_WIDTH, mulN(bz, bInverse));
+}
+
+/**
+ * Calculate orthonormal Tangents with Handedness for a Mesh
+ *
+ * 1. Triangle Frames: SIMD over SIMD_WIDTH Triangles (AVX2 if compiled with it, else SSE2),
+ *    stored blockwise in SoA Layout; Threads over Block Ranges
+ * 2. Vertex Sums: a Vertex -> Corner List (CSR, Corners in Index Order) is built once,
+ *    then every Thread owns a Vertex Range and walks only the Corners of its Vertices,
+ *    so each Vertex adds its Triangles in the same Order for any Thread Count (deterministic)
+ * 3. Gram-Schmidt against the Normal, w = sign of the Bitangent relative to cross(N, T)
+ * @param vertices Positions (3 floats per Vertex)
+ * @param normals Normals (3 floats per Vertex)
+ * @param uvs UVs (2 floats per Vertex)
+ * @param indices Indices
+ * @param tangents Tangents (4 floats per Vertex: xyz, Handedness)
+ */
+void generateTangents(
+    const std::vector<float>& vertices,
+    const std::vector<float>& normals,
+    const std::vector<float>& uvs,
+    const std::vector<unsigned int>& indices,
+    std::vector<float>& tangents)
+{
+    size_t vertexCount = vertices.size() / 3;
+    size_t triangleCount = indices.size() / 3;
+    size_t blockCount = (triangleCount + SIMD_WIDTH - 1) / SIMD_WIDTH;
+    std::unique_ptr<float[]> frames(new float[blockCount * 6 * SIMD_WIDTH]);
+
+    // 1. Triangle Frames; Lanes past the last Triangle repeat it and are never read
+    // -----------------------------------------------------------------------------
+    parallelFor(blockCount, [&](size_t begin, size_t end)
+        {
+            unsigned int corners[3 * SIMD_WIDTH];
+            for (size_t block = begin; block < end; block++)
+            {
+                for (size_t lane = 0; lane < SIMD_WIDTH; lane++)
+                {
+                    size_t t = std::min(block * SIMD_WIDTH + lane, triangleCount - 1);
+                    for (size_t corner = 0; corner < 3; corner++)
+                        corners[corner * SIMD_WIDTH + lane] = indices[t * 3 + corner];
+                }
+                triangleFramesSimd(&frames[block * 6 * SIMD_WIDTH], vertices.data(), uvs.data(), corners);
+            }
+        });
+
+    // Vertex -> Corner List: Corners of Vertex v are vertexCorners[cornerStart[v], cornerStart[v + 1])
+    // -----------------------------------------------------------------------------------------------
+    size_t cornerCount = triangleCount * 3;
+    std::vector<unsigned int> cornerStart(vertexCount + 1, 0);
+    for (size_t i = 0; i < cornerCount; i++)
+        cornerStart[indices[i] + 1]++;
+    for (size_t v = 0; v < vertexCount; v++)
+        cornerStart[v + 1] += cornerStart[v];
+    std::vector<unsigned int> vertexCorners(cornerCount);
+    std::vector<unsigned int> cornerFill(cornerStart.begin(), cornerStart.end() - 1);
+    for (size_t i = 0; i < cornerCount; i++)
+        vertexCorners[cornerFill[indices[i]]++] = (unsigned int)i;
+
+    // 2. Vertex Sums: Tangent into tangents.xyz, Bitangent into bitangents
+    // --------------------------------------------------------------------
+    tangents.assign(vertexCount * 4, 0.0f);
+    std::vector<float> bitangents(vertexCount * 3, 0.0f);
+    parallelFor(vertexCount, [&](size_t begin, size_t end)
+        {
+            for (size_t v = begin; v < end; v++)
+            {
+                for (unsigned int c = cornerStart[v]; c < cornerStart[v + 1]; c++)
+                {
+                    size_t t = vertexCorners[c] / 3;
+                    const float* frame = &frames[(t / SIMD_WIDTH) * 6 * SIMD_WIDTH + t % SIMD_WIDTH];
+                    tangents[v * 4] += frame[0];
+                    tangents[v * 4 + 1] += frame[SIMD_WIDTH];
+                    tangents[v * 4 + 2] += frame[2 * SIMD_WIDTH];
+                    bitangents[v * 3] += frame[3 * SIMD_WIDTH];
+                    bitangents[v * 3 + 1] += frame[4 * SIMD_WIDTH];
+                    bitangents[v * 3 + 2] += frame[5 * SIMD_WIDTH];
+                }
+            }
+
+            // 3. Gram-Schmidt; fall back to any Perpendicular if the Tangent degenerates
+            // --------------------------------------------------------------------------
+            for (size_t v = begin; v < end; v++)
+            {
+                glm::vec3 n = glm::normalize(glm::vec3(normals[v * 3], normals[v * 3 + 1], normals[v * 3 + 2]));
+                glm::vec3 t(tangents[v * 4], tangents[v * 4 + 1], tangents[v * 4 + 2]);
+                glm::vec3 b(bitangents[v * 3], bitangents[v * 3 + 1], bitangents[v * 3 + 2]);
+                t = t - n * glm::dot(n, t);
+                if (glm::dot(t, t) < 1e-12f)
+                    t = glm::cross(n, std::abs(n.y) < 0.99f ? glm::vec3(0.0f, 1.0f, 0.0f) : glm::vec3(1.0f, 0.0f, 0.0f));
+                t = glm::normalize(t);
+
+                tangents[v * 4] = t.x;
+                tangents[v * 4 + 1] = t.y;
+                tangents[v * 4 + 2] = t.z;
+                tangents[v * 4 + 3] = glm::dot(glm::cross(n, t), b) < 0.0f ? -1.0f : 1.0f;
+            }
+        });
+}
@@ -0,0 +1,638 @@
+#include "../include/TerrainUtil.h"
+#include "../include/BackgroundUtil.h"
+#include "../include/Init.h"
+#include "../include/UniformUtil.h"
+#include "../include/RenderQueueUtil.h"
+
+/**
+ * One Quadtree Node: Chunk (x, y) of 2^level x 2^level on a Cube Face
+ */
+struct TerrainNode
+{
+    int face;
+    unsigned int level;
+    unsigned int x, y;
+
+    uint64_t key() const
+    {
+        return ((uint64_t)face << 60) | ((uint64_t)level << 52) | ((uint64_t)x << 26) | (uint64_t)y;
+    }
+};
+
+/**
+ * Resident Elevation Tile (LRU Cache Entry)
+ */
+struct TerrainTile
+{
+    uint64_t key;
+    unsigned int texture;
+    uint64_t lastFrame;
+};
+
+/**
+ * Elevation loaded by a Worker, waiting for its Upload on the Render Thread
+ */
+struct TerrainTileResult
+{
+    uint64_t key;
+    std::vector<float> heights;
+};
+
+// GPU Side: Program, shared Chunk Grid and the LRU Tile Cache (front = most recently used)
+// ----------------------------------------------------------------------------------------
+static unsigned int terrainProgram = 0, gridVAO = 0, gridVBO = 0, gridEBO = 0, gridIndexCount = 0;
+static std::list<TerrainTile> tileCache;
+static std::unordered_map<uint64_t, std::list<TerrainTile>::iterator> tileIndex;
+static uint64_t terrainFrame = 0;
+
+// Streaming: the Render Thread replaces the Request Queue every Frame with the Tiles it is missing,
+// Workers load them from the Tile Directory (or generate them) into the Result List
+// ------------------------------------------------------------------------------------------------
+static std::mutex streamMutex;
+static std::condition_variable streamCondition;
+static std::deque<uint64_t> requestQueue;
+static std::unordered_set<uint64_t> tilesInFlight;
+static std::vector<TerrainTileResult> tileResults;
+static std::vector<std::thread> streamWorkers;
+static bool stopStreaming = false;
+static bool tileDirectoryReported = false;
+static bool terrainDrawn = false;               // Result of the last updateTerrain
+
+/**
+ * Decode a Node Key
+ * @param key Key from TerrainNode::key()
+ * @return Node
+ */
+static TerrainNode nodeFromKey(uint64_t key)
+{
+    TerrainNode node;
+    node.face = (int)(key >> 60);
+    node.level = (unsigned int)((key >> 52) & 0xFF);
+    node.x = (unsigned int)((key >> 26) & 0x3FFFFFF);
+    node.y = (unsigned int)(key & 0x3FFFFFF);
+    return node;
+}
+
+/**
+ * Point on the unit Sphere for equal-angle Face Coordinates (same Warp as generateCubeSphere and vs_terrain.glsl)
+ * @param face Cube Face
+ * @param a Coordinate along U in [-1, 1]
+ * @param b Coordinate along V in [-1, 1]
+ * @return Direction
+ */
+static glm::vec3 faceDirection(int face, double a, double b)
+{
+    const int* N = CUBE_FACE_AXES[face][0];
+    const int* U = CUBE_FACE_AXES[face][1];
+    glm::dvec3 n(N[0], N[1], N[2]), u(U[0], U[1], U[2]);
+    glm::dvec3 v = glm::cross(n, u);
+    return glm::vec3(glm::normalize(n + u * std::tan(a * M_PI / 4.0) + v * std::tan(b * M_PI / 4.0)));
+}
+
+/**
+ * Face Coordinate of a Chunk's Grid Line
+ * @param level Node Level
+ * @param chunk Chunk Column or Row
+ * @param grid Grid Line inside the Chunk (0 - TERRAIN_GRID)
+ * @return Coordinate in [-1, 1]
+ */
+static double faceCoordinate(unsigned int level, unsigned int chunk, double grid)
+{
+    return -1.0 + 2.0 * (chunk + grid / TERRAIN_GRID) / (double)(1u << level);
+}
+
+// Procedural Elevation (Fallback without Tile Files)
+// --------------------------------------------------
+
+/**
+ * Hash of an integer Lattice Point
+ * @return Value in [-1, 1]
+ */
+static double latticeValue(int64_t x, int64_t y, int64_t z)
+{
+    uint64_t h = (uint64_t)x * 0x9E3779B97F4A7C15ull ^ (uint64_t)y * 0xC2B2AE3D27D4EB4Full ^ (uint64_t)z * 0x165667B19E3779F9ull;
+    h ^= h >> 29;
+    h *= 0xBF58476D1CE4E5B9ull;
+    h ^= h >> 32;
+    return (double)(h >> 11) * (2.0 / 9007199254740992.0) - 1.0;
+}
+
+/**
+ * Smooth trilinear Value Noise
+ * @param p Sample Point
+ * @return Value in [-1, 1]
+ */
+static double valueNoise(const glm::dvec3& p)
+{
+    glm::dvec3 cell = glm::floor(p);
+    glm::dvec3 f = p - cell;
+    glm::dvec3 w = f * f * (3.0 - 2.0 * f);
+    int64_t x = (int64_t)cell.x, y = (int64_t)cell.y, z = (int64_t)cell.z;
+
+    double result = 0.0;
+    for (int corner = 0; corner < 8; corner++)
+    {
+        int dx = corner & 1, dy = (corner >> 1) & 1, dz = corner >> 2;
+        double weight = (dx ? w.x : 1.0 - w.x) * (dy ? w.y : 1.0 - w.y) * (dz ? w.z : 1.0 - w.z);
+        result += weight * latticeValue(x + dx, y + dy, z + dz);
+    }
+    return result;
+}
+
+/**
+ * Fractal Elevation down to the finest Grid Spacing
+ * @param direction Point on the unit Sphere
+ * @return Elevation in Meters
+ */
+static float proceduralElevation(const glm::vec3& direction)
+{
+    double sum = 0.0, amplitude = 1.0, frequency = 2.0;
+    for (unsigned int octave = 0; octave < TERRAIN_MAX_LEVEL + 4; octave++)
+    {
+        sum += amplitude * valueNoise(glm::dvec3(direction) * frequency + (double)octave * 17.0);
+        amplitude *= 0.5;
+        frequency *= 2.0;
+    }
+    return (float)(sum * 4000.0 - 800.0);
+}
+
+/**
+ * Load one Elevation Tile (Worker Thread): the Tile File if there is one, else procedural Elevation;
+ * Oceans are flattened to Sea Level, Heights converted to exaggerated Earth Radii
+ * @param key Node Key
+ * @param heights TERRAIN_TILE_SIZE^2 Heights
+ */
+static void loadTerrainTile(uint64_t key, std::vector<float>& heights)
+{
+    TerrainNode node = nodeFromKey(key);
+    std::vector<float> meters(TERRAIN_TILE_SIZE * TERRAIN_TILE_SIZE);
+
+    std::string path = std::string(TERRAIN_TILE_DIRECTORY) + "/" + std::to_string(node.face) + "/" + std::to_string(node.level)
+        + "/" + std::to_string(node.x) + "_" + std::to_string(node.y) + ".r16";
+    std::ifstream file(path, std::ios::binary);
+    std::vector<unsigned char> raw(meters.size() * 2);
+    if (file && file.read((char*)raw.data(), raw.size()))
+    {
+        for (size_t i = 0; i < meters.size(); i++)
+            meters[i] = (float)(int16_t)(raw[i * 2] | (raw[i * 2 + 1] << 8));
+    }
+    else
+    {
+        for (int row = 0; row < TERRAIN_TILE_SIZE; row++)
+            for (int column = 0; column < TERRAIN_TILE_SIZE; column++)
+                meters[row * TERRAIN_TILE_SIZE + column] = proceduralElevation(faceDirection(node.face,
+                    faceCoordinate(node.level, node.x, column), faceCoordinate(node.level, node.y, row)));
+    }
+
+    heights.resize(meters.size());
+    for (size_t i = 0; i < meters.size(); i++)
+        heights[i] = std::max(meters[i], 0.0f) / EARTH_RADIUS_METERS * TERRAIN_EXAGGERATION;
+}
+
+/**
+ * Streaming Worker: take the oldest Request, load it outside the Lock, hand the Result over
+ */
+static void terrainStreamWorker()
+{
+    std::unique_lock<std::mutex> lock(streamMutex);
+    while (true)
+    {
+        streamCondition.wait(lock, [] { return stopStreaming || !requestQueue.empty(); });
+        if (stopStreaming)
+            return;
+
+        TerrainTileResult result;
+        result.key = requestQueue.front();
+        requestQueue.pop_front();
+        tilesInFlight.insert(result.key);
+
+        lock.unlock();
+        loadTerrainTile(result.key, result.heights);
+        lock.lock();
+        tileResults.push_back(std::move(result));
+    }
+}
+
+/**
+ * Replace the Request Queue with the Tiles missing this Frame (Tiles already in Flight are skipped)
+ * @param wanted missing Tiles, coarse ones first
+ */
+static void requestTerrainTiles(const std::vector<uint64_t>& wanted)
+{
+    std::lock_guard<std::mutex> lock(streamMutex);
+    requestQueue.clear();
+    for (uint64_t key : wanted)
+        if (tilesInFlight.count(key) == 0)
+            requestQueue.push_back(key);
+    if (!requestQueue.empty())
+        streamCondition.notify_all();
+}
+
+/**
+ * LRU Lookup; marks the Tile as used in this Frame
+ * @param key Node Key
+ * @return Tile, nullptr if not resident
+ */
+static TerrainTile* findTerrainTile(uint64_t key)
+{
+    auto it = tileIndex.find(key);
+    if (it == tileIndex.end())
+        return nullptr;
+    tileCache.splice(tileCache.begin(), tileCache, it->second);
+    it->second->lastFrame = terrainFrame;
+    return &*it->second;
+}
+
+/**
+ * True if a new Tile fits into the Cache (possibly by evicting one not used in this Frame)
+ */
+static bool terrainCacheHasRoom()
+{
+    return tileCache.size() < TERRAIN_CACHE_TILES || tileCache.back().lastFrame < terrainFrame;
+}
+
+/**
+ * Upload finished Tiles as Height Textures, evicting the least recently used Tiles beyond the Capacity
+ * (called after the Frame's Tiles have been looked up, so none of them is evicted)
+ */
+static void uploadTerrainTiles()
+{
+    std::vector<TerrainTileResult> results;
+    {
+        std::lock_guard<std::mutex> lock(streamMutex);
+        size_t count = std::min<size_t>(tileResults.size(), TERRAIN_UPLOADS_PER_FRAME);
+        results.assign(std::make_move_iterator(tileResults.begin()), std::make_move_iterator(tileResults.begin() + count));
+        tileResults.erase(tileResults.begin(), tileResults.begin() + count);
+        for (const TerrainTileResult& result : results)
+            tilesInFlight.erase(result.key);
+    }
+
+    for (TerrainTileResult& result : results)
+    {
+        if (tileIndex.count(result.key) != 0 || !terrainCacheHasRoom())
+            continue;
+        if (tileCache.size() >= TERRAIN_CACHE_TILES)
+        {
+            glDeleteTextures(1, &tileCache.back().texture);
+            tileIndex.erase(tileCache.back().key);
+            tileCache.pop_back();
+            invalidateRenderState();    // the Name may come back from glGenTextures
+        }
+
+        unsigned int texture;
+        glGenTextures(1, &texture);
+        bindTexture(2, GL_TEXTURE_2D, texture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_R32F, TERRAIN_TILE_SIZE, TERRAIN_TILE_SIZE, 0, GL_RED, GL_FLOAT, result.heights.data());
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+        tileCache.push_front({ result.key, texture, terrainFrame });
+        tileIndex[result.key] = tileCache.begin();
+    }
+}
+
+/**
+ * Initialize the Terrain: Shader, the Chunk Grid shared by all Chunks and the Streaming Workers
+ *
+ * The Grid has (TERRAIN_GRID + 3)^2 Vertices: the outer Ring repeats the Border Grid Points
+ * as Skirt Vertices, pulled down in the Shader to hide Cracks between Chunks of different Levels
+ * @return False if the Terrain can't be used (Cube Map Surfaces)
+ */
+bool initTerrain()
+{
+    if (sphereGeometryMode == SphereGeometryMode::CubeSphere)
+    {
+        std::cout << "Terrain needs the equirectangular surface textures, disabled for cube spheres" << std::endl;
+        return false;
+    }
+    terrainProgram = loadShader("resources/shader/vs_terrain.glsl", "resources/shader/fs.glsl");
+
+    // Grid Vertices: Column, Row (clamped to the Chunk), 1 for Skirt Vertices
+    // -----------------------------------------------------------------------
+    const int side = TERRAIN_GRID + 3;
+    std::vector<float> grid;
+    std::vector<uint16_t> indices;
+    grid.reserve(side * side * 3);
+    for (int j = -1; j <= TERRAIN_GRID + 1; j++)
+    {
+        for (int i = -1; i <= TERRAIN_GRID + 1; i++)
+        {
+            bool skirt = i < 0 || j < 0 || i > TERRAIN_GRID || j > TERRAIN_GRID;
+            grid.push_back((float)glm::clamp(i, 0, TERRAIN_GRID));
+            grid.push_back((float)glm::clamp(j, 0, TERRAIN_GRID));
+            grid.push_back(skirt ? 1.0f : 0.0f);
+        }
+    }
+    for (int j = 0; j + 1 < side; j++)
+    {
+        for (int i = 0; i + 1 < side; i++)
+        {
+            uint16_t p00 = (uint16_t)(j * side + i), p10 = p00 + 1, p01 = (uint16_t)(p00 + side), p11 = p01 + 1;
+            const uint16_t quad[6] = { p00, p10, p11, p00, p11, p01 };
+            indices.insert(indices.end(), quad, quad + 6);
+        }
+    }
+    gridIndexCount = (unsigned int)indices.size();
+
+    glGenVertexArrays(1, &gridVAO);
+    glGenBuffers(1, &gridVBO);
+    glGenBuffers(1, &gridEBO);
+    glBindVertexArray(gridVAO);
+    glBindBuffer(GL_ARRAY_BUFFER, gridVBO);
+    glBufferData(GL_ARRAY_BUFFER, grid.size() * sizeof(float), grid.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, gridEBO);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(uint16_t), indices.data(), GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glBindVertexArray(0);
+
+    for (unsigned int i = 0; i < TERRAIN_WORKER_THREADS; i++)
+        streamWorkers.emplace_back(terrainStreamWorker);
+    return true;
+}
+
+/**
+ * Per-Frame Streaming Step: once the Camera gets close, stream in the Face Roots;
+ * while the Terrain isn't drawn, finished Tiles are uploaded here (else by drawTerrain)
+ * @param cameraDistance Camera Distance to the Earth Center
+ * @return True if the Terrain should replace the Sphere this Frame (close enough and all Roots resident)
+ */
+bool updateTerrain(float cameraDistance)
+{
+    terrainDrawn = false;
+    if (terrainProgram == 0 || cameraDistance > TERRAIN_STREAM_DISTANCE)
+        return false;
+    terrainFrame++;
+
+    std::vector<uint64_t> missingRoots;
+    for (int face = 0; face < 6; face++)
+    {
+        TerrainNode root = { face, 0, 0, 0 };
+        if (findTerrainTile(root.key()) == nullptr)
+            missingRoots.push_back(root.key());
+    }
+    if (!missingRoots.empty())
+    {
+        if (!tileDirectoryReported)
+        {
+            std::ifstream probe(std::string(TERRAIN_TILE_DIRECTORY) + "/0/0/0_0.r16");
+            std::cout << "Terrain streaming from " << TERRAIN_TILE_DIRECTORY
+                << (probe ? "" : " (no tiles found, procedural elevation)") << std::endl;
+            tileDirectoryReported = true;
+        }
+        requestTerrainTiles(missingRoots);
+    }
+    if (missingRoots.empty() && cameraDistance < TERRAIN_ACTIVATION_DISTANCE)
+        return terrainDrawn = true;
+    uploadTerrainTiles();
+    return false;
+}
+
+/**
+ * Whether the last updateTerrain let the Terrain replace the Sphere (this Frame, once called)
+ */
+bool terrainActive()
+{
+    return terrainDrawn;
+}
+
+/**
+ * Terrain Heights at Points on the unit Sphere, bilinear in the Tiles of one Level (loaded on the calling Thread,
+ * from the Tile Directory or procedurally as by the Workers), e.g. to lift Overlays above the Terrain
+ * @param directions Points on the unit Sphere (3 floats each)
+ * @param level Tile Level (finer Levels follow the Terrain more closely but load more Tiles)
+ * @param heights Heights in exaggerated Earth Radii, one per Point
+ */
+void sampleTerrainHeights(const std::vector<float>& directions, unsigned int level, std::vector<float>& heights)
+{
+    std::unordered_map<uint64_t, std::vector<float>> tiles;
+    unsigned int chunks = 1u << level;
+    heights.resize(directions.size() / 3);
+    for (size_t i = 0; i < heights.size(); i++)
+    {
+        // Cube Face the Direction points through, equal-angle Face Coordinates (Inverse of faceDirection)
+        // ------------------------------------------------------------------------------------------------
+        glm::dvec3 d(directions[i * 3], directions[i * 3 + 1], directions[i * 3 + 2]);
+        int face = 0;
+        double best = -2.0;
+        for (int f = 0; f < 6; f++)
+        {
+            const int* N = CUBE_FACE_AXES[f][0];
+            double along = glm::dot(d, glm::dvec3(N[0], N[1], N[2]));
+            if (along > best)
+            {
+                best = along;
+                face = f;
+            }
+        }
+        const int* U = CUBE_FACE_AXES[face][1];
+        const int* N = CUBE_FACE_AXES[face][0];
+        glm::dvec3 n(N[0], N[1], N[2]), u(U[0], U[1], U[2]);
+        double a = std::atan(glm::dot(d, u) / best) * 4.0 / M_PI;
+        double b = std::atan(glm::dot(d, glm::cross(n, u)) / best) * 4.0 / M_PI;
+
+        // Chunk and Grid Position inside it
+        // ---------------------------------
+        double gridA = (a + 1.0) * 0.5 * chunks, gridB = (b + 1.0) * 0.5 * chunks;
+        TerrainNode node = { face, level, std::min((unsigned int)gridA, chunks - 1), std::min((unsigned int)gridB, chunks - 1) };
+        std::vector<float>& tile = tiles[node.key()];
+        if (tile.empty())
+            loadTerrainTile(node.key(), tile);
+
+        double column = glm::clamp((gridA - node.x) * TERRAIN_GRID, 0.0, (double)TERRAIN_GRID);
+        double row = glm::clamp((gridB - node.y) * TERRAIN_GRID, 0.0, (double)TERRAIN_GRID);
+        int c0 = std::min((int)column, TERRAIN_GRID - 1), r0 = std::min((int)row, TERRAIN_GRID - 1);
+        double fc = column - c0, fr = row - r0;
+        auto height = [&](int r, int c) { return (double)tile[r * TERRAIN_TILE_SIZE + c]; };
+        heights[i] = (float)glm::mix(glm::mix(height(r0, c0), height(r0, c0 + 1), fc), glm::mix(height(r0 + 1, c0), height(r0 + 1, c0 + 1), fc), fr);
+    }
+}
+
+/**
+ * Terrain Shader Program (vs_terrain.glsl + fs.glsl)
+ */
+unsigned int terrainShaderProgram()
+{
+    return terrainProgram;
+}
+
+/**
+ * Chunk Selection State of one Frame
+ */
+struct TerrainSelection
+{
+    glm::vec3 cameraObjectPos;
+    glm::vec4 frustumPlanes[6];         // Object Space, Inside: dot(plane, (p, 1)) >= 0
+    float pixelsPerUnit;                // Screen Pixels per Unit at Distance 1
+    std::vector<const TerrainTile*> tiles;
+    std::vector<TerrainNode> nodes;
+    std::vector<uint64_t> missing;
+};
+
+/**
+ * Distance below which a Node is split: its Grid Spacing (about PI/2 / 2^level / TERRAIN_GRID Radii)
+ * would cover more than TERRAIN_TARGET_EDGE_PIXELS
+ * @param level Node Level
+ * @param pixelsPerUnit Screen Pixels per Unit at Distance 1
+ * @return Split Distance
+ */
+static float splitDistance(unsigned int level, float pixelsPerUnit)
+{
+    float spacing = (float)(M_PI / 2.0) / (float)(1u << level) / TERRAIN_GRID;
+    return spacing * pixelsPerUnit / TERRAIN_TARGET_EDGE_PIXELS;
+}
+
+/**
+ * Walk the Quadtree below a resident Node: split while the Grid Spacing is too large on Screen
+ * and all four Children are resident (missing Children are requested, the Node is drawn meanwhile)
+ * @param node Node
+ * @param tile Tile of the Node
+ * @param selection Frame State, receives the Chunks to draw
+ */
+static void selectTerrainChunks(const TerrainNode& node, const TerrainTile* tile, TerrainSelection& selection)
+{
+    // Bounding Sphere: Chunk Center on the Surface, Corners and the highest Relief inside
+    // -----------------------------------------------------------------------------------
+    glm::vec3 center = faceDirection(node.face, faceCoordinate(node.level, node.x, TERRAIN_GRID * 0.5), faceCoordinate(node.level, node.y, TERRAIN_GRID * 0.5));
+    float radius = 0.0f;
+    for (int corner = 0; corner < 4; corner++)
+    {
+        glm::vec3 p = faceDirection(node.face, faceCoordinate(node.level, node.x, (corner & 1) * TERRAIN_GRID),
+            faceCoordinate(node.level, node.y, (corner >> 1) * TERRAIN_GRID));
+        radius = std::max(radius, glm::length(p - center));
+    }
+    radius += TERRAIN_MAX_HEIGHT;
+
+    for (const glm::vec4& plane : selection.frustumPlanes)
+        if (glm::dot(glm::vec3(plane), center) + plane.w < -radius * glm::length(glm::vec3(plane)))
+            return;
+
+    float distance = std::max(glm::length(selection.cameraObjectPos - center) - radius, 0.0f);
+    if (node.level < TERRAIN_MAX_LEVEL && distance < splitDistance(node.level, selection.pixelsPerUnit))
+    {
+        TerrainNode children[4];
+        const TerrainTile* childTiles[4];
+        bool resident = true;
+        for (int c = 0; c < 4; c++)
+        {
+            children[c] = { node.face, node.level + 1, node.x * 2 + (c & 1), node.y * 2 + (c >> 1) };
+            childTiles[c] = findTerrainTile(children[c].key());
+            if (childTiles[c] == nullptr)
+            {
+                resident = false;
+                if (terrainCacheHasRoom())
+                    selection.missing.push_back(children[c].key());
+            }
+        }
+        if (resident)
+        {
+            for (int c = 0; c < 4; c++)
+                selectTerrainChunks(children[c], childTiles[c], selection);
+            return;
+        }
+    }
+    selection.nodes.push_back(node);
+    selection.tiles.push_back(tile);
+}
+
+/**
+ * Draw the Terrain instead of the Earth Sphere: select the Chunks by Screen-Space Error,
+ * request missing Tiles and draw every Chunk with its Height Tile.
+ * Light, Camera and Matrix Uniforms are expected to be set already (as for the Sphere)
+ * @param shaderProgram Terrain Shader Program
+ * @param model Model Matrix of the Earth (Rotation only)
+ * @param view View Matrix
+ * @param projection Projection Matrix
+ */
+void drawTerrain(unsigned int shaderProgram, const glm::mat4& model, const glm::mat4& view, const glm::mat4& projection)
+{
+    TerrainSelection selection;
+    selection.cameraObjectPos = glm::vec3(glm::inverse(model) * glm::vec4(cameraPos, 1.0f));
+    selection.pixelsPerUnit = projection[1][1] * SCR_HEIGHT * 0.5f;
+
+    // Frustum Planes of the Clip Space Matrix (Gribb/Hartmann), in Object Space
+    // -------------------------------------------------------------------------
+    glm::mat4 clip = glm::transpose(projection * view * model);
+    for (int i = 0; i < 3; i++)
+    {
+        selection.frustumPlanes[i * 2] = clip[3] + clip[i];
+        selection.frustumPlanes[i * 2 + 1] = clip[3] - clip[i];
+    }
+
+    for (int face = 0; face < 6; face++)
+    {
+        TerrainNode root = { face, 0, 0, 0 };
+        selectTerrainChunks(root, findTerrainTile(root.key()), selection);
+    }
+    requestTerrainTiles(selection.missing);
+
+    // Per-Chunk Uniforms
+    // ------------------
+    int faceNormalLoc = uniformLocation(shaderProgram, Uniform::FaceNormal);
+    int faceULoc = uniformLocation(shaderProgram, Uniform::FaceU);
+    int faceVLoc = uniformLocation(shaderProgram, Uniform::FaceV);
+    int chunkOriginLoc = uniformLocation(shaderProgram, Uniform::ChunkOrigin);
+    int chunkSizeLoc = uniformLocation(shaderProgram, Uniform::ChunkSize);
+    int chunkCenterLoc = uniformLocation(shaderProgram, Uniform::ChunkCenter);
+    int morphDistanceLoc = uniformLocation(shaderProgram, Uniform::MorphDistance);
+    int skirtDepthLoc = uniformLocation(shaderProgram, Uniform::SkirtDepth);
+
+    glUniform1i(uniformLocation(shaderProgram, Uniform::HeightTile), 2);
+    glUniform1f(uniformLocation(shaderProgram, Uniform::GridSize), (float)TERRAIN_GRID);
+    glUniform1f(uniformLocation(shaderProgram, Uniform::MorphStart), TERRAIN_MORPH_START);
+    glUniform3fv(uniformLocation(shaderProgram, Uniform::CameraObjectPos), 1, glm::value_ptr(selection.cameraObjectPos));
+
+    bindVertexArray(gridVAO);
+    for (size_t i = 0; i < selection.nodes.size(); i++)
+    {
+        const TerrainNode& node = selection.nodes[i];
+        const int* N = CUBE_FACE_AXES[node.face][0];
+        const int* U = CUBE_FACE_AXES[node.face][1];
+        glm::vec3 n(N[0], N[1], N[2]), u(U[0], U[1], U[2]);
+        glm::vec3 center = faceDirection(node.face, faceCoordinate(node.level, node.x, TERRAIN_GRID * 0.5), faceCoordinate(node.level, node.y, TERRAIN_GRID * 0.5));
+
+        // Geomorph: the Chunk looks like its Parent where the Parent stops being split
+        // ----------------------------------------------------------------------------
+        float morphDistance = node.level == 0 ? 1e30f : splitDistance(node.level - 1, selection.pixelsPerUnit);
+        float spacing = (float)(M_PI / 2.0) / (float)(1u << node.level) / TERRAIN_GRID;
+
+        glUniform3fv(faceNormalLoc, 1, glm::value_ptr(n));
+        glUniform3fv(faceULoc, 1, glm::value_ptr(u));
+        glUniform3fv(faceVLoc, 1, glm::value_ptr(glm::cross(n, u)));
+        glUniform2f(chunkOriginLoc, (float)faceCoordinate(node.level, node.x, 0.0), (float)faceCoordinate(node.level, node.y, 0.0));
+        glUniform1f(chunkSizeLoc, 2.0f / (float)(1u << node.level));
+        glUniform3fv(chunkCenterLoc, 1, glm::value_ptr(center));
+        glUniform1f(morphDistanceLoc, morphDistance);
+        glUniform1f(skirtDepthLoc, 2.0f * spacing + TERRAIN_MAX_HEIGHT / (float)(1u << node.level));
+
+        bindTexture(2, GL_TEXTURE_2D, selection.tiles[i]->texture);
+        glDrawElements(GL_TRIANGLES, gridIndexCount, GL_UNSIGNED_SHORT, 0);
+    }
+
+    uploadTerrainTiles();
+}
+
+/**
+ * Stop the Streaming Workers and release all Tiles
+ */
+void shutdownTerrain()
+{
+    {
+        std::lock_guard<std::mutex> lock(streamMutex);
+        stopStreaming = true;
+    }
+    streamCondition.notify_all();
+    for (std::thread& worker : streamWorkers)
+        worker.join();
+    streamWorkers.clear();
+
+    for (const TerrainTile& tile : tileCache)
+        glDeleteTextures(1, &tile.texture);
+    tileCache.clear();
+    tileIndex.clear();
+    glDeleteVertexArrays(1, &gridVAO);
+    glDeleteBuffers(1, &gridVBO);
+    glDeleteBuffers(1, &gridEBO);
+}
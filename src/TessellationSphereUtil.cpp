@@ -0,0 +1,136 @@
+#include "../include/TessellationSphereUtil.h"
+#include "../include/StaticIcosphereUtil.h"
+#include "../include/UniformUtil.h"
+
+// OpenGL 4.0 Parts missing in the 3.3 GLAD Loader
+// -----------------------------------------------
+#define GL_PATCHES 0x000E
+#define GL_PATCH_VERTICES 0x8E72
+#define GL_TESS_EVALUATION_SHADER 0x8E87
+#define GL_TESS_CONTROL_SHADER 0x8E88
+#define GL_MAX_TESS_GEN_LEVEL 0x8E7E
+
+typedef void (APIENTRYP PFNGLPATCHPARAMETERIPROC)(GLenum pname, GLint value);
+static PFNGLPATCHPARAMETERIPROC patchParameteri = nullptr;
+
+static int maxTessellationLevel = 64;
+static unsigned int patchIndexCount = 0;
+
+/**
+ * Compile one Shader Stage
+ * @param type Shader Type
+ * @param path Path to the Shader
+ * @param name Stage Name for the Error Message
+ * @return Shader ID, 0 on Failure
+ */
+static unsigned int compileStage(GLenum type, const char* path, const char* name)
+{
+    std::string code = readFile(path);
+    const char* source = code.c_str();
+    int success;
+    char infoLog[512];
+
+    unsigned int shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, NULL);
+    glCompileShader(shader);
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+    if (!success)
+    {
+        glGetShaderInfoLog(shader, 512, NULL, infoLog);
+        std::cout << "ERROR::SHADER::" << name << "::COMPILATION_FAILED\n" << infoLog << std::endl;
+        glDeleteShader(shader);
+        return 0;
+    }
+    return shader;
+}
+
+/**
+ * Check for an OpenGL 4.0 Context, load glPatchParameteri and link the Tessellation Sphere Program
+ * (vs_tess -> tcs_sphere -> tes_sphere -> fs)
+ * @return Shader Program, 0 if Tessellation can't be used
+ */
+unsigned int initTessellationShaders()
+{
+    int major = 0;
+    glGetIntegerv(GL_MAJOR_VERSION, &major);
+    if (major < 4)
+        return 0;
+
+    patchParameteri = (PFNGLPATCHPARAMETERIPROC)glfwGetProcAddress("glPatchParameteri");
+    if (patchParameteri == nullptr)
+        return 0;
+    glGetIntegerv(GL_MAX_TESS_GEN_LEVEL, &maxTessellationLevel);
+
+    unsigned int stages[4] =
+    {
+        compileStage(GL_VERTEX_SHADER, "resources/shader/vs_tess.glsl", "VERTEX"),
+        compileStage(GL_TESS_CONTROL_SHADER, "resources/shader/tcs_sphere.glsl", "TESS_CONTROL"),
+        compileStage(GL_TESS_EVALUATION_SHADER, "resources/shader/tes_sphere.glsl", "TESS_EVALUATION"),
+        compileStage(GL_FRAGMENT_SHADER, "resources/shader/fs.glsl", "FRAGMENT")
+    };
+
+    unsigned int program = glCreateProgram();
+    bool compiled = true;
+    for (unsigned int stage : stages)
+    {
+        compiled = compiled && stage != 0;
+        if (stage != 0)
+            glAttachShader(program, stage);
+    }
+    int success = 0;
+    if (compiled)
+    {
+        glLinkProgram(program);
+        glGetProgramiv(program, GL_LINK_STATUS, &success);
+        if (!success)
+        {
+            char infoLog[512];
+            glGetProgramInfoLog(program, 512, NULL, infoLog);
+            std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infoLog << std::endl;
+        }
+    }
+    for (unsigned int stage : stages)
+        glDeleteShader(stage);
+    if (!success)
+    {
+        glDeleteProgram(program);
+        return 0;
+    }
+    reflectUniforms(program);
+    return program;
+}
+
+/**
+ * Fill the bound VAO's VBO and EBO with the Patch Mesh: the welded Level-TESSELLATION_BASE_LEVEL
+ * Icosphere (embedded in the Executable), Positions only (POSITION_VERTEX_LAYOUT), one Patch per Triangle
+ */
+void initTessellatedSphere()
+{
+    static_assert(TESSELLATION_BASE_LEVEL <= STATIC_ICOSPHERE_MAX_LEVEL, "the Patch Mesh has to be embedded");
+    std::vector<float> vertices, normals;
+    std::vector<unsigned int> indices;
+    loadStaticIcosphere(TESSELLATION_BASE_LEVEL, vertices, normals, indices);
+
+    std::vector<uint16_t> patchIndices(indices.begin(), indices.end());
+    patchIndexCount = (unsigned int)patchIndices.size();
+    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_STATIC_DRAW);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, patchIndices.size() * sizeof(uint16_t), patchIndices.data(), GL_STATIC_DRAW);
+
+    std::cout << "Sphere tessellated: " << patchIndexCount / 3 << " patches (level " << TESSELLATION_BASE_LEVEL
+        << "), tessellation level up to " << maxTessellationLevel << ", " << TESSELLATION_MAX_ERROR_PIXELS << " px error" << std::endl;
+}
+
+/**
+ * Draw the Sphere as Patches; the Control Shader picks every Edge's Tessellation Level
+ * from the Model, View and Projection Uniforms already set for the Body
+ * @param shaderProgram Shader Program (initTessellationShaders)
+ */
+void drawTessellatedSphere(unsigned int shaderProgram)
+{
+    glUniform1f(uniformLocation(shaderProgram, Uniform::ViewportHeight), (float)SCR_HEIGHT);
+    glUniform1f(uniformLocation(shaderProgram, Uniform::MaxErrorPixels), TESSELLATION_MAX_ERROR_PIXELS);
+    glUniform1f(uniformLocation(shaderProgram, Uniform::MaxTessellationLevel), (float)maxTessellationLevel);
+
+    patchParameteri(GL_PATCH_VERTICES, 3);
+    glDrawElements(GL_PATCHES, patchIndexCount, GL_UNSIGNED_SHORT, 0);
+}
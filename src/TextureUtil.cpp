@@ -107,3 +107,167 @@ unsigned int loadCubeMap(std::vector<std::string> faces)
 
     return textureID;
 }
+
+/**
+ * Bilinear RGB Sample of an equirectangular Image in the Sphere's Texture Convention
+ * (the Shaders sample at (-u, v) with u = 0.5 + atan2(z, x) / 2PI, v = 0.5 - asin(y) / PI)
+ * @param data RGB Image Data, Row 0 = North
+ * @param width Width
+ * @param height Height
+ * @param direction Direction on the Unit Sphere
+ * @return RGB in [0, 255]
+ */
+static glm::vec3 sampleEquirect(const unsigned char* data, int width, int height, const glm::vec3& direction)
+{
+    float u = 0.5f + std::atan2(direction.z, direction.x) / (2.0f * (float)M_PI);
+    float v = 0.5f - std::asin(glm::clamp(direction.y, -1.0f, 1.0f)) / (float)M_PI;
+    float x = (-u - std::floor(-u)) * width - 0.5f;
+    float y = glm::clamp(v * height - 0.5f, 0.0f, (float)(height - 1));
+
+    int x0 = (int)std::floor(x), y0 = (int)y;
+    float fx = x - x0, fy = y - y0;
+    int y1 = std::min(y0 + 1, height - 1);
+    auto texel = [&](int px, int py)
+    {
+        px = ((px % width) + width) % width;
+        const unsigned char* t = &data[((size_t)py * width + px) * 3];
+        return glm::vec3(t[0], t[1], t[2]);
+    };
+    return glm::mix(glm::mix(texel(x0, y0), texel(x0 + 1, y0), fx), glm::mix(texel(x0, y1), texel(x0 + 1, y1), fx), fy);
+}
+
+/**
+ * Bake an equirectangular RGB Image into the bound equal-angle Cube Map (see loadEquirectCubeMap)
+ * @param data RGB Image Data, Row 0 = North
+ * @param width Width
+ * @param height Height
+ * @param tangentSpaceNormals True for a Normal Map
+ * @return Face Size in Texels
+ */
+static int bakeEquirectCubeMap(const unsigned char* data, int width, int height, bool tangentSpaceNormals)
+{
+    // Direction of Face Coordinates (s, t) per Cube Map Face (+X, -X, +Y, -Y, +Z, -Z)
+    // -------------------------------------------------------------------------------
+    auto faceDirection = [](int face, float s, float t)
+    {
+        switch (face)
+        {
+        case 0: return glm::vec3(1.0f, -t, -s);
+        case 1: return glm::vec3(-1.0f, -t, s);
+        case 2: return glm::vec3(s, 1.0f, t);
+        case 3: return glm::vec3(s, -1.0f, -t);
+        case 4: return glm::vec3(s, -t, 1.0f);
+        default: return glm::vec3(-s, -t, -1.0f);
+        }
+    };
+
+    int faceSize = std::max(1, width / 4);
+    std::vector<unsigned char> faceData((size_t)faceSize * faceSize * 3);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);     // RGB Rows of odd Face Sizes are not 4-byte aligned
+    for (int face = 0; face < 6; face++)
+    {
+        for (int y = 0; y < faceSize; y++)
+        {
+            for (int x = 0; x < faceSize; x++)
+            {
+                float s = std::tan(((2.0f * x + 1.0f) / faceSize - 1.0f) * (float)M_PI / 4.0f);
+                float t = std::tan(((2.0f * y + 1.0f) / faceSize - 1.0f) * (float)M_PI / 4.0f);
+                glm::vec3 n = glm::normalize(faceDirection(face, s, t));
+                glm::vec3 rgb = sampleEquirect(data, width, height, n);
+
+                if (tangentSpaceNormals)
+                {
+                    glm::vec3 local = glm::normalize(rgb / 255.0f * 2.0f - 1.0f);
+                    glm::vec3 tangent(-n.z, 0.0f, n.x);
+                    tangent = glm::dot(tangent, tangent) > 1e-12f ? glm::normalize(tangent) : glm::vec3(1.0f, 0.0f, 0.0f);
+                    glm::vec3 bitangent = glm::cross(n, tangent);
+                    glm::vec3 objectNormal = glm::normalize(tangent * local.x + bitangent * local.y + n * local.z);
+                    rgb = (objectNormal * 0.5f + 0.5f) * 255.0f;
+                }
+
+                unsigned char* texel = &faceData[((size_t)y * faceSize + x) * 3];
+                for (int c = 0; c < 3; c++)
+                    texel[c] = (unsigned char)glm::clamp(rgb[c] + 0.5f, 0.0f, 255.0f);
+            }
+        }
+        glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, 0, GL_RGB, faceSize, faceSize, 0, GL_RGB, GL_UNSIGNED_BYTE, faceData.data());
+    }
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+    glGenerateMipmap(GL_TEXTURE_CUBE_MAP);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+    glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
+    return faceSize;
+}
+
+/**
+ * Resample an equirectangular Texture into an equal-angle Cube Map for Cube Sphere Bodies
+ *
+ * Face Texel (s, t) in [-1, 1] holds the Direction with Face Coordinates tan(s * PI/4), tan(t * PI/4),
+ * which spreads the Texels evenly over the Sphere (fs_cube.glsl applies the inverse Warp).
+ * Faces are width/4 wide -> same Texel Density at the Equator as the Source, 25% fewer Texels, no Poles or Seams.
+ * Tangent-space Normal Maps are turned into object-space Normals with the analytic Frame
+ * of the equirectangular Mapping (T east, B = cross(N, T)), so no Tangents are needed at all.
+ * @param path Path to the equirectangular Texture
+ * @param tangentSpaceNormals True for a Normal Map
+ * @return Texture ID
+ */
+unsigned int loadEquirectCubeMap(const char* path, bool tangentSpaceNormals)
+{
+    unsigned int textureID;
+    glGenTextures(1, &textureID);
+    glBindTexture(GL_TEXTURE_CUBE_MAP, textureID);
+
+    int width, height, nrChannels;
+    unsigned char* data = stbi_load(path, &width, &height, &nrChannels, 3);
+    if (!data)
+    {
+        std::cout << "Failed to load texture " << path << std::endl;
+        return textureID;
+    }
+
+    int faceSize = bakeEquirectCubeMap(data, width, height, tangentSpaceNormals);
+    stbi_image_free(data);
+
+    std::cout << "Cube map " << path << ": " << width << "x" << height << " -> 6 x " << faceSize << "^2 texels" << std::endl;
+    return textureID;
+}
+
+/**
+ * Normal Map without Relief for Bodies that have none, so every Body can be drawn with the same Shader
+ * @param cubeMap True for an object-space Cube Map (Cube Sphere Bodies), else a 1x1 tangent-space Texture
+ * @return Texture ID
+ */
+unsigned int createFlatNormalMap(bool cubeMap)
+{
+    unsigned int textureID;
+    glGenTextures(1, &textureID);
+
+    // Tangent-space (0, 0, 1) everywhere; the Cube Map bakes it into the Sphere Normals
+    // ---------------------------------------------------------------------------------
+    const unsigned char flat[3] = { 128, 128, 255 };
+    if (cubeMap)
+    {
+        const int width = 4 * FLAT_NORMAL_CUBE_FACE_SIZE, height = width / 2;
+        std::vector<unsigned char> data((size_t)width * height * 3);
+        for (size_t i = 0; i < data.size(); i++)
+            data[i] = flat[i % 3];
+        glBindTexture(GL_TEXTURE_CUBE_MAP, textureID);
+        bakeEquirectCubeMap(data.data(), width, height, true);
+        return textureID;
+    }
+
+    glBindTexture(GL_TEXTURE_2D, textureID);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, 1, 1, 0, GL_RGB, GL_UNSIGNED_BYTE, flat);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    return textureID;
+}
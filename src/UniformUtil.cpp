@@ -0,0 +1,128 @@
+#include "../include/UniformUtil.h"
+
+// GLSL Names of the Uniform Enum
+// ------------------------------
+static const char* const UNIFORM_NAMES[] =
+{
+    "model", "objectFromView",
+    "texture1", "normalMap", "heightTile", "skybox",
+    "subdivisions", "icosahedronVertices", "icosahedronFaces", "wordsPerVertex", "baseWord",
+    "blockSide", "blockLattice", "blockIndices",
+    "viewportHeight", "maxErrorPixels", "maxTessellationLevel",
+    "faceNormal", "faceU", "faceV", "chunkOrigin", "chunkSize", "chunkCenter",
+    "morphDistance", "skirtDepth", "gridSize", "morphStart", "cameraObjectPos",
+    "overlayRadius", "terrainHeightScale"
+};
+static_assert(sizeof(UNIFORM_NAMES) / sizeof(UNIFORM_NAMES[0]) == (size_t)Uniform::Count, "one Name per Uniform");
+
+// Locations per Program, indexed by the Program ID (-1: not active in that Program)
+// ---------------------------------------------------------------------------------
+struct UniformTable
+{
+    int locations[(size_t)Uniform::Count];
+};
+
+static std::vector<UniformTable> uniformTables;
+static unsigned int frameUBO = 0;
+
+/**
+ * Reflect the active Uniforms of a linked Program into its Location Table
+ *
+ * Runs once at Link Time: every active Uniform (Arrays by their Base Name) is matched
+ * against UNIFORM_NAMES, so the Frame Loop only indexes the Table. Members of the Frame
+ * Block have no Location; the Block is bound to FRAME_UNIFORM_BINDING instead.
+ * @param program linked Shader Program
+ */
+void reflectUniforms(unsigned int program)
+{
+    if (program >= uniformTables.size())
+        uniformTables.resize(program + 1);
+    UniformTable& table = uniformTables[program];
+    std::fill(table.locations, table.locations + (size_t)Uniform::Count, -1);
+
+    unsigned int frameBlock = glGetUniformBlockIndex(program, FRAME_UNIFORM_BLOCK);
+    if (frameBlock != GL_INVALID_INDEX)
+        glUniformBlockBinding(program, frameBlock, FRAME_UNIFORM_BINDING);
+
+    int activeCount = 0;
+    glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &activeCount);
+    for (int i = 0; i < activeCount; i++)
+    {
+        GLuint index = (GLuint)i;
+        GLint block = -1;
+        glGetActiveUniformsiv(program, 1, &index, GL_UNIFORM_BLOCK_INDEX, &block);
+        if (block != -1)
+            continue;
+
+        char name[256];
+        GLsizei length = 0;
+        GLint size = 0;
+        GLenum type = 0;
+        glGetActiveUniform(program, (GLuint)i, sizeof(name), &length, &size, &type, name);
+        if (length > 3 && std::strcmp(name + length - 3, "[0]") == 0)
+            name[length - 3] = '\0';
+
+        const char* const* found = std::find_if(std::begin(UNIFORM_NAMES), std::end(UNIFORM_NAMES),
+            [&](const char* known) { return std::strcmp(known, name) == 0; });
+        if (found == std::end(UNIFORM_NAMES))
+        {
+            std::cout << "Uniform " << name << " of shader program " << program << " is not in the uniform table" << std::endl;
+            continue;
+        }
+        table.locations[found - std::begin(UNIFORM_NAMES)] = glGetUniformLocation(program, name);
+    }
+}
+
+/**
+ * Location of a Uniform, as reflected at Link Time
+ * @param program Shader Program
+ * @param uniform Uniform
+ * @return Location, -1 if the Uniform is not active (glUniform* ignores -1)
+ */
+int uniformLocation(unsigned int program, Uniform uniform)
+{
+    if (program >= uniformTables.size())
+        return -1;
+    return uniformTables[program].locations[(size_t)uniform];
+}
+
+/**
+ * Create the Frame Uniform Buffer and bind it to FRAME_UNIFORM_BINDING for all Programs
+ */
+void initFrameUniforms()
+{
+    glGenBuffers(1, &frameUBO);
+    glBindBuffer(GL_UNIFORM_BUFFER, frameUBO);
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(FrameUniforms), NULL, GL_DYNAMIC_DRAW);
+    glBindBufferBase(GL_UNIFORM_BUFFER, FRAME_UNIFORM_BINDING, frameUBO);
+}
+
+/**
+ * Upload Camera and Light once per Frame, before the first Draw
+ * @param view View Matrix
+ * @param projection Projection Matrix
+ * @param lightPos Position of the Light
+ * @param lightColor Color and Intensity of the Light
+ * @param viewPos Camera Position
+ * @param earthPos Position of the Earth
+ */
+void updateFrameUniforms(const glm::mat4& view, const glm::mat4& projection,
+    const glm::vec3& lightPos, const glm::vec3& lightColor, const glm::vec3& viewPos, const glm::vec3& earthPos)
+{
+    FrameUniforms frame;
+    frame.view = view;
+    frame.projection = projection;
+    frame.lightPos = glm::vec4(lightPos, 1.0f);
+    frame.lightColor = glm::vec4(lightColor, 1.0f);
+    frame.viewPos = glm::vec4(viewPos, 1.0f);
+    frame.earthPos = glm::vec4(earthPos, 1.0f);
+
+    glBindBuffer(GL_UNIFORM_BUFFER, frameUBO);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(FrameUniforms), &frame);
+}
+
+void releaseFrameUniforms()
+{
+    glDeleteBuffers(1, &frameUBO);
+    frameUBO = 0;
+}
@@ -0,0 +1,275 @@
+#include "../include/UvUtil.h"
+#include "../include/TextureUtil.h"
+
+#include <emmintrin.h>
+
+/**
+ * atan(x) for x in [0, 1], |Error| <= UV_ATAN_MAX_ERROR (Abramowitz & Stegun 4.4.49)
+ * @param x 4 Values in [0, 1]
+ * @return 4 Angles in [0, PI / 4]
+ */
+static inline __m128 atanPoly(__m128 x)
+{
+    __m128 x2 = _mm_mul_ps(x, x);
+    __m128 p = _mm_set1_ps((float)UV_ATAN_COEFFICIENTS[0]);
+    for (int k = 1; k < 9; k++)
+        p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps((float)UV_ATAN_COEFFICIENTS[k]));
+    return _mm_mul_ps(p, x);
+}
+
+/**
+ * Select a where mask is set, else b
+ */
+static inline __m128 selectPs(__m128 mask, __m128 a, __m128 b)
+{
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+/**
+ * atan2(y, x) for 4 Pairs: reduce to atan on [0, 1] by Octant, same Conventions as std::atan2
+ * @param y 4 y Values
+ * @param x 4 x Values
+ * @return 4 Angles in [-PI, PI]
+ */
+static inline __m128 atan2Simd(__m128 y, __m128 x)
+{
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    __m128 ax = _mm_andnot_ps(signMask, x);
+    __m128 ay = _mm_andnot_ps(signMask, y);
+    __m128 mx = _mm_max_ps(ax, ay);
+    __m128 mn = _mm_min_ps(ax, ay);
+    __m128 ratio = _mm_and_ps(_mm_cmpgt_ps(mx, _mm_setzero_ps()), _mm_div_ps(mn, mx));
+
+    __m128 r = atanPoly(ratio);
+    r = selectPs(_mm_cmpgt_ps(ay, ax), _mm_sub_ps(_mm_set1_ps((float)(M_PI / 2.0)), r), r);
+    r = selectPs(_mm_cmplt_ps(x, _mm_setzero_ps()), _mm_sub_ps(_mm_set1_ps((float)M_PI), r), r);
+    return _mm_or_ps(r, _mm_and_ps(signMask, y));
+}
+
+/**
+ * asin(x) for 4 Values in [-1, 1], |Error| <= UV_ASIN_MAX_ERROR (Abramowitz & Stegun 4.4.46)
+ * @param x 4 Values in [-1, 1]
+ * @return 4 Angles in [-PI / 2, PI / 2]
+ */
+static inline __m128 asinSimd(__m128 x)
+{
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    __m128 ax = _mm_min_ps(_mm_andnot_ps(signMask, x), _mm_set1_ps(1.0f));
+    __m128 p = _mm_set1_ps((float)UV_ASIN_COEFFICIENTS[0]);
+    for (int k = 1; k < 8; k++)
+        p = _mm_add_ps(_mm_mul_ps(p, ax), _mm_set1_ps((float)UV_ASIN_COEFFICIENTS[k]));
+    __m128 r = _mm_sub_ps(_mm_set1_ps((float)(M_PI / 2.0)), _mm_mul_ps(_mm_sqrt_ps(_mm_sub_ps(_mm_set1_ps(1.0f), ax)), p));
+    return _mm_or_ps(r, _mm_and_ps(signMask, x));
+}
+
+/**
+ * Equirectangular u and v for all Vertices, 4 at a time (same Mapping as calculateUVs)
+ * u = 0.5 + atan2(z, x) / 2PI, v = 0.5 - asin(y) / PI
+ * @param vertices Positions on the Unit Sphere (3 floats per Vertex)
+ * @param uvs UVs (2 floats per Vertex)
+ */
+void calculateUVsSimd(const std::vector<float>& vertices, std::vector<float>& uvs)
+{
+    size_t vertexCount = vertices.size() / 3;
+    uvs.resize(vertexCount * 2);
+    const float* p = vertices.data();
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 uScale = _mm_set1_ps((float)(0.5 / M_PI));
+    const __m128 vScale = _mm_set1_ps((float)(1.0 / M_PI));
+
+    size_t i = 0;
+    for (; i + 4 <= vertexCount; i += 4)
+    {
+        const float* q = p + i * 3;
+        __m128 x = _mm_setr_ps(q[0], q[3], q[6], q[9]);
+        __m128 y = _mm_setr_ps(q[1], q[4], q[7], q[10]);
+        __m128 z = _mm_setr_ps(q[2], q[5], q[8], q[11]);
+
+        __m128 u = _mm_add_ps(half, _mm_mul_ps(atan2Simd(z, x), uScale));
+        __m128 v = _mm_sub_ps(half, _mm_mul_ps(asinSimd(y), vScale));
+        _mm_storeu_ps(&uvs[i * 2], _mm_unpacklo_ps(u, v));
+        _mm_storeu_ps(&uvs[i * 2 + 4], _mm_unpackhi_ps(u, v));
+    }
+
+    // Remainder: pad one Block with the last Vertex
+    // ---------------------------------------------
+    if (i < vertexCount)
+    {
+        float x[4], y[4], z[4], u[4], v[4];
+        for (size_t lane = 0; lane < 4; lane++)
+        {
+            size_t k = std::min(i + lane, vertexCount - 1);
+            x[lane] = p[k * 3];
+            y[lane] = p[k * 3 + 1];
+            z[lane] = p[k * 3 + 2];
+        }
+        _mm_storeu_ps(u, _mm_add_ps(half, _mm_mul_ps(atan2Simd(_mm_loadu_ps(z), _mm_loadu_ps(x)), uScale)));
+        _mm_storeu_ps(v, _mm_sub_ps(half, _mm_mul_ps(asinSimd(_mm_loadu_ps(y)), vScale)));
+        for (size_t lane = 0; i + lane < vertexCount; lane++)
+        {
+            uvs[(i + lane) * 2] = u[lane];
+            uvs[(i + lane) * 2 + 1] = v[lane];
+        }
+    }
+}
+
+/**
+ * Append a Copy of a Vertex (Position, Normal) with its own UV
+ * @return Index of the Copy
+ */
+static unsigned int duplicateVertex(unsigned int source, float u, float v,
+    std::vector<float>& vertices, std::vector<float>& normals, std::vector<float>& uvs)
+{
+    unsigned int copy = (unsigned int)(vertices.size() / 3);
+    for (int c = 0; c < 3; c++)
+    {
+        vertices.push_back(vertices[source * 3 + c]);
+        normals.push_back(normals[source * 3 + c]);
+    }
+    uvs.push_back(u);
+    uvs.push_back(v);
+    return copy;
+}
+
+/**
+ * Seam-correct UVs for a Sphere Mesh
+ *
+ * 1. u and v per Vertex with calculateUVsSimd
+ * 2. Date Line: a Triangle whose u Values span more than half the Texture wraps around;
+ *    its Vertices on the small Side get a Copy with u + 1 (one Copy per Vertex, shared by all such Triangles)
+ * 3. Poles: u is undefined there, so every Triangle gets its own Copy of the Pole Vertex
+ *    with u = Average of the two other Corners
+ * @param vertices Positions on the Unit Sphere (Copies are appended)
+ * @param normals Normals (Copies are appended)
+ * @param indices Indices (rewritten to the Copies)
+ * @param uvs UVs (2 floats per Vertex)
+ */
+void calculateSphereUVs(
+    std::vector<float>& vertices,
+    std::vector<float>& normals,
+    std::vector<unsigned int>& indices,
+    std::vector<float>& uvs)
+{
+    calculateUVsSimd(vertices, uvs);
+    size_t vertexCount = vertices.size() / 3;
+    auto isPole = [&](unsigned int index) { return std::abs(vertices[index * 3 + 1]) > 1.0f - 1e-6f; };
+
+    // 2. Date Line
+    // ------------
+    std::vector<unsigned int> wrapped(vertexCount, UINT32_MAX);
+    for (size_t t = 0; t < indices.size(); t += 3)
+    {
+        float uMin = 1.0f, uMax = 0.0f;
+        for (int c = 0; c < 3; c++)
+        {
+            unsigned int index = indices[t + c];
+            if (isPole(index))
+                continue;
+            uMin = std::min(uMin, uvs[index * 2]);
+            uMax = std::max(uMax, uvs[index * 2]);
+        }
+        if (uMax - uMin <= 0.5f)
+            continue;
+
+        for (int c = 0; c < 3; c++)
+        {
+            unsigned int index = indices[t + c];
+            if (isPole(index) || uvs[index * 2] >= 0.5f)
+                continue;
+            if (wrapped[index] == UINT32_MAX)
+                wrapped[index] = duplicateVertex(index, uvs[index * 2] + 1.0f, uvs[index * 2 + 1], vertices, normals, uvs);
+            indices[t + c] = wrapped[index];
+        }
+    }
+
+    // 3. Poles
+    // --------
+    for (size_t t = 0; t < indices.size(); t += 3)
+    {
+        for (int c = 0; c < 3; c++)
+        {
+            unsigned int index = indices[t + c];
+            if (index >= vertexCount || !isPole(index))
+                continue;
+            unsigned int a = indices[t + (c + 1) % 3], b = indices[t + (c + 2) % 3];
+            float u = 0.5f * (uvs[a * 2] + uvs[b * 2]);
+            indices[t + c] = duplicateVertex(index, u, uvs[index * 2 + 1], vertices, normals, uvs);
+        }
+    }
+}
+
+/**
+ * Largest Error of the atan and asin Polynomials on [0, 1], evaluated in double
+ * @param atanError Radians
+ * @param asinError Radians
+ */
+static void measurePolynomialErrors(double& atanError, double& asinError)
+{
+    const int samples = 1 << 20;
+    atanError = 0.0;
+    asinError = 0.0;
+    for (int i = 0; i <= samples; i++)
+    {
+        double x = (double)i / samples, p = 0.0, q = 0.0;
+        for (double a : UV_ATAN_COEFFICIENTS)
+            p = p * x * x + a;
+        for (double a : UV_ASIN_COEFFICIENTS)
+            q = q * x + a;
+        atanError = std::max(atanError, std::abs(p * x - std::atan(x)));
+        asinError = std::max(asinError, std::abs(M_PI / 2.0 - std::sqrt(1.0 - x) * q - std::asin(x)));
+    }
+}
+
+/**
+ * Compare calculateUVsSimd with the scalar calculateUVs on the finest Sphere Level:
+ * Time per Pass and largest Difference to a double Precision Reference;
+ * checks the documented Polynomial Bounds UV_ATAN_MAX_ERROR and UV_ASIN_MAX_ERROR
+ * @return False if a Polynomial exceeds its Bound
+ */
+bool benchmarkUVs()
+{
+    const unsigned int level = 8;
+    const int runs = 20;
+    std::vector<float> vertices, normals, scalarUVs, simdUVs;
+    std::vector<unsigned int> indices;
+    generateIcosphere(level, vertices, normals, indices);
+
+    auto timePass = [&](auto pass)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (int run = 0; run < runs; run++)
+            pass();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / runs;
+    };
+    double scalarMs = timePass([&]() { calculateUVs(vertices, scalarUVs); });
+    double simdMs = timePass([&]() { calculateUVsSimd(vertices, simdUVs); });
+
+    // Errors against double Precision; u Differences of a full Turn at the Date Line do not count
+    // --------------------------------------------------------------------------------------------
+    double scalarError = 0.0, simdError = 0.0;
+    for (size_t i = 0; i < vertices.size() / 3; i++)
+    {
+        double x = vertices[i * 3], y = vertices[i * 3 + 1], z = vertices[i * 3 + 2];
+        double u = 0.5 + std::atan2(z, x) / (2.0 * M_PI);
+        double v = 0.5 - std::asin(std::min(1.0, std::max(-1.0, y))) / M_PI;
+        auto error = [&](const std::vector<float>& uvs)
+        {
+            double du = std::abs(uvs[i * 2] - u);
+            return std::max(std::min(du, std::abs(du - 1.0)), std::abs(uvs[i * 2 + 1] - v));
+        };
+        scalarError = std::max(scalarError, error(scalarUVs));
+        simdError = std::max(simdError, error(simdUVs));
+    }
+
+    std::cout << "UV benchmark (level " << level << ", " << vertices.size() / 3 << " vertices, " << runs << " runs)" << std::endl;
+    std::cout << "  scalar calculateUVs:   " << scalarMs << " ms, max error " << scalarError << std::endl;
+    std::cout << "  SIMD calculateUVsSimd: " << simdMs << " ms, max error " << simdError
+        << " (" << scalarMs / simdMs << "x)" << std::endl;
+
+    double atanError, asinError;
+    measurePolynomialErrors(atanError, asinError);
+    bool ok = atanError <= UV_ATAN_MAX_ERROR && asinError <= UV_ASIN_MAX_ERROR;
+    std::cout << "  polynomials: atan max error " << atanError << " (bound " << UV_ATAN_MAX_ERROR << "), asin max error "
+        << asinError << " (bound " << UV_ASIN_MAX_ERROR << ")" << (ok ? " -> ok" : " -> exceeded") << std::endl;
+    return ok;
+}
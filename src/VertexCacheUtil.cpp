@@ -0,0 +1,150 @@
+#include "../include/VertexCacheUtil.h"
+
+/**
+ * Reorder Triangles for a FIFO Post-Transform Vertex Cache (Tipsify, Sander et al. 2007)
+ *
+ * Emits all remaining Triangles around a Fanning Vertex, then continues with the
+ * Neighbor that is still in the Cache and has the most Cache Time left; on a dead End
+ * it goes back to recently used Vertices, then to the next Vertex with live Triangles.
+ * @param indices Indices to reorder in Place
+ * @param indexCount Number of Indices (multiple of 3)
+ * @param vertexCount Number of Vertices referenced
+ */
+void optimizeVertexCache(unsigned int* indices, size_t indexCount, size_t vertexCount)
+{
+    const size_t cacheSize = VERTEX_CACHE_SIZE;
+    size_t triangleCount = indexCount / 3;
+    if (triangleCount == 0)
+        return;
+
+    // Vertex -> Triangle Adjacency (CSR)
+    // ----------------------------------
+    std::vector<unsigned int> adjacencyOffset(vertexCount + 1, 0);
+    std::vector<unsigned int> adjacency(indexCount);
+    for (size_t i = 0; i < indexCount; i++)
+        adjacencyOffset[indices[i] + 1]++;
+    for (size_t v = 0; v < vertexCount; v++)
+        adjacencyOffset[v + 1] += adjacencyOffset[v];
+    std::vector<unsigned int> cursor(adjacencyOffset.begin(), adjacencyOffset.end() - 1);
+    for (size_t i = 0; i < indexCount; i++)
+        adjacency[cursor[indices[i]]++] = (unsigned int)(i / 3);
+
+    std::vector<unsigned int> liveTriangles(vertexCount);
+    for (size_t v = 0; v < vertexCount; v++)
+        liveTriangles[v] = adjacencyOffset[v + 1] - adjacencyOffset[v];
+    std::vector<size_t> cacheTime(vertexCount, 0);
+    std::vector<char> triangleEmitted(triangleCount, 0);
+    std::vector<unsigned int> result, deadEnd, candidates;
+    result.reserve(indexCount);
+
+    size_t time = cacheSize + 1;
+    size_t scan = 0;
+    long fanning = indices[0];
+    while (fanning >= 0)
+    {
+        // Emit every remaining Triangle around the Fanning Vertex
+        // -------------------------------------------------------
+        candidates.clear();
+        for (unsigned int a = adjacencyOffset[fanning]; a < adjacencyOffset[fanning + 1]; a++)
+        {
+            unsigned int t = adjacency[a];
+            if (triangleEmitted[t])
+                continue;
+            triangleEmitted[t] = 1;
+            for (unsigned int corner = 0; corner < 3; corner++)
+            {
+                unsigned int v = indices[t * 3 + corner];
+                result.push_back(v);
+                deadEnd.push_back(v);
+                candidates.push_back(v);
+                liveTriangles[v]--;
+                if (time - cacheTime[v] > cacheSize)
+                    cacheTime[v] = time++;
+            }
+        }
+
+        // Next Fanning Vertex: a Candidate that stays in the Cache for its remaining Triangles
+        // ------------------------------------------------------------------------------------
+        long next = -1;
+        long bestPriority = -1;
+        for (unsigned int v : candidates)
+        {
+            if (liveTriangles[v] == 0)
+                continue;
+            long priority = 0;
+            if (time - cacheTime[v] + 2 * liveTriangles[v] <= cacheSize)
+                priority = (long)(time - cacheTime[v]);
+            if (priority > bestPriority)
+            {
+                bestPriority = priority;
+                next = v;
+            }
+        }
+        while (next < 0 && !deadEnd.empty())
+        {
+            unsigned int v = deadEnd.back();
+            deadEnd.pop_back();
+            if (liveTriangles[v] > 0)
+                next = v;
+        }
+        while (next < 0 && scan < vertexCount)
+        {
+            if (liveTriangles[scan] > 0)
+                next = (long)scan;
+            scan++;
+        }
+        fanning = next;
+    }
+    std::copy(result.begin(), result.end(), indices);
+}
+
+/**
+ * Renumber Vertices in the Order of their first Use so Vertex Fetch runs linearly
+ * @param indices Indices to rewrite in Place
+ * @param indexCount Number of Indices
+ * @param vertexRemap for every new Vertex the old Vertex Index
+ */
+void optimizeVertexFetch(unsigned int* indices, size_t indexCount, std::vector<unsigned int>& vertexRemap)
+{
+    std::unordered_map<unsigned int, unsigned int> newIndex;
+    vertexRemap.clear();
+    for (size_t i = 0; i < indexCount; i++)
+    {
+        auto it = newIndex.find(indices[i]);
+        if (it == newIndex.end())
+        {
+            it = newIndex.emplace(indices[i], (unsigned int)vertexRemap.size()).first;
+            vertexRemap.push_back(indices[i]);
+        }
+        indices[i] = it->second;
+    }
+}
+
+/**
+ * Simulate a FIFO Post-Transform Cache over an Index Stream
+ * @param indices Indices
+ * @param indexCount Number of Indices
+ * @param vertexCount Number of Vertices in the Buffer
+ * @param cacheSize FIFO Entries
+ * @return ACMR and ATVR
+ */
+VertexCacheStats analyzeVertexCache(const unsigned int* indices, size_t indexCount, size_t vertexCount, unsigned int cacheSize)
+{
+    // Entry inserted at Miss m is evicted after cacheSize further Misses
+    // ------------------------------------------------------------------
+    std::vector<size_t> insertedAt(vertexCount, (size_t)-1);
+    size_t misses = 0;
+    for (size_t i = 0; i < indexCount; i++)
+    {
+        size_t& inserted = insertedAt[indices[i]];
+        if (inserted == (size_t)-1 || misses - inserted >= cacheSize)
+        {
+            inserted = misses;
+            misses++;
+        }
+    }
+    VertexCacheStats stats;
+    stats.acmr = indexCount ? (float)misses / (indexCount / 3) : 0.0f;
+    stats.atvr = vertexCount ? (float)misses / vertexCount : 0.0f;
+    return stats;
+}
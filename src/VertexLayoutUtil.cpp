@@ -0,0 +1,112 @@
+#include "../include/VertexLayoutUtil.h"
+
+#include <glm/gtc/packing.hpp>
+
+const VertexLayout PACKED_VERTEX_LAYOUT =
+{
+    sizeof(PackedVertex),
+    {
+        { 0, 3, GL_FLOAT,               GL_FALSE, offsetof(PackedVertex, position) },
+        { 1, 4, GL_INT_2_10_10_10_REV,  GL_TRUE,  offsetof(PackedVertex, normal) },
+        { 2, 2, GL_HALF_FLOAT,          GL_FALSE, offsetof(PackedVertex, uv) },
+        { 3, 4, GL_INT_2_10_10_10_REV,  GL_TRUE,  offsetof(PackedVertex, tangent) }
+    }
+};
+
+const VertexLayout SLIM_VERTEX_LAYOUT =
+{
+    sizeof(SlimVertex),
+    {
+        { 0, 3, GL_FLOAT,               GL_FALSE, offsetof(SlimVertex, position) },
+        { 1, 4, GL_INT_2_10_10_10_REV,  GL_TRUE,  offsetof(SlimVertex, normal) },
+        { 2, 2, GL_HALF_FLOAT,          GL_FALSE, offsetof(SlimVertex, uv) }
+    }
+};
+
+const VertexLayout POSITION_VERTEX_LAYOUT =
+{
+    3 * sizeof(float),
+    {
+        { 0, 3, GL_FLOAT,               GL_FALSE, 0 }
+    }
+};
+
+/**
+ * Pack separate float Streams into interleaved, quantized Vertices
+ *
+ * The Tangent w stores the Handedness, so the Bitangent is cross(N, T) * w in the Shader.
+ * @param vertices Positions (3 floats per Vertex)
+ * @param normals Normals (3 floats per Vertex)
+ * @param uvs UVs (2 floats per Vertex)
+ * @param tangents orthonormal Tangents with Handedness (4 floats per Vertex)
+ * @param packed packed Vertices
+ */
+void packVertices(
+    const std::vector<float>& vertices,
+    const std::vector<float>& normals,
+    const std::vector<float>& uvs,
+    const std::vector<float>& tangents,
+    std::vector<PackedVertex>& packed)
+{
+    size_t vertexCount = vertices.size() / 3;
+    packed.resize(vertexCount);
+
+    for (size_t i = 0; i < vertexCount; i++)
+    {
+        glm::vec3 n = glm::normalize(glm::vec3(normals[i * 3], normals[i * 3 + 1], normals[i * 3 + 2]));
+        glm::vec4 t(tangents[i * 4], tangents[i * 4 + 1], tangents[i * 4 + 2], tangents[i * 4 + 3]);
+
+        PackedVertex& v = packed[i];
+        v.position[0] = vertices[i * 3];
+        v.position[1] = vertices[i * 3 + 1];
+        v.position[2] = vertices[i * 3 + 2];
+        v.normal = glm::packSnorm3x10_1x2(glm::vec4(n, 0.0f));
+        v.uv[0] = glm::packHalf1x16(uvs[i * 2]);
+        v.uv[1] = glm::packHalf1x16(uvs[i * 2 + 1]);
+        v.tangent = glm::packSnorm3x10_1x2(t);
+    }
+}
+
+/**
+ * Pack separate float Streams into interleaved, quantized Vertices without Tangent
+ * @param vertices Positions (3 floats per Vertex)
+ * @param normals Normals (3 floats per Vertex)
+ * @param uvs UVs (2 floats per Vertex)
+ * @param packed packed Vertices
+ */
+void packVertices(
+    const std::vector<float>& vertices,
+    const std::vector<float>& normals,
+    const std::vector<float>& uvs,
+    std::vector<SlimVertex>& packed)
+{
+    size_t vertexCount = vertices.size() / 3;
+    packed.resize(vertexCount);
+
+    for (size_t i = 0; i < vertexCount; i++)
+    {
+        glm::vec3 n = glm::normalize(glm::vec3(normals[i * 3], normals[i * 3 + 1], normals[i * 3 + 2]));
+
+        SlimVertex& v = packed[i];
+        v.position[0] = vertices[i * 3];
+        v.position[1] = vertices[i * 3 + 1];
+        v.position[2] = vertices[i * 3 + 2];
+        v.normal = glm::packSnorm3x10_1x2(glm::vec4(n, 0.0f));
+        v.uv[0] = glm::packHalf1x16(uvs[i * 2]);
+        v.uv[1] = glm::packHalf1x16(uvs[i * 2 + 1]);
+    }
+}
+
+/**
+ * Set up all Attributes of a Layout for the bound VAO and GL_ARRAY_BUFFER
+ * @param layout Vertex Layout
+ */
+void applyVertexLayout(const VertexLayout& layout)
+{
+    for (const VertexAttribute& attribute : layout.attributes)
+    {
+        glVertexAttribPointer(attribute.location, attribute.components, attribute.type, attribute.normalized,
+            layout.stride, (void*)(size_t)attribute.offset);
+        glEnableVertexAttribArray(attribute.location);
+    }
+}